@@ -83,6 +83,8 @@ C_STD_HEADERS=(
 # Platform headers plugins may use (POSIX / Windows file I/O, dlopen).
 PLATFORM_HEADERS=(
     "unistd.h" "fcntl.h" "io.h" "share.h" "windows.h" "dlfcn.h"
+    # Compiler-provided SIMD intrinsics (shared gf256 kernels)
+    "immintrin.h" "intrin.h" "tmmintrin.h" "emmintrin.h"
 )
 
 # Permitted third-party header prefixes/names. fmt and spdlog are permitted
@@ -0,0 +1,183 @@
+/*
+ * File:        bench_harness.cpp
+ * Module:      orc-bench
+ * Purpose:     Case selection, timing and JSON reporting shared by every
+ *              orc-bench suite
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "bench_harness.h"
+
+#include <atomic>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <thread>
+
+#include "version.h"
+
+#ifndef ORC_BENCH_BUILD_TYPE
+#define ORC_BENCH_BUILD_TYPE ""
+#endif
+
+namespace orc_bench {
+
+namespace {
+
+std::atomic<uint64_t> g_sink{0};
+
+std::string json_string(const std::string& value) {
+  std::string out = "\"";
+  for (const char c : value) {
+    switch (c) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[8];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          out += escaped;
+        } else {
+          out += c;
+        }
+    }
+  }
+  return out + "\"";
+}
+
+std::string json_number(double value) {
+  char text[32];
+  std::snprintf(text, sizeof(text), "%.6g", value);
+  return text;
+}
+
+std::string utc_timestamp() {
+  const std::time_t now = std::time(nullptr);
+  std::tm utc{};
+#if defined(_WIN32)
+  gmtime_s(&utc, &now);
+#else
+  gmtime_r(&now, &utc);
+#endif
+  char text[32];
+  std::strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%SZ", &utc);
+  return text;
+}
+
+std::string compiler_id() {
+#if defined(__clang__)
+  return std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+  return std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+  return "msvc " + std::to_string(_MSC_VER);
+#else
+  return "unknown";
+#endif
+}
+
+}  // namespace
+
+void keep(uint64_t value) {
+  g_sink.fetch_xor(value, std::memory_order_relaxed);
+}
+
+BenchRunner::BenchRunner(Options options) : options_(std::move(options)) {}
+
+bool BenchRunner::selected(const std::string& suite,
+                           const std::string& name) const {
+  return options_.filter.empty() ||
+         (suite + "/" + name).find(options_.filter) != std::string::npos;
+}
+
+void BenchRunner::list_case(const std::string& suite, const std::string& name,
+                            const std::string& unit) const {
+  std::printf("%s/%s  [%s]\n", suite.c_str(), name.c_str(), unit.c_str());
+}
+
+void BenchRunner::record(CaseResult result) {
+  double rate = result.items_per_second();
+  const char* scale = "";
+  if (rate >= 1e6) {
+    rate /= 1e6;
+    scale = "M";
+  } else if (rate >= 1e3) {
+    rate /= 1e3;
+    scale = "k";
+  }
+  const std::string id = result.suite + "/" + result.name;
+  std::printf("%-56s %10.2f %s%s/s\n", id.c_str(), rate, scale,
+              result.unit.c_str());
+  std::fflush(stdout);
+  results_.push_back(std::move(result));
+}
+
+void BenchRunner::skip(const std::string& suite, const std::string& name,
+                       const std::string& reason) {
+  if (!selected(suite, name) || options_.list) return;
+  const std::string id = suite + "/" + name;
+  std::printf("%-56s skipped: %s\n", id.c_str(), reason.c_str());
+  skipped_.emplace_back(id, reason);
+}
+
+bool BenchRunner::write_json(const std::string& path,
+                             std::string& error) const {
+  std::ofstream out(path, std::ios::trunc);
+  if (!out) {
+    error = "cannot open '" + path + "' for writing";
+    return false;
+  }
+
+  // Schema version 1. Consumers compare runs by "suite"/"name" and should
+  // ignore members they do not know.
+  out << "{\n";
+  out << "  \"schema\": 1,\n";
+  out << "  \"tool\": \"orc-bench\",\n";
+  out << "  \"orc_version\": " << json_string(ORC_VERSION) << ",\n";
+  out << "  \"build_type\": " << json_string(ORC_BENCH_BUILD_TYPE) << ",\n";
+  out << "  \"compiler\": " << json_string(compiler_id()) << ",\n";
+  out << "  \"hardware_threads\": " << std::thread::hardware_concurrency()
+      << ",\n";
+  out << "  \"timestamp\": " << json_string(utc_timestamp()) << ",\n";
+  out << "  \"seconds_per_case\": " << json_number(options_.seconds) << ",\n";
+
+  out << "  \"results\": [";
+  for (size_t i = 0; i < results_.size(); ++i) {
+    const CaseResult& r = results_[i];
+    out << (i == 0 ? "\n" : ",\n");
+    out << "    {\"suite\": " << json_string(r.suite)
+        << ", \"name\": " << json_string(r.name)
+        << ", \"unit\": " << json_string(r.unit)
+        << ", \"items_per_second\": " << json_number(r.items_per_second())
+        << ", \"items\": " << r.items << ", \"passes\": " << r.passes
+        << ", \"elapsed_seconds\": " << json_number(r.elapsed_seconds) << "}";
+  }
+  out << (results_.empty() ? "],\n" : "\n  ],\n");
+
+  out << "  \"skipped\": [";
+  for (size_t i = 0; i < skipped_.size(); ++i) {
+    out << (i == 0 ? "\n" : ",\n");
+    out << "    {\"id\": " << json_string(skipped_[i].first)
+        << ", \"reason\": " << json_string(skipped_[i].second) << "}";
+  }
+  out << (skipped_.empty() ? "]\n" : "\n  ]\n");
+  out << "}\n";
+
+  out.close();
+  if (!out) {
+    error = "failed writing '" + path + "'";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace orc_bench
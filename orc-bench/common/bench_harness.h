@@ -0,0 +1,132 @@
+/*
+ * File:        bench_harness.h
+ * Module:      orc-bench
+ * Purpose:     Case selection, timing and JSON reporting shared by every
+ *              orc-bench suite
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace orc_bench {
+
+// Command-line settings shared by all suites.
+struct Options {
+  double seconds = 1.0;     // minimum measured time per case
+  std::string filter;       // substring of "suite/case"; empty = all
+  std::string json_path;    // write results here when non-empty
+  std::string fixture_dir;  // keep file fixtures here (default: temp dir)
+  bool list = false;        // print case ids instead of running them
+};
+
+// One measured case.
+struct CaseResult {
+  std::string suite;
+  std::string name;
+  std::string unit;        // what an item is: "frames", "codewords", ...
+  uint64_t items = 0;      // items processed in the measured window
+  uint64_t passes = 0;     // measured passes (warm-up excluded)
+  double elapsed_seconds = 0.0;
+
+  double items_per_second() const {
+    return elapsed_seconds > 0.0 ? static_cast<double>(items) / elapsed_seconds
+                                 : 0.0;
+  }
+};
+
+// Folds |value| into a process-wide sink so the optimiser cannot discard the
+// work that produced it.
+void keep(uint64_t value);
+
+// A fixture built on first use. Suites declare their fixtures up front and
+// get() them inside the case, so filtered-out and listed cases never pay for
+// set-up, and the build lands in run()'s untimed warm-up pass.
+template <typename T>
+class Lazy {
+ public:
+  explicit Lazy(std::function<T()> make) : make_(std::move(make)) {}
+
+  T& get() {
+    if (!value_) value_.emplace(make_());
+    return *value_;
+  }
+
+ private:
+  std::function<T()> make_;
+  std::optional<T> value_;
+};
+
+// Runs the cases the options select and collects their results.
+//
+// A case is a callable performing one pass over a fixed workload and
+// returning the number of items it processed. run() calls it once untimed
+// (first-touch page faults, lazily built tables and caches belong to
+// set-up, not to the steady state being measured), then repeatedly until
+// Options::seconds have elapsed, and records items per second.
+class BenchRunner {
+ public:
+  explicit BenchRunner(Options options);
+
+  const Options& options() const { return options_; }
+
+  // True if "suite/name" matches the filter.
+  bool selected(const std::string& suite, const std::string& name) const;
+
+  template <typename Pass>
+  void run(const std::string& suite, const std::string& name,
+           const std::string& unit, Pass pass) {
+    if (!selected(suite, name)) return;
+    if (options_.list) {
+      list_case(suite, name, unit);
+      return;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    keep(static_cast<uint64_t>(pass()));  // warm-up
+
+    CaseResult result;
+    result.suite = suite;
+    result.name = name;
+    result.unit = unit;
+    const auto start = Clock::now();
+    do {
+      result.items += static_cast<uint64_t>(pass());
+      ++result.passes;
+      result.elapsed_seconds =
+          std::chrono::duration<double>(Clock::now() - start).count();
+    } while (result.elapsed_seconds < options_.seconds);
+    record(std::move(result));
+  }
+
+  // Records a case that could not run (missing input, unsupported CPU, ...).
+  void skip(const std::string& suite, const std::string& name,
+            const std::string& reason);
+
+  const std::vector<CaseResult>& results() const { return results_; }
+
+  // Writes every result as one JSON document. Returns false and sets
+  // |error| if the file cannot be written.
+  bool write_json(const std::string& path, std::string& error) const;
+
+ private:
+  void list_case(const std::string& suite, const std::string& name,
+                 const std::string& unit) const;
+  void record(CaseResult result);
+
+  Options options_;
+  std::vector<CaseResult> results_;
+  std::vector<std::pair<std::string, std::string>> skipped_;  // id, reason
+};
+
+}  // namespace orc_bench
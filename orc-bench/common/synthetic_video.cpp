@@ -0,0 +1,541 @@
+/*
+ * File:        synthetic_video.cpp
+ * Module:      orc-bench
+ * Purpose:     Deterministic synthetic PAL / NTSC signal, in-memory sources
+ *              and on-disk CVBS / TBC fixtures for the benchmarks
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "synthetic_video.h"
+
+#include <orc/stage/cvbs_signal_constants.h>
+#include <orc/support/dropout_util.h>
+#include <orc/support/frame_line_util.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+
+namespace orc_bench {
+
+namespace {
+
+using orc::VideoSystem;
+
+struct Levels {
+  int32_t sync_tip;
+  int32_t blanking;
+  int32_t white;
+  int32_t sync_end;  // end of the line-sync pulse (~4.7 us)
+  int32_t burst_start;
+  int32_t burst_end;
+  int32_t active_start;
+  int32_t active_end;
+  int32_t first_active_field_line;
+};
+
+const Levels& levels_for(VideoSystem system) {
+  static const Levels kPal{orc::kPalSyncTip,          orc::kPalBlanking,
+                           orc::kPalWhite,            83,
+                           orc::kPalColourBurstStart, orc::kPalColourBurstEnd,
+                           orc::kPalActiveVideoStart, orc::kPalActiveVideoEnd,
+                           orc::kPalFirstActiveLine};
+  static const Levels kNtsc{
+      orc::kNtscSyncTip,          orc::kNtscBlanking,
+      orc::kNtscWhite,            67,
+      orc::kNtscColourBurstStart, orc::kNtscColourBurstEnd,
+      orc::kNtscActiveVideoStart, orc::kNtscActiveVideoEnd,
+      orc::kNtscFirstActiveLine};
+  return system == VideoSystem::PAL ? kPal : kNtsc;
+}
+
+// 75% colour bars (white, yellow, cyan, green, magenta, red, blue, black) as
+// luma and colour-difference amplitudes relative to the white level.
+struct Bar {
+  double y;
+  double u;
+  double v;
+};
+
+const std::array<Bar, 8>& colour_bars() {
+  static const std::array<Bar, 8> bars = [] {
+    constexpr int kRgb[8][3] = {{1, 1, 1}, {1, 1, 0}, {0, 1, 1}, {0, 1, 0},
+                                {1, 0, 1}, {1, 0, 0}, {0, 0, 1}, {0, 0, 0}};
+    std::array<Bar, 8> result{};
+    for (size_t i = 0; i < result.size(); ++i) {
+      const double r = 0.75 * kRgb[i][0];
+      const double g = 0.75 * kRgb[i][1];
+      const double b = 0.75 * kRgb[i][2];
+      const double y = 0.299 * r + 0.587 * g + 0.114 * b;
+      result[i] = {y, 0.493 * (b - y), 0.877 * (r - y)};
+    }
+    return result;
+  }();
+  return bars;
+}
+
+// Subcarrier at four samples per cycle: sin and cos of phase index & 3.
+constexpr double kSin[4] = {0.0, 1.0, 0.0, -1.0};
+constexpr double kCos[4] = {1.0, 0.0, -1.0, 0.0};
+
+uint32_t mix_seed(uint32_t seed, uint32_t index, uint32_t salt) {
+  return seed * 2654435761u ^ (index + 0x9e3779b9u + (salt << 6));
+}
+
+// Renders |count| samples of frame line |frame_line| (field 1 lines first)
+// in the CVBS_U10_4FSC domain. |phase_origin| is the line's first sample
+// position in the continuous sample stream and fixes the subcarrier phase.
+void render_line(const SyntheticFormat& format, size_t frame_line,
+                 uint32_t frame, uint64_t phase_origin, std::mt19937& rng,
+                 int16_t* out, size_t count) {
+  const Levels& lv = levels_for(format.system);
+  const auto& bars = colour_bars();
+  const size_t field_line = frame_line < format.field1_lines
+                                ? frame_line
+                                : frame_line - format.field1_lines;
+  const bool active =
+      field_line >= static_cast<size_t>(lv.first_active_field_line);
+  const double span = lv.white - lv.blanking;
+  const double v_switch =
+      (format.system == VideoSystem::PAL &&
+       (static_cast<uint64_t>(frame) * format.frame_lines + frame_line) % 2)
+          ? -1.0
+          : 1.0;
+  const int32_t active_width = lv.active_end - lv.active_start;
+
+  for (size_t i = 0; i < count; ++i) {
+    const int32_t x = static_cast<int32_t>(i);
+    const size_t phase = static_cast<size_t>((phase_origin + i) & 3);
+    double value = lv.blanking;
+    if (x < lv.sync_end) {
+      value = lv.sync_tip;
+    } else if (active && x >= lv.burst_start && x < lv.burst_end) {
+      // PAL: +/-135 degree swinging burst; NTSC: 180 degrees.
+      const double burst =
+          format.system == VideoSystem::PAL
+              ? 0.15 * (-kSin[phase] + v_switch * kCos[phase]) / 1.41421356
+              : -0.15 * kSin[phase];
+      value += span * burst;
+    } else if (active && x >= lv.active_start && x < lv.active_end) {
+      const size_t bar = static_cast<size_t>(
+          ((x - lv.active_start + 2 * static_cast<int32_t>(frame % 1024)) *
+           8 / active_width) %
+          8);
+      const Bar& b = bars[bar];
+      value += span * (b.y + b.u * kSin[phase] + v_switch * b.v * kCos[phase]);
+    }
+    if (x >= lv.sync_end) {
+      value += static_cast<double>(static_cast<int32_t>(rng() % 9) - 4);
+    }
+    out[i] = static_cast<int16_t>(std::clamp(value, 0.0, 1023.0));
+  }
+}
+
+uint16_t to_tbc_domain(const SyntheticFormat& format, int16_t sample) {
+  const Levels& lv = levels_for(format.system);
+  const double scale =
+      static_cast<double>(format.tbc_white - format.tbc_blanking) /
+      (lv.white - lv.blanking);
+  const double value = format.tbc_blanking + (sample - lv.blanking) * scale;
+  return static_cast<uint16_t>(std::clamp(value, 0.0, 65535.0));
+}
+
+int32_t colour_frame_index(VideoSystem system, uint32_t frame) {
+  return system == VideoSystem::PAL ? static_cast<int32_t>(frame % 4) + 1
+                                    : static_cast<int32_t>(frame % 2);
+}
+
+// Appends |samples| as little-endian 16-bit words.
+template <typename Sample>
+void append_le16(std::vector<char>& bytes, const std::vector<Sample>& samples) {
+  for (const Sample s : samples) {
+    const auto word = static_cast<uint16_t>(s);
+    bytes.push_back(static_cast<char>(word & 0xFF));
+    bytes.push_back(static_cast<char>(word >> 8));
+  }
+}
+
+bool file_has_size(const std::filesystem::path& path, uintmax_t size) {
+  std::error_code ec;
+  return std::filesystem::file_size(path, ec) == size && !ec;
+}
+
+void write_file(const std::filesystem::path& path,
+                const std::vector<char>& bytes) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+  if (!out) {
+    throw std::runtime_error("orc-bench: cannot write fixture " +
+                             path.string());
+  }
+}
+
+std::string fixture_stem(VideoSystem system, size_t frames, uint32_t seed) {
+  return std::string("synthetic_") +
+         (system == VideoSystem::PAL ? "pal_" : "ntsc_") +
+         std::to_string(frames) + "f_s" + std::to_string(seed);
+}
+
+}  // namespace
+
+const SyntheticFormat& synthetic_format(VideoSystem system) {
+  static const SyntheticFormat kPal{
+      VideoSystem::PAL,
+      static_cast<size_t>(orc::kPalSamplesPerLineNominal),
+      static_cast<size_t>(orc::kPalFrameLines),
+      static_cast<size_t>(orc::kPalField1Lines),
+      static_cast<size_t>(orc::kPalFrameSamples),
+      static_cast<size_t>(orc::kPalField1Lines),
+      orc::kTbcPalBlanking,
+      orc::kTbcPalWhite};
+  static const SyntheticFormat kNtsc{
+      VideoSystem::NTSC,
+      static_cast<size_t>(orc::kNtscSamplesPerLine),
+      static_cast<size_t>(orc::kNtscFrameLines),
+      static_cast<size_t>(orc::kNtscField1Lines),
+      static_cast<size_t>(orc::kNtscFrameSamples),
+      static_cast<size_t>(orc::kNtscField1Lines),
+      orc::kTbcNtscBlanking,
+      orc::kTbcNtscWhite};
+  switch (system) {
+    case VideoSystem::PAL:
+      return kPal;
+    case VideoSystem::NTSC:
+      return kNtsc;
+    default:
+      throw std::invalid_argument(
+          "orc-bench: synthetic fixtures cover PAL and NTSC only");
+  }
+}
+
+orc::SourceParameters synthetic_source_parameters(VideoSystem system,
+                                                  int32_t frame_count) {
+  const SyntheticFormat& format = synthetic_format(system);
+  const Levels& lv = levels_for(system);
+  orc::SourceParameters sp;
+  sp.system = system;
+  sp.number_of_sequential_frames = frame_count;
+  sp.frame_width_nominal = static_cast<int32_t>(format.samples_per_line);
+  sp.frame_height = static_cast<int32_t>(format.frame_lines);
+  sp.sync_tip_level = lv.sync_tip;
+  sp.blanking_level = lv.blanking;
+  sp.black_level =
+      system == VideoSystem::PAL ? orc::kPalBlack : orc::kNtscBlack;
+  sp.white_level = lv.white;
+  sp.peak_level = system == VideoSystem::PAL ? orc::kPalPeak : orc::kNtscPeak;
+  sp.active_video_start = lv.active_start;
+  sp.active_video_end = lv.active_end;
+  sp.first_active_frame_line = system == VideoSystem::PAL
+                                   ? orc::kPalFirstActiveFrameLine
+                                   : orc::kNtscFirstActiveFrameLine;
+  sp.last_active_frame_line = system == VideoSystem::PAL
+                                  ? orc::kPalLastActiveFrameLine
+                                  : orc::kNtscLastActiveFrameLine;
+  sp.tape_format = "synthetic";
+  sp.decoder = "orc-bench";
+  return sp;
+}
+
+std::vector<int16_t> make_cvbs_frame(VideoSystem system, uint32_t frame,
+                                     uint32_t seed) {
+  const SyntheticFormat& format = synthetic_format(system);
+  std::vector<int16_t> samples(format.frame_samples);
+  std::mt19937 rng(mix_seed(seed, frame, 1));
+  const uint64_t frame_origin =
+      static_cast<uint64_t>(frame) * format.frame_samples;
+  for (size_t line = 0; line < format.frame_lines; ++line) {
+    const size_t offset = orc::frame_line_sample_offset(
+        system, format.samples_per_line, line);
+    const size_t count = orc::frame_line_sample_count(
+        system, format.samples_per_line, line);
+    render_line(format, line, frame, frame_origin + offset, rng,
+                samples.data() + offset, count);
+  }
+  return samples;
+}
+
+std::vector<uint16_t> make_tbc_field(VideoSystem system, uint32_t field,
+                                     uint32_t seed) {
+  const SyntheticFormat& format = synthetic_format(system);
+  const uint32_t frame = field / 2;
+  const bool first = field % 2 == 0;
+  const size_t lines =
+      first ? format.field1_lines : format.frame_lines - format.field1_lines;
+  const size_t first_line = first ? 0 : format.field1_lines;
+  const uint64_t frame_origin =
+      static_cast<uint64_t>(frame) * format.frame_samples;
+
+  std::vector<uint16_t> samples(
+      format.tbc_field_lines * format.samples_per_line,
+      static_cast<uint16_t>(format.tbc_blanking));
+  std::vector<int16_t> line_samples(format.samples_per_line);
+  std::mt19937 rng(mix_seed(seed, field, 2));
+  for (size_t i = 0; i < lines; ++i) {
+    const size_t line = first_line + i;
+    render_line(format, line, frame,
+                frame_origin + orc::frame_line_sample_offset(
+                                   system, format.samples_per_line, line),
+                rng, line_samples.data(), line_samples.size());
+    std::transform(line_samples.begin(), line_samples.end(),
+                   samples.begin() + i * format.samples_per_line,
+                   [&](int16_t s) { return to_tbc_domain(format, s); });
+  }
+  return samples;
+}
+
+std::vector<orc::DropoutRun> make_dropout_runs(VideoSystem system,
+                                               orc::FrameID frame,
+                                               uint32_t seed, size_t count) {
+  const SyntheticFormat& format = synthetic_format(system);
+  const Levels& lv = levels_for(system);
+  std::mt19937 rng(mix_seed(seed, static_cast<uint32_t>(frame), 3));
+  const size_t active_lines =
+      format.field1_lines - static_cast<size_t>(lv.first_active_field_line);
+
+  std::vector<orc::DropoutRun> runs;
+  runs.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    const int32_t field = 1 + static_cast<int32_t>(rng() % 2);
+    const int32_t line = lv.first_active_field_line +
+                         static_cast<int32_t>(rng() % (active_lines - 1));
+    const uint32_t length = 4 + rng() % 45;
+    const int32_t start =
+        lv.active_start +
+        static_cast<int32_t>(rng() % static_cast<uint32_t>(
+                                         lv.active_end - lv.active_start - 48));
+    orc::DropoutRun run;
+    run.frame_id = frame;
+    run.sample_start =
+        orc::dropout_util::field_line_to_frame_sample(system, field, line,
+                                                      start);
+    run.sample_count = length;
+    run.severity = static_cast<uint8_t>(rng() % 101);
+    runs.push_back(run);
+  }
+  std::sort(runs.begin(), runs.end(),
+            [](const orc::DropoutRun& a, const orc::DropoutRun& b) {
+              return a.sample_start < b.sample_start;
+            });
+  return runs;
+}
+
+uint64_t frame_digest(const orc::FrameHandle& frame) {
+  if (!frame || !frame->samples) return 0;
+  const std::vector<int16_t>& samples = *frame->samples;
+  uint64_t sum = 0;
+  for (size_t i = 0; i < samples.size(); i += 4099) {
+    sum += static_cast<uint16_t>(samples[i]);
+  }
+  return sum;
+}
+
+// ---------------------------------------------------------------------------
+// SyntheticVideoSource
+// ---------------------------------------------------------------------------
+
+SyntheticVideoSource::SyntheticVideoSource(VideoSystem system, size_t frames,
+                                           uint32_t seed,
+                                           size_t dropouts_per_frame)
+    : system_(system) {
+  frames_.reserve(frames);
+  dropouts_.reserve(frames);
+  for (size_t f = 0; f < frames; ++f) {
+    frames_.push_back(std::make_shared<const std::vector<int16_t>>(
+        make_cvbs_frame(system, static_cast<uint32_t>(f), seed)));
+    dropouts_.push_back(
+        make_dropout_runs(system, f, seed, dropouts_per_frame));
+  }
+}
+
+orc::FrameIDRange SyntheticVideoSource::frame_range() const {
+  return {orc::FrameID{0},
+          orc::FrameID{frames_.empty() ? 0 : frames_.size() - 1}};
+}
+
+std::optional<orc::FrameDescriptor> SyntheticVideoSource::get_frame_descriptor(
+    orc::FrameID id) const {
+  if (!has_frame(id)) return std::nullopt;
+  const SyntheticFormat& format = synthetic_format(system_);
+  orc::FrameDescriptor desc;
+  desc.frame_id = id;
+  desc.system = system_;
+  desc.height = format.frame_lines;
+  desc.samples_total = format.frame_samples;
+  desc.samples_per_line_nominal = format.samples_per_line;
+  desc.colour_frame_index =
+      colour_frame_index(system_, static_cast<uint32_t>(id));
+  return desc;
+}
+
+const orc::VideoFrameRepresentation::sample_type*
+SyntheticVideoSource::get_frame(orc::FrameID id) const {
+  return has_frame(id) ? frames_[id]->data() : nullptr;
+}
+
+std::vector<orc::VideoFrameRepresentation::sample_type>
+SyntheticVideoSource::get_frame_copy(orc::FrameID id) const {
+  return has_frame(id) ? *frames_[id] : std::vector<sample_type>{};
+}
+
+orc::FrameHandle SyntheticVideoSource::acquire_frame(orc::FrameID id) const {
+  if (!has_frame(id)) return nullptr;
+  auto frame = std::make_shared<orc::AcquiredFrame>();
+  frame->frame_id = id;
+  frame->samples = frames_[id];
+  frame->dropouts = dropouts_[id];
+  return frame;
+}
+
+std::vector<orc::DropoutRun> SyntheticVideoSource::get_dropout_hints(
+    orc::FrameID id) const {
+  return has_frame(id) ? dropouts_[id] : std::vector<orc::DropoutRun>{};
+}
+
+std::optional<orc::SourceParameters>
+SyntheticVideoSource::get_video_parameters() const {
+  return synthetic_source_parameters(system_,
+                                     static_cast<int32_t>(frames_.size()));
+}
+
+// ---------------------------------------------------------------------------
+// File fixtures
+// ---------------------------------------------------------------------------
+
+FixtureDirectory::FixtureDirectory(const std::string& path) {
+  namespace fs = std::filesystem;
+  if (path.empty()) {
+    const auto stamp =
+        std::chrono::steady_clock::now().time_since_epoch().count();
+    path_ = (fs::temp_directory_path() /
+             ("orc-bench-" + std::to_string(static_cast<uint64_t>(stamp))))
+                .string();
+    owned_ = true;
+  } else {
+    path_ = path;
+  }
+  fs::create_directories(path_);
+}
+
+FixtureDirectory::~FixtureDirectory() {
+  if (!owned_) return;
+  std::error_code ec;
+  std::filesystem::remove_all(path_, ec);
+}
+
+std::string write_cvbs_fixture(const std::string& directory,
+                               VideoSystem system, size_t frames,
+                               uint32_t seed) {
+  const SyntheticFormat& format = synthetic_format(system);
+  const std::filesystem::path path =
+      std::filesystem::path(directory) /
+      (fixture_stem(system, frames, seed) + ".cvbs");
+  if (file_has_size(path, frames * format.frame_samples * 2)) {
+    return path.string();
+  }
+
+  std::vector<char> bytes;
+  bytes.reserve(frames * format.frame_samples * 2);
+  for (size_t f = 0; f < frames; ++f) {
+    append_le16(bytes, make_cvbs_frame(system, static_cast<uint32_t>(f), seed));
+  }
+  write_file(path, bytes);
+  return path.string();
+}
+
+std::string write_tbc_fixture(const std::string& directory,
+                              VideoSystem system, size_t frames,
+                              uint32_t seed, size_t dropouts_per_frame) {
+  const SyntheticFormat& format = synthetic_format(system);
+  const Levels& lv = levels_for(system);
+  const std::filesystem::path tbc_path =
+      std::filesystem::path(directory) /
+      (fixture_stem(system, frames, seed) + "_d" +
+       std::to_string(dropouts_per_frame) + ".tbc");
+  std::filesystem::path json_path = tbc_path;
+  json_path += ".json";
+  const size_t field_samples = format.tbc_field_lines * format.samples_per_line;
+  if (file_has_size(tbc_path, frames * 2 * field_samples * 2) &&
+      std::filesystem::exists(json_path)) {
+    return tbc_path.string();
+  }
+
+  std::vector<char> bytes;
+  bytes.reserve(frames * 2 * field_samples * 2);
+  for (size_t field = 0; field < frames * 2; ++field) {
+    append_le16(bytes,
+                make_tbc_field(system, static_cast<uint32_t>(field), seed));
+  }
+  write_file(tbc_path, bytes);
+
+  // Legacy ld-decode JSON sidecar. NTSC stores the 7.5 IRE pedestal as
+  // black16bIre; the reader derives blanking from it.
+  const bool pal = system == VideoSystem::PAL;
+  std::string json = "{\"videoParameters\": {";
+  json += "\"system\": \"" + std::string(pal ? "PAL" : "NTSC") + "\"";
+  json += ", \"numberOfSequentialFields\": " + std::to_string(frames * 2);
+  json += ", \"fieldWidth\": " + std::to_string(format.samples_per_line);
+  json += ", \"fieldHeight\": " + std::to_string(format.tbc_field_lines);
+  json += ", \"sampleRate\": " +
+          std::to_string(static_cast<int64_t>(
+              pal ? orc::kPalSampleRate : orc::kNtscSampleRate));
+  json += ", \"activeVideoStart\": " + std::to_string(lv.active_start);
+  json += ", \"activeVideoEnd\": " + std::to_string(lv.active_end);
+  json += ", \"colourBurstStart\": " + std::to_string(lv.burst_start);
+  json += ", \"colourBurstEnd\": " + std::to_string(lv.burst_end);
+  json += ", \"black16bIre\": " +
+          std::to_string(pal ? orc::kTbcPalBlanking : orc::kTbcNtscBlack);
+  json += ", \"white16bIre\": " + std::to_string(format.tbc_white);
+  json += ", \"isMapped\": false, \"isSubcarrierLocked\": true";
+  json += ", \"isWidescreen\": false, \"tapeFormat\": \"synthetic\"";
+  json += "}, \"pcmAudioParameters\": {\"bits\": 16, \"isLittleEndian\": true";
+  json += ", \"isSigned\": true, \"sampleRate\": 44100";
+  json += "}, \"fields\": [";
+
+  for (size_t frame = 0; frame < frames; ++frame) {
+    // Per-field dropouts, converted from the frame-flat runs.
+    std::array<std::string, 2> starts, ends, lines;
+    for (const auto& run :
+         make_dropout_runs(system, frame, seed, dropouts_per_frame)) {
+      const auto at =
+          orc::dropout_util::frame_sample_to_field_line(system,
+                                                        run.sample_start);
+      const size_t f = static_cast<size_t>(at.field - 1);
+      const char* sep = starts[f].empty() ? "" : ", ";
+      starts[f] += sep + std::to_string(at.sample);
+      ends[f] += sep + std::to_string(at.sample + run.sample_count - 1);
+      lines[f] += sep + std::to_string(at.line + 1);  // 1-based
+    }
+
+    const int32_t cfi =
+        colour_frame_index(system, static_cast<uint32_t>(frame));
+    for (size_t f = 0; f < 2; ++f) {
+      // PAL field phases run 1-8 over four frames, NTSC 1-4 over two.
+      const int32_t phase =
+          pal ? 2 * (cfi - 1) + 1 + static_cast<int32_t>(f)
+              : 2 * cfi + 1 + static_cast<int32_t>(f);
+      json += (frame == 0 && f == 0) ? "\n" : ",\n";
+      json += "{\"seqNo\": " + std::to_string(frame * 2 + f + 1);
+      json += ", \"isFirstField\": " + std::string(f == 0 ? "true" : "false");
+      json += ", \"fieldPhaseID\": " + std::to_string(phase);
+      json += ", \"syncConf\": 100, \"medianBurstIRE\": 20, \"pad\": false";
+      if (!starts[f].empty()) {
+        json += ", \"dropOuts\": {\"startx\": [" + starts[f] +
+                "], \"endx\": [" + ends[f] + "], \"fieldLine\": [" +
+                lines[f] + "]}";
+      }
+      json += "}";
+    }
+  }
+  json += "\n]}\n";
+  write_file(json_path, std::vector<char>(json.begin(), json.end()));
+  return tbc_path.string();
+}
+
+}  // namespace orc_bench
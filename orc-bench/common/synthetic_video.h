@@ -0,0 +1,133 @@
+/*
+ * File:        synthetic_video.h
+ * Module:      orc-bench
+ * Purpose:     Deterministic synthetic PAL / NTSC signal, in-memory sources
+ *              and on-disk CVBS / TBC fixtures for the benchmarks
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <orc/stage/video_frame_representation.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace orc_bench {
+
+// The test signal is 75% colour bars with sync, colour burst and blanked
+// vertical-interval lines, plus a few LSBs of noise. The bars move two
+// samples per frame and the noise is drawn from a generator seeded by
+// (seed, frame), so every frame differs, different seeds give the "same
+// picture from another capture" that the stacker expects, and a given
+// (system, frame, seed) always renders identically. The subcarrier is
+// continuous at four samples per cycle; PAL lines alternate the V phase.
+
+// Geometry and levels of a supported system (PAL or NTSC).
+struct SyntheticFormat {
+  orc::VideoSystem system;
+  size_t samples_per_line;  // nominal
+  size_t frame_lines;
+  size_t field1_lines;
+  size_t frame_samples;     // flat CVBS_U10_4FSC frame
+  size_t tbc_field_lines;   // lines stored per TBC field (padded)
+  int32_t tbc_blanking;     // ld-decode 16-bit domain
+  int32_t tbc_white;
+};
+
+// Throws std::invalid_argument for systems other than PAL and NTSC.
+const SyntheticFormat& synthetic_format(orc::VideoSystem system);
+
+// Canonical SourceParameters of |system| (the CVBS source's values).
+orc::SourceParameters synthetic_source_parameters(orc::VideoSystem system,
+                                                  int32_t frame_count);
+
+// Frame |frame| in the CVBS_U10_4FSC domain (frame_samples samples, field 1
+// lines then field 2 lines).
+std::vector<int16_t> make_cvbs_frame(orc::VideoSystem system, uint32_t frame,
+                                     uint32_t seed);
+
+// TBC field |field| (even = first field of frame field / 2) in the ld-decode
+// 16-bit domain, tbc_field_lines x samples_per_line samples. The shorter
+// second field carries one blanked padding line, as ld-decode stores it.
+std::vector<uint16_t> make_tbc_field(orc::VideoSystem system, uint32_t field,
+                                     uint32_t seed);
+
+// Deterministic dropouts on active lines of |frame|: |count| runs of 4-48
+// samples.
+std::vector<orc::DropoutRun> make_dropout_runs(orc::VideoSystem system,
+                                               orc::FrameID frame,
+                                               uint32_t seed, size_t count);
+
+// Cheap digest of an acquired frame (a strided sample sum) to pass to keep().
+// Zero for a null handle or an empty frame.
+uint64_t frame_digest(const orc::FrameHandle& frame);
+
+// In-memory composite source over pre-rendered frames, reporting
+// make_dropout_runs() hints. Frames are rendered once, at construction.
+class SyntheticVideoSource : public orc::VideoFrameRepresentation {
+ public:
+  SyntheticVideoSource(orc::VideoSystem system, size_t frames, uint32_t seed,
+                       size_t dropouts_per_frame);
+
+  orc::FrameIDRange frame_range() const override;
+  size_t frame_count() const override { return frames_.size(); }
+  bool has_frame(orc::FrameID id) const override {
+    return id < frames_.size();
+  }
+  std::optional<orc::FrameDescriptor> get_frame_descriptor(
+      orc::FrameID id) const override;
+
+  const sample_type* get_frame(orc::FrameID id) const override;
+  std::vector<sample_type> get_frame_copy(orc::FrameID id) const override;
+  orc::FrameHandle acquire_frame(orc::FrameID id) const override;
+
+  std::vector<orc::DropoutRun> get_dropout_hints(
+      orc::FrameID id) const override;
+  std::optional<orc::SourceParameters> get_video_parameters() const override;
+
+ private:
+  orc::VideoSystem system_;
+  std::vector<orc::SharedSampleBuffer> frames_;
+  std::vector<std::vector<orc::DropoutRun>> dropouts_;
+};
+
+// Directory for file fixtures. Without a path it creates a fresh temporary
+// directory and removes it (with its contents) on destruction; a supplied
+// path is created if needed and kept.
+class FixtureDirectory {
+ public:
+  explicit FixtureDirectory(const std::string& path = {});
+  ~FixtureDirectory();
+
+  FixtureDirectory(const FixtureDirectory&) = delete;
+  FixtureDirectory& operator=(const FixtureDirectory&) = delete;
+
+  const std::string& path() const { return path_; }
+
+ private:
+  std::string path_;
+  bool owned_ = false;
+};
+
+// Writes |frames| frames as a raw CVBS_U10_4FSC file (no .meta sidecar; the
+// CVBS source is configured with an explicit sample encoding) and returns
+// its path. Existing files of the same name are reused.
+std::string write_cvbs_fixture(const std::string& directory,
+                               orc::VideoSystem system, size_t frames,
+                               uint32_t seed);
+
+// Writes |frames| frames as a composite .tbc file with a legacy ld-decode
+// .tbc.json sidecar carrying per-field phase IDs and make_dropout_runs()
+// dropouts, and returns the .tbc path. Existing files are reused.
+std::string write_tbc_fixture(const std::string& directory,
+                              orc::VideoSystem system, size_t frames,
+                              uint32_t seed, size_t dropouts_per_frame);
+
+}  // namespace orc_bench
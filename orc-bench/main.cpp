@@ -0,0 +1,124 @@
+/*
+ * File:        main.cpp
+ * Module:      orc-bench
+ * Purpose:     orc-bench entry point: option parsing and suite dispatch
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include <orc/support/logging.h>
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+
+#include "bench_harness.h"
+
+namespace orc_bench {
+
+// One entry point per suite (micro/ and pipeline/).
+void run_tbc_converter_benchmarks(BenchRunner& runner);
+void run_stacker_benchmarks(BenchRunner& runner);
+void run_chroma_decoder_benchmarks(BenchRunner& runner);
+void run_dropout_correct_benchmarks(BenchRunner& runner);
+void run_efm_benchmarks(BenchRunner& runner);
+void run_reed_solomon_benchmarks(BenchRunner& runner);
+void run_pipeline_benchmarks(BenchRunner& runner);
+
+}  // namespace orc_bench
+
+namespace {
+
+void print_usage(const char* program_name) {
+  std::cerr << "Usage: " << program_name << " [options]\n";
+  std::cerr << "\n";
+  std::cerr << "Runs the decode-orc benchmarks on synthetic PAL/NTSC input "
+               "and prints items/sec per case.\n";
+  std::cerr << "\n";
+  std::cerr << "Options:\n";
+  std::cerr << "  --seconds S          Minimum measured time per case "
+               "(default: 1)\n";
+  std::cerr << "  --filter TEXT        Run only cases whose \"suite/case\" "
+               "id contains TEXT\n";
+  std::cerr << "  --json PATH          Also write the results to PATH as "
+               "JSON\n";
+  std::cerr << "  --fixture-dir DIR    Write (and reuse) the file fixtures "
+               "in DIR instead of a\n";
+  std::cerr << "                       temporary directory\n";
+  std::cerr << "  --list               List the case ids and exit\n";
+  std::cerr << "  --log-level LEVEL    Logging verbosity (default: error)\n";
+  std::cerr << "  --help               Show this help\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  orc_bench::Options options;
+  std::string log_level = "error";
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    auto value = [&](std::string& out) {
+      if (i + 1 >= argc) {
+        std::cerr << "Error: " << arg << " requires a value\n";
+        std::exit(2);
+      }
+      out = argv[++i];
+    };
+    std::string text;
+    if (arg == "--help" || arg == "-h") {
+      print_usage(argv[0]);
+      return 0;
+    } else if (arg == "--seconds") {
+      value(text);
+      options.seconds = std::atof(text.c_str());
+      if (options.seconds <= 0.0) {
+        std::cerr << "Error: --seconds must be positive\n";
+        return 2;
+      }
+    } else if (arg == "--filter") {
+      value(options.filter);
+    } else if (arg == "--json") {
+      value(options.json_path);
+    } else if (arg == "--fixture-dir") {
+      value(options.fixture_dir);
+    } else if (arg == "--list") {
+      options.list = true;
+    } else if (arg == "--log-level") {
+      value(log_level);
+    } else {
+      std::cerr << "Error: unknown option '" << arg << "'\n\n";
+      print_usage(argv[0]);
+      return 2;
+    }
+  }
+
+  // Stage warnings about the synthetic input would interleave with the
+  // results; errors still surface.
+  orc::init_logging(log_level);
+
+  orc_bench::BenchRunner runner(options);
+  try {
+    orc_bench::run_tbc_converter_benchmarks(runner);
+    orc_bench::run_stacker_benchmarks(runner);
+    orc_bench::run_chroma_decoder_benchmarks(runner);
+    orc_bench::run_dropout_correct_benchmarks(runner);
+    orc_bench::run_efm_benchmarks(runner);
+    orc_bench::run_reed_solomon_benchmarks(runner);
+    orc_bench::run_pipeline_benchmarks(runner);
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 1;
+  }
+
+  if (!options.json_path.empty() && !options.list) {
+    std::string error;
+    if (!runner.write_json(options.json_path, error)) {
+      std::cerr << "Error: " << error << "\n";
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,234 @@
+/*
+ * File:        chroma_decoder_bench.cpp
+ * Module:      orc-bench
+ * Purpose:     Frames/sec of the PAL and NTSC chroma decoders and the
+ *              OutputWriter pixel conversion
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+// Drives PalColour (2D, Transform 2D, Transform 3D) and Comb (2D, 3D
+// adaptive) directly, as the chroma sink's workers do: the synthetic frames
+// are split into SourceFields once, with the look-behind/look-ahead frames a
+// 3D filter needs around the kFrames decoded per pass. The "_draft" cases are
+// the decoders the video sink runs for draft colour previews (PAL 2D at a
+// horizontal step of 2, NTSC 1D comb), so their frames/sec against the
+// full-quality cases is the draft latency saving. OutputWriter cases convert
+// pre-decoded ComponentFrames to each output pixel format.
+//
+// Built only when the decoders are (they need FFTW3); otherwise every case
+// is reported as skipped.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bench_harness.h"
+
+#ifdef ORC_BENCH_HAVE_CHROMA_DECODERS
+
+#include <orc/support/frame_line_util.h>
+
+#include "comb.h"
+#include "componentframe.h"
+#include "outputwriter.h"
+#include "palcolour.h"
+#include "sourcefield.h"
+#include "synthetic_video.h"
+
+#endif  // ORC_BENCH_HAVE_CHROMA_DECODERS
+
+namespace orc_bench {
+
+namespace {
+
+constexpr const char* kSuite = "chroma_decoder";
+
+#ifdef ORC_BENCH_HAVE_CHROMA_DECODERS
+
+constexpr int32_t kFrames = 4;
+
+// Synthetic frames and the field views over them. Frames are padded with
+// |behind| frames before and |ahead| frames after the decoded range.
+struct FieldSet {
+  orc::SourceParameters params;
+  std::vector<std::vector<int16_t>> frames;
+  std::vector<SourceField> fields;
+  int32_t start = 0;  // first decoded field index
+  int32_t end = 0;    // one past the last decoded field index
+};
+
+SourceField make_field(orc::VideoSystem system, const int16_t* frame,
+                       uint32_t frame_id, bool first) {
+  const SyntheticFormat& format = synthetic_format(system);
+  const size_t first_line = first ? 0 : format.field1_lines;
+  SourceField sf;
+  sf.seq_no = static_cast<int32_t>(frame_id) + 1;
+  sf.is_first_field = first;
+  sf.frame_phase_id = system == orc::VideoSystem::PAL
+                          ? static_cast<int32_t>(frame_id % 4) + 1
+                          : static_cast<int32_t>(frame_id % 2);
+  sf.samples_per_line = format.samples_per_line;
+  sf.line_count =
+      first ? format.field1_lines : format.frame_lines - format.field1_lines;
+  sf.data = frame + orc::frame_line_sample_offset(
+                        system, format.samples_per_line, first_line);
+  if (system == orc::VideoSystem::PAL) {
+    for (size_t line = 0; line < sf.line_count; ++line) {
+      sf.line_ptrs.push_back(
+          frame + orc::frame_line_sample_offset(
+                      system, format.samples_per_line, first_line + line));
+    }
+  }
+  return sf;
+}
+
+FieldSet make_field_set(orc::VideoSystem system, int32_t behind,
+                        int32_t ahead) {
+  FieldSet set;
+  const int32_t total = behind + kFrames + ahead;
+  set.params = synthetic_source_parameters(system, total);
+  for (int32_t f = 0; f < total; ++f) {
+    set.frames.push_back(
+        make_cvbs_frame(system, static_cast<uint32_t>(f), /*seed=*/1));
+  }
+  // Field views are taken after all frames exist: the vector no longer
+  // reallocates.
+  for (int32_t f = 0; f < total; ++f) {
+    const int16_t* data = set.frames[static_cast<size_t>(f)].data();
+    set.fields.push_back(
+        make_field(system, data, static_cast<uint32_t>(f), true));
+    set.fields.push_back(
+        make_field(system, data, static_cast<uint32_t>(f), false));
+  }
+  set.start = 2 * behind;
+  set.end = 2 * (behind + kFrames);
+  return set;
+}
+
+uint64_t component_digest(const std::vector<ComponentFrame>& frames) {
+  uint64_t sum = 0;
+  for (const ComponentFrame& frame : frames) {
+    const int32_t mid = frame.getHeight() / 2;
+    sum += static_cast<uint64_t>(frame.y(mid)[frame.getWidth() / 2] * 16.0);
+  }
+  return sum;
+}
+
+void bench_pal(BenchRunner& runner, const std::string& name,
+               PalColour::ChromaFilterMode filter,
+               int32_t horizontal_step = 1) {
+  PalColour::Configuration config;
+  config.chromaFilter = filter;
+  config.horizontalStep = horizontal_step;
+  Lazy<FieldSet> fields([config] {
+    return make_field_set(orc::VideoSystem::PAL, config.getLookBehind(),
+                          config.getLookAhead());
+  });
+  PalColour decoder;
+  bool configured = false;
+  std::vector<ComponentFrame> output(kFrames);
+
+  runner.run(kSuite, "pal/" + name, "frames", [&] {
+    const FieldSet& in = fields.get();
+    if (!configured) {
+      decoder.updateConfiguration(in.params, config);
+      configured = true;
+    }
+    decoder.decodeFrames(in.fields, in.start, in.end, output);
+    keep(component_digest(output));
+    return kFrames;
+  });
+}
+
+void bench_ntsc(BenchRunner& runner, const std::string& name,
+                int32_t dimensions, bool adaptive) {
+  Comb::Configuration config;
+  config.dimensions = dimensions;
+  config.adaptive = adaptive;
+  Lazy<FieldSet> fields([config] {
+    return make_field_set(orc::VideoSystem::NTSC, config.getLookBehind(),
+                          config.getLookAhead());
+  });
+  Comb decoder;
+  bool configured = false;
+  std::vector<ComponentFrame> output(kFrames);
+
+  runner.run(kSuite, "ntsc/" + name, "frames", [&] {
+    const FieldSet& in = fields.get();
+    if (!configured) {
+      decoder.updateConfiguration(in.params, config);
+      configured = true;
+    }
+    decoder.decodeFrames(in.fields, in.start, in.end, output);
+    keep(component_digest(output));
+    return kFrames;
+  });
+}
+
+// Decoded PAL frames for the OutputWriter cases.
+struct DecodedFrames {
+  orc::SourceParameters params;
+  std::vector<ComponentFrame> frames;
+};
+
+DecodedFrames decode_pal_frames() {
+  const FieldSet in = make_field_set(orc::VideoSystem::PAL, 0, 0);
+  PalColour decoder;
+  decoder.updateConfiguration(in.params, PalColour::Configuration{});
+  DecodedFrames decoded{in.params, std::vector<ComponentFrame>(kFrames)};
+  decoder.decodeFrames(in.fields, in.start, in.end, decoded.frames);
+  return decoded;
+}
+
+void bench_output_writer(BenchRunner& runner, Lazy<DecodedFrames>& decoded,
+                         const std::string& name,
+                         OutputWriter::PixelFormat format) {
+  OutputWriter writer;
+  bool configured = false;
+  OutputFrame frame;
+
+  runner.run(kSuite, "output_writer/" + name, "frames", [&] {
+    const DecodedFrames& in = decoded.get();
+    if (!configured) {
+      OutputWriter::Configuration config;
+      config.pixelFormat = format;
+      orc::SourceParameters params = in.params;
+      writer.updateConfiguration(params, config);
+      configured = true;
+    }
+    uint64_t sum = 0;
+    for (const ComponentFrame& component : in.frames) {
+      writer.convert(component, frame);
+      sum += frame[frame.size() / 2];
+    }
+    keep(sum);
+    return kFrames;
+  });
+}
+
+#endif  // ORC_BENCH_HAVE_CHROMA_DECODERS
+
+}  // namespace
+
+void run_chroma_decoder_benchmarks(BenchRunner& runner) {
+#ifdef ORC_BENCH_HAVE_CHROMA_DECODERS
+  bench_pal(runner, "pal2d", PalColour::palColourFilter);
+  bench_pal(runner, "transform2d", PalColour::transform2DFilter);
+  bench_pal(runner, "transform3d", PalColour::transform3DFilter);
+  bench_pal(runner, "pal2d_draft", PalColour::palColourFilter, 2);
+  bench_ntsc(runner, "comb2d", 2, false);
+  bench_ntsc(runner, "comb3d_adaptive", 3, true);
+  bench_ntsc(runner, "comb1d_draft", 1, false);
+
+  Lazy<DecodedFrames> decoded(decode_pal_frames);
+  bench_output_writer(runner, decoded, "rgb48", OutputWriter::RGB48);
+  bench_output_writer(runner, decoded, "yuv444p16", OutputWriter::YUV444P16);
+#else
+  runner.skip(kSuite, "*", "chroma decoders not built (FFTW3 not found)");
+#endif
+}
+
+}  // namespace orc_bench
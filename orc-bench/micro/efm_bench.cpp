@@ -0,0 +1,370 @@
+/*
+ * File:        efm_bench.cpp
+ * Module:      orc-bench
+ * Purpose:     Sections/sec of the EFM decoder front end and back end
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+// Throughput is in F2 sections (98 frames, 1/75 s of CD audio), so 75
+// sections/s is real time.
+//
+// The front end decodes a synthetic T-value stream - valid EFM channel
+// frames with sync patterns and a Q-channel timecode per section - to F2
+// sections, serially on one FrontEndChain and on a SegmentedFrontEnd with
+// one worker per hardware thread.
+//
+// The back end (F2 correction, CIRC, F1 -> Data24 -> audio) is fed the front
+// end's sections. In "back_end/f2_to_audio" the frame payload is CIRC-encoded
+// (random C2 codewords run backwards through the decoder's delay lines,
+// interleave and parity inversion), so every C1/C2 word is a clean codeword,
+// as on a good disc. "back_end/f2_to_audio_uncorrectable" feeds random
+// payload instead: every word takes the full decode-and-fail path, the back
+// end's worst case.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_harness.h"
+#include "decoders.h"
+#include "dec_data24toaudio.h"
+#include "dec_f1sectiontodata24section.h"
+#include "dec_f2sectioncorrection.h"
+#include "dec_f2sectiontof1section.h"
+#include "efm.h"
+#include "efm_constants.h"
+#include "gf256/gf256.h"
+#include "section.h"
+#include "segmented_front_end.h"
+
+namespace orc_bench {
+
+namespace {
+
+constexpr const char* kSuite = "efm";
+constexpr int kSections = 600;  // 8 s of audio
+constexpr size_t kChunkSize = 1024;
+constexpr size_t kChunksPerSegment = 512;
+
+constexpr size_t kC1Length = 32;
+constexpr size_t kC2Length = 28;
+constexpr size_t kParity = 4;
+// Longest delay of F2SectionToF1Section's delay line M (C2 symbol 0).
+constexpr size_t kMaxDelayM = 108;
+
+uint8_t toBcd(int value) {
+  return static_cast<uint8_t>((value / 10) << 4 | value % 10);
+}
+
+// Q-channel mode 1 block (track 1, index 1) for absolute frame |frames|,
+// including its CRC, as 96 bits.
+std::vector<bool> qChannelBits(int frames) {
+  std::vector<uint8_t> q(12, 0);
+  q[0] = 0x01;
+  q[1] = 0x01;
+  q[2] = 0x01;
+  q[3] = toBcd(frames / (60 * 75));
+  q[4] = toBcd(frames / 75 % 60);
+  q[5] = toBcd(frames % 75);
+  q[7] = q[3];
+  q[8] = q[4];
+  q[9] = q[5];
+
+  uint32_t crc = 0;
+  for (int i = 0; i < 10; ++i) {
+    crc ^= static_cast<uint32_t>(q[i]) << 8;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc <<= 1;
+      if (crc & 0x10000) crc = (crc ^ 0x1021) & 0xFFFF;
+    }
+  }
+  crc = ~crc & 0xFFFF;
+  q[10] = static_cast<uint8_t>(crc >> 8);
+  q[11] = static_cast<uint8_t>(crc);
+
+  std::vector<bool> bits;
+  for (uint8_t byte : q) {
+    for (int bit = 7; bit >= 0; --bit) bits.push_back(byte >> bit & 1);
+  }
+  return bits;
+}
+
+// Fills the last kParity symbols of |word| so that it is a codeword of the
+// CIRC code - the remainder of payload(x) * x^4 modulo
+// (x - 1)(x - alpha)(x - alpha^2)(x - alpha^3), as in reed_solomon_bench.cpp.
+void appendParity(uint8_t* word, size_t length) {
+  static const std::vector<uint8_t> generator = [] {
+    std::vector<uint8_t> g = {1};
+    for (size_t i = 0; i < kParity; ++i) {
+      const uint8_t root = orc::gf256::alphaPower(static_cast<uint32_t>(i));
+      std::vector<uint8_t> next(g.size() + 1, 0);
+      for (size_t k = 0; k < g.size(); ++k) {
+        next[k] ^= g[k];
+        next[k + 1] ^= orc::gf256::multiply(g[k], root);
+      }
+      g = next;
+    }
+    return g;
+  }();
+
+  std::vector<uint8_t> remainder(word, word + length);
+  std::fill(remainder.end() - kParity, remainder.end(), 0);
+  for (size_t k = 0; k < length - kParity; ++k) {
+    const uint8_t factor = remainder[k];
+    for (size_t g = 0; g < generator.size(); ++g) {
+      remainder[k + g] ^= orc::gf256::multiply(generator[g], factor);
+    }
+  }
+  std::copy(remainder.end() - kParity, remainder.end(),
+            word + length - kParity);
+}
+
+// 32 payload bytes per F2 frame, not CIRC-encoded.
+std::vector<uint8_t> randomPayload(size_t frames, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::vector<uint8_t> payload(frames * kC1Length);
+  for (auto& byte : payload) byte = static_cast<uint8_t>(rng());
+  return payload;
+}
+
+// 32 payload bytes per F2 frame that F2SectionToF1Section decodes without
+// a single C1 or C2 correction: random C2 codewords, spread over the C1
+// words in reverse of delay line M, then each C1 word's parity, the Q/P
+// parity inversion and delay line 1 in reverse.
+std::vector<uint8_t> circPayload(size_t frames, uint32_t seed) {
+  std::mt19937 rng(seed);
+  const size_t c1Words = frames + 1;
+  const size_t c2Words = c1Words + kMaxDelayM;
+
+  std::vector<uint8_t> c2(c2Words * kC2Length);
+  for (size_t w = 0; w < c2Words; ++w) {
+    uint8_t* word = &c2[w * kC2Length];
+    for (size_t k = 0; k < kC2Length - kParity; ++k) {
+      word[k] = static_cast<uint8_t>(rng());
+    }
+    appendParity(word, kC2Length);
+  }
+
+  // C2 symbol i is delayed by 108 - 4i frames on its way from C1.
+  std::vector<uint8_t> c1(c1Words * kC1Length);
+  for (size_t w = 0; w < c1Words; ++w) {
+    uint8_t* word = &c1[w * kC1Length];
+    for (size_t i = 0; i < kC2Length; ++i) {
+      word[i] = c2[(w + kMaxDelayM - 4 * i) * kC2Length + i];
+    }
+    appendParity(word, kC1Length);
+    for (size_t i = 12; i < 16; ++i) word[i] = static_cast<uint8_t>(~word[i]);
+    for (size_t i = 28; i < 32; ++i) word[i] = static_cast<uint8_t>(~word[i]);
+  }
+
+  // Odd symbols are delayed by one frame on their way to C1.
+  std::vector<uint8_t> payload(frames * kC1Length);
+  for (size_t f = 0; f < frames; ++f) {
+    for (size_t i = 0; i < kC1Length; ++i) {
+      payload[f * kC1Length + i] = c1[(f + (i & 1)) * kC1Length + i];
+    }
+  }
+  return payload;
+}
+
+// Builds channel bits for whole sections and converts them to T-values.
+class StreamBuilder {
+ public:
+  // |payload| holds 32 bytes for each frame of |sectionCount| sections.
+  std::vector<uint8_t> build(int sectionCount,
+                             const std::vector<uint8_t>& payload) {
+    const uint8_t* data = payload.data();
+    for (int section = 0; section < sectionCount; ++section) {
+      const std::vector<bool> q = qChannelBits(section);
+      for (int frame = 0; frame < efm::kFramesPerSection; ++frame) {
+        appendMerged(kSync, true);
+        uint16_t subcode = 0;
+        if (frame == 0) {
+          subcode = 256;
+        } else if (frame == 1) {
+          subcode = 257;
+        } else {
+          subcode = static_cast<uint16_t>(0x80 | (q[frame - 2] ? 0x40 : 0));
+        }
+        appendSymbol(subcode);
+        for (size_t byte = 0; byte < kC1Length; ++byte) appendSymbol(*data++);
+      }
+    }
+    m_bits.push_back('1');
+    return tValues();
+  }
+
+ private:
+  static constexpr const char* kSync = "100000000001000000000010";
+  // Two 11T runs in a row: the part of the sync the front end locks on to.
+  static constexpr const char* kSyncRuns = "10000000000100000000001";
+
+  void appendSymbol(uint16_t value) {
+    appendMerged(m_efm.eightToFourteen(value), false);
+  }
+
+  // Every word, the frame sync included, is preceded by merging bits chosen
+  // so that each run of zeros stays within the 2..10 limit of the channel
+  // code and, outside the sync itself, no false sync pattern appears.
+  void appendMerged(const std::string& word, bool sync) {
+    const char* chosen = nullptr;
+    for (const char* merge : {"000", "100", "010", "001"}) {
+      if (!fits(merge + word)) continue;
+      if (!chosen) chosen = merge;
+      if (syncPatterns(merge + word) == (sync ? 1 : 0)) {
+        chosen = merge;
+        break;
+      }
+    }
+    if (chosen) appendWord(chosen);
+    appendWord(word);
+  }
+
+  // The number of 11T-11T patterns that appending |next| creates.
+  int syncPatterns(const std::string& next) const {
+    const std::string pattern = kSyncRuns;
+    const size_t tailSize = std::min(m_bits.size(), pattern.size());
+    const std::string bits = m_bits.substr(m_bits.size() - tailSize) + next;
+    int count = 0;
+    for (size_t pos = bits.find(pattern); pos != std::string::npos;
+         pos = bits.find(pattern, pos + 1)) {
+      if (pos + pattern.size() > tailSize) ++count;
+    }
+    return count;
+  }
+
+  bool fits(const std::string& next) const {
+    size_t zeros = 0;
+    for (auto it = m_bits.rbegin(); it != m_bits.rend() && *it == '0'; ++it) {
+      ++zeros;
+    }
+    const bool previousOne = !m_bits.empty() && m_bits.back() == '1';
+    for (size_t i = 0; i < next.size(); ++i) {
+      if (next[i] == '1') {
+        if ((previousOne || zeros > 0 || i > 0) && (zeros < 2 || zeros > 10)) {
+          return false;
+        }
+        zeros = 0;
+      } else {
+        ++zeros;
+      }
+    }
+    return zeros <= 10;
+  }
+
+  void appendWord(const std::string& word) { m_bits += word; }
+
+  std::vector<uint8_t> tValues() const {
+    std::vector<uint8_t> result;
+    size_t last = m_bits.find('1');
+    for (size_t i = last + 1; i < m_bits.size(); ++i) {
+      if (m_bits[i] == '1') {
+        result.push_back(static_cast<uint8_t>(i - last));
+        last = i;
+      }
+    }
+    return result;
+  }
+
+  Efm m_efm;
+  std::string m_bits;
+};
+
+using Chunks = std::vector<std::vector<uint8_t>>;
+
+Chunks make_chunks(bool circEncoded) {
+  const size_t frames = static_cast<size_t>(kSections) * efm::kFramesPerSection;
+  const std::vector<uint8_t> payload =
+      circEncoded ? circPayload(frames, 1) : randomPayload(frames, 1);
+  const std::vector<uint8_t> stream = StreamBuilder().build(kSections, payload);
+  Chunks chunks;
+  for (size_t pos = 0; pos < stream.size(); pos += kChunkSize) {
+    const size_t end = std::min(stream.size(), pos + kChunkSize);
+    chunks.emplace_back(stream.begin() + pos, stream.begin() + end);
+  }
+  return chunks;
+}
+
+std::vector<F2Section> decode_serially(const Chunks& chunks) {
+  FrontEndChain chain;
+  std::vector<F2Section> sections;
+  for (const auto& chunk : chunks) chain.pushChunk(chunk, sections);
+  return sections;
+}
+
+// F2 correction, CIRC and F1 -> Data24 -> audio over |input|; returns the
+// number of audio sections produced.
+uint64_t decode_back_end(const std::vector<F2Section>& input) {
+  F2SectionCorrection correction;
+  F2SectionToF1Section f2ToF1;
+  F1SectionToData24Section f1ToData24;
+  Data24ToAudio data24ToAudio;
+  uint64_t audio = 0;
+  auto drain = [&] {
+    while (correction.isReady()) f2ToF1.pushSection(correction.popSection());
+    while (f2ToF1.isReady()) f1ToData24.pushSection(f2ToF1.popSection());
+    while (f1ToData24.isReady()) {
+      data24ToAudio.pushSection(f1ToData24.popSection());
+    }
+    for (; data24ToAudio.isReady(); ++audio) data24ToAudio.popSection();
+  };
+  for (const F2Section& section : input) {
+    correction.pushSection(section);
+    drain();
+  }
+  correction.flush();
+  drain();
+  f2ToF1.flush();
+  drain();
+  return audio;
+}
+
+}  // namespace
+
+void run_efm_benchmarks(BenchRunner& runner) {
+  Lazy<Chunks> chunks([] { return make_chunks(true); });
+  Lazy<std::vector<F2Section>> sections(
+      [&chunks] { return decode_serially(chunks.get()); });
+  Lazy<std::vector<F2Section>> uncorrectableSections(
+      [] { return decode_serially(make_chunks(false)); });
+
+  runner.run(kSuite, "front_end/serial", "sections", [&] {
+    const auto decoded = decode_serially(chunks.get());
+    keep(decoded.size());
+    return decoded.size();
+  });
+
+  const size_t workers = std::max(1u, std::thread::hardware_concurrency());
+  runner.run(kSuite, "front_end/segmented", "sections", [&] {
+    SegmentedFrontEnd frontEnd(workers, kChunksPerSegment);
+    size_t count = 0;
+    for (const auto& chunk : chunks.get()) {
+      frontEnd.pushChunk(chunk);
+      for (; frontEnd.isReady(); ++count) frontEnd.popSection();
+    }
+    frontEnd.finish();
+    for (; frontEnd.isReady(); ++count) frontEnd.popSection();
+    keep(count);
+    return count;
+  });
+
+  runner.run(kSuite, "back_end/f2_to_audio", "sections", [&] {
+    const std::vector<F2Section>& input = sections.get();
+    keep(decode_back_end(input));
+    return input.size();
+  });
+
+  runner.run(kSuite, "back_end/f2_to_audio_uncorrectable", "sections", [&] {
+    const std::vector<F2Section>& input = uncorrectableSections.get();
+    keep(decode_back_end(input));
+    return input.size();
+  });
+}
+
+}  // namespace orc_bench
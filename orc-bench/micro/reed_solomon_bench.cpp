@@ -0,0 +1,178 @@
+/*
+ * File:        reed_solomon_bench.cpp
+ * Module:      orc-bench
+ * Purpose:     Codewords/sec of the EFM C1/C2 Reed-Solomon decode paths
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+// Every case decodes the same deterministic set of codewords (a section's
+// worth of C1 or C2 words, 98 at a time, as the CIRC decoder batches them) and
+// reports codewords per second. "_clean" words are valid codewords - nearly
+// every word read from a disc - and "_1error" words carry one corrupted
+// symbol, which takes the full Berlekamp-Massey decode.
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_harness.h"
+#include "ezpwd_compat.h"
+#include "gf256/gf256.h"
+#include "reedsolomon.h"
+
+namespace orc_bench {
+
+namespace {
+
+constexpr const char* kSuite = "reed_solomon";
+
+// The codec reedsolomon.cpp uses, for the baseline ezpwd-only decode.
+template <size_t SYMBOLS, size_t PAYLOAD>
+struct BenchRS;
+template <size_t PAYLOAD>
+struct BenchRS<255, PAYLOAD>
+    : public __RS(BenchRS, uint8_t, 255, PAYLOAD, 0x11D, 0, 1, false);
+
+constexpr size_t kRoots = ReedSolomon::kSyndromes;
+constexpr size_t kWordsPerSection = 98;
+constexpr size_t kSections = 256;
+constexpr size_t kWords = kWordsPerSection * kSections;
+
+// Systematic encode over the CIRC code: the payload followed by the remainder
+// of payload(x) * x^4 modulo (x - 1)(x - alpha)(x - alpha^2)(x - alpha^3).
+std::vector<uint8_t> makeCodewords(size_t length, bool corrupt) {
+  std::vector<uint8_t> generator = {1};
+  for (size_t i = 0; i < kRoots; ++i) {
+    const uint8_t root = orc::gf256::alphaPower(static_cast<uint32_t>(i));
+    std::vector<uint8_t> next(generator.size() + 1, 0);
+    for (size_t k = 0; k < generator.size(); ++k) {
+      next[k] ^= generator[k];
+      next[k + 1] ^= orc::gf256::multiply(generator[k], root);
+    }
+    generator = next;
+  }
+
+  std::mt19937 rng(static_cast<uint32_t>(length));
+  std::vector<uint8_t> words(kWords * length);
+  for (size_t w = 0; w < kWords; ++w) {
+    uint8_t* word = &words[w * length];
+    std::vector<uint8_t> remainder(length, 0);
+    for (size_t k = 0; k < length - kRoots; ++k) {
+      word[k] = remainder[k] = static_cast<uint8_t>(rng());
+    }
+    for (size_t k = 0; k < length - kRoots; ++k) {
+      const uint8_t factor = remainder[k];
+      for (size_t g = 0; g < generator.size(); ++g) {
+        remainder[k + g] ^= orc::gf256::multiply(generator[g], factor);
+      }
+    }
+    for (size_t k = length - kRoots; k < length; ++k) word[k] = remainder[k];
+    if (corrupt) word[rng() % length] ^= static_cast<uint8_t>(1 + rng() % 255);
+  }
+  return words;
+}
+
+// One CIRC code: C1 is (32,28), C2 is (28,24).
+void benchCode(BenchRunner& runner, const char* code, size_t length) {
+  const BenchRS<255, 255 - kRoots> ezpwdRs;
+  const bool c1 = length == 32;
+
+  for (bool corrupt : {false, true}) {
+    const std::vector<uint8_t> words = makeCodewords(length, corrupt);
+    const std::string label =
+        std::string(code) + (corrupt ? "_1error" : "_clean") + "/";
+
+    // Baseline: every word through ezpwd, as before the syndrome fast path.
+    runner.run(kSuite, label + "ezpwd_decode", "codewords", [&] {
+      std::vector<uint8_t> data;
+      std::vector<int> erasures;
+      std::vector<int> position;
+      uint64_t sum = 0;
+      for (size_t w = 0; w < kWords; ++w) {
+        data.assign(&words[w * length], &words[(w + 1) * length]);
+        erasures.clear();
+        sum += static_cast<uint64_t>(
+            ezpwdRs.decode(data, erasures, &position) + 1);
+      }
+      keep(sum);
+      return kWords;
+    });
+
+    // Syndromes alone: one word at a time, then batched on each ISA.
+    const orc::gf256::SyndromeKernel scalar(length, kRoots,
+                                            orc::gf256::Isa::Scalar);
+    runner.run(kSuite, label + "syndromes_per_word", "codewords", [&] {
+      uint8_t syndromes[kRoots];
+      uint64_t sum = 0;
+      for (size_t w = 0; w < kWords; ++w) {
+        sum += scalar.compute(&words[w * length], syndromes);
+      }
+      keep(sum);
+      return kWords;
+    });
+    for (auto isa : {orc::gf256::Isa::Scalar, orc::gf256::Isa::Ssse3,
+                     orc::gf256::Isa::Avx2}) {
+      const orc::gf256::SyndromeKernel kernel(length, kRoots, isa);
+      if (kernel.isa() != isa) continue;  // not supported by this CPU
+      runner.run(kSuite, label + "syndromes_batch_" + orc::gf256::isaName(isa),
+                 "codewords", [&] {
+            std::vector<uint8_t> syndromes(kWordsPerSection * kRoots);
+            uint64_t sum = 0;
+            for (size_t s = 0; s < kSections; ++s) {
+              kernel.computeBatch(&words[s * kWordsPerSection * length],
+                                  length, kWordsPerSection, syndromes.data());
+              sum += syndromes[0];
+            }
+            keep(sum);
+            return kWords;
+          });
+    }
+
+    // The decoder as the CIRC chain drives it: batch syndromes per section,
+    // then the per-word decode (fast path, or ezpwd for non-codewords).
+    ReedSolomon circ;
+    runner.run(kSuite, label + "circ_decode", "codewords", [&] {
+      std::vector<uint8_t> syndromes(kWordsPerSection * kRoots);
+      std::vector<uint8_t> data;
+      std::vector<uint8_t> errorData;
+      std::vector<uint8_t> paddedData;
+      uint64_t sum = 0;
+      for (size_t s = 0; s < kSections; ++s) {
+        const uint8_t* section = &words[s * kWordsPerSection * length];
+        if (c1) {
+          ReedSolomon::c1Syndromes(section, length, kWordsPerSection,
+                                   syndromes.data());
+        } else {
+          ReedSolomon::c2Syndromes(section, length, kWordsPerSection,
+                                   syndromes.data());
+        }
+        for (size_t w = 0; w < kWordsPerSection; ++w) {
+          data.assign(section + w * length, section + (w + 1) * length);
+          errorData.assign(length, 0);
+          paddedData.assign(length, 0);
+          if (c1) {
+            circ.c1Decode(data, errorData, paddedData, &syndromes[w * kRoots]);
+          } else {
+            circ.c2Decode(data, errorData, paddedData, &syndromes[w * kRoots]);
+          }
+          sum += errorData[0];
+        }
+      }
+      keep(sum);
+      return kWords;
+    });
+  }
+}
+
+}  // namespace
+
+void run_reed_solomon_benchmarks(BenchRunner& runner) {
+  benchCode(runner, "c1_32_28", 32);
+  benchCode(runner, "c2_28_24", 28);
+}
+
+}  // namespace orc_bench
@@ -0,0 +1,94 @@
+/*
+ * File:        tbc_converter_bench.cpp
+ * Module:      orc-bench
+ * Purpose:     Frames/sec of TBC field pair to CVBS_U10_4FSC frame assembly
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+// Each pass assembles kFrames frames from pre-rendered TBC fields, both into a
+// freshly allocated frame (assemble_frame) and into a reused buffer
+// (assemble_frame_into, as the TBC source does with pooled buffers), so the
+// difference is the allocation and first-touch cost per frame.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bench_harness.h"
+#include "ntsc_tbc_converter.h"
+#include "pal_tbc_converter.h"
+#include "synthetic_video.h"
+
+namespace orc_bench {
+
+namespace {
+
+constexpr const char* kSuite = "tbc_converter";
+constexpr size_t kFrames = 8;
+
+struct FieldPairs {
+  std::vector<std::vector<uint16_t>> field1;
+  std::vector<std::vector<uint16_t>> field2;
+};
+
+FieldPairs make_field_pairs(orc::VideoSystem system) {
+  const SyntheticFormat& format = synthetic_format(system);
+  const size_t field2_samples =
+      (format.frame_lines - format.field1_lines) * format.samples_per_line;
+  FieldPairs pairs;
+  for (size_t f = 0; f < kFrames; ++f) {
+    pairs.field1.push_back(
+        make_tbc_field(system, static_cast<uint32_t>(2 * f), /*seed=*/1));
+    // The converters take the second field without its padding line.
+    auto field2 =
+        make_tbc_field(system, static_cast<uint32_t>(2 * f + 1), /*seed=*/1);
+    field2.resize(field2_samples);
+    pairs.field2.push_back(std::move(field2));
+  }
+  return pairs;
+}
+
+template <typename Converter>
+void bench_system(BenchRunner& runner, orc::VideoSystem system,
+                  const std::string& label) {
+  const SyntheticFormat& format = synthetic_format(system);
+  Lazy<FieldPairs> pairs([system] { return make_field_pairs(system); });
+
+  runner.run(kSuite, label + "/assemble_frame", "frames", [&] {
+    const FieldPairs& in = pairs.get();
+    uint64_t sum = 0;
+    for (size_t f = 0; f < kFrames; ++f) {
+      const auto frame = Converter::assemble_frame(
+          in.field1[f], in.field2[f], format.tbc_blanking, format.tbc_white);
+      sum += static_cast<uint16_t>(frame[frame.size() / 2]);
+    }
+    keep(sum);
+    return kFrames;
+  });
+
+  std::vector<int16_t> frame;
+  runner.run(kSuite, label + "/assemble_frame_into", "frames", [&] {
+    const FieldPairs& in = pairs.get();
+    uint64_t sum = 0;
+    for (size_t f = 0; f < kFrames; ++f) {
+      Converter::assemble_frame_into(in.field1[f], in.field2[f],
+                                     format.tbc_blanking, format.tbc_white,
+                                     frame);
+      sum += static_cast<uint16_t>(frame[frame.size() / 2]);
+    }
+    keep(sum);
+    return kFrames;
+  });
+}
+
+}  // namespace
+
+void run_tbc_converter_benchmarks(BenchRunner& runner) {
+  bench_system<orc::PalTBCConverter>(runner, orc::VideoSystem::PAL, "pal");
+  bench_system<orc::NtscTBCConverter>(runner, orc::VideoSystem::NTSC, "ntsc");
+}
+
+}  // namespace orc_bench
@@ -0,0 +1,174 @@
+/*
+ * File:        dag_pipeline_bench.cpp
+ * Module:      orc-bench
+ * Purpose:     End-to-end frames/sec of source -> transform chains run
+ *              through DAGExecutor
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+// Each pass builds the DAG from freshly created stages (as project_to_dag()
+// does: descriptor defaults overlaid with the case's parameters), executes
+// it, and acquires every frame of the output representation, so file reads,
+// TBC assembly, metadata loading and every lazy transform are inside the
+// measurement. The fixtures are synthetic CVBS and TBC files written to the
+// fixture directory on first use.
+
+#include <orc/stage/params/stage_parameter.h>
+#include <orc/stage/video_frame_representation.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench_harness.h"
+#include "dag_executor.h"
+#include "stage_registry.h"
+#include "synthetic_video.h"
+
+namespace orc_bench {
+
+namespace {
+
+constexpr const char* kSuite = "pipeline";
+constexpr size_t kFrames = 25;
+constexpr size_t kDropoutsPerFrame = 40;
+
+using Parameters = std::map<std::string, orc::ParameterValue>;
+
+// One node of a linear or fan-in chain; inputs index earlier nodes.
+struct NodeSpec {
+  std::string stage;
+  Parameters parameters;
+  std::vector<int32_t> inputs;
+};
+
+orc::DAGNode make_node(int32_t id, const NodeSpec& spec,
+                       orc::VideoSystem system) {
+  orc::DAGNode node;
+  node.node_id = orc::NodeID(id);
+  node.stage = orc::StageRegistry::instance().create_stage(spec.stage);
+  if (auto* parameterized =
+          dynamic_cast<orc::ParameterizedStage*>(node.stage.get())) {
+    for (const auto& desc : parameterized->get_parameter_descriptors(
+             system, orc::SourceType::Composite)) {
+      if (desc.constraints.default_value) {
+        node.parameters.emplace(desc.name, *desc.constraints.default_value);
+      }
+    }
+    for (const auto& [key, value] : spec.parameters) {
+      node.parameters[key] = value;
+    }
+    parameterized->set_parameters(node.parameters);
+  }
+  for (const int32_t input : spec.inputs) {
+    node.input_node_ids.push_back(orc::NodeID(input));
+    node.input_indices.push_back(0);
+  }
+  return node;
+}
+
+// Executes |specs| (the last node is the output) and pulls every frame.
+size_t run_chain(const std::vector<NodeSpec>& specs, orc::VideoSystem system) {
+  orc::DAG dag;
+  for (size_t i = 0; i < specs.size(); ++i) {
+    dag.add_node(make_node(static_cast<int32_t>(i), specs[i], system));
+  }
+  dag.set_output_nodes({orc::NodeID(static_cast<int32_t>(specs.size() - 1))});
+
+  orc::DAGExecutor executor;
+  const auto outputs = executor.execute(dag);
+  const auto video =
+      outputs.empty()
+          ? nullptr
+          : std::dynamic_pointer_cast<const orc::VideoFrameRepresentation>(
+                outputs.front());
+  if (!video) return 0;
+
+  uint64_t sum = 0;
+  const size_t frames = video->frame_count();
+  for (size_t f = 0; f < frames; ++f) {
+    sum += frame_digest(video->acquire_frame(f));
+  }
+  keep(sum);
+  return frames;
+}
+
+NodeSpec cvbs_source(orc::VideoSystem system, const std::string& path) {
+  return {system == orc::VideoSystem::PAL ? "PAL_CVBS_Source"
+                                          : "NTSC_CVBS_Source",
+          {{"input_path", path},
+           {"sample_encoding", std::string("CVBS_U10_4FSC")}},
+          {}};
+}
+
+NodeSpec tbc_source(const std::string& path) {
+  return {"tbc_source", {{"input_path", path}}, {}};
+}
+
+// Runs |chain| as case |name|, or records it as skipped if a stage it needs
+// is not registered (a plugin not built in this configuration).
+template <typename Chain>
+void run_case(BenchRunner& runner, const std::string& name,
+              const std::vector<std::string>& stages, Chain chain) {
+  for (const auto& stage : stages) {
+    if (!orc::StageRegistry::instance().has_stage(stage)) {
+      runner.skip(kSuite, name, "stage '" + stage + "' is not available");
+      return;
+    }
+  }
+  runner.run(kSuite, name, "frames", chain);
+}
+
+}  // namespace
+
+void run_pipeline_benchmarks(BenchRunner& runner) {
+  using orc::VideoSystem;
+  Lazy<std::unique_ptr<FixtureDirectory>> fixtures([&runner] {
+    return std::make_unique<FixtureDirectory>(runner.options().fixture_dir);
+  });
+  auto cvbs = [&fixtures](VideoSystem system) {
+    return write_cvbs_fixture(fixtures.get()->path(), system, kFrames, 1);
+  };
+  auto tbc = [&fixtures](VideoSystem system, uint32_t seed) {
+    return write_tbc_fixture(fixtures.get()->path(), system, kFrames, seed,
+                             kDropoutsPerFrame);
+  };
+
+  for (const VideoSystem system : {VideoSystem::PAL, VideoSystem::NTSC}) {
+    const std::string label = system == VideoSystem::PAL ? "pal" : "ntsc";
+    const NodeSpec cvbs_spec = cvbs_source(system, {});
+
+    run_case(runner, label + "/cvbs_source", {cvbs_spec.stage}, [&] {
+      return run_chain({cvbs_source(system, cvbs(system))}, system);
+    });
+
+    run_case(runner, label + "/tbc_source", {"tbc_source"}, [&] {
+      return run_chain({tbc_source(tbc(system, 1))}, system);
+    });
+
+    run_case(runner, label + "/tbc_source+dropout_correct",
+             {"tbc_source", "dropout_correct"}, [&] {
+               return run_chain(
+                   {tbc_source(tbc(system, 1)), {"dropout_correct", {}, {0}}},
+                   system);
+             });
+  }
+
+  run_case(runner, "pal/3x_tbc_source+stacker+dropout_correct",
+           {"tbc_source", "stacker", "dropout_correct"}, [&] {
+             return run_chain(
+                 {tbc_source(tbc(VideoSystem::PAL, 1)),
+                  tbc_source(tbc(VideoSystem::PAL, 2)),
+                  tbc_source(tbc(VideoSystem::PAL, 3)),
+                  {"stacker", {{"mode", std::string("Smart Mean")}}, {0, 1, 2}},
+                  {"dropout_correct", {}, {3}}},
+                 VideoSystem::PAL);
+           });
+}
+
+}  // namespace orc_bench
@@ -0,0 +1,237 @@
+/*
+ * File:        colour_statistics_pass_test.cpp
+ * Module:      analysis
+ * Purpose:     Unit tests for the parallel colour statistics pass
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "../../../../orc/core/analysis/colour_statistics/colour_statistics_pass.h"
+
+#include <gtest/gtest.h>
+#include <orc/stage/preview/colour_decode_session.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace {
+
+using orc::ColourFrameCarrier;
+using orc::ColourStatisticsData;
+using orc::IColourDecodeSession;
+using orc::IColourDecodeSessionProvider;
+namespace colour_statistics = orc::colour_statistics;
+
+constexpr uint32_t kWidth = 12;
+constexpr uint32_t kHeight = 6;
+
+// Levels chosen so black-to-white and blanking-to-white are both 500 codes.
+constexpr double kBlack = 300.0;
+constexpr double kWhite = 800.0;
+
+// Frame |index|: a 2-sample border around an active area whose luma is
+// index % 5 * 20 % of black-to-white and whose U/V swing is index % 3 * 0.25
+// of blanking-to-white. The border is out of range and must not be counted.
+ColourFrameCarrier make_carrier(uint64_t index) {
+  ColourFrameCarrier carrier;
+  carrier.system = orc::VideoSystem::PAL;
+  carrier.frame_index = index;
+  carrier.width = kWidth;
+  carrier.height = kHeight;
+  carrier.active_x_start = 2;
+  carrier.active_x_end = kWidth - 2;
+  carrier.active_y_start = 1;
+  carrier.active_y_end = kHeight - 1;
+  carrier.cvbs_blanking = kBlack;
+  carrier.cvbs_black = kBlack;
+  carrier.cvbs_white = kWhite;
+
+  const size_t samples = static_cast<size_t>(kWidth) * kHeight;
+  carrier.y_plane.assign(samples, 0.0);
+  carrier.u_plane.assign(samples, -400.0);
+  carrier.v_plane.assign(samples, -400.0);
+  for (uint32_t y = carrier.active_y_start; y < carrier.active_y_end; ++y) {
+    for (uint32_t x = carrier.active_x_start; x < carrier.active_x_end; ++x) {
+      const size_t i = static_cast<size_t>(y) * kWidth + x;
+      carrier.y_plane[i] = kBlack + (kWhite - kBlack) * (index % 5) * 0.2;
+      carrier.u_plane[i] = (kWhite - kBlack) * (index % 3) * 0.25;
+      carrier.v_plane[i] = -carrier.u_plane[i];
+    }
+  }
+  return carrier;
+}
+
+class SyntheticSession : public IColourDecodeSession {
+ public:
+  SyntheticSession(uint64_t frames, std::atomic<int>& decodes)
+      : frames_(frames), decodes_(decodes) {}
+
+  uint64_t frame_count() const override { return frames_; }
+
+  std::optional<ColourFrameCarrier> decode_colour_frame(
+      uint64_t frame_index) override {
+    ++decodes_;
+    if (frame_index >= frames_ || frame_index % 7 == 6) {
+      return std::nullopt;  // a frame the decoder cannot produce
+    }
+    return make_carrier(frame_index);
+  }
+
+ private:
+  uint64_t frames_;
+  std::atomic<int>& decodes_;
+};
+
+class SyntheticProvider : public IColourDecodeSessionProvider {
+ public:
+  explicit SyntheticProvider(uint64_t frames) : frames_(frames) {}
+
+  std::unique_ptr<IColourDecodeSession> open_colour_decode_session()
+      const override {
+    return std::make_unique<SyntheticSession>(frames_, decodes_);
+  }
+
+  int decodes() const { return decodes_.load(); }
+
+ private:
+  uint64_t frames_;
+  mutable std::atomic<int> decodes_{0};
+};
+
+// Sequential reference for the frames a selection visits.
+ColourStatisticsData reference(uint64_t first, uint64_t last, uint64_t stride) {
+  ColourStatisticsData data;
+  for (uint64_t frame = first; frame <= last; frame += stride) {
+    if (frame % 7 == 6) {
+      ++data.frames_failed;
+    } else {
+      colour_statistics::accumulate_frame(make_carrier(frame), data);
+    }
+  }
+  return data;
+}
+
+void expect_same_counts(const ColourStatisticsData& a,
+                        const ColourStatisticsData& b) {
+  EXPECT_EQ(a.frames_decoded, b.frames_decoded);
+  EXPECT_EQ(a.frames_failed, b.frames_failed);
+  EXPECT_EQ(a.sample_count, b.sample_count);
+  EXPECT_EQ(a.y_bins, b.y_bins);
+  EXPECT_EQ(a.uv_density, b.uv_density);
+}
+
+}  // namespace
+
+TEST(ColourStatisticsPassTest, AccumulateFrame_BinsActiveAreaOnly) {
+  ColourStatisticsData data;
+  colour_statistics::accumulate_frame(make_carrier(2), data);
+
+  const uint64_t active = (kWidth - 4) * (kHeight - 2);
+  EXPECT_EQ(data.frames_decoded, 1u);
+  EXPECT_EQ(data.sample_count, active);
+  EXPECT_DOUBLE_EQ(data.cvbs_white, kWhite);
+
+  // 40 % luma: (40 + 10) / 120 * 256 = bin 106.
+  EXPECT_EQ(data.y_bins[106], active);
+
+  // U = +0.5, V = -0.5 of the swing: bins 192 and 64.
+  EXPECT_EQ(data.uv_count(192, 64), active);
+  EXPECT_EQ(data.uv_count(64, 64), 0u);
+}
+
+TEST(ColourStatisticsPassTest, AccumulateFrame_ClampsChromaAndDropsFarLuma) {
+  ColourFrameCarrier carrier = make_carrier(0);
+  carrier.active_x_start = 0;
+  carrier.active_x_end = 0;  // no usable active area: whole frame
+  carrier.active_y_end = 0;
+
+  ColourStatisticsData data;
+  colour_statistics::accumulate_frame(carrier, data);
+
+  // The border (U = V = -0.8) is not clipped; the invalid active bounds make
+  // the border count. Luma 0 is -60 %, outside the histogram.
+  uint64_t y_total = 0;
+  for (uint64_t count : data.y_bins) y_total += count;
+  EXPECT_EQ(data.sample_count, static_cast<uint64_t>(kWidth) * kHeight);
+  EXPECT_EQ(y_total, (kWidth - 4) * (kHeight - 2));
+  EXPECT_EQ(data.uv_count(25, 25), data.sample_count - y_total);
+
+  carrier.u_plane.assign(carrier.u_plane.size(), 5000.0);
+  ColourStatisticsData clipped;
+  colour_statistics::accumulate_frame(carrier, clipped);
+  EXPECT_EQ(clipped.uv_count(ColourStatisticsData::kUVBinCount - 1, 25),
+            data.sample_count - y_total);
+}
+
+TEST(ColourStatisticsPassTest, Merge_AddsCountsAndKeepsLevels) {
+  ColourStatisticsData a;
+  ColourStatisticsData b;
+  colour_statistics::accumulate_frame(make_carrier(1), a);
+  colour_statistics::accumulate_frame(make_carrier(2), b);
+
+  ColourStatisticsData merged;
+  merged.frames_total = 9;
+  merged.merge(a);
+  merged.merge(b);
+
+  ColourStatisticsData both;
+  colour_statistics::accumulate_frame(make_carrier(1), both);
+  colour_statistics::accumulate_frame(make_carrier(2), both);
+  expect_same_counts(merged, both);
+  EXPECT_EQ(merged.frames_total, 9u);
+  EXPECT_DOUBLE_EQ(merged.cvbs_black, kBlack);
+}
+
+TEST(ColourStatisticsPassTest, Collect_MatchesSequentialPass) {
+  SyntheticProvider provider(100);
+  colour_statistics::FrameSelection selection;
+  selection.max_threads = 4;
+
+  const auto data = colour_statistics::collect(provider, selection);
+  ASSERT_TRUE(data.has_value());
+  EXPECT_EQ(data->frames_total, 100u);
+  expect_same_counts(*data, reference(0, 99, 1));
+}
+
+TEST(ColourStatisticsPassTest, Collect_HonoursStrideAndRange) {
+  SyntheticProvider provider(100);
+  colour_statistics::FrameSelection selection;
+  selection.first_frame = 10;
+  selection.frame_count = 50;
+  selection.stride = 3;
+
+  const auto data = colour_statistics::collect(provider, selection);
+  ASSERT_TRUE(data.has_value());
+  // Frames 10, 13, ..., 58.
+  EXPECT_EQ(data->frames_total, 17u);
+  EXPECT_EQ(provider.decodes(), 17);
+  expect_same_counts(*data, reference(10, 59, 3));
+}
+
+TEST(ColourStatisticsPassTest, Collect_ReturnsNulloptWhenCancelled) {
+  SyntheticProvider provider(1000);
+  const auto data = colour_statistics::collect(
+      provider, colour_statistics::FrameSelection(), [] { return true; });
+  EXPECT_FALSE(data.has_value());
+}
+
+TEST(ColourStatisticsPassTest, Summarise_ReadsPercentilesFromBins) {
+  ColourStatisticsData data;
+  for (uint64_t frame = 0; frame < 5; ++frame) {
+    colour_statistics::accumulate_frame(make_carrier(frame), data);
+  }
+  // Luma 0, 20, 40, 60 and 80 %; saturation ~0, 35, 71, ~0 and 35 %
+  // (sqrt(2) times the U/V swing).
+  const auto summary = colour_statistics::summarise(data);
+  EXPECT_NEAR(summary.y_p1, 0.0, 0.5);
+  EXPECT_NEAR(summary.y_median, 40.0, 0.5);
+  EXPECT_NEAR(summary.y_p99, 80.0, 0.5);
+  EXPECT_DOUBLE_EQ(summary.y_below_black, 0.0);
+  EXPECT_DOUBLE_EQ(summary.y_above_white, 0.0);
+  EXPECT_NEAR(summary.mean_saturation, (35.4 * 2 + 70.7) / 5, 0.5);
+  EXPECT_NEAR(summary.saturation_p99, 70.5, 0.5);
+}
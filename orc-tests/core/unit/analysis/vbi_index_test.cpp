@@ -0,0 +1,231 @@
+/*
+ * File:        vbi_index_test.cpp
+ * Module:      analysis
+ * Purpose:     Unit tests for the lines-16-18-only VBI address index
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "../../../../orc/core/analysis/vbi_index/vbi_index.h"
+
+#include <biphase_observer.h>
+#include <gtest/gtest.h>
+#include <orc/stage/cvbs_signal_constants.h>
+#include <orc/stage/video_frame_representation.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace {
+
+using orc::BiphaseObserver;
+using orc::FieldID;
+using orc::FrameDescriptor;
+using orc::FrameID;
+using orc::FrameIDRange;
+using orc::SourceParameters;
+using orc::VBIIndex;
+using orc::VideoFrameRepresentation;
+using orc::VideoSystem;
+using sample_type = VideoFrameRepresentation::sample_type;
+
+constexpr size_t kWidth = 910;
+constexpr size_t kHeight = 525;
+constexpr uint64_t kFrames = 600;  // several index windows
+constexpr sample_type kWhite = 1000;
+constexpr int32_t kLeadIn = 0x88FFFF;
+
+int32_t bcd(int32_t value) {
+  int32_t out = 0;
+  for (int shift = 0; value > 0; shift += 4, value /= 10) {
+    out |= (value % 10) << shift;
+  }
+  return out;
+}
+
+int32_t cav_code(int32_t picture) { return 0xF00000 | bcd(picture); }
+
+// One NTSC line carrying |code| as 24 Manchester cells of 2 us from sample
+// 100: a 1 is low-then-high, a 0 high-then-low.
+std::vector<sample_type> encode_line(int32_t code) {
+  std::vector<sample_type> line(kWidth, 0);
+  const double cell = orc::sample_rate_from_system(VideoSystem::NTSC) * 2e-6;
+  for (int bit = 0; bit < 24; ++bit) {
+    const bool one = ((code >> (23 - bit)) & 1) != 0;
+    const double start = 100.0 + bit * cell;
+    for (size_t x = static_cast<size_t>(start);
+         x < static_cast<size_t>(start + cell); ++x) {
+      const bool second_half = x >= static_cast<size_t>(start + cell / 2);
+      line[x] = (second_half == one) ? kWhite : 0;
+    }
+  }
+  return line;
+}
+
+// Synthesises only the VBI lines: frame f carries CAV picture
+// |first_picture| + f on line 17 of field 1 and line 18 of field 2, except
+// frame 0, which carries a lead-in code in field 1 and nothing in field 2.
+// Whole frames are never materialised.
+class VBISource : public VideoFrameRepresentation {
+ public:
+  explicit VBISource(int32_t first_picture)
+      : first_picture_(first_picture), blank_(kWidth, 0) {
+    lines_.emplace(kLeadIn, encode_line(kLeadIn));
+    for (uint64_t f = 1; f < kFrames; ++f) {
+      const int32_t code = cav_code(first_picture_ + static_cast<int32_t>(f));
+      lines_.emplace(code, encode_line(code));
+    }
+  }
+
+  FrameIDRange frame_range() const override {
+    return {FrameID{0}, FrameID{kFrames - 1}};
+  }
+  size_t frame_count() const override { return kFrames; }
+  bool has_frame(FrameID id) const override { return id < kFrames; }
+  std::optional<FrameDescriptor> get_frame_descriptor(
+      FrameID id) const override {
+    if (!has_frame(id)) return std::nullopt;
+    FrameDescriptor desc;
+    desc.frame_id = id;
+    desc.system = VideoSystem::NTSC;
+    desc.height = kHeight;
+    desc.samples_total = kWidth * kHeight;
+    desc.samples_per_line_nominal = kWidth;
+    return desc;
+  }
+
+  const sample_type* get_frame(FrameID) const override { return nullptr; }
+  std::vector<sample_type> get_frame_copy(FrameID) const override {
+    return {};
+  }
+  const sample_type* get_line(FrameID id, size_t line) const override {
+    if (!has_frame(id) || line >= kHeight) return nullptr;
+    const size_t f1 = orc::field1_lines(VideoSystem::NTSC);
+    int32_t code = 0;
+    if (id == 0) {
+      code = (line == 16) ? kLeadIn : 0;
+    } else if (line == 16 || line == f1 + 17) {
+      code = cav_code(first_picture_ + static_cast<int32_t>(id));
+    }
+    return code == 0 ? blank_.data() : lines_.at(code).data();
+  }
+
+  std::optional<SourceParameters> get_video_parameters() const override {
+    SourceParameters params;
+    params.system = VideoSystem::NTSC;
+    params.frame_width_nominal = static_cast<int32_t>(kWidth);
+    params.frame_height = static_cast<int32_t>(kHeight);
+    params.number_of_sequential_frames = static_cast<int32_t>(kFrames);
+    params.active_video_start = 0;
+    params.blanking_level = 0;
+    params.white_level = kWhite;
+    return params;
+  }
+
+ private:
+  int32_t first_picture_;
+  std::vector<sample_type> blank_;
+  std::map<int32_t, std::vector<sample_type>> lines_;
+};
+
+}  // namespace
+
+TEST(VBIIndexTest, DecodeAddressCodes_CAVPictureAndLeadIn) {
+  const auto cav = BiphaseObserver::decode_address_codes(0, cav_code(12345), 0);
+  ASSERT_TRUE(cav.picture_number.has_value());
+  EXPECT_EQ(*cav.picture_number, 12345);
+  EXPECT_FALSE(cav.lead_in);
+
+  const auto lead_in = BiphaseObserver::decode_address_codes(0, kLeadIn, 0);
+  EXPECT_TRUE(lead_in.lead_in);
+  EXPECT_FALSE(lead_in.picture_number.has_value());
+}
+
+TEST(VBIIndexTest, DecodeAddressCodes_CLVTimecodeSuppressesCAVPicture) {
+  // Line 16: 15 s, picture 12. Lines 17/18: 1 h 23 min.
+  const auto codes = BiphaseObserver::decode_address_codes(
+      0x8BE512, 0xF1DD23, cav_code(500));
+  ASSERT_TRUE(codes.clv_timecode.has_value());
+  EXPECT_EQ(codes.clv_timecode->hours, 1);
+  EXPECT_EQ(codes.clv_timecode->minutes, 23);
+  EXPECT_EQ(codes.clv_timecode->seconds, 15);
+  EXPECT_EQ(codes.clv_timecode->picture_number, 12);
+  EXPECT_FALSE(codes.picture_number.has_value());
+}
+
+TEST(VBIIndexTest, Build_IndexesEveryFieldOfEverySource) {
+  std::vector<std::shared_ptr<const VideoFrameRepresentation>> sources = {
+      std::make_shared<VBISource>(0), std::make_shared<VBISource>(1000)};
+  uint64_t last_done = 0;
+  uint64_t last_total = 0;
+  const auto indexes = VBIIndex::build(sources, nullptr,
+                                       [&](uint64_t done, uint64_t total) {
+                                         last_done = done;
+                                         last_total = total;
+                                       });
+  ASSERT_EQ(indexes.size(), 2u);
+  EXPECT_EQ(last_done, 2 * kFrames);
+  EXPECT_EQ(last_total, 2 * kFrames);
+
+  const VBIIndex& index = indexes[0];
+  EXPECT_EQ(index.frame_range().first, FrameID{0});
+  EXPECT_EQ(index.frame_range().last, FrameID{kFrames - 1});
+
+  const VBIIndex::Field* lead_in = index.field(FrameID{0}, 0);
+  ASSERT_NE(lead_in, nullptr);
+  EXPECT_TRUE(lead_in->lead_in());
+  EXPECT_FALSE(index.field(FrameID{0}, 1)->has_vbi());
+  EXPECT_FALSE(index.frame_number(FrameID{0}, false).has_value());
+
+  for (FrameID frame : {FrameID{1}, FrameID{255}, FrameID{256}, FrameID{599}}) {
+    EXPECT_EQ(index.frame_number(frame, false),
+              std::optional<int32_t>(static_cast<int32_t>(frame)));
+    EXPECT_EQ(indexes[1].frame_number(frame, false),
+              std::optional<int32_t>(1000 + static_cast<int32_t>(frame)));
+  }
+
+  // The second field carries its code on line 18.
+  const VBIIndex::Field* second = index.field(FieldID(450 * 2 + 1));
+  ASSERT_NE(second, nullptr);
+  EXPECT_EQ(second->lines[0], 0);
+  EXPECT_EQ(second->lines[2], cav_code(450));
+  EXPECT_EQ(second->cav_picture_number(), std::optional<int32_t>(450));
+
+  EXPECT_EQ(index.field(FrameID{kFrames}, 0), nullptr);
+}
+
+TEST(VBIIndexTest, DecodeField_MatchesBuiltIndex) {
+  auto source = std::make_shared<VBISource>(0);
+  const auto indexes = VBIIndex::build({source});
+  ASSERT_EQ(indexes.size(), 1u);
+  for (FrameID frame : {FrameID{0}, FrameID{42}, FrameID{300}}) {
+    for (size_t f = 0; f < 2; ++f) {
+      const VBIIndex::Field probed = VBIIndex::decode_field(*source, frame, f);
+      const VBIIndex::Field* indexed = indexes[0].field(frame, f);
+      ASSERT_NE(indexed, nullptr);
+      EXPECT_EQ(probed.lines, indexed->lines);
+      EXPECT_EQ(probed.picture_number, indexed->picture_number);
+      EXPECT_EQ(probed.flags, indexed->flags);
+    }
+  }
+}
+
+TEST(VBIIndexTest, Build_MaxFramesLimitsEachSource) {
+  const auto indexes =
+      VBIIndex::build({std::make_shared<VBISource>(0)}, nullptr, nullptr, 100);
+  ASSERT_EQ(indexes.size(), 1u);
+  EXPECT_EQ(indexes[0].frame_range().last, FrameID{99});
+  EXPECT_EQ(indexes[0].frame_number(FrameID{99}, false),
+            std::optional<int32_t>(99));
+  EXPECT_EQ(indexes[0].field(FrameID{100}, 0), nullptr);
+}
+
+TEST(VBIIndexTest, Build_ReturnsEmptyWhenCancelled) {
+  const auto indexes = VBIIndex::build({std::make_shared<VBISource>(0)},
+                                       [] { return true; });
+  EXPECT_TRUE(indexes.empty());
+}
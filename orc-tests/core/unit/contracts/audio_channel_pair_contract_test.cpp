@@ -2,8 +2,8 @@
  * File:        audio_channel_pair_contract_test.cpp
  * Module:      orc-core-tests
  * Purpose:     Contract tests for the SDK audio channel-pair model: default
- *              VFR accessor behaviour, wrapper forwarding of the three pair
- *              accessors, and SMPTE 272M cadence exactness
+ *              VFR accessor behaviour, wrapper forwarding of the pair
+ *              accessors, SMPTE 272M cadence exactness and range reads
  *
  * SPDX-License-Identifier: GPL-3.0-or-later
  * SPDX-FileCopyrightText: 2026 decode-orc contributors
@@ -13,15 +13,19 @@
 #include <orc/stage/audio/audio_channel_pair.h>
 #include <orc/stage/video_frame_representation.h>
 
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace orc_unit_test {
 
 namespace {
 
+using orc::audio_frame_containing_pair;
 using orc::audio_pair_offset;
 using orc::audio_pairs_in_frame;
+using orc::for_each_audio_frame_span;
 using orc::AudioChannelPairDescriptor;
 using orc::AudioOrigin;
 using orc::FrameID;
@@ -71,6 +75,47 @@ class TwoPairSource : public DefaultAudioSource {
   }
 };
 
+// NTSC source of kStreamFrames frames whose single pair carries, at stream
+// position pos, pos + 1 on the left and -(pos + 1) on the right. Counts
+// range reads so forwarding is observable.
+constexpr uint64_t kStreamFrames = 12;
+
+int32_t left_at(uint64_t pos) { return static_cast<int32_t>(pos + 1); }
+
+class StreamSource : public DefaultAudioSource {
+ public:
+  FrameIDRange frame_range() const override {
+    return {FrameID{0}, FrameID{kStreamFrames - 1}};
+  }
+  size_t frame_count() const override { return kStreamFrames; }
+  bool has_frame(FrameID id) const override { return id < kStreamFrames; }
+  std::optional<orc::SourceParameters> get_video_parameters() const override {
+    orc::SourceParameters params;
+    params.system = VideoSystem::NTSC;
+    return params;
+  }
+  size_t audio_channel_pair_count() const override { return 1; }
+
+  std::vector<int32_t> get_audio_samples(size_t pair,
+                                         FrameID id) const override {
+    if (pair != 0 || !has_frame(id)) return {};
+    std::vector<int32_t> samples;
+    for (uint64_t pos = audio_pair_offset(id, VideoSystem::NTSC);
+         pos < audio_pair_offset(id + 1, VideoSystem::NTSC); ++pos) {
+      samples.push_back(left_at(pos));
+      samples.push_back(-left_at(pos));
+    }
+    return samples;
+  }
+  bool read_audio(size_t pair, uint64_t start_pair, size_t count,
+                  int32_t* out) const override {
+    ++range_reads;
+    return VideoFrameRepresentation::read_audio(pair, start_pair, count, out);
+  }
+
+  mutable std::atomic<int> range_reads{0};
+};
+
 // Wrapper with no overrides — must forward every audio accessor.
 class PassThrough : public VideoFrameRepresentationWrapper {
  public:
@@ -216,4 +261,107 @@ TEST(AudioChannelPairContractTest, PairOffset_UnknownSystem_ReturnsZero) {
   EXPECT_EQ(audio_pairs_in_frame(100, VideoSystem::Unknown), 0u);
 }
 
+// ---------------------------------------------------------------------------
+// Range reads
+// ---------------------------------------------------------------------------
+
+TEST(AudioChannelPairContractTest, FrameContainingPair_InvertsPairOffset) {
+  for (VideoSystem system : {VideoSystem::PAL, VideoSystem::NTSC}) {
+    for (uint64_t frame = 0; frame < 1000; ++frame) {
+      const uint64_t first = audio_pair_offset(frame, system);
+      const uint64_t last = audio_pair_offset(frame + 1, system) - 1;
+      ASSERT_EQ(audio_frame_containing_pair(first, system), frame);
+      ASSERT_EQ(audio_frame_containing_pair(last, system), frame);
+    }
+  }
+}
+
+TEST(AudioChannelPairContractTest, FrameSpans_SplitAtFrameBoundaries) {
+  // From 100 pairs into frame 1 (1601 pairs) to 10 pairs into frame 3.
+  const uint64_t start = audio_pair_offset(1, VideoSystem::NTSC) + 100;
+  const uint64_t end = audio_pair_offset(3, VideoSystem::NTSC) + 10;
+  struct Span {
+    uint64_t frame;
+    size_t within, pairs, at;
+  };
+  std::vector<Span> spans;
+  for_each_audio_frame_span(
+      start, end - start, VideoSystem::NTSC,
+      [&](uint64_t frame, size_t within, size_t pairs, size_t at) {
+        spans.push_back({frame, within, pairs, at});
+      });
+  ASSERT_EQ(spans.size(), 3u);
+  EXPECT_EQ(spans[0].frame, 1u);
+  EXPECT_EQ(spans[0].within, 100u);
+  EXPECT_EQ(spans[0].pairs, 1501u);
+  EXPECT_EQ(spans[0].at, 0u);
+  EXPECT_EQ(spans[1].frame, 2u);
+  EXPECT_EQ(spans[1].within, 0u);
+  EXPECT_EQ(spans[1].pairs, 1602u);
+  EXPECT_EQ(spans[1].at, 1501u);
+  EXPECT_EQ(spans[2].frame, 3u);
+  EXPECT_EQ(spans[2].pairs, 10u);
+  EXPECT_EQ(spans[2].at, 1501u + 1602u);
+
+  bool called = false;
+  for_each_audio_frame_span(0, 100, VideoSystem::Unknown,
+                            [&](uint64_t, size_t, size_t, size_t) {
+                              called = true;
+                            });
+  EXPECT_FALSE(called);
+}
+
+TEST(AudioChannelPairContractTest, ReadAudio_DefaultSpansFramesContiguously) {
+  StreamSource source;
+  const uint64_t start = audio_pair_offset(1, VideoSystem::NTSC) + 100;
+  const size_t count = 5000;  // into frame 4
+  std::vector<int32_t> out(count * 2, 123);
+  ASSERT_TRUE(source.read_audio(0, start, count, out.data()));
+  for (size_t k = 0; k < count; ++k) {
+    ASSERT_EQ(out[k * 2], left_at(start + k)) << "pair " << k;
+    ASSERT_EQ(out[k * 2 + 1], -left_at(start + k)) << "pair " << k;
+  }
+}
+
+TEST(AudioChannelPairContractTest, ReadAudio_SilencesPairsPastTheLastFrame) {
+  StreamSource source;
+  const uint64_t end = audio_pair_offset(kStreamFrames, VideoSystem::NTSC);
+  std::vector<int32_t> out(20, 123);
+  EXPECT_FALSE(source.read_audio(0, end - 4, 10, out.data()));
+  EXPECT_EQ(out[0], left_at(end - 4));
+  EXPECT_EQ(out[7], -left_at(end - 1));
+  for (size_t v = 8; v < out.size(); ++v) EXPECT_EQ(out[v], 0) << v;
+}
+
+TEST(AudioChannelPairContractTest, ReadAudio_FailsWithSilenceWhenUnservable) {
+  std::vector<int32_t> out(8, 123);
+  StreamSource source;
+  EXPECT_FALSE(source.read_audio(1, 0, 4, out.data()));
+  EXPECT_EQ(out, std::vector<int32_t>(8, 0));
+
+  // Without video parameters there is no cadence to address by.
+  TwoPairSource no_system;
+  out.assign(8, 123);
+  EXPECT_FALSE(no_system.read_audio(0, 0, 4, out.data()));
+  EXPECT_EQ(out, std::vector<int32_t>(8, 0));
+
+  PassThrough null_wrapper(nullptr);
+  out.assign(8, 123);
+  EXPECT_FALSE(null_wrapper.read_audio(0, 0, 4, out.data()));
+  EXPECT_EQ(out, std::vector<int32_t>(8, 0));
+}
+
+TEST(AudioChannelPairContractTest, Wrapper_ForwardsRangeReadsInOneCall) {
+  auto source = std::make_shared<StreamSource>();
+  auto first = std::make_shared<PassThrough>(source);
+  PassThrough second(first);
+
+  const size_t count = 4 * 1602;
+  std::vector<int32_t> out(count * 2);
+  ASSERT_TRUE(second.read_audio(0, 0, count, out.data()));
+  EXPECT_EQ(source->range_reads.load(), 1);
+  EXPECT_EQ(out[0], left_at(0));
+  EXPECT_EQ(out[(count - 1) * 2], left_at(count - 1));
+}
+
 }  // namespace orc_unit_test
@@ -0,0 +1,210 @@
+/*
+ * File:        dag_executor_shared_stage_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Contracts for concurrent executors sharing stage instances
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <orc/stage/stage.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../../orc/core/include/dag_executor.h"
+#include "../../../orc/plugins/stages/mask_line/mask_line_stage.h"
+#include "../../../orc/plugins/stages/video_params/video_params_stage.h"
+#include "../mocks/mock_video_frame_representation.h"
+
+using ::testing::Return;
+
+namespace orc_unit_test {
+namespace {
+
+// A mock source frame sequence that can travel through the DAG as an
+// artifact.
+class SourceFrames : public testing::NiceMock<MockVideoFrameRepresentation>,
+                     public orc::Artifact {
+ public:
+  SourceFrames() : orc::Artifact(orc::ArtifactID("source_frames"), {}) {
+    orc::SourceParameters params;
+    params.system = orc::VideoSystem::PAL;
+    params.frame_width_nominal = 1135;
+    params.frame_height = 625;
+    ON_CALL(*this, get_video_parameters()).WillByDefault(Return(params));
+  }
+
+  std::string type_name() const override { return "source_frames"; }
+};
+
+class SourceStage : public orc::DAGStage {
+ public:
+  std::string version() const override { return "1.0"; }
+
+  orc::NodeTypeInfo get_node_type_info() const override {
+    return orc::NodeTypeInfo(orc::NodeType::SOURCE, "shared_stage_source",
+                             "Source", "test stage", 0, 0, 1, 1,
+                             orc::VideoFormatCompatibility::ALL,
+                             orc::SinkCategory::CORE, "Test");
+  }
+
+  std::vector<orc::ArtifactPtr> execute(
+      const std::vector<orc::ArtifactPtr>& /*inputs*/,
+      const std::map<std::string, orc::ParameterValue>& /*parameters*/,
+      orc::ObservationContext& /*observation_context*/) override {
+    return {frames_};
+  }
+
+  size_t required_input_count() const override { return 0; }
+  size_t output_count() const override { return 1; }
+
+ private:
+  std::shared_ptr<SourceFrames> frames_ = std::make_shared<SourceFrames>();
+};
+
+// Records how many calls to execute() overlap.
+class ProbeStage : public orc::DAGStage {
+ public:
+  std::string version() const override { return "1.0"; }
+
+  orc::NodeTypeInfo get_node_type_info() const override {
+    return orc::NodeTypeInfo(orc::NodeType::TRANSFORM, "shared_stage_probe",
+                             "Probe", "test stage", 1, 1, 1, 1,
+                             orc::VideoFormatCompatibility::ALL,
+                             orc::SinkCategory::CORE, "Test");
+  }
+
+  std::vector<orc::ArtifactPtr> execute(
+      const std::vector<orc::ArtifactPtr>& inputs,
+      const std::map<std::string, orc::ParameterValue>& /*parameters*/,
+      orc::ObservationContext& /*observation_context*/) override {
+    const int now = ++in_flight_;
+    int seen = max_in_flight_.load();
+    while (now > seen && !max_in_flight_.compare_exchange_weak(seen, now)) {
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+    --in_flight_;
+    return inputs;
+  }
+
+  size_t required_input_count() const override { return 1; }
+  size_t output_count() const override { return 1; }
+
+  int max_in_flight() const { return max_in_flight_.load(); }
+
+ private:
+  std::atomic<int> in_flight_{0};
+  std::atomic<int> max_in_flight_{0};
+};
+
+orc::DAGNode make_node(uint64_t id, orc::DAGStagePtr stage,
+                       std::map<std::string, orc::ParameterValue> parameters,
+                       std::vector<uint64_t> inputs) {
+  orc::DAGNode node;
+  node.node_id = orc::NodeID(id);
+  node.stage = std::move(stage);
+  node.parameters = std::move(parameters);
+  for (const uint64_t input : inputs) {
+    node.input_node_ids.push_back(orc::NodeID(input));
+    node.input_indices.push_back(0);
+  }
+  return node;
+}
+
+// Runs |body| on |lanes| threads at once, each with its own executor, as
+// RenderCoordinator's interactive and background lanes do.
+void run_lanes(int lanes,
+               const std::function<void(int lane, orc::DAGExecutor&)>& body) {
+  std::vector<std::thread> threads;
+  for (int lane = 0; lane < lanes; ++lane) {
+    threads.emplace_back([lane, &body] {
+      orc::DAGExecutor executor;
+      executor.set_cache_enabled(false);
+      body(lane, executor);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
+constexpr int kLanes = 4;
+// The probe sleeps inside execute(), so a few passes expose any overlap; the
+// real stages race only in a short window and need many.
+constexpr int kProbePasses = 25;
+constexpr int kStagePasses = 1000;
+
+}  // namespace
+
+TEST(DAGExecutorSharedStageTest, SharedInstance_ExecuteIsSerialised) {
+  // Two DAGs holding the same probe instance, as after an incremental
+  // rebuild: the lock must follow the stage, not the DAG or executor.
+  auto source = std::make_shared<SourceStage>();
+  auto probe = std::make_shared<ProbeStage>();
+  std::vector<orc::DAG> dags(2);
+  for (auto& dag : dags) {
+    dag.add_node(make_node(1, source, {}, {}));
+    dag.add_node(make_node(2, probe, {}, {1}));
+  }
+
+  run_lanes(kLanes, [&](int lane, orc::DAGExecutor& executor) {
+    const orc::DAG& dag = dags[static_cast<size_t>(lane) % dags.size()];
+    for (int pass = 0; pass < kProbePasses; ++pass) {
+      executor.execute_to_node(dag, orc::NodeID(2));
+    }
+  });
+
+  EXPECT_EQ(probe->max_in_flight(), 1);
+}
+
+TEST(DAGExecutorSharedStageTest, RealStages_EachLaneSeesItsOwnParameters) {
+  // VideoParamsStage and MaskLineStage store their parameters and output in
+  // members during execute(). The old and new DAG of an incremental rebuild
+  // share those instances with different node parameters; every lane must
+  // get output built from its own DAG's parameters.
+  auto source = std::make_shared<SourceStage>();
+  auto video_params = std::make_shared<orc::VideoParamsStage>();
+  auto mask_line = std::make_shared<orc::MaskLineStage>();
+  const std::vector<int32_t> starts = {120, 140};
+  std::vector<orc::DAG> dags(starts.size());
+  for (size_t i = 0; i < dags.size(); ++i) {
+    dags[i].add_node(make_node(1, source, {}, {}));
+    dags[i].add_node(make_node(
+        2, video_params, {{"activeVideoStart", starts[i]}}, {1}));
+    dags[i].add_node(make_node(
+        3, mask_line,
+        {{"lineSpec", std::string(i == 0 ? "20" : "30-32")},
+         {"maskSampleLevel", int32_t(0)}},
+        {2}));
+  }
+
+  std::atomic<int> mismatches{0};
+  run_lanes(kLanes, [&](int lane, orc::DAGExecutor& executor) {
+    const size_t which = static_cast<size_t>(lane) % dags.size();
+    for (int pass = 0; pass < kStagePasses; ++pass) {
+      auto outputs = executor.execute_to_node(dags[which], orc::NodeID(3));
+      const auto& masked = outputs.at(orc::NodeID(3));
+      auto frames = masked.empty()
+                        ? nullptr
+                        : std::dynamic_pointer_cast<
+                              const orc::VideoFrameRepresentation>(masked[0]);
+      const auto params =
+          frames ? frames->get_video_parameters() : std::nullopt;
+      if (!params || params->active_video_start != starts[which]) {
+        ++mismatches;
+      }
+    }
+  });
+
+  EXPECT_EQ(mismatches.load(), 0);
+}
+
+}  // namespace orc_unit_test
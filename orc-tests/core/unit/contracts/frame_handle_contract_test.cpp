@@ -0,0 +1,294 @@
+/*
+ * File:        frame_handle_contract_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Contract tests: VideoFrameRepresentation::acquire_frame()
+ *              returns immutable handles that describe the output frame,
+ *              outlive upstream caches, and share buffers rather than copy
+ *              them through pass-through stages.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include <gtest/gtest.h>
+#include <orc/stage/frame_handle.h>
+#include <orc/stage/line_overlay_representation.h>
+#include <orc/support/line_batch_representation.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "../../../orc/plugins/stages/audio_align/audio_align_stage.h"
+#include "../../../orc/plugins/stages/video_params/video_params_stage.h"
+
+namespace orc_unit_test {
+
+namespace {
+
+using orc::DropoutRun;
+using orc::FrameDescriptor;
+using orc::FrameHandle;
+using orc::FrameID;
+using orc::FrameIDRange;
+using orc::LineOverlayFrameRepresentation;
+using orc::SharedSampleBuffer;
+using orc::SourceParameters;
+using orc::VideoFrameRepresentation;
+using orc::VideoSystem;
+using sample_type = orc::VideoFrameRepresentation::sample_type;
+
+constexpr size_t kWidth = 16;
+constexpr size_t kHeight = 8;
+constexpr size_t kSamplesTotal = kWidth * kHeight;
+constexpr size_t kFrames = 32;
+
+SharedSampleBuffer make_plane(size_t frame, int offset) {
+  auto plane = std::make_shared<std::vector<sample_type>>(kSamplesTotal);
+  for (size_t i = 0; i < kSamplesTotal; ++i) {
+    (*plane)[i] = static_cast<sample_type>(frame * 1000 + i + offset);
+  }
+  return plane;
+}
+
+// In-memory source. Sample i of frame f holds f * 1000 + i; luma and chroma
+// are offset by 100 and 200. With |shares_buffers| it overrides
+// acquire_frame() to hand out its own buffers, as caching sources do;
+// otherwise the contract's copying default applies.
+class FakeSource : public VideoFrameRepresentation {
+ public:
+  FakeSource(bool separate_channels, bool shares_buffers)
+      : separate_channels_(separate_channels),
+        shares_buffers_(shares_buffers) {
+    for (size_t f = 0; f < kFrames; ++f) {
+      frames_.push_back(make_plane(f, 0));
+      luma_.push_back(make_plane(f, 100));
+      chroma_.push_back(make_plane(f, 200));
+    }
+  }
+
+  FrameIDRange frame_range() const override {
+    return {FrameID{0}, FrameID{kFrames - 1}};
+  }
+  size_t frame_count() const override { return kFrames; }
+  bool has_frame(FrameID id) const override { return id < kFrames; }
+
+  std::optional<FrameDescriptor> get_frame_descriptor(
+      FrameID id) const override {
+    if (!has_frame(id)) return std::nullopt;
+    FrameDescriptor desc;
+    desc.frame_id = id;
+    desc.system = VideoSystem::NTSC;
+    desc.height = kHeight;
+    desc.samples_total = kSamplesTotal;
+    desc.samples_per_line_nominal = kWidth;
+    return desc;
+  }
+
+  const sample_type* get_frame(FrameID id) const override {
+    return has_frame(id) ? frames_[id]->data() : nullptr;
+  }
+  std::vector<sample_type> get_frame_copy(FrameID id) const override {
+    return has_frame(id) ? *frames_[id] : std::vector<sample_type>{};
+  }
+
+  FrameHandle acquire_frame(FrameID id) const override {
+    if (!shares_buffers_) return VideoFrameRepresentation::acquire_frame(id);
+    if (!has_frame(id)) return nullptr;
+    auto frame = std::make_shared<orc::AcquiredFrame>();
+    frame->frame_id = id;
+    frame->samples = frames_[id];
+    if (separate_channels_) {
+      frame->luma = luma_[id];
+      frame->chroma = chroma_[id];
+    }
+    frame->dropouts = get_dropout_hints(id);
+    return frame;
+  }
+
+  bool has_separate_channels() const override { return separate_channels_; }
+  const sample_type* get_frame_luma(FrameID id) const override {
+    return (separate_channels_ && has_frame(id)) ? luma_[id]->data()
+                                                 : nullptr;
+  }
+  const sample_type* get_frame_chroma(FrameID id) const override {
+    return (separate_channels_ && has_frame(id)) ? chroma_[id]->data()
+                                                 : nullptr;
+  }
+
+  std::vector<DropoutRun> get_dropout_hints(FrameID id) const override {
+    DropoutRun run;
+    run.frame_id = id;
+    run.sample_count = 4;
+    return {run};
+  }
+
+  std::optional<SourceParameters> get_video_parameters() const override {
+    SourceParameters params;
+    params.system = VideoSystem::NTSC;
+    params.frame_width_nominal = static_cast<int32_t>(kWidth);
+    params.frame_height = static_cast<int32_t>(kHeight);
+    params.number_of_sequential_frames = static_cast<int32_t>(kFrames);
+    return params;
+  }
+
+  const SharedSampleBuffer& buffer(FrameID id) const { return frames_[id]; }
+
+ private:
+  bool separate_channels_;
+  bool shares_buffers_;
+  std::vector<SharedSampleBuffer> frames_;
+  std::vector<SharedSampleBuffer> luma_;
+  std::vector<SharedSampleBuffer> chroma_;
+};
+
+// Pass-through that drops the first |skip_| source frames and, optionally,
+// fills line |line_| of every frame with -1.
+class TestOverlay : public LineOverlayFrameRepresentation {
+ public:
+  TestOverlay(std::shared_ptr<const VideoFrameRepresentation> source,
+              std::optional<size_t> line, size_t skip, size_t budget)
+      : LineOverlayFrameRepresentation(std::move(source), budget),
+        line_(line),
+        skip_(skip) {}
+
+  size_t frame_count() const override { return kFrames - skip_; }
+
+ protected:
+  std::optional<FrameID> source_frame_id(FrameID id) const override {
+    if (id + skip_ >= kFrames) return std::nullopt;
+    return id + skip_;
+  }
+  bool overlays_line(FrameID /*id*/, size_t line) const override {
+    return line_ && *line_ == line;
+  }
+  void render_overlay_line(FrameID /*id*/, size_t /*line*/, Plane /*plane*/,
+                           sample_type* out, size_t count) const override {
+    std::fill(out, out + count, sample_type{-1});
+  }
+
+ private:
+  std::optional<size_t> line_;
+  size_t skip_;
+};
+
+}  // namespace
+
+TEST(FrameHandleContractTest, DefaultAcquire_CopiesFrameAndHints) {
+  FakeSource source(/*separate_channels=*/true, /*shares_buffers=*/false);
+
+  const FrameHandle frame = source.acquire_frame(FrameID{4});
+  ASSERT_NE(frame, nullptr);
+  EXPECT_EQ(frame->frame_id, FrameID{4});
+  ASSERT_NE(frame->samples, nullptr);
+  ASSERT_EQ(frame->samples->size(), kSamplesTotal);
+  EXPECT_EQ((*frame->samples)[5], 4005);
+  EXPECT_NE(frame->samples->data(), source.get_frame(FrameID{4}));
+  ASSERT_NE(frame->luma, nullptr);
+  ASSERT_NE(frame->chroma, nullptr);
+  EXPECT_EQ((*frame->luma)[0], 4100);
+  EXPECT_EQ((*frame->chroma)[kSamplesTotal - 1],
+            static_cast<sample_type>(4200 + kSamplesTotal - 1));
+  ASSERT_EQ(frame->dropouts.size(), 1u);
+  EXPECT_EQ(frame->dropouts[0].frame_id, FrameID{4});
+
+  EXPECT_EQ(source.acquire_frame(FrameID{kFrames}), nullptr);
+}
+
+TEST(FrameHandleContractTest, CompositeHandle_HasNoYCPlanes) {
+  FakeSource source(/*separate_channels=*/false, /*shares_buffers=*/false);
+  const FrameHandle frame = source.acquire_frame(FrameID{0});
+  ASSERT_NE(frame, nullptr);
+  EXPECT_EQ(frame->luma, nullptr);
+  EXPECT_EQ(frame->chroma, nullptr);
+}
+
+TEST(FrameHandleContractTest, Handle_OutlivesRepresentation) {
+  auto source = std::make_shared<FakeSource>(false, /*shares_buffers=*/true);
+  const FrameHandle frame = source->acquire_frame(FrameID{2});
+  ASSERT_NE(frame, nullptr);
+  source.reset();
+  EXPECT_EQ((*frame->samples)[kSamplesTotal - 1],
+            static_cast<sample_type>(2000 + kSamplesTotal - 1));
+}
+
+TEST(FrameHandleContractTest, ForwardedHandle_SharesBuffersWithNewIdentity) {
+  FakeSource source(/*separate_channels=*/true, /*shares_buffers=*/true);
+  const FrameHandle upstream = source.acquire_frame(FrameID{9});
+
+  const FrameHandle forwarded = orc::forward_frame_handle(upstream, 1, {});
+  ASSERT_NE(forwarded, nullptr);
+  EXPECT_EQ(forwarded->frame_id, FrameID{1});
+  EXPECT_EQ(forwarded->samples, upstream->samples);
+  EXPECT_EQ(forwarded->luma, upstream->luma);
+  EXPECT_EQ(forwarded->chroma, upstream->chroma);
+  EXPECT_TRUE(forwarded->dropouts.empty());
+  EXPECT_EQ(upstream->frame_id, FrameID{9});
+
+  EXPECT_EQ(orc::forward_frame_handle(nullptr, 1, {}), nullptr);
+}
+
+TEST(FrameHandleContractTest, LineOverlay_UnchangedFrameSharesUpstreamBuffer) {
+  auto source = std::make_shared<FakeSource>(false, /*shares_buffers=*/true);
+  TestOverlay overlay(source, std::nullopt, /*skip=*/3,
+                      LineOverlayFrameRepresentation::kDefaultCacheBudgetBytes);
+
+  const FrameHandle frame = overlay.acquire_frame(FrameID{0});
+  ASSERT_NE(frame, nullptr);
+  EXPECT_EQ(frame->samples, source->buffer(FrameID{3}));
+  EXPECT_EQ(frame->frame_id, FrameID{0});
+  ASSERT_EQ(frame->dropouts.size(), 1u);
+  EXPECT_EQ(frame->dropouts[0].frame_id, FrameID{0});
+  EXPECT_EQ(overlay.cached_frame_count(), 0u);
+}
+
+TEST(FrameHandleContractTest, LineOverlay_OverlaidFrameSurvivesEviction) {
+  auto source = std::make_shared<FakeSource>(false, /*shares_buffers=*/true);
+  const size_t budget = 4 * kSamplesTotal * sizeof(sample_type);
+  TestOverlay overlay(source, /*line=*/1, /*skip=*/0, budget);
+
+  const FrameHandle frame = overlay.acquire_frame(FrameID{0});
+  ASSERT_NE(frame, nullptr);
+  EXPECT_EQ(frame->samples->data(), overlay.get_frame(FrameID{0}));
+
+  // Materialise every other frame so frame 0 leaves the cache.
+  for (FrameID id = 1; id < kFrames; ++id) {
+    ASSERT_NE(overlay.get_frame(id), nullptr);
+  }
+  EXPECT_LE(overlay.cached_frame_count(), 8u);
+
+  ASSERT_EQ(frame->samples->size(), kSamplesTotal);
+  EXPECT_EQ((*frame->samples)[0], 0);
+  EXPECT_EQ((*frame->samples)[kWidth], -1);
+  EXPECT_EQ((*frame->samples)[2 * kWidth],
+            static_cast<sample_type>(2 * kWidth));
+}
+
+TEST(FrameHandleContractTest, PassThroughWrappers_ShareUpstreamBuffers) {
+  // Stages that leave video samples and hints untouched must not fall back
+  // to the wrapper's copying default, or every frame is copied on its way
+  // from the source to the sink.
+  auto source = std::make_shared<FakeSource>(/*separate_channels=*/true,
+                                             /*shares_buffers=*/true);
+  const std::vector<std::shared_ptr<const VideoFrameRepresentation>> wrappers =
+      {std::make_shared<orc::VideoParamsOverrideFrameRepresentation>(
+           source, std::nullopt),
+       std::make_shared<orc::AlignedAudioChannelPairRepresentation>(
+           source, /*channel_pair=*/0, /*offset_pairs=*/12),
+       std::make_shared<orc::LineBatchRepresentation>(
+           source, std::vector<size_t>{1, 2})};
+
+  const FrameHandle upstream = source->acquire_frame(FrameID{5});
+  for (const auto& wrapper : wrappers) {
+    const FrameHandle frame = wrapper->acquire_frame(FrameID{5});
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->frame_id, FrameID{5});
+    EXPECT_EQ(frame->samples, source->buffer(FrameID{5}));
+    EXPECT_EQ(frame->luma, upstream->luma);
+    EXPECT_EQ(frame->chroma, upstream->chroma);
+    EXPECT_EQ(frame->dropouts.size(), upstream->dropouts.size());
+  }
+}
+
+}  // namespace orc_unit_test
@@ -0,0 +1,193 @@
+/*
+ * File:        line_batch_representation_contract_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Contract tests: VideoFrameRepresentation::read_lines() layout
+ *              and LineBatchRepresentation serving batched lines without
+ *              touching whole frames.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include <gtest/gtest.h>
+#include <orc/stage/video_frame_representation.h>
+#include <orc/support/line_batch_representation.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../../../orc/plugins/stages/audio_align/audio_align_stage.h"
+#include "../../../orc/plugins/stages/audio_channel_map/audio_channel_map_stage.h"
+
+namespace orc_unit_test {
+
+namespace {
+
+using orc::FrameDescriptor;
+using orc::FrameID;
+using orc::FrameIDRange;
+using orc::LineBatchRepresentation;
+using orc::SourceParameters;
+using orc::VideoFrameRepresentation;
+using orc::VideoSystem;
+using sample_type = orc::VideoFrameRepresentation::sample_type;
+
+constexpr size_t kWidth = 16;
+constexpr size_t kHeight = 8;
+constexpr size_t kSamplesTotal = kWidth * kHeight;
+constexpr size_t kFrames = 32;
+
+// In-memory source: sample i of frame f holds f * 1000 + i. NTSC geometry
+// keeps every line at kWidth samples. Counts whole-frame and batched reads.
+class FakeSource : public VideoFrameRepresentation {
+ public:
+  FakeSource() {
+    for (size_t f = 0; f < kFrames; ++f) {
+      std::vector<sample_type> frame(kSamplesTotal);
+      for (size_t i = 0; i < kSamplesTotal; ++i) {
+        frame[i] = static_cast<sample_type>(f * 1000 + i);
+      }
+      frames_.push_back(std::move(frame));
+    }
+  }
+
+  FrameIDRange frame_range() const override {
+    return {FrameID{0}, FrameID{kFrames - 1}};
+  }
+  size_t frame_count() const override { return kFrames; }
+  bool has_frame(FrameID id) const override { return id < kFrames; }
+  std::optional<FrameDescriptor> get_frame_descriptor(
+      FrameID id) const override {
+    if (!has_frame(id)) return std::nullopt;
+    FrameDescriptor desc;
+    desc.frame_id = id;
+    desc.system = VideoSystem::NTSC;
+    desc.height = kHeight;
+    desc.samples_total = kSamplesTotal;
+    desc.samples_per_line_nominal = kWidth;
+    return desc;
+  }
+
+  const sample_type* get_frame(FrameID id) const override {
+    ++frame_reads;
+    return has_frame(id) ? frames_[id].data() : nullptr;
+  }
+  std::vector<sample_type> get_frame_copy(FrameID id) const override {
+    return has_frame(id) ? frames_[id] : std::vector<sample_type>{};
+  }
+  bool read_lines(FrameIDRange frames, const std::vector<size_t>& lines,
+                  std::vector<sample_type>& out) const override {
+    ++batched_reads;
+    return VideoFrameRepresentation::read_lines(frames, lines, out);
+  }
+
+  std::optional<SourceParameters> get_video_parameters() const override {
+    SourceParameters params;
+    params.system = VideoSystem::NTSC;
+    params.frame_width_nominal = static_cast<int32_t>(kWidth);
+    params.frame_height = static_cast<int32_t>(kHeight);
+    params.number_of_sequential_frames = static_cast<int32_t>(kFrames);
+    return params;
+  }
+
+  mutable std::atomic<int> frame_reads{0};
+  mutable std::atomic<int> batched_reads{0};
+
+ private:
+  std::vector<std::vector<sample_type>> frames_;
+};
+
+sample_type first_sample(size_t frame, size_t line) {
+  return static_cast<sample_type>(frame * 1000 + line * kWidth);
+}
+
+}  // namespace
+
+TEST(LineBatchContractTest, ReadLines_IsFrameMajorInRequestedLineOrder) {
+  FakeSource source;
+  std::vector<sample_type> out;
+  ASSERT_TRUE(source.read_lines({FrameID{3}, FrameID{5}}, {6, 1}, out));
+  ASSERT_EQ(out.size(), 3 * 2 * kWidth);
+  EXPECT_EQ(out[0], first_sample(3, 6));
+  EXPECT_EQ(out[kWidth], first_sample(3, 1));
+  EXPECT_EQ(out[2 * kWidth], first_sample(4, 6));
+  EXPECT_EQ(out[5 * kWidth], first_sample(5, 1));
+  EXPECT_EQ(out[5 * kWidth + kWidth - 1],
+            static_cast<sample_type>(first_sample(5, 1) + kWidth - 1));
+}
+
+TEST(LineBatchContractTest, ReadLines_ZeroFillsRowsThatCannotBeRead) {
+  FakeSource source;
+  std::vector<sample_type> out;
+  EXPECT_FALSE(
+      source.read_lines({FrameID{kFrames - 1}, FrameID{kFrames}}, {2}, out));
+  ASSERT_EQ(out.size(), 2 * kWidth);
+  EXPECT_EQ(out[0], first_sample(kFrames - 1, 2));
+  EXPECT_EQ(out[kWidth], 0);
+}
+
+TEST(LineBatchContractTest, Batch_ServesLoadedLinesWithoutFrameReads) {
+  auto source = std::make_shared<FakeSource>();
+  LineBatchRepresentation batch(source, {2, 5});
+  ASSERT_TRUE(batch.load({FrameID{4}, FrameID{9}}));
+  EXPECT_EQ(source->batched_reads.load(), 1);
+  source->frame_reads = 0;
+
+  const sample_type* line = batch.get_line(FrameID{7}, 5);
+  ASSERT_NE(line, nullptr);
+  EXPECT_EQ(line[0], first_sample(7, 5));
+  const auto samples = batch.get_line_samples(FrameID{4}, 2);
+  ASSERT_EQ(samples.size(), kWidth);
+  EXPECT_EQ(samples[1], static_cast<sample_type>(first_sample(4, 2) + 1));
+  EXPECT_EQ(source->frame_reads.load(), 0);
+
+  // Lines and frames outside the batch fall through to the source.
+  const sample_type* other_line = batch.get_line(FrameID{7}, 3);
+  ASSERT_NE(other_line, nullptr);
+  EXPECT_EQ(other_line[0], first_sample(7, 3));
+  const sample_type* other_frame = batch.get_line(FrameID{10}, 2);
+  ASSERT_NE(other_frame, nullptr);
+  EXPECT_EQ(other_frame[0], first_sample(10, 2));
+  EXPECT_EQ(source->frame_reads.load(), 2);
+}
+
+TEST(LineBatchContractTest, Load_ClampsToSourceRange) {
+  auto source = std::make_shared<FakeSource>();
+  LineBatchRepresentation batch(source, {0});
+  ASSERT_TRUE(batch.load({FrameID{kFrames - 2}, FrameID{kFrames + 10}}));
+  EXPECT_EQ(batch.loaded_range().first, FrameID{kFrames - 2});
+  EXPECT_EQ(batch.loaded_range().last, FrameID{kFrames - 1});
+
+  EXPECT_FALSE(batch.load({FrameID{kFrames}, FrameID{kFrames + 4}}));
+  EXPECT_TRUE(batch.loaded_range().empty());
+}
+
+TEST(LineBatchContractTest, AudioWrappers_ForwardBatchedReads) {
+  // Audio stages leave video lines untouched, so a line scan through them
+  // must reach the source's batched read rather than the per-frame default.
+  auto source = std::make_shared<FakeSource>();
+  const std::vector<std::shared_ptr<const VideoFrameRepresentation>> wrappers =
+      {std::make_shared<orc::AlignedAudioChannelPairRepresentation>(
+           source, /*channel_pair=*/0, /*offset_pairs=*/12),
+       std::make_shared<orc::ChannelMappedRepresentation>(
+           source, /*source_pair=*/0,
+           orc::AudioChannelMapOperation::kLeftToMono,
+           /*target_is_new=*/false, /*target_pair=*/0,
+           /*override_description=*/false, std::string{})};
+
+  for (const auto& wrapper : wrappers) {
+    source->batched_reads = 0;
+    source->frame_reads = 0;
+    std::vector<sample_type> out;
+    ASSERT_TRUE(wrapper->read_lines({FrameID{2}, FrameID{3}}, {4}, out));
+    ASSERT_EQ(out.size(), 2 * kWidth);
+    EXPECT_EQ(out[0], first_sample(2, 4));
+    EXPECT_EQ(out[kWidth], first_sample(3, 4));
+    EXPECT_EQ(source->batched_reads.load(), 1);
+  }
+}
+
+}  // namespace orc_unit_test
@@ -0,0 +1,309 @@
+/*
+ * File:        line_overlay_representation_contract_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Contract tests: LineOverlayFrameRepresentation shares upstream
+ *              buffers for unchanged frames/lines, substitutes only overlaid
+ *              lines, keeps materialised frames within its cache budget, and
+ *              translates frame IDs on every per-frame accessor.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include <gtest/gtest.h>
+#include <orc/stage/line_overlay_representation.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace orc_unit_test {
+
+namespace {
+
+using orc::DropoutRun;
+using orc::FrameDescriptor;
+using orc::FrameID;
+using orc::FrameIDRange;
+using orc::LineOverlayFrameRepresentation;
+using orc::SourceParameters;
+using orc::VideoFrameRepresentation;
+using orc::VideoSystem;
+using sample_type = orc::VideoFrameRepresentation::sample_type;
+
+constexpr size_t kWidth = 16;
+constexpr size_t kHeight = 8;
+constexpr size_t kSamplesTotal = kWidth * kHeight;
+constexpr size_t kFrames = 64;
+constexpr sample_type kBlanking = 60;
+
+// In-memory multi-frame source. Sample i of frame f holds f * 1000 + i; luma
+// and chroma are offset by 100 and 200. NTSC geometry keeps every line at
+// kWidth samples.
+class FakeSource : public VideoFrameRepresentation {
+ public:
+  explicit FakeSource(bool separate_channels = false)
+      : separate_channels_(separate_channels) {
+    for (size_t f = 0; f < kFrames; ++f) {
+      std::vector<sample_type> frame(kSamplesTotal);
+      for (size_t i = 0; i < kSamplesTotal; ++i) {
+        frame[i] = static_cast<sample_type>(f * 1000 + i);
+      }
+      frames_.push_back(frame);
+      for (auto& s : frame) s = static_cast<sample_type>(s + 100);
+      luma_.push_back(frame);
+      for (auto& s : frame) s = static_cast<sample_type>(s + 100);
+      chroma_.push_back(frame);
+    }
+  }
+
+  FrameIDRange frame_range() const override {
+    return {FrameID{0}, FrameID{kFrames - 1}};
+  }
+  size_t frame_count() const override { return kFrames; }
+  bool has_frame(FrameID id) const override { return id < kFrames; }
+
+  std::optional<FrameDescriptor> get_frame_descriptor(
+      FrameID id) const override {
+    if (!has_frame(id)) return std::nullopt;
+    FrameDescriptor desc;
+    desc.frame_id = id;
+    desc.system = VideoSystem::NTSC;
+    desc.height = kHeight;
+    desc.samples_total = kSamplesTotal;
+    desc.samples_per_line_nominal = kWidth;
+    return desc;
+  }
+
+  const sample_type* get_frame(FrameID id) const override {
+    return has_frame(id) ? frames_[id].data() : nullptr;
+  }
+  std::vector<sample_type> get_frame_copy(FrameID id) const override {
+    return has_frame(id) ? frames_[id] : std::vector<sample_type>{};
+  }
+  std::vector<sample_type> get_line_samples(FrameID id,
+                                            size_t line) const override {
+    ++line_sample_reads;
+    return VideoFrameRepresentation::get_line_samples(id, line);
+  }
+  bool read_lines(FrameIDRange frames, const std::vector<size_t>& lines,
+                  std::vector<sample_type>& out) const override {
+    ++batched_reads;
+    return VideoFrameRepresentation::read_lines(frames, lines, out);
+  }
+
+  bool has_separate_channels() const override { return separate_channels_; }
+  const sample_type* get_frame_luma(FrameID id) const override {
+    return (separate_channels_ && has_frame(id)) ? luma_[id].data() : nullptr;
+  }
+  const sample_type* get_frame_chroma(FrameID id) const override {
+    return (separate_channels_ && has_frame(id)) ? chroma_[id].data()
+                                                 : nullptr;
+  }
+
+  std::vector<DropoutRun> get_dropout_hints(FrameID id) const override {
+    DropoutRun run;
+    run.frame_id = id;
+    return {run};
+  }
+
+  std::optional<SourceParameters> get_video_parameters() const override {
+    SourceParameters params;
+    params.system = VideoSystem::NTSC;
+    params.frame_width_nominal = static_cast<int32_t>(kWidth);
+    params.frame_height = static_cast<int32_t>(kHeight);
+    params.blanking_level = kBlanking;
+    params.number_of_sequential_frames = static_cast<int32_t>(kFrames);
+    return params;
+  }
+
+  mutable std::atomic<int> line_sample_reads{0};
+  mutable std::atomic<int> batched_reads{0};
+
+ private:
+  bool separate_channels_;
+  std::vector<std::vector<sample_type>> frames_;
+  std::vector<std::vector<sample_type>> luma_;
+  std::vector<std::vector<sample_type>> chroma_;
+};
+
+// Overlay that fills line |line_| of every frame with -1 - frame (so the
+// substitute differs per frame), optionally skipping |skip_| output frames
+// (remapped to source frame id - skip_) and prepending |pad_| synthetic
+// frames.
+class TestOverlay : public LineOverlayFrameRepresentation {
+ public:
+  TestOverlay(std::shared_ptr<const VideoFrameRepresentation> source,
+              std::optional<size_t> line, size_t skip = 0, size_t pad = 0,
+              size_t budget = kDefaultCacheBudgetBytes)
+      : LineOverlayFrameRepresentation(std::move(source), budget),
+        line_(line),
+        skip_(skip),
+        pad_(pad) {}
+
+  size_t frame_count() const override { return kFrames - skip_ + pad_; }
+
+ protected:
+  std::optional<FrameID> source_frame_id(FrameID id) const override {
+    if (id < pad_ || id - pad_ + skip_ >= kFrames) return std::nullopt;
+    return id - pad_ + skip_;
+  }
+  bool is_synthetic_frame(FrameID id) const override { return id < pad_; }
+  bool overlays_line(FrameID /*id*/, size_t line) const override {
+    return line_ && *line_ == line;
+  }
+  void render_overlay_line(FrameID id, size_t /*line*/, Plane /*plane*/,
+                           sample_type* out, size_t count) const override {
+    std::fill(out, out + count,
+              static_cast<sample_type>(-1 - static_cast<int>(id)));
+  }
+
+ private:
+  std::optional<size_t> line_;
+  size_t skip_;
+  size_t pad_;
+};
+
+}  // namespace
+
+TEST(LineOverlayContractTest, FramesWithoutOverlay_ShareUpstreamBuffer) {
+  auto source = std::make_shared<FakeSource>();
+  TestOverlay overlay(source, std::nullopt);
+
+  EXPECT_EQ(overlay.get_frame(FrameID{5}), source->get_frame(FrameID{5}));
+  EXPECT_EQ(overlay.get_line(FrameID{5}, 3), source->get_line(FrameID{5}, 3));
+  EXPECT_EQ(overlay.cached_frame_count(), 0u);
+}
+
+TEST(LineOverlayContractTest, OverlaidLine_IsSubstitutedOthersShared) {
+  auto source = std::make_shared<FakeSource>();
+  TestOverlay overlay(source, 2);
+
+  // Unchanged lines come straight from the source buffer.
+  EXPECT_EQ(overlay.get_line(FrameID{7}, 3), source->get_line(FrameID{7}, 3));
+
+  // The overlaid line is rendered without materialising the frame.
+  const sample_type* line = overlay.get_line(FrameID{7}, 2);
+  ASSERT_NE(line, nullptr);
+  EXPECT_EQ(line[0], -8);
+  EXPECT_EQ(line[kWidth - 1], -8);
+  EXPECT_EQ(overlay.cached_frame_count(), 0u);
+
+  // The flat frame carries the substitute and the untouched lines.
+  const sample_type* frame = overlay.get_frame(FrameID{7});
+  ASSERT_NE(frame, nullptr);
+  EXPECT_NE(frame, source->get_frame(FrameID{7}));
+  EXPECT_EQ(frame[2 * kWidth], -8);
+  EXPECT_EQ(frame[3 * kWidth], static_cast<sample_type>(7000 + 3 * kWidth));
+
+  const auto copy = overlay.get_frame_copy(FrameID{7});
+  ASSERT_EQ(copy.size(), kSamplesTotal);
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), frame));
+}
+
+TEST(LineOverlayContractTest, LineSamples_ForwardUnchangedLinesToSource) {
+  auto source = std::make_shared<FakeSource>();
+  TestOverlay overlay(source, 2);
+
+  const auto unchanged = overlay.get_line_samples(FrameID{1}, 4);
+  EXPECT_EQ(source->line_sample_reads.load(), 1);
+  ASSERT_EQ(unchanged.size(), kWidth);
+  EXPECT_EQ(unchanged[0], static_cast<sample_type>(1000 + 4 * kWidth));
+
+  const auto overlaid = overlay.get_line_samples(FrameID{1}, 2);
+  EXPECT_EQ(source->line_sample_reads.load(), 1);
+  ASSERT_EQ(overlaid.size(), kWidth);
+  EXPECT_EQ(overlaid[0], -2);
+}
+
+TEST(LineOverlayContractTest, ReadLines_ForwardsUnchangedRunsAsOneBatch) {
+  auto source = std::make_shared<FakeSource>();
+  TestOverlay overlay(source, 2, /*skip=*/10);
+
+  std::vector<sample_type> out;
+  ASSERT_TRUE(overlay.read_lines({FrameID{0}, FrameID{9}}, {3, 4}, out));
+  EXPECT_EQ(source->batched_reads.load(), 1);
+  ASSERT_EQ(out.size(), 10 * 2 * kWidth);
+  EXPECT_EQ(out[0], static_cast<sample_type>(10000 + 3 * kWidth));
+  EXPECT_EQ(out[19 * kWidth], static_cast<sample_type>(19000 + 4 * kWidth));
+
+  // A requested overlaid line keeps those frames off the batched path.
+  ASSERT_TRUE(overlay.read_lines({FrameID{0}, FrameID{1}}, {2, 3}, out));
+  EXPECT_EQ(source->batched_reads.load(), 1);
+  ASSERT_EQ(out.size(), 2 * 2 * kWidth);
+  EXPECT_EQ(out[0], -1);
+  EXPECT_EQ(out[3 * kWidth], static_cast<sample_type>(11000 + 3 * kWidth));
+}
+
+TEST(LineOverlayContractTest, MaterialisedFrames_StayWithinBudget) {
+  auto source = std::make_shared<FakeSource>();
+  const size_t budget = 8 * kSamplesTotal * sizeof(sample_type);
+  TestOverlay overlay(source, 0, 0, 0, budget);
+
+  for (FrameID id = 0; id < kFrames; ++id) {
+    const sample_type* frame = overlay.get_frame(id);
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame[0], static_cast<sample_type>(-1 - static_cast<int>(id)));
+    EXPECT_EQ(frame[kWidth], static_cast<sample_type>(id * 1000 + kWidth));
+  }
+  EXPECT_GE(overlay.cached_frame_count(), 4u);
+  EXPECT_LE(overlay.cached_frame_count(), 8u);
+}
+
+TEST(LineOverlayContractTest, YCPlanes_AreOverlaidIndependently) {
+  auto source = std::make_shared<FakeSource>(/*separate_channels=*/true);
+  TestOverlay overlay(source, 1);
+
+  const sample_type* luma = overlay.get_frame_luma(FrameID{3});
+  const sample_type* chroma = overlay.get_frame_chroma(FrameID{3});
+  ASSERT_NE(luma, nullptr);
+  ASSERT_NE(chroma, nullptr);
+  EXPECT_EQ(luma[0], static_cast<sample_type>(3100));
+  EXPECT_EQ(chroma[0], static_cast<sample_type>(3200));
+  EXPECT_EQ(luma[kWidth], -4);
+  EXPECT_EQ(chroma[kWidth], -4);
+  EXPECT_EQ(overlay.get_line_luma(FrameID{3}, 0),
+            source->get_line_luma(FrameID{3}, 0));
+}
+
+TEST(LineOverlayContractTest, RemappedFrames_TranslateEveryAccessor) {
+  auto source = std::make_shared<FakeSource>();
+  TestOverlay overlay(source, std::nullopt, /*skip=*/10);
+
+  EXPECT_EQ(overlay.get_frame(FrameID{0}), source->get_frame(FrameID{10}));
+  const auto desc = overlay.get_frame_descriptor(FrameID{0});
+  ASSERT_TRUE(desc.has_value());
+  EXPECT_EQ(desc->frame_id, FrameID{0});
+
+  const auto runs = overlay.get_dropout_hints(FrameID{0});
+  ASSERT_EQ(runs.size(), 1u);
+  EXPECT_EQ(runs[0].frame_id, FrameID{0});
+
+  EXPECT_FALSE(overlay.has_frame(FrameID{kFrames - 10}));
+  EXPECT_EQ(overlay.get_frame(FrameID{kFrames - 10}), nullptr);
+}
+
+TEST(LineOverlayContractTest, SyntheticFrames_AreSharedBlankingFrames) {
+  auto source = std::make_shared<FakeSource>(/*separate_channels=*/true);
+  TestOverlay overlay(source, std::nullopt, 0, /*pad=*/3);
+
+  EXPECT_TRUE(overlay.has_frame(FrameID{0}));
+  const sample_type* first = overlay.get_frame(FrameID{0});
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first, overlay.get_frame(FrameID{2}));
+  EXPECT_EQ(first[0], kBlanking);
+  EXPECT_EQ(first[kSamplesTotal - 1], kBlanking);
+
+  const sample_type* line = overlay.get_line(FrameID{1}, kHeight - 1);
+  ASSERT_NE(line, nullptr);
+  EXPECT_EQ(line[kWidth - 1], kBlanking);
+
+  EXPECT_EQ(overlay.get_frame_luma(FrameID{0}), nullptr);
+  EXPECT_TRUE(overlay.get_dropout_hints(FrameID{0}).empty());
+  EXPECT_EQ(overlay.get_frame(FrameID{3}), source->get_frame(FrameID{0}));
+  EXPECT_EQ(overlay.cached_frame_count(), 0u);
+}
+
+}  // namespace orc_unit_test
@@ -0,0 +1,181 @@
+/*
+ * File:        project_to_dag_incremental_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Contracts for incremental DAG rebuilds after parameter edits
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include <gtest/gtest.h>
+#include <orc/stage/params/stage_parameter.h>
+#include <orc/stage/stage.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../../orc/core/include/dag_frame_renderer.h"
+#include "../../../orc/core/include/project.h"
+#include "../../../orc/core/include/project_to_dag.h"
+#include "../../../orc/core/include/stage_registry.h"
+
+namespace orc_unit_test {
+namespace {
+
+constexpr const char* kSourceStage = "incremental_test_source";
+constexpr const char* kTransformStage = "incremental_test_transform";
+constexpr const char* kSinkStage = "incremental_test_sink";
+
+// Minimal parameterized stage; only its identity matters to these tests.
+class FakeStage : public orc::DAGStage, public orc::ParameterizedStage {
+ public:
+  FakeStage(orc::NodeType type, std::string name)
+      : type_(type), name_(std::move(name)) {}
+
+  std::string version() const override { return "1.0"; }
+
+  orc::NodeTypeInfo get_node_type_info() const override {
+    const bool is_source = type_ == orc::NodeType::SOURCE;
+    const bool is_sink = type_ == orc::NodeType::SINK;
+    return orc::NodeTypeInfo(
+        type_, name_, name_, "test stage", is_source ? 0 : 1,
+        is_source ? 0 : 1, is_sink ? 0 : 1, is_sink ? 0 : 1,
+        orc::VideoFormatCompatibility::ALL, orc::SinkCategory::CORE, "Test");
+  }
+
+  std::vector<orc::ArtifactPtr> execute(
+      const std::vector<orc::ArtifactPtr>& /*inputs*/,
+      const std::map<std::string, orc::ParameterValue>& /*parameters*/,
+      orc::ObservationContext& /*observation_context*/) override {
+    return {};
+  }
+
+  size_t required_input_count() const override {
+    return type_ == orc::NodeType::SOURCE ? 0 : 1;
+  }
+  size_t output_count() const override {
+    return type_ == orc::NodeType::SINK ? 0 : 1;
+  }
+
+  std::vector<orc::ParameterDescriptor> get_parameter_descriptors(
+      orc::VideoSystem, orc::SourceType) const override {
+    return {};
+  }
+  std::map<std::string, orc::ParameterValue> get_parameters() const override {
+    return parameters_;
+  }
+  bool set_parameters(
+      const std::map<std::string, orc::ParameterValue>& params) override {
+    parameters_ = params;
+    return true;
+  }
+
+ private:
+  orc::NodeType type_;
+  std::string name_;
+  std::map<std::string, orc::ParameterValue> parameters_;
+};
+
+void register_fake_stages() {
+  auto& registry = orc::StageRegistry::instance();
+  const std::vector<std::pair<orc::NodeType, std::string>> stages = {
+      {orc::NodeType::SOURCE, kSourceStage},
+      {orc::NodeType::TRANSFORM, kTransformStage},
+      {orc::NodeType::SINK, kSinkStage}};
+  for (const auto& [type, name] : stages) {
+    if (!registry.has_stage(name)) {
+      registry.register_stage(name, [type = type, name = name]() {
+        return std::make_shared<FakeStage>(type, name);
+      });
+    }
+  }
+}
+
+// source -> transform -> sink, with the given "value" parameters. Node IDs
+// are allocated in order from a fresh project, so they are 1, 2 and 3 for
+// every chain.
+orc::Project make_chain(const std::string& source_value,
+                        const std::string& transform_value) {
+  auto project = orc::project_io::create_empty_project(
+      "incremental-rebuild", orc::VideoSystem::PAL, orc::SourceType::Composite);
+  const auto source = orc::project_io::add_node(project, kSourceStage, 0, 0);
+  const auto transform =
+      orc::project_io::add_node(project, kTransformStage, 100, 0);
+  const auto sink = orc::project_io::add_node(project, kSinkStage, 200, 0);
+  orc::project_io::add_edge(project, source, transform);
+  orc::project_io::add_edge(project, transform, sink);
+  orc::project_io::set_node_parameters(project, source,
+                                       {{"value", source_value}});
+  orc::project_io::set_node_parameters(project, transform,
+                                       {{"value", transform_value}});
+  return project;
+}
+
+const orc::DAGStage* stage_of(const orc::DAG& dag, uint64_t id) {
+  for (const auto& node : dag.nodes()) {
+    if (node.node_id == orc::NodeID(id)) {
+      return node.stage.get();
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST(ProjectToDagIncrementalTest, DownstreamEdit_KeepsUpstreamStageInstances) {
+  register_fake_stages();
+  const auto before = orc::project_to_dag(make_chain("a.tbc", "x"));
+  const auto after =
+      orc::project_to_dag(make_chain("a.tbc", "y"), before.get());
+
+  EXPECT_EQ(stage_of(*after, 1), stage_of(*before, 1));
+  EXPECT_NE(stage_of(*after, 2), stage_of(*before, 2));
+  // The sink's own parameters are unchanged but its input is not.
+  EXPECT_NE(stage_of(*after, 3), stage_of(*before, 3));
+}
+
+TEST(ProjectToDagIncrementalTest, SourceEdit_ReplacesWholeChain) {
+  register_fake_stages();
+  const auto before = orc::project_to_dag(make_chain("a.tbc", "x"));
+  const auto after =
+      orc::project_to_dag(make_chain("b.tbc", "x"), before.get());
+
+  for (uint64_t id = 1; id <= 3; ++id) {
+    EXPECT_NE(stage_of(*after, id), stage_of(*before, id)) << "node " << id;
+  }
+}
+
+TEST(ProjectToDagIncrementalTest, ReusedStage_KeepsItsParameters) {
+  register_fake_stages();
+  const auto before = orc::project_to_dag(make_chain("a.tbc", "x"));
+  const auto after =
+      orc::project_to_dag(make_chain("a.tbc", "y"), before.get());
+
+  const auto* source =
+      dynamic_cast<const orc::ParameterizedStage*>(stage_of(*after, 1));
+  ASSERT_NE(source, nullptr);
+  EXPECT_EQ(std::get<std::string>(source->get_parameters().at("value")),
+            "a.tbc");
+  const auto* transform =
+      dynamic_cast<const orc::ParameterizedStage*>(stage_of(*after, 2));
+  ASSERT_NE(transform, nullptr);
+  EXPECT_EQ(std::get<std::string>(transform->get_parameters().at("value")),
+            "y");
+}
+
+TEST(ProjectToDagIncrementalTest, FrameRenderer_InvalidatesOnlyChangedNodes) {
+  register_fake_stages();
+  const auto before = orc::project_to_dag(make_chain("a.tbc", "x"));
+  orc::DAGFrameRenderer renderer(before);
+
+  EXPECT_EQ(renderer.update_dag(
+                orc::project_to_dag(make_chain("a.tbc", "y"), before.get())),
+            2u);
+  // A DAG built from scratch shares no stage instances.
+  EXPECT_EQ(renderer.update_dag(orc::project_to_dag(make_chain("a.tbc", "y"))),
+            3u);
+}
+
+}  // namespace orc_unit_test
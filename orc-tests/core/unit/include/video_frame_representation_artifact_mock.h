@@ -24,6 +24,15 @@ class MockVideoFrameRepresentationArtifact
  public:
   MockVideoFrameRepresentationArtifact()
       : orc::Artifact(orc::ArtifactID("test_vfr_artifact"), orc::Provenance{}) {
+    // Range reads assemble from the mocked get_audio_samples() unless a test
+    // sets its own expectation.
+    ON_CALL(*this, read_audio)
+        .WillByDefault(
+            [this](size_t pair, uint64_t start_pair, size_t count,
+                   int32_t* out) {
+              return orc::VideoFrameRepresentation::read_audio(
+                  pair, start_pair, count, out);
+            });
   }
 
   using sample_type = orc::VideoFrameRepresentation::sample_type;
@@ -55,6 +64,8 @@ class MockVideoFrameRepresentationArtifact
               get_audio_channel_pair_descriptor, (size_t), (const, override));
   MOCK_METHOD((std::vector<int32_t>), get_audio_samples, (size_t, orc::FrameID),
               (const, override));
+  MOCK_METHOD(bool, read_audio, (size_t, uint64_t, size_t, int32_t*),
+              (const, override));
 
   // EFM
   MOCK_METHOD(uint32_t, get_efm_sample_count, (orc::FrameID),
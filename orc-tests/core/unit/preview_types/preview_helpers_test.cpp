@@ -303,6 +303,23 @@ TEST(PreviewHelpersTest, NoMask_RendersPlainFullFrame) {
   EXPECT_EQ(gray_at(image, 99, 50), gray_at(image, 100, 50));
 }
 
+// The cancel check is polled per line; once it fires the render stops and
+// returns an invalid image instead of fetching the remaining lines.
+TEST(PreviewHelpersTest, CancelCheck_StopsBetweenLineFetches) {
+  auto rep = std::make_shared<FakePalMarkedLineRepresentation>(75, 60);
+  int polls = 0;
+  const auto image = orc::PreviewHelpers::render_standard_preview(
+      rep, "sequential_raw", 0, orc::PreviewNavigationHint::Random, false,
+      [&polls] { return ++polls > 10; });
+  EXPECT_FALSE(image.is_valid());
+  EXPECT_EQ(polls, 11);
+
+  const auto uncancelled = orc::PreviewHelpers::render_standard_preview(
+      rep, "sequential_raw", 0, orc::PreviewNavigationHint::Random, false,
+      [] { return false; });
+  EXPECT_TRUE(uncancelled.is_valid());
+}
+
 TEST(PreviewHelpersTest, SequentialLumaPreview_UsesPalLineOffsets) {
   auto representation = std::make_shared<FakePalYcRepresentation>();
   const auto image = orc::PreviewHelpers::render_standard_preview(
@@ -10,9 +10,13 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 
+#include "../../../orc/core/include/core_blob_store.h"
 #include "../../../orc/core/include/project.h"
 
 namespace orc_unit_test {
@@ -888,4 +892,93 @@ dag:
   }
 }
 
+// ---------------------------------------------------------------------------
+// Blob parameters: large edit maps live in <project>.blobs sidecar files
+// ---------------------------------------------------------------------------
+
+namespace {
+
+std::string blob_project_yaml(const std::string& value) {
+  return R"yaml(
+project:
+  name: blob-project
+  version: "2.0"
+  video_format: PAL
+  source_format: Composite
+  amplitude_unit: mV
+dag:
+  nodes:
+    - id: 1
+      stage: dropout_map
+      node_type: TRANSFORM
+      x: 0
+      y: 0
+      parameters:
+        dropout_map:
+          type: blob
+          value: ")yaml" +
+         value + R"yaml("
+  edges: []
+)yaml";
+}
+
+std::string read_text(const std::filesystem::path& path) {
+  std::ifstream in(path);
+  std::ostringstream text;
+  text << in.rdbuf();
+  return text.str();
+}
+
+}  // namespace
+
+TEST(ProjectFormatTest, BlobParameter_LoadsLazilyAndSaveRewritesSidecars) {
+  const auto dir =
+      std::filesystem::temp_directory_path() / "orc_project_blob_test";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir / "in.blobs");
+  std::filesystem::create_directories(dir / "out.blobs");
+
+  // Write the sidecar by hand, as a previous save would have.
+  const std::string map_text = "[{frame:42,add:[{line:7,start:1,end:9}]}]";
+  orc::CoreBlobStore scratch;
+  const std::string ref = scratch.put(map_text);
+  const auto file_name = orc::CoreBlobStore::sidecar_file_name(ref);
+  std::ofstream(dir / "in.blobs" / file_name) << map_text;
+  std::ofstream(dir / "out.blobs" / "stale.blob") << "old";
+  std::ofstream(dir / "in.orcprj") << blob_project_yaml(ref);
+
+  const auto project =
+      orc::project_io::load_project((dir / "in.orcprj").string());
+  ASSERT_EQ(project.get_nodes().size(), 1u);
+  const auto& params = project.get_nodes()[0].parameters;
+  EXPECT_EQ(std::get<std::string>(params.at("dropout_map")), ref);
+  EXPECT_EQ(std::get<std::string>(
+                orc::resolve_blob_parameters(params).at("dropout_map")),
+            map_text);
+
+  orc::project_io::save_project(project, (dir / "out.orcprj").string());
+  EXPECT_EQ(read_text(dir / "out.blobs" / file_name), map_text);
+  EXPECT_FALSE(std::filesystem::exists(dir / "out.blobs" / "stale.blob"));
+  const std::string saved = read_text(dir / "out.orcprj");
+  EXPECT_NE(saved.find("type: blob"), std::string::npos) << saved;
+  EXPECT_EQ(saved.find(map_text), std::string::npos) << saved;
+
+  std::filesystem::remove_all(dir);
+}
+
+TEST(ProjectFormatTest, BlobParameter_InvalidReference_Throws) {
+  EXPECT_THROW(orc::project_io::load_project_from_yaml(
+                   blob_project_yaml("blob:sha256:nothex"),
+                   "/tmp/blob-invalid.orcprj"),
+               std::runtime_error);
+  // Right length, but the digest would name a file outside <project>.blobs.
+  const std::string traversal = "../../../../etc/passwd";
+  EXPECT_THROW(
+      orc::project_io::load_project_from_yaml(
+          blob_project_yaml("blob:sha256:" + traversal +
+                            std::string(64 - traversal.size(), '0')),
+          "/tmp/blob-invalid.orcprj"),
+      std::runtime_error);
+}
+
 }  // namespace orc_unit_test
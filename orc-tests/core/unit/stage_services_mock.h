@@ -50,4 +50,13 @@ class MockStageServices : public orc::IStageServices {
   MOCK_METHOD(std::shared_ptr<orc::IFileWriterInt16>,
               create_buffered_file_writer_int16, (size_t buffer_size),
               (override));
+  MOCK_METHOD(std::shared_ptr<orc::IFileWriterUint8>,
+              create_async_file_writer_uint8,
+              (const orc::AsyncFileWriterOptions& options), (override));
+  MOCK_METHOD(std::shared_ptr<orc::IFileWriterUint16>,
+              create_async_file_writer_uint16,
+              (const orc::AsyncFileWriterOptions& options), (override));
+  MOCK_METHOD(std::shared_ptr<orc::IFileWriterInt16>,
+              create_async_file_writer_int16,
+              (const orc::AsyncFileWriterOptions& options), (override));
 };
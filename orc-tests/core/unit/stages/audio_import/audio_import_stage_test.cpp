@@ -30,10 +30,25 @@ class MockAudioImportDeps : public orc::IAudioImportDeps {
  public:
   MOCK_METHOD(orc::WavProbeResult, open, (const std::string& wav_path),
               (override));
-  MOCK_METHOD((std::vector<int16_t>), read_all_pairs_16, (), (const, override));
-  MOCK_METHOD((std::vector<int32_t>), read_all_pairs_24, (), (const, override));
+  MOCK_METHOD((std::vector<int16_t>), read_pairs_16,
+              (uint64_t first_pair, size_t count), (const, override));
+  MOCK_METHOD((std::vector<int32_t>), read_pairs_24,
+              (uint64_t first_pair, size_t count), (const, override));
 };
 
+// Serves ranges of |raw| (interleaved stereo) the way the WAV deps do: short
+// at the end, empty past it.
+template <typename T>
+auto serve_pairs(std::vector<T> raw) {
+  return [raw = std::move(raw)](uint64_t first_pair, size_t count) {
+    const uint64_t pairs = raw.size() / 2;
+    if (first_pair >= pairs) return std::vector<T>{};
+    const uint64_t last = std::min<uint64_t>(pairs, first_pair + count);
+    return std::vector<T>(raw.begin() + static_cast<ptrdiff_t>(first_pair * 2),
+                          raw.begin() + static_cast<ptrdiff_t>(last * 2));
+  };
+}
+
 const orc::ParameterDescriptor* find_descriptor(
     const std::vector<orc::ParameterDescriptor>& descs,
     const std::string& name) {
@@ -168,9 +183,11 @@ TEST(AudioImportStageTest, Import_Converts16BitWavToSynchronousPairs) {
   }
   ON_CALL(*deps, open(_))
       .WillByDefault(Return(orc::WavProbeResult{true, "", 48000, 16, kPairs}));
-  // The whole WAV is read and converted once, on first audio access.
-  EXPECT_CALL(*deps, read_all_pairs_16()).Times(1).WillOnce(Return(raw));
-  EXPECT_CALL(*deps, read_all_pairs_24()).Times(0);
+  // Both frames lie in the first one-second conversion segment: one read.
+  EXPECT_CALL(*deps, read_pairs_16(0u, _))
+      .Times(1)
+      .WillOnce(serve_pairs(raw));
+  EXPECT_CALL(*deps, read_pairs_24(_, _)).Times(0);
 
   auto vfr = make_pal_source();
   auto output =
@@ -205,8 +222,10 @@ TEST(AudioImportStageTest, Import_Converts24BitInputPath) {
   const std::vector<int32_t> raw{100000, -100000, 8388607, -8388608};
   ON_CALL(*deps, open(_))
       .WillByDefault(Return(orc::WavProbeResult{true, "", 48000, 24, 2}));
-  EXPECT_CALL(*deps, read_all_pairs_24()).Times(1).WillOnce(Return(raw));
-  EXPECT_CALL(*deps, read_all_pairs_16()).Times(0);
+  EXPECT_CALL(*deps, read_pairs_24(0u, _))
+      .Times(1)
+      .WillOnce(serve_pairs(raw));
+  EXPECT_CALL(*deps, read_pairs_16(_, _)).Times(0);
 
   auto vfr = make_pal_source();
   auto output = run(stage, vfr, {{"wav_path", std::string("/tmp/a.wav")}});
@@ -234,8 +253,8 @@ TEST(AudioImportStageTest, Import_ResamplesNonNativeRateToCadenceBlocks) {
   // cadence-sized regardless of the source length.
   ON_CALL(*deps, open(_))
       .WillByDefault(Return(orc::WavProbeResult{true, "", 44100, 16, 1000}));
-  ON_CALL(*deps, read_all_pairs_16())
-      .WillByDefault(Return(std::vector<int16_t>(1000 * 2, 100)));
+  ON_CALL(*deps, read_pairs_16(_, _))
+      .WillByDefault(serve_pairs(std::vector<int16_t>(1000 * 2, 100)));
 
   auto vfr = make_pal_source();
   auto output = run(stage, vfr, {{"wav_path", std::string("/tmp/a.wav")}});
@@ -254,8 +273,8 @@ TEST(AudioImportStageTest, Import_SegmentsNtscCadence) {
   constexpr size_t kPairs = 1602u + 1601u;
   ON_CALL(*deps, open(_))
       .WillByDefault(Return(orc::WavProbeResult{true, "", 48000, 16, kPairs}));
-  ON_CALL(*deps, read_all_pairs_16())
-      .WillByDefault(Return(std::vector<int16_t>(kPairs * 2, 7)));
+  ON_CALL(*deps, read_pairs_16(_, _))
+      .WillByDefault(serve_pairs(std::vector<int16_t>(kPairs * 2, 7)));
 
   auto vfr = make_pal_source();
   orc::SourceParameters params;
@@ -268,6 +287,42 @@ TEST(AudioImportStageTest, Import_SegmentsNtscCadence) {
   EXPECT_EQ(output->get_audio_samples(1, orc::FrameID(1)).size(), 1601u * 2u);
 }
 
+TEST(AudioImportStageTest, Import_ReadsOnlyTheRequestedStretchOfTheWav) {
+  orc::AudioImportStage stage;
+  auto deps = std::make_shared<NiceMock<MockAudioImportDeps>>();
+  stage.set_deps_override(deps);
+
+  // An hour of 48000 Hz PAL audio: frame 60000 (40 minutes in) is served
+  // from the one-second segment containing it, not from the whole file.
+  constexpr size_t kFrames = 90000;
+  constexpr uint64_t kPairs = kFrames * 1920u;
+  ON_CALL(*deps, open(_))
+      .WillByDefault(Return(orc::WavProbeResult{true, "", 48000, 16, kPairs}));
+  const uint64_t frame_start = 60000u * 1920u;
+  const uint64_t segment_start = frame_start / 48000u * 48000u;
+  EXPECT_CALL(*deps, read_pairs_16(segment_start, 48000u))
+      .WillOnce([](uint64_t first_pair, size_t count) {
+        std::vector<int16_t> raw(count * 2);
+        for (size_t i = 0; i < raw.size(); ++i) {
+          raw[i] = static_cast<int16_t>((first_pair + i / 2) % 1000);
+        }
+        return raw;
+      });
+
+  auto vfr = make_pal_source();
+  ON_CALL(*vfr, frame_count()).WillByDefault(Return(kFrames));
+  ON_CALL(*vfr, frame_range())
+      .WillByDefault(Return(
+          orc::FrameIDRange{orc::FrameID(0), orc::FrameID(kFrames - 1)}));
+  auto output = run(stage, vfr, {{"wav_path", std::string("/tmp/a.wav")}});
+
+  const auto block = output->get_audio_samples(1, orc::FrameID(60000));
+  ASSERT_EQ(block.size(), 1920u * 2u);
+  EXPECT_EQ(block[0], static_cast<int32_t>(frame_start % 1000) * 256);
+  EXPECT_EQ(block.back(),
+            static_cast<int32_t>((frame_start + 1919) % 1000) * 256);
+}
+
 TEST(AudioImportStageTest, OutOfRangePair_ReturnsEmptyAndNullopt) {
   orc::AudioImportStage stage;
   auto deps = std::make_shared<NiceMock<MockAudioImportDeps>>();
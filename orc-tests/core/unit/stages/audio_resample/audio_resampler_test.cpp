@@ -3,18 +3,20 @@
  * Module:      orc-tests/core/unit/stages/audio_resample
  * Purpose:     Unit tests for the shared AudioResampler library (16→24-bit
  *              widening, any-rate → synchronous 48 kHz conversion, cadence
- *              segmentation)
+ *              segmentation, streaming conversion)
  *
  * SPDX-License-Identifier: GPL-3.0-or-later
  * SPDX-FileCopyrightText: 2026 Simon Inns
  */
 
 #include "audio-resample/audio_resampler.h"
+#include "audio-resample/streaming_audio_resampler.h"
 
 #include <gtest/gtest.h>
 #include <orc/stage/audio/audio_channel_pair.h>
 #include <orc/stage/common_types.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <vector>
@@ -42,6 +44,50 @@ std::vector<int32_t> make_dc_pairs(size_t pair_count, int32_t level) {
   return std::vector<int32_t>(pair_count * 2, level);
 }
 
+// A slow stereo triangle wave in the 24-bit carrier, different per channel,
+// so resampled output is smooth but position-dependent.
+int32_t triangle_sample(uint64_t pair, size_t channel) {
+  const auto phase = static_cast<int32_t>(pair % 2000);
+  const int32_t tri = (phase < 1000 ? phase : 2000 - phase) - 500;
+  return channel == 0 ? tri * 4000 : -tri * 2000;
+}
+
+std::vector<int32_t> make_triangle_pairs(uint64_t first_pair,
+                                         size_t pair_count) {
+  std::vector<int32_t> samples(pair_count * 2);
+  for (size_t i = 0; i < samples.size(); ++i) {
+    samples[i] = triangle_sample(first_pair + i / 2, i % 2);
+  }
+  return samples;
+}
+
+// Serves |pairs| pairs of |sample| to a StreamingAudioResampler, generated
+// on demand, and records what was read.
+struct RecordingReader {
+  int32_t (*sample)(uint64_t pair, size_t channel);
+  uint64_t pairs;
+  uint64_t lowest_pair = UINT64_MAX;
+  uint64_t pairs_read = 0;
+
+  StreamingAudioResampler::InputReader reader() {
+    return [this](uint64_t first, size_t count, int32_t* out) -> size_t {
+      if (first >= pairs) return 0;
+      const auto n =
+          static_cast<size_t>(std::min<uint64_t>(count, pairs - first));
+      for (size_t i = 0; i < n * 2; ++i) {
+        out[i] = sample(first + i / 2, i % 2);
+      }
+      lowest_pair = std::min(lowest_pair, first);
+      pairs_read += n;
+      return n;
+    };
+  }
+};
+
+int32_t ramp_sample(uint64_t pair, size_t) {
+  return static_cast<int32_t>(pair);
+}
+
 }  // namespace
 
 // ===========================================================================
@@ -230,6 +276,95 @@ TEST(AudioResamplerTest, ResampleToSynchronous_UnknownSystemYieldsEmptyFrames) {
   EXPECT_TRUE(frames[1].empty());
 }
 
+// ===========================================================================
+// StreamingAudioResampler
+// ===========================================================================
+
+TEST(StreamingAudioResamplerTest, SameRate_MatchesResampleToSynchronous) {
+  // 48 kHz NTSC material spanning two conversion segments, slightly short
+  // of the 40 frames so the tail is padded.
+  const auto expected = AudioResampler::resample_to_synchronous(
+      make_ramp_pairs(64000), 48000.0, VideoSystem::NTSC, 40);
+  RecordingReader source{ramp_sample, 64000};
+  StreamingAudioResampler streaming(source.reader(), 48000, VideoSystem::NTSC,
+                                    40);
+
+  EXPECT_EQ(streaming.total_pairs(), audio_pair_offset(40, VideoSystem::NTSC));
+  for (uint64_t i = 0; i < 40; ++i) {
+    ASSERT_EQ(streaming.frame_block(i), expected[i]) << "frame " << i;
+  }
+  EXPECT_TRUE(streaming.frame_block(40).empty());
+}
+
+TEST(StreamingAudioResamplerTest, Resampled_MatchesOneShotConversion) {
+  // Three seconds of 44.1 kHz material into four seconds of PAL frames:
+  // the stream crosses several checkpoints and ends in padding.
+  const auto expected = AudioResampler::resample_to_synchronous(
+      make_triangle_pairs(0, 3 * 44100), 44100.0, VideoSystem::PAL, 100);
+  RecordingReader source{triangle_sample, 3 * 44100};
+  StreamingAudioResampler streaming(source.reader(), 44100, VideoSystem::PAL,
+                                    100);
+
+  for (uint64_t i = 0; i < 100; ++i) {
+    const auto block = streaming.frame_block(i);
+    ASSERT_EQ(block.size(), expected[i].size()) << "frame " << i;
+    for (size_t v = 0; v < block.size(); ++v) {
+      ASSERT_NEAR(block[v], expected[i][v], 512) << "frame " << i << " " << v;
+    }
+  }
+  // A sequential pass reads each input pair once.
+  EXPECT_EQ(source.pairs_read, source.pairs);
+}
+
+TEST(StreamingAudioResamplerTest, RandomAccess_RestartsFromNearestCheckpoint) {
+  // Ten minutes of 44.1 kHz material; reading a frame 9 min 20 s in
+  // converts only the stretch around it.
+  RecordingReader source{triangle_sample, 600 * 44100};
+  StreamingAudioResampler streaming(source.reader(), 44100, VideoSystem::PAL,
+                                    15000);
+  const uint64_t frame = 14000;
+  const auto block = streaming.frame_block(frame);
+  EXPECT_GT(source.lowest_pair, 550u * 44100u);
+  EXPECT_LT(source.pairs_read, 3u * 44100u);
+
+  // Same output grid as a conversion started on an earlier whole second.
+  const auto one_shot = AudioResampler::resample(
+      make_triangle_pairs(555 * 44100, 10 * 44100), 44100.0, 48000.0);
+  const uint64_t from =
+      audio_pair_offset(frame, VideoSystem::PAL) - 555 * 48000;
+  ASSERT_EQ(block.size(), 1920u * 2);
+  for (size_t v = 0; v < block.size(); ++v) {
+    ASSERT_NEAR(block[v], one_shot[from * 2 + v], 512) << v;
+  }
+}
+
+TEST(StreamingAudioResamplerTest, Read_SilencesAndReportsPairsPastTheEnd) {
+  RecordingReader source{ramp_sample, 100};
+  StreamingAudioResampler streaming(source.reader(), 48000, VideoSystem::PAL,
+                                    1);
+
+  std::vector<int32_t> out(20, -1);
+  EXPECT_TRUE(streaming.read(95, 10, out.data()));
+  EXPECT_EQ(out[0], 95);
+  EXPECT_EQ(out[8], 99);
+  EXPECT_EQ(out[10], 0);  // past the material: padding
+
+  out.assign(20, -1);
+  EXPECT_FALSE(streaming.read(1915, 10, out.data()));
+  EXPECT_TRUE(std::all_of(out.begin(), out.end(),
+                          [](int32_t s) { return s == 0; }));
+}
+
+TEST(StreamingAudioResamplerTest, UnknownSystem_HasNoStream) {
+  RecordingReader source{ramp_sample, 100};
+  StreamingAudioResampler streaming(source.reader(), 48000,
+                                    VideoSystem::Unknown, 2);
+
+  EXPECT_EQ(streaming.total_pairs(), 0u);
+  EXPECT_TRUE(streaming.frame_block(0).empty());
+  EXPECT_EQ(source.pairs_read, 0u);
+}
+
 // ===========================================================================
 // SDK cadence helpers used by the resampler contract
 // ===========================================================================
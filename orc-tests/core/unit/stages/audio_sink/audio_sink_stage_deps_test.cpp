@@ -12,9 +12,14 @@
 #include <gtest/gtest.h>
 #include <orc/stage/audio/audio_channel_pair.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 #include "../../include/video_frame_representation_artifact_mock.h"
 #include "../../stage_services_mock.h"
 
+using testing::_;
 using testing::A;
 using testing::Return;
 using testing::StrictMock;
@@ -50,6 +55,16 @@ std::vector<int32_t> make_frame_samples(uint64_t frame_index,
   return samples;
 }
 
+// read_audio() action serving |samples| from the start of the requested
+// range, silence after them.
+auto serve_audio(std::vector<int32_t> samples) {
+  return [samples](size_t, uint64_t, size_t count, int32_t* out) {
+    std::fill(out, out + count * 2, 0);
+    std::copy_n(samples.begin(), std::min(samples.size(), count * 2), out);
+    return !samples.empty();
+  };
+}
+
 // Reads a little-endian uint32 at the given byte offset from the header.
 uint32_t header_u32_at(const std::vector<uint8_t>& bytes, size_t byte_offset) {
   return static_cast<uint32_t>(bytes[byte_offset]) |
@@ -139,9 +154,9 @@ TEST_F(AudioSinkStageDeps,
   EXPECT_CALL(mockRepresentation_, frame_range())
       .Times(1)
       .WillOnce(Return(orc::FrameIDRange{0, 0}));
-  EXPECT_CALL(mockRepresentation_, get_audio_samples(0, 0))
+  EXPECT_CALL(mockRepresentation_, read_audio(0, 0, kPalPairsPerFrame, _))
       .Times(1)
-      .WillOnce(Return(carrier));
+      .WillOnce(serve_audio(carrier));
 
   expect_writer_created_and_opened();
 
@@ -186,30 +201,69 @@ TEST_F(AudioSinkStageDeps, WriteAudioWav_SilenceFramesAreSizedByNtscCadence) {
   EXPECT_CALL(mockRepresentation_, frame_range())
       .Times(1)
       .WillOnce(Return(orc::FrameIDRange{0, 1}));
-  EXPECT_CALL(mockRepresentation_, get_audio_samples(0, 0))
+  EXPECT_CALL(mockRepresentation_, read_audio(0, 0, 1602 + 1601, _))
       .Times(1)
-      .WillOnce(Return(std::vector<int32_t>{}));
-  EXPECT_CALL(mockRepresentation_, get_audio_samples(0, 1))
-      .Times(1)
-      .WillOnce(Return(std::vector<int32_t>{}));
+      .WillOnce(serve_audio({}));
 
   expect_writer_created_and_opened();
 
-  // Header plus one silence write per frame.
+  // Header plus one silence write covering both frames.
   std::vector<std::vector<uint8_t>> writes;
-  capture_writes(writes, 3);
+  capture_writes(writes, 2);
 
   const auto result =
       instance_->write_audio_wav(&mockRepresentation_, "out_path.wav", 0);
 
   EXPECT_TRUE(result.success);
   EXPECT_EQ(result.frames_written, 1602U + 1601U);
-  ASSERT_EQ(writes.size(), 3U);
+  ASSERT_EQ(writes.size(), 2U);
   EXPECT_EQ(header_u32_at(writes[0], kWavSampleRateOffset), 48000U);
   EXPECT_EQ(header_u32_at(writes[0], kWavDataSizeOffset),
             (1602U + 1601U) * kBytesPerPair);
-  EXPECT_EQ(writes[1], std::vector<uint8_t>(1602 * kBytesPerPair, 0));
-  EXPECT_EQ(writes[2], std::vector<uint8_t>(1601 * kBytesPerPair, 0));
+  EXPECT_EQ(writes[1], std::vector<uint8_t>((1602 + 1601) * kBytesPerPair, 0));
+}
+
+TEST_F(AudioSinkStageDeps, WriteAudioWav_StreamsContiguousMultiFrameRanges) {
+  // 30 NTSC frames are read as two contiguous ranges of whole frames
+  // (25 + 5), each starting where the previous one ended.
+  const uint64_t split = orc::audio_pair_offset(25, orc::VideoSystem::NTSC);
+  const uint64_t total = orc::audio_pair_offset(30, orc::VideoSystem::NTSC);
+
+  EXPECT_CALL(mockRepresentation_, get_audio_channel_pair_descriptor(0))
+      .Times(1)
+      .WillOnce(Return(analogue_pair_descriptor()));
+  EXPECT_CALL(mockRepresentation_, get_video_parameters())
+      .Times(1)
+      .WillOnce(Return(make_system_params(orc::VideoSystem::NTSC)));
+  EXPECT_CALL(mockRepresentation_, frame_range())
+      .Times(1)
+      .WillOnce(Return(orc::FrameIDRange{0, 29}));
+  EXPECT_CALL(mockRepresentation_, read_audio(0, 0, split, _))
+      .Times(1)
+      .WillOnce(serve_audio({7, -7}));
+  EXPECT_CALL(mockRepresentation_, read_audio(0, split, total - split, _))
+      .Times(1)
+      .WillOnce(serve_audio({9, -9}));
+
+  expect_writer_created_and_opened();
+
+  std::vector<std::vector<uint8_t>> writes;
+  capture_writes(writes, 3);
+
+  const auto result =
+      instance_->write_audio_wav(&mockRepresentation_, "out_path.wav", 0);
+
+  EXPECT_TRUE(result.success);
+  EXPECT_EQ(result.frames_written, total);
+  ASSERT_EQ(writes.size(), 3U);
+  EXPECT_EQ(header_u32_at(writes[0], kWavDataSizeOffset),
+            total * kBytesPerPair);
+  ASSERT_EQ(writes[1].size(), split * kBytesPerPair);
+  ASSERT_EQ(writes[2].size(), (total - split) * kBytesPerPair);
+  EXPECT_EQ(s24le_at(writes[1], 0), 7);
+  EXPECT_EQ(s24le_at(writes[1], 1), -7);
+  EXPECT_EQ(s24le_at(writes[2], 0), 9);
+  EXPECT_EQ(s24le_at(writes[2], 1), -9);
 }
 
 TEST_F(AudioSinkStageDeps, WriteAudioWav_SelectedPair_ReadsThatPairOnly) {
@@ -225,9 +279,9 @@ TEST_F(AudioSinkStageDeps, WriteAudioWav_SelectedPair_ReadsThatPairOnly) {
   EXPECT_CALL(mockRepresentation_, frame_range())
       .Times(1)
       .WillOnce(Return(orc::FrameIDRange{0, 0}));
-  EXPECT_CALL(mockRepresentation_, get_audio_samples(1, 0))
+  EXPECT_CALL(mockRepresentation_, read_audio(1, 0, 1920, _))
       .Times(1)
-      .WillOnce(Return(carrier));
+      .WillOnce(serve_audio(carrier));
 
   expect_writer_created_and_opened();
 
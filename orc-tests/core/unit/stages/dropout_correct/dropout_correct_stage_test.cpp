@@ -14,6 +14,8 @@
 #include <orc/stage/observation/observation_context.h>
 
 #include <algorithm>
+#include <thread>
+#include <vector>
 
 #include "../../include/video_frame_representation_artifact_mock.h"
 
@@ -437,4 +439,134 @@ TEST(DropoutCorrectStageTest, SkipsReplacementLinesWithOverlappingDropout) {
       << "expected a clean in-phase line (96/104), got " << v;
 }
 
+// ---------------------------------------------------------------------------
+// Parallel correction
+// ---------------------------------------------------------------------------
+// Noise-filled frame with hundreds of dropouts, many overlapping on the same
+// line, so replacement choice depends on per-line quality and on the order
+// overlapping regions are written.
+namespace {
+class FakeDamagedSource : public orc::VideoFrameRepresentation,
+                          public orc::Artifact {
+ public:
+  static constexpr size_t kSpl = 910;
+  static constexpr size_t kHeight = 525;
+  static constexpr size_t kDropouts = 400;
+
+  FakeDamagedSource()
+      : orc::Artifact(orc::ArtifactID("fake"), orc::Provenance{}) {
+    uint32_t state = 12345;
+    auto next = [&state]() {
+      state = state * 1664525u + 1013904223u;
+      return state >> 8;
+    };
+    buffer_.resize(kSpl * kHeight);
+    for (auto& sample : buffer_) {
+      sample = static_cast<int16_t>(200 + next() % 600);
+    }
+    for (size_t i = 0; i < kDropouts; ++i) {
+      const uint32_t line = 40 + next() % 440;
+      const uint32_t start = 150 + next() % 500;
+      orc::DropoutRun r;
+      r.frame_id = 0;
+      r.sample_start = line * kSpl + start;
+      r.sample_count = 4 + next() % 60;
+      r.severity = 100;
+      runs_.push_back(r);
+    }
+  }
+  std::string type_name() const override { return "fake_damaged"; }
+  orc::FrameIDRange frame_range() const override {
+    return orc::FrameIDRange{0u, 1u};
+  }
+  size_t frame_count() const override { return 1; }
+  bool has_frame(orc::FrameID id) const override { return id == 0; }
+  std::optional<orc::FrameDescriptor> get_frame_descriptor(
+      orc::FrameID id) const override {
+    if (id != 0) return std::nullopt;
+    orc::FrameDescriptor d;
+    d.frame_id = 0;
+    d.system = orc::VideoSystem::NTSC;
+    d.height = kHeight;
+    d.samples_total = buffer_.size();
+    d.samples_per_line_nominal = kSpl;
+    return d;
+  }
+  const sample_type* get_frame(orc::FrameID id) const override {
+    return id == 0 ? buffer_.data() : nullptr;
+  }
+  std::vector<sample_type> get_frame_copy(orc::FrameID id) const override {
+    return id == 0 ? buffer_ : std::vector<sample_type>{};
+  }
+  std::vector<orc::DropoutRun> get_dropout_hints(
+      orc::FrameID id) const override {
+    return id == 0 ? runs_ : std::vector<orc::DropoutRun>{};
+  }
+  std::optional<orc::SourceParameters> get_video_parameters() const override {
+    orc::SourceParameters p;
+    p.system = orc::VideoSystem::NTSC;
+    p.frame_width_nominal = static_cast<int32_t>(kSpl);
+    p.frame_height = static_cast<int32_t>(kHeight);
+    p.white_level = 800;
+    p.black_level = 240;
+    p.blanking_level = 240;
+    p.active_video_start = 134;
+    p.active_video_end = 753;
+    p.first_active_frame_line = 40;
+    p.last_active_frame_line = 480;
+    return p;
+  }
+
+ private:
+  std::vector<int16_t> buffer_;
+  std::vector<orc::DropoutRun> runs_;
+};
+
+std::vector<int16_t> correct_with_threads(
+    const std::shared_ptr<FakeDamagedSource>& source, uint32_t threads) {
+  orc::DropoutCorrectionConfig config;
+  config.overcorrect_extension = 8;
+  config.thread_count = threads;
+  orc::DropoutCorrectStage stage(config);
+  orc::ObservationContext ctx;
+  const auto outputs = stage.execute({source}, {}, ctx);
+  EXPECT_EQ(outputs.size(), 1u);
+  auto corrected =
+      std::dynamic_pointer_cast<orc::VideoFrameRepresentation>(outputs[0]);
+  EXPECT_NE(corrected, nullptr);
+  return corrected ? corrected->get_frame_copy(0) : std::vector<int16_t>{};
+}
+}  // namespace
+
+// Line bands on several threads must produce exactly the serial result.
+TEST(DropoutCorrectStageTest, ParallelCorrection_MatchesSerialOutput) {
+  auto source = std::make_shared<FakeDamagedSource>();
+  const auto serial = correct_with_threads(source, 1);
+  ASSERT_EQ(serial.size(), source->get_frame_copy(0).size());
+  EXPECT_NE(serial, source->get_frame_copy(0));
+  for (uint32_t threads : {2u, 3u, 8u}) {
+    EXPECT_EQ(correct_with_threads(source, threads), serial)
+        << threads << " threads";
+  }
+}
+
+// Frames corrected from several threads at once share one helper budget;
+// callers that get no helper correct serially, with the same result.
+TEST(DropoutCorrectStageTest, ConcurrentCallers_ShareHelpersAndMatchSerial) {
+  auto source = std::make_shared<FakeDamagedSource>();
+  const auto serial = correct_with_threads(source, 1);
+  std::vector<std::vector<int16_t>> results(6);
+  std::vector<std::thread> callers;
+  for (size_t i = 0; i < results.size(); ++i) {
+    callers.emplace_back(
+        [&, i] { results[i] = correct_with_threads(source, 4); });
+  }
+  for (auto& caller : callers) {
+    caller.join();
+  }
+  for (const auto& result : results) {
+    EXPECT_EQ(result, serial);
+  }
+}
+
 }  // namespace orc_unit_test
@@ -0,0 +1,267 @@
+/*
+ * File:        segmented_front_end_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Unit tests for the parallel, segmented EFM front end
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "efm.h"
+#include "efm_constants.h"
+#include "section.h"
+#include "segmented_front_end.h"
+
+namespace {
+
+constexpr size_t kChunkSize = 1024;
+
+// A warm-up of ~3 sections' worth of T-values, enough to reach section sync.
+constexpr size_t kWarmUpChunks = 40;
+
+uint8_t toBcd(int value) {
+  return static_cast<uint8_t>((value / 10) << 4 | value % 10);
+}
+
+// Q-channel mode 1 block (track 1, index 1) for absolute frame |frames|,
+// including its CRC, as 96 bits.
+std::vector<bool> qChannelBits(int frames) {
+  std::vector<uint8_t> q(12, 0);
+  q[0] = 0x01;
+  q[1] = 0x01;
+  q[2] = 0x01;
+  q[3] = toBcd(frames / (60 * 75));
+  q[4] = toBcd(frames / 75 % 60);
+  q[5] = toBcd(frames % 75);
+  q[7] = q[3];
+  q[8] = q[4];
+  q[9] = q[5];
+
+  uint32_t crc = 0;
+  for (int i = 0; i < 10; ++i) {
+    crc ^= static_cast<uint32_t>(q[i]) << 8;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc <<= 1;
+      if (crc & 0x10000) crc = (crc ^ 0x1021) & 0xFFFF;
+    }
+  }
+  crc = ~crc & 0xFFFF;
+  q[10] = static_cast<uint8_t>(crc >> 8);
+  q[11] = static_cast<uint8_t>(crc);
+
+  std::vector<bool> bits;
+  for (uint8_t byte : q) {
+    for (int bit = 7; bit >= 0; --bit) bits.push_back(byte >> bit & 1);
+  }
+  return bits;
+}
+
+// Builds channel bits for whole sections and converts them to T-values.
+class StreamBuilder {
+ public:
+  std::vector<uint8_t> build(int sectionCount, uint32_t seed) {
+    std::mt19937 rng(seed);
+    for (int section = 0; section < sectionCount; ++section) {
+      const std::vector<bool> q = qChannelBits(section);
+      for (int frame = 0; frame < efm::kFramesPerSection; ++frame) {
+        appendWord("100000000001000000000010");
+        uint16_t subcode = 0;
+        if (frame == 0) {
+          subcode = 256;
+        } else if (frame == 1) {
+          subcode = 257;
+        } else {
+          subcode = static_cast<uint16_t>(0x80 | (q[frame - 2] ? 0x40 : 0));
+        }
+        appendSymbol(subcode);
+        for (int byte = 0; byte < 32; ++byte) appendSymbol(rng() & 0xFF);
+      }
+    }
+    m_bits.push_back('1');
+    return tValues();
+  }
+
+ private:
+  // Merging bits are chosen so that every run of zeros stays within the
+  // 2..10 limit of the channel code.
+  void appendSymbol(uint16_t value) {
+    const std::string word = m_efm.eightToFourteen(value);
+    for (const char* merge : {"000", "100", "010", "001"}) {
+      if (fits(merge + word)) {
+        appendWord(merge);
+        break;
+      }
+    }
+    appendWord(word);
+  }
+
+  bool fits(const std::string& next) const {
+    size_t zeros = 0;
+    for (auto it = m_bits.rbegin(); it != m_bits.rend() && *it == '0'; ++it) {
+      ++zeros;
+    }
+    const bool previousOne = !m_bits.empty() && m_bits.back() == '1';
+    for (size_t i = 0; i < next.size(); ++i) {
+      if (next[i] == '1') {
+        if ((previousOne || zeros > 0 || i > 0) && (zeros < 2 || zeros > 10)) {
+          return false;
+        }
+        zeros = 0;
+      } else {
+        ++zeros;
+      }
+    }
+    return zeros <= 10;
+  }
+
+  void appendWord(const std::string& word) { m_bits += word; }
+
+  std::vector<uint8_t> tValues() const {
+    std::vector<uint8_t> result;
+    size_t last = m_bits.find('1');
+    for (size_t i = last + 1; i < m_bits.size(); ++i) {
+      if (m_bits[i] == '1') {
+        result.push_back(static_cast<uint8_t>(i - last));
+        last = i;
+      }
+    }
+    return result;
+  }
+
+  Efm m_efm;
+  std::string m_bits;
+};
+
+// Flips a T-value in a few short bursts, inserts and drops T-values (bit
+// slips), and replaces a longer stretch with noise so that sync is lost.
+void corrupt(std::vector<uint8_t>& stream, uint32_t seed) {
+  std::mt19937 rng(seed);
+  auto at = [&](size_t limit) { return rng() % (stream.size() - limit); };
+
+  for (int burst = 0; burst < 40; ++burst) {
+    const size_t start = at(64);
+    for (size_t i = 0; i < 1 + rng() % 48; ++i) {
+      stream[start + i] = static_cast<uint8_t>(3 + rng() % 9);
+    }
+  }
+  for (int slip = 0; slip < 10; ++slip) {
+    const size_t position = at(1);
+    if (slip % 2 == 0) {
+      stream.insert(stream.begin() + position, 4);
+    } else {
+      stream.erase(stream.begin() + position);
+    }
+  }
+  const size_t noise = at(20000);
+  for (size_t i = 0; i < 20000; ++i) {
+    stream[noise + i] = static_cast<uint8_t>(3 + rng() % 8);
+  }
+}
+
+std::vector<std::vector<uint8_t>> chunk(const std::vector<uint8_t>& stream) {
+  std::vector<std::vector<uint8_t>> chunks;
+  for (size_t pos = 0; pos < stream.size(); pos += kChunkSize) {
+    const size_t end = std::min(stream.size(), pos + kChunkSize);
+    chunks.emplace_back(stream.begin() + pos, stream.begin() + end);
+  }
+  return chunks;
+}
+
+std::vector<F2Section> decodeSerially(const std::vector<uint8_t>& stream) {
+  FrontEndChain chain;
+  std::vector<F2Section> sections;
+  for (const auto& c : chunk(stream)) chain.pushChunk(c, sections);
+  return sections;
+}
+
+std::vector<F2Section> decodeSegmented(const std::vector<uint8_t>& stream,
+                                       size_t workers, size_t chunksPerSegment,
+                                       size_t warmUpChunks,
+                                       uint64_t* resynced = nullptr) {
+  SegmentedFrontEnd frontEnd(workers, chunksPerSegment, warmUpChunks);
+  std::vector<F2Section> sections;
+  auto drain = [&] {
+    while (frontEnd.isReady()) sections.push_back(frontEnd.popSection());
+  };
+  for (const auto& c : chunk(stream)) {
+    frontEnd.pushChunk(c);
+    drain();
+  }
+  frontEnd.finish();
+  drain();
+  if (resynced) *resynced = frontEnd.resyncedSegments();
+  return sections;
+}
+
+void expectSameSections(const std::vector<F2Section>& actual,
+                        const std::vector<F2Section>& expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    const SectionMetadata& a = actual[i].metadata;
+    const SectionMetadata& e = expected[i].metadata;
+    EXPECT_EQ(a.isValid(), e.isValid()) << "section " << i;
+    EXPECT_EQ(a.absoluteSectionTime().frames(),
+              e.absoluteSectionTime().frames())
+        << "section " << i;
+    for (int f = 0; f < efm::kFramesPerSection; ++f) {
+      ASSERT_EQ(actual[i].frame(f).data(), expected[i].frame(f).data())
+          << "section " << i << " frame " << f;
+      ASSERT_EQ(actual[i].frame(f).errorData(),
+                expected[i].frame(f).errorData())
+          << "section " << i << " frame " << f;
+    }
+  }
+}
+
+TEST(SegmentedFrontEnd, CleanStreamDecodesValidSections) {
+  const std::vector<uint8_t> stream = StreamBuilder().build(120, 1);
+  const auto sections = decodeSerially(stream);
+
+  ASSERT_GT(sections.size(), 100u);
+  int valid = 0;
+  for (const auto& section : sections) valid += section.metadata.isValid();
+  EXPECT_GT(valid, 100);
+}
+
+TEST(SegmentedFrontEnd, CleanStreamMatchesSerialDecodeWithoutResync) {
+  const std::vector<uint8_t> stream = StreamBuilder().build(120, 2);
+  const auto expected = decodeSerially(stream);
+
+  uint64_t resynced = 0;
+  const auto actual =
+      decodeSegmented(stream, 4, 48, kWarmUpChunks, &resynced);
+  expectSameSections(actual, expected);
+  EXPECT_EQ(resynced, 0u);
+}
+
+TEST(SegmentedFrontEnd, DamagedStreamMatchesSerialDecode) {
+  for (uint32_t seed : {3u, 4u, 5u}) {
+    std::vector<uint8_t> stream = StreamBuilder().build(150, seed);
+    corrupt(stream, seed);
+    const auto expected = decodeSerially(stream);
+
+    SCOPED_TRACE("seed " + std::to_string(seed));
+    expectSameSections(decodeSegmented(stream, 4, 48, kWarmUpChunks),
+                       expected);
+    // A warm-up too short to converge is still correct, just serial.
+    expectSameSections(decodeSegmented(stream, 3, 8, 0), expected);
+  }
+}
+
+TEST(SegmentedFrontEnd, SingleWorkerMatchesSerialDecode) {
+  std::vector<uint8_t> stream = StreamBuilder().build(60, 6);
+  corrupt(stream, 6);
+  expectSameSections(decodeSegmented(stream, 1, 10, 4),
+                     decodeSerially(stream));
+}
+
+}  // namespace
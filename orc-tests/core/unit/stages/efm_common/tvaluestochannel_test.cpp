@@ -0,0 +1,136 @@
+/*
+ * File:        tvaluestochannel_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Unit tests for the EFM T-value to channel frame front end
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "dec_tvaluestochannel.h"
+#include "efm_constants.h"
+
+namespace {
+
+// A 588-bit channel frame: the T11+T11 sync header followed by T3..T9 values
+// (never T11) chosen from |seed| so that consecutive frames differ.
+std::vector<uint8_t> makeFrame(uint32_t seed) {
+  std::vector<uint8_t> frame = {efm::kSyncSymbolT11, efm::kSyncSymbolT11};
+  int remaining = efm::kEfmFrameChannelBits - 22;
+  for (uint32_t k = 0; remaining > 0; ++k) {
+    int t = 3 + static_cast<int>((seed * 5 + k) % 7);
+    if (remaining <= 10) {
+      t = remaining;
+    } else if (remaining - t < 3) {
+      t = 3;
+    }
+    frame.push_back(static_cast<uint8_t>(t));
+    remaining -= t;
+  }
+  return frame;
+}
+
+std::vector<uint8_t> makeStream(uint32_t frameCount) {
+  std::vector<uint8_t> stream;
+  for (uint32_t i = 0; i < frameCount; ++i) {
+    const std::vector<uint8_t> frame = makeFrame(i);
+    stream.insert(stream.end(), frame.begin(), frame.end());
+  }
+  return stream;
+}
+
+uint32_t bitsIn(const std::vector<uint8_t>& frame) {
+  return std::accumulate(frame.begin(), frame.end(), 0u);
+}
+
+// Feeds |stream| in chunks of |chunkSize| T-values and collects every frame.
+std::vector<std::vector<uint8_t>> decode(const std::vector<uint8_t>& stream,
+                                         size_t chunkSize) {
+  TvaluesToChannel decoder;
+  std::vector<std::vector<uint8_t>> frames;
+  for (size_t pos = 0; pos < stream.size(); pos += chunkSize) {
+    const size_t end = std::min(stream.size(), pos + chunkSize);
+    decoder.pushFrame(std::vector<uint8_t>(stream.begin() + pos,
+                                           stream.begin() + end));
+    while (decoder.isReady()) frames.push_back(decoder.popFrame());
+  }
+  return frames;
+}
+
+TEST(TvaluesToChannel, EmitsCleanFramesIntact) {
+  const uint32_t frameCount = 50;
+  const auto frames = decode(makeStream(frameCount), 4096);
+
+  // The last frames stay buffered until more T-values arrive.
+  ASSERT_GE(frames.size(), frameCount - 5);
+  for (size_t i = 0; i < frames.size(); ++i) {
+    EXPECT_EQ(frames[i], makeFrame(static_cast<uint32_t>(i))) << "frame " << i;
+  }
+}
+
+TEST(TvaluesToChannel, OutputDoesNotDependOnChunking) {
+  const std::vector<uint8_t> stream = makeStream(200);
+  const auto reference = decode(stream, stream.size());
+
+  for (size_t chunkSize : {1u, 2u, 7u, 191u, 383u, 1000u}) {
+    EXPECT_EQ(decode(stream, chunkSize), reference)
+        << "chunk size " << chunkSize;
+  }
+}
+
+// A corrupt sync header between two frames leaves a 1176-bit run, which the
+// overshoot recovery splits back into two 588-bit frames.
+TEST(TvaluesToChannel, SplitsFramesAcrossCorruptSync) {
+  std::vector<uint8_t> stream = makeFrame(0);
+  std::vector<uint8_t> damaged = makeFrame(1);
+  damaged[1] = 5;
+  damaged.insert(damaged.begin() + 2, 6);  // 11+5+6 keeps the bit count
+  stream.insert(stream.end(), damaged.begin(), damaged.end());
+  const std::vector<uint8_t> tail = makeStream(20);
+  stream.insert(stream.end(), tail.begin(), tail.end());
+
+  const auto frames = decode(stream, stream.size());
+  const uint32_t frameBits = efm::kEfmFrameChannelBits;
+  ASSERT_GE(frames.size(), 2u);
+  EXPECT_EQ(bitsIn(frames[0]), frameBits);
+  EXPECT_EQ(bitsIn(frames[1]), frameBits);
+  EXPECT_EQ(frames[0], makeFrame(0));
+  EXPECT_EQ(frames[1], damaged);
+}
+
+// Noise without any sync header is dropped rather than emitted.
+TEST(TvaluesToChannel, DiscardsNoiseWithoutSync) {
+  std::vector<uint8_t> noise;
+  for (int i = 0; i < 4000; ++i) noise.push_back(3 + i % 7);
+  EXPECT_TRUE(decode(noise, 512).empty());
+}
+
+// popFrame(std::vector&) reuses the caller's buffer, so steady-state draining
+// does not allocate per frame.
+TEST(TvaluesToChannel, PopIntoScratchReusesCapacity) {
+  TvaluesToChannel decoder;
+  decoder.pushFrame(makeStream(40));
+  ASSERT_TRUE(decoder.isReady());
+
+  std::vector<uint8_t> frame;
+  frame.reserve(256);
+  const uint8_t* storage = frame.data();
+  size_t popped = 0;
+  while (decoder.isReady()) {
+    decoder.popFrame(frame);
+    EXPECT_EQ(frame, makeFrame(static_cast<uint32_t>(popped)));
+    EXPECT_EQ(frame.data(), storage);
+    ++popped;
+  }
+  EXPECT_GT(popped, 30u);
+}
+
+}  // namespace
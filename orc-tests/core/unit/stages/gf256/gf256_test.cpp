@@ -0,0 +1,244 @@
+/*
+ * File:        gf256_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Unit tests for the shared GF(2^8) and syndrome kernels
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "gf256/gf256.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using orc::gf256::Isa;
+using orc::gf256::SyndromeKernel;
+
+// Shift-and-add multiply, independent of the tables under test.
+uint8_t referenceMultiply(
+    uint8_t a, uint8_t b,
+    uint16_t polynomial = orc::gf256::kPrimitivePolynomial) {
+  uint16_t product = 0;
+  uint16_t shifted = a;
+  for (int bit = 0; bit < 8; ++bit) {
+    if (b & (1 << bit)) product ^= shifted;
+    shifted <<= 1;
+    if (shifted & 0x100) shifted ^= polynomial;
+  }
+  return static_cast<uint8_t>(product);
+}
+
+// S_i = r(alpha^i) by Horner's rule, symbol 0 the highest-order coefficient.
+std::vector<uint8_t> referenceSyndromes(const uint8_t* word, size_t length,
+                                        size_t roots) {
+  std::vector<uint8_t> syndromes(roots, 0);
+  for (size_t i = 0; i < roots; ++i) {
+    const uint8_t root = orc::gf256::alphaPower(static_cast<uint32_t>(i));
+    for (size_t j = 0; j < length; ++j) {
+      syndromes[i] = referenceMultiply(syndromes[i], root) ^ word[j];
+    }
+  }
+  return syndromes;
+}
+
+// Systematic encode: the message followed by the remainder of
+// message(x) * x^roots modulo
+// g(x) = (x - 1)(x - alpha)...(x - alpha^(roots-1)).
+std::vector<uint8_t> encode(const std::vector<uint8_t>& message,
+                            size_t roots) {
+  std::vector<uint8_t> generator = {1};
+  for (size_t i = 0; i < roots; ++i) {
+    const uint8_t root = orc::gf256::alphaPower(static_cast<uint32_t>(i));
+    std::vector<uint8_t> next(generator.size() + 1, 0);
+    for (size_t k = 0; k < generator.size(); ++k) {
+      next[k] ^= generator[k];
+      next[k + 1] ^= referenceMultiply(generator[k], root);
+    }
+    generator = next;
+  }
+
+  std::vector<uint8_t> word = message;
+  word.resize(message.size() + roots, 0);
+  std::vector<uint8_t> remainder = word;
+  for (size_t k = 0; k < message.size(); ++k) {
+    const uint8_t factor = remainder[k];
+    if (factor == 0) continue;
+    for (size_t g = 0; g < generator.size(); ++g) {
+      remainder[k + g] ^= referenceMultiply(generator[g], factor);
+    }
+  }
+  for (size_t k = message.size(); k < word.size(); ++k) word[k] = remainder[k];
+  return word;
+}
+
+std::vector<uint8_t> randomBytes(size_t count, std::mt19937& rng) {
+  std::vector<uint8_t> bytes(count);
+  for (auto& byte : bytes) byte = static_cast<uint8_t>(rng());
+  return bytes;
+}
+
+TEST(Gf256, TablesMatchReferenceArithmetic) {
+  const auto& t = orc::gf256::tables();
+  for (int a = 0; a < 256; ++a) {
+    if (a != 0) {
+      EXPECT_EQ(t.exp[t.log[a]], a);
+    }
+    for (int b = 0; b < 256; ++b) {
+      const uint8_t expected = referenceMultiply(a, b);
+      ASSERT_EQ(orc::gf256::multiply(a, b), expected) << a << " * " << b;
+      ASSERT_EQ(t.mulLow[a][b & 15] ^ t.mulHigh[a][b >> 4], expected);
+    }
+  }
+}
+
+TEST(Gf256, AlphaPowerWrapsAtFieldOrder) {
+  EXPECT_EQ(orc::gf256::alphaPower(0), 1);
+  EXPECT_EQ(orc::gf256::alphaPower(1), 2);
+  EXPECT_EQ(orc::gf256::alphaPower(8), 0x1D);
+  EXPECT_EQ(orc::gf256::alphaPower(255), 1);
+  EXPECT_EQ(orc::gf256::alphaPower(300), orc::gf256::alphaPower(45));
+}
+
+// The AC-3 RF C1/C2 field.
+TEST(Gf256, OtherFieldTablesMatchReferenceArithmetic) {
+  const uint16_t polynomial = 0x187;
+  const auto& t = orc::gf256::tables(polynomial);
+  EXPECT_EQ(&t, &orc::gf256::tables(polynomial));
+  for (int a = 0; a < 256; ++a) {
+    if (a != 0) {
+      EXPECT_EQ(t.exp[t.log[a]], a);
+      EXPECT_EQ(referenceMultiply(a, t.inverse(a), polynomial), 1);
+    }
+    for (int b = 0; b < 256; ++b) {
+      ASSERT_EQ(t.multiply(a, b), referenceMultiply(a, b, polynomial))
+          << a << " * " << b;
+    }
+  }
+}
+
+TEST(Gf256, RejectsFieldsWhereXIsNotPrimitive) {
+  // x has order 51 modulo the AES polynomial.
+  EXPECT_THROW(orc::gf256::tables(0x11B), std::invalid_argument);
+  EXPECT_THROW(orc::gf256::tables(0x1D), std::invalid_argument);
+}
+
+TEST(Gf256SyndromeKernel, CodewordsHaveZeroSyndromes) {
+  std::mt19937 rng(1);
+  for (size_t roots : {2u, 4u, 8u}) {
+    const SyndromeKernel kernel(32, roots);
+    for (int n = 0; n < 50; ++n) {
+      const auto word = encode(randomBytes(32 - roots, rng), roots);
+      std::vector<uint8_t> syndromes(roots, 0xFF);
+      EXPECT_TRUE(kernel.compute(word.data(), syndromes.data()));
+      EXPECT_EQ(syndromes, std::vector<uint8_t>(roots, 0));
+    }
+  }
+}
+
+TEST(Gf256SyndromeKernel, SingleWordMatchesReference) {
+  std::mt19937 rng(2);
+  for (size_t length : {5u, 16u, 28u, 32u, 255u}) {
+    for (size_t roots : {1u, 2u, 4u}) {
+      const SyndromeKernel kernel(length, roots);
+      for (int n = 0; n < 20; ++n) {
+        auto word = encode(randomBytes(length - roots, rng), roots);
+        word[rng() % length] ^= static_cast<uint8_t>(1 + rng() % 255);
+        std::vector<uint8_t> syndromes(roots);
+        EXPECT_FALSE(kernel.compute(word.data(), syndromes.data()));
+        EXPECT_EQ(syndromes, referenceSyndromes(word.data(), length, roots))
+            << "length " << length << " roots " << roots;
+      }
+    }
+  }
+}
+
+// Every instruction set the CPU supports must agree with the reference, for
+// strides wider than the word and batch sizes that leave a scalar remainder.
+TEST(Gf256SyndromeKernel, BatchMatchesReferenceOnEveryIsa) {
+  std::mt19937 rng(3);
+  for (Isa isa : {Isa::Scalar, Isa::Ssse3, Isa::Avx2}) {
+    for (size_t length : {16u, 28u, 32u, 45u}) {
+      const size_t roots = 4;
+      const SyndromeKernel kernel(length, roots, isa);
+      for (size_t stride : {length, length + 3}) {
+        for (size_t count : {1u, 15u, 16u, 33u, 98u}) {
+          std::vector<uint8_t> words = randomBytes(count * stride, rng);
+          // Leave some words valid so zero and non-zero lanes are mixed.
+          for (size_t k = 0; k < count; k += 3) {
+            const auto codeword =
+                encode(randomBytes(length - roots, rng), roots);
+            std::copy(codeword.begin(), codeword.end(),
+                      words.begin() + k * stride);
+          }
+
+          std::vector<uint8_t> syndromes(count * roots);
+          kernel.computeBatch(words.data(), stride, count, syndromes.data());
+          for (size_t k = 0; k < count; ++k) {
+            const std::vector<uint8_t> actual(
+                syndromes.begin() + k * roots,
+                syndromes.begin() + (k + 1) * roots);
+            ASSERT_EQ(actual,
+                      referenceSyndromes(&words[k * stride], length, roots))
+                << orc::gf256::isaName(kernel.isa()) << " length " << length
+                << " stride " << stride << " word " << k << "/" << count;
+          }
+        }
+      }
+    }
+  }
+}
+
+// S_i = r(alpha^(120 + i)) over GF(2^8) mod 0x187, the AC-3 RF C1 code.
+TEST(Gf256SyndromeKernel, OtherFieldAndFirstRootMatchReference) {
+  const uint16_t polynomial = 0x187;
+  const uint32_t first_root = 120;
+  const auto& t = orc::gf256::tables(polynomial);
+  std::mt19937 rng(4);
+  for (Isa isa : {Isa::Scalar, Isa::Ssse3, Isa::Avx2}) {
+    const size_t length = 37;
+    const size_t roots = 4;
+    const SyndromeKernel kernel(length, roots, polynomial, first_root, isa);
+    const size_t count = 40;
+    const std::vector<uint8_t> words = randomBytes(count * length, rng);
+    std::vector<uint8_t> syndromes(count * roots);
+    kernel.computeBatch(words.data(), length, count, syndromes.data());
+    for (size_t k = 0; k < count; ++k) {
+      for (size_t i = 0; i < roots; ++i) {
+        const uint8_t root = t.exp[first_root + i];
+        uint8_t expected = 0;
+        for (size_t j = 0; j < length; ++j) {
+          expected = referenceMultiply(expected, root, polynomial) ^
+                     words[k * length + j];
+        }
+        ASSERT_EQ(syndromes[k * roots + i], expected)
+            << orc::gf256::isaName(kernel.isa()) << " word " << k
+            << " root " << i;
+      }
+    }
+  }
+}
+
+TEST(Gf256SyndromeKernel, RejectsUnsupportedShapes) {
+  EXPECT_THROW(SyndromeKernel(32, 0), std::invalid_argument);
+  EXPECT_THROW(SyndromeKernel(32, SyndromeKernel::kMaxRoots + 1),
+               std::invalid_argument);
+  EXPECT_THROW(SyndromeKernel(4, 4), std::invalid_argument);
+  EXPECT_THROW(SyndromeKernel(256, 4), std::invalid_argument);
+}
+
+TEST(Gf256SyndromeKernel, UnsupportedIsaFallsBack) {
+  const SyndromeKernel kernel(32, 4, Isa::Avx2);
+  EXPECT_LE(static_cast<int>(kernel.isa()),
+            static_cast<int>(orc::gf256::bestIsa()));
+}
+
+}  // namespace
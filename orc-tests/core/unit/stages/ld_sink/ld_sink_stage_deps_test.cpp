@@ -18,6 +18,7 @@
 #include "tbc_metadata_writer_interface_mock.h"
 
 using testing::_;  // NOLINT(bugprone-reserved-identifier)
+using testing::Field;
 using testing::Ref;
 using testing::Return;
 using testing::StrictMock;
@@ -64,7 +65,9 @@ TEST_F(LDSinkStageDepsTest, WriteTbc_AddsExtensionAndSucceedsWithEmptyRange) {
       .WillOnce(Return(orc::FrameIDRange{1, 0}));
 
   EXPECT_CALL(mockStageServices_,
-              create_buffered_file_writer_uint16(16UL * 1024 * 1024))
+              create_async_file_writer_uint16(
+                  Field(&orc::AsyncFileWriterOptions::buffer_size,
+                        16UL * 1024 * 1024)))
       .Times(1)
       .WillOnce(Return(pMockFileWriterUint16_));
 
@@ -108,9 +111,14 @@ TEST_F(LDSinkStageDepsTest, WriteTbc_ReturnsFalseWhenTbcFileOpenFails) {
   EXPECT_CALL(mockRepresentation_, frame_range())
       .Times(1)
       .WillOnce(Return(orc::FrameIDRange{1, 0}));
+  EXPECT_CALL(mockRepresentation_, get_video_parameters())
+      .Times(1)
+      .WillOnce(Return(std::nullopt));
 
   EXPECT_CALL(mockStageServices_,
-              create_buffered_file_writer_uint16(16UL * 1024 * 1024))
+              create_async_file_writer_uint16(
+                  Field(&orc::AsyncFileWriterOptions::buffer_size,
+                        16UL * 1024 * 1024)))
       .Times(1)
       .WillOnce(Return(pMockFileWriterUint16_));
 
@@ -128,9 +136,14 @@ TEST_F(LDSinkStageDepsTest, WriteTbc_ReturnsFalseWhenMetadataDbOpenFails) {
   EXPECT_CALL(mockRepresentation_, frame_range())
       .Times(1)
       .WillOnce(Return(orc::FrameIDRange{1, 0}));
+  EXPECT_CALL(mockRepresentation_, get_video_parameters())
+      .Times(1)
+      .WillOnce(Return(std::nullopt));
 
   EXPECT_CALL(mockStageServices_,
-              create_buffered_file_writer_uint16(16UL * 1024 * 1024))
+              create_async_file_writer_uint16(
+                  Field(&orc::AsyncFileWriterOptions::buffer_size,
+                        16UL * 1024 * 1024)))
       .Times(1)
       .WillOnce(Return(pMockFileWriterUint16_));
 
@@ -157,7 +170,9 @@ TEST_F(LDSinkStageDepsTest,
       .WillOnce(Return(orc::FrameIDRange{1, 0}));
 
   EXPECT_CALL(mockStageServices_,
-              create_buffered_file_writer_uint16(16UL * 1024 * 1024))
+              create_async_file_writer_uint16(
+                  Field(&orc::AsyncFileWriterOptions::buffer_size,
+                        16UL * 1024 * 1024)))
       .Times(1)
       .WillOnce(Return(pMockFileWriterUint16_));
 
@@ -189,7 +204,9 @@ TEST_F(LDSinkStageDepsTest,
       .WillOnce(Return(orc::FrameIDRange{1, 0}));
 
   EXPECT_CALL(mockStageServices_,
-              create_buffered_file_writer_uint16(16UL * 1024 * 1024))
+              create_async_file_writer_uint16(
+                  Field(&orc::AsyncFileWriterOptions::buffer_size,
+                        16UL * 1024 * 1024)))
       .Times(1)
       .WillOnce(Return(pMockFileWriterUint16_));
 
@@ -230,7 +247,9 @@ TEST_F(LDSinkStageDepsTest,
       .WillOnce(Return(orc::FrameIDRange{0, 1}));
 
   EXPECT_CALL(mockStageServices_,
-              create_buffered_file_writer_uint16(16UL * 1024 * 1024))
+              create_async_file_writer_uint16(
+                  Field(&orc::AsyncFileWriterOptions::buffer_size,
+                        16UL * 1024 * 1024)))
       .Times(1)
       .WillOnce(Return(pMockFileWriterUint16_));
 
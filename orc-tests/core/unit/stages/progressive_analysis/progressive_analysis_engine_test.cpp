@@ -0,0 +1,243 @@
+/*
+ * File:        progressive_analysis_engine_test.cpp
+ * Module:      orc-tests/core/unit/stages/progressive_analysis
+ * Purpose:     Unit tests for the shared progressive (coarse-then-refined)
+ *              analysis engine and its bucket layouts
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "progressive-analysis/progressive_analysis.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "progressive-analysis/local_observation_context.h"
+
+namespace orc {
+namespace tests {
+
+namespace {
+
+// Sum and count of the frame IDs visited, so coverage is checkable exactly.
+struct SumAccumulator {
+  uint64_t sum = 0;
+  uint64_t frames = 0;
+
+  void merge(const SumAccumulator& other) {
+    sum += other.sum;
+    frames += other.frames;
+  }
+};
+
+ProgressiveAnalysisEngine<SumAccumulator>::VisitorFactory sum_visitor() {
+  return [] {
+    return [](FrameID fid, SumAccumulator& accum) {
+      accum.sum += fid;
+      ++accum.frames;
+    };
+  };
+}
+
+}  // namespace
+
+// ===========================================================================
+// Bucket layouts
+// ===========================================================================
+
+TEST(ProgressiveAnalysisTest, EvenBuckets_CoverRangeWithoutGapsOrOverlap) {
+  const auto buckets =
+      make_even_analysis_buckets(FrameIDRange{10, 2509}, 1000);
+
+  ASSERT_EQ(buckets.size(), 1000u);
+  EXPECT_EQ(buckets.front().first, 10u);
+  EXPECT_EQ(buckets.back().last, 2509u);
+  for (size_t b = 1; b < buckets.size(); ++b) {
+    EXPECT_EQ(buckets[b].first, buckets[b - 1].last + 1);
+  }
+}
+
+TEST(ProgressiveAnalysisTest, EvenBuckets_OnePerFrameForShortSources) {
+  const auto buckets = make_even_analysis_buckets(FrameIDRange{0, 9}, 1000);
+
+  ASSERT_EQ(buckets.size(), 10u);
+  for (size_t b = 0; b < buckets.size(); ++b) {
+    EXPECT_EQ(buckets[b].first, b);
+    EXPECT_EQ(buckets[b].size(), 1u);
+  }
+}
+
+TEST(ProgressiveAnalysisTest, FixedWidthBuckets_LastBucketHoldsRemainder) {
+  const auto buckets =
+      make_fixed_width_analysis_buckets(FrameIDRange{0, 2500}, 1000);
+
+  // ceil(2501 / 1000) = 3 frames per bucket.
+  ASSERT_EQ(buckets.size(), 834u);
+  EXPECT_EQ(buckets.front().size(), 3u);
+  EXPECT_EQ(buckets.back().first, 2499u);
+  EXPECT_EQ(buckets.back().last, 2500u);
+}
+
+TEST(ProgressiveAnalysisTest, BucketOrder_IsCoarseToFinePermutation) {
+  const auto order = progressive_bucket_order(10);
+
+  ASSERT_EQ(order.size(), 10u);
+  EXPECT_EQ(std::set<size_t>(order.begin(), order.end()).size(), 10u);
+  EXPECT_EQ(order[0], 0u);
+  EXPECT_EQ(order[1], 8u);
+  EXPECT_EQ(order[2], 4u);
+}
+
+// ===========================================================================
+// Engine
+// ===========================================================================
+
+TEST(ProgressiveAnalysisTest, Run_RefinedResultCoversEveryFrameOnce) {
+  ProgressiveAnalysisConfig config;
+  config.worker_count = 4;
+  ProgressiveAnalysisEngine<SumAccumulator> engine(
+      make_even_analysis_buckets(FrameIDRange{0, 4999}, 100), config);
+
+  const auto status = engine.run(sum_visitor(), {}, {}, nullptr);
+
+  ASSERT_EQ(status, ProgressiveAnalysisStatus::Complete);
+  const auto& buckets = engine.buckets();
+  const auto& accums = engine.accumulators();
+  for (size_t b = 0; b < buckets.size(); ++b) {
+    uint64_t expected = 0;
+    for (FrameID f = buckets[b].first; f <= buckets[b].last; ++f) {
+      expected += f;
+    }
+    EXPECT_EQ(accums[b].frames, buckets[b].size());
+    EXPECT_EQ(accums[b].sum, expected);
+  }
+}
+
+TEST(ProgressiveAnalysisTest, Run_CoarseOnlyVisitsFirstFrameOfEachBucket) {
+  ProgressiveAnalysisConfig config;
+  config.refine = false;
+  ProgressiveAnalysisEngine<SumAccumulator> engine(
+      make_even_analysis_buckets(FrameIDRange{0, 999}, 10), config);
+
+  ASSERT_EQ(engine.run(sum_visitor(), {}, {}, nullptr),
+            ProgressiveAnalysisStatus::Complete);
+  for (size_t b = 0; b < engine.buckets().size(); ++b) {
+    EXPECT_EQ(engine.accumulators()[b].frames, 1u);
+    EXPECT_EQ(engine.accumulators()[b].sum, engine.buckets()[b].first);
+  }
+}
+
+TEST(ProgressiveAnalysisTest, Run_PublishesCoarseBeforeComplete) {
+  ProgressiveAnalysisConfig config;
+  config.worker_count = 2;
+  ProgressiveAnalysisEngine<SumAccumulator> engine(
+      make_even_analysis_buckets(FrameIDRange{0, 1999}, 20), config);
+
+  std::vector<ProgressivePass> passes;
+  std::vector<uint64_t> coarse_frames;
+  const auto publish = [&](const std::vector<SumAccumulator>& accums,
+                           ProgressivePass pass) {
+    passes.push_back(pass);
+    if (pass == ProgressivePass::Coarse) {
+      for (const auto& a : accums) coarse_frames.push_back(a.frames);
+    }
+  };
+
+  // Slow the refinement down so the coarse snapshot is observed on its own.
+  const auto visitor = [] {
+    return [](FrameID fid, SumAccumulator& accum) {
+      if (fid % 100 != 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+      }
+      accum.sum += fid;
+      ++accum.frames;
+    };
+  };
+
+  ASSERT_EQ(engine.run(visitor, publish, {}, nullptr),
+            ProgressiveAnalysisStatus::Complete);
+  ASSERT_GE(passes.size(), 2u);
+  EXPECT_EQ(passes.front(), ProgressivePass::Coarse);
+  EXPECT_EQ(passes.back(), ProgressivePass::Complete);
+  ASSERT_EQ(coarse_frames.size(), 20u);
+  for (uint64_t frames : coarse_frames) EXPECT_GE(frames, 1u);
+}
+
+TEST(ProgressiveAnalysisTest, Run_CancelStopsWorkersAndReportsCancelled) {
+  ProgressiveAnalysisConfig config;
+  config.worker_count = 2;
+  ProgressiveAnalysisEngine<SumAccumulator> engine(
+      make_even_analysis_buckets(FrameIDRange{0, 99999}, 10), config);
+
+  std::atomic<bool> cancel{false};
+  const auto visitor = [&cancel] {
+    return [&cancel](FrameID fid, SumAccumulator& accum) {
+      if (fid > 5000) cancel.store(true);
+      accum.sum += fid;
+      ++accum.frames;
+    };
+  };
+
+  EXPECT_EQ(engine.run(visitor, {}, {}, &cancel),
+            ProgressiveAnalysisStatus::Cancelled);
+}
+
+TEST(ProgressiveAnalysisTest, Run_RethrowsVisitorException) {
+  ProgressiveAnalysisEngine<SumAccumulator> engine(
+      make_even_analysis_buckets(FrameIDRange{0, 99}, 10),
+      ProgressiveAnalysisConfig{});
+
+  const auto visitor = [] {
+    return [](FrameID fid, SumAccumulator&) {
+      if (fid == 42) throw std::runtime_error("observer failed");
+    };
+  };
+
+  EXPECT_THROW(engine.run(visitor, {}, {}, nullptr), std::runtime_error);
+}
+
+TEST(ProgressiveAnalysisTest, Run_VisitorFactoryCalledOncePerWorker) {
+  ProgressiveAnalysisConfig config;
+  config.worker_count = 3;
+  ProgressiveAnalysisEngine<SumAccumulator> engine(
+      make_even_analysis_buckets(FrameIDRange{0, 299}, 30), config);
+
+  std::atomic<int> factory_calls{0};
+  const auto factory = [&factory_calls] {
+    factory_calls.fetch_add(1);
+    return [](FrameID, SumAccumulator& accum) { ++accum.frames; };
+  };
+
+  ASSERT_EQ(engine.run(factory, {}, {}, nullptr),
+            ProgressiveAnalysisStatus::Complete);
+  EXPECT_EQ(factory_calls.load(), 3);
+}
+
+// ===========================================================================
+// LocalObservationContext
+// ===========================================================================
+
+TEST(ProgressiveAnalysisTest, LocalObservationContext_StoresAndClears) {
+  LocalObservationContext context;
+  context.set(FieldID(4), "burst_level", "median_burst_10bit", 123.5);
+
+  const auto value =
+      context.get(FieldID(4), "burst_level", "median_burst_10bit");
+  ASSERT_TRUE(value.has_value());
+  EXPECT_DOUBLE_EQ(std::get<double>(*value), 123.5);
+  EXPECT_FALSE(context.has(FieldID(5), "burst_level", "median_burst_10bit"));
+
+  context.clear();
+  EXPECT_FALSE(context.has(FieldID(4), "burst_level", "median_burst_10bit"));
+}
+
+}  // namespace tests
+}  // namespace orc
@@ -13,6 +13,8 @@
 #include "../../stage_services_mock.h"
 #include "efm_sink_stage_deps.h"
 
+using testing::AllOf;
+using testing::Field;
 using testing::Return;
 using testing::StrictMock;
 
@@ -50,8 +52,11 @@ TEST_F(RawEFMSinkStageDeps,
       .Times(1)
       .WillOnce(Return(std::vector<uint8_t>{3, 7, 11}));
 
-  EXPECT_CALL(mockStageServices_,
-              create_buffered_file_writer_uint8(4UL * 1024 * 1024))
+  EXPECT_CALL(
+      mockStageServices_,
+      create_async_file_writer_uint8(AllOf(
+          Field(&orc::AsyncFileWriterOptions::buffer_size, 4UL * 1024 * 1024),
+          Field(&orc::AsyncFileWriterOptions::expected_size, 3U))))
       .Times(1)
       .WillOnce(Return(pMockFileWriterUint8_));
   EXPECT_CALL(*pMockFileWriterUint8_, open("out_path.efm"))
@@ -95,8 +100,11 @@ TEST_F(RawEFMSinkStageDeps, WriteRawEfm_Fails_WhenWriterCannotOpenFile) {
       .Times(1)
       .WillOnce(Return(3));
 
-  EXPECT_CALL(mockStageServices_,
-              create_buffered_file_writer_uint8(4UL * 1024 * 1024))
+  EXPECT_CALL(
+      mockStageServices_,
+      create_async_file_writer_uint8(AllOf(
+          Field(&orc::AsyncFileWriterOptions::buffer_size, 4UL * 1024 * 1024),
+          Field(&orc::AsyncFileWriterOptions::expected_size, 3U))))
       .Times(1)
       .WillOnce(Return(pMockFileWriterUint8_));
   EXPECT_CALL(*pMockFileWriterUint8_, open("out_path.efm"))
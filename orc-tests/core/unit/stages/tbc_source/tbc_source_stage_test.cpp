@@ -454,6 +454,77 @@ TEST(TBCSourceStageTest, OutputVFR_GetFrameLazilyAssemblesFromMockedDeps) {
   EXPECT_EQ(frame_ptr[0], static_cast<int16_t>(orc::kPalBlanking));
 }
 
+TEST(TBCSourceStageTest, OutputVFR_ReadLinesMatchesPerLineReads) {
+  // read_lines() fetches only the requested lines through read_field_runs();
+  // the default deps implementation routes each run to read_field_samples_at.
+  auto deps = std::make_shared<NiceMock<MockTBCSourceStageDeps>>();
+  orc::TBCSourceStage stage(deps);
+  orc::ObservationContext ctx;
+
+  // Raw sample value encodes the field and the position within it.
+  const auto raw_sample = [](int32_t field, int32_t pos) {
+    return static_cast<uint16_t>(16384 + field * 2000 + pos % 1000);
+  };
+
+  ON_CALL(*deps, validate_input_file(_, _)).WillByDefault(Return(true));
+  ON_CALL(*deps, load_video_params(_, _))
+      .WillByDefault([](const std::string&, std::string&) {
+        return std::optional<orc::TBCVideoParams>{make_pal_video_params(4)};
+      });
+  ON_CALL(*deps, load_all_field_meta(_, _))
+      .WillByDefault([](const std::string&, std::string&) {
+        return make_pal_field_meta(4);
+      });
+  ON_CALL(*deps, read_field_samples(_, _, _, _, _))
+      .WillByDefault([raw_sample](const std::string&, int32_t field, int32_t,
+                                  int32_t count, std::string&) {
+        std::vector<uint16_t> samples(static_cast<size_t>(count));
+        for (int32_t i = 0; i < count; ++i) {
+          samples[static_cast<size_t>(i)] = raw_sample(field, i);
+        }
+        return samples;
+      });
+  EXPECT_CALL(*deps, read_field_samples_at(_, _, _, _, _, _))
+      .Times(4)
+      .WillRepeatedly([raw_sample](const std::string&, int32_t field, int32_t,
+                                   int32_t offset, int32_t count,
+                                   std::string&) {
+        std::vector<uint16_t> samples(static_cast<size_t>(count));
+        for (int32_t i = 0; i < count; ++i) {
+          samples[static_cast<size_t>(i)] = raw_sample(field, offset + i);
+        }
+        return samples;
+      });
+
+  const auto outputs =
+      stage.execute({}, {{"input_path", std::string("/tmp/test.tbc")}}, ctx);
+  ASSERT_EQ(outputs.size(), 1u);
+  auto* vfr =
+      dynamic_cast<orc::VideoFrameRepresentation*>(outputs.front().get());
+  ASSERT_NE(vfr, nullptr);
+
+  // One line from each field of both frames.
+  const std::vector<size_t> lines = {16, orc::kPalField1Lines + 16};
+  std::vector<orc::VideoFrameRepresentation::sample_type> batch;
+  ASSERT_TRUE(
+      vfr->read_lines({orc::FrameID{0}, orc::FrameID{1}}, lines, batch));
+  const size_t width = orc::kPalSamplesPerLineNominal;
+  ASSERT_EQ(batch.size(), 2 * lines.size() * width);
+
+  size_t row = 0;
+  for (orc::FrameID id = 0; id <= 1; ++id) {
+    for (const size_t line : lines) {
+      const auto expected = vfr->get_line_samples(id, line);
+      ASSERT_EQ(expected.size(), width);
+      EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                             batch.begin() +
+                                 static_cast<std::ptrdiff_t>(row * width)))
+          << "frame " << id << " line " << line;
+      ++row;
+    }
+  }
+}
+
 // ===========================================================================
 // set_parameters status feedback tests
 // ===========================================================================
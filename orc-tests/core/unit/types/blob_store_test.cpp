@@ -0,0 +1,218 @@
+/*
+ * File:        blob_store_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Unit tests for CoreBlobStore, ParsedParamCache and the ABI 16
+ *              plugin::get_blob_store() accessor
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include <gtest/gtest.h>
+#include <orc/abi/orc_plugin_services.h>
+#include <orc/stage/blob_store.h>
+#include <orc/support/parsed_param_cache.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "core_blob_store.h"
+
+namespace orc_unit_test {
+
+namespace {
+
+using orc::CoreBlobStore;
+using orc::OrcPluginServices;
+using orc::ParameterValue;
+using orc::ParsedParamCache;
+
+class CoreBlobStoreTest : public ::testing::Test {
+ protected:
+  void SetUp() override { std::filesystem::create_directories(dir_); }
+  void TearDown() override { std::filesystem::remove_all(dir_); }
+
+  void write_file(const std::filesystem::path& path, const std::string& text) {
+    std::ofstream out(path, std::ios::binary);
+    out << text;
+  }
+
+  const std::filesystem::path dir_ =
+      std::filesystem::temp_directory_path() / "orc_blob_store_test";
+};
+
+}  // namespace
+
+TEST_F(CoreBlobStoreTest, Put_ReturnsContentAddressedReference) {
+  CoreBlobStore store;
+  const std::string ref = store.put("[{frame:1}]");
+  EXPECT_TRUE(orc::is_blob_ref(ref));
+  EXPECT_EQ(ref, store.put("[{frame:1}]"));
+  EXPECT_NE(ref, store.put("[{frame:2}]"));
+  ASSERT_NE(store.get(ref), nullptr);
+  EXPECT_EQ(*store.get(ref), "[{frame:1}]");
+  // The same text shares one copy.
+  EXPECT_EQ(store.get(ref), store.get(store.put("[{frame:1}]")));
+}
+
+TEST_F(CoreBlobStoreTest, IsBlobRef_RejectsInlineText) {
+  EXPECT_FALSE(orc::is_blob_ref(""));
+  EXPECT_FALSE(orc::is_blob_ref("0-10,20-30"));
+  EXPECT_FALSE(orc::is_blob_ref("blob:sha256:abc"));
+}
+
+TEST_F(CoreBlobStoreTest, IsBlobRef_RequiresLowercaseHexDigest) {
+  EXPECT_TRUE(orc::is_blob_ref("blob:sha256:" + std::string(64, 'f')));
+  EXPECT_FALSE(orc::is_blob_ref("blob:sha256:" + std::string(64, 'F')));
+  EXPECT_FALSE(orc::is_blob_ref("blob:sha256:" + std::string(64, 'g')));
+  EXPECT_FALSE(orc::is_blob_ref("blob:sha256:../../" + std::string(58, '0')));
+}
+
+TEST_F(CoreBlobStoreTest, InvalidReference_NeverReachesTheFilesystem) {
+  const std::string ref = "blob:sha256:../" + std::string(61, 'a');
+  CoreBlobStore store;
+  store.add_sidecar(ref, (dir_ / "x.blob").string());
+  EXPECT_EQ(store.get(ref), nullptr);
+  std::string error;
+  EXPECT_FALSE(store.write_sidecar(ref, dir_.string(), error));
+  EXPECT_FALSE(error.empty());
+}
+
+TEST_F(CoreBlobStoreTest, Get_UnknownReferenceIsNull) {
+  CoreBlobStore store;
+  EXPECT_EQ(store.get("blob:sha256:" + std::string(64, '0')), nullptr);
+}
+
+TEST_F(CoreBlobStoreTest, WriteSidecar_RoundTripsThroughLazyLoad) {
+  CoreBlobStore writer;
+  const std::string ref = writer.put("0-10,20-30");
+  std::string error;
+  ASSERT_TRUE(writer.write_sidecar(ref, dir_.string(), error)) << error;
+  const auto path = dir_ / CoreBlobStore::sidecar_file_name(ref);
+  ASSERT_TRUE(std::filesystem::exists(path));
+
+  CoreBlobStore reader;
+  reader.add_sidecar(ref, path.string());
+  ASSERT_NE(reader.get(ref), nullptr);
+  EXPECT_EQ(*reader.get(ref), "0-10,20-30");
+}
+
+TEST_F(CoreBlobStoreTest, Get_RejectsSidecarWithWrongContents) {
+  CoreBlobStore writer;
+  const std::string ref = writer.put("0-10");
+  const auto path = dir_ / CoreBlobStore::sidecar_file_name(ref);
+  write_file(path, "0-11");
+
+  CoreBlobStore reader;
+  reader.add_sidecar(ref, path.string());
+  EXPECT_EQ(reader.get(ref), nullptr);
+}
+
+TEST_F(CoreBlobStoreTest, WriteSidecar_FailsForUnknownBlob) {
+  CoreBlobStore store;
+  std::string error;
+  EXPECT_FALSE(store.write_sidecar("blob:sha256:" + std::string(64, 'a'),
+                                   dir_.string(), error));
+  EXPECT_FALSE(error.empty());
+}
+
+TEST_F(CoreBlobStoreTest, ResidentLimit_EvictsLeastRecentlyUsed) {
+  CoreBlobStore store(10);
+  const std::string first = store.put("0123456789");
+  const std::string second = store.put("abcdefghij");
+  // Only one 10-byte blob fits; the older, unsaved one was spilled.
+  EXPECT_EQ(store.resident_bytes(), 10u);
+
+  // Both stay resolvable, and a blob a caller holds is never dropped.
+  auto held = store.get(first);
+  ASSERT_NE(held, nullptr);
+  EXPECT_EQ(*held, "0123456789");
+  ASSERT_NE(store.get(second), nullptr);
+  EXPECT_EQ(*store.get(second), "abcdefghij");
+  EXPECT_EQ(store.get(first), held);
+
+  // Once released, older blobs make room for a new one again.
+  held.reset();
+  store.put("klmnopqrst");
+  EXPECT_EQ(store.resident_bytes(), 10u);
+  EXPECT_EQ(*store.get(first), "0123456789");
+}
+
+TEST_F(CoreBlobStoreTest, ResidentLimit_SavedBlobReloadsFromItsSidecar) {
+  CoreBlobStore store(4);
+  const std::string ref = store.put("0-10,20-30");
+  std::string error;
+  ASSERT_TRUE(store.write_sidecar(ref, dir_.string(), error)) << error;
+  store.put("abcdefgh");
+  EXPECT_LE(store.resident_bytes(), 8u);
+
+  const auto path = dir_ / CoreBlobStore::sidecar_file_name(ref);
+  std::filesystem::remove(path);
+  // Evicted and its project sidecar is gone: the reload fails honestly.
+  EXPECT_EQ(store.get(ref), nullptr);
+}
+
+TEST_F(CoreBlobStoreTest, ResolveParameters_ReplacesReferencesOnly) {
+  const std::string ref = orc::host_blob_store().put("[{frame:3}]");
+  const std::map<std::string, ParameterValue> params = {
+      {"dropout_map", ref}, {"label", std::string("x")}, {"count", 4}};
+  const auto resolved = orc::resolve_blob_parameters(params);
+  EXPECT_EQ(std::get<std::string>(resolved.at("dropout_map")), "[{frame:3}]");
+  EXPECT_EQ(std::get<std::string>(resolved.at("label")), "x");
+  EXPECT_EQ(std::get<int32_t>(resolved.at("count")), 4);
+}
+
+TEST_F(CoreBlobStoreTest, ParsedParamCache_ParsesEachValueOnce) {
+  CoreBlobStore store;
+  const std::string ref = store.put("abc");
+  ParsedParamCache<size_t> cache;
+  int parses = 0;
+  auto parse = [&parses](const std::string& text) {
+    ++parses;
+    return text.size();
+  };
+
+  const auto first = cache.get(ref, &store, parse);
+  const auto again = cache.get(ref, &store, parse);
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(*first, 3u);
+  EXPECT_EQ(first, again);
+  EXPECT_EQ(parses, 1);
+
+  const auto inline_value = cache.get("abcd", &store, parse);
+  ASSERT_NE(inline_value, nullptr);
+  EXPECT_EQ(*inline_value, 4u);
+  EXPECT_EQ(parses, 2);
+}
+
+TEST_F(CoreBlobStoreTest, ParsedParamCache_UnresolvedReferenceIsNull) {
+  ParsedParamCache<size_t> cache;
+  const auto parse = [](const std::string& text) { return text.size(); };
+  const std::string ref = "blob:sha256:" + std::string(64, 'b');
+  EXPECT_EQ(cache.get(ref, nullptr, parse), nullptr);
+  CoreBlobStore empty;
+  EXPECT_EQ(cache.get(ref, &empty, parse), nullptr);
+}
+
+TEST_F(CoreBlobStoreTest, Accessor_GuardsOlderHostServicesSize) {
+  CoreBlobStore store;
+  OrcPluginServices services{};
+  services.blob_store = &store;
+  // Simulate an ABI 15 host: services_size stops short of the appended field.
+  services.services_size =
+      static_cast<uint32_t>(offsetof(OrcPluginServices, blob_store));
+  orc::plugin::set_services(&services);
+  EXPECT_EQ(orc::plugin::get_blob_store(), nullptr);
+
+  services.services_size = static_cast<uint32_t>(sizeof(OrcPluginServices));
+  EXPECT_EQ(orc::plugin::get_blob_store(), &store);
+
+  orc::plugin::set_services(nullptr);
+  EXPECT_EQ(orc::plugin::get_blob_store(), nullptr);
+}
+
+}  // namespace orc_unit_test
@@ -0,0 +1,159 @@
+/*
+ * File:        frame_buffer_pool_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Unit tests for CoreFrameBufferPool and the ABI 12
+ *              plugin::get_frame_buffer_pool() accessor
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include <gtest/gtest.h>
+#include <orc/abi/orc_plugin_services.h>
+#include <orc/stage/frame_buffer_pool.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "core_frame_buffer_pool.h"
+
+namespace orc_unit_test {
+
+namespace {
+
+using orc::CoreFrameBufferPool;
+using orc::FrameBufferPoolStats;
+using orc::OrcPluginServices;
+
+// PAL composite frame (kPalFrameSamples).
+constexpr size_t kPalSamples = 709379;
+constexpr size_t kPalBytes =
+    ((kPalSamples + CoreFrameBufferPool::kSizeClassSamples - 1) /
+     CoreFrameBufferPool::kSizeClassSamples) *
+    CoreFrameBufferPool::kSizeClassSamples * sizeof(int16_t);
+
+}  // namespace
+
+TEST(CoreFrameBufferPool, Acquire_ReturnsExclusiveBufferOfRequestedSize) {
+  CoreFrameBufferPool pool;
+  auto buffer = pool.acquire(kPalSamples);
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_EQ(buffer->size(), kPalSamples);
+  EXPECT_GE(buffer->capacity(), kPalSamples);
+  EXPECT_EQ(buffer.use_count(), 1);
+  EXPECT_EQ(pool.acquire(0), nullptr);
+
+  const FrameBufferPoolStats stats = pool.stats();
+  EXPECT_EQ(stats.allocations, 1u);
+  EXPECT_EQ(stats.reuses, 0u);
+}
+
+TEST(CoreFrameBufferPool, ReleasedBuffer_IsRecycledOnSameThread) {
+  CoreFrameBufferPool pool;
+  const int16_t* storage = nullptr;
+  {
+    auto buffer = pool.acquire(kPalSamples);
+    storage = buffer->data();
+  }
+  EXPECT_EQ(pool.stats().recycles, 1u);
+  EXPECT_EQ(pool.stats().pooled_buffers, 1u);
+  EXPECT_EQ(pool.stats().pooled_bytes, kPalBytes);
+
+  auto again = pool.acquire(kPalSamples);
+  EXPECT_EQ(again->data(), storage);
+  EXPECT_EQ(again->size(), kPalSamples);
+
+  const FrameBufferPoolStats stats = pool.stats();
+  EXPECT_EQ(stats.allocations, 1u);
+  EXPECT_EQ(stats.reuses, 1u);
+  EXPECT_EQ(stats.magazine_hits, 1u);
+  EXPECT_EQ(stats.pooled_buffers, 0u);
+}
+
+TEST(CoreFrameBufferPool, SizeClass_ServesNearbySizes) {
+  CoreFrameBufferPool pool;
+  pool.acquire(kPalSamples).reset();
+
+  // Same 32 KiB class: reused and resized.
+  auto nearby = pool.acquire(kPalSamples - 100);
+  EXPECT_EQ(nearby->size(), kPalSamples - 100);
+  EXPECT_EQ(pool.stats().reuses, 1u);
+
+  // A different class never reuses it.
+  auto small = pool.acquire(1000);
+  EXPECT_EQ(small->size(), 1000u);
+  EXPECT_EQ(pool.stats().allocations, 2u);
+}
+
+TEST(CoreFrameBufferPool, BuffersReleasedOnOtherThread_ReachTheDepot) {
+  CoreFrameBufferPool pool;
+  std::vector<std::shared_ptr<std::vector<int16_t>>> buffers;
+  for (int i = 0; i < 3; ++i) buffers.push_back(pool.acquire(kPalSamples));
+
+  // The worker's magazine is flushed to the shared depot when it exits.
+  std::thread worker([&buffers] { buffers.clear(); });
+  worker.join();
+  EXPECT_EQ(pool.stats().recycles, 3u);
+  EXPECT_EQ(pool.stats().pooled_buffers, 3u);
+
+  for (int i = 0; i < 3; ++i) buffers.push_back(pool.acquire(kPalSamples));
+  const FrameBufferPoolStats stats = pool.stats();
+  EXPECT_EQ(stats.allocations, 3u);
+  EXPECT_EQ(stats.reuses, 3u);
+  EXPECT_EQ(stats.magazine_hits, 0u);
+}
+
+TEST(CoreFrameBufferPool, FullPool_DiscardsReleasedBuffers) {
+  // No magazine; the depot holds exactly one frame.
+  CoreFrameBufferPool pool(kPalBytes, /*magazine_slots=*/0);
+  auto a = pool.acquire(kPalSamples);
+  auto b = pool.acquire(kPalSamples);
+  a.reset();
+  b.reset();
+
+  const FrameBufferPoolStats stats = pool.stats();
+  EXPECT_EQ(stats.recycles, 1u);
+  EXPECT_EQ(stats.discards, 1u);
+  EXPECT_EQ(stats.pooled_bytes, kPalBytes);
+
+  pool.trim();
+  EXPECT_EQ(pool.stats().pooled_buffers, 0u);
+  EXPECT_EQ(pool.stats().pooled_bytes, 0u);
+}
+
+TEST(CoreFrameBufferPool, Buffer_OutlivesPool) {
+  auto pool = std::make_unique<CoreFrameBufferPool>();
+  auto buffer = pool->acquire(1024);
+  (*buffer)[1023] = 7;
+  pool.reset();
+  EXPECT_EQ((*buffer)[1023], 7);
+  buffer.reset();  // freed, not recycled
+}
+
+TEST(CoreFrameBufferPool, AcquireSampleBuffer_FallsBackWithoutPool) {
+  auto buffer = orc::acquire_sample_buffer(nullptr, 16);
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_EQ(*buffer, std::vector<int16_t>(16, 0));
+}
+
+TEST(CoreFrameBufferPool, Accessor_GuardsOlderHostServicesSize) {
+  CoreFrameBufferPool pool;
+  OrcPluginServices services{};
+  services.frame_buffer_pool = &pool;
+  // Simulate an ABI 11 host: services_size stops short of the appended field.
+  services.services_size =
+      static_cast<uint32_t>(offsetof(OrcPluginServices, frame_buffer_pool));
+  orc::plugin::set_services(&services);
+  EXPECT_EQ(orc::plugin::get_frame_buffer_pool(), nullptr);
+
+  services.services_size = static_cast<uint32_t>(sizeof(OrcPluginServices));
+  EXPECT_EQ(orc::plugin::get_frame_buffer_pool(), &pool);
+
+  orc::plugin::set_services(nullptr);
+  EXPECT_EQ(orc::plugin::get_frame_buffer_pool(), nullptr);
+}
+
+}  // namespace orc_unit_test
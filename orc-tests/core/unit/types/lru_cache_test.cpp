@@ -111,3 +111,20 @@ TEST(LRUCache, PutIfAbsentEvictsAtCapacity) {
   EXPECT_TRUE(cache.contains(3));
   EXPECT_EQ(cache.size(), 2u);
 }
+
+TEST(LRUCache, EraseIfRemovesMatchingKeysOnly) {
+  LRUCache<int, int> cache(4);
+  cache.put(1, 100);
+  cache.put(2, 200);
+  cache.put(3, 300);
+  EXPECT_EQ(cache.erase_if([](int key) { return key % 2 == 1; }), 2u);
+  EXPECT_FALSE(cache.contains(1));
+  EXPECT_TRUE(cache.contains(2));
+  EXPECT_FALSE(cache.contains(3));
+  EXPECT_EQ(cache.size(), 1u);
+  // Freed slots are reusable without evicting the survivor.
+  cache.put(4, 400);
+  cache.put(5, 500);
+  cache.put(6, 600);
+  EXPECT_TRUE(cache.contains(2));
+}
@@ -0,0 +1,290 @@
+/*
+ * File:        metrics_registry_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Unit tests for CoreMetricsRegistry, LRUCache metrics binding
+ *              and the ABI 14 plugin::get_metrics() accessor
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include <gtest/gtest.h>
+#include <orc/abi/orc_plugin_services.h>
+#include <orc/stage/metrics.h>
+#include <orc/support/lru_cache.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core_frame_buffer_pool.h"
+#include "core_metrics.h"
+
+namespace orc_unit_test {
+
+namespace {
+
+using orc::CoreMetricsRegistry;
+using orc::LRUCache;
+using orc::MetricKind;
+using orc::MetricSample;
+using orc::OrcPluginServices;
+
+std::string read_file(const std::filesystem::path& path) {
+  std::ifstream in(path);
+  std::ostringstream text;
+  text << in.rdbuf();
+  return text.str();
+}
+
+const MetricSample* find_sample(const std::vector<MetricSample>& samples,
+                                const std::string& name,
+                                const std::string& labels) {
+  for (const auto& sample : samples) {
+    if (sample.name == name && sample.labels == labels) return &sample;
+  }
+  return nullptr;
+}
+
+class CoreMetricsRegistryTest : public ::testing::Test {
+ protected:
+  void TearDown() override { std::filesystem::remove(path_); }
+
+  const std::filesystem::path path_ =
+      std::filesystem::temp_directory_path() / "orc_metrics_test.prom";
+};
+
+}  // namespace
+
+TEST_F(CoreMetricsRegistryTest, Lookup_ReturnsSameInstrumentPerSeries) {
+  CoreMetricsRegistry registry;
+  auto* a = registry.counter("orc_test_total", "Test", "stage=a");
+  auto* again = registry.counter("orc_test_total", "Test", "stage=a");
+  auto* b = registry.counter("orc_test_total", "Test", "stage=b");
+  ASSERT_NE(a, nullptr);
+  EXPECT_EQ(a, again);
+  EXPECT_NE(a, b);
+}
+
+TEST_F(CoreMetricsRegistryTest, Lookup_RejectsKindConflict) {
+  CoreMetricsRegistry registry;
+  ASSERT_NE(registry.counter("orc_test_total", "Test", ""), nullptr);
+  EXPECT_EQ(registry.gauge("orc_test_total", "Test", ""), nullptr);
+  EXPECT_EQ(registry.histogram("orc_test_total", "Test", "stage=a"), nullptr);
+}
+
+TEST_F(CoreMetricsRegistryTest, Snapshot_ReportsValues) {
+  CoreMetricsRegistry registry;
+  registry.counter("orc_frames_total", "Frames", "sink=a")->add(3);
+  auto* gauge = registry.gauge("orc_queue_depth", "Queue", "");
+  gauge->set(5.0);
+  gauge->add(-2.0);
+  auto* histogram = registry.histogram("orc_latency_seconds", "Latency", "");
+  histogram->observe(0.002);
+  histogram->observe(0.2);
+
+  const auto samples = registry.snapshot();
+  const auto* counter = find_sample(samples, "orc_frames_total", "sink=a");
+  ASSERT_NE(counter, nullptr);
+  EXPECT_EQ(counter->kind, MetricKind::Counter);
+  EXPECT_DOUBLE_EQ(counter->value, 3.0);
+
+  const auto* depth = find_sample(samples, "orc_queue_depth", "");
+  ASSERT_NE(depth, nullptr);
+  EXPECT_DOUBLE_EQ(depth->value, 3.0);
+
+  const auto* latency = find_sample(samples, "orc_latency_seconds", "");
+  ASSERT_NE(latency, nullptr);
+  EXPECT_EQ(latency->count, 2u);
+  EXPECT_NEAR(latency->value, 0.202, 1e-9);
+  // Buckets are cumulative.
+  for (const auto& [bound, count] : latency->buckets) {
+    const uint64_t expected = bound < 0.002 ? 0 : bound < 0.2 ? 1 : 2;
+    EXPECT_EQ(count, expected) << "le=" << bound;
+  }
+}
+
+TEST_F(CoreMetricsRegistryTest, Counter_IsSafeAcrossThreads) {
+  CoreMetricsRegistry registry;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; ++t) {
+    workers.emplace_back([&registry] {
+      auto* counter = registry.counter("orc_test_total", "Test", "");
+      for (int i = 0; i < 1000; ++i) counter->add(1);
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  const auto samples = registry.snapshot();
+  ASSERT_EQ(samples.size(), 1u);
+  EXPECT_DOUBLE_EQ(samples[0].value, 4000.0);
+}
+
+TEST_F(CoreMetricsRegistryTest, Collector_RunsOnSnapshot) {
+  CoreMetricsRegistry registry;
+  int runs = 0;
+  registry.add_collector([&runs](CoreMetricsRegistry& r) {
+    r.gauge("orc_sampled", "Sampled", "")->set(++runs);
+  });
+  registry.snapshot();
+  const auto samples = registry.snapshot();
+  EXPECT_EQ(runs, 2);
+  ASSERT_NE(find_sample(samples, "orc_sampled", ""), nullptr);
+  EXPECT_DOUBLE_EQ(find_sample(samples, "orc_sampled", "")->value, 2.0);
+}
+
+TEST_F(CoreMetricsRegistryTest, HostMetrics_PublishFramePoolCounters) {
+  auto& metrics = orc::host_metrics();
+  const auto before = metrics.snapshot();
+  const auto value = [](const std::vector<MetricSample>& samples,
+                        const std::string& name) {
+    const MetricSample* sample = find_sample(samples, name, "");
+    return sample ? sample->value : 0.0;
+  };
+
+  // An odd size no other test uses, so the first acquire allocates.
+  auto& pool = orc::host_frame_buffer_pool();
+  pool.acquire(12345).reset();
+  pool.acquire(12345).reset();
+
+  const auto after = metrics.snapshot();
+  const MetricSample* allocations =
+      find_sample(after, "orc_frame_pool_allocations_total", "");
+  ASSERT_NE(allocations, nullptr);
+  EXPECT_EQ(allocations->kind, MetricKind::Counter);
+  EXPECT_GE(allocations->value,
+            value(before, "orc_frame_pool_allocations_total") + 1.0);
+  EXPECT_GE(value(after, "orc_frame_pool_recycles_total"),
+            value(before, "orc_frame_pool_recycles_total") + 1.0);
+  EXPECT_GE(value(after, "orc_frame_pool_reuses_total"),
+            value(before, "orc_frame_pool_reuses_total") + 1.0);
+
+  // Counters track the pool's totals rather than re-adding them.
+  const auto stats = pool.stats();
+  EXPECT_DOUBLE_EQ(allocations->value, static_cast<double>(stats.allocations));
+  EXPECT_NE(find_sample(after, "orc_frame_pool_pooled_buffers", ""), nullptr);
+}
+
+TEST_F(CoreMetricsRegistryTest, PrometheusText_EmitsFamiliesAndBuckets) {
+  CoreMetricsRegistry registry;
+  registry.counter("orc_cache_hits_total", "Cache hits", "cache=a")->add(7);
+  registry.counter("orc_cache_hits_total", "Cache hits", "cache=b")->add(1);
+  registry.histogram("orc_stage_execute_seconds", "Execute", "stage=x")
+      ->observe(0.003);
+
+  const std::string text = registry.prometheus_text();
+  EXPECT_NE(text.find("# HELP orc_cache_hits_total Cache hits\n"
+                      "# TYPE orc_cache_hits_total counter\n"
+                      "orc_cache_hits_total{cache=\"a\"} 7\n"
+                      "orc_cache_hits_total{cache=\"b\"} 1\n"),
+            std::string::npos)
+      << text;
+  EXPECT_NE(text.find("# TYPE orc_stage_execute_seconds histogram\n"),
+            std::string::npos);
+  EXPECT_NE(
+      text.find(
+          "orc_stage_execute_seconds_bucket{stage=\"x\",le=\"0.0025\"} 0\n"),
+      std::string::npos);
+  EXPECT_NE(
+      text.find(
+          "orc_stage_execute_seconds_bucket{stage=\"x\",le=\"0.005\"} 1\n"),
+      std::string::npos);
+  EXPECT_NE(
+      text.find(
+          "orc_stage_execute_seconds_bucket{stage=\"x\",le=\"+Inf\"} 1\n"),
+      std::string::npos);
+  EXPECT_NE(text.find("orc_stage_execute_seconds_count{stage=\"x\"} 1\n"),
+            std::string::npos);
+}
+
+TEST_F(CoreMetricsRegistryTest, WriteTextfile_ReplacesFile) {
+  CoreMetricsRegistry registry;
+  registry.gauge("orc_queue_depth", "Queue", "")->set(4);
+  std::string error;
+  ASSERT_TRUE(registry.write_prometheus_textfile(path_.string(), error))
+      << error;
+  EXPECT_EQ(read_file(path_), registry.prometheus_text());
+  EXPECT_FALSE(std::filesystem::exists(path_.string() + ".tmp"));
+}
+
+TEST_F(CoreMetricsRegistryTest, WriteTextfile_ReportsUnwritablePath) {
+  CoreMetricsRegistry registry;
+  std::string error;
+  EXPECT_FALSE(registry.write_prometheus_textfile(
+      (path_ / "missing" / "orc.prom").string(), error));
+  EXPECT_FALSE(error.empty());
+}
+
+TEST_F(CoreMetricsRegistryTest, LruCache_CountsFetchLookups) {
+  CoreMetricsRegistry registry;
+  LRUCache<int, int> cache(4);
+  cache.bind_metrics(&registry, "test.fetch");
+  cache.put(1, 10);
+  cache.get(1);
+  cache.get(2);
+  cache.contains(1);  // Not counted in kFetch mode
+
+  const auto samples = registry.snapshot();
+  EXPECT_DOUBLE_EQ(
+      find_sample(samples, "orc_cache_hits_total", "cache=test.fetch")->value,
+      1.0);
+  EXPECT_DOUBLE_EQ(
+      find_sample(samples, "orc_cache_misses_total", "cache=test.fetch")->value,
+      1.0);
+}
+
+TEST_F(CoreMetricsRegistryTest, LruCache_CountsContainsLookups) {
+  CoreMetricsRegistry registry;
+  LRUCache<int, int> cache(4);
+  cache.bind_metrics(&registry, "test.contains",
+                     LRUCache<int, int>::CountedLookup::kContains);
+  // Check-then-put: one miss, then a hit; the fetch is not counted again.
+  if (!cache.contains(1)) cache.put(1, 10);
+  if (!cache.contains(1)) cache.put(1, 10);
+  cache.get(1);
+
+  const auto samples = registry.snapshot();
+  EXPECT_DOUBLE_EQ(find_sample(samples, "orc_cache_hits_total",
+                               "cache=test.contains")
+                       ->value,
+                   1.0);
+  EXPECT_DOUBLE_EQ(find_sample(samples, "orc_cache_misses_total",
+                               "cache=test.contains")
+                       ->value,
+                   1.0);
+}
+
+TEST_F(CoreMetricsRegistryTest, LruCache_UnboundCacheIsInert) {
+  LRUCache<int, int> cache(4);
+  cache.bind_metrics(nullptr, "ignored");
+  cache.put(1, 10);
+  EXPECT_TRUE(cache.get(1).has_value());
+}
+
+TEST_F(CoreMetricsRegistryTest, Timer_WithoutHistogramIsInert) {
+  { orc::MetricTimer timer(nullptr); }
+  SUCCEED();
+}
+
+TEST_F(CoreMetricsRegistryTest, Accessor_GuardsOlderHostServicesSize) {
+  CoreMetricsRegistry registry;
+  OrcPluginServices services{};
+  services.metrics = &registry;
+  // Simulate an ABI 13 host: services_size stops short of the appended field.
+  services.services_size =
+      static_cast<uint32_t>(offsetof(OrcPluginServices, metrics));
+  orc::plugin::set_services(&services);
+  EXPECT_EQ(orc::plugin::get_metrics(), nullptr);
+
+  services.services_size = static_cast<uint32_t>(sizeof(OrcPluginServices));
+  EXPECT_EQ(orc::plugin::get_metrics(), &registry);
+
+  orc::plugin::set_services(nullptr);
+  EXPECT_EQ(orc::plugin::get_metrics(), nullptr);
+}
+
+}  // namespace orc_unit_test
@@ -0,0 +1,190 @@
+/*
+ * File:        preview_image_pyramid_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Unit tests for the tiled preview image mip pyramid
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include <gtest/gtest.h>
+#include <orc/stage/preview/orc_rendering.h>
+#include <preview_image_pyramid.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace orc;
+
+namespace {
+
+// Deterministic, non-uniform RGB888 content.
+PreviewImage make_image(uint32_t width, uint32_t height) {
+  PreviewImage image;
+  image.width = width;
+  image.height = height;
+  image.rgb_data.resize(static_cast<size_t>(width) * height * 3);
+  uint32_t state = 12345;
+  for (auto& byte : image.rgb_data) {
+    state = state * 1103515245u + 12345u;
+    byte = static_cast<uint8_t>(state >> 16);
+  }
+  return image;
+}
+
+const uint8_t* pixel(const std::vector<uint8_t>& rgb, uint32_t width,
+                     uint32_t x, uint32_t y) {
+  return &rgb[(static_cast<size_t>(y) * width + x) * 3];
+}
+
+bool is_red(const uint8_t* p) { return p[0] == 255 && p[1] == 0 && p[2] == 0; }
+
+}  // namespace
+
+TEST(PreviewImagePyramid, Build_HalvesEachLevelDownToOneTile) {
+  const PreviewImagePyramid pyramid(make_image(1000, 600));
+  ASSERT_EQ(pyramid.level_count(), 4u);
+  EXPECT_EQ(pyramid.level(1).width, 500u);
+  EXPECT_EQ(pyramid.level(1).height, 300u);
+  EXPECT_EQ(pyramid.level(3).width, 125u);
+  EXPECT_EQ(pyramid.level(3).height, 75u);
+
+  EXPECT_TRUE(PreviewImagePyramid(PreviewImage()).empty());
+}
+
+TEST(PreviewImagePyramid, Build_LevelIsRoundedTwoByTwoMean) {
+  // Odd width exercises the dropped last column and the scalar tail.
+  const PreviewImage image = make_image(301, 9);
+  const PreviewImagePyramid pyramid(image);
+  ASSERT_GE(pyramid.level_count(), 2u);
+  const PreviewImagePyramid::Level& half = pyramid.level(1);
+  ASSERT_EQ(half.width, 150u);
+  ASSERT_EQ(half.height, 4u);
+
+  for (uint32_t y = 0; y < half.height; ++y) {
+    for (uint32_t x = 0; x < half.width; ++x) {
+      for (size_t c = 0; c < 3; ++c) {
+        const uint32_t sum =
+            pixel(image.rgb_data, 301, 2 * x, 2 * y)[c] +
+            pixel(image.rgb_data, 301, 2 * x + 1, 2 * y)[c] +
+            pixel(image.rgb_data, 301, 2 * x, 2 * y + 1)[c] +
+            pixel(image.rgb_data, 301, 2 * x + 1, 2 * y + 1)[c];
+        ASSERT_EQ(pixel(half.rgb_data, half.width, x, y)[c], (sum + 2) / 4)
+            << "x=" << x << " y=" << y << " c=" << c;
+      }
+    }
+  }
+}
+
+TEST(PreviewImagePyramid, Resample_NearestWidenRepeatsColumns) {
+  const PreviewImage image = make_image(7, 3);
+  const PreviewViewport view = PreviewViewport::whole_image(7, 3, 2.0);
+  ASSERT_EQ(view.output_width, 14u);
+
+  std::vector<uint8_t> out(14 * 3 * 3, 0);
+  resample_rgb888(image.rgb_data.data(), 7, 3, view, out.data(), 14 * 3);
+  for (uint32_t y = 0; y < 3; ++y) {
+    for (uint32_t x = 0; x < 14; ++x) {
+      for (size_t c = 0; c < 3; ++c) {
+        EXPECT_EQ(pixel(out, 14, x, y)[c],
+                  pixel(image.rgb_data, 7, x / 2, y)[c]);
+      }
+    }
+  }
+}
+
+TEST(PreviewImagePyramid, Resample_LeavesOutputOffTheImageUntouched) {
+  const PreviewImage image = make_image(4, 4);
+  // Panned half an image left and up at 1:1.
+  PreviewViewport view;
+  view.source_x = -2.0;
+  view.source_y = -2.0;
+  view.source_width = 4.0;
+  view.source_height = 4.0;
+  view.output_width = 4;
+  view.output_height = 4;
+
+  std::vector<uint8_t> out(4 * 4 * 3, 7);
+  resample_rgb888(image.rgb_data.data(), 4, 4, view, out.data(), 4 * 3,
+                  PreviewFilter::Bilinear);
+  EXPECT_EQ(pixel(out, 4, 1, 1)[0], 7);
+  EXPECT_EQ(pixel(out, 4, 3, 1)[0], 7);
+  // Integer-aligned 1:1 bilinear sampling lands on pixel centres.
+  for (size_t c = 0; c < 3; ++c) {
+    EXPECT_EQ(pixel(out, 4, 2, 2)[c], pixel(image.rgb_data, 4, 0, 0)[c]);
+    EXPECT_EQ(pixel(out, 4, 3, 3)[c], pixel(image.rgb_data, 4, 1, 1)[c]);
+  }
+}
+
+TEST(PreviewImagePyramid, LevelFor_FollowsTheLessMinifiedAxis) {
+  const PreviewImagePyramid pyramid(make_image(1024, 512));
+  PreviewViewport view = PreviewViewport::whole_image(1024, 512);
+  EXPECT_EQ(pyramid.level_for(view), 0u);
+
+  view.output_width = 256;
+  view.output_height = 128;
+  EXPECT_EQ(pyramid.level_for(view), 2u);
+
+  // Aspect correction squeezes only the width: stay on the vertical's level.
+  view.output_width = 700;
+  view.output_height = 512;
+  EXPECT_EQ(pyramid.level_for(view), 0u);
+}
+
+TEST(PreviewImagePyramid, VisibleTiles_CoverOnlyTheViewport) {
+  const PreviewImagePyramid pyramid(make_image(1000, 600));
+  PreviewViewport view;
+  view.source_x = 300.0;
+  view.source_y = 10.0;
+  view.source_width = 200.0;
+  view.source_height = 50.0;
+  view.output_width = 800;
+  view.output_height = 200;
+
+  const auto tiles = pyramid.visible_tiles(view, 0);
+  // Columns 256-383 and 384-511, row 0-127.
+  ASSERT_EQ(tiles.size(), 2u);
+  EXPECT_EQ(tiles[0].x, 256u);
+  EXPECT_EQ(tiles[1].x, 384u);
+  EXPECT_EQ(tiles[0].y, 0u);
+
+  // Edge tiles are clipped to the level.
+  view = PreviewViewport::whole_image(1000, 600);
+  const auto all = pyramid.visible_tiles(view, 0);
+  ASSERT_EQ(all.size(), 8u * 5u);
+  EXPECT_EQ(all.back().width, 1000u - 7 * PreviewImagePyramid::kTileSize);
+  EXPECT_EQ(all.back().height, 600u - 4 * PreviewImagePyramid::kTileSize);
+}
+
+TEST(PreviewImagePyramid, Render_PaintsDropoutsOfVisibleTilesOnly) {
+  PreviewImage image = make_image(512, 256);
+  DropoutRegion visible;
+  visible.line = 10;
+  visible.start_sample = 20;
+  visible.end_sample = 200;  // spans two tiles
+  DropoutRegion hidden;
+  hidden.line = 200;
+  hidden.start_sample = 400;
+  hidden.end_sample = 500;
+  image.dropout_regions = {visible, hidden};
+  const PreviewImagePyramid pyramid(std::move(image));
+
+  // Top-left quarter at 1:1.
+  PreviewViewport view;
+  view.source_width = 256.0;
+  view.source_height = 128.0;
+  view.output_width = 256;
+  view.output_height = 128;
+  std::vector<uint8_t> out(256 * 128 * 3, 0);
+  pyramid.render(view, out.data(), 256 * 3, true);
+
+  EXPECT_TRUE(is_red(pixel(out, 256, 20, 10)));
+  EXPECT_TRUE(is_red(pixel(out, 256, 199, 10)));
+  EXPECT_FALSE(is_red(pixel(out, 256, 200, 10)));
+  EXPECT_FALSE(is_red(pixel(out, 256, 19, 10)));
+
+  std::vector<uint8_t> plain(256 * 128 * 3, 0);
+  pyramid.render(view, plain.data(), 256 * 3, false);
+  EXPECT_FALSE(is_red(pixel(plain, 256, 100, 10)));
+}
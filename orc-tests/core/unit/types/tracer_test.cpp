@@ -0,0 +1,187 @@
+/*
+ * File:        tracer_test.cpp
+ * Module:      orc-core-tests
+ * Purpose:     Unit tests for CoreTracer, TraceScope and the ABI 13
+ *              plugin::get_tracer() accessor
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include <gtest/gtest.h>
+#include <orc/abi/orc_plugin_services.h>
+#include <orc/stage/trace.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core_tracer.h"
+
+namespace orc_unit_test {
+
+namespace {
+
+using orc::CoreTracer;
+using orc::OrcPluginServices;
+
+std::string read_file(const std::filesystem::path& path) {
+  std::ifstream in(path);
+  std::ostringstream text;
+  text << in.rdbuf();
+  return text.str();
+}
+
+size_t count_of(const std::string& text, const std::string& needle) {
+  size_t count = 0;
+  for (size_t at = text.find(needle); at != std::string::npos;
+       at = text.find(needle, at + needle.size())) {
+    ++count;
+  }
+  return count;
+}
+
+class CoreTracerTest : public ::testing::Test {
+ protected:
+  void TearDown() override { std::filesystem::remove(path_); }
+
+  const std::filesystem::path path_ =
+      std::filesystem::temp_directory_path() / "orc_tracer_test.json";
+};
+
+}  // namespace
+
+TEST_F(CoreTracerTest, Scope_RecordsNothingWhileDisabled) {
+  CoreTracer tracer;
+  {
+    ORC_TRACE_SCOPE(&tracer, "test", "ignored");
+  }
+  EXPECT_FALSE(tracer.enabled());
+  EXPECT_EQ(tracer.stats().recorded, 0u);
+}
+
+TEST_F(CoreTracerTest, Scope_WithoutTracerIsInert) {
+  ORC_TRACE_FRAME_SCOPE(nullptr, "test", "inert", "stage", 3);
+  SUCCEED();
+}
+
+TEST_F(CoreTracerTest, WriteChromeTrace_EmitsTaggedCompleteEvents) {
+  CoreTracer tracer;
+  tracer.start();
+  {
+    ORC_TRACE_FRAME_SCOPE(&tracer, "source", "read \"frame\"", "tbc_source",
+                          42);
+  }
+  {
+    ORC_TRACE_SCOPE(&tracer, "dag", "execute");
+  }
+  tracer.stop();
+  {
+    ORC_TRACE_SCOPE(&tracer, "dag", "after_stop");
+  }
+
+  EXPECT_EQ(tracer.stats().recorded, 2u);
+  std::string error;
+  ASSERT_TRUE(tracer.write_chrome_trace(path_.string(), error)) << error;
+
+  const std::string json = read_file(path_);
+  EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+  EXPECT_EQ(count_of(json, "\"ph\":\"X\""), 2u);
+  EXPECT_NE(json.find("\"name\":\"read \\\"frame\\\"\""), std::string::npos);
+  EXPECT_NE(json.find("\"args\":{\"stage\":\"tbc_source\",\"frame\":42}"),
+            std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"execute\""), std::string::npos);
+  EXPECT_EQ(json.find("after_stop"), std::string::npos);
+}
+
+TEST_F(CoreTracerTest, Start_DiscardsPreviousCapture) {
+  CoreTracer tracer;
+  tracer.start();
+  { ORC_TRACE_SCOPE(&tracer, "test", "first"); }
+  tracer.start();
+  { ORC_TRACE_SCOPE(&tracer, "test", "second"); }
+  tracer.stop();
+
+  EXPECT_EQ(tracer.stats().recorded, 1u);
+  std::string error;
+  ASSERT_TRUE(tracer.write_chrome_trace(path_.string(), error)) << error;
+  const std::string json = read_file(path_);
+  EXPECT_EQ(json.find("\"first\""), std::string::npos);
+  EXPECT_NE(json.find("\"second\""), std::string::npos);
+}
+
+TEST_F(CoreTracerTest, Ring_KeepsNewestSpansAndCountsDropped) {
+  CoreTracer tracer(4);
+  tracer.start();
+  for (uint64_t frame = 0; frame < 10; ++frame) {
+    ORC_TRACE_FRAME_SCOPE(&tracer, "test", "span", nullptr, frame);
+  }
+  tracer.stop();
+
+  const auto stats = tracer.stats();
+  EXPECT_EQ(stats.recorded, 10u);
+  EXPECT_EQ(stats.dropped, 6u);
+
+  std::string error;
+  ASSERT_TRUE(tracer.write_chrome_trace(path_.string(), error)) << error;
+  const std::string json = read_file(path_);
+  EXPECT_EQ(count_of(json, "\"ph\":\"X\""), 4u);
+  EXPECT_EQ(json.find("\"frame\":5}"), std::string::npos);
+  EXPECT_NE(json.find("\"frame\":6}"), std::string::npos);
+  EXPECT_LT(json.find("\"frame\":6}"), json.find("\"frame\":9}"));
+}
+
+TEST_F(CoreTracerTest, Threads_RecordOnTheirOwnTracks) {
+  CoreTracer tracer;
+  tracer.start();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; ++t) {
+    workers.emplace_back([&tracer] {
+      for (int i = 0; i < 100; ++i) {
+        ORC_TRACE_SCOPE(&tracer, "test", "work");
+      }
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  tracer.stop();
+
+  // Spans of exited threads are still exported.
+  const auto stats = tracer.stats();
+  EXPECT_EQ(stats.recorded, 400u);
+  EXPECT_EQ(stats.threads, 4u);
+  std::string error;
+  ASSERT_TRUE(tracer.write_chrome_trace(path_.string(), error)) << error;
+  EXPECT_EQ(count_of(read_file(path_), "\"thread_name\""), 4u);
+}
+
+TEST_F(CoreTracerTest, WriteChromeTrace_ReportsUnwritablePath) {
+  CoreTracer tracer;
+  std::string error;
+  EXPECT_FALSE(tracer.write_chrome_trace(
+      (path_ / "missing" / "trace.json").string(), error));
+  EXPECT_FALSE(error.empty());
+}
+
+TEST_F(CoreTracerTest, Accessor_GuardsOlderHostServicesSize) {
+  CoreTracer tracer;
+  OrcPluginServices services{};
+  services.tracer = &tracer;
+  // Simulate an ABI 12 host: services_size stops short of the appended field.
+  services.services_size =
+      static_cast<uint32_t>(offsetof(OrcPluginServices, tracer));
+  orc::plugin::set_services(&services);
+  EXPECT_EQ(orc::plugin::get_tracer(), nullptr);
+
+  services.services_size = static_cast<uint32_t>(sizeof(OrcPluginServices));
+  EXPECT_EQ(orc::plugin::get_tracer(), &tracer);
+
+  orc::plugin::set_services(nullptr);
+  EXPECT_EQ(orc::plugin::get_tracer(), nullptr);
+}
+
+}  // namespace orc_unit_test
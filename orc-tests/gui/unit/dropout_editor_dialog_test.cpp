@@ -84,7 +84,8 @@ class FakeRenderPresenter : public orc::presenters::IRenderPresenter {
   orc::PreviewRenderResult renderPreview(orc::NodeID node_id,
                                          orc::PreviewOutputType output_type,
                                          uint64_t output_index,
-                                         const std::string&) override {
+                                         const std::string&,
+                                         std::function<bool()>) override {
     orc::PreviewRenderResult result;
     result.node_id = node_id;
     result.output_type = output_type;
@@ -104,6 +105,11 @@ class FakeRenderPresenter : public orc::presenters::IRenderPresenter {
   }
 
   // Unused interface surface: inert stubs.
+  std::optional<orc::PreviewRenderResult> renderDraftPreview(
+      orc::NodeID, orc::PreviewOutputType, uint64_t,
+      std::function<bool()>) override {
+    return std::nullopt;
+  }
   std::optional<orc::presenters::VBIFieldInfoView> getVBIData(
       orc::NodeID, orc::FieldID) override {
     return std::nullopt;
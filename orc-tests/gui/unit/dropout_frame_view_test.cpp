@@ -8,10 +8,10 @@
  */
 
 #include <gtest/gtest.h>
+#include <orc/stage/preview/orc_rendering.h>
 
 #include <QApplication>
 #include <QCoreApplication>
-#include <QImage>
 #include <QMouseEvent>
 #include <optional>
 #include <vector>
@@ -96,8 +96,10 @@ class DropoutFrameViewTest : public ::testing::Test {
       const std::vector<orc::presenters::DropoutRegion>& sources,
       const std::vector<orc::presenters::DropoutRegion>& additions = {},
       const std::vector<orc::presenters::DropoutRegion>& removals = {}) {
-    QImage image(100, 50, QImage::Format_RGB888);
-    image.fill(Qt::gray);
+    orc::PreviewImage image;
+    image.width = 100;
+    image.height = 50;
+    image.rgb_data.assign(100 * 50 * 3, 128);
     view_->setFrame(image, sources, additions, removals);
     ASSERT_EQ(view_->zoomLevel(), 1.0);
     ASSERT_EQ(view_->size(), QSize(100, 50));
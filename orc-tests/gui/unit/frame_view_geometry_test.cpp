@@ -120,6 +120,33 @@ TEST(FrameViewGeometry_Mapping, WidgetPointOnImageRespectsLetterbox) {
   EXPECT_FALSE(geometry.widgetPointOnImage(QPoint(250, 100)));  // right bar
 }
 
+TEST(FrameViewGeometry_PreviewViewport, ClipsExposedRectToTheImage) {
+  // 100x100 image at zoom 2 in a 400x400 viewport -> target rect at
+  // (100, 100), two widget pixels per image pixel.
+  auto geometry = makeGeometry(QSize(100, 100), QSize(400, 400), 1.0, 2.0);
+
+  const orc::PreviewViewport view =
+      geometry.previewViewport(QRect(0, 150, 200, 100));
+  EXPECT_EQ(view.output_width, 100u);  // left letterbox bar clipped off
+  EXPECT_EQ(view.output_height, 100u);
+  EXPECT_NEAR(view.source_x, 0.0, 1e-9);
+  EXPECT_NEAR(view.source_y, 25.0, 1e-9);
+  EXPECT_NEAR(view.source_width, 50.0, 1e-9);
+  EXPECT_NEAR(view.source_height, 50.0, 1e-9);
+
+  EXPECT_EQ(geometry.previewViewport(QRect(0, 0, 50, 50)).output_width, 0u);
+}
+
+TEST(FrameViewGeometry_PreviewViewport, CarriesAspectCorrection) {
+  auto geometry = makeGeometry(QSize(100, 100), QSize(50, 100), 0.5);
+
+  const orc::PreviewViewport view =
+      geometry.previewViewport(QRect(0, 0, 50, 100));
+  EXPECT_EQ(view.output_width, 50u);
+  EXPECT_NEAR(view.source_width, 100.0, 1e-9);
+  EXPECT_NEAR(view.source_height, 100.0, 1e-9);
+}
+
 TEST(FrameViewGeometry_ScrollAfterZoom, KeepsCursorContentStationary) {
   // Content point under the cursor: scroll 100 + cursor 50 = 150.
   // After zooming 2x it sits at 300; new scroll must be 300 - 50 = 250.
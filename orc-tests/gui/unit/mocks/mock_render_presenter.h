@@ -23,7 +23,12 @@ class MockRenderPresenter : public IRenderPresenter {
 
   MOCK_METHOD(orc::PreviewRenderResult, renderPreview,
               (NodeID node_id, orc::PreviewOutputType output_type,
-               uint64_t output_index, const std::string& option_id),
+               uint64_t output_index, const std::string& option_id,
+               std::function<bool()> cancel_check),
+              (override));
+  MOCK_METHOD((std::optional<orc::PreviewRenderResult>), renderDraftPreview,
+              (NodeID node_id, orc::PreviewOutputType output_type,
+               uint64_t output_index, std::function<bool()> cancel_check),
               (override));
 
   MOCK_METHOD((std::optional<VBIFieldInfoView>), getVBIData,
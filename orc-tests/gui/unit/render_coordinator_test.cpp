@@ -17,8 +17,15 @@
 #include <QMetaType>
 #include <QSignalSpy>
 #include <QThread>
+#include <atomic>
 #include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 #include "mocks/mock_render_presenter.h"
 
@@ -57,8 +64,9 @@ TEST(RenderCoordinatorTest, TriggerRequestRoundTrip_EmitsTriggerComplete) {
   auto mock_presenter =
       std::make_shared<NiceMock<orc::presenters::test::MockRenderPresenter>>();
 
-  EXPECT_CALL(*mock_presenter, setDAG(testing::_)).Times(1);
-  EXPECT_CALL(*mock_presenter, setShowDropouts(false)).Times(1);
+  // Once per lane: triggers run on the background lane's own presenter
+  EXPECT_CALL(*mock_presenter, setDAG(testing::_)).Times(2);
+  EXPECT_CALL(*mock_presenter, setShowDropouts(false)).Times(2);
   EXPECT_CALL(*mock_presenter, triggerStage(orc::NodeID(7), testing::_))
       .WillOnce(Return(1001));
 
@@ -110,8 +118,9 @@ TEST(RenderCoordinatorTest, TriggerRequests_AreProcessedInOrder) {
   auto mock_presenter =
       std::make_shared<NiceMock<orc::presenters::test::MockRenderPresenter>>();
 
-  EXPECT_CALL(*mock_presenter, setDAG(testing::_)).Times(1);
-  EXPECT_CALL(*mock_presenter, setShowDropouts(false)).Times(1);
+  // Once per lane: triggers run on the background lane's own presenter
+  EXPECT_CALL(*mock_presenter, setDAG(testing::_)).Times(2);
+  EXPECT_CALL(*mock_presenter, setShowDropouts(false)).Times(2);
 
   {
     InSequence seq;
@@ -160,28 +169,27 @@ TEST(RenderCoordinatorTest, StalePreviewResponses_AreSuppressed) {
   EXPECT_CALL(*mock_presenter, setDAG(testing::_)).Times(1);
   EXPECT_CALL(*mock_presenter, setShowDropouts(false)).Times(1);
 
+  // Whether the first request is coalesced at dequeue or rendered and then
+  // dropped, the second is served without a second render.
   EXPECT_CALL(*mock_presenter,
               renderPreview(orc::NodeID(9),
-                            orc::PreviewOutputType::Frame_Field1, 0, ""))
-      .WillOnce(
-          Invoke([](orc::NodeID node_id, orc::PreviewOutputType output_type,
-                    uint64_t output_index, const std::string&) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(20));
-            return orc::PreviewRenderResult{
-                {}, true, "", node_id, output_type, output_index, std::nullopt};
-          }))
-      .WillOnce(
-          Invoke([](orc::NodeID node_id, orc::PreviewOutputType output_type,
-                    uint64_t output_index, const std::string&) {
-            return orc::PreviewRenderResult{
-                {}, true, "", node_id, output_type, output_index, std::nullopt};
-          }));
+                            orc::PreviewOutputType::Frame_Field1, 0, "",
+                            testing::_))
+      .WillOnce(Invoke([](orc::NodeID node_id,
+                          orc::PreviewOutputType output_type,
+                          uint64_t output_index, const std::string&,
+                          std::function<bool()>) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return orc::PreviewRenderResult{
+            {}, true, "", node_id, output_type, output_index, std::nullopt};
+      }));
 
   RenderCoordinator coordinator(
       [mock_presenter](
           void*) -> std::shared_ptr<orc::presenters::IRenderPresenter> {
         return mock_presenter;
       });
+  coordinator.setPrefetchDepth(0);
 
   QSignalSpy preview_spy(&coordinator, &RenderCoordinator::previewReady);
 
@@ -202,4 +210,517 @@ TEST(RenderCoordinatorTest, StalePreviewResponses_AreSuppressed) {
   coordinator.stop();
 }
 
+namespace {
+
+// Presenter stub that renders every preview successfully and counts renders
+// per output index.
+class CountingRenders {
+ public:
+  void install(orc::presenters::test::MockRenderPresenter& presenter) {
+    ON_CALL(presenter, renderPreview(testing::_, testing::_, testing::_,
+                                     testing::_, testing::_))
+        .WillByDefault(Invoke([this](orc::NodeID node_id,
+                                     orc::PreviewOutputType output_type,
+                                     uint64_t output_index, const std::string&,
+                                     std::function<bool()>) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          ++counts_[output_index];
+          return orc::PreviewRenderResult{
+              {}, true, "", node_id, output_type, output_index, std::nullopt};
+        }));
+  }
+
+  int count(uint64_t index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return counts_[index];
+  }
+
+  bool waitForRender(uint64_t index, int timeout_ms = 2000) {
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(timeout_ms);
+    while (std::chrono::steady_clock::now() < deadline) {
+      if (count(index) > 0) {
+        return true;
+      }
+      QThread::msleep(5);
+    }
+    return count(index) > 0;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::map<uint64_t, int> counts_;
+};
+
+}  // namespace
+
+TEST(RenderCoordinatorTest, RepeatedPreview_IsServedFromCache) {
+  (void)kMetatypesRegistered;
+
+  auto mock_presenter =
+      std::make_shared<NiceMock<orc::presenters::test::MockRenderPresenter>>();
+  CountingRenders renders;
+  renders.install(*mock_presenter);
+
+  RenderCoordinator coordinator(
+      [mock_presenter](
+          void*) -> std::shared_ptr<orc::presenters::IRenderPresenter> {
+        return mock_presenter;
+      });
+  coordinator.setPrefetchDepth(0);
+
+  QSignalSpy preview_spy(&coordinator, &RenderCoordinator::previewReady);
+
+  coordinator.start();
+  coordinator.setProject(reinterpret_cast<void*>(0x1));
+  coordinator.updateDAG(std::make_shared<int>(456));
+
+  coordinator.requestPreview(orc::NodeID(3),
+                             orc::PreviewOutputType::Frame_Field1, 5);
+  ASSERT_TRUE(waitForCount(preview_spy, 1));
+  coordinator.requestPreview(orc::NodeID(3),
+                             orc::PreviewOutputType::Frame_Field1, 5);
+  ASSERT_TRUE(waitForCount(preview_spy, 2));
+
+  EXPECT_EQ(renders.count(5), 1);
+  EXPECT_TRUE(
+      preview_spy.at(1).at(1).value<orc::PreviewRenderResult>().success);
+
+  // A new DAG invalidates the cache.
+  coordinator.updateDAG(std::make_shared<int>(457));
+  coordinator.requestPreview(orc::NodeID(3),
+                             orc::PreviewOutputType::Frame_Field1, 5);
+  ASSERT_TRUE(waitForCount(preview_spy, 3));
+  EXPECT_EQ(renders.count(5), 2);
+
+  coordinator.stop();
+}
+
+TEST(RenderCoordinatorTest, Prefetch_FollowsScrubDirection) {
+  (void)kMetatypesRegistered;
+
+  auto mock_presenter =
+      std::make_shared<NiceMock<orc::presenters::test::MockRenderPresenter>>();
+  CountingRenders renders;
+  renders.install(*mock_presenter);
+
+  RenderCoordinator coordinator(
+      [mock_presenter](
+          void*) -> std::shared_ptr<orc::presenters::IRenderPresenter> {
+        return mock_presenter;
+      });
+  coordinator.setPrefetchDepth(2);
+
+  QSignalSpy preview_spy(&coordinator, &RenderCoordinator::previewReady);
+
+  coordinator.start();
+  coordinator.setProject(reinterpret_cast<void*>(0x1));
+  coordinator.updateDAG(std::make_shared<int>(567));
+
+  // The first preview prefetches forwards.
+  coordinator.requestPreview(orc::NodeID(4),
+                             orc::PreviewOutputType::Frame_Field1, 10);
+  ASSERT_TRUE(waitForCount(preview_spy, 1));
+  ASSERT_TRUE(renders.waitForRender(12));
+
+  // Stepping onto a prefetched frame does not render it again.
+  coordinator.requestPreview(orc::NodeID(4),
+                             orc::PreviewOutputType::Frame_Field1, 11);
+  ASSERT_TRUE(waitForCount(preview_spy, 2));
+  EXPECT_EQ(renders.count(11), 1);
+
+  // Stepping back reverses the prefetch direction.
+  coordinator.requestPreview(orc::NodeID(4),
+                             orc::PreviewOutputType::Frame_Field1, 9);
+  ASSERT_TRUE(waitForCount(preview_spy, 3));
+  ASSERT_TRUE(renders.waitForRender(7));
+  EXPECT_EQ(renders.count(8), 1);
+
+  coordinator.stop();
+}
+
+TEST(RenderCoordinatorTest, NewerPreview_CancelsRenderInFlight) {
+  (void)kMetatypesRegistered;
+
+  auto mock_presenter =
+      std::make_shared<NiceMock<orc::presenters::test::MockRenderPresenter>>();
+
+  std::atomic<bool> first_started{false};
+  std::atomic<bool> first_cancelled{false};
+  EXPECT_CALL(*mock_presenter,
+              renderPreview(orc::NodeID(5),
+                            orc::PreviewOutputType::Frame_Field1, 1, "",
+                            testing::_))
+      .WillOnce(Invoke([&](orc::NodeID node_id,
+                           orc::PreviewOutputType output_type,
+                           uint64_t output_index, const std::string&,
+                           std::function<bool()> cancel_check) {
+        first_started = true;
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (std::chrono::steady_clock::now() < deadline) {
+          if (cancel_check && cancel_check()) {
+            first_cancelled = true;
+            break;
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        return orc::PreviewRenderResult{{},          false,
+                                        "cancelled", node_id,
+                                        output_type, output_index,
+                                        std::nullopt};
+      }));
+  EXPECT_CALL(*mock_presenter,
+              renderPreview(orc::NodeID(5),
+                            orc::PreviewOutputType::Frame_Field1, 2, "",
+                            testing::_))
+      .WillOnce(Invoke([](orc::NodeID node_id,
+                          orc::PreviewOutputType output_type,
+                          uint64_t output_index, const std::string&,
+                          std::function<bool()>) {
+        return orc::PreviewRenderResult{
+            {}, true, "", node_id, output_type, output_index, std::nullopt};
+      }));
+
+  RenderCoordinator coordinator(
+      [mock_presenter](
+          void*) -> std::shared_ptr<orc::presenters::IRenderPresenter> {
+        return mock_presenter;
+      });
+  coordinator.setPrefetchDepth(0);
+
+  QSignalSpy preview_spy(&coordinator, &RenderCoordinator::previewReady);
+
+  coordinator.start();
+  coordinator.setProject(reinterpret_cast<void*>(0x1));
+  coordinator.updateDAG(std::make_shared<int>(678));
+
+  coordinator.requestPreview(orc::NodeID(5),
+                             orc::PreviewOutputType::Frame_Field1, 1);
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (!first_started && std::chrono::steady_clock::now() < deadline) {
+    QThread::msleep(2);
+  }
+  ASSERT_TRUE(first_started);
+
+  const uint64_t second_id = coordinator.requestPreview(
+      orc::NodeID(5), orc::PreviewOutputType::Frame_Field1, 2);
+
+  ASSERT_TRUE(waitForCount(preview_spy, 1));
+  EXPECT_TRUE(first_cancelled);
+  EXPECT_EQ(preview_spy.count(), 1);
+  EXPECT_EQ(preview_spy.at(0).at(0).toULongLong(), second_id);
+
+  coordinator.stop();
+}
+
+
+TEST(RenderCoordinatorTest, DraftPreview_IsRefinedOnceNavigationPauses) {
+  (void)kMetatypesRegistered;
+
+  auto mock_presenter =
+      std::make_shared<NiceMock<orc::presenters::test::MockRenderPresenter>>();
+  CountingRenders renders;
+  renders.install(*mock_presenter);
+  EXPECT_CALL(*mock_presenter,
+              renderDraftPreview(orc::NodeID(6),
+                                 orc::PreviewOutputType::Frame_Field1, 4,
+                                 testing::_))
+      .WillOnce(Invoke([](orc::NodeID node_id,
+                          orc::PreviewOutputType output_type,
+                          uint64_t output_index, std::function<bool()>) {
+        // Tag the draft by image width; full renders leave it at zero.
+        orc::PreviewRenderResult result{
+            {}, true, "", node_id, output_type, output_index, std::nullopt};
+        result.image.width = 1;
+        return std::optional<orc::PreviewRenderResult>(std::move(result));
+      }));
+
+  RenderCoordinator coordinator(
+      [mock_presenter](
+          void*) -> std::shared_ptr<orc::presenters::IRenderPresenter> {
+        return mock_presenter;
+      });
+  coordinator.setPrefetchDepth(0);
+
+  QSignalSpy preview_spy(&coordinator, &RenderCoordinator::previewReady);
+
+  coordinator.start();
+  coordinator.setProject(reinterpret_cast<void*>(0x1));
+  coordinator.updateDAG(std::make_shared<int>(789));
+
+  const uint64_t request_id = coordinator.requestPreview(
+      orc::NodeID(6), orc::PreviewOutputType::Frame_Field1, 4);
+
+  // The draft is delivered first, then replaced under the same request ID.
+  ASSERT_TRUE(waitForCount(preview_spy, 2));
+  EXPECT_EQ(preview_spy.at(0).at(0).toULongLong(), request_id);
+  EXPECT_EQ(preview_spy.at(1).at(0).toULongLong(), request_id);
+  EXPECT_EQ(
+      preview_spy.at(0).at(1).value<orc::PreviewRenderResult>().image.width,
+      1u);
+  EXPECT_EQ(
+      preview_spy.at(1).at(1).value<orc::PreviewRenderResult>().image.width,
+      0u);
+  EXPECT_EQ(renders.count(4), 1);
+
+  // The refined preview is cached; drafts are not.
+  coordinator.requestPreview(orc::NodeID(6),
+                             orc::PreviewOutputType::Frame_Field1, 4);
+  ASSERT_TRUE(waitForCount(preview_spy, 3));
+  EXPECT_EQ(renders.count(4), 1);
+
+  coordinator.stop();
+}
+
+TEST(RenderCoordinatorTest, DraftPreviews_CanBeDisabled) {
+  (void)kMetatypesRegistered;
+
+  auto mock_presenter =
+      std::make_shared<NiceMock<orc::presenters::test::MockRenderPresenter>>();
+  CountingRenders renders;
+  renders.install(*mock_presenter);
+  EXPECT_CALL(*mock_presenter, renderDraftPreview(testing::_, testing::_,
+                                                  testing::_, testing::_))
+      .Times(0);
+
+  RenderCoordinator coordinator(
+      [mock_presenter](
+          void*) -> std::shared_ptr<orc::presenters::IRenderPresenter> {
+        return mock_presenter;
+      });
+  coordinator.setPrefetchDepth(0);
+  coordinator.setDraftPreviews(false);
+
+  QSignalSpy preview_spy(&coordinator, &RenderCoordinator::previewReady);
+
+  coordinator.start();
+  coordinator.setProject(reinterpret_cast<void*>(0x1));
+  coordinator.updateDAG(std::make_shared<int>(890));
+
+  coordinator.requestPreview(orc::NodeID(6),
+                             orc::PreviewOutputType::Frame_Field1, 4);
+  ASSERT_TRUE(waitForCount(preview_spy, 1));
+  EXPECT_EQ(renders.count(4), 1);
+
+  coordinator.stop();
+}
+
+
+TEST(RenderCoordinatorTest, LongTrigger_DoesNotBlockPreviews) {
+  (void)kMetatypesRegistered;
+
+  auto mock_presenter =
+      std::make_shared<NiceMock<orc::presenters::test::MockRenderPresenter>>();
+  CountingRenders renders;
+  renders.install(*mock_presenter);
+
+  std::atomic<bool> trigger_started{false};
+  std::atomic<bool> release_trigger{false};
+  EXPECT_CALL(*mock_presenter, triggerStage(orc::NodeID(1), testing::_))
+      .WillOnce(Invoke(
+          [&](orc::NodeID,
+              orc::presenters::IRenderPresenter::TriggerProgressCallback) {
+            trigger_started = true;
+            const auto deadline =
+                std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            while (!release_trigger &&
+                   std::chrono::steady_clock::now() < deadline) {
+              std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            return 3001ULL;
+          }));
+
+  RenderCoordinator coordinator(
+      [mock_presenter](
+          void*) -> std::shared_ptr<orc::presenters::IRenderPresenter> {
+        return mock_presenter;
+      });
+  coordinator.setPrefetchDepth(0);
+
+  QSignalSpy preview_spy(&coordinator, &RenderCoordinator::previewReady);
+  QSignalSpy trigger_complete_spy(&coordinator,
+                                  &RenderCoordinator::triggerComplete);
+
+  coordinator.start();
+  coordinator.setProject(reinterpret_cast<void*>(0x1));
+  coordinator.updateDAG(std::make_shared<int>(901));
+
+  coordinator.requestTrigger(orc::NodeID(1));
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (!trigger_started && std::chrono::steady_clock::now() < deadline) {
+    QThread::msleep(2);
+  }
+  ASSERT_TRUE(trigger_started);
+
+  // The preview is served while the trigger is still running.
+  coordinator.requestPreview(orc::NodeID(2),
+                             orc::PreviewOutputType::Frame_Field1, 3);
+  ASSERT_TRUE(waitForCount(preview_spy, 1));
+  EXPECT_EQ(trigger_complete_spy.count(), 0);
+
+  release_trigger = true;
+  ASSERT_TRUE(waitForCount(trigger_complete_spy, 1));
+  EXPECT_TRUE(trigger_complete_spy.at(0).at(1).toBool());
+
+  coordinator.stop();
+}
+
+TEST(RenderCoordinatorTest, CancelRequest_StopsRunningAndQueuedTriggers) {
+  (void)kMetatypesRegistered;
+
+  auto mock_presenter =
+      std::make_shared<NiceMock<orc::presenters::test::MockRenderPresenter>>();
+
+  std::atomic<bool> trigger_started{false};
+  std::atomic<bool> cancel_requested{false};
+  ON_CALL(*mock_presenter, cancelTrigger()).WillByDefault(Invoke([&] {
+    cancel_requested = true;
+  }));
+  EXPECT_CALL(*mock_presenter, triggerStage(orc::NodeID(1), testing::_))
+      .WillOnce(Invoke(
+          [&](orc::NodeID,
+              orc::presenters::IRenderPresenter::TriggerProgressCallback)
+              -> uint64_t {
+            trigger_started = true;
+            const auto deadline =
+                std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            while (!cancel_requested &&
+                   std::chrono::steady_clock::now() < deadline) {
+              std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            throw std::runtime_error("Trigger failed: cancelled");
+          }));
+  // A cancelled request never reaches the presenter
+  EXPECT_CALL(*mock_presenter, triggerStage(orc::NodeID(2), testing::_))
+      .Times(0);
+
+  RenderCoordinator coordinator(
+      [mock_presenter](
+          void*) -> std::shared_ptr<orc::presenters::IRenderPresenter> {
+        return mock_presenter;
+      });
+
+  QSignalSpy trigger_complete_spy(&coordinator,
+                                  &RenderCoordinator::triggerComplete);
+
+  coordinator.start();
+  coordinator.setProject(reinterpret_cast<void*>(0x1));
+  coordinator.updateDAG(std::make_shared<int>(902));
+
+  const uint64_t running_id = coordinator.requestTrigger(orc::NodeID(1));
+  const uint64_t queued_id = coordinator.requestTrigger(orc::NodeID(2));
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (!trigger_started && std::chrono::steady_clock::now() < deadline) {
+    QThread::msleep(2);
+  }
+  ASSERT_TRUE(trigger_started);
+
+  coordinator.cancelRequest(queued_id);
+  coordinator.cancelRequest(running_id);
+
+  ASSERT_TRUE(waitForCount(trigger_complete_spy, 2));
+  EXPECT_TRUE(cancel_requested);
+  EXPECT_EQ(trigger_complete_spy.at(0).at(0).toULongLong(), running_id);
+  EXPECT_FALSE(trigger_complete_spy.at(0).at(1).toBool());
+  EXPECT_EQ(trigger_complete_spy.at(1).at(0).toULongLong(), queued_id);
+  EXPECT_FALSE(trigger_complete_spy.at(1).at(1).toBool());
+
+  coordinator.stop();
+}
+
+TEST(RenderCoordinatorTest, AnalysisTrigger_StreamsEachSnapshotOnce) {
+  (void)kMetatypesRegistered;
+
+  auto mock_presenter =
+      std::make_shared<NiceMock<orc::presenters::test::MockRenderPresenter>>();
+
+  // The sink's dataset as published by the progressive engine; only touched
+  // on the background lane's thread.
+  std::vector<orc::FrameBurstLevelStats> published;
+  bool has_results = false;
+  ON_CALL(*mock_presenter,
+          getBurstLevelAnalysisData(orc::NodeID(3), testing::_, testing::_))
+      .WillByDefault(Invoke([&](orc::NodeID, std::vector<void*>& stats,
+                                int32_t& total_frames) {
+        if (!has_results) return false;
+        stats = {&published};
+        total_frames = 100;
+        return true;
+      }));
+
+  auto publish = [&](size_t buckets, double level) {
+    published.assign(buckets, orc::FrameBurstLevelStats{});
+    for (size_t i = 0; i < buckets; ++i) {
+      published[i].frame_number = static_cast<int32_t>(i + 1);
+      published[i].median_burst_10bit = level;
+      published[i].has_data = true;
+      published[i].field_count = 2;
+    }
+    has_results = true;
+  };
+
+  EXPECT_CALL(*mock_presenter, triggerStage(orc::NodeID(3), testing::_))
+      .WillOnce(Invoke(
+          [&](orc::NodeID,
+              orc::presenters::IRenderPresenter::TriggerProgressCallback
+                  progress) -> uint64_t {
+            progress(0, 100, "Starting");  // nothing published yet
+            publish(10, 200.0);            // coarse overview
+            progress(10, 100, "Coarse");
+            progress(20, 100, "Coarse");  // same snapshot, not re-sent
+            publish(10, 210.0);           // refinement
+            progress(60, 100, "Refining");
+            publish(10, 220.0);  // final dataset
+            return 3001ULL;
+          }));
+
+  RenderCoordinator coordinator(
+      [mock_presenter](
+          void*) -> std::shared_ptr<orc::presenters::IRenderPresenter> {
+        return mock_presenter;
+      });
+
+  std::mutex mutex;
+  std::vector<double> partial_levels;
+  QObject::connect(
+      &coordinator, &RenderCoordinator::burstLevelPartialDataReady,
+      [&](uint64_t, std::vector<orc::FrameBurstLevelStats> stats, int32_t) {
+        std::lock_guard<std::mutex> lock(mutex);
+        partial_levels.push_back(stats.front().median_burst_10bit);
+      });
+  std::optional<double> final_level;
+  QObject::connect(
+      &coordinator, &RenderCoordinator::burstLevelDataReady,
+      [&](uint64_t, std::vector<orc::FrameBurstLevelStats> stats, int32_t) {
+        std::lock_guard<std::mutex> lock(mutex);
+        final_level = stats.front().median_burst_10bit;
+      });
+
+  coordinator.start();
+  coordinator.setProject(reinterpret_cast<void*>(0x1));
+  coordinator.updateDAG(std::make_shared<int>(903));
+  coordinator.requestBurstLevelData(orc::NodeID(3));
+
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (std::chrono::steady_clock::now() < deadline) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (final_level) break;
+    }
+    QThread::msleep(2);
+  }
+
+  coordinator.stop();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  ASSERT_TRUE(final_level.has_value());
+  EXPECT_DOUBLE_EQ(*final_level, 220.0);
+  EXPECT_EQ(partial_levels, (std::vector<double>{200.0, 210.0}));
+}
+
 }  // namespace gui_unit_test
@@ -0,0 +1,130 @@
+/*
+ * File:        vectorscope_histogram_test.cpp
+ * Module:      orc-tests/gui/unit
+ * Purpose:     Unit tests for the vectorscope histogram kernel
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "preview/vectorscope_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace gui_unit_test {
+
+namespace {
+
+// 16x16 canvas with one pixel per U/V unit: sample (u, v) lands on pixel
+// (8 + u, 8 - v).
+orc::gui::VectorscopeLayout small_layout() {
+  orc::gui::VectorscopeLayout layout;
+  layout.canvas_size = 16;
+  layout.centre_x = 8.0;
+  layout.centre_y = 8.0;
+  layout.pixels_per_uv_unit = 1.0;
+  layout.signed_full_scale = 8.0;
+  return layout;
+}
+
+}  // namespace
+
+TEST(VectorscopeHistogramTest, Accumulate_CountsSamplesAtTheirCanvasPixel) {
+  const std::vector<orc::UVSample> samples = {
+      {2.0, 3.0, 0}, {2.0, 3.0, 1}, {-4.0, -1.0, 0}, {100.0, 0.0, 0}};
+
+  orc::gui::VectorscopeHistogram histogram;
+  histogram.accumulate(samples.data(), samples.size(), small_layout());
+  EXPECT_EQ(histogram.count(10, 5), 2u);
+  EXPECT_EQ(histogram.count(4, 9), 1u);
+  EXPECT_EQ(histogram.count(8, 8), 0u);
+  EXPECT_FALSE(histogram.has_chroma());
+
+  // A new field replaces the previous counts.
+  histogram.accumulate(samples.data(), 1, small_layout());
+  EXPECT_EQ(histogram.count(10, 5), 1u);
+  EXPECT_EQ(histogram.count(4, 9), 0u);
+}
+
+TEST(VectorscopeHistogramTest, Accumulate_FiltersFieldsAndTracesLines) {
+  const std::vector<orc::UVSample> samples = {
+      {0.0, 0.0, 0}, {4.0, 0.0, 0}, {4.0, 4.0, 1}};
+
+  orc::gui::VectorscopeLayout layout = small_layout();
+  layout.field_select = 2;
+  orc::gui::VectorscopeHistogram histogram;
+  histogram.accumulate(samples.data(), samples.size(), layout);
+  EXPECT_EQ(histogram.count(8, 8), 0u);
+  EXPECT_EQ(histogram.count(12, 4), 1u);
+
+  // Lines join consecutive samples of the same field only, so the segment
+  // from (8,8) to (12,8) is traced and nothing links it to field 1.
+  layout.field_select = 0;
+  layout.draw_lines = true;
+  histogram.accumulate(samples.data(), samples.size(), layout);
+  for (int x = 9; x < 12; ++x) {
+    EXPECT_EQ(histogram.count(x, 8), 1u) << "x=" << x;
+  }
+  EXPECT_EQ(histogram.count(12, 8), 2u);
+  EXPECT_EQ(histogram.count(12, 6), 0u);
+}
+
+TEST(VectorscopeHistogramTest, Accumulate_DetectsChroma) {
+  const std::vector<orc::UVSample> samples = {{0.0, 0.0, 0},
+                                              {0.0, -1500.0, 0}};
+  orc::gui::VectorscopeHistogram histogram;
+  histogram.accumulate(samples.data(), samples.size(), small_layout());
+  EXPECT_TRUE(histogram.has_chroma());
+}
+
+TEST(VectorscopeHistogramTest, Render_WritesTraceOverTransparentBackground) {
+  const std::vector<orc::UVSample> samples = {{2.0, 3.0, 0}};
+  orc::gui::VectorscopeHistogram histogram;
+  histogram.accumulate(samples.data(), samples.size(), small_layout());
+
+  orc::gui::VectorscopeRenderStyle style;
+  style.gain = 100.0f;  // saturate a single hit
+  style.trace = 0xff10e020;
+
+  // The stride is padded to check that rows are addressed by it.
+  const size_t stride = 19;
+  std::vector<uint32_t> pixels(stride * 16, 0xdeadbeef);
+  histogram.render(pixels.data(), stride, style);
+  for (int py = 0; py < 16; ++py) {
+    for (int px = 0; px < 16; ++px) {
+      const bool lit = px == 10 && py == 5;
+      EXPECT_EQ(pixels[static_cast<size_t>(py) * stride +
+                       static_cast<size_t>(px)],
+                lit ? 0xff10e020u : 0u)
+          << "px=" << px << " py=" << py;
+    }
+    EXPECT_EQ(pixels[static_cast<size_t>(py) * stride + 18], 0xdeadbeefu);
+  }
+}
+
+TEST(VectorscopeHistogramTest, Render_ColorizesByUvPosition) {
+  // Centre, +V (towards red) and +U (towards blue).
+  const std::vector<orc::UVSample> samples = {
+      {0.0, 0.0, 0}, {0.0, 6.0, 0}, {6.0, 0.0, 0}};
+  orc::gui::VectorscopeHistogram histogram;
+  histogram.accumulate(samples.data(), samples.size(), small_layout());
+
+  orc::gui::VectorscopeRenderStyle style;
+  style.gain = 100.0f;
+  style.colorize = true;
+  std::vector<uint32_t> pixels(16 * 16, 0);
+  histogram.render(pixels.data(), 16, style);
+
+  EXPECT_EQ(pixels[8 * 16 + 8], 0xffffffffu);  // achromatic → white
+  const uint32_t red_side = pixels[2 * 16 + 8];
+  EXPECT_EQ((red_side >> 16) & 0xff, 0xffu);
+  EXPECT_LE(red_side & 0xff, 0x80u);
+  const uint32_t blue_side = pixels[8 * 16 + 14];
+  EXPECT_EQ(blue_side & 0xff, 0xffu);
+  EXPECT_LE((blue_side >> 16) & 0xff, 0x80u);
+}
+
+}  // namespace gui_unit_test
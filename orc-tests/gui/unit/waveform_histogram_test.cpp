@@ -0,0 +1,159 @@
+/*
+ * File:        waveform_histogram_test.cpp
+ * Module:      orc-tests/gui/unit
+ * Purpose:     Unit tests for the waveform monitor histogram kernel
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "waveform_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <amplitude_conversion.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace gui_unit_test {
+
+namespace {
+
+// Raw-sample layout: bin == sample value - y_min.
+orc::gui::WaveformLayout raw_layout(int samples_per_line, int lines) {
+  orc::gui::WaveformLayout layout;
+  layout.samples_per_line = samples_per_line;
+  layout.total_lines = lines;
+  layout.active_start = 0;
+  layout.active_width = samples_per_line;
+  layout.y_min_mv = 0.0;
+  layout.y_bins = 100;
+  return layout;
+}
+
+}  // namespace
+
+TEST(WaveformHistogramTest, Accumulate_CountsEachLineSampleInItsBin) {
+  // 19 columns exercise both the vector loop and the scalar tail.
+  const int width = 19;
+  std::vector<int16_t> samples;
+  for (int line = 0; line < 3; ++line) {
+    for (int x = 0; x < width; ++x) {
+      samples.push_back(static_cast<int16_t>(x + line % 2));
+    }
+  }
+
+  orc::gui::WaveformHistogram histogram;
+  histogram.accumulate(samples.data(), samples.size(), raw_layout(width, 3),
+                       0.0f);
+  for (int x = 0; x < width; ++x) {
+    EXPECT_FLOAT_EQ(histogram.count(x, x), 2.0f) << "x=" << x;
+    EXPECT_FLOAT_EQ(histogram.count(x, x + 1), 1.0f) << "x=" << x;
+  }
+  EXPECT_FLOAT_EQ(histogram.count(0, 5), 0.0f);
+}
+
+TEST(WaveformHistogramTest, Accumulate_MatchesScalarMillivoltBinning) {
+  orc::gui::WaveformLayout layout = raw_layout(40, 1);
+  layout.active_start = 4;
+  layout.active_width = 32;
+  layout.blanking_level = 256;
+  layout.white_level = 844;
+  layout.system = orc::VideoSystem::PAL;
+  layout.y_min_mv = -350.0;
+  layout.y_bins = 1301;
+
+  std::vector<int16_t> samples(40);
+  for (size_t i = 0; i < samples.size(); ++i) {
+    samples[i] = static_cast<int16_t>(3 + i * 29);
+  }
+
+  orc::gui::WaveformHistogram histogram;
+  histogram.accumulate(samples.data(), samples.size(), layout, 0.0f);
+  for (int x = 0; x < layout.active_width; ++x) {
+    const double mv = orc::samples10_to_mv(
+        samples[static_cast<size_t>(x + layout.active_start)], 256, 844,
+        orc::VideoSystem::PAL);
+    const int bin = static_cast<int>(mv - layout.y_min_mv);
+    if (bin >= layout.y_bins) continue;
+    EXPECT_FLOAT_EQ(histogram.count(x, bin), 1.0f) << "x=" << x;
+  }
+}
+
+TEST(WaveformHistogramTest, Accumulate_DecaysHistoryAndResetsOnLayoutChange) {
+  const std::vector<int16_t> a(8, 10);
+  const std::vector<int16_t> b(8, 20);
+  orc::gui::WaveformHistogram histogram;
+
+  histogram.accumulate(a.data(), a.size(), raw_layout(8, 1), 0.75f);
+  histogram.accumulate(b.data(), b.size(), raw_layout(8, 1), 0.75f);
+  EXPECT_FLOAT_EQ(histogram.count(3, 10), 0.75f);
+  EXPECT_FLOAT_EQ(histogram.count(3, 20), 1.0f);
+
+  // 0.75^3 drops below the visible floor and is flushed.
+  histogram.accumulate(b.data(), b.size(), raw_layout(8, 1), 0.75f);
+  histogram.accumulate(b.data(), b.size(), raw_layout(8, 1), 0.75f);
+  EXPECT_FLOAT_EQ(histogram.count(3, 10), 0.0f);
+
+  // Zero decay shows the frame alone.
+  histogram.accumulate(a.data(), a.size(), raw_layout(8, 1), 0.0f);
+  EXPECT_FLOAT_EQ(histogram.count(3, 20), 0.0f);
+  EXPECT_FLOAT_EQ(histogram.count(3, 10), 1.0f);
+
+  histogram.accumulate(b.data(), b.size(), raw_layout(4, 2), 0.75f);
+  EXPECT_FLOAT_EQ(histogram.count(3, 10), 0.0f);
+  EXPECT_FLOAT_EQ(histogram.count(3, 20), 2.0f);
+}
+
+TEST(WaveformHistogramTest, Render_WritesTraceOverTransparentBackground) {
+  // A single hit in column 3, bin 45; every other sample is off the scale.
+  const int width = 8;
+  std::vector<int16_t> samples(width, 200);
+  samples[3] = 45;
+  orc::gui::WaveformLayout layout = raw_layout(width, 1);
+  layout.y_bins = 80;
+
+  orc::gui::WaveformHistogram histogram;
+  histogram.accumulate(samples.data(), samples.size(), layout, 0.0f);
+
+  orc::gui::WaveformRenderStyle style;
+  style.gain = 100.0f;  // saturate a single hit
+  style.background = 0xff000000;
+  style.trace = 0xff10e020;
+
+  // Each pixel's column and bin ranges include their upper bound, so column 3
+  // lands in px 2 and 3; bin 45 lies in row 3 (bins 40-50). The stride is
+  // padded to check that rows are addressed by it.
+  const size_t stride = 11;
+  std::vector<uint32_t> pixels(stride * 8, 0xdeadbeef);
+  histogram.render(pixels.data(), width, 8, stride, style);
+
+  for (int py = 0; py < 8; ++py) {
+    for (int px = 0; px < width; ++px) {
+      const bool lit = py == 3 && (px == 2 || px == 3);
+      EXPECT_EQ(pixels[static_cast<size_t>(py) * stride +
+                       static_cast<size_t>(px)],
+                lit ? 0xff10e020u : 0u)
+          << "px=" << px << " py=" << py;
+    }
+    EXPECT_EQ(pixels[static_cast<size_t>(py) * stride + 10], 0xdeadbeefu);
+  }
+}
+
+TEST(WaveformHistogramTest, Render_AreaMaxKeepsSparseBinsWhenDownscaling) {
+  std::vector<int16_t> samples(64, 0);
+  samples[37] = 50;  // one hit in a column and bin a 4x4 image would skip
+  orc::gui::WaveformLayout layout = raw_layout(64, 1);
+
+  orc::gui::WaveformHistogram histogram;
+  histogram.accumulate(samples.data(), samples.size(), layout, 0.0f);
+
+  std::vector<uint32_t> pixels(16, 0);
+  histogram.render(pixels.data(), 4, 4, 4, orc::gui::WaveformRenderStyle());
+  // Column 37 of 64 -> px 2; bin 50 of 100 -> row 1 from the top.
+  EXPECT_NE(pixels[1 * 4 + 2], 0u);
+  EXPECT_EQ(pixels[0 * 4 + 2], 0u);
+}
+
+}  // namespace gui_unit_test
@@ -9,10 +9,16 @@
 
 #include "command_process.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
 #include <filesystem>
 #include <iostream>
+#include <mutex>
+#include <thread>
 
 #include "logging.h"
+#include "pipeline_metrics_presenter.h"
 #include "project_presenter.h"
 
 namespace fs = std::filesystem;
@@ -87,6 +93,137 @@ void log_plugin_runtime_state(
   }
 }
 
+std::string format_bytes(double bytes) {
+  static const char* const kUnits[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+  size_t unit = 0;
+  while (bytes >= 1024.0 && unit + 1 < sizeof(kUnits) / sizeof(kUnits[0])) {
+    bytes /= 1024.0;
+    ++unit;
+  }
+  char text[32];
+  std::snprintf(text, sizeof(text), unit == 0 ? "%.0f %s" : "%.1f %s", bytes,
+                kUnits[unit]);
+  return text;
+}
+
+// While the sinks run, logs a one-line pipeline status every interval and
+// keeps the Prometheus textfile current. Totals are relative to start().
+class PipelineStatusReporter {
+ public:
+  PipelineStatusReporter(int interval_seconds, std::string metrics_path)
+      : log_status_(interval_seconds > 0),
+        interval_(interval_seconds > 0 ? interval_seconds
+                                       : kDefaultFilePeriodSeconds),
+        metrics_path_(std::move(metrics_path)) {}
+
+  ~PipelineStatusReporter() { stop(); }
+
+  void start() {
+    if (!log_status_ && metrics_path_.empty()) return;
+    baseline_ = orc::presenters::summarizePipelineMetrics(
+        orc::presenters::snapshotPipelineMetrics());
+    previous_ = baseline_;
+    previous_time_ = std::chrono::steady_clock::now();
+    thread_ = std::thread([this] { run(); });
+  }
+
+  // Stops reporting and writes the metrics file one last time.
+  void stop() {
+    if (!thread_.joinable()) return;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+    write_metrics_file();
+  }
+
+ private:
+  static constexpr int kDefaultFilePeriodSeconds = 10;
+
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!wake_.wait_for(lock, interval_, [this] { return stopping_; })) {
+      lock.unlock();
+      if (log_status_) log_status();
+      write_metrics_file();
+      lock.lock();
+    }
+  }
+
+  void log_status() {
+    const auto now = std::chrono::steady_clock::now();
+    const auto status = orc::presenters::summarizePipelineMetrics(
+        orc::presenters::snapshotPipelineMetrics());
+    const double seconds =
+        std::chrono::duration<double>(now - previous_time_).count();
+
+    const double fps =
+        seconds > 0.0
+            ? static_cast<double>(status.frames_written -
+                                  previous_.frames_written) /
+                  seconds
+            : 0.0;
+    const double read_rate =
+        seconds > 0.0
+            ? static_cast<double>(status.source_bytes_read -
+                                  previous_.source_bytes_read) /
+                  seconds
+            : 0.0;
+    const uint64_t hits = status.cache_hits - baseline_.cache_hits;
+    const uint64_t lookups =
+        hits + (status.cache_misses - baseline_.cache_misses);
+    char hit_rate[16] = "n/a";
+    if (lookups > 0) {
+      std::snprintf(hit_rate, sizeof(hit_rate), "%.1f%%",
+                    100.0 * static_cast<double>(hits) /
+                        static_cast<double>(lookups));
+    }
+
+    ORC_LOG_INFO(
+        "[Status] {} frames written ({:.1f} fps) | cache hits {} | sink queue "
+        "{} | read {} ({}/s) | RSS {}",
+        status.frames_written - baseline_.frames_written, fps,
+        std::string(hit_rate),
+        static_cast<int64_t>(status.queue_depth),
+        format_bytes(static_cast<double>(status.source_bytes_read -
+                                         baseline_.source_bytes_read)),
+        format_bytes(read_rate),
+        status.resident_bytes > 0
+            ? format_bytes(static_cast<double>(status.resident_bytes))
+            : std::string("n/a"));
+
+    previous_ = status;
+    previous_time_ = now;
+  }
+
+  void write_metrics_file() {
+    if (metrics_path_.empty()) return;
+    std::string error;
+    if (!orc::presenters::writePipelineMetricsTextfile(metrics_path_, error) &&
+        !reported_write_error_) {
+      // Once per run; the next period retries silently.
+      ORC_LOG_WARN("Failed to write metrics file: {}", error);
+      reported_write_error_ = true;
+    }
+  }
+
+  const bool log_status_;
+  const std::chrono::seconds interval_;
+  const std::string metrics_path_;
+
+  orc::presenters::PipelineStatus baseline_;
+  orc::presenters::PipelineStatus previous_;
+  std::chrono::steady_clock::time_point previous_time_;
+  bool reported_write_error_ = false;
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool stopping_ = false;  // guarded by mutex_
+  std::thread thread_;
+};
+
 }  // namespace
 
 int process_command(const ProcessOptions& options) {
@@ -135,9 +272,36 @@ int process_command(const ProcessOptions& options) {
     }
   };
 
+  if (!options.trace_path.empty()) {
+    orc::presenters::startTracing();
+  }
+
+  PipelineStatusReporter status_reporter(options.status_interval_seconds,
+                                         options.metrics_path);
+  status_reporter.start();
+
   // Trigger all sink nodes using presenter
   bool all_success = presenter.triggerAllSinks(progress_callback);
 
+  status_reporter.stop();
+
+  // A trace of a failed run is still useful, so it is written either way.
+  if (!options.trace_path.empty()) {
+    orc::presenters::TraceSummary summary;
+    std::string error;
+    if (!orc::presenters::stopTracing(options.trace_path, summary, error)) {
+      ORC_LOG_ERROR("Failed to write trace: {}", error);
+      return 1;
+    }
+    ORC_LOG_INFO("Trace written to {} ({} spans from {} threads)",
+                 options.trace_path, summary.spans, summary.threads);
+    if (summary.dropped > 0) {
+      ORC_LOG_WARN(
+          "Trace buffers overflowed: the oldest {} spans were dropped",
+          summary.dropped);
+    }
+  }
+
   if (all_success) {
     return 0;
   } else {
@@ -22,6 +22,9 @@ namespace cli {
  */
 struct ProcessOptions {
   std::string project_path;  ///< Path to the .orcprj project file
+  std::string trace_path;    ///< Chrome trace output file; empty = no trace
+  std::string metrics_path;  ///< Prometheus textfile; empty = not written
+  int status_interval_seconds = 10;  ///< Status line period; 0 = disabled
 };
 
 /**
@@ -29,7 +32,10 @@ struct ProcessOptions {
  *
  * Loads the specified project file, converts it to a DAG, and triggers all
  * sink nodes to process the complete pipeline. This is the main execution
- * path for batch processing.
+ * path for batch processing. With a trace path set, the run is traced and
+ * the spans are written there in Chrome trace format. While the sinks run, a
+ * one-line pipeline status is logged periodically and, with a metrics path
+ * set, the live metrics are kept written there in Prometheus text format.
  *
  * @param options Configuration options including project path
  * @return Exit code (0 = success, non-zero = error)
@@ -66,6 +66,18 @@ void print_usage(const char* program_name) {
   std::cerr << "                                 Default: info\n";
   std::cerr
       << "  --log-file FILE                Write logs to specified file\n";
+  std::cerr << "  --trace FILE                   With --process, write a "
+               "Chrome/Perfetto trace\n";
+  std::cerr << "                                 of per-stage timings to "
+               "FILE\n";
+  std::cerr << "  --status-interval SECONDS      With --process, log a "
+               "one-line pipeline status\n";
+  std::cerr << "                                 every SECONDS (0 disables). "
+               "Default: 10\n";
+  std::cerr << "  --metrics-file FILE            With --process, keep FILE "
+               "updated with pipeline\n";
+  std::cerr << "                                 metrics in Prometheus text "
+               "format\n";
   std::cerr << "  --safe-core-plugins            Clear plugin registry and "
                "ignore ORC_STAGE_PLUGIN_PATHS\n";
   std::cerr
@@ -75,6 +87,10 @@ void print_usage(const char* program_name) {
   std::cerr << "  " << program_name << " project.orcprj --process\n";
   std::cerr << "  " << program_name
             << " project.orcprj --process --log-level debug\n";
+  std::cerr << "  " << program_name
+            << " project.orcprj --process --trace trace.json\n";
+  std::cerr << "  " << program_name
+            << " project.orcprj --process --metrics-file orc.prom\n";
   std::cerr << "  " << program_name << " plugins list\n";
   std::cerr << "  " << program_name
             << " plugins add /path/to/libmyplugin.so --id com.example.my "
@@ -98,6 +114,10 @@ int main(int argc, char* argv[]) {
     std::string project_path;
     std::string log_level = "info";
     std::string log_file;
+    std::string trace_file;
+    std::string metrics_file;
+    int status_interval_seconds = 10;
+    bool status_interval_given = false;
     bool safe_core_plugins = false;
 
     // Command flags
@@ -175,6 +195,29 @@ int main(int argc, char* argv[]) {
         log_level = argv[++i];
       } else if (arg == "--log-file" && i + 1 < argc) {
         log_file = argv[++i];
+      } else if (arg == "--trace" && i + 1 < argc) {
+        trace_file = argv[++i];
+      } else if (arg == "--metrics-file" && i + 1 < argc) {
+        metrics_file = argv[++i];
+      } else if (arg == "--status-interval" && i + 1 < argc) {
+        const std::string value = argv[++i];
+        size_t parsed = 0;
+        try {
+          status_interval_seconds = std::stoi(value, &parsed);
+        } catch (const std::exception&) {
+          parsed = 0;
+        }
+        if (parsed != value.size() || status_interval_seconds < 0) {
+          std::cerr << "Error: Invalid --status-interval: " << value << "\n";
+          return 1;
+        }
+        status_interval_given = true;
+      } else if (arg == "--log-level" || arg == "--log-file" ||
+                 arg == "--trace" || arg == "--metrics-file" ||
+                 arg == "--status-interval") {
+        std::cerr << "Error: " << arg << " requires a value\n\n";
+        print_usage(argv[0]);
+        return 1;
       } else if (arg == "--safe-core-plugins") {
         // Handled before dispatch.
       } else if (arg == "--process") {
@@ -202,6 +245,19 @@ int main(int argc, char* argv[]) {
       return 1;
     }
 
+    // Options that only affect --process are rejected rather than ignored.
+    if (!do_process) {
+      const char* process_only = !trace_file.empty()     ? "--trace"
+                                 : !metrics_file.empty() ? "--metrics-file"
+                                 : status_interval_given ? "--status-interval"
+                                                         : nullptr;
+      if (process_only) {
+        std::cerr << "Error: " << process_only << " requires --process\n\n";
+        print_usage(argv[0]);
+        return 1;
+      }
+    }
+
     // Check if at least one command was specified
     if (!do_process) {
       std::cerr << "Error: No command specified. You must use --process\n\n";
@@ -248,6 +304,9 @@ int main(int argc, char* argv[]) {
     try {
       cli::ProcessOptions options;
       options.project_path = project_path;
+      options.trace_path = trace_file;
+      options.metrics_path = metrics_file;
+      options.status_interval_seconds = status_interval_seconds;
 
       exit_code = cli::process_command(options);
     } catch (const UserDataError& e) {
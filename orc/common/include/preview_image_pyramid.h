@@ -0,0 +1,164 @@
+/*
+ * File:        preview_image_pyramid.h
+ * Module:      orc-common
+ * Purpose:     Tiled mip pyramid over an RGB888 preview image for
+ *              viewport-sized zoom, pan and aspect-ratio resampling
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#pragma once
+
+#include <orc/stage/preview/orc_rendering.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace orc {
+
+/**
+ * @brief Region of a preview image presented in an output buffer.
+ *
+ * The source rectangle is in full-resolution image pixels (samples x lines)
+ * and may be fractional or extend past the image; output pixels whose centre
+ * falls outside the image are left untouched. Aspect-ratio correction is
+ * expressed by the ratio of the horizontal and vertical scales, zoom by their
+ * magnitude and pan by the source origin.
+ */
+struct PreviewViewport {
+  double source_x = 0.0;
+  double source_y = 0.0;
+  double source_width = 0.0;
+  double source_height = 0.0;
+  uint32_t output_width = 0;
+  uint32_t output_height = 0;
+
+  /// Viewport showing a whole width x height image in an output of
+  /// round(width * aspect_correction) x height pixels.
+  static PreviewViewport whole_image(uint32_t width, uint32_t height,
+                                     double aspect_correction = 1.0);
+};
+
+/// Resampling filter of resample_rgb888().
+enum class PreviewFilter {
+  Nearest,   ///< Source pixel under each output pixel centre
+  Bilinear,  ///< Weighted mean of the four nearest source pixel centres
+};
+
+/// Half-open pixel rectangle of one tile within a pyramid level.
+struct PreviewTileRect {
+  uint32_t x = 0;
+  uint32_t y = 0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+};
+
+/**
+ * @brief Resample an RGB888 image region.
+ *
+ * Output pixel (ox, oy) is sampled at its centre's source position. Source
+ * columns and filter weights are looked up once per call, so the per-pixel
+ * cost is a 3-byte copy (nearest) or four fixed-point taps (bilinear).
+ * Writes only the output pixels whose centre lies on the image.
+ *
+ * @param rgb Source pixels, width * 3 bytes per row
+ * @param width Source width in pixels
+ * @param height Source height in pixels
+ * @param view Source region and output size (coordinates in source pixels)
+ * @param out Output buffer of view.output_height rows
+ * @param out_stride Bytes per output row (at least view.output_width * 3)
+ * @param filter Resampling filter
+ */
+void resample_rgb888(const uint8_t* rgb, uint32_t width, uint32_t height,
+                     const PreviewViewport& view, uint8_t* out,
+                     size_t out_stride,
+                     PreviewFilter filter = PreviewFilter::Nearest);
+
+/**
+ * @brief Mip-mapped, tiled view of one rendered preview image.
+ *
+ * Built once per rendered frame: level 0 is the preview image itself and
+ * each further level halves both dimensions with a 2x2 box filter (SSE2 where
+ * available), down to a single tile. Dropout regions are split into per-tile
+ * segments of the level-0 tile grid at build time.
+ *
+ * render() picks the coarsest level that still has at least one source pixel
+ * per output pixel along the less-minified axis, then bilinearly resamples
+ * only the viewport's region of that level and paints the dropout segments
+ * of the tiles it covers. Zoom, pan and aspect-ratio changes therefore cost
+ * time proportional to the output size, not the frame; callers keep the
+ * output buffer viewport-sized.
+ *
+ * Thread safety: const members may be called concurrently.
+ */
+class PreviewImagePyramid {
+ public:
+  /// Edge length of a square tile, in pixels of its level.
+  static constexpr uint32_t kTileSize = 128;
+
+  struct Level {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<uint8_t> rgb_data;  ///< RGB888, width * 3 bytes per row
+  };
+
+  PreviewImagePyramid() = default;
+
+  /// Builds the pyramid, taking ownership of the image's pixel data.
+  explicit PreviewImagePyramid(PreviewImage image);
+
+  bool empty() const { return levels_.empty(); }
+  uint32_t width() const { return empty() ? 0 : levels_.front().width; }
+  uint32_t height() const { return empty() ? 0 : levels_.front().height; }
+
+  size_t level_count() const { return levels_.size(); }
+  const Level& level(size_t index) const { return levels_[index]; }
+
+  /// Dropout regions of the source image, in level-0 coordinates.
+  const std::vector<DropoutRegion>& dropout_regions() const {
+    return dropout_regions_;
+  }
+
+  /// Level render() samples for the given viewport.
+  size_t level_for(const PreviewViewport& view) const;
+
+  /// Tiles of level |level_index| that the viewport's source region covers.
+  std::vector<PreviewTileRect> visible_tiles(const PreviewViewport& view,
+                                             size_t level_index) const;
+
+  /**
+   * @brief Resample the viewport into an RGB888 output buffer.
+   *
+   * Output pixels outside the image are left untouched, so callers clear the
+   * buffer to their background first.
+   *
+   * @param view Source region and output size
+   * @param out Output buffer of view.output_height rows
+   * @param out_stride Bytes per output row
+   * @param show_dropouts Paint dropout segments of the visible tiles in red
+   */
+  void render(const PreviewViewport& view, uint8_t* out, size_t out_stride,
+              bool show_dropouts) const;
+
+ private:
+  // A dropout region clipped to one level-0 tile.
+  struct DropoutSegment {
+    uint32_t line;
+    uint32_t start_sample;
+    uint32_t end_sample;
+  };
+
+  void bucket_dropouts();
+  void paint_dropouts(const PreviewViewport& view, uint8_t* out,
+                      size_t out_stride) const;
+
+  std::vector<Level> levels_;
+  std::vector<DropoutRegion> dropout_regions_;
+  uint32_t tile_columns_ = 0;
+  // Level-0 tiles in row-major order.
+  std::vector<std::vector<DropoutSegment>> tile_dropouts_;
+};
+
+}  // namespace orc
@@ -0,0 +1,379 @@
+/*
+ * File:        preview_image_pyramid.cpp
+ * Module:      orc-common
+ * Purpose:     Tiled mip pyramid over an RGB888 preview image for
+ *              viewport-sized zoom, pan and aspect-ratio resampling
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "preview_image_pyramid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ORC_PREVIEW_PYRAMID_SSE2 1
+#endif
+
+namespace orc {
+
+namespace {
+
+// out[i] = rounded mean of a[i], a[i + 3], b[i] and b[i + 3] for i < count:
+// the 2x2 box filter of two RGB888 rows before every other pixel is dropped.
+// Reads count + 3 bytes of each row.
+void box_filter_rows(const uint8_t* a, const uint8_t* b, uint8_t* out,
+                     size_t count) {
+  size_t i = 0;
+#if defined(ORC_PREVIEW_PYRAMID_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i two = _mm_set1_epi16(2);
+  for (; i + 16 <= count; i += 16) {
+    const __m128i a0 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    const __m128i a1 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 3));
+    const __m128i b0 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    const __m128i b1 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + 3));
+
+    __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero),
+                               _mm_unpacklo_epi8(a1, zero));
+    lo = _mm_add_epi16(lo, _mm_unpacklo_epi8(b0, zero));
+    lo = _mm_add_epi16(lo, _mm_unpacklo_epi8(b1, zero));
+    lo = _mm_srli_epi16(_mm_add_epi16(lo, two), 2);
+
+    __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero),
+                               _mm_unpackhi_epi8(a1, zero));
+    hi = _mm_add_epi16(hi, _mm_unpackhi_epi8(b0, zero));
+    hi = _mm_add_epi16(hi, _mm_unpackhi_epi8(b1, zero));
+    hi = _mm_srli_epi16(_mm_add_epi16(hi, two), 2);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                     _mm_packus_epi16(lo, hi));
+  }
+#endif
+  for (; i < count; ++i) {
+    out[i] =
+        static_cast<uint8_t>((a[i] + a[i + 3] + b[i] + b[i + 3] + 2) >> 2);
+  }
+}
+
+PreviewImagePyramid::Level downsample(const PreviewImagePyramid::Level& src) {
+  PreviewImagePyramid::Level dst;
+  dst.width = src.width / 2;
+  dst.height = src.height / 2;
+  dst.rgb_data.resize(static_cast<size_t>(dst.width) * dst.height * 3);
+
+  const size_t src_stride = static_cast<size_t>(src.width) * 3;
+  const size_t dst_stride = static_cast<size_t>(dst.width) * 3;
+  // Filtered values at every source byte of the row pair; pixel x of the
+  // destination row is the three bytes at 6 * x.
+  const size_t filtered_count = dst_stride * 2 - 3;
+  std::vector<uint8_t> filtered(dst_stride * 2);
+
+  for (uint32_t y = 0; y < dst.height; ++y) {
+    const uint8_t* row0 = src.rgb_data.data() + 2 * y * src_stride;
+    box_filter_rows(row0, row0 + src_stride, filtered.data(), filtered_count);
+
+    uint8_t* out = dst.rgb_data.data() + y * dst_stride;
+    for (uint32_t x = 0; x < dst.width; ++x) {
+      std::memcpy(out + x * 3, filtered.data() + x * 6, 3);
+    }
+  }
+  return dst;
+}
+
+// Output range [begin, end) whose pixel centres map into [0, limit) for an
+// axis starting at |origin| with |step| source pixels per output pixel.
+std::pair<uint32_t, uint32_t> covered_outputs(double origin, double step,
+                                              uint32_t limit,
+                                              uint32_t outputs) {
+  const double first = std::ceil((0.0 - origin) / step - 0.5);
+  const double last = std::ceil((limit - origin) / step - 0.5);
+  const auto clamp_output = [outputs](double value) {
+    return static_cast<uint32_t>(
+        std::clamp(value, 0.0, static_cast<double>(outputs)));
+  };
+  return {clamp_output(first), clamp_output(last)};
+}
+
+}  // namespace
+
+PreviewViewport PreviewViewport::whole_image(uint32_t width, uint32_t height,
+                                             double aspect_correction) {
+  if (aspect_correction <= 0.0) {
+    aspect_correction = 1.0;
+  }
+  PreviewViewport view;
+  view.source_width = width;
+  view.source_height = height;
+  view.output_width = std::max<uint32_t>(
+      1, static_cast<uint32_t>(std::lround(width * aspect_correction)));
+  view.output_height = height;
+  return view;
+}
+
+void resample_rgb888(const uint8_t* rgb, uint32_t width, uint32_t height,
+                     const PreviewViewport& view, uint8_t* out,
+                     size_t out_stride, PreviewFilter filter) {
+  if (!rgb || !out || width == 0 || height == 0 || view.output_width == 0 ||
+      view.output_height == 0 || !(view.source_width > 0.0) ||
+      !(view.source_height > 0.0)) {
+    return;
+  }
+
+  const double step_x = view.source_width / view.output_width;
+  const double step_y = view.source_height / view.output_height;
+  const auto [x_begin, x_end] =
+      covered_outputs(view.source_x, step_x, width, view.output_width);
+  const auto [y_begin, y_end] =
+      covered_outputs(view.source_y, step_y, height, view.output_height);
+  if (x_begin >= x_end || y_begin >= y_end) {
+    return;
+  }
+
+  // Taps and 8-bit weights of each covered output column and row, looked up
+  // once. Nearest sampling is the bilinear case with all weight on the first
+  // tap, which is the pixel under the output pixel centre.
+  struct Tap {
+    uint32_t first;
+    uint32_t second;
+    uint32_t weight;  // of |second|, 0-256
+  };
+  const bool bilinear = filter == PreviewFilter::Bilinear;
+  const auto tap = [bilinear](double pos, uint32_t limit) {
+    if (!bilinear) {
+      const uint32_t index = std::min(static_cast<uint32_t>(pos), limit - 1);
+      return Tap{index, index, 0};
+    }
+    const double centre =
+        std::clamp(pos - 0.5, 0.0, static_cast<double>(limit - 1));
+    const uint32_t index = static_cast<uint32_t>(centre);
+    return Tap{index, std::min(index + 1, limit - 1),
+               static_cast<uint32_t>(std::lround((centre - index) * 256.0))};
+  };
+
+  std::vector<Tap> columns(x_end - x_begin);
+  for (uint32_t ox = x_begin; ox < x_end; ++ox) {
+    Tap column = tap(view.source_x + (ox + 0.5) * step_x, width);
+    column.first *= 3;
+    column.second *= 3;
+    columns[ox - x_begin] = column;
+  }
+
+  const size_t src_stride = static_cast<size_t>(width) * 3;
+  const size_t row_bytes = columns.size() * 3;
+  Tap previous_row_tap{height, height, 0};
+  const uint8_t* previous_row = nullptr;
+  for (uint32_t oy = y_begin; oy < y_end; ++oy) {
+    const Tap row = tap(view.source_y + (oy + 0.5) * step_y, height);
+    uint8_t* dst = out + oy * out_stride + x_begin * 3;
+
+    // When magnifying, consecutive output rows repeat the same taps.
+    if (row.first == previous_row_tap.first &&
+        row.weight == previous_row_tap.weight) {
+      std::memcpy(dst, previous_row, row_bytes);
+      continue;
+    }
+    previous_row_tap = row;
+    previous_row = dst;
+
+    const uint8_t* top = rgb + row.first * src_stride;
+    if (!bilinear) {
+      for (size_t i = 0; i < columns.size(); ++i) {
+        std::memcpy(dst + i * 3, top + columns[i].first, 3);
+      }
+      continue;
+    }
+
+    const uint8_t* bottom = rgb + row.second * src_stride;
+    const uint32_t wy = row.weight;
+    for (size_t i = 0; i < columns.size(); ++i) {
+      const Tap& column = columns[i];
+      const uint32_t wx = column.weight;
+      for (size_t c = 0; c < 3; ++c) {
+        const uint32_t upper = top[column.first + c] * (256 - wx) +
+                               top[column.second + c] * wx;
+        const uint32_t lower = bottom[column.first + c] * (256 - wx) +
+                               bottom[column.second + c] * wx;
+        dst[i * 3 + c] = static_cast<uint8_t>(
+            (upper * (256 - wy) + lower * wy + 32768) >> 16);
+      }
+    }
+  }
+}
+
+PreviewImagePyramid::PreviewImagePyramid(PreviewImage image) {
+  if (!image.is_valid()) {
+    return;
+  }
+
+  Level base;
+  base.width = image.width;
+  base.height = image.height;
+  base.rgb_data = std::move(image.rgb_data);
+  levels_.push_back(std::move(base));
+  while (std::max(levels_.back().width, levels_.back().height) > kTileSize &&
+         levels_.back().width >= 2 && levels_.back().height >= 2) {
+    levels_.push_back(downsample(levels_.back()));
+  }
+
+  dropout_regions_ = std::move(image.dropout_regions);
+  bucket_dropouts();
+}
+
+size_t PreviewImagePyramid::level_for(const PreviewViewport& view) const {
+  if (empty() || view.output_width == 0 || view.output_height == 0) {
+    return 0;
+  }
+  // Sample the less-minified axis at no less than one source pixel per output
+  // pixel, so aspect correction never costs horizontal detail.
+  double step = std::min(view.source_width / view.output_width,
+                         view.source_height / view.output_height);
+  size_t index = 0;
+  while (index + 1 < levels_.size() && step >= 2.0) {
+    step /= 2.0;
+    ++index;
+  }
+  return index;
+}
+
+std::vector<PreviewTileRect> PreviewImagePyramid::visible_tiles(
+    const PreviewViewport& view, size_t level_index) const {
+  std::vector<PreviewTileRect> tiles;
+  if (level_index >= levels_.size()) {
+    return tiles;
+  }
+
+  const Level& lv = levels_[level_index];
+  const double scale_x = static_cast<double>(width()) / lv.width;
+  const double scale_y = static_cast<double>(height()) / lv.height;
+  const auto span = [](double begin, double end, uint32_t limit) {
+    const double bound = static_cast<double>(limit);
+    const double lo = std::clamp(std::floor(begin), 0.0, bound);
+    const double hi = std::clamp(std::ceil(end), 0.0, bound);
+    return std::pair<uint32_t, uint32_t>(static_cast<uint32_t>(lo),
+                                         static_cast<uint32_t>(hi));
+  };
+  const auto [x0, x1] = span(view.source_x / scale_x,
+                             (view.source_x + view.source_width) / scale_x,
+                             lv.width);
+  const auto [y0, y1] = span(view.source_y / scale_y,
+                             (view.source_y + view.source_height) / scale_y,
+                             lv.height);
+  if (x0 >= x1 || y0 >= y1) {
+    return tiles;
+  }
+
+  for (uint32_t ty = y0 / kTileSize; ty <= (y1 - 1) / kTileSize; ++ty) {
+    for (uint32_t tx = x0 / kTileSize; tx <= (x1 - 1) / kTileSize; ++tx) {
+      PreviewTileRect tile;
+      tile.x = tx * kTileSize;
+      tile.y = ty * kTileSize;
+      tile.width = std::min(kTileSize, lv.width - tile.x);
+      tile.height = std::min(kTileSize, lv.height - tile.y);
+      tiles.push_back(tile);
+    }
+  }
+  return tiles;
+}
+
+void PreviewImagePyramid::render(const PreviewViewport& view, uint8_t* out,
+                                 size_t out_stride, bool show_dropouts) const {
+  if (empty()) {
+    return;
+  }
+
+  // Level dimensions are rounded down, so map through the exact per-axis
+  // ratio rather than a power of two to keep the image edges aligned.
+  const Level& lv = levels_[level_for(view)];
+  const double scale_x = static_cast<double>(width()) / lv.width;
+  const double scale_y = static_cast<double>(height()) / lv.height;
+  PreviewViewport level_view = view;
+  level_view.source_x = view.source_x / scale_x;
+  level_view.source_y = view.source_y / scale_y;
+  level_view.source_width = view.source_width / scale_x;
+  level_view.source_height = view.source_height / scale_y;
+  resample_rgb888(lv.rgb_data.data(), lv.width, lv.height, level_view, out,
+                  out_stride, PreviewFilter::Bilinear);
+
+  if (show_dropouts) {
+    paint_dropouts(view, out, out_stride);
+  }
+}
+
+void PreviewImagePyramid::bucket_dropouts() {
+  const Level& base = levels_.front();
+  tile_columns_ = (base.width + kTileSize - 1) / kTileSize;
+  const uint32_t tile_rows = (base.height + kTileSize - 1) / kTileSize;
+  tile_dropouts_.assign(static_cast<size_t>(tile_columns_) * tile_rows, {});
+
+  for (const DropoutRegion& region : dropout_regions_) {
+    const uint32_t end = std::min(region.end_sample, base.width);
+    if (region.line >= base.height || region.start_sample >= end) {
+      continue;
+    }
+    const uint32_t tile_row = region.line / kTileSize;
+    for (uint32_t tx = region.start_sample / kTileSize;
+         tx <= (end - 1) / kTileSize; ++tx) {
+      const uint32_t tile_start = tx * kTileSize;
+      tile_dropouts_[tile_row * tile_columns_ + tx].push_back(
+          {region.line, std::max(region.start_sample, tile_start),
+           std::min(end, tile_start + kTileSize)});
+    }
+  }
+}
+
+void PreviewImagePyramid::paint_dropouts(const PreviewViewport& view,
+                                         uint8_t* out,
+                                         size_t out_stride) const {
+  const double step_x = view.source_width / view.output_width;
+  const double step_y = view.source_height / view.output_height;
+  // A 1-4 pixel band centred on the line, as the preview has always drawn it.
+  const int64_t thickness =
+      std::clamp<int64_t>(view.output_height / 200, 1, 4);
+  const auto clamp_to = [](double value, uint32_t limit) {
+    return static_cast<uint32_t>(
+        std::clamp(value, 0.0, static_cast<double>(limit)));
+  };
+
+  for (const PreviewTileRect& tile : visible_tiles(view, 0)) {
+    const size_t index = static_cast<size_t>(tile.y / kTileSize) *
+                             tile_columns_ +
+                         tile.x / kTileSize;
+    for (const DropoutSegment& segment : tile_dropouts_[index]) {
+      const double centre = (segment.line + 0.5 - view.source_y) / step_y;
+      const double top = std::floor(centre - thickness / 2.0 + 0.5);
+      const uint32_t y0 = clamp_to(top, view.output_height);
+      const uint32_t y1 = clamp_to(top + thickness, view.output_height);
+      const double left = std::round((segment.start_sample - view.source_x) /
+                                     step_x);
+      const double right =
+          std::round((segment.end_sample - view.source_x) / step_x);
+      if (right <= 0.0 || left >= view.output_width) {
+        continue;
+      }
+      // Keep short dropouts visible when minified.
+      const uint32_t x0 = clamp_to(left, view.output_width - 1);
+      const uint32_t x1 =
+          std::max(x0 + 1, clamp_to(right, view.output_width));
+      for (uint32_t y = y0; y < y1; ++y) {
+        uint8_t* row = out + y * out_stride;
+        for (uint32_t x = x0; x < x1; ++x) {
+          row[x * 3 + 0] = 255;
+          row[x * 3 + 1] = 0;
+          row[x * 3 + 2] = 0;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace orc
@@ -11,6 +11,7 @@
 
 #include <memory>
 
+#include "colour_statistics/colour_statistics_analysis.h"
 #include "disc_mapper/disc_mapper_analysis.h"
 #include "dropout/dropout_editor_tool.h"
 #include "ffmpeg_preset/ffmpeg_preset_analysis.h"
@@ -32,6 +33,7 @@ void force_link_SourceAlignmentAnalysisTool();
 void force_link_MaskLineAnalysisTool();
 void force_link_DropoutEditorTool();
 void force_link_VectorscopeAnalysisTool();
+void force_link_ColourStatisticsAnalysisTool();
 
 /**
  * @brief Force linking of all analysis tool object files
@@ -46,7 +48,7 @@ void force_analysis_tool_linking() {
   ORC_LOG_DEBUG(
       "Forcing link of analysis tools: FFmpeg preset, frame corruption, disc "
       "mapper, frame map range, source alignment, mask line, dropout editor, "
-      "vectorscope");
+      "vectorscope, colour statistics");
   force_link_FFmpegPresetAnalysisTool();
   force_link_FrameCorruptionAnalysisTool();
   force_link_DiscMapperAnalysisTool();
@@ -55,6 +57,7 @@ void force_analysis_tool_linking() {
   force_link_MaskLineAnalysisTool();
   force_link_DropoutEditorTool();
   force_link_VectorscopeAnalysisTool();
+  force_link_ColourStatisticsAnalysisTool();
 }
 
 }  // namespace orc
@@ -0,0 +1,276 @@
+/*
+ * File:        colour_statistics_analysis.cpp
+ * Module:      analysis
+ * Purpose:     Whole-recording vectorscope and luma statistics tool
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "colour_statistics_analysis.h"
+
+#include <orc/stage/preview/colour_decode_session.h>
+#include <orc/support/logging.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "../../include/dag_executor.h"
+#include "../analysis_registry.h"
+#include "colour_statistics_pass.h"
+
+namespace orc {
+
+// Force linker to include this object file (for static registration)
+void force_link_ColourStatisticsAnalysisTool() {}
+
+// Register the tool
+REGISTER_ANALYSIS_TOOL(ColourStatisticsAnalysisTool)
+
+namespace {
+
+int32_t int_parameter(const AnalysisContext& ctx, const std::string& name,
+                      int32_t fallback) {
+  auto it = ctx.parameters.find(name);
+  if (it != ctx.parameters.end() &&
+      std::holds_alternative<int32_t>(it->second)) {
+    return std::get<int32_t>(it->second);
+  }
+  return fallback;
+}
+
+}  // namespace
+
+std::string ColourStatisticsAnalysisTool::id() const {
+  return "colour_statistics";
+}
+
+std::string ColourStatisticsAnalysisTool::name() const {
+  return "Colour Statistics";
+}
+
+std::string ColourStatisticsAnalysisTool::description() const {
+  return "Decode a range of frames with the configured chroma decoder and "
+         "accumulate a vectorscope density map and luma histogram over all of "
+         "them, to check chroma gain and phase before exporting.";
+}
+
+std::string ColourStatisticsAnalysisTool::category() const {
+  return "Visualization";
+}
+
+std::vector<ParameterDescriptor> ColourStatisticsAnalysisTool::parameters()
+    const {
+  std::vector<ParameterDescriptor> params;
+
+  ParameterDescriptor stride;
+  stride.name = "frameStride";
+  stride.display_name = "Frame Stride";
+  stride.description =
+      "Decode every Nth frame (1 = every frame). Larger strides give a quick "
+      "overview of a whole disc.";
+  stride.type = ParameterType::INT32;
+  stride.constraints.min_value = int32_t{1};
+  stride.constraints.max_value = int32_t{10000};
+  stride.constraints.default_value = int32_t{25};
+  params.push_back(stride);
+
+  ParameterDescriptor start;
+  start.name = "startFrame";
+  start.display_name = "Start Frame";
+  start.description = "First frame to decode (0-based).";
+  start.type = ParameterType::INT32;
+  start.constraints.min_value = int32_t{0};
+  start.constraints.default_value = int32_t{0};
+  params.push_back(start);
+
+  ParameterDescriptor count;
+  count.name = "frameCount";
+  count.display_name = "Frame Count";
+  count.description =
+      "Frames to cover from the start frame, before the stride is applied "
+      "(0 = to the end of the recording).";
+  count.type = ParameterType::INT32;
+  count.constraints.min_value = int32_t{0};
+  count.constraints.default_value = int32_t{0};
+  params.push_back(count);
+
+  ParameterDescriptor threads;
+  threads.name = "threads";
+  threads.display_name = "Threads";
+  threads.description = "Decoder threads (0 = one per CPU core).";
+  threads.type = ParameterType::INT32;
+  threads.constraints.min_value = int32_t{0};
+  threads.constraints.max_value = int32_t{64};
+  threads.constraints.default_value = int32_t{0};
+  params.push_back(threads);
+
+  return params;
+}
+
+bool ColourStatisticsAnalysisTool::canAnalyze(
+    AnalysisSourceType source_type) const {
+  (void)source_type;
+  return true;
+}
+
+bool ColourStatisticsAnalysisTool::isApplicableToStage(
+    const std::string& stage_name) const {
+  return stage_name == "video_sink";
+}
+
+AnalysisResult ColourStatisticsAnalysisTool::analyze(
+    const AnalysisContext& ctx, AnalysisProgress* progress) {
+  AnalysisResult result;
+  result.status = AnalysisResult::Failed;
+
+  if (progress) {
+    progress->setStatus("Preparing colour statistics...");
+    progress->setProgress(0);
+  }
+
+  if (!ctx.dag) {
+    result.summary = "No DAG provided for analysis";
+    ORC_LOG_ERROR("{}", result.summary);
+    return result;
+  }
+
+  const auto& dag_nodes = ctx.dag->nodes();
+  auto node_it = std::find_if(
+      dag_nodes.begin(), dag_nodes.end(),
+      [&ctx](const DAGNode& node) { return node.node_id == ctx.node_id; });
+  if (node_it == dag_nodes.end() || !node_it->stage) {
+    result.summary = "Node not found in DAG";
+    ORC_LOG_ERROR("Node '{}' not found in DAG", ctx.node_id);
+    return result;
+  }
+
+  const auto* provider =
+      dynamic_cast<const IColourDecodeSessionProvider*>(node_it->stage.get());
+  if (!provider) {
+    result.summary = "Stage cannot decode colour frames for analysis";
+    ORC_LOG_ERROR("Node '{}': {}", ctx.node_id, result.summary);
+    return result;
+  }
+
+  // Executing up to the sink hands it its input, which the decode sessions
+  // read; a fresh executor has no artifact cache, so execute() always runs.
+  try {
+    DAGExecutor executor;
+    executor.execute_to_node(*ctx.dag, ctx.node_id);
+  } catch (const std::exception& e) {
+    result.summary = std::string("Failed to execute DAG: ") + e.what();
+    ORC_LOG_ERROR("Node '{}': {}", ctx.node_id, result.summary);
+    return result;
+  }
+
+  colour_statistics::FrameSelection selection;
+  selection.stride =
+      static_cast<uint64_t>(std::max(1, int_parameter(ctx, "frameStride", 25)));
+  selection.first_frame =
+      static_cast<uint64_t>(std::max(0, int_parameter(ctx, "startFrame", 0)));
+  selection.frame_count =
+      static_cast<uint64_t>(std::max(0, int_parameter(ctx, "frameCount", 0)));
+  selection.max_threads =
+      static_cast<size_t>(std::max(0, int_parameter(ctx, "threads", 0)));
+
+  auto* statistics_progress = dynamic_cast<ColourStatisticsProgress*>(progress);
+
+  if (progress) {
+    progress->setStatus("Decoding frames...");
+  }
+  auto data = colour_statistics::collect(
+      *provider, selection,
+      [progress] { return progress && progress->isCancelled(); },
+      [progress](uint64_t done, uint64_t total) {
+        if (!progress || total == 0) return;
+        progress->setProgress(static_cast<int>(done * 100 / total));
+        progress->setSubStatus(std::to_string(done) + " / " +
+                               std::to_string(total) + " frames");
+      },
+      [statistics_progress](const ColourStatisticsData& partial) {
+        if (statistics_progress) {
+          statistics_progress->reportColourStatistics(partial);
+        }
+      });
+
+  if (progress && progress->isCancelled()) {
+    result.status = AnalysisResult::Cancelled;
+    result.summary = "Colour statistics cancelled.";
+    return result;
+  }
+  if (!data) {
+    result.summary = "Could not decode frames for colour statistics.";
+    return result;
+  }
+  if (data->frames_decoded == 0) {
+    result.summary = "No frames were decoded in the selected range.";
+    return result;
+  }
+
+  if (statistics_progress) {
+    statistics_progress->reportColourStatistics(*data);
+  }
+
+  const auto summary = colour_statistics::summarise(*data);
+  result.statistics["framesDecoded"] =
+      static_cast<long long>(data->frames_decoded);
+  result.statistics["framesFailed"] =
+      static_cast<long long>(data->frames_failed);
+  result.statistics["samples"] = static_cast<long long>(data->sample_count);
+  result.statistics["meanSaturation"] = summary.mean_saturation;
+  result.statistics["saturationP99"] = summary.saturation_p99;
+  result.statistics["lumaP1"] = summary.y_p1;
+  result.statistics["lumaMedian"] = summary.y_median;
+  result.statistics["lumaP99"] = summary.y_p99;
+  result.statistics["lumaBelowBlack"] = summary.y_below_black;
+  result.statistics["lumaAboveWhite"] = summary.y_above_white;
+
+  std::ostringstream text;
+  text << std::fixed << std::setprecision(1);
+  text << "Decoded " << data->frames_decoded << " of " << data->frames_total
+       << " frames (stride " << selection.stride << ")";
+  if (data->frames_failed > 0) {
+    text << ", " << data->frames_failed << " failed";
+  }
+  text << ".\n\n";
+  text << "Saturation (% of the active-video swing):\n";
+  text << "  Mean: " << summary.mean_saturation << "%\n";
+  text << "  99th percentile: " << summary.saturation_p99 << "%\n\n";
+  text << "Luma (% of black to white):\n";
+  text << "  1st percentile: " << summary.y_p1 << "%\n";
+  text << "  Median: " << summary.y_median << "%\n";
+  text << "  99th percentile: " << summary.y_p99 << "%\n";
+  text << "  Below black: " << summary.y_below_black << "% of samples\n";
+  text << "  Above white: " << summary.y_above_white << "% of samples\n";
+  result.summary = text.str();
+  result.status = AnalysisResult::Success;
+
+  if (progress) {
+    progress->setStatus("Analysis complete");
+    progress->setProgress(100);
+  }
+
+  return result;
+}
+
+bool ColourStatisticsAnalysisTool::canApplyToGraph() const { return false; }
+
+bool ColourStatisticsAnalysisTool::applyToGraph(AnalysisResult& result,
+                                                const Project& project,
+                                                NodeID node_id) {
+  (void)result;
+  (void)project;
+  (void)node_id;
+
+  // Statistics only; the user adjusts the decoder settings.
+  return false;
+}
+
+}  // namespace orc
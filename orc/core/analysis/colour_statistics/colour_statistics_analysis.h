@@ -0,0 +1,61 @@
+/*
+ * File:        colour_statistics_analysis.h
+ * Module:      analysis
+ * Purpose:     Whole-recording vectorscope and luma statistics tool
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#ifndef ORC_CORE_ANALYSIS_COLOUR_STATISTICS_ANALYSIS_H
+#define ORC_CORE_ANALYSIS_COLOUR_STATISTICS_ANALYSIS_H
+
+#include "../analysis_tool.h"
+#include "orc_colour_statistics.h"
+
+namespace orc {
+
+/**
+ * @brief Progress sink that also receives the accumulated colour statistics
+ *
+ * Passed to ColourStatisticsAnalysisTool::analyze() in place of a plain
+ * AnalysisProgress to receive merged partial counts while the pass runs, on
+ * the thread that called analyze().
+ */
+class ColourStatisticsProgress : public AnalysisProgress {
+ public:
+  virtual void reportColourStatistics(const ColourStatisticsData& data) = 0;
+};
+
+/**
+ * @brief Colour statistics analysis tool
+ *
+ * Decodes a strided or full frame range through the video sink's configured
+ * chroma decoder, in parallel, and accumulates a U/V density map and luma
+ * histogram over all of it, to judge chroma gain and phase settings before
+ * a long export. The final counts are delivered through
+ * ColourStatisticsProgress; the result carries a text summary and headline
+ * statistics.
+ */
+class ColourStatisticsAnalysisTool : public AnalysisTool {
+ public:
+  std::string id() const override;
+  std::string name() const override;
+  std::string description() const override;
+  std::string category() const override;
+
+  std::vector<ParameterDescriptor> parameters() const override;
+  bool canAnalyze(AnalysisSourceType source_type) const override;
+  bool isApplicableToStage(const std::string& stage_name) const override;
+
+  AnalysisResult analyze(const AnalysisContext& ctx,
+                         AnalysisProgress* progress) override;
+
+  bool canApplyToGraph() const override;
+  bool applyToGraph(AnalysisResult& result, const Project& project,
+                    NodeID node_id) override;
+};
+
+}  // namespace orc
+
+#endif  // ORC_CORE_ANALYSIS_COLOUR_STATISTICS_ANALYSIS_H
@@ -0,0 +1,315 @@
+/*
+ * File:        colour_statistics_pass.cpp
+ * Module:      analysis
+ * Purpose:     Parallel whole-recording U/V density and luma histogram pass
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "colour_statistics_pass.h"
+
+#include <orc/stage/preview/colour_decode_session.h>
+#include <orc/support/logging.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace orc::colour_statistics {
+
+namespace {
+
+// Frames a worker decodes before merging its counts into the shared total;
+// bounds how stale a partial result can be.
+constexpr uint64_t kWindowFrames = 8;
+
+// Minimum spacing of partial results.
+constexpr auto kPartialInterval = std::chrono::milliseconds(500);
+
+// Saturation histogram used by summarise(): 1 % bins up to the corner of the
+// clamped U/V square (~141 %).
+constexpr size_t kSaturationBins = 142;
+
+size_t uv_bin(double value, double uv_range) {
+  constexpr size_t kBins = ColourStatisticsData::kUVBinCount;
+  const double normalised = std::clamp(value / uv_range, -1.0, 1.0);
+  return std::min(kBins - 1,
+                  static_cast<size_t>((normalised + 1.0) * 0.5 * kBins));
+}
+
+// Centre of a luma bin, in percent of black-to-white.
+double y_bin_centre(size_t bin) {
+  constexpr double kWidth =
+      (ColourStatisticsData::kYRangeMax - ColourStatisticsData::kYRangeMin) /
+      static_cast<double>(ColourStatisticsData::kYBinCount);
+  return ColourStatisticsData::kYRangeMin +
+         (static_cast<double>(bin) + 0.5) * kWidth;
+}
+
+// Level below which |fraction| of the counts lie, as the centre of the bin
+// reaching it.
+template <typename Bins, typename Centre>
+double percentile(const Bins& bins, uint64_t total, double fraction,
+                  Centre centre) {
+  if (total == 0) return 0.0;
+  const double target = fraction * static_cast<double>(total);
+  uint64_t running = 0;
+  for (size_t i = 0; i < bins.size(); ++i) {
+    running += bins[i];
+    if (static_cast<double>(running) >= target) return centre(i);
+  }
+  return centre(bins.size() - 1);
+}
+
+}  // namespace
+
+void accumulate_frame(const ColourFrameCarrier& carrier,
+                      ColourStatisticsData& data) {
+  if (!carrier.is_valid()) {
+    ++data.frames_failed;
+    return;
+  }
+
+  if (data.frames_decoded == 0) {
+    data.system = carrier.system;
+    data.cvbs_blanking = carrier.cvbs_blanking;
+    data.cvbs_black = carrier.cvbs_black;
+    data.cvbs_white = carrier.cvbs_white;
+  }
+
+  uint32_t x_start = 0;
+  uint32_t x_end = carrier.width;
+  uint32_t y_start = 0;
+  uint32_t y_end = carrier.height;
+  if (carrier.active_x_end > carrier.active_x_start &&
+      carrier.active_x_end <= carrier.width) {
+    x_start = carrier.active_x_start;
+    x_end = carrier.active_x_end;
+  }
+  if (carrier.active_y_end > carrier.active_y_start &&
+      carrier.active_y_end <= carrier.height) {
+    y_start = carrier.active_y_start;
+    y_end = carrier.active_y_end;
+  }
+
+  // Same normalisation as the single-frame histogram and vectorscope: Y
+  // relative to picture black, U/V to the full active-video swing.
+  const double y_range = std::max(1.0, carrier.cvbs_white - carrier.cvbs_black);
+  const double uv_range =
+      std::max(1.0, carrier.cvbs_white - carrier.cvbs_blanking);
+  const double bins_per_percent =
+      static_cast<double>(ColourStatisticsData::kYBinCount) /
+      (ColourStatisticsData::kYRangeMax - ColourStatisticsData::kYRangeMin);
+  // bin = ((y - black) / y_range * 100 - kYRangeMin) * bins_per_percent,
+  // folded into one multiply-add per sample.
+  const double y_scale = 100.0 / y_range * bins_per_percent;
+  const double y_offset = (-carrier.cvbs_black * 100.0 / y_range -
+                           ColourStatisticsData::kYRangeMin) *
+                          bins_per_percent;
+
+  uint64_t* uv = data.uv_density.data();
+  for (uint32_t row = y_start; row < y_end; ++row) {
+    const size_t line = static_cast<size_t>(row) * carrier.width;
+    const double* y_line = carrier.y_plane.data() + line;
+    const double* u_line = carrier.u_plane.data() + line;
+    const double* v_line = carrier.v_plane.data() + line;
+    for (uint32_t col = x_start; col < x_end; ++col) {
+      const int y_bin = static_cast<int>(y_line[col] * y_scale + y_offset);
+      if (y_bin >= 0 &&
+          y_bin < static_cast<int>(ColourStatisticsData::kYBinCount)) {
+        ++data.y_bins[static_cast<size_t>(y_bin)];
+      }
+      ++uv[uv_bin(v_line[col], uv_range) * ColourStatisticsData::kUVBinCount +
+           uv_bin(u_line[col], uv_range)];
+    }
+  }
+
+  ++data.frames_decoded;
+  data.sample_count += static_cast<uint64_t>(x_end - x_start) *
+                       static_cast<uint64_t>(y_end - y_start);
+}
+
+std::optional<ColourStatisticsData> collect(
+    const IColourDecodeSessionProvider& provider,
+    const FrameSelection& selection, const CancelCheck& cancelled,
+    const ProgressCallback& progress, const PartialCallback& partial) {
+  uint64_t recording_frames = 0;
+  {
+    auto probe = provider.open_colour_decode_session();
+    if (!probe) {
+      ORC_LOG_ERROR("Colour statistics: stage has no input to decode");
+      return std::nullopt;
+    }
+    recording_frames = probe->frame_count();
+  }
+
+  ColourStatisticsData total;
+  const uint64_t stride = std::max<uint64_t>(1, selection.stride);
+  uint64_t span = 0;
+  if (selection.first_frame < recording_frames) {
+    span = recording_frames - selection.first_frame;
+    if (selection.frame_count > 0) {
+      span = std::min(span, selection.frame_count);
+    }
+  }
+  const uint64_t frames = (span + stride - 1) / stride;
+  total.frames_total = frames;
+  if (frames == 0) {
+    return total;
+  }
+
+  const size_t item_count =
+      static_cast<size_t>((frames + kWindowFrames - 1) / kWindowFrames);
+  std::atomic<size_t> next_item{0};
+  std::atomic<uint64_t> frames_done{0};
+  std::atomic<bool> stop{false};
+  std::atomic<bool> session_failed{false};
+  std::mutex total_mutex;
+
+  auto worker = [&]() {
+    // Opened on the worker so the decoder is built (and used) on one thread.
+    auto session = provider.open_colour_decode_session();
+    if (!session) {
+      session_failed = true;
+      stop = true;
+      return;
+    }
+    ColourStatisticsData local;
+    for (size_t n = next_item++; n < item_count && !stop; n = next_item++) {
+      const uint64_t begin = static_cast<uint64_t>(n) * kWindowFrames;
+      const uint64_t end = std::min(frames, begin + kWindowFrames);
+      for (uint64_t k = begin; k < end && !stop; ++k) {
+        auto carrier =
+            session->decode_colour_frame(selection.first_frame + k * stride);
+        if (carrier) {
+          accumulate_frame(*carrier, local);
+        } else {
+          ++local.frames_failed;
+        }
+        ++frames_done;
+      }
+      {
+        std::lock_guard<std::mutex> lock(total_mutex);
+        total.merge(local);
+      }
+      local.clear_counts();
+    }
+  };
+
+  size_t thread_count = std::max<size_t>(
+      1, std::min<size_t>(std::thread::hardware_concurrency(), item_count));
+  if (selection.max_threads > 0) {
+    thread_count = std::min(thread_count, selection.max_threads);
+  }
+  std::vector<std::future<void>> workers;
+  workers.reserve(thread_count);
+  for (size_t t = 0; t < thread_count; ++t) {
+    workers.push_back(std::async(std::launch::async, worker));
+  }
+
+  bool was_cancelled = false;
+  auto last_partial = std::chrono::steady_clock::now();
+  uint64_t partial_frames = 0;
+  for (auto& future : workers) {
+    while (future.wait_for(std::chrono::milliseconds(50)) !=
+           std::future_status::ready) {
+      if (!was_cancelled && cancelled && cancelled()) {
+        was_cancelled = true;
+        stop = true;
+      }
+      if (progress) progress(frames_done.load(), frames);
+
+      const auto now = std::chrono::steady_clock::now();
+      if (partial && !was_cancelled && now - last_partial >= kPartialInterval) {
+        std::optional<ColourStatisticsData> snapshot;
+        {
+          std::lock_guard<std::mutex> lock(total_mutex);
+          const uint64_t merged = total.frames_decoded + total.frames_failed;
+          if (merged != partial_frames) {
+            partial_frames = merged;
+            snapshot = total;
+          }
+        }
+        if (snapshot) partial(*snapshot);
+        last_partial = now;
+      }
+    }
+  }
+  for (auto& future : workers) {
+    future.get();
+  }
+  if (was_cancelled || (cancelled && cancelled())) {
+    return std::nullopt;
+  }
+  if (session_failed) {
+    ORC_LOG_ERROR("Colour statistics: could not open a decode session");
+    return std::nullopt;
+  }
+  if (progress) progress(frames, frames);
+
+  ORC_LOG_DEBUG(
+      "Colour statistics: {} frames ({} failed) of {} (stride {}) on {} "
+      "thread(s)",
+      total.frames_decoded, total.frames_failed, recording_frames, stride,
+      thread_count);
+  return total;
+}
+
+Summary summarise(const ColourStatisticsData& data) {
+  Summary summary;
+
+  constexpr size_t kUVBins = ColourStatisticsData::kUVBinCount;
+  std::array<uint64_t, kSaturationBins> saturation{};
+  double saturation_sum = 0.0;
+  uint64_t uv_total = 0;
+  for (size_t v = 0; v < kUVBins && data.uv_density.size() >= kUVBins * kUVBins;
+       ++v) {
+    const double vc = (static_cast<double>(v) + 0.5) / kUVBins * 2.0 - 1.0;
+    for (size_t u = 0; u < kUVBins; ++u) {
+      const uint64_t count = data.uv_count(u, v);
+      if (count == 0) continue;
+      const double uc = (static_cast<double>(u) + 0.5) / kUVBins * 2.0 - 1.0;
+      const double percent = std::sqrt(uc * uc + vc * vc) * 100.0;
+      saturation[std::min(kSaturationBins - 1, static_cast<size_t>(percent))] +=
+          count;
+      saturation_sum += percent * static_cast<double>(count);
+      uv_total += count;
+    }
+  }
+  if (uv_total > 0) {
+    summary.mean_saturation = saturation_sum / static_cast<double>(uv_total);
+    summary.saturation_p99 =
+        percentile(saturation, uv_total, 0.99,
+                   [](size_t bin) { return static_cast<double>(bin) + 0.5; });
+  }
+
+  uint64_t y_total = 0;
+  uint64_t below = 0;
+  uint64_t above = 0;
+  for (size_t i = 0; i < data.y_bins.size(); ++i) {
+    y_total += data.y_bins[i];
+    if (y_bin_centre(i) < 0.0) below += data.y_bins[i];
+    if (y_bin_centre(i) > 100.0) above += data.y_bins[i];
+  }
+  if (y_total > 0) {
+    summary.y_p1 = percentile(data.y_bins, y_total, 0.01, y_bin_centre);
+    summary.y_median = percentile(data.y_bins, y_total, 0.5, y_bin_centre);
+    summary.y_p99 = percentile(data.y_bins, y_total, 0.99, y_bin_centre);
+    summary.y_below_black =
+        100.0 * static_cast<double>(below) / static_cast<double>(y_total);
+    summary.y_above_white =
+        100.0 * static_cast<double>(above) / static_cast<double>(y_total);
+  }
+
+  return summary;
+}
+
+}  // namespace orc::colour_statistics
@@ -0,0 +1,79 @@
+/*
+ * File:        colour_statistics_pass.h
+ * Module:      analysis
+ * Purpose:     Parallel whole-recording U/V density and luma histogram pass
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#ifndef ORC_CORE_ANALYSIS_COLOUR_STATISTICS_PASS_H
+#define ORC_CORE_ANALYSIS_COLOUR_STATISTICS_PASS_H
+
+#include <orc/stage/preview/orc_preview_carriers.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+#include "orc_colour_statistics.h"
+
+namespace orc {
+
+class IColourDecodeSessionProvider;
+
+namespace colour_statistics {
+
+// Polled while the pass runs; return true to abort it.
+using CancelCheck = std::function<bool()>;
+// Frames visited so far and in total. Always called on the thread that
+// called collect().
+using ProgressCallback = std::function<void(uint64_t done, uint64_t total)>;
+// Merged counts of every frame finished so far. Always called on the thread
+// that called collect().
+using PartialCallback = std::function<void(const ColourStatisticsData&)>;
+
+// Frames visited by a pass: first_frame, first_frame + stride, ... up to
+// first_frame + frame_count - 1, clipped to the end of the recording.
+struct FrameSelection {
+  uint64_t first_frame = 0;
+  uint64_t frame_count = 0;  // 0 = to the end of the recording
+  uint64_t stride = 1;       // 1 = every frame
+  size_t max_threads = 0;    // 0 = one per hardware thread
+};
+
+// Readings derived from the accumulated counts, as percentages: luma of
+// black-to-white, saturation of the full active-video swing.
+struct Summary {
+  double mean_saturation = 0.0;
+  double saturation_p99 = 0.0;
+  double y_p1 = 0.0;
+  double y_median = 0.0;
+  double y_p99 = 0.0;
+  double y_below_black = 0.0;  // share of binned luma samples below 0 %
+  double y_above_white = 0.0;  // share of binned luma samples above 100 %
+};
+
+// Adds the active picture of one decoded frame to |data|. The carrier's
+// active_* bounds address its planes directly. Invalid carriers count as
+// failed frames.
+void accumulate_frame(const ColourFrameCarrier& carrier,
+                      ColourStatisticsData& data);
+
+// Decodes the selected frames with one decode session per thread, each
+// accumulating into its own counts that are merged after every window of
+// frames, and |partial| receives the merged counts about twice a second.
+// Returns std::nullopt when |cancelled| fired or no session could be opened.
+std::optional<ColourStatisticsData> collect(
+    const IColourDecodeSessionProvider& provider,
+    const FrameSelection& selection, const CancelCheck& cancelled = nullptr,
+    const ProgressCallback& progress = nullptr,
+    const PartialCallback& partial = nullptr);
+
+Summary summarise(const ColourStatisticsData& data);
+
+}  // namespace colour_statistics
+}  // namespace orc
+
+#endif  // ORC_CORE_ANALYSIS_COLOUR_STATISTICS_PASS_H
@@ -10,7 +10,6 @@
 
 #include "disc_mapper_analysis.h"
 
-#include <biphase_observer.h>
 #include <frame_numbering.h>
 #include <orc/stage/video_frame_representation.h>
 #include <orc/support/logging.h>
@@ -142,46 +141,28 @@ AnalysisResult DiscMapperAnalysisTool::analyze(const AnalysisContext& ctx,
       progress->setProgress(0);
     }
 
-    // Run BiphaseObserver on all frames to extract VBI data into
-    // ObservationContext. Populates the "biphase" namespace with
-    // vbi_line_16, vbi_line_17, vbi_line_18 keyed by derived FieldIDs.
-    BiphaseObserver biphase_observer;
-    auto& obs_context = executor.get_observation_context();
-    auto frame_range = source->frame_range();
-
-    ORC_LOG_DEBUG("Running BiphaseObserver on {} frames", frame_range.count());
-
-    {
-      size_t total_frames = frame_range.count();
-      size_t biphase_idx = 0;
-      size_t update_interval =
-          std::max(static_cast<size_t>(1), total_frames / 100);
-      for (FrameID fid = frame_range.first; fid <= frame_range.last; ++fid) {
-        biphase_observer.process_frame(*source, fid, obs_context);
-        ++biphase_idx;
-        if (progress && biphase_idx % update_interval == 0) {
-          int pct = static_cast<int>(biphase_idx * 100 / total_frames);
-          progress->setProgress(pct);
-          progress->setSubStatus("Frame " + std::to_string(biphase_idx) +
-                                 " / " + std::to_string(total_frames));
-          if (progress->isCancelled()) {
-            result.status = AnalysisResult::Cancelled;
-            return result;
-          }
-        }
-      }
-      if (progress) {
-        progress->setProgress(100);
-        progress->setSubStatus("");
-      }
-    }
-
-    ORC_LOG_DEBUG("BiphaseObserver complete, ObservationContext populated");
-
-    if (progress && progress->isCancelled()) {
+    // Index the VBI address codes of every field. Only lines 16-18 are
+    // read, in parallel windows of frames, instead of running the observer
+    // set over whole frames.
+    ORC_LOG_DEBUG("Building VBI index over {} frames",
+                  source->frame_range().count());
+    auto cancel_check = [progress]() {
+      return progress && progress->isCancelled();
+    };
+    auto report = [progress](uint64_t done, uint64_t total) {
+      if (!progress || total == 0) return;
+      progress->setProgress(static_cast<int>(done * 100 / total));
+      progress->setSubStatus("Frame " + std::to_string(done) + " / " +
+                             std::to_string(total));
+    };
+    auto indexes = VBIIndex::build({source}, cancel_check, report);
+    if (indexes.empty()) {
       result.status = AnalysisResult::Cancelled;
       return result;
     }
+    if (progress) {
+      progress->setSubStatus("");
+    }
 
     // Now run the analyzer on the representation
     DiscMapperAnalyzer analyzer;
@@ -189,7 +170,7 @@ AnalysisResult DiscMapperAnalysisTool::analyze(const AnalysisContext& ctx,
 
     // Run field mapping analysis - each stage reports its own 0-100% progress
     FieldMappingDecision decision =
-        analyzer.analyze(*source, obs_context, options, progress);
+        analyzer.analyze(*source, indexes.front(), options, progress);
 
     if (!decision.success) {
       result.status = AnalysisResult::Failed;
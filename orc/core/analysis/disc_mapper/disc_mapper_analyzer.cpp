@@ -9,7 +9,6 @@
 
 #include "disc_mapper_analyzer.h"
 
-#include <orc/stage/observation/observation_context.h>
 #include <orc/support/logging.h>
 
 #include <algorithm>
@@ -213,12 +212,12 @@ static bool is_lead_in_out(int32_t vbi17, int32_t vbi18) {
 }
 
 /**
- * @brief Normalize a single field's metadata using VBI bytes from
- * ObservationContext. Parity and format are derived from the parent frame.
+ * @brief Normalize a single field's metadata using its VBI index entry.
+ * Parity and format are derived from the parent frame.
  * Phase hints are not available from VideoFrameRepresentation; the VFR pipeline
  * already guarantees correct field pairing so phase validation is skipped.
  */
-static NormalizedField normalize_field(const ObservationContext& obs_context,
+static NormalizedField normalize_field(const VBIIndex& vbi_index,
                                        FieldID field_id, bool is_first_field,
                                        VideoFormat format) {
   NormalizedField nf;
@@ -226,15 +225,11 @@ static NormalizedField normalize_field(const ObservationContext& obs_context,
   nf.is_first_field = is_first_field;
   nf.format = format;
 
-  // Get VBI bytes from ObservationContext (populated by observers)
-  auto vbi16_opt = obs_context.get(field_id, "biphase", "vbi_line_16");
-  auto vbi17_opt = obs_context.get(field_id, "biphase", "vbi_line_17");
-  auto vbi18_opt = obs_context.get(field_id, "biphase", "vbi_line_18");
-
-  if (vbi16_opt && vbi17_opt && vbi18_opt) {
-    int32_t vbi16 = std::get<int32_t>(*vbi16_opt);
-    int32_t vbi17 = std::get<int32_t>(*vbi17_opt);
-    int32_t vbi18 = std::get<int32_t>(*vbi18_opt);
+  const VBIIndex::Field* entry = vbi_index.field(field_id);
+  if (entry && entry->has_vbi()) {
+    int32_t vbi16 = entry->lines[0];
+    int32_t vbi17 = entry->lines[1];
+    int32_t vbi18 = entry->lines[2];
 
     ORC_LOG_DEBUG("Field {}: VBI data: {:08x} {:08x} {:08x}", field_id.value(),
                   vbi16, vbi17, vbi18);
@@ -275,8 +270,7 @@ static NormalizedField normalize_field(const ObservationContext& obs_context,
       }
     }
   } else {
-    ORC_LOG_DEBUG("Field {}: No VBI data in ObservationContext",
-                  field_id.value());
+    ORC_LOG_DEBUG("Field {}: No VBI data in index", field_id.value());
   }
 
   // Compute quality score (placeholder)
@@ -560,9 +554,8 @@ static std::optional<CandidateFrame> pair_fields(const NormalizedField& f1,
 // ============================================================================
 
 FieldMappingDecision DiscMapperAnalyzer::analyze(
-    const VideoFrameRepresentation& source,
-    const ObservationContext& observation_context, const Options& options,
-    AnalysisProgress* progress) {
+    const VideoFrameRepresentation& source, const VBIIndex& vbi_index,
+    const Options& options, AnalysisProgress* progress) {
   FieldMappingDecision decision;
   std::ostringstream rationale;
 
@@ -612,7 +605,7 @@ FieldMappingDecision DiscMapperAnalyzer::analyze(
       for (size_t field_idx = 0; field_idx < 2; ++field_idx) {
         FieldID fid(frame_id * 2 + field_idx);
         bool is_first = (field_idx == 0);
-        auto nf = normalize_field(observation_context, fid, is_first, format);
+        auto nf = normalize_field(vbi_index, fid, is_first, format);
 
         if (nf.picture_number) {
           fields_with_pn++;
@@ -664,14 +657,11 @@ FieldMappingDecision DiscMapperAnalyzer::analyze(
       auto& nf = normalized_fields[i];
       if (nf.picture_number) continue;
 
-      auto vbi17_opt =
-          observation_context.get(nf.field_id, "biphase", "vbi_line_17");
-      auto vbi18_opt =
-          observation_context.get(nf.field_id, "biphase", "vbi_line_18");
-      if (!vbi17_opt || !vbi18_opt) continue;
+      const VBIIndex::Field* entry = vbi_index.field(nf.field_id);
+      if (!entry || !entry->has_vbi()) continue;
 
-      int32_t vbi17 = std::get<int32_t>(*vbi17_opt);
-      int32_t vbi18 = std::get<int32_t>(*vbi18_opt);
+      int32_t vbi17 = entry->lines[1];
+      int32_t vbi18 = entry->lines[2];
 
       std::optional<int32_t> pn_a, pn_b;
       if ((vbi17 & 0xF00000) == 0xF00000) {
@@ -15,6 +15,8 @@
 #include <string>
 #include <vector>
 
+#include "../vbi_index/vbi_index.h"
+
 namespace orc {
 
 // Forward declaration
@@ -47,8 +49,8 @@ struct FieldMappingDecision {
 /**
  * @brief Field mapping analyzer
  *
- * Maps decoded fields onto a coherent frame sequence using the VBI data
- * populated in the observation context. The analysis runs a six-stage
+ * Maps decoded fields onto a coherent frame sequence using the VBI codes
+ * held in the source's VBIIndex. The analysis runs a six-stage
  * pipeline:
  *   1. Per-field VBI normalization (with sequence-based resolution of CAV
  *      VBI line disagreements).
@@ -83,20 +85,18 @@ class DiscMapperAnalyzer {
   ~DiscMapperAnalyzer() = default;
 
   /**
-   * @brief Analyze disc mapping using VBI data from the observation context.
+   * @brief Analyze disc mapping using the source's VBI index.
    *
    * @param source The video field representation
-   * @param observation_context Observation context containing VBI data from
-   * observers
+   * @param vbi_index VBI index of source (see VBIIndex::build)
    * @param options Analysis options
    * @param progress Optional progress callback
    * @return Field mapping decision
    */
-  FieldMappingDecision analyze(
-      const VideoFrameRepresentation& source,
-      const class ObservationContext& observation_context,
-      const Options& options = Options{},
-      class AnalysisProgress* progress = nullptr);
+  FieldMappingDecision analyze(const VideoFrameRepresentation& source,
+                               const VBIIndex& vbi_index,
+                               const Options& options = Options{},
+                               class AnalysisProgress* progress = nullptr);
 };
 
 }  // namespace orc
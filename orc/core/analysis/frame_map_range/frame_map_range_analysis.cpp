@@ -10,7 +10,6 @@
 
 #include "frame_map_range_analysis.h"
 
-#include <biphase_observer.h>
 #include <orc/stage/video_frame_representation.h>
 #include <orc/support/logging.h>
 
@@ -27,6 +26,7 @@
 #include "../../include/dag_executor.h"
 #include "../../include/project.h"
 #include "../analysis_registry.h"
+#include "../vbi_index/vbi_index.h"
 #include "frame_map_range_search.h"
 
 namespace orc {
@@ -216,56 +216,48 @@ static ParsedAddress parse_address(const std::string& input, bool is_pal) {
   return result;
 }
 
-// Read picture number from one field slot in the observation context.
+// Picture number carried by one field: the CAV picture number, or the CLV
+// time converted to a 1-based picture number.
 static std::optional<int32_t> get_picture_number_from_vbi(
-    const ObservationContext& observation_context, FieldID field_id,
-    bool is_pal) {
-  auto picture_num = observation_context.get(field_id, "vbi", "picture_number");
-  if (picture_num && std::holds_alternative<int32_t>(*picture_num)) {
-    return std::get<int32_t>(*picture_num);
-  }
-
-  auto hours_opt =
-      observation_context.get(field_id, "vbi", "clv_timecode_hours");
-  auto minutes_opt =
-      observation_context.get(field_id, "vbi", "clv_timecode_minutes");
-  auto seconds_opt =
-      observation_context.get(field_id, "vbi", "clv_timecode_seconds");
-  auto picture_opt =
-      observation_context.get(field_id, "vbi", "clv_timecode_picture");
-
-  if (hours_opt && minutes_opt && seconds_opt && picture_opt) {
-    if (std::holds_alternative<int32_t>(*hours_opt) &&
-        std::holds_alternative<int32_t>(*minutes_opt) &&
-        std::holds_alternative<int32_t>(*seconds_opt) &&
-        std::holds_alternative<int32_t>(*picture_opt)) {
-      int32_t hours = std::get<int32_t>(*hours_opt);
-      int32_t minutes = std::get<int32_t>(*minutes_opt);
-      int32_t seconds = std::get<int32_t>(*seconds_opt);
-      int32_t picture = std::get<int32_t>(*picture_opt);
-      int32_t fps = is_pal ? 25 : 30;
-      int64_t frame_index = static_cast<int64_t>(hours) * 3600LL * fps +
-                            static_cast<int64_t>(minutes) * 60LL * fps +
-                            static_cast<int64_t>(seconds) * fps +
-                            static_cast<int64_t>(picture);
-      int64_t picture_number = frame_index + 1;  // 0:0:0.0 = picture number 1
-      if (picture_number > 0 &&
-          picture_number <= std::numeric_limits<int32_t>::max()) {
-        return static_cast<int32_t>(picture_number);
-      }
+    const VBIIndex::Field& field, bool is_pal) {
+  if (auto picture = field.cav_picture_number()) {
+    return picture;
+  }
+
+  if (auto clv = field.clv_timecode()) {
+    int32_t fps = is_pal ? 25 : 30;
+    int64_t frame_index = static_cast<int64_t>(clv->hours) * 3600LL * fps +
+                          static_cast<int64_t>(clv->minutes) * 60LL * fps +
+                          static_cast<int64_t>(clv->seconds) * fps +
+                          static_cast<int64_t>(clv->picture_number);
+    int64_t picture_number = frame_index + 1;  // 0:0:0.0 = picture number 1
+    if (picture_number > 0 &&
+        picture_number <= std::numeric_limits<int32_t>::max()) {
+      return static_cast<int32_t>(picture_number);
     }
   }
 
   return std::nullopt;
 }
 
-// BiphaseObserver stores VBI per-field at FieldID(frame_id*2 + field_idx).
-// Check both fields and return the first valid picture number found.
+// Fields are indexed at FieldID(frame_id*2 + field_idx). Check both fields
+// and return the first valid picture number found.
 static std::optional<int32_t> get_picture_number_from_frame(
-    const ObservationContext& obs_context, FrameID frame_id, bool is_pal) {
-  for (uint64_t field_idx = 0; field_idx < 2; ++field_idx) {
+    const VBIIndex& index, FrameID frame_id, bool is_pal) {
+  for (size_t field_idx = 0; field_idx < 2; ++field_idx) {
+    const VBIIndex::Field* field = index.field(frame_id, field_idx);
+    if (!field) return std::nullopt;
+    if (auto pn = get_picture_number_from_vbi(*field, is_pal)) return pn;
+  }
+  return std::nullopt;
+}
+
+// Same, decoding the frame's VBI lines directly for a single probe.
+static std::optional<int32_t> get_picture_number_from_frame(
+    const VideoFrameRepresentation& source, FrameID frame_id, bool is_pal) {
+  for (size_t field_idx = 0; field_idx < 2; ++field_idx) {
     auto pn = get_picture_number_from_vbi(
-        obs_context, FieldID(frame_id * 2 + field_idx), is_pal);
+        VBIIndex::decode_field(source, frame_id, field_idx), is_pal);
     if (pn) return pn;
   }
   return std::nullopt;
@@ -404,23 +396,32 @@ AnalysisResult FrameMapRangeAnalysisTool::analyze(const AnalysisContext& ctx,
     progress->setProgress(30);
   }
 
-  BiphaseObserver biphase_observer;
-  auto& obs_context = executor.get_observation_context();
-
-  // Memoized probe: each frame is biphase-decoded at most once.
+  // Memoized probe: each frame's VBI lines are decoded at most once. Once a
+  // sequential fallback has indexed the whole source, probes are lookups.
   std::unordered_map<int64_t, std::optional<int32_t>> picture_cache;
+  std::vector<VBIIndex> full_index;
   auto probe = [&](int64_t fid) -> std::optional<int32_t> {
+    FrameID frame_id = static_cast<FrameID>(fid);
+    if (!full_index.empty()) {
+      return get_picture_number_from_frame(full_index.front(), frame_id,
+                                           is_pal);
+    }
     auto it = picture_cache.find(fid);
     if (it != picture_cache.end()) {
       return it->second;
     }
-    FrameID frame_id = static_cast<FrameID>(fid);
-    biphase_observer.process_frame(*source, frame_id, obs_context);
-    auto pn = get_picture_number_from_frame(obs_context, frame_id, is_pal);
+    auto pn = get_picture_number_from_frame(*source, frame_id, is_pal);
     picture_cache.emplace(fid, pn);
     return pn;
   };
   auto cancel_check = [&]() { return progress && progress->isCancelled(); };
+  // Sequential fallbacks index every frame first, in parallel windows.
+  auto index_source = [&]() {
+    if (full_index.empty()) {
+      full_index = VBIIndex::build({source}, cancel_check);
+    }
+    return !full_index.empty();
+  };
 
   int64_t src_first = static_cast<int64_t>(frame_range.first);
   int64_t src_last = static_cast<int64_t>(frame_range.last);
@@ -452,6 +453,10 @@ AnalysisResult FrameMapRangeAnalysisTool::analyze(const AnalysisContext& ctx,
     if (progress) {
       progress->setStatus("Start not found by binary search, scanning...");
     }
+    if (!index_source()) {
+      result.status = AnalysisResult::Cancelled;
+      return result;
+    }
 
     for (int64_t fid = src_first; fid <= src_last; ++fid) {
       if (cancel_check()) {
@@ -526,6 +531,10 @@ AnalysisResult FrameMapRangeAnalysisTool::analyze(const AnalysisContext& ctx,
         progress->setStatus(
             "End not found by binary search, scanning from start...");
       }
+      if (!index_source()) {
+        result.status = AnalysisResult::Cancelled;
+        return result;
+      }
 
       for (int64_t fid = static_cast<int64_t>(start_frame) + 1; fid <= src_last;
            ++fid) {
@@ -9,8 +9,6 @@
 
 #include "source_alignment_analysis.h"
 
-#include <biphase_observer.h>
-#include <orc/stage/observation/observation_context.h>
 #include <orc/stage/video_frame_representation.h>
 #include <orc/support/logging.h>
 
@@ -23,7 +21,9 @@
 #include "../../../plugins/stages/source_align/source_align_stage.h"
 #include "../../include/dag_executor.h"
 #include "../../include/project.h"
+#include "../analysis_progress.h"
 #include "../analysis_registry.h"
+#include "../vbi_index/vbi_index.h"
 
 namespace orc {
 
@@ -79,55 +79,20 @@ bool SourceAlignmentAnalysisTool::isApplicableToStage(
 }
 
 /**
- * @brief Get VBI frame number or CLV timecode frame equivalent for a field
+ * @brief Index the VBI codes of the given sources in parallel
  *
- * ARCHITECTURAL NOTE: This function queries the ObservationContext for VBI
- * data. Observations must be populated by running BiphaseObserver on the field
- * first.
- *
- * @param observation_context The observation context containing VBI data
- * @param field_id The field to query
- * @param is_pal Whether the source is PAL (used for CLV timecode conversion)
- * @return Frame number if found, -1 otherwise
+ * @param max_frames Limit each source to its first max_frames frames (0 for
+ * the whole source)
+ * @return One index per source, or an empty vector when cancelled
  */
-static int32_t get_frame_number_from_vbi(
-    const ObservationContext& observation_context, FieldID field_id,
-    bool is_pal) {
-  // Check for CAV picture number (preferred)
-  auto picture_num = observation_context.get(field_id, "vbi", "picture_number");
-  if (picture_num && std::holds_alternative<int32_t>(*picture_num)) {
-    return std::get<int32_t>(*picture_num);
-  }
-
-  // Check for CLV timecode (need to query all components)
-  auto hours_opt =
-      observation_context.get(field_id, "vbi", "clv_timecode_hours");
-  auto minutes_opt =
-      observation_context.get(field_id, "vbi", "clv_timecode_minutes");
-  auto seconds_opt =
-      observation_context.get(field_id, "vbi", "clv_timecode_seconds");
-  auto picture_opt =
-      observation_context.get(field_id, "vbi", "clv_timecode_picture");
-
-  if (hours_opt && minutes_opt && seconds_opt && picture_opt) {
-    if (std::holds_alternative<int32_t>(*hours_opt) &&
-        std::holds_alternative<int32_t>(*minutes_opt) &&
-        std::holds_alternative<int32_t>(*seconds_opt) &&
-        std::holds_alternative<int32_t>(*picture_opt)) {
-      int32_t hours = std::get<int32_t>(*hours_opt);
-      int32_t minutes = std::get<int32_t>(*minutes_opt);
-      int32_t seconds = std::get<int32_t>(*seconds_opt);
-      int32_t picture_number = std::get<int32_t>(*picture_opt);
-
-      // Convert CLV timecode to frame number
-      int32_t fps = is_pal ? 25 : 30;
-      int32_t frame_num = hours * 3600 * fps + minutes * 60 * fps +
-                          seconds * fps + picture_number;
-      return frame_num;
-    }
-  }
-
-  return -1;  // No VBI frame number found
+static std::vector<VBIIndex> index_sources(
+    const std::vector<std::shared_ptr<VideoFrameRepresentation>>& sources,
+    AnalysisProgress* progress, uint64_t max_frames) {
+  std::vector<std::shared_ptr<const VideoFrameRepresentation>> readers(
+      sources.begin(), sources.end());
+  return VBIIndex::build(
+      readers, [progress]() { return progress && progress->isCancelled(); },
+      nullptr, max_frames);
 }
 
 AnalysisResult SourceAlignmentAnalysisTool::analyze(
@@ -297,9 +262,13 @@ AnalysisResult SourceAlignmentAnalysisTool::analyze(
         "source)",
         MAX_SCAN_FRAMES);
 
-    // Create observation context and biphase observer for VBI scanning
-    ObservationContext observation_context;
-    BiphaseObserver biphase_observer;
+    // Index the VBI lines of the first frames of every source in parallel
+    const auto quick_index =
+        index_sources(input_sources, progress, MAX_SCAN_FRAMES);
+    if (quick_index.empty()) {
+      result.status = AnalysisResult::Cancelled;
+      return result;
+    }
 
     for (size_t src_idx = 0; src_idx < input_sources.size(); ++src_idx) {
       const auto& source = input_sources[src_idx];
@@ -329,16 +298,9 @@ AnalysisResult SourceAlignmentAnalysisTool::analyze(
 
         ++scanned;
 
-        biphase_observer.process_frame(*source, frame_id, observation_context);
-
         // Check both fields of this frame for VBI data.
-        int32_t frame_num = -1;
-        for (int field = 0; field < 2 && frame_num < 0; ++field) {
-          FieldID field_id =
-              FieldID(frame_id * 2 + static_cast<uint64_t>(field));
-          frame_num =
-              get_frame_number_from_vbi(observation_context, field_id, is_pal);
-        }
+        const int32_t frame_num =
+            quick_index[src_idx].frame_number(frame_id, is_pal).value_or(-1);
 
         if (frame_num >= 0) {
           info.vbi_frames.insert(frame_num);
@@ -409,6 +371,18 @@ AnalysisResult SourceAlignmentAnalysisTool::analyze(
       if (any_missing) {
         ORC_LOG_DEBUG(
             "Pad mode: some sources have no VBI in quick scan – scanning");
+        std::vector<std::shared_ptr<VideoFrameRepresentation>> to_scan;
+        for (size_t src_idx = 0; src_idx < input_sources.size(); ++src_idx) {
+          if (source_info[src_idx].first_vbi < 0) {
+            to_scan.push_back(input_sources[src_idx]);
+          }
+        }
+        const auto scan_index = index_sources(to_scan, progress, 0);
+        if (scan_index.empty()) {
+          result.status = AnalysisResult::Cancelled;
+          return result;
+        }
+        size_t scan_idx = 0;
         for (size_t src_idx = 0; src_idx < input_sources.size(); ++src_idx) {
           auto& info = source_info[src_idx];
           if (info.first_vbi >= 0) continue;
@@ -418,18 +392,12 @@ AnalysisResult SourceAlignmentAnalysisTool::analyze(
           if (auto fd = source->get_frame_descriptor(info.range.first)) {
             is_pal = (fd->system == VideoSystem::PAL);
           }
+          const VBIIndex& index = scan_index[scan_idx++];
           for (uint64_t i = 0; i < info.range.count(); ++i) {
             FrameID frame_id = info.range.first + i;
             if (!source->has_frame(frame_id)) continue;
-            biphase_observer.process_frame(*source, frame_id,
-                                           observation_context);
-            int32_t frame_num = -1;
-            for (int field = 0; field < 2 && frame_num < 0; ++field) {
-              FieldID fid =
-                  FieldID(frame_id * 2 + static_cast<uint64_t>(field));
-              frame_num =
-                  get_frame_number_from_vbi(observation_context, fid, is_pal);
-            }
+            const int32_t frame_num =
+                index.frame_number(frame_id, is_pal).value_or(-1);
             if (frame_num >= 0) {
               info.first_vbi = frame_num;
               info.vbi_frames.insert(frame_num);
@@ -674,6 +642,11 @@ AnalysisResult SourceAlignmentAnalysisTool::analyze(
       // Phase 3: Full scan if no common frame found in the quick scan
       if (first_common_frame < 0) {
         ORC_LOG_DEBUG("Phase 3: Full scan to find best alignment");
+        const auto full_index = index_sources(input_sources, progress, 0);
+        if (full_index.empty()) {
+          result.status = AnalysisResult::Cancelled;
+          return result;
+        }
         for (size_t src_idx = 0; src_idx < input_sources.size(); ++src_idx) {
           const auto& source = input_sources[src_idx];
           if (!source) continue;
@@ -687,15 +660,9 @@ AnalysisResult SourceAlignmentAnalysisTool::analyze(
           for (uint64_t i = 0; i < info.range.count(); ++i) {
             FrameID frame_id = info.range.first + i;
             if (!source->has_frame(frame_id)) continue;
-            biphase_observer.process_frame(*source, frame_id,
-                                           observation_context);
-            int32_t frame_num = -1;
-            for (int field = 0; field < 2 && frame_num < 0; ++field) {
-              FieldID fid =
-                  FieldID(frame_id * 2 + static_cast<uint64_t>(field));
-              frame_num =
-                  get_frame_number_from_vbi(observation_context, fid, is_pal);
-            }
+            const auto vbi_frame =
+                full_index[src_idx].frame_number(frame_id, is_pal);
+            const int32_t frame_num = vbi_frame.value_or(-1);
             if (frame_num >= 0) {
               if (info.vbi_frames.find(frame_num) == info.vbi_frames.end()) {
                 info.vbi_frames.insert(frame_num);
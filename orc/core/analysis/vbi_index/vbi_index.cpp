@@ -0,0 +1,214 @@
+/*
+ * File:        vbi_index.cpp
+ * Module:      analysis
+ * Purpose:     Compact per-field VBI address index built from lines 16-18 only
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "vbi_index.h"
+
+#include <biphase_observer.h>
+#include <orc/stage/video_frame_representation.h>
+#include <orc/support/line_batch_representation.h>
+#include <orc/support/logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+namespace orc {
+
+namespace {
+
+// Frames per batched line read; one work item for the thread pool.
+constexpr uint64_t kWindowFrames = 256;
+
+VBIIndex::Field make_field(const std::array<int32_t, 3>& lines) {
+  VBIIndex::Field field;
+  field.lines = lines;
+  if (!field.has_vbi()) {
+    return field;
+  }
+  const auto codes =
+      BiphaseObserver::decode_address_codes(lines[0], lines[1], lines[2]);
+  field.picture_number = codes.picture_number.value_or(-1);
+  field.chapter_number = codes.chapter_number.value_or(-1);
+  if (codes.clv_timecode) {
+    field.clv = {static_cast<int8_t>(codes.clv_timecode->hours),
+                 static_cast<int8_t>(codes.clv_timecode->minutes),
+                 static_cast<int8_t>(codes.clv_timecode->seconds),
+                 static_cast<int8_t>(codes.clv_timecode->picture_number)};
+  }
+  field.flags = static_cast<uint8_t>(
+      (codes.lead_in ? VBIIndex::Field::kLeadIn : 0) |
+      (codes.lead_out ? VBIIndex::Field::kLeadOut : 0) |
+      (codes.stop_code ? VBIIndex::Field::kStopCode : 0));
+  return field;
+}
+
+struct WorkItem {
+  size_t source;
+  FrameIDRange frames;
+};
+
+}  // namespace
+
+bool VBIIndex::Field::has_vbi() const {
+  return std::any_of(lines.begin(), lines.end(),
+                     [](int32_t code) { return code != 0 && code != -1; });
+}
+
+std::optional<int32_t> VBIIndex::Field::cav_picture_number() const {
+  if (picture_number < 0) return std::nullopt;
+  return picture_number;
+}
+
+std::optional<int32_t> VBIIndex::Field::chapter() const {
+  if (chapter_number < 0) return std::nullopt;
+  return chapter_number;
+}
+
+std::optional<CLVTimecode> VBIIndex::Field::clv_timecode() const {
+  if (clv[0] < 0) return std::nullopt;
+  return CLVTimecode{clv[0], clv[1], clv[2], clv[3]};
+}
+
+VBIIndex::Field VBIIndex::decode_field(const VideoFrameRepresentation& source,
+                                       FrameID frame, size_t field_index) {
+  const auto params = source.get_video_parameters();
+  if (!params || !source.has_frame(frame)) {
+    return make_field({-1, -1, -1});
+  }
+  return make_field(BiphaseObserver::decode_field_lines(source, frame,
+                                                        field_index, *params));
+}
+
+std::vector<VBIIndex> VBIIndex::build(
+    const std::vector<std::shared_ptr<const VideoFrameRepresentation>>&
+        sources,
+    const CancelCheck& cancelled, const ProgressCallback& progress,
+    uint64_t max_frames) {
+  std::vector<VBIIndex> indexes(sources.size());
+  std::vector<WorkItem> items;
+  uint64_t total_frames = 0;
+  for (size_t i = 0; i < sources.size(); ++i) {
+    if (!sources[i]) continue;
+    FrameIDRange range = sources[i]->frame_range();
+    if (range.empty()) continue;
+    if (max_frames > 0 && range.count() > max_frames) {
+      range.last = range.first + max_frames - 1;
+    }
+    indexes[i].frames_ = range;
+    indexes[i].fields_.resize(range.count() * 2);
+    total_frames += range.count();
+    for (FrameID first = range.first; first <= range.last;
+         first += kWindowFrames) {
+      items.push_back(
+          {i, {first, std::min(range.last, first + kWindowFrames - 1)}});
+    }
+  }
+
+  std::atomic<size_t> next_item{0};
+  std::atomic<uint64_t> frames_done{0};
+  std::atomic<bool> stop{false};
+
+  auto worker = [&]() {
+    // One batch per source per worker; load() replaces its window.
+    std::vector<std::unique_ptr<LineBatchRepresentation>> batches(
+        sources.size());
+    for (size_t n = next_item++; n < items.size() && !stop; n = next_item++) {
+      const WorkItem& item = items[n];
+      const auto& source = sources[item.source];
+      const auto params = source->get_video_parameters();
+      VBIIndex& index = indexes[item.source];
+
+      // YC sources decode from the luma plane, which the batch does not
+      // carry; they read line by line.
+      const VideoFrameRepresentation* reader = source.get();
+      if (params && !source->has_separate_channels()) {
+        auto& batch = batches[item.source];
+        if (!batch) {
+          batch = std::make_unique<LineBatchRepresentation>(
+              source, BiphaseObserver::frame_lines(params->system));
+        }
+        batch->load(item.frames);
+        reader = batch.get();
+      }
+
+      for (FrameID frame = item.frames.first; frame <= item.frames.last;
+           ++frame) {
+        const size_t slot = static_cast<size_t>(frame - index.frames_.first);
+        for (size_t f = 0; f < 2; ++f) {
+          index.fields_[slot * 2 + f] =
+              (params && source->has_frame(frame))
+                  ? make_field(BiphaseObserver::decode_field_lines(
+                        *reader, frame, f, *params))
+                  : make_field({-1, -1, -1});
+        }
+      }
+      frames_done += item.frames.count();
+    }
+  };
+
+  const size_t thread_count = std::max<size_t>(
+      1, std::min<size_t>(std::thread::hardware_concurrency(), items.size()));
+  std::vector<std::future<void>> workers;
+  workers.reserve(thread_count);
+  for (size_t t = 0; t < thread_count; ++t) {
+    workers.push_back(std::async(std::launch::async, worker));
+  }
+
+  bool was_cancelled = false;
+  for (auto& future : workers) {
+    while (future.wait_for(std::chrono::milliseconds(50)) !=
+           std::future_status::ready) {
+      if (!was_cancelled && cancelled && cancelled()) {
+        was_cancelled = true;
+        stop = true;
+      }
+      if (progress) progress(frames_done.load(), total_frames);
+    }
+  }
+  for (auto& future : workers) {
+    future.get();
+  }
+  if (was_cancelled || (cancelled && cancelled())) {
+    return {};
+  }
+  if (progress) progress(total_frames, total_frames);
+
+  ORC_LOG_DEBUG("VBI index: {} frames from {} source(s) on {} thread(s)",
+                total_frames, sources.size(), thread_count);
+  return indexes;
+}
+
+const VBIIndex::Field* VBIIndex::field(FieldID id) const {
+  if (!id.is_valid() || frames_.empty()) return nullptr;
+  const uint64_t first_field = frames_.first * 2;
+  if (id.value() < first_field) return nullptr;
+  const uint64_t slot = id.value() - first_field;
+  return slot < fields_.size() ? &fields_[static_cast<size_t>(slot)] : nullptr;
+}
+
+std::optional<int32_t> VBIIndex::frame_number(FrameID frame,
+                                              bool is_pal) const {
+  for (size_t f = 0; f < 2; ++f) {
+    const Field* entry = field(frame, f);
+    if (!entry) return std::nullopt;
+    if (auto picture = entry->cav_picture_number()) {
+      return picture;
+    }
+    if (auto clv = entry->clv_timecode()) {
+      const int32_t fps = is_pal ? 25 : 30;
+      return clv->hours * 3600 * fps + clv->minutes * 60 * fps +
+             clv->seconds * fps + clv->picture_number;
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace orc
@@ -0,0 +1,106 @@
+/*
+ * File:        vbi_index.h
+ * Module:      analysis
+ * Purpose:     Compact per-field VBI address index built from lines 16-18 only
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#ifndef ORC_CORE_ANALYSIS_VBI_INDEX_H
+#define ORC_CORE_ANALYSIS_VBI_INDEX_H
+
+#include <orc/stage/field_id.h>
+#include <orc/stage/frame_id.h>
+#include <orc/support/vbi_types.h>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace orc {
+
+class VideoFrameRepresentation;
+
+// Per-field picture numbers, chapters, CLV times and lead-in/out flags for
+// whole sources, decoded from the three biphase VBI lines and nothing else.
+// The disc mapper, source alignment and frame-map range search read this
+// instead of running observers over rendered frames: a build reads a few KB
+// per field (through VideoFrameRepresentation::read_lines) and indexes every
+// source in parallel.
+//
+// Fields are addressed like BiphaseObserver observations: FieldID(frame * 2)
+// is the first field of a frame and FieldID(frame * 2 + 1) the second.
+class VBIIndex {
+ public:
+  // One field's codes; 28 bytes.
+  struct Field {
+    // Raw biphase codes of lines 16, 17 and 18: 0 where no code was found,
+    // -1 where the line could not be read.
+    std::array<int32_t, 3> lines{0, 0, 0};
+    int32_t picture_number = -1;  // CAV picture number
+    int32_t chapter_number = -1;
+    std::array<int8_t, 4> clv{-1, -1, -1, -1};  // hours, min, sec, picture
+    uint8_t flags = 0;
+
+    static constexpr uint8_t kLeadIn = 1;
+    static constexpr uint8_t kLeadOut = 2;
+    static constexpr uint8_t kStopCode = 4;
+
+    // True when at least one line carried a biphase code.
+    bool has_vbi() const;
+    bool lead_in() const { return (flags & kLeadIn) != 0; }
+    bool lead_out() const { return (flags & kLeadOut) != 0; }
+    bool stop_code() const { return (flags & kStopCode) != 0; }
+    std::optional<int32_t> cav_picture_number() const;
+    std::optional<int32_t> chapter() const;
+    std::optional<CLVTimecode> clv_timecode() const;
+  };
+
+  using CancelCheck = std::function<bool()>;
+  // Frames indexed so far and in total, across every source being built.
+  // Always called on the thread that called build().
+  using ProgressCallback = std::function<void(uint64_t done, uint64_t total)>;
+
+  VBIIndex() = default;
+
+  // Decodes one field straight from |source|, for callers that only probe a
+  // handful of frames. Lines are -1 when the source has no video parameters.
+  static Field decode_field(const VideoFrameRepresentation& source,
+                            FrameID frame, size_t field_index);
+
+  // Indexes every source, splitting the work across threads by source and by
+  // window of frames. |max_frames| > 0 limits each source to its first
+  // max_frames frames (a quick scan). Returns one index per source, in
+  // order, or an empty vector when |cancelled| fired.
+  static std::vector<VBIIndex> build(
+      const std::vector<std::shared_ptr<const VideoFrameRepresentation>>&
+          sources,
+      const CancelCheck& cancelled = nullptr,
+      const ProgressCallback& progress = nullptr, uint64_t max_frames = 0);
+
+  // Frames covered; empty for a default-constructed index.
+  FrameIDRange frame_range() const { return frames_; }
+
+  // nullptr outside frame_range().
+  const Field* field(FieldID id) const;
+  const Field* field(FrameID frame, size_t field_index) const {
+    return field(FieldID(frame * 2 + field_index));
+  }
+
+  // CAV picture number of |frame|, or its CLV time as a frame count from
+  // 0:00:00.00 (25 or 30 frames per second), taken from the first field that
+  // carries one.
+  std::optional<int32_t> frame_number(FrameID frame, bool is_pal) const;
+
+ private:
+  FrameIDRange frames_{1, 0};
+  std::vector<Field> fields_;
+};
+
+}  // namespace orc
+
+#endif  // ORC_CORE_ANALYSIS_VBI_INDEX_H
@@ -0,0 +1,455 @@
+/*
+ * File:        async_file_writer.cpp
+ * Module:      orc-core
+ * Purpose:     Asynchronous multi-buffered file writer for sink outputs
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "async_file_writer.h"
+
+#include <orc/support/logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace orc {
+
+namespace {
+
+// O_DIRECT needs buffer addresses, lengths and file offsets aligned to the
+// logical block size; 4 KiB covers current devices.
+constexpr size_t kIoAlignment = 4096;
+
+struct AlignedDelete {
+  void operator()(uint8_t* data) const {
+    ::operator delete(data, std::align_val_t{kIoAlignment});
+  }
+};
+
+struct Buffer {
+  std::unique_ptr<uint8_t, AlignedDelete> data;
+  size_t used = 0;
+};
+
+// Platform file descriptor. Only the I/O thread writes; open, truncate and
+// close run while it is stopped.
+class OutputFile {
+ public:
+  bool open(const std::string& path, bool direct_io) {
+#if defined(_WIN32)
+    (void)direct_io;
+    fd_ = ::_open(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY,
+                  _S_IREAD | _S_IWRITE);
+    return fd_ >= 0;
+#else
+    int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+    aligned_ = false;
+#ifdef O_DIRECT
+    if (direct_io) {
+      fd_ = ::open(path.c_str(), flags | O_DIRECT, 0644);
+      if (fd_ >= 0) {
+        aligned_ = true;
+        return true;
+      }
+      // tmpfs and some network filesystems reject O_DIRECT.
+      ORC_LOG_DEBUG("AsyncFileWriter: O_DIRECT unavailable for {}: {}", path,
+                    std::strerror(errno));
+    }
+#endif
+    fd_ = ::open(path.c_str(), flags, 0644);
+#ifdef F_NOCACHE
+    // macOS: uncached I/O without alignment rules.
+    if (fd_ >= 0 && direct_io) {
+      ::fcntl(fd_, F_NOCACHE, 1);
+    }
+#endif
+    return fd_ >= 0;
+#endif
+  }
+
+  /// True while writes must be whole, aligned blocks (O_DIRECT).
+  bool aligned() const { return aligned_; }
+
+  /// Leave O_DIRECT for the rest of the file, before an unaligned tail.
+  void end_aligned() {
+#ifdef O_DIRECT
+    if (aligned_) {
+      ::fcntl(fd_, F_SETFL, ::fcntl(fd_, F_GETFL) & ~O_DIRECT);
+      aligned_ = false;
+    }
+#endif
+  }
+
+  /// Reserve @p bytes without changing the file size. posix_fallocate() is
+  /// avoided because it falls back to writing zeros where the filesystem
+  /// cannot reserve space, doubling the I/O of a large export.
+  bool preallocate(uint64_t bytes) {
+#if defined(__linux__)
+    if (::fallocate(fd_, FALLOC_FL_KEEP_SIZE, 0,
+                    static_cast<off_t>(bytes)) == 0) {
+      return true;
+    }
+    ORC_LOG_DEBUG("AsyncFileWriter: preallocation unavailable: {}",
+                  std::strerror(errno));
+#else
+    (void)bytes;
+#endif
+    return false;
+  }
+
+  bool write_all(const uint8_t* data, size_t bytes) {
+    while (bytes > 0) {
+#if defined(_WIN32)
+      const int chunk = ::_write(
+          fd_, data, static_cast<unsigned>(std::min<size_t>(bytes, 1U << 30)));
+#else
+      const ssize_t chunk = ::write(fd_, data, bytes);
+#endif
+      if (chunk < 0) {
+        if (errno == EINTR) continue;
+        return false;
+      }
+      data += chunk;
+      bytes -= static_cast<size_t>(chunk);
+    }
+    return true;
+  }
+
+  /// Start writeback of a range without waiting for it.
+  void start_writeback(uint64_t offset, uint64_t bytes) {
+#if defined(__linux__)
+    ::sync_file_range(fd_, static_cast<off_t>(offset),
+                      static_cast<off_t>(bytes), SYNC_FILE_RANGE_WRITE);
+#else
+    (void)offset;
+    (void)bytes;
+#endif
+  }
+
+  /// Wait for an earlier range to reach the disk and drop it from the page
+  /// cache; nothing reads it back during an export.
+  void finish_writeback(uint64_t offset, uint64_t bytes) {
+#if defined(__linux__)
+    ::sync_file_range(fd_, static_cast<off_t>(offset),
+                      static_cast<off_t>(bytes),
+                      SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE |
+                          SYNC_FILE_RANGE_WAIT_AFTER);
+    ::posix_fadvise(fd_, static_cast<off_t>(offset), static_cast<off_t>(bytes),
+                    POSIX_FADV_DONTNEED);
+#else
+    (void)offset;
+    (void)bytes;
+#endif
+  }
+
+  bool truncate(uint64_t size) {
+#if defined(_WIN32)
+    return ::_chsize_s(fd_, static_cast<__int64>(size)) == 0;
+#else
+    return ::ftruncate(fd_, static_cast<off_t>(size)) == 0;
+#endif
+  }
+
+  bool close() {
+#if defined(_WIN32)
+    const bool ok = ::_close(fd_) == 0;
+#else
+    const bool ok = ::close(fd_) == 0;
+#endif
+    fd_ = -1;
+    aligned_ = false;
+    return ok;
+  }
+
+ private:
+  int fd_ = -1;
+  bool aligned_ = false;
+};
+
+}  // namespace
+
+struct AsyncFileOutput::State {
+  explicit State(const AsyncFileWriterOptions& opts)
+      : options(opts),
+        buffer_bytes((std::max(opts.buffer_size, kIoAlignment) +
+                      kIoAlignment - 1) /
+                     kIoAlignment * kIoAlignment),
+        buffers(std::max<uint32_t>(opts.buffer_count, 2)) {}
+
+  const AsyncFileWriterOptions options;
+  const size_t buffer_bytes;
+  std::vector<Buffer> buffers;  // allocated on first open()
+
+  // Producer side
+  OutputFile file;
+  std::string filepath;
+  bool is_open = false;
+  uint64_t preallocated = 0;
+  Buffer* current = nullptr;  // being filled
+
+  std::mutex mutex;
+  std::condition_variable wake_io;
+  std::condition_variable wake_producer;
+  std::deque<Buffer*> free_buffers;  // guarded by mutex
+  std::deque<Buffer*> pending;       // guarded by mutex
+  bool writing = false;              // guarded by mutex
+  bool stopping = false;             // guarded by mutex
+  std::string error;                 // guarded by mutex; sticky
+  std::atomic<uint64_t> bytes_written{0};
+  std::thread io_thread;
+
+  // I/O thread only: sync_file_range() throttling
+  uint64_t writeback_start = 0;
+  uint64_t unsynced = 0;
+  uint64_t previous_start = 0;
+  uint64_t previous_bytes = 0;
+
+  void throw_if_failed_locked() const {
+    if (!error.empty()) {
+      throw std::runtime_error("AsyncFileWriter: " + error);
+    }
+  }
+
+  Buffer* acquire() {
+    std::unique_lock<std::mutex> lock(mutex);
+    wake_producer.wait(
+        lock, [this] { return !free_buffers.empty() || !error.empty(); });
+    throw_if_failed_locked();
+    Buffer* buffer = free_buffers.front();
+    free_buffers.pop_front();
+    return buffer;
+  }
+
+  void submit(Buffer* buffer) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pending.push_back(buffer);
+    }
+    wake_io.notify_one();
+  }
+
+  void wait_idle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    wake_producer.wait(lock, [this] { return pending.empty() && !writing; });
+    throw_if_failed_locked();
+  }
+
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+      wake_io.wait(lock, [this] { return !pending.empty() || stopping; });
+      if (pending.empty()) {
+        return;
+      }
+      Buffer* buffer = pending.front();
+      pending.pop_front();
+      writing = true;
+      // After a failure, buffers are only recycled so the producer wakes up
+      // and sees the error.
+      const bool failed = !error.empty();
+      lock.unlock();
+
+      std::string failure;
+      if (!failed) {
+        failure = write_buffer(*buffer);
+      }
+
+      lock.lock();
+      if (!failure.empty()) {
+        error = std::move(failure);
+      }
+      buffer->used = 0;
+      free_buffers.push_back(buffer);
+      writing = false;
+      wake_producer.notify_all();
+    }
+  }
+
+  std::string write_buffer(const Buffer& buffer) {
+    if (file.aligned() && buffer.used % kIoAlignment != 0) {
+      file.end_aligned();
+    }
+    if (!file.write_all(buffer.data.get(), buffer.used)) {
+      const int err = errno;
+      return "Failed to write to file: " + filepath + " (" +
+             std::strerror(err) + ")";
+    }
+    bytes_written.fetch_add(buffer.used, std::memory_order_relaxed);
+    throttle(buffer.used);
+    return {};
+  }
+
+  // Keep at most two writeback intervals of dirty pages: start writeback of
+  // each completed interval and wait for the one before it.
+  void throttle(uint64_t bytes) {
+    if (options.writeback_interval == 0 || file.aligned()) {
+      return;
+    }
+    unsynced += bytes;
+    if (unsynced < options.writeback_interval) {
+      return;
+    }
+    file.start_writeback(writeback_start, unsynced);
+    if (previous_bytes > 0) {
+      file.finish_writeback(previous_start, previous_bytes);
+    }
+    previous_start = writeback_start;
+    previous_bytes = unsynced;
+    writeback_start += unsynced;
+    unsynced = 0;
+  }
+};
+
+AsyncFileOutput::AsyncFileOutput(const AsyncFileWriterOptions& options)
+    : state_(std::make_unique<State>(options)) {}
+
+AsyncFileOutput::~AsyncFileOutput() {
+  try {
+    close();
+  } catch (...) {  // NOLINT(bugprone-empty-catch)
+    // Suppress exceptions in destructor
+  }
+}
+
+bool AsyncFileOutput::open(const std::string& filepath) {
+  State& s = *state_;
+  if (s.is_open) {
+    close();
+  }
+  if (!s.file.open(filepath, s.options.direct_io)) {
+    return false;
+  }
+
+  s.free_buffers.clear();
+  for (Buffer& buffer : s.buffers) {
+    if (!buffer.data) {
+      buffer.data.reset(static_cast<uint8_t*>(
+          ::operator new(s.buffer_bytes, std::align_val_t{kIoAlignment})));
+    }
+    buffer.used = 0;
+    s.free_buffers.push_back(&buffer);
+  }
+  s.pending.clear();
+  s.current = nullptr;
+  s.writing = false;
+  s.stopping = false;
+  s.error.clear();
+  s.bytes_written = 0;
+  s.writeback_start = s.unsynced = s.previous_start = s.previous_bytes = 0;
+
+  s.preallocated = 0;
+  if (s.options.expected_size > 0 &&
+      s.file.preallocate(s.options.expected_size)) {
+    s.preallocated = s.options.expected_size;
+  }
+
+  s.filepath = filepath;
+  s.is_open = true;
+  s.io_thread = std::thread([&s] { s.run(); });
+  return true;
+}
+
+void AsyncFileOutput::write(const void* data, size_t bytes) {
+  State& s = *state_;
+  if (!s.is_open) {
+    throw std::runtime_error("AsyncFileWriter: File not open");
+  }
+
+  const auto* source = static_cast<const uint8_t*>(data);
+  while (bytes > 0) {
+    if (!s.current) {
+      s.current = s.acquire();
+    }
+    const size_t chunk = std::min(bytes, s.buffer_bytes - s.current->used);
+    std::memcpy(s.current->data.get() + s.current->used, source, chunk);
+    s.current->used += chunk;
+    source += chunk;
+    bytes -= chunk;
+    if (s.current->used == s.buffer_bytes) {
+      s.submit(s.current);
+      s.current = nullptr;
+    }
+  }
+}
+
+void AsyncFileOutput::flush() {
+  State& s = *state_;
+  if (!s.is_open) {
+    throw std::runtime_error("AsyncFileWriter: File not open");
+  }
+  if (s.current && s.current->used > 0) {
+    s.submit(s.current);
+    s.current = nullptr;
+  }
+  s.wait_idle();
+}
+
+void AsyncFileOutput::close() {
+  State& s = *state_;
+  if (!s.is_open) {
+    return;
+  }
+
+  std::string failure;
+  try {
+    flush();
+  } catch (const std::exception& e) {
+    failure = e.what();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.stopping = true;
+  }
+  s.wake_io.notify_one();
+  s.io_thread.join();
+  s.current = nullptr;
+
+  // FALLOC_FL_KEEP_SIZE left the file size alone; truncating to it releases
+  // any reserved blocks past the end.
+  if (s.preallocated > 0 &&
+      !s.file.truncate(s.bytes_written.load(std::memory_order_relaxed)) &&
+      failure.empty()) {
+    failure = "AsyncFileWriter: Failed to release preallocated space: " +
+              s.filepath;
+  }
+  if (!s.file.close() && failure.empty()) {
+    failure = "AsyncFileWriter: Failed to close file: " + s.filepath;
+  }
+  s.is_open = false;
+
+  if (!failure.empty()) {
+    throw std::runtime_error(failure);
+  }
+}
+
+uint64_t AsyncFileOutput::bytes_written() const {
+  return state_->bytes_written.load(std::memory_order_relaxed);
+}
+
+bool AsyncFileOutput::is_open() const { return state_->is_open; }
+
+const std::string& AsyncFileOutput::filepath() const {
+  return state_->filepath;
+}
+
+}  // namespace orc
@@ -0,0 +1,258 @@
+/*
+ * File:        core_blob_store.cpp
+ * Module:      orc-core
+ * Purpose:     Host implementation of the plugin-facing IBlobStore with
+ *              project sidecar files
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "core_blob_store.h"
+
+#include <orc/support/logging.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "sha256_hash.h"
+
+namespace orc {
+
+namespace {
+
+std::string make_ref(const std::string& text) {
+  return std::string(kBlobRefPrefix) + sha256_hex(text);
+}
+
+// Write @p text to @p path through a temporary file, so a reader never sees
+// a partial sidecar.
+bool write_file_atomically(const std::filesystem::path& path,
+                           const std::string& text, std::string& error) {
+  std::error_code ec;
+  std::filesystem::create_directories(path.parent_path(), ec);
+  const std::string temp_path = path.string() + ".tmp";
+  {
+    std::ofstream out(temp_path, std::ios::trunc | std::ios::binary);
+    if (!out) {
+      error = "cannot open '" + temp_path + "' for writing";
+      return false;
+    }
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    out.close();
+    if (!out) {
+      error = "failed writing '" + temp_path + "'";
+      return false;
+    }
+  }
+  std::filesystem::rename(temp_path, path, ec);
+  if (ec) {
+    std::filesystem::remove(temp_path, ec);
+    error = "cannot create '" + path.string() + "'";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+CoreBlobStore::CoreBlobStore(size_t resident_limit)
+    : resident_limit_(resident_limit) {}
+
+CoreBlobStore::~CoreBlobStore() {
+  if (!spill_directory_.empty()) {
+    std::error_code ec;
+    std::filesystem::remove_all(spill_directory_, ec);
+  }
+}
+
+std::shared_ptr<const std::string> CoreBlobStore::get(
+    const std::string& ref) const {
+  std::string path;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(ref);
+    if (it == entries_.end()) {
+      return nullptr;
+    }
+    if (it->second.data) {
+      touch_locked(it->second, 0);
+      return it->second.data;
+    }
+    path = it->second.sidecar_path;
+  }
+
+  // Read outside the lock; a concurrent first get() of the same blob reads
+  // it too and the second store is a no-op.
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    ORC_LOG_WARN("Blob store: sidecar '{}' for {} cannot be opened", path,
+                 ref);
+    return nullptr;
+  }
+  auto text = std::make_shared<const std::string>(
+      std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  if (make_ref(*text) != ref) {
+    ORC_LOG_WARN("Blob store: sidecar '{}' does not match its hash", path);
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& entry = entries_[ref];
+  if (!entry.data) {
+    entry.data = std::move(text);
+    touch_locked(entry, entry.data->size());
+  } else {
+    touch_locked(entry, 0);
+  }
+  auto data = entry.data;
+  evict_locked();
+  return data;
+}
+
+std::string CoreBlobStore::put(std::string text) {
+  std::string ref = make_ref(text);
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& entry = entries_[ref];
+  if (!entry.data) {
+    entry.data = std::make_shared<const std::string>(std::move(text));
+    touch_locked(entry, entry.data->size());
+    evict_locked();
+  } else {
+    touch_locked(entry, 0);
+  }
+  return ref;
+}
+
+void CoreBlobStore::add_sidecar(const std::string& ref,
+                                const std::string& path) {
+  if (!is_blob_ref(ref)) {
+    ORC_LOG_WARN("Blob store: ignoring invalid blob reference '{}'", ref);
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& entry = entries_[ref];
+  if (!entry.data) {
+    entry.sidecar_path = path;
+  }
+}
+
+bool CoreBlobStore::write_sidecar(const std::string& ref,
+                                  const std::string& directory,
+                                  std::string& error) const {
+  if (!is_blob_ref(ref)) {
+    error = "'" + ref + "' is not a valid blob reference";
+    return false;
+  }
+  const std::filesystem::path path =
+      std::filesystem::path(directory) / sidecar_file_name(ref);
+  std::error_code ec;
+  if (!std::filesystem::exists(path, ec)) {
+    const auto text = get(ref);
+    if (!text) {
+      error = "contents of " + ref + " are not available";
+      return false;
+    }
+    if (!write_file_atomically(path, *text, error)) {
+      return false;
+    }
+  }
+
+  // The saved file replaces a scratch spill as the blob's sidecar.
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(ref);
+  if (it != entries_.end()) {
+    it->second.sidecar_path = path.string();
+  }
+  return true;
+}
+
+size_t CoreBlobStore::resident_bytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return resident_bytes_;
+}
+
+void CoreBlobStore::touch_locked(Entry& entry, size_t added_bytes) const {
+  entry.last_use = ++use_clock_;
+  resident_bytes_ += added_bytes;
+}
+
+void CoreBlobStore::evict_locked() const {
+  if (resident_bytes_ <= resident_limit_) {
+    return;
+  }
+
+  // Blobs still held by a caller are skipped: dropping our reference would
+  // free nothing and the next get() would load a second copy.
+  std::vector<std::pair<uint64_t, std::string>> candidates;
+  for (const auto& [ref, entry] : entries_) {
+    if (entry.data && entry.data.use_count() == 1) {
+      candidates.emplace_back(entry.last_use, ref);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+
+  for (const auto& candidate : candidates) {
+    if (resident_bytes_ <= resident_limit_) {
+      break;
+    }
+    auto& entry = entries_.at(candidate.second);
+    if (entry.sidecar_path.empty() && !spill_locked(candidate.second, entry)) {
+      continue;
+    }
+    resident_bytes_ -= entry.data->size();
+    entry.data.reset();
+  }
+}
+
+bool CoreBlobStore::spill_locked(const std::string& ref, Entry& entry) const {
+  if (spill_directory_.empty()) {
+    std::random_device random;
+    spill_directory_ = (std::filesystem::temp_directory_path() /
+                        ("orc-blobs-" + std::to_string(random()) + "-" +
+                         std::to_string(random())))
+                           .string();
+  }
+  const auto path =
+      std::filesystem::path(spill_directory_) / sidecar_file_name(ref);
+  std::string error;
+  if (!write_file_atomically(path, *entry.data, error)) {
+    ORC_LOG_WARN("Blob store: cannot spill {}: {}", ref, error);
+    return false;
+  }
+  entry.sidecar_path = path.string();
+  return true;
+}
+
+std::string CoreBlobStore::sidecar_file_name(const std::string& ref) {
+  return ref.substr(kBlobRefPrefix.size()) + ".blob";
+}
+
+CoreBlobStore& host_blob_store() {
+  static CoreBlobStore store;
+  return store;
+}
+
+std::map<std::string, ParameterValue> resolve_blob_parameters(
+    const std::map<std::string, ParameterValue>& parameters) {
+  auto resolved = parameters;
+  for (auto& [name, value] : resolved) {
+    const auto* text = std::get_if<std::string>(&value);
+    if (!text || !is_blob_ref(*text)) {
+      continue;
+    }
+    if (auto blob = host_blob_store().get(*text)) {
+      value = *blob;
+    } else {
+      ORC_LOG_WARN("Parameter '{}': {} is not available", name, *text);
+    }
+  }
+  return resolved;
+}
+
+}  // namespace orc
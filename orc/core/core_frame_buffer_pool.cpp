@@ -0,0 +1,272 @@
+/*
+ * File:        core_frame_buffer_pool.cpp
+ * Module:      orc-core
+ * Purpose:     Host implementation of the plugin-facing IFrameBufferPool
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "core_frame_buffer_pool.h"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <utility>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+namespace orc {
+
+namespace {
+
+using Buffer = std::vector<int16_t>;
+using BufferPtr = std::unique_ptr<Buffer>;
+
+size_t size_class_for_request(size_t samples) {
+  const size_t granule = CoreFrameBufferPool::kSizeClassSamples;
+  return (samples + granule - 1) / granule;
+}
+
+// Class of a parked buffer. Buffers are reserved at their class capacity, so
+// rounding down recovers the class even if the allocator over-reserved.
+size_t size_class_for_capacity(size_t capacity) {
+  return capacity / CoreFrameBufferPool::kSizeClassSamples;
+}
+
+size_t buffer_bytes(const Buffer& buffer) {
+  return buffer.capacity() * sizeof(int16_t);
+}
+
+}  // namespace
+
+struct CoreFrameBufferPool::State {
+  State(size_t capacity, size_t slots)
+      : capacity_bytes(capacity), magazine_slots(slots) {}
+
+  const size_t capacity_bytes;
+  const size_t magazine_slots;
+
+  std::mutex mutex;
+  std::unordered_map<size_t, std::vector<BufferPtr>> depot;  // by size class
+  size_t depot_bytes = 0;  // guarded by mutex
+
+  std::atomic<uint64_t> allocations{0};
+  std::atomic<uint64_t> reuses{0};
+  std::atomic<uint64_t> magazine_hits{0};
+  std::atomic<uint64_t> recycles{0};
+  std::atomic<uint64_t> discards{0};
+  std::atomic<uint64_t> pooled_buffers{0};  // depot + magazines
+  std::atomic<uint64_t> pooled_bytes{0};
+
+  void note_parked(const Buffer& buffer) {
+    pooled_buffers.fetch_add(1, std::memory_order_relaxed);
+    pooled_bytes.fetch_add(buffer_bytes(buffer), std::memory_order_relaxed);
+  }
+
+  void note_unparked(const Buffer& buffer) {
+    pooled_buffers.fetch_sub(1, std::memory_order_relaxed);
+    pooled_bytes.fetch_sub(buffer_bytes(buffer), std::memory_order_relaxed);
+  }
+
+  // Parks |buffer| in the depot; returns false (freeing it) if the depot is
+  // full. |from_magazine| marks a buffer already counted as pooled.
+  bool park(BufferPtr buffer, bool from_magazine) {
+    const size_t bytes = buffer_bytes(*buffer);
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (depot_bytes + bytes <= capacity_bytes) {
+        depot_bytes += bytes;
+        if (!from_magazine) note_parked(*buffer);
+        depot[size_class_for_capacity(buffer->capacity())].push_back(
+            std::move(buffer));
+        return true;
+      }
+    }
+    if (from_magazine) note_unparked(*buffer);
+    return false;
+  }
+
+  BufferPtr take_from_depot(size_t size_class) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = depot.find(size_class);
+    if (it == depot.end() || it->second.empty()) return nullptr;
+    BufferPtr buffer = std::move(it->second.back());
+    it->second.pop_back();
+    depot_bytes -= buffer_bytes(*buffer);
+    note_unparked(*buffer);
+    return buffer;
+  }
+
+  void clear_depot() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& [size_class, buffers] : depot) {
+      for (const auto& buffer : buffers) note_unparked(*buffer);
+    }
+    depot.clear();
+    depot_bytes = 0;
+  }
+};
+
+namespace {
+
+using State = CoreFrameBufferPool::State;
+
+// Per-thread cache of recently released buffers, bound to one pool at a time.
+// A thread that switches pools flushes its buffers back to the previous one.
+struct Magazine {
+  std::weak_ptr<State> owner;
+  std::vector<BufferPtr> slots;
+
+  ~Magazine();
+
+  // Binds the magazine to |state|, flushing buffers that belong to another
+  // pool back to it first.
+  void bind(const std::shared_ptr<State>& state) {
+    if (owner.lock() == state) return;
+    flush();
+    owner = state;
+  }
+
+  void flush() {
+    auto state = owner.lock();
+    for (auto& buffer : slots) {
+      if (state) state->park(std::move(buffer), /*from_magazine=*/true);
+    }
+    slots.clear();
+    owner.reset();
+  }
+
+  BufferPtr take(size_t size_class) {
+    for (auto it = slots.begin(); it != slots.end(); ++it) {
+      if (size_class_for_capacity((*it)->capacity()) == size_class) {
+        BufferPtr buffer = std::move(*it);
+        slots.erase(it);
+        return buffer;
+      }
+    }
+    return nullptr;
+  }
+};
+
+// Trivially destructible, so it stays readable while other thread_local
+// destructors (which may release buffers) run after the magazine is gone.
+thread_local bool t_magazine_destroyed = false;
+thread_local Magazine t_magazine;
+
+Magazine::~Magazine() {
+  flush();
+  t_magazine_destroyed = true;
+}
+
+// Custom deleter of pooled buffers: hands the storage back to the pool.
+struct Recycler {
+  std::weak_ptr<State> pool;
+
+  void operator()(Buffer* raw) const {
+    BufferPtr buffer(raw);
+    auto state = pool.lock();
+    if (!state) return;
+
+    if (!t_magazine_destroyed) {
+      t_magazine.bind(state);
+      if (t_magazine.slots.size() < state->magazine_slots) {
+        state->note_parked(*buffer);
+        t_magazine.slots.push_back(std::move(buffer));
+        state->recycles.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+    }
+
+    if (state->park(std::move(buffer), /*from_magazine=*/false)) {
+      state->recycles.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      state->discards.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+};
+
+}  // namespace
+
+CoreFrameBufferPool::CoreFrameBufferPool(size_t capacity_bytes,
+                                         size_t magazine_slots)
+    : state_(std::make_shared<State>(capacity_bytes, magazine_slots)) {}
+
+CoreFrameBufferPool::~CoreFrameBufferPool() {
+  // Outstanding buffers and other threads' magazines hold weak references
+  // only; they free their storage once the state is gone.
+  trim();
+}
+
+std::shared_ptr<std::vector<int16_t>> CoreFrameBufferPool::acquire(
+    size_t samples) {
+  if (samples == 0) return nullptr;
+  const size_t size_class = size_class_for_request(samples);
+
+  try {
+    BufferPtr buffer;
+    if (!t_magazine_destroyed) {
+      t_magazine.bind(state_);
+      buffer = t_magazine.take(size_class);
+      if (buffer) {
+        state_->note_unparked(*buffer);
+        state_->magazine_hits.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+    if (!buffer) buffer = state_->take_from_depot(size_class);
+
+    if (buffer) {
+      state_->reuses.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      buffer = std::make_unique<Buffer>();
+      buffer->reserve(size_class * kSizeClassSamples);
+      state_->allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    // Recycled buffers keep their previous size, so re-acquiring the same
+    // frame size is a no-op rather than a fill.
+    buffer->resize(samples);
+    return std::shared_ptr<Buffer>(buffer.release(),
+                                   Recycler{std::weak_ptr<State>(state_)});
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+FrameBufferPoolStats CoreFrameBufferPool::stats() const {
+  FrameBufferPoolStats stats;
+  stats.allocations = state_->allocations.load(std::memory_order_relaxed);
+  stats.reuses = state_->reuses.load(std::memory_order_relaxed);
+  stats.magazine_hits = state_->magazine_hits.load(std::memory_order_relaxed);
+  stats.recycles = state_->recycles.load(std::memory_order_relaxed);
+  stats.discards = state_->discards.load(std::memory_order_relaxed);
+  stats.pooled_buffers =
+      state_->pooled_buffers.load(std::memory_order_relaxed);
+  stats.pooled_bytes = state_->pooled_bytes.load(std::memory_order_relaxed);
+#ifndef _WIN32
+  struct rusage usage {};
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    stats.minor_faults = static_cast<uint64_t>(usage.ru_minflt);
+    stats.major_faults = static_cast<uint64_t>(usage.ru_majflt);
+  }
+#endif
+  return stats;
+}
+
+void CoreFrameBufferPool::trim() {
+  if (!t_magazine_destroyed && t_magazine.owner.lock() == state_) {
+    for (const auto& buffer : t_magazine.slots) state_->note_unparked(*buffer);
+    t_magazine.slots.clear();
+    t_magazine.owner.reset();
+  }
+  state_->clear_depot();
+}
+
+CoreFrameBufferPool& host_frame_buffer_pool() {
+  static CoreFrameBufferPool pool;
+  return pool;
+}
+
+}  // namespace orc
@@ -0,0 +1,436 @@
+/*
+ * File:        core_metrics.cpp
+ * Module:      orc-core
+ * Purpose:     Host implementation of the plugin-facing IMetricsRegistry with
+ *              Prometheus text export
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "core_metrics.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <new>
+#include <sstream>
+
+#include "core_frame_buffer_pool.h"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+// psapi.h needs the Windows types.
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace orc {
+
+namespace {
+
+constexpr std::array<double, 16> kLatencyBuckets = {
+    0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025,
+    0.05,   0.1,     0.25,   0.5,   1.0,    2.5,   5.0,  10.0};
+
+// C++17 has no atomic<double>::fetch_add.
+void atomic_add(std::atomic<double>& target, double delta) {
+  double current = target.load(std::memory_order_relaxed);
+  while (!target.compare_exchange_weak(current, current + delta,
+                                       std::memory_order_relaxed)) {
+  }
+}
+
+struct Instrument {
+  explicit Instrument(MetricKind k) : kind(k) {}
+  virtual ~Instrument() = default;
+  const MetricKind kind;
+};
+
+class Counter final : public Instrument, public IMetricCounter {
+ public:
+  Counter() : Instrument(MetricKind::Counter) {}
+  void add(uint64_t delta) override {
+    value.fetch_add(delta, std::memory_order_relaxed);
+  }
+  std::atomic<uint64_t> value{0};
+};
+
+class Gauge final : public Instrument, public IMetricGauge {
+ public:
+  Gauge() : Instrument(MetricKind::Gauge) {}
+  void set(double v) override { value.store(v, std::memory_order_relaxed); }
+  void add(double delta) override { atomic_add(value, delta); }
+  std::atomic<double> value{0.0};
+};
+
+class Histogram final : public Instrument, public IMetricHistogram {
+ public:
+  Histogram() : Instrument(MetricKind::Histogram) {}
+  void observe(double seconds) override {
+    if (!(seconds >= 0.0)) seconds = 0.0;  // also catches NaN
+    const auto bucket = static_cast<size_t>(
+        std::lower_bound(kLatencyBuckets.begin(), kLatencyBuckets.end(),
+                         seconds) -
+        kLatencyBuckets.begin());
+    counts[bucket].fetch_add(1, std::memory_order_relaxed);
+    atomic_add(sum, seconds);
+  }
+  // One slot per bucket plus the +Inf overflow; not cumulative.
+  std::array<std::atomic<uint64_t>, kLatencyBuckets.size() + 1> counts{};
+  std::atomic<double> sum{0.0};
+};
+
+struct Family {
+  MetricKind kind;
+  std::string help;
+};
+
+// "a=1,b=2" as the Prometheus label set {a="1",b="2"}, plus @p extra (an
+// already formatted label such as le="0.5").
+std::string prometheus_labels(const std::string& labels,
+                              const std::string& extra = {}) {
+  std::string out;
+  std::stringstream pairs(labels);
+  std::string pair;
+  while (std::getline(pairs, pair, ',')) {
+    const size_t eq = pair.find('=');
+    if (eq == std::string::npos || eq == 0) continue;
+    if (!out.empty()) out += ',';
+    out += pair.substr(0, eq) + "=\"";
+    for (const char c : pair.substr(eq + 1)) {
+      if (c == '\\' || c == '"') {
+        out += '\\';
+        out += c;
+      } else if (c == '\n') {
+        out += "\\n";
+      } else {
+        out += c;
+      }
+    }
+    out += '"';
+  }
+  if (!extra.empty()) {
+    if (!out.empty()) out += ',';
+    out += extra;
+  }
+  return out.empty() ? std::string() : "{" + out + "}";
+}
+
+std::string format_number(double value) {
+  if (std::isnan(value)) return "NaN";
+  if (std::isinf(value)) return value > 0 ? "+Inf" : "-Inf";
+  char text[32];
+  if (value == std::floor(value) && std::fabs(value) < 9.0e15) {
+    std::snprintf(text, sizeof(text), "%.0f", value);
+  } else {
+    std::snprintf(text, sizeof(text), "%.9g", value);
+  }
+  return text;
+}
+
+std::string help_text(const std::string& help) {
+  std::string out;
+  for (const char c : help) {
+    if (c == '\\') {
+      out += "\\\\";
+    } else if (c == '\n') {
+      out += "\\n";
+    } else {
+      out += c;
+    }
+  }
+  return out;
+}
+
+}  // namespace
+
+struct CoreMetricsRegistry::State {
+  mutable std::mutex mutex;
+  // Keyed by name then labels, so iteration order is the snapshot order.
+  std::map<std::pair<std::string, std::string>, std::unique_ptr<Instrument>>
+      series;                            // guarded by mutex
+  std::map<std::string, Family> families;  // guarded by mutex
+  std::vector<Collector> collectors;       // guarded by mutex
+
+  template <typename T>
+  T* find_or_create(MetricKind kind, const char* name, const char* help,
+                    const char* labels) {
+    if (!name || name[0] == '\0') return nullptr;
+    try {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto family = families.find(name);
+      if (family == families.end()) {
+        families.emplace(name, Family{kind, help ? help : ""});
+      } else if (family->second.kind != kind) {
+        return nullptr;
+      }
+      auto& slot = series[{name, labels ? labels : ""}];
+      if (!slot) slot = std::make_unique<T>();
+      return static_cast<T*>(slot.get());
+    } catch (const std::bad_alloc&) {
+      return nullptr;
+    }
+  }
+};
+
+CoreMetricsRegistry::CoreMetricsRegistry()
+    : state_(std::make_unique<State>()) {}
+
+CoreMetricsRegistry::~CoreMetricsRegistry() = default;
+
+IMetricCounter* CoreMetricsRegistry::counter(const char* name,
+                                             const char* help,
+                                             const char* labels) {
+  return state_->find_or_create<Counter>(MetricKind::Counter, name, help,
+                                         labels);
+}
+
+IMetricGauge* CoreMetricsRegistry::gauge(const char* name, const char* help,
+                                         const char* labels) {
+  return state_->find_or_create<Gauge>(MetricKind::Gauge, name, help, labels);
+}
+
+IMetricHistogram* CoreMetricsRegistry::histogram(const char* name,
+                                                 const char* help,
+                                                 const char* labels) {
+  return state_->find_or_create<Histogram>(MetricKind::Histogram, name, help,
+                                           labels);
+}
+
+void CoreMetricsRegistry::add_collector(Collector collector) {
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  state_->collectors.push_back(std::move(collector));
+}
+
+std::vector<MetricSample> CoreMetricsRegistry::snapshot() const {
+  std::vector<Collector> collectors;
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    collectors = state_->collectors;
+  }
+  // Collectors update gauges through the public lookups, so they run
+  // without the lock held.
+  for (const auto& collect : collectors) {
+    collect(const_cast<CoreMetricsRegistry&>(*this));
+  }
+
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  std::vector<MetricSample> samples;
+  samples.reserve(state_->series.size());
+  for (const auto& [key, instrument] : state_->series) {
+    MetricSample sample;
+    sample.name = key.first;
+    sample.labels = key.second;
+    sample.help = state_->families.at(key.first).help;
+    sample.kind = instrument->kind;
+    switch (instrument->kind) {
+      case MetricKind::Counter:
+        sample.value = static_cast<double>(
+            static_cast<const Counter&>(*instrument).value.load(
+                std::memory_order_relaxed));
+        break;
+      case MetricKind::Gauge:
+        sample.value = static_cast<const Gauge&>(*instrument).value.load(
+            std::memory_order_relaxed);
+        break;
+      case MetricKind::Histogram: {
+        const auto& histogram = static_cast<const Histogram&>(*instrument);
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < kLatencyBuckets.size(); ++i) {
+          cumulative += histogram.counts[i].load(std::memory_order_relaxed);
+          sample.buckets.emplace_back(kLatencyBuckets[i], cumulative);
+        }
+        cumulative += histogram.counts.back().load(std::memory_order_relaxed);
+        sample.count = cumulative;
+        sample.value = histogram.sum.load(std::memory_order_relaxed);
+        break;
+      }
+    }
+    samples.push_back(std::move(sample));
+  }
+  return samples;
+}
+
+std::string CoreMetricsRegistry::prometheus_text() const {
+  std::string out;
+  std::string family;
+  for (const MetricSample& sample : snapshot()) {
+    if (sample.name != family) {
+      family = sample.name;
+      const char* type = sample.kind == MetricKind::Counter ? "counter"
+                         : sample.kind == MetricKind::Gauge ? "gauge"
+                                                            : "histogram";
+      if (!sample.help.empty()) {
+        out += "# HELP " + family + " " + help_text(sample.help) + "\n";
+      }
+      out += "# TYPE " + family + " " + type + "\n";
+    }
+
+    if (sample.kind != MetricKind::Histogram) {
+      out += sample.name + prometheus_labels(sample.labels) + " " +
+             format_number(sample.value) + "\n";
+      continue;
+    }
+    for (const auto& [bound, count] : sample.buckets) {
+      out += sample.name + "_bucket" +
+             prometheus_labels(sample.labels,
+                               "le=\"" + format_number(bound) + "\"") +
+             " " + std::to_string(count) + "\n";
+    }
+    out += sample.name + "_bucket" +
+           prometheus_labels(sample.labels, "le=\"+Inf\"") + " " +
+           std::to_string(sample.count) + "\n";
+    out += sample.name + "_sum" + prometheus_labels(sample.labels) + " " +
+           format_number(sample.value) + "\n";
+    out += sample.name + "_count" + prometheus_labels(sample.labels) + " " +
+           std::to_string(sample.count) + "\n";
+  }
+  return out;
+}
+
+bool CoreMetricsRegistry::write_prometheus_textfile(const std::string& path,
+                                                    std::string& error) const {
+  const std::string text = prometheus_text();
+  const std::string temp_path = path + ".tmp";
+  {
+    std::ofstream out(temp_path, std::ios::trunc | std::ios::binary);
+    if (!out) {
+      error = "cannot open '" + temp_path + "' for writing";
+      return false;
+    }
+    out << text;
+    out.close();
+    if (!out) {
+      error = "failed writing '" + temp_path + "'";
+      return false;
+    }
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(temp_path, path, ec);
+  if (ec) {
+    std::filesystem::remove(temp_path, ec);
+    error = "cannot replace '" + path + "'";
+    return false;
+  }
+  return true;
+}
+
+uint64_t process_resident_bytes() {
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters{};
+  if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                              sizeof(counters))) {
+    return static_cast<uint64_t>(counters.WorkingSetSize);
+  }
+  return 0;
+#elif defined(__APPLE__)
+  mach_task_basic_info_data_t info{};
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+    return static_cast<uint64_t>(info.resident_size);
+  }
+  return 0;
+#else
+  // Second field of statm: resident pages.
+  std::ifstream statm("/proc/self/statm");
+  uint64_t size_pages = 0;
+  uint64_t resident_pages = 0;
+  if (!(statm >> size_pages >> resident_pages)) {
+    return 0;
+  }
+  const long page_size = sysconf(_SC_PAGESIZE);
+  return page_size > 0 ? resident_pages * static_cast<uint64_t>(page_size) : 0;
+#endif
+}
+
+namespace {
+
+// Advances |counter| to the pool's running |total|. Counters only accept
+// increments, so the collector publishes the growth since its last run.
+void publish_total(CoreMetricsRegistry& metrics, const char* name,
+                   const char* help, uint64_t total, uint64_t& published) {
+  if (total <= published) return;
+  if (auto* counter = metrics.counter(name, help, "")) {
+    counter->add(total - published);
+    published = total;
+  }
+}
+
+void collect_frame_pool_metrics(CoreMetricsRegistry& metrics) {
+  const FrameBufferPoolStats stats = host_frame_buffer_pool().stats();
+  if (auto* gauge =
+          metrics.gauge("orc_frame_pool_pooled_bytes",
+                        "Recycled frame buffer bytes held by the pool", "")) {
+    gauge->set(static_cast<double>(stats.pooled_bytes));
+  }
+  if (auto* gauge =
+          metrics.gauge("orc_frame_pool_pooled_buffers",
+                        "Recycled frame buffers held by the pool", "")) {
+    gauge->set(static_cast<double>(stats.pooled_buffers));
+  }
+
+  // Snapshots may run concurrently; the published totals are shared.
+  static std::mutex mutex;
+  static FrameBufferPoolStats published;
+  std::lock_guard<std::mutex> lock(mutex);
+  publish_total(metrics, "orc_frame_pool_allocations_total",
+                "Frame buffers freshly allocated from the heap",
+                stats.allocations, published.allocations);
+  publish_total(metrics, "orc_frame_pool_reuses_total",
+                "Frame buffer acquisitions served by a recycled buffer",
+                stats.reuses, published.reuses);
+  publish_total(metrics, "orc_frame_pool_magazine_hits_total",
+                "Frame buffer reuses served by a thread-local magazine",
+                stats.magazine_hits, published.magazine_hits);
+  publish_total(metrics, "orc_frame_pool_recycles_total",
+                "Released frame buffers kept for reuse", stats.recycles,
+                published.recycles);
+  publish_total(metrics, "orc_frame_pool_discards_total",
+                "Released frame buffers freed because the pool was full",
+                stats.discards, published.discards);
+  publish_total(metrics, "orc_frame_pool_minor_faults_total",
+                "Process minor page faults, sampled with the pool counters",
+                stats.minor_faults, published.minor_faults);
+  publish_total(metrics, "orc_frame_pool_major_faults_total",
+                "Process major page faults, sampled with the pool counters",
+                stats.major_faults, published.major_faults);
+}
+
+void collect_process_metrics(CoreMetricsRegistry& metrics) {
+  if (const uint64_t rss = process_resident_bytes()) {
+    if (auto* gauge = metrics.gauge("orc_process_resident_memory_bytes",
+                                    "Resident memory of the process", "")) {
+      gauge->set(static_cast<double>(rss));
+    }
+  }
+  collect_frame_pool_metrics(metrics);
+}
+
+}  // namespace
+
+CoreMetricsRegistry& host_metrics() {
+  static CoreMetricsRegistry registry;
+  static const bool collectors_added = [] {
+    registry.add_collector(collect_process_metrics);
+    return true;
+  }();
+  (void)collectors_added;
+  return registry;
+}
+
+}  // namespace orc
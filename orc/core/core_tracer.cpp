@@ -0,0 +1,290 @@
+/*
+ * File:        core_tracer.cpp
+ * Module:      orc-core
+ * Purpose:     Host implementation of the plugin-facing ITracer with Chrome
+ *              trace export
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "core_tracer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace orc {
+
+namespace {
+
+// Fixed-size copy of one span. 136 bytes, so a default ring is ~2 MiB.
+struct SpanRecord {
+  uint64_t start_ns;
+  uint64_t end_ns;
+  uint64_t frame;
+  char category[16];
+  char name[48];
+  char stage[48];
+};
+
+template <size_t N>
+void copy_text(char (&dest)[N], const char* text) {
+  size_t i = 0;
+  if (text) {
+    for (; i + 1 < N && text[i] != '\0'; ++i) dest[i] = text[i];
+  }
+  dest[i] = '\0';
+}
+
+std::atomic<uint64_t> g_next_tracer_id{1};
+
+struct ThreadRing {
+  explicit ThreadRing(uint32_t thread_index) : tid(thread_index) {}
+
+  const uint32_t tid;  // Chrome trace "tid" of this thread
+
+  std::mutex mutex;
+  std::vector<SpanRecord> spans;  // allocated by the first span recorded
+  size_t next = 0;                // guarded by mutex
+  uint64_t written = 0;           // guarded by mutex; since the last clear
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    next = 0;
+    written = 0;
+  }
+
+  // Spans oldest first.
+  std::vector<SpanRecord> snapshot() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<SpanRecord> ordered;
+    if (written > spans.size()) {
+      ordered.assign(spans.begin() + static_cast<std::ptrdiff_t>(next),
+                     spans.end());
+    }
+    ordered.insert(ordered.end(), spans.begin(),
+                   spans.begin() + static_cast<std::ptrdiff_t>(next));
+    return ordered;
+  }
+};
+
+std::string json_string(const char* text) {
+  std::string out = "\"";
+  for (const char* p = text; *p != '\0'; ++p) {
+    const char c = *p;
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      out += escaped;
+    } else {
+      out += c;
+    }
+  }
+  return out + "\"";
+}
+
+// Nanoseconds as Chrome's microsecond timestamps.
+std::string micros(uint64_t ns) {
+  char text[32];
+  std::snprintf(text, sizeof(text), "%.3f", static_cast<double>(ns) / 1000.0);
+  return text;
+}
+
+}  // namespace
+
+struct CoreTracer::State {
+  explicit State(size_t spans) : id(g_next_tracer_id++), capacity(spans) {}
+
+  const uint64_t id;  // process-unique, so thread bindings never alias
+  const size_t capacity;
+
+  std::atomic<bool> enabled{false};
+  std::atomic<uint64_t> origin_ns{0};
+
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ThreadRing>> rings;  // guarded by mutex
+  uint32_t next_tid = 1;                           // guarded by mutex
+
+  std::shared_ptr<ThreadRing> register_thread() {
+    std::lock_guard<std::mutex> lock(mutex);
+    rings.push_back(std::make_shared<ThreadRing>(next_tid++));
+    return rings.back();
+  }
+
+  std::vector<std::shared_ptr<ThreadRing>> all_rings() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return rings;
+  }
+};
+
+namespace {
+
+// The calling thread's ring, bound to one tracer at a time. A thread that
+// records on another tracer registers a fresh ring there.
+struct ThreadBinding {
+  uint64_t tracer_id = 0;
+  std::shared_ptr<ThreadRing> ring;
+
+  ~ThreadBinding();
+};
+
+// Trivially destructible, so it stays readable while other thread_local
+// destructors (which may record spans) run after the binding is gone.
+thread_local bool t_binding_destroyed = false;
+thread_local ThreadBinding t_binding;
+
+ThreadBinding::~ThreadBinding() { t_binding_destroyed = true; }
+
+}  // namespace
+
+CoreTracer::CoreTracer(size_t spans_per_thread)
+    : state_(std::make_shared<State>(spans_per_thread > 0 ? spans_per_thread
+                                                          : 1)) {}
+
+CoreTracer::~CoreTracer() = default;
+
+bool CoreTracer::enabled() const {
+  return state_->enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t CoreTracer::now_ns() const {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+void CoreTracer::record(const TraceSpan& span) {
+  if (!enabled() || t_binding_destroyed) return;
+  // Spans opened before start() would land before the trace origin.
+  if (span.start_ns < state_->origin_ns.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  try {
+    if (t_binding.tracer_id != state_->id) {
+      t_binding.ring = state_->register_thread();
+      t_binding.tracer_id = state_->id;
+    }
+    ThreadRing& ring = *t_binding.ring;
+
+    std::lock_guard<std::mutex> lock(ring.mutex);
+    if (ring.spans.empty()) ring.spans.resize(state_->capacity);
+
+    SpanRecord& out = ring.spans[ring.next];
+    out.start_ns = span.start_ns;
+    out.end_ns = span.end_ns < span.start_ns ? span.start_ns : span.end_ns;
+    out.frame = span.frame;
+    copy_text(out.category, span.category);
+    copy_text(out.name, span.name);
+    copy_text(out.stage, span.stage);
+
+    ring.next = (ring.next + 1) % ring.spans.size();
+    ++ring.written;
+  } catch (const std::bad_alloc&) {
+    // Tracing is best-effort; never fail the traced code.
+  }
+}
+
+void CoreTracer::start() {
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    // A ring referenced only from here belongs to an exited thread.
+    auto& rings = state_->rings;
+    std::vector<std::shared_ptr<ThreadRing>> live;
+    live.reserve(rings.size());
+    for (auto& ring : rings) {
+      if (ring.use_count() > 1) live.push_back(std::move(ring));
+    }
+    rings = std::move(live);
+    for (const auto& ring : rings) ring->clear();
+  }
+  state_->origin_ns.store(now_ns(), std::memory_order_relaxed);
+  state_->enabled.store(true, std::memory_order_release);
+}
+
+void CoreTracer::stop() {
+  state_->enabled.store(false, std::memory_order_release);
+}
+
+TracerStats CoreTracer::stats() const {
+  TracerStats stats;
+  for (const auto& ring : state_->all_rings()) {
+    std::lock_guard<std::mutex> lock(ring->mutex);
+    if (ring->written == 0) continue;
+    ++stats.threads;
+    stats.recorded += ring->written;
+    if (ring->written > ring->spans.size()) {
+      stats.dropped += ring->written - ring->spans.size();
+    }
+  }
+  return stats;
+}
+
+bool CoreTracer::write_chrome_trace(const std::string& path,
+                                    std::string& error) const {
+  std::ofstream out(path, std::ios::trunc);
+  if (!out) {
+    error = "cannot open '" + path + "' for writing";
+    return false;
+  }
+
+  const uint64_t origin = state_->origin_ns.load(std::memory_order_relaxed);
+  const TracerStats totals = stats();
+
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+         "\"args\":{\"name\":\"decode-orc\"}}";
+
+  for (const auto& ring : state_->all_rings()) {
+    const std::vector<SpanRecord> spans = ring->snapshot();
+    if (spans.empty()) continue;
+
+    const std::string tid = std::to_string(ring->tid);
+    out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid
+        << ",\"args\":{\"name\":\"thread " << tid << "\"}}";
+
+    for (const SpanRecord& span : spans) {
+      out << ",\n{\"name\":" << json_string(span.name)
+          << ",\"cat\":" << json_string(span.category)
+          << ",\"ph\":\"X\",\"ts\":" << micros(span.start_ns - origin)
+          << ",\"dur\":" << micros(span.end_ns - span.start_ns)
+          << ",\"pid\":1,\"tid\":" << tid << ",\"args\":{";
+      const char* separator = "";
+      if (span.stage[0] != '\0') {
+        out << "\"stage\":" << json_string(span.stage);
+        separator = ",";
+      }
+      if (span.frame != kTraceNoFrame) {
+        out << separator << "\"frame\":" << span.frame;
+      }
+      out << "}}";
+    }
+  }
+
+  out << "\n],\"otherData\":{\"recorded_spans\":" << totals.recorded
+      << ",\"dropped_spans\":" << totals.dropped << "}}\n";
+
+  out.close();
+  if (!out) {
+    error = "failed writing '" + path + "'";
+    return false;
+  }
+  return true;
+}
+
+CoreTracer& host_tracer() {
+  static CoreTracer tracer;
+  return tracer;
+}
+
+}  // namespace orc
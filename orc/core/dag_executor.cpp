@@ -12,14 +12,48 @@
 #include <orc/support/logging.h>
 
 #include <algorithm>
+#include <iterator>
+#include <mutex>
 #include <queue>
 #include <set>
 #include <sstream>
 
+#include "include/core_metrics.h"
+#include "include/core_tracer.h"
 #include "include/pipeline_validator.h"
 
 namespace orc {
 
+namespace {
+
+// DAGStage::execute() is not reentrant: stages store their parameters and
+// last output in members. Each render lane runs its own DAGExecutor over the
+// same DAG, and an incremental rebuild hands unchanged stage instances to the
+// new DAG, so execution is serialised per stage instance rather than per
+// executor or DAG. Entries are keyed by ownership, so a new stage allocated
+// at a destroyed stage's address gets its own mutex; expired entries are
+// dropped whenever one is added.
+std::shared_ptr<std::mutex> stage_execute_mutex(const DAGStagePtr& stage) {
+  static std::mutex registry_mutex;
+  static std::map<std::weak_ptr<DAGStage>, std::shared_ptr<std::mutex>,
+                  std::owner_less<std::weak_ptr<DAGStage>>>
+      registry;
+
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  auto it = registry.find(stage);
+  if (it != registry.end()) {
+    return it->second;
+  }
+  for (auto entry = registry.begin(); entry != registry.end();) {
+    entry = entry->first.expired() ? registry.erase(entry) : std::next(entry);
+  }
+  auto mutex = std::make_shared<std::mutex>();
+  registry.emplace(stage, mutex);
+  return mutex;
+}
+
+}  // namespace
+
 // ============================================================================
 // DAGExecutor Implementation
 // ============================================================================
@@ -27,7 +61,9 @@ namespace orc {
 DAGExecutor::DAGExecutor()
     : cache_enabled_(true),
       artifact_cache_(MAX_CACHED_ARTIFACTS),
-      progress_callback_(nullptr) {}
+      progress_callback_(nullptr) {
+  artifact_cache_.bind_metrics(&host_metrics(), "dag_artifacts");
+}
 
 // ============================================================================
 // DAG Implementation
@@ -317,8 +353,20 @@ std::vector<ArtifactPtr> DAGExecutor::get_cached_or_execute(
   // Execute stage
   ORC_LOG_DEBUG("Node '{}': Executing stage '{}'", node.node_id.to_string(),
                 node.stage->get_node_type_info().stage_name);
-  auto outputs =
-      node.stage->execute(inputs, node.parameters, observation_context_);
+  std::vector<ArtifactPtr> outputs;
+  {
+    const std::string node_label = node.node_id.to_string();
+    const std::string stage_label =
+        "stage=" + node.stage->get_node_type_info().stage_name;
+    TraceScope trace(&host_tracer(), "dag", "execute", node_label.c_str());
+    const auto execute_mutex = stage_execute_mutex(node.stage);
+    std::lock_guard<std::mutex> execute_lock(*execute_mutex);
+    MetricTimer timer(host_metrics().histogram(
+        "orc_stage_execute_seconds", "Time spent in DAGStage::execute()",
+        stage_label.c_str()));
+    outputs =
+        node.stage->execute(inputs, node.parameters, observation_context_);
+  }
 
   // Sink stages are allowed to return empty outputs (they consume inputs
   // without producing outputs)
@@ -12,6 +12,7 @@
 #include <orc/support/logging.h>
 
 #include <algorithm>
+#include <set>
 #include <sstream>
 
 namespace orc {
@@ -39,6 +40,10 @@ DAGFrameRenderer::DAGFrameRenderer(std::shared_ptr<const DAG> dag)
   executor_ = std::make_unique<DAGExecutor>();
   executor_->set_cache_enabled(true);
 
+  for (const auto& node : dag_->nodes()) {
+    node_versions_[node.node_id] = dag_version_;
+  }
+
   // Cache the observer id enumeration once; the registry is fixed at build
   // time, so update_dag() need not recompute it.
   for (const auto& info : observation_service_.available_observers()) {
@@ -58,7 +63,7 @@ bool DAGFrameRenderer::has_node(NodeID node_id) const {
   return node_index_.find(node_id) != node_index_.end();
 }
 
-void DAGFrameRenderer::update_dag(std::shared_ptr<const DAG> new_dag) {
+size_t DAGFrameRenderer::update_dag(std::shared_ptr<const DAG> new_dag) {
   if (!new_dag) {
     throw DAGFrameRenderError("Cannot update to null DAG");
   }
@@ -73,13 +78,47 @@ void DAGFrameRenderer::update_dag(std::shared_ptr<const DAG> new_dag) {
     throw DAGFrameRenderError(oss.str());
   }
 
-  dag_ = std::move(new_dag);
+  // A node whose stage instance survived the rebuild has the same
+  // configuration and upstream as before, so its cached results still hold.
+  std::map<NodeID, const DAGStage*> old_stages;
+  for (const auto& node : dag_->nodes()) {
+    old_stages[node.node_id] = node.stage.get();
+  }
+
   ++dag_version_;
+  std::map<NodeID, uint64_t> node_versions;
+  std::set<NodeID> changed;
+  for (const auto& node : new_dag->nodes()) {
+    auto it = old_stages.find(node.node_id);
+    auto version = node_versions_.find(node.node_id);
+    if (it != old_stages.end() && it->second == node.stage.get() &&
+        version != node_versions_.end()) {
+      node_versions[node.node_id] = version->second;
+    } else {
+      node_versions[node.node_id] = dag_version_;
+      changed.insert(node.node_id);
+    }
+  }
+  for (const auto& [node_id, stage] : old_stages) {
+    if (node_versions.find(node_id) == node_versions.end()) {
+      changed.insert(node_id);
+    }
+  }
+
+  render_cache_.erase_if([&changed](const CacheKey& key) {
+    return changed.count(key.node_id) != 0;
+  });
+
+  ORC_LOG_DEBUG("DAGFrameRenderer: DAG updated, {} of {} nodes changed",
+                changed.size(), new_dag->nodes().size());
+
+  dag_ = std::move(new_dag);
+  node_versions_ = std::move(node_versions);
   node_index_valid_ = false;
-  render_cache_.clear();
 
-  executor_ = std::make_unique<DAGExecutor>();
-  executor_->set_cache_enabled(true);
+  // The executor is kept: its artifact cache is keyed by stage, parameters
+  // and input artifact IDs, so changed nodes miss and unchanged ones hit.
+  return changed.size();
 }
 
 void DAGFrameRenderer::clear_cache() { render_cache_.clear(); }
@@ -102,8 +141,9 @@ FrameRenderResult DAGFrameRenderer::render_frame_at_node(NodeID node_id,
     return err;
   }
 
+  const uint64_t node_version = node_versions_[node_id];
   if (cache_enabled_) {
-    CacheKey key{node_id, frame_id, dag_version_};
+    CacheKey key{node_id, frame_id, node_version};
     auto cached = render_cache_.get(key);
     if (cached.has_value()) {
       ORC_LOG_TRACE("DAGFrameRenderer: cache hit node='{}' frame={}",
@@ -118,7 +158,7 @@ FrameRenderResult DAGFrameRenderer::render_frame_at_node(NodeID node_id,
   auto result = execute_to_node(node_id, frame_id);
 
   if (cache_enabled_ && result.is_valid) {
-    CacheKey key{node_id, frame_id, dag_version_};
+    CacheKey key{node_id, frame_id, node_version};
     render_cache_.put(key, result);
   }
 
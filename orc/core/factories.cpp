@@ -11,6 +11,7 @@
 
 #include "factories.h"
 
+#include "async_file_writer.h"
 #include "buffered_file_io.h"
 
 namespace orc {
@@ -39,4 +40,22 @@ std::shared_ptr<IFileWriter<int16_t>>
 Factories::create_instance_buffered_file_writer_int16(size_t buffer_size) {
   return std::make_shared<BufferedFileWriter<int16_t>>(buffer_size);
 }
+
+std::shared_ptr<IFileWriter<uint8_t>>
+Factories::create_instance_async_file_writer_uint8(
+    const AsyncFileWriterOptions& options) {
+  return std::make_shared<AsyncBufferedFileWriter<uint8_t>>(options);
+}
+
+std::shared_ptr<IFileWriter<uint16_t>>
+Factories::create_instance_async_file_writer_uint16(
+    const AsyncFileWriterOptions& options) {
+  return std::make_shared<AsyncBufferedFileWriter<uint16_t>>(options);
+}
+
+std::shared_ptr<IFileWriter<int16_t>>
+Factories::create_instance_async_file_writer_int16(
+    const AsyncFileWriterOptions& options) {
+  return std::make_shared<AsyncBufferedFileWriter<int16_t>>(options);
+}
 }  // namespace orc
@@ -51,6 +51,25 @@ class Factories : public IFactories {
   std::shared_ptr<IFileWriter<int16_t>>
   create_instance_buffered_file_writer_int16(size_t buffer_size) override;
 
+  /**
+   * @brief Create instance of AsyncBufferedFileWriter<uint8_t>
+   */
+  std::shared_ptr<IFileWriter<uint8_t>> create_instance_async_file_writer_uint8(
+      const AsyncFileWriterOptions& options) override;
+
+  /**
+   * @brief Create instance of AsyncBufferedFileWriter<uint16_t>
+   */
+  std::shared_ptr<IFileWriter<uint16_t>>
+  create_instance_async_file_writer_uint16(
+      const AsyncFileWriterOptions& options) override;
+
+  /**
+   * @brief Create instance of AsyncBufferedFileWriter<int16_t>
+   */
+  std::shared_ptr<IFileWriter<int16_t>> create_instance_async_file_writer_int16(
+      const AsyncFileWriterOptions& options) override;
+
  private:
   StageFactories factoriesStage_;
 };
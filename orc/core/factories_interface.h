@@ -11,6 +11,7 @@
 
 #ifndef DECODE_ORC_ROOT_FACTORIES_INTERFACE_H
 #define DECODE_ORC_ROOT_FACTORIES_INTERFACE_H
+#include <orc/plugin/orc_stage_services.h>
 #include <orc/stage/file_io_interface.h>
 
 #include <memory>
@@ -52,6 +53,20 @@ class IFactories {
   create_instance_buffered_file_writer_uint16(size_t buffer_size) = 0;
   virtual std::shared_ptr<IFileWriter<int16_t>>
   create_instance_buffered_file_writer_int16(size_t buffer_size) = 0;
+
+  /*
+   * Factory methods for AsyncBufferedFileWriter.
+   */
+
+  virtual std::shared_ptr<IFileWriter<uint8_t>>
+  create_instance_async_file_writer_uint8(
+      const AsyncFileWriterOptions& options) = 0;
+  virtual std::shared_ptr<IFileWriter<uint16_t>>
+  create_instance_async_file_writer_uint16(
+      const AsyncFileWriterOptions& options) = 0;
+  virtual std::shared_ptr<IFileWriter<int16_t>>
+  create_instance_async_file_writer_int16(
+      const AsyncFileWriterOptions& options) = 0;
 };
 }  // namespace orc
 
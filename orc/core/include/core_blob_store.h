@@ -0,0 +1,123 @@
+/*
+ * File:        core_blob_store.h
+ * Module:      orc-core
+ * Purpose:     Host implementation of the plugin-facing IBlobStore with
+ *              project sidecar files
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <orc/stage/blob_store.h>
+#include <orc/stage/params/parameter_types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace orc {
+
+/**
+ * @brief Content-addressed blob store behind OrcPluginServices::blob_store
+ *
+ * Blobs are identified by the SHA-256 of their contents, so storing the same
+ * text twice yields the same reference and one copy. A project records the
+ * sidecar file of each blob it references at load time (add_sidecar()); the
+ * file is only read, and its hash checked, when a stage or presenter first
+ * asks for the blob.
+ *
+ * References stay resolvable for the rest of the process, so undo snapshots
+ * and unsaved edits keep working, but only the most recently used blobs stay
+ * in memory: once the resident bytes exceed the limit, the least recently
+ * used blobs are dropped and re-read from their sidecar on the next get().
+ * A blob with no sidecar yet (an unsaved edit) is first spilled to a private
+ * scratch directory that is removed with the store.
+ *
+ * Sidecars hold the parameter value byte for byte rather than a per-stage
+ * binary encoding: the hash is over exactly those bytes, and stages keep a
+ * single parser for inline and stored values.
+ *
+ * Thread-safety: all methods may be called concurrently.
+ */
+class CoreBlobStore : public IBlobStore {
+ public:
+  /// Default limit on the bytes of blob contents held in memory.
+  static constexpr size_t kDefaultResidentLimit = size_t{256} << 20;
+
+  explicit CoreBlobStore(size_t resident_limit = kDefaultResidentLimit);
+  ~CoreBlobStore() override;
+
+  CoreBlobStore(const CoreBlobStore&) = delete;
+  CoreBlobStore& operator=(const CoreBlobStore&) = delete;
+
+  std::shared_ptr<const std::string> get(
+      const std::string& ref) const override;
+
+  /// Store @p text and return its `blob:sha256:<hex>` reference.
+  std::string put(std::string text);
+
+  /// Record @p path as the sidecar file holding @p ref, for a lazy load.
+  /// Ignored when the blob is already in memory or @p ref is not a valid
+  /// blob reference.
+  void add_sidecar(const std::string& ref, const std::string& path);
+
+  /**
+   * @brief Write the blob named by @p ref into @p directory
+   *
+   * The file is named sidecar_file_name(@p ref) and is left untouched when it
+   * already exists (same name, same contents). The written file becomes the
+   * blob's sidecar, so it can be dropped from memory without a spill.
+   * @return false with @p error set when @p ref is invalid, the blob is
+   *         unknown or the file cannot be written
+   */
+  bool write_sidecar(const std::string& ref, const std::string& directory,
+                     std::string& error) const;
+
+  /// Sidecar file name for @p ref: "<hex>.blob". @p ref must satisfy
+  /// is_blob_ref(), which keeps the name inside the sidecar directory.
+  static std::string sidecar_file_name(const std::string& ref);
+
+  /// Bytes of blob contents currently held in memory.
+  size_t resident_bytes() const;
+
+ private:
+  struct Entry {
+    std::shared_ptr<const std::string> data;  // null until loaded or evicted
+    std::string sidecar_path;
+    uint64_t last_use = 0;
+  };
+
+  // Record @p entry as just used, and account for newly resident data.
+  void touch_locked(Entry& entry, size_t added_bytes) const;
+  // Drop least recently used blobs until the resident bytes fit the limit.
+  void evict_locked() const;
+  // Write an unsaved blob to the scratch directory so it can be dropped.
+  bool spill_locked(const std::string& ref, Entry& entry) const;
+
+  const size_t resident_limit_;
+  mutable std::mutex mutex_;
+  mutable std::unordered_map<std::string, Entry> entries_;  // by reference
+  mutable size_t resident_bytes_ = 0;
+  mutable uint64_t use_clock_ = 0;
+  mutable std::string spill_directory_;  // created on first spill
+};
+
+/// Process-wide blob store shared by the project layer and every plugin.
+CoreBlobStore& host_blob_store();
+
+/**
+ * @brief Copy of @p parameters with blob references replaced by their text
+ *
+ * For presenters that show or edit parameter values as text. A reference
+ * that cannot be resolved is left as is.
+ */
+std::map<std::string, ParameterValue> resolve_blob_parameters(
+    const std::map<std::string, ParameterValue>& parameters);
+
+}  // namespace orc
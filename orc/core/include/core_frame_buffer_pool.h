@@ -0,0 +1,72 @@
+/*
+ * File:        core_frame_buffer_pool.h
+ * Module:      orc-core
+ * Purpose:     Host implementation of the plugin-facing IFrameBufferPool
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <orc/stage/frame_buffer_pool.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace orc {
+
+/**
+ * @brief Size-classed, recycling frame buffer pool shared by every stage.
+ *
+ * Requests are rounded up to a multiple of kSizeClassSamples, so frames of one
+ * video system (and the odd-length YC planes beside them) land in the same
+ * class. A released buffer is parked in the releasing thread's magazine — a
+ * handful of slots touched without locking — and overflows into a shared
+ * depot bounded by @p capacity_bytes; beyond that it is freed. acquire()
+ * looks in the calling thread's magazine, then the depot, and only then
+ * allocates.
+ *
+ * Buffers hold a weak reference to the pool state: a buffer released after
+ * the pool is destroyed is simply freed. Magazines are flushed to the depot
+ * when their thread exits.
+ *
+ * Thread-safety: all methods are thread-safe; see IFrameBufferPool.
+ */
+class CoreFrameBufferPool final : public IFrameBufferPool {
+ public:
+  // 32 KiB of int16_t samples: fine enough that a class wastes under 3% of a
+  // full frame, coarse enough that PAL / NTSC composite, luma and chroma
+  // planes of one system share a class.
+  static constexpr size_t kSizeClassSamples = 16384;
+  // ~45 PAL frames parked in the shared depot.
+  static constexpr size_t kDefaultCapacityBytes = size_t{64} * 1024 * 1024;
+  static constexpr size_t kDefaultMagazineSlots = 4;
+
+  explicit CoreFrameBufferPool(
+      size_t capacity_bytes = kDefaultCapacityBytes,
+      size_t magazine_slots = kDefaultMagazineSlots);
+  ~CoreFrameBufferPool() override;
+
+  CoreFrameBufferPool(const CoreFrameBufferPool&) = delete;
+  CoreFrameBufferPool& operator=(const CoreFrameBufferPool&) = delete;
+
+  std::shared_ptr<std::vector<int16_t>> acquire(size_t samples) override;
+  FrameBufferPoolStats stats() const override;
+
+  /// Frees every buffer parked in the depot and in the calling thread's
+  /// magazine. Magazines of other threads are left alone.
+  void trim();
+
+  struct State;
+
+ private:
+  std::shared_ptr<State> state_;
+};
+
+/// Process-wide pool handed to plugins through OrcPluginServices.
+CoreFrameBufferPool& host_frame_buffer_pool();
+
+}  // namespace orc
@@ -0,0 +1,105 @@
+/*
+ * File:        core_metrics.h
+ * Module:      orc-core
+ * Purpose:     Host implementation of the plugin-facing IMetricsRegistry with
+ *              Prometheus text export
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <orc/stage/metrics.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace orc {
+
+enum class MetricKind { Counter, Gauge, Histogram };
+
+/// Point-in-time value of one metric series, as returned by snapshot().
+struct MetricSample {
+  std::string name;
+  std::string help;
+  std::string labels;  ///< As registered: "key=value,..." or empty.
+  MetricKind kind = MetricKind::Counter;
+  double value = 0.0;  ///< Counter or gauge value; histogram sum.
+  uint64_t count = 0;  ///< Histogram observations.
+  /// Histogram (upper bound, cumulative count) pairs, excluding +Inf.
+  std::vector<std::pair<double, uint64_t>> buckets;
+};
+
+/**
+ * @brief Metrics registry behind the OrcPluginServices::metrics pointer.
+ *
+ * Plugins reach it through plugin::get_metrics(); the host publishes it in
+ * the services table it hands to every plugin at load time.
+ *
+ * Instruments are created on first lookup and never destroyed, so the
+ * pointers handed to stages stay valid. Updates are relaxed atomics; only
+ * lookups and snapshots take the registry lock. Histograms use fixed latency
+ * buckets from 100 µs to 10 s.
+ *
+ * Collectors registered with add_collector() run at the start of every
+ * snapshot() to refresh sampled gauges such as resident memory.
+ *
+ * Thread-safety: all methods are thread-safe.
+ */
+class CoreMetricsRegistry final : public IMetricsRegistry {
+ public:
+  using Collector = std::function<void(CoreMetricsRegistry&)>;
+
+  CoreMetricsRegistry();
+  ~CoreMetricsRegistry() override;
+
+  CoreMetricsRegistry(const CoreMetricsRegistry&) = delete;
+  CoreMetricsRegistry& operator=(const CoreMetricsRegistry&) = delete;
+
+  IMetricCounter* counter(const char* name, const char* help,
+                          const char* labels) override;
+  IMetricGauge* gauge(const char* name, const char* help,
+                      const char* labels) override;
+  IMetricHistogram* histogram(const char* name, const char* help,
+                              const char* labels) override;
+
+  void add_collector(Collector collector);
+
+  /// Every series, sorted by name then labels.
+  std::vector<MetricSample> snapshot() const;
+
+  /// snapshot() in the Prometheus text exposition format (version 0.0.4).
+  std::string prometheus_text() const;
+
+  /**
+   * @brief Write prometheus_text() to @p path for node_exporter's textfile
+   * collector.
+   *
+   * The text is written to a temporary file beside @p path and renamed over
+   * it, so a scraper never reads a partial file.
+   *
+   * @return false, with @p error set, if the file cannot be written.
+   */
+  bool write_prometheus_textfile(const std::string& path,
+                                 std::string& error) const;
+
+  struct State;
+
+ private:
+  std::unique_ptr<State> state_;
+};
+
+/// Process-wide registry published to plugins as OrcPluginServices::metrics.
+/// Its snapshots include the process resident memory gauge and the frame
+/// buffer pool's occupancy gauges and orc_frame_pool_*_total counters.
+CoreMetricsRegistry& host_metrics();
+
+/// Resident set size of this process in bytes, or 0 if unknown.
+uint64_t process_resident_bytes();
+
+}  // namespace orc
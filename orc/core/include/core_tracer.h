@@ -0,0 +1,86 @@
+/*
+ * File:        core_tracer.h
+ * Module:      orc-core
+ * Purpose:     Host implementation of the plugin-facing ITracer with Chrome
+ *              trace export
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <orc/stage/trace.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace orc {
+
+/// Counters reported by CoreTracer::stats().
+struct TracerStats {
+  uint64_t recorded = 0;  ///< Spans recorded since start().
+  uint64_t dropped = 0;   ///< Spans overwritten because a buffer was full.
+  uint64_t threads = 0;   ///< Threads that recorded since start().
+};
+
+/**
+ * @brief Span recorder backed by one bounded ring buffer per thread.
+ *
+ * A thread's first span allocates its ring and registers it with the tracer;
+ * later spans append to it under the ring's own (uncontended) lock, so
+ * recording threads never serialise against each other. When a ring is full
+ * the oldest span is overwritten and counted as dropped. Span strings are
+ * copied into fixed-size fields and truncated if longer.
+ *
+ * Rings outlive their threads, so spans of finished worker threads are still
+ * exported. start() clears every ring and forgets those of exited threads.
+ *
+ * Thread-safety: all methods are thread-safe; see ITracer.
+ */
+class CoreTracer final : public ITracer {
+ public:
+  // ~2 MiB per recording thread.
+  static constexpr size_t kDefaultSpansPerThread = 16384;
+
+  explicit CoreTracer(size_t spans_per_thread = kDefaultSpansPerThread);
+  ~CoreTracer() override;
+
+  CoreTracer(const CoreTracer&) = delete;
+  CoreTracer& operator=(const CoreTracer&) = delete;
+
+  bool enabled() const override;
+  uint64_t now_ns() const override;
+  void record(const TraceSpan& span) override;
+
+  /// Discards previously recorded spans and starts capturing.
+  void start();
+
+  /// Stops capturing. Recorded spans are kept until the next start().
+  void stop();
+
+  TracerStats stats() const;
+
+  /**
+   * @brief Write the recorded spans as a Chrome trace event JSON file.
+   *
+   * Each span becomes a complete ("X") event on its thread's track with its
+   * stage and frame tags in "args"; timestamps are microseconds since
+   * start(). The file loads in chrome://tracing and ui.perfetto.dev.
+   *
+   * @return false, with @p error set, if the file cannot be written.
+   */
+  bool write_chrome_trace(const std::string& path, std::string& error) const;
+
+  struct State;
+
+ private:
+  std::shared_ptr<State> state_;
+};
+
+/// Process-wide tracer handed to plugins through OrcPluginServices.
+CoreTracer& host_tracer();
+
+}  // namespace orc
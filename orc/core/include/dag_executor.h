@@ -93,6 +93,9 @@ class DAG {
  * - Topological sorting
  * - Caching (by artifact ID)
  * - Partial re-execution
+ *
+ * Executors may run concurrently over DAGs that share stage instances;
+ * calls to one stage's execute() are serialised across all executors.
  */
 class DAGExecutor {
  public:
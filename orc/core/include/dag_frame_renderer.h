@@ -87,7 +87,7 @@ class DAGFrameRenderer {
 
   // Render the representation at node_id and return it, verifying that
   // frame_id is present.  Results are LRU-cached; calling update_dag()
-  // invalidates all cached entries.
+  // invalidates the cached entries of the nodes it reports as changed.
   //
   // The representation is NOT executed per-frame: the whole source runs once
   // and the VFR is cached.  Individual frames are accessed by FrameID through
@@ -101,9 +101,14 @@ class DAGFrameRenderer {
   // DAG Change Tracking
   // -------------------------------------------------------------------------
 
-  // Replace the DAG and clear all cached render results.  Increments the
-  // internal DAG version so stale FrameRenderResult objects are detectable.
-  void update_dag(std::shared_ptr<const DAG> new_dag);
+  // Replace the DAG and invalidate the cached render results of changed
+  // nodes.  A node is unchanged when the new DAG holds the same stage instance
+  // for it as the old one (project_to_dag() with a previous DAG shares the
+  // instances of the untouched subgraph); its cached results, and the
+  // executor's cached artifacts, stay valid.  Every other node - and so every
+  // node when the DAG was built from scratch - is re-executed on its next
+  // render.  Returns the number of nodes invalidated.
+  size_t update_dag(std::shared_ptr<const DAG> new_dag);
 
   // Returns the observation context populated during the most recent
   // render_frame_at_node() execution.
@@ -126,14 +131,18 @@ class DAGFrameRenderer {
   uint64_t dag_version_;
   bool cache_enabled_;
 
-  // Cache key: (node_id, frame_id value, dag_version)
+  // DAG version at which each node's stage instance last changed.  Cache keys
+  // carry the node's version, so replacing a node orphans its old entries.
+  std::map<NodeID, uint64_t> node_versions_;
+
+  // Cache key: (node_id, frame_id value, node version)
   struct CacheKey {
     NodeID node_id;
     uint64_t frame_id_value;
-    uint64_t dag_version;
+    uint64_t node_version;
 
     bool operator==(const CacheKey& o) const noexcept {
-      return dag_version == o.dag_version && node_id == o.node_id &&
+      return node_version == o.node_version && node_id == o.node_id &&
              frame_id_value == o.frame_id_value;
     }
   };
@@ -142,7 +151,7 @@ class DAGFrameRenderer {
     std::size_t operator()(const CacheKey& k) const noexcept {
       std::size_t h1 = std::hash<NodeID>{}(k.node_id);
       std::size_t h2 = std::hash<uint64_t>{}(k.frame_id_value);
-      std::size_t h3 = std::hash<uint64_t>{}(k.dag_version);
+      std::size_t h3 = std::hash<uint64_t>{}(k.node_version);
       return h1 ^ (h2 << 1) ^ (h3 << 2);
     }
   };
@@ -61,6 +61,9 @@ class ObservationCache {
 
   /**
    * @brief Update the DAG reference and clear cache
+   *
+   * Frames of nodes the new DAG left unchanged are re-observed from the
+   * renderer's cached results rather than re-executed.
    * @param dag New DAG to use
    */
   void update_dag(std::shared_ptr<const DAG> dag);
@@ -15,6 +15,7 @@
 #include <orc/stage/common_types.h>  // For PreviewOutputType, AspectRatioMode
 #include <orc/stage/frame_id.h>
 #include <orc/stage/node_id.h>
+#include <orc/stage/preview/orc_preview_carriers.h>
 #include <orc/stage/preview/orc_rendering.h>  // For public API types (DropoutRegion, PreviewImage)
 #include <orc/stage/preview/preview_stage_types.h>
 #include <orc/stage/preview/stage_custom_preview_renderer.h>
@@ -22,6 +23,7 @@
 #include <orc/stage/video_frame_representation.h>
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
@@ -70,6 +72,9 @@ using FrameFieldsResult = orc::FrameFieldsResult;
  */
 class PreviewRenderer {
  public:
+  /// Polled during a render; returning true abandons it.
+  using CancelCheck = std::function<bool()>;
+
   /**
    * @brief Construct a preview renderer
    * @param dag The DAG to render previews from
@@ -123,6 +128,9 @@ class PreviewRenderer {
    * @param node_id The node to render from
    * @param type The output type (field, frame, etc.)
    * @param index The output index (0-based)
+   * @param cancelled Optional poll; when it returns true between the DAG
+   *        execution and the image rendering, the render stops early and
+   *        returns an unsuccessful result
    * @return Rendered image result
    *
    * Examples:
@@ -134,13 +142,30 @@ class PreviewRenderer {
   PreviewRenderResult render_output(
       const NodeID& node_id, PreviewOutputType type, uint64_t index,
       const std::string& option_id = "",
-      PreviewNavigationHint hint = PreviewNavigationHint::Random);
+      PreviewNavigationHint hint = PreviewNavigationHint::Random,
+      const CancelCheck& cancelled = nullptr);
+
+  /**
+   * @brief Render a fast draft of an output, when the node offers one
+   *
+   * Drafts come from stages implementing IDraftColourPreviewProvider and are
+   * widened back to the geometry of the full-quality preview. Hosts show
+   * them while the user navigates and render_output() once navigation
+   * pauses.
+   *
+   * @return std::nullopt when the node has no draft for this output;
+   *         otherwise a result as from render_output()
+   */
+  std::optional<PreviewRenderResult> render_draft_output(
+      const NodeID& node_id, PreviewOutputType type, uint64_t index,
+      const CancelCheck& cancelled = nullptr);
 
   /**
    * @brief Update the DAG reference
    *
    * Call this when the DAG changes (nodes added/removed/modified).
-   * This will invalidate any cached render results.
+   * Cached render results are invalidated for the nodes the new DAG changed;
+   * see DAGFrameRenderer::update_dag().
    *
    * @param dag The new DAG to use
    */
@@ -336,12 +361,16 @@ class PreviewRenderer {
 
   /**
    * @brief Render a frame through the colour-carrier provider path.
+   *
+   * @param fetch_carrier Fetches the carrier for @p index from the provider
+   * @param widen Horizontal factor restoring a decimated carrier's geometry
+   * @param cancelled Polled after the fetch, before the image conversion
    */
   PreviewRenderResult render_colour_carrier_preview(
-      const NodeID& stage_node_id, const class IColourPreviewProvider& provider,
-      const StagePreviewCapability& capability, PreviewOutputType type,
-      uint64_t index,
-      PreviewNavigationHint hint = PreviewNavigationHint::Random);
+      const NodeID& stage_node_id, const StagePreviewCapability& capability,
+      PreviewOutputType type, uint64_t index,
+      const std::function<std::optional<ColourFrameCarrier>()>& fetch_carrier,
+      uint32_t widen = 1, const CancelCheck& cancelled = nullptr);
 
   /**
    * @brief Convert a vector of PreviewOptions to PreviewOutputInfo entries.
@@ -56,7 +56,16 @@ class ProjectConversionError : public std::runtime_error {
  * 3. Set up edges and dependencies
  * 4. Validate the resulting DAG
  *
+ * Incremental rebuild: when @p previous is given (normally the DAG built
+ * before the edit), every node whose stage type, effective parameters and
+ * input edges are unchanged - and whose upstream nodes are all unchanged too -
+ * shares its stage instance with @p previous instead of getting a new one.
+ * Sources in the untouched subgraph therefore keep their opened files, and
+ * renderers can tell changed nodes from unchanged ones by comparing
+ * DAGNode::stage pointers (see DAGFrameRenderer::update_dag()).
+ *
  * @param project The project to convert
+ * @param previous DAG to reuse unchanged stage instances from; may be null
  * @return Executable DAG ready for rendering or execution
  * @throws ProjectConversionError if conversion fails
  *
@@ -72,7 +81,8 @@ class ProjectConversionError : public std::runtime_error {
  * auto result = renderer.render_frame_at_node("transform_1", FrameID(42));
  * ```
  */
-std::shared_ptr<DAG> project_to_dag(const Project& project);
+std::shared_ptr<DAG> project_to_dag(const Project& project,
+                                    const DAG* previous = nullptr);
 
 /**
  * @brief Validate that all source nodes in a DAG can be accessed
@@ -32,7 +32,7 @@ void ObservationCache::update_dag(std::shared_ptr<const DAG> dag) {
   }
 
   dag_ = dag;
-  renderer_ = std::make_shared<DAGFrameRenderer>(dag_);
+  renderer_->update_dag(dag_);
   clear();
 }
 
@@ -16,6 +16,7 @@
 #include <orc/support/vbi_types.h>
 #include <orc/support/vbi_utilities.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <optional>
@@ -134,9 +135,10 @@ static bool check_parity(uint32_t x4, uint32_t x5) {
   return x51p && x52p && x53p;
 }
 
-// Interpret the decoded VBI data according to IEC 60857 LaserDisc standard
-static void interpret_vbi_data(int32_t vbi16, int32_t vbi17, int32_t vbi18,
-                               FieldID field_id, IObservationContext& context) {
+BiphaseObserver::AddressCodes BiphaseObserver::decode_address_codes(
+    int32_t vbi16, int32_t vbi17, int32_t vbi18) {
+  AddressCodes codes;
+
   // IEC 60857-1986 - 10.1.3 Picture numbers (CAV discs)
   // ---------------------------- Check for CAV picture number on lines 17 and
   // 18 Top bit can be used for stop code, so mask it: range 0-79999
@@ -167,7 +169,7 @@ static void interpret_vbi_data(int32_t vbi16, int32_t vbi17, int32_t vbi18,
   if ((vbi17 & 0xF00FFF) == 0x800DDD) {
     int32_t chapter;
     if (decode_bcd((vbi17 & 0x07F000) >> 12, chapter)) {
-      context.set(field_id, "vbi", "chapter_number", chapter);
+      codes.chapter_number = chapter;
       ORC_LOG_DEBUG("BiphaseObserver: Chapter number {} from line 17", chapter);
     }
   }
@@ -175,7 +177,7 @@ static void interpret_vbi_data(int32_t vbi16, int32_t vbi17, int32_t vbi18,
   if ((vbi18 & 0xF00FFF) == 0x800DDD) {
     int32_t chapter;
     if (decode_bcd((vbi18 & 0x07F000) >> 12, chapter)) {
-      context.set(field_id, "vbi", "chapter_number", chapter);
+      codes.chapter_number = chapter;
       ORC_LOG_DEBUG("BiphaseObserver: Chapter number {} from line 18", chapter);
     }
   }
@@ -245,10 +247,7 @@ static void interpret_vbi_data(int32_t vbi16, int32_t vbi17, int32_t vbi18,
   // Only store CLV timecode if ALL fields are present and valid
   if (clv_tc.hours != -1 && clv_tc.minutes != -1 && clv_tc.seconds != -1 &&
       clv_tc.picture_number != -1) {
-    context.set(field_id, "vbi", "clv_timecode_hours", clv_tc.hours);
-    context.set(field_id, "vbi", "clv_timecode_minutes", clv_tc.minutes);
-    context.set(field_id, "vbi", "clv_timecode_seconds", clv_tc.seconds);
-    context.set(field_id, "vbi", "clv_timecode_picture", clv_tc.picture_number);
+    codes.clv_timecode = clv_tc;
     ORC_LOG_DEBUG(
         "BiphaseObserver: Complete CLV timecode validated: {}:{}:{}.{}",
         clv_tc.hours, clv_tc.minutes, clv_tc.seconds, clv_tc.picture_number);
@@ -256,20 +255,20 @@ static void interpret_vbi_data(int32_t vbi16, int32_t vbi17, int32_t vbi18,
 
   // Only set CAV picture number if CLV picture number not detected
   if (!has_clv_picture_number && cav_picture_number.has_value()) {
-    context.set(field_id, "vbi", "picture_number", cav_picture_number.value());
+    codes.picture_number = cav_picture_number;
   }
 
   // IEC 60857-1986 - 10.1.1 Lead-in
   // ------------------------------------------------
   if (vbi17 == 0x88FFFF || vbi18 == 0x88FFFF) {
-    context.set(field_id, "vbi", "lead_in", static_cast<int32_t>(1));
+    codes.lead_in = true;
     ORC_LOG_DEBUG("BiphaseObserver: Lead-in detected");
   }
 
   // IEC 60857-1986 - 10.1.2 Lead-out
   // -----------------------------------------------
   if (vbi17 == 0x80EEEE || vbi18 == 0x80EEEE) {
-    context.set(field_id, "vbi", "lead_out", static_cast<int32_t>(1));
+    codes.lead_out = true;
     ORC_LOG_DEBUG("BiphaseObserver: Lead-out detected");
   }
 
@@ -277,7 +276,7 @@ static void interpret_vbi_data(int32_t vbi16, int32_t vbi17, int32_t vbi18,
   // -------------------------------------- Check for picture stop code on lines
   // 16 and 17
   if (vbi16 == 0x82CFFF || vbi17 == 0x82CFFF) {
-    context.set(field_id, "vbi", "stop_code_present", static_cast<int32_t>(1));
+    codes.stop_code = true;
     ORC_LOG_DEBUG("BiphaseObserver: Picture stop code detected");
   }
 
@@ -287,6 +286,37 @@ static void interpret_vbi_data(int32_t vbi16, int32_t vbi17, int32_t vbi18,
     ORC_LOG_DEBUG("BiphaseObserver: CLV indicator code detected");
   }
 
+  return codes;
+}
+
+// Interpret the decoded VBI data according to IEC 60857 LaserDisc standard
+static void interpret_vbi_data(int32_t vbi16, int32_t vbi17, int32_t vbi18,
+                               FieldID field_id, IObservationContext& context) {
+  const auto codes =
+      BiphaseObserver::decode_address_codes(vbi16, vbi17, vbi18);
+  if (codes.chapter_number) {
+    context.set(field_id, "vbi", "chapter_number", *codes.chapter_number);
+  }
+  if (codes.clv_timecode) {
+    const CLVTimecode& clv_tc = *codes.clv_timecode;
+    context.set(field_id, "vbi", "clv_timecode_hours", clv_tc.hours);
+    context.set(field_id, "vbi", "clv_timecode_minutes", clv_tc.minutes);
+    context.set(field_id, "vbi", "clv_timecode_seconds", clv_tc.seconds);
+    context.set(field_id, "vbi", "clv_timecode_picture", clv_tc.picture_number);
+  }
+  if (codes.picture_number) {
+    context.set(field_id, "vbi", "picture_number", *codes.picture_number);
+  }
+  if (codes.lead_in) {
+    context.set(field_id, "vbi", "lead_in", static_cast<int32_t>(1));
+  }
+  if (codes.lead_out) {
+    context.set(field_id, "vbi", "lead_out", static_cast<int32_t>(1));
+  }
+  if (codes.stop_code) {
+    context.set(field_id, "vbi", "stop_code_present", static_cast<int32_t>(1));
+  }
+
   // IEC 60857-1986 - 10.1.8 Programme status code
   // ----------------------------------
   if ((vbi16 & 0xFFF000) == 0x8DC000 || (vbi16 & 0xFFF000) == 0x8BA000) {
@@ -503,6 +533,53 @@ static void interpret_vbi_data(int32_t vbi16, int32_t vbi17, int32_t vbi18,
   }
 }
 
+std::vector<size_t> BiphaseObserver::frame_lines(VideoSystem system) {
+  const size_t f1_lines = field1_lines(system);
+  return {15, 16, 17, f1_lines + 15, f1_lines + 16, f1_lines + 17};
+}
+
+std::array<int32_t, 3> BiphaseObserver::decode_field_lines(
+    const VideoFrameRepresentation& representation, FrameID frame_id,
+    size_t field_index, const SourceParameters& params) {
+  // 4FSC sample rate is fully determined by the video system.
+  double sample_rate = sample_rate_from_system(params.system);
+  size_t active_start = static_cast<size_t>(params.active_video_start);
+  size_t line_width = static_cast<size_t>(params.frame_width_nominal);
+  size_t f1_lines = field1_lines(params.system);
+
+  // CVBS_U10_4FSC zero-crossing: midpoint between blanking and white.
+  int16_t zero_crossing =
+      static_cast<int16_t>((params.white_level + params.blanking_level) / 2);
+
+  size_t line_offset = (field_index == 0) ? 0 : f1_lines;
+  size_t field_height =
+      (field_index == 0) ? f1_lines
+                         : static_cast<size_t>(params.frame_height) - f1_lines;
+
+  // Decode lines 16, 17, 18 (VBI lines; 0-based: positions 15, 16, 17)
+  std::array<int32_t, 3> vbi_data = {0, 0, 0};
+  for (int line_offset_vbi = 0; line_offset_vbi < 3; ++line_offset_vbi) {
+    size_t field_line = 15 + static_cast<size_t>(line_offset_vbi);
+    if (field_line >= field_height) {
+      vbi_data[line_offset_vbi] = -1;
+      continue;
+    }
+
+    const int16_t* line_data =
+        representation.has_separate_channels()
+            ? representation.get_line_luma(frame_id, line_offset + field_line)
+            : representation.get_line(frame_id, line_offset + field_line);
+    if (!line_data) {
+      vbi_data[line_offset_vbi] = -1;
+      continue;
+    }
+
+    vbi_data[line_offset_vbi] = decode_manchester(
+        line_data, line_width, zero_crossing, active_start, sample_rate);
+  }
+  return vbi_data;
+}
+
 void BiphaseObserver::process_frame(
     const VideoFrameRepresentation& representation, FrameID frame_id,
     IObservationContext& context) {
@@ -512,52 +589,14 @@ void BiphaseObserver::process_frame(
                   frame_id);
     return;
   }
-  const auto& vp = vp_opt.value();
-
-  // 4FSC sample rate is fully determined by the video system.
-  double sample_rate = sample_rate_from_system(vp.system);
-  size_t active_start = static_cast<size_t>(vp.active_video_start);
-  size_t line_width = static_cast<size_t>(vp.frame_width_nominal);
-  size_t f1_lines = field1_lines(vp.system);
-
-  // CVBS_U10_4FSC zero-crossing: midpoint between blanking and white.
-  int16_t zero_crossing =
-      static_cast<int16_t>((vp.white_level + vp.blanking_level) / 2);
 
   for (size_t field_idx = 0; field_idx < 2; ++field_idx) {
     FieldID derived_fid(frame_id * 2 + field_idx);
-    size_t line_offset = (field_idx == 0) ? 0 : f1_lines;
-    size_t field_height = (field_idx == 0)
-                              ? f1_lines
-                              : static_cast<size_t>(vp.frame_height) - f1_lines;
-
-    // Decode lines 16, 17, 18 (VBI lines; 0-based: positions 15, 16, 17)
-    std::array<int32_t, 3> vbi_data = {0, 0, 0};
-    int lines_decoded = 0;
-
-    for (int line_offset_vbi = 0; line_offset_vbi < 3; ++line_offset_vbi) {
-      size_t field_line = 15 + static_cast<size_t>(line_offset_vbi);
-      if (field_line >= field_height) {
-        vbi_data[line_offset_vbi] = -1;
-        continue;
-      }
-
-      const int16_t* line_data =
-          representation.has_separate_channels()
-              ? representation.get_line_luma(frame_id, line_offset + field_line)
-              : representation.get_line(frame_id, line_offset + field_line);
-      if (!line_data) {
-        vbi_data[line_offset_vbi] = -1;
-        continue;
-      }
-
-      vbi_data[line_offset_vbi] = decode_manchester(
-          line_data, line_width, zero_crossing, active_start, sample_rate);
-
-      if (vbi_data[line_offset_vbi] != 0 && vbi_data[line_offset_vbi] != -1) {
-        lines_decoded++;
-      }
-    }
+    const auto vbi_data =
+        decode_field_lines(representation, frame_id, field_idx, *vp_opt);
+    const int lines_decoded = static_cast<int>(
+        std::count_if(vbi_data.begin(), vbi_data.end(),
+                      [](int32_t code) { return code != 0 && code != -1; }));
 
     // Store the decoded VBI data in observation context
     if (lines_decoded > 0) {
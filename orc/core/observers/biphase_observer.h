@@ -11,8 +11,12 @@
 #define ORC_CORE_BIPHASE_OBSERVER_H
 
 #include <observer.h>
+#include <orc/support/vbi_types.h>
 
+#include <array>
 #include <memory>
+#include <optional>
+#include <vector>
 
 namespace orc {
 
@@ -38,6 +42,47 @@ class BiphaseObserver : public Observer {
   void process_frame(const VideoFrameRepresentation& representation,
                      FrameID frame_id, IObservationContext& context) override;
 
+  /**
+   * @brief Frame lines read by process_frame() for a video system
+   *
+   * VBI lines 16-18 of both fields, as 0-based frame lines. Whole-recording
+   * scans batch these through LineBatchRepresentation.
+   */
+  static std::vector<size_t> frame_lines(VideoSystem system);
+
+  /**
+   * @brief Biphase-decode VBI lines 16-18 of one field of a frame
+   *
+   * @param field_index 0 for the first field, 1 for the second
+   * @return Raw 24-bit codes for lines 16, 17 and 18; 0 where no code was
+   *         found and -1 where the line could not be read
+   */
+  static std::array<int32_t, 3> decode_field_lines(
+      const VideoFrameRepresentation& representation, FrameID frame_id,
+      size_t field_index, const SourceParameters& params);
+
+  /**
+   * @brief Frame-addressing codes carried by one field (IEC 60857-1986)
+   */
+  struct AddressCodes {
+    std::optional<int32_t> picture_number;    ///< CAV picture number
+    std::optional<int32_t> chapter_number;    ///< Chapter marker
+    std::optional<CLVTimecode> clv_timecode;  ///< All four parts valid
+    bool lead_in = false;
+    bool lead_out = false;
+    bool stop_code = false;
+  };
+
+  /**
+   * @brief Interpret raw line 16-18 codes as picture, chapter, CLV time and
+   *        lead-in/out/stop codes
+   *
+   * The CAV picture number is dropped when line 16 carries a CLV picture
+   * number, matching the "vbi" observations process_frame() stores.
+   */
+  static AddressCodes decode_address_codes(int32_t vbi16, int32_t vbi17,
+                                           int32_t vbi18);
+
   std::vector<ObservationKey> get_provided_observations() const override {
     return {
         {"biphase", "vbi_line_16", ObservationType::INT32,
@@ -11,11 +11,13 @@
 
 #include <orc/stage/cvbs_signal_constants.h>
 #include <orc/stage/preview/colour_preview_provider.h>
+#include <orc/stage/preview/draft_colour_preview_provider.h>
 #include <orc/stage/preview/stage_custom_preview_renderer.h>
 #include <orc/support/colour_preview_conversion.h>
 #include <orc/support/logging.h>
 #include <orc/support/preview_helpers.h>
 #include <png.h>
+#include <preview_image_pyramid.h>
 
 #include <algorithm>
 #include <cmath>
@@ -226,21 +228,10 @@ static PreviewImage scale_image_horizontal_for_export(const PreviewImage& image,
   scaled.rgb_data.resize(static_cast<size_t>(dst_width) * src_height * 3);
   scaled.vectorscope_data = image.vectorscope_data;
 
-  for (uint32_t y = 0; y < src_height; ++y) {
-    for (uint32_t x = 0; x < dst_width; ++x) {
-      uint32_t src_x = static_cast<uint32_t>(
-          std::floor(static_cast<double>(x) / correction));
-      src_x = std::min(src_x, src_width - 1);
-
-      const size_t src_offset =
-          (static_cast<size_t>(y) * src_width + src_x) * 3;
-      const size_t dst_offset = (static_cast<size_t>(y) * dst_width + x) * 3;
-
-      scaled.rgb_data[dst_offset + 0] = image.rgb_data[src_offset + 0];
-      scaled.rgb_data[dst_offset + 1] = image.rgb_data[src_offset + 1];
-      scaled.rgb_data[dst_offset + 2] = image.rgb_data[src_offset + 2];
-    }
-  }
+  resample_rgb888(image.rgb_data.data(), src_width, src_height,
+                  PreviewViewport::whole_image(src_width, src_height,
+                                               correction),
+                  scaled.rgb_data.data(), static_cast<size_t>(dst_width) * 3);
 
   scaled.dropout_regions = image.dropout_regions;
   for (auto& region : scaled.dropout_regions) {
@@ -397,11 +388,10 @@ uint64_t PreviewRenderer::get_output_count(const NodeID& node_id,
   return 0;
 }
 
-PreviewRenderResult PreviewRenderer::render_output(const NodeID& node_id,
-                                                   PreviewOutputType type,
-                                                   uint64_t index,
-                                                   const std::string& option_id,
-                                                   PreviewNavigationHint hint) {
+PreviewRenderResult PreviewRenderer::render_output(
+    const NodeID& node_id, PreviewOutputType type, uint64_t index,
+    const std::string& option_id, PreviewNavigationHint hint,
+    const CancelCheck& cancelled) {
   ORC_LOG_DEBUG(
       "render_output: node='{}', type={}, option_id='{}', index={}, hint={}",
       node_id.to_string(), static_cast<int>(type), option_id, index,
@@ -413,6 +403,20 @@ PreviewRenderResult PreviewRenderer::render_output(const NodeID& node_id,
   result.output_index = index;
   result.success = false;
 
+  // Cooperative cancellation: polled between the DAG execution and the image
+  // rendering, and passed into the per-frame render itself, which polls it
+  // between field and line fetches and around the colour decode.
+  auto cancel_requested = [&cancelled, &result]() {
+    if (cancelled && cancelled()) {
+      result.error_message = "Preview render cancelled";
+      return true;
+    }
+    return false;
+  };
+  if (cancel_requested()) {
+    return result;
+  }
+
   // Special handling for placeholder node - render "No source available" image
   if (node_id.to_string() == "_no_preview") {
     result.image = create_placeholder_image(type, "No source available");
@@ -431,6 +435,9 @@ PreviewRenderResult PreviewRenderer::render_output(const NodeID& node_id,
       if (auto* capability_stage = dynamic_cast<const IStagePreviewCapability*>(
               node_it->stage.get())) {
         ensure_node_executed(node_id, true);
+        if (cancel_requested()) {
+          return result;
+        }
         const StagePreviewCapability capability =
             capability_stage->get_preview_capability();
 
@@ -440,8 +447,21 @@ PreviewRenderResult PreviewRenderer::render_output(const NodeID& node_id,
             if (auto* colour_provider =
                     dynamic_cast<const IColourPreviewProvider*>(
                         node_it->stage.get())) {
+              auto* cancellable =
+                  dynamic_cast<const ICancellableColourPreviewProvider*>(
+                      node_it->stage.get());
               return render_colour_carrier_preview(
-                  node_id, *colour_provider, capability, type, index, hint);
+                  node_id, capability, type, index,
+                  [&]() -> std::optional<ColourFrameCarrier> {
+                    if (cancellable) {
+                      return cancellable
+                          ->get_cancellable_colour_preview_carrier(
+                              index, hint, false, cancelled);
+                    }
+                    return colour_provider->get_colour_preview_carrier(index,
+                                                                       hint);
+                  },
+                  1, cancelled);
             }
           }
 
@@ -449,10 +469,16 @@ PreviewRenderResult PreviewRenderer::render_output(const NodeID& node_id,
           if (has_signal_domain_type(capability) && frame_renderer_) {
             auto vfr_result = frame_renderer_->render_frame_at_node(
                 node_id, static_cast<FrameID>(0));
+            if (cancel_requested()) {
+              return result;
+            }
             if (vfr_result.is_valid && vfr_result.representation) {
               result.image = PreviewHelpers::render_standard_preview(
                   vfr_result.representation, option_id, index, hint,
-                  capability.geometry.mask_inactive_area);
+                  capability.geometry.mask_inactive_area, cancelled);
+              if (cancel_requested()) {
+                return result;
+              }
               result.success = result.image.is_valid();
               if (result.success) render_dropouts(result.image);
               return result;
@@ -465,6 +491,9 @@ PreviewRenderResult PreviewRenderer::render_output(const NodeID& node_id,
         // Custom rendering path for multi-output stages (e.g.
         // SourceAlignStage).
         ensure_node_executed(node_id, true);
+        if (cancel_requested()) {
+          return result;
+        }
         result.image = custom->render_preview(option_id, index, hint);
         result.success = result.image.is_valid();
         if (result.success) render_dropouts(result.image);
@@ -478,9 +507,16 @@ PreviewRenderResult PreviewRenderer::render_output(const NodeID& node_id,
       if (frame_renderer_) {
         auto vfr_result = frame_renderer_->render_frame_at_node(
             node_id, static_cast<FrameID>(0));
+        if (cancel_requested()) {
+          return result;
+        }
         if (vfr_result.is_valid && vfr_result.representation) {
           result.image = PreviewHelpers::render_standard_preview(
-              vfr_result.representation, option_id, index, hint);
+              vfr_result.representation, option_id, index, hint, false,
+              cancelled);
+          if (cancel_requested()) {
+            return result;
+          }
           result.success = result.image.is_valid();
           if (result.success) render_dropouts(result.image);
           return result;
@@ -499,14 +535,69 @@ PreviewRenderResult PreviewRenderer::render_output(const NodeID& node_id,
   return result;
 }
 
+std::optional<PreviewRenderResult> PreviewRenderer::render_draft_output(
+    const NodeID& node_id, PreviewOutputType type, uint64_t index,
+    const CancelCheck& cancelled) {
+  if (!dag_) {
+    return std::nullopt;
+  }
+  const auto& dag_nodes = dag_->nodes();
+  auto node_it =
+      std::find_if(dag_nodes.begin(), dag_nodes.end(),
+                   [&node_id](const auto& n) { return n.node_id == node_id; });
+  if (node_it == dag_nodes.end() || !node_it->stage) {
+    return std::nullopt;
+  }
+  auto* capability_stage =
+      dynamic_cast<const IStagePreviewCapability*>(node_it->stage.get());
+  auto* draft_provider =
+      dynamic_cast<const IDraftColourPreviewProvider*>(node_it->stage.get());
+  if (!capability_stage || !draft_provider ||
+      type != PreviewOutputType::Frame_Field1_First) {
+    return std::nullopt;
+  }
+
+  ensure_node_executed(node_id, true);
+  const StagePreviewCapability capability =
+      capability_stage->get_preview_capability();
+  if (!capability.is_valid() || !has_colour_domain_type(capability)) {
+    return std::nullopt;
+  }
+  if (cancelled && cancelled()) {
+    PreviewRenderResult result{};
+    result.node_id = node_id;
+    result.output_type = type;
+    result.output_index = index;
+    result.success = false;
+    result.error_message = "Preview render cancelled";
+    return result;
+  }
+
+  auto* cancellable = dynamic_cast<const ICancellableColourPreviewProvider*>(
+      node_it->stage.get());
+  return render_colour_carrier_preview(
+      node_id, capability, type, index,
+      [&]() -> std::optional<ColourFrameCarrier> {
+        if (cancellable) {
+          return cancellable->get_cancellable_colour_preview_carrier(
+              index, PreviewNavigationHint::Random, true, cancelled);
+        }
+        return draft_provider->get_draft_colour_preview_carrier(index);
+      },
+      kDraftColourPreviewDecimation, cancelled);
+}
+
 void PreviewRenderer::update_dag(std::shared_ptr<const DAG> dag) {
   dag_ = dag;
   first_field_offset_cache_.clear();
 
-  if (dag_) {
-    frame_renderer_ = std::make_unique<DAGFrameRenderer>(dag_);
-  } else {
+  if (!dag_) {
     frame_renderer_.reset();
+  } else if (frame_renderer_) {
+    // Keeps the cached results of nodes the rebuild left unchanged.
+    frame_renderer_->update_dag(dag_);
+  } else {
+    frame_renderer_ = std::make_unique<DAGFrameRenderer>(dag_);
   }
 }
 
@@ -1173,9 +1264,10 @@ std::vector<PreviewOutputInfo> PreviewRenderer::get_capability_preview_outputs(
 }
 
 PreviewRenderResult PreviewRenderer::render_colour_carrier_preview(
-    const NodeID& stage_node_id, const IColourPreviewProvider& provider,
-    const StagePreviewCapability& capability, PreviewOutputType type,
-    uint64_t index, PreviewNavigationHint hint) {
+    const NodeID& stage_node_id, const StagePreviewCapability& capability,
+    PreviewOutputType type, uint64_t index,
+    const std::function<std::optional<ColourFrameCarrier>()>& fetch_carrier,
+    uint32_t widen, const CancelCheck& cancelled) {
   PreviewRenderResult result{};
   result.node_id = stage_node_id;
   result.output_type = type;
@@ -1198,7 +1290,11 @@ PreviewRenderResult PreviewRenderer::render_colour_carrier_preview(
     return result;
   }
 
-  auto carrier_opt = provider.get_colour_preview_carrier(index, hint);
+  auto carrier_opt = fetch_carrier();
+  if (cancelled && cancelled()) {
+    result.error_message = "Preview render cancelled";
+    return result;
+  }
   if (!carrier_opt.has_value() || !carrier_opt->is_valid()) {
     result.error_message = "Failed to fetch colour preview carrier";
     result.image = create_placeholder_image(type, "Rendering failed");
@@ -1207,6 +1303,9 @@ PreviewRenderResult PreviewRenderer::render_colour_carrier_preview(
   }
 
   result.image = render_preview_from_colour_carrier(*carrier_opt);
+  if (widen > 1) {
+    result.image = scale_image_horizontal_for_export(result.image, widen);
+  }
   result.success = result.image.is_valid();
   result.image.vectorscope_data = carrier_opt->vectorscope_data;
 
@@ -48,6 +48,8 @@
 #include <sstream>
 #include <stdexcept>
 
+#include "core_blob_store.h"
+#include "core_tracer.h"
 #include "dag_executor.h"
 #include "include/stage_plugin_registry.h"
 #include "project_to_dag.h"
@@ -70,6 +72,70 @@ std::filesystem::path resolve_project_root_for_filename(
   return yaml_path.parent_path();
 }
 
+// Values of blob_storage parameters shorter than this stay inline in the
+// YAML; a small map is easier to read there than a sidecar reference.
+constexpr size_t kBlobInlineLimit = 1024;
+
+// Sidecar directory of a project file: "<dir>/<stem>.blobs".
+std::filesystem::path blob_directory_for(
+    const std::filesystem::path& project_file) {
+  return project_file.parent_path() /
+         (project_file.stem().string() + ".blobs");
+}
+
+// Move large values of the stage's blob_storage parameters into the host blob
+// store, leaving blob references in their place.
+void externalize_blob_parameters(
+    const std::string& stage_name, VideoSystem video_format,
+    SourceType source_format,
+    std::map<std::string, ParameterValue>& parameters) {
+  const auto is_large_text = [](const ParameterValue& value) {
+    const auto* text = std::get_if<std::string>(&value);
+    return text && text->size() >= kBlobInlineLimit;
+  };
+  if (std::none_of(parameters.begin(), parameters.end(),
+                   [&](const auto& p) { return is_large_text(p.second); })) {
+    return;
+  }
+
+  auto& registry = StageRegistry::instance();
+  if (!registry.has_stage(stage_name)) {
+    return;
+  }
+  auto stage = registry.create_stage(stage_name);
+  auto* param_stage = dynamic_cast<ParameterizedStage*>(stage.get());
+  if (!param_stage) {
+    return;
+  }
+  for (const auto& desc :
+       param_stage->get_parameter_descriptors(video_format, source_format)) {
+    auto it = parameters.find(desc.name);
+    if (!desc.blob_storage || it == parameters.end() ||
+        !is_large_text(it->second)) {
+      continue;
+    }
+    it->second = host_blob_store().put(std::get<std::string>(it->second));
+  }
+}
+
+// Remove sidecar files of blobs the saved project no longer references.
+void prune_blob_directory(const std::filesystem::path& directory,
+                          const std::set<std::string>& referenced) {
+  std::error_code ec;
+  if (!std::filesystem::is_directory(directory, ec)) {
+    return;
+  }
+  for (const auto& file : std::filesystem::directory_iterator(directory, ec)) {
+    const auto name = file.path().filename().string();
+    if (file.path().extension() == ".blob" && !referenced.count(name)) {
+      std::filesystem::remove(file.path(), ec);
+    }
+  }
+  if (std::filesystem::is_empty(directory, ec)) {
+    std::filesystem::remove(directory, ec);
+  }
+}
+
 ProjectPluginRequirement requirement_from_registry_entry(
     const StagePluginRegistryEntry& entry) {
   ProjectPluginRequirement requirement;
@@ -493,6 +559,7 @@ Project load_project_from_yaml(const std::string& yaml_text,
 
   Project project;
   project.project_root_ = yaml_path.parent_path().string();
+  const std::filesystem::path blob_dir = blob_directory_for(yaml_path);
 
   YAML::Node root;
   try {
@@ -650,6 +717,18 @@ Project load_project_from_yaml(const std::string& yaml_text,
             node.parameters[param_name] = param_map["value"].as<double>();
           } else if (type == "bool") {
             node.parameters[param_name] = param_map["value"].as<bool>();
+          } else if (type == "blob") {
+            // Large value kept in a sidecar file, read when first used
+            std::string ref = param_map["value"].as<std::string>();
+            if (!is_blob_ref(ref)) {
+              throw std::runtime_error(
+                  "Invalid project file '" + filename_hint + "': parameter '" +
+                  param_name + "' has an invalid blob reference");
+            }
+            host_blob_store().add_sidecar(
+                ref, (blob_dir / CoreBlobStore::sidecar_file_name(ref))
+                         .string());
+            node.parameters[param_name] = std::move(ref);
           } else {
             // String parameter - store as-is to preserve original format
             // (relative/absolute/${PROJECT_ROOT})
@@ -674,6 +753,11 @@ Project load_project_from_yaml(const std::string& yaml_text,
         }
       }
 
+      // Projects saved before blob storage hold edit maps inline; move them
+      // to the blob store so the next save writes sidecars.
+      externalize_blob_parameters(node.stage_name, project.video_format_,
+                                  project.source_format_, node.parameters);
+
       project.nodes_.push_back(node);
     }
   }
@@ -954,8 +1038,10 @@ std::string serialize_project_to_yaml(const Project& project,
           std::string value = std::get<std::string>(param_value);
 
           // Save string parameters as-is to preserve their original format
-          // (relative paths, absolute paths, or ${PROJECT_ROOT} variables)
-          out << YAML::Key << "type" << YAML::Value << "string";
+          // (relative paths, absolute paths, or ${PROJECT_ROOT} variables).
+          // Blob references name a sidecar file written by save_project().
+          out << YAML::Key << "type" << YAML::Value
+              << (is_blob_ref(value) ? "blob" : "string");
           out << YAML::Key << "value" << YAML::Value << value;
         }
         out << YAML::EndMap;
@@ -1001,6 +1087,27 @@ std::string serialize_project_to_yaml(const Project& project,
 void save_project(const Project& project, const std::string& filename) {
   std::string yaml_text = serialize_project_to_yaml(project, filename);
 
+  // Write blob sidecars first so the YAML never references a missing file.
+  const std::filesystem::path blob_dir =
+      blob_directory_for(resolve_project_root_for_filename(filename) /
+                         std::filesystem::path(filename).filename());
+  std::set<std::string> blob_files;
+  for (const auto& node : project.nodes_) {
+    for (const auto& [param_name, param_value] : node.parameters) {
+      const auto* ref = std::get_if<std::string>(&param_value);
+      if (!ref || !is_blob_ref(*ref)) {
+        continue;
+      }
+      std::string error;
+      if (!host_blob_store().write_sidecar(*ref, blob_dir.string(), error)) {
+        throw std::runtime_error("Failed to save parameter '" + param_name +
+                                 "' of node " + node.node_id.to_string() +
+                                 ": " + error);
+      }
+      blob_files.insert(CoreBlobStore::sidecar_file_name(*ref));
+    }
+  }
+
   // Write to file
   std::ofstream file(filename);
   if (!file.is_open()) {
@@ -1009,6 +1116,8 @@ void save_project(const Project& project, const std::string& filename) {
   file << yaml_text;
   file.close();
 
+  prune_blob_directory(blob_dir, blob_files);
+
   // Clear modification flag - project has been saved
   project.clear_modified_flag();
 }
@@ -1460,7 +1569,10 @@ void set_node_parameters(
     }
   }
 
-  node_it->parameters = parameters;
+  auto stored = parameters;
+  externalize_blob_parameters(node_it->stage_name, project.video_format_,
+                              project.source_format_, stored);
+  node_it->parameters = std::move(stored);
 
   // Source stages handle their own caching via set_parameters()
 
@@ -1725,8 +1837,13 @@ bool trigger_node(Project& project, NodeID node_id, std::string& status_out,
 
   // Trigger (DAG and executor stay alive, keeping stage instances valid)
   ObservationContext observation_context;
-  bool success =
-      trigger_stage->trigger(inputs, it->parameters, observation_context);
+  bool success = false;
+  {
+    const std::string node_label = node_id.to_string();
+    TraceScope trace(&host_tracer(), "dag", "trigger", node_label.c_str());
+    success =
+        trigger_stage->trigger(inputs, it->parameters, observation_context);
+  }
   status_out = trigger_stage->get_trigger_status();
 
   // DAG and executor destroyed here AFTER trigger completes, ensuring stages
@@ -1787,6 +1904,9 @@ std::future<std::pair<bool, std::string>> trigger_node_async(
           }
 
           ObservationContext observation_context;
+          const std::string node_label = node_id.to_string();
+          TraceScope trace(&host_tracer(), "dag", "trigger",
+                           node_label.c_str());
           bool success = trigger_stage->trigger(inputs, target_node->parameters,
                                                 observation_context);
           std::string status = trigger_stage->get_trigger_status();
@@ -16,6 +16,8 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <functional>
+#include <map>
 #include <sstream>
 
 #include "stage_registry.h"
@@ -55,6 +57,66 @@ std::string build_missing_stage_message(const Project& project,
          std::to_string(node.node_id.value());
 }
 
+// True when @p node can keep the stage instance of @p previous: the stage
+// type, effective parameters and input edges are unchanged.
+bool same_node_configuration(const DAGNode& node, const DAGNode& previous) {
+  if (!previous.stage) {
+    return false;
+  }
+  const auto info = node.stage->get_node_type_info();
+  const auto previous_info = previous.stage->get_node_type_info();
+  return info.stage_name == previous_info.stage_name &&
+         node.stage->version() == previous.stage->version() &&
+         node.parameters == previous.parameters &&
+         node.input_node_ids == previous.input_node_ids &&
+         node.input_indices == previous.input_indices;
+}
+
+// Mark each node of @p nodes that can reuse its stage instance from
+// @p previous. A node is reusable only when its own configuration and that of
+// every node upstream of it are unchanged, so the reused stage sees exactly the
+// inputs it saw before.
+std::map<NodeID, bool> find_reusable_nodes(const std::vector<DAGNode>& nodes,
+                                           const DAG& previous) {
+  std::map<NodeID, size_t> index;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    index[nodes[i].node_id] = i;
+  }
+  const auto previous_index = previous.build_node_index();
+
+  std::map<NodeID, bool> reusable;
+  std::function<bool(const NodeID&)> visit = [&](const NodeID& node_id) {
+    auto done = reusable.find(node_id);
+    if (done != reusable.end()) {
+      return done->second;
+    }
+    // Provisionally false so a cycle terminates; validation rejects it later.
+    reusable[node_id] = false;
+
+    auto it = index.find(node_id);
+    auto previous_it = previous_index.find(node_id);
+    if (it == index.end() || previous_it == previous_index.end()) {
+      return false;
+    }
+    const DAGNode& node = nodes[it->second];
+    bool result = same_node_configuration(
+        node, previous.nodes()[previous_it->second]);
+    for (const auto& input_id : node.input_node_ids) {
+      if (!result) {
+        break;
+      }
+      result = visit(input_id);
+    }
+    reusable[node_id] = result;
+    return result;
+  };
+
+  for (const auto& node : nodes) {
+    visit(node.node_id);
+  }
+  return reusable;
+}
+
 }  // namespace
 
 // Helper function to resolve paths relative to project root
@@ -95,7 +157,8 @@ static std::string resolve_path_for_execution(const std::string& path,
   }
 }
 
-std::shared_ptr<DAG> project_to_dag(const Project& project) {
+std::shared_ptr<DAG> project_to_dag(const Project& project,
+                                    const DAG* previous) {
   auto dag = std::make_shared<DAG>();
   auto& registry = StageRegistry::instance();
 
@@ -182,14 +245,6 @@ std::shared_ptr<DAG> project_to_dag(const Project& project) {
           value);
     }
 
-    // Apply parameters to the stage instance if it's parameterized
-    auto* param_stage = dynamic_cast<ParameterizedStage*>(dag_node.stage.get());
-    if (param_stage && !dag_node.parameters.empty()) {
-      param_stage->set_parameters(dag_node.parameters);
-      ORC_LOG_DEBUG("Node '{}': Applied {} parameters to stage instance",
-                    proj_node.node_id, dag_node.parameters.size());
-    }
-
     // Find input edges for this node
     for (const auto& edge : project.get_edges()) {
       if (edge.target_node_id == proj_node.node_id) {
@@ -201,6 +256,40 @@ std::shared_ptr<DAG> project_to_dag(const Project& project) {
     dag_nodes.push_back(dag_node);
   }
 
+  // Carry over the stage instances of the unchanged subgraph, so sources keep
+  // their opened files and loaded metadata and the executor's artifact cache
+  // keeps serving their outputs. Every other node gets its fresh instance.
+  std::map<NodeID, bool> reusable;
+  if (previous) {
+    reusable = find_reusable_nodes(dag_nodes, *previous);
+  }
+  const auto previous_index =
+      previous ? previous->build_node_index() : std::map<NodeID, size_t>{};
+  size_t reused_count = 0;
+
+  for (auto& dag_node : dag_nodes) {
+    auto it = reusable.find(dag_node.node_id);
+    if (it != reusable.end() && it->second) {
+      dag_node.stage =
+          previous->nodes()[previous_index.at(dag_node.node_id)].stage;
+      ++reused_count;
+      continue;
+    }
+
+    // Apply parameters to the stage instance if it's parameterized
+    auto* param_stage = dynamic_cast<ParameterizedStage*>(dag_node.stage.get());
+    if (param_stage && !dag_node.parameters.empty()) {
+      param_stage->set_parameters(dag_node.parameters);
+      ORC_LOG_DEBUG("Node '{}': Applied {} parameters to stage instance",
+                    dag_node.node_id, dag_node.parameters.size());
+    }
+  }
+
+  if (previous) {
+    ORC_LOG_DEBUG("DAG rebuild: reused {} of {} stage instances",
+                  reused_count, dag_nodes.size());
+  }
+
   // Add all nodes to DAG
   for (const auto& node : dag_nodes) {
     dag->add_node(node);
@@ -21,7 +21,11 @@
 
 #include "../../sdk/include/orc/abi/orc_plugin_services.h"
 #include "../../sdk/include/orc/plugin/orc_stage_services.h"
+#include "core_blob_store.h"
+#include "core_frame_buffer_pool.h"
+#include "core_metrics.h"
 #include "core_observation_service.h"
+#include "core_tracer.h"
 #include "factories.h"
 #include "include/plugin_safe_call.h"
 
@@ -196,6 +200,45 @@ class CoreStageServicesAdapter final : public IStageServices {
     }
     return std::make_shared<FileWriterInt16ServiceAdapter>(std::move(writer));
   }
+
+  std::shared_ptr<IFileWriterUint8> create_async_file_writer_uint8(
+      const AsyncFileWriterOptions& options) override {
+    auto factories = Factories::instance();
+    if (!factories) {
+      return nullptr;
+    }
+    auto writer = factories->create_instance_async_file_writer_uint8(options);
+    if (!writer) {
+      return nullptr;
+    }
+    return std::make_shared<FileWriterUint8ServiceAdapter>(std::move(writer));
+  }
+
+  std::shared_ptr<IFileWriterUint16> create_async_file_writer_uint16(
+      const AsyncFileWriterOptions& options) override {
+    auto factories = Factories::instance();
+    if (!factories) {
+      return nullptr;
+    }
+    auto writer = factories->create_instance_async_file_writer_uint16(options);
+    if (!writer) {
+      return nullptr;
+    }
+    return std::make_shared<FileWriterUint16ServiceAdapter>(std::move(writer));
+  }
+
+  std::shared_ptr<IFileWriterInt16> create_async_file_writer_int16(
+      const AsyncFileWriterOptions& options) override {
+    auto factories = Factories::instance();
+    if (!factories) {
+      return nullptr;
+    }
+    auto writer = factories->create_instance_async_file_writer_int16(options);
+    if (!writer) {
+      return nullptr;
+    }
+    return std::make_shared<FileWriterInt16ServiceAdapter>(std::move(writer));
+  }
 };
 
 struct RegisterContext {
@@ -436,6 +479,18 @@ StagePluginLoader::LoadResult StagePluginLoader::load_plugin(
   // instance backs every plugin; its lifetime spans the whole process.
   static CoreObservationService observation_service;
   services.observation_service = &observation_service;
+  // Host-owned frame buffer pool (ABI 12). One process-wide pool, so buffers
+  // released by one plugin's caches are recycled by every other plugin.
+  services.frame_buffer_pool = &host_frame_buffer_pool();
+  // Host execution tracer (ABI 13). Process-wide, so plugin spans share one
+  // timeline with the host's DAG spans.
+  services.tracer = &host_tracer();
+  // Host metrics registry (ABI 14). Process-wide, so every instance of a
+  // stage contributes to the same series.
+  services.metrics = &host_metrics();
+  // Host blob store (ABI 16). Process-wide, shared with the project layer
+  // that fills it from the sidecar files.
+  services.blob_store = &host_blob_store();
 
   std::string last_error;
   RegisterContext context{&register_stage_callback, &entry.plugin, &last_error,
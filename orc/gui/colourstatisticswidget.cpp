@@ -0,0 +1,193 @@
+/*
+ * File:        colourstatisticswidget.cpp
+ * Module:      orc-gui
+ * Purpose:     Accumulated vectorscope density and luma histogram widget
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "colourstatisticswidget.h"
+
+#include <QPainter>
+#include <QPen>
+#include <QSizePolicy>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "plotwidget.h"  // PlotWidget::isDarkTheme()
+#include "preview/vectorscope_geometry.h"
+#include "theme_color_tokens.h"
+
+namespace {
+
+constexpr int kMargin = 8;
+constexpr int kAxisLabelHeight = 18;
+constexpr int kTargetBoxSize = 8;
+
+// Colour-bar labels for rgb masks 1..6, as in the live vectorscope.
+constexpr const char* kBarLabels[] = {"", "B", "G", "Cy", "R", "Mg", "Yl"};
+
+}  // namespace
+
+ColourStatisticsWidget::ColourStatisticsWidget(QWidget* parent)
+    : QWidget(parent) {
+  setMinimumSize(600, 300);
+  setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+}
+
+void ColourStatisticsWidget::setData(
+    std::shared_ptr<const orc::ColourStatisticsData> data) {
+  data_ = std::move(data);
+  rebuildDensityImage();
+  update();
+}
+
+void ColourStatisticsWidget::clear() { setData(nullptr); }
+
+void ColourStatisticsWidget::rebuildDensityImage() {
+  constexpr int kBins =
+      static_cast<int>(orc::ColourStatisticsData::kUVBinCount);
+  if (!data_ || data_->uv_density.size() !=
+                    static_cast<size_t>(kBins) * static_cast<size_t>(kBins)) {
+    density_image_ = QImage();
+    return;
+  }
+
+  const uint64_t peak =
+      *std::max_element(data_->uv_density.begin(), data_->uv_density.end());
+  density_image_ = QImage(kBins, kBins, QImage::Format_RGB32);
+  density_image_.fill(Qt::black);
+  if (peak == 0) return;
+
+  // Log scale: a whole recording piles most samples near the centre, and the
+  // outliers that matter for gain and phase are many decades fainter.
+  const double scale = 1.0 / std::log1p(static_cast<double>(peak));
+  for (int v = 0; v < kBins; ++v) {
+    auto* line =
+        reinterpret_cast<QRgb*>(density_image_.scanLine(kBins - 1 - v));
+    for (int u = 0; u < kBins; ++u) {
+      const uint64_t count = data_->uv_count(static_cast<size_t>(u),
+                                             static_cast<size_t>(v));
+      if (count == 0) continue;
+      const double t = std::log1p(static_cast<double>(count)) * scale;
+      const int glow = static_cast<int>(200.0 * t * t);
+      line[u] = qRgb(glow, 48 + static_cast<int>(207.0 * t), glow);
+    }
+  }
+}
+
+void ColourStatisticsWidget::paintEvent(QPaintEvent*) {
+  QPainter painter(this);
+  painter.fillRect(rect(), palette().color(QPalette::Base));
+
+  const QRect content = rect().adjusted(kMargin, kMargin, -kMargin, -kMargin);
+  const int scope_size = std::min(content.height(), content.width() / 2);
+  const QRect scope_area(content.left(), content.top(), scope_size,
+                         scope_size);
+  const QRect histogram_area(scope_area.right() + kMargin * 2, content.top(),
+                             content.right() - scope_area.right() - kMargin * 2,
+                             content.height());
+
+  if (!data_ || data_->frames_decoded == 0) {
+    painter.setPen(theme_tokens::mutedText(palette()));
+    painter.drawText(content, Qt::AlignCenter, "No data");
+    return;
+  }
+
+  drawVectorscope(painter, scope_area);
+  drawLumaHistogram(painter, histogram_area);
+}
+
+void ColourStatisticsWidget::drawVectorscope(QPainter& painter,
+                                             const QRect& area) const {
+  painter.fillRect(area, Qt::black);
+  if (!density_image_.isNull()) {
+    painter.drawImage(area, density_image_);
+  }
+
+  painter.save();
+  painter.setRenderHint(QPainter::Antialiasing, true);
+  const QPointF centre = QRectF(area).center();
+  const double half = area.width() / 2.0;
+  auto map_uv = [&](double u, double v) {
+    return QPointF(centre.x() + u * half, centre.y() - v * half);
+  };
+
+  // Axes and the full-scale circle; counts are normalised to the same
+  // active-video swing as the live vectorscope.
+  painter.setPen(QPen(QColor(255, 255, 255, 70), 1));
+  painter.drawLine(map_uv(-1.0, 0.0), map_uv(1.0, 0.0));
+  painter.drawLine(map_uv(0.0, -1.0), map_uv(0.0, 1.0));
+  painter.drawEllipse(centre, half, half);
+
+  for (int rgb = 1; rgb < 7; ++rgb) {
+    const orc::UVSample target =
+        orc::gui::vectorscopeDisplayTargetUv(rgb, 0.75, 1.0, data_->system);
+    const QPointF point = map_uv(target.u, target.v);
+    painter.setPen(QPen(QColor(255, 255, 255, 160), 1));
+    painter.drawRect(QRectF(point.x() - kTargetBoxSize / 2.0,
+                            point.y() - kTargetBoxSize / 2.0, kTargetBoxSize,
+                            kTargetBoxSize));
+    painter.drawText(point + QPointF(kTargetBoxSize, -kTargetBoxSize),
+                     kBarLabels[rgb]);
+  }
+  painter.restore();
+
+  painter.setPen(QColor(255, 255, 255, 160));
+  painter.drawText(area.adjusted(4, 2, -4, -2), Qt::AlignLeft | Qt::AlignTop,
+                   QString("U/V, %1 frames").arg(data_->frames_decoded));
+}
+
+void ColourStatisticsWidget::drawLumaHistogram(QPainter& painter,
+                                               const QRect& area) const {
+  using Data = orc::ColourStatisticsData;
+  const QRect plot = area.adjusted(0, 0, 0, -kAxisLabelHeight);
+  if (plot.width() <= 0 || plot.height() <= 0) return;
+
+  const QColor grid = theme_tokens::gridLine(palette());
+  const QColor muted = theme_tokens::mutedText(palette());
+  const QColor bars = theme_tokens::plotColor(
+      theme_tokens::PlotColorToken::LumaPrimary, PlotWidget::isDarkTheme());
+
+  painter.setPen(grid);
+  painter.drawRect(plot.adjusted(0, 0, -1, -1));
+
+  const uint64_t peak =
+      *std::max_element(data_->y_bins.begin(), data_->y_bins.end());
+  const double x_per_bin =
+      static_cast<double>(plot.width()) / static_cast<double>(Data::kYBinCount);
+  if (peak > 0) {
+    for (size_t bin = 0; bin < Data::kYBinCount; ++bin) {
+      if (data_->y_bins[bin] == 0) continue;
+      const double height = static_cast<double>(data_->y_bins[bin]) /
+                            static_cast<double>(peak) * plot.height();
+      painter.fillRect(QRectF(plot.left() + bin * x_per_bin,
+                              plot.bottom() + 1 - height,
+                              std::max(1.0, x_per_bin), height),
+                       bars);
+    }
+  }
+
+  // Black and white level markers, labelled along the bottom.
+  auto percent_to_x = [&](double percent) {
+    return plot.left() + (percent - Data::kYRangeMin) /
+                             (Data::kYRangeMax - Data::kYRangeMin) *
+                             plot.width();
+  };
+  painter.setPen(QPen(muted, 1, Qt::DashLine));
+  for (double percent : {0.0, 100.0}) {
+    const double x = percent_to_x(percent);
+    painter.drawLine(QPointF(x, plot.top()), QPointF(x, plot.bottom()));
+  }
+  painter.setPen(muted);
+  for (double percent : {0.0, 50.0, 100.0}) {
+    const double x = percent_to_x(percent);
+    painter.drawText(QRectF(x - 30, plot.bottom() + 2, 60, kAxisLabelHeight),
+                     Qt::AlignHCenter | Qt::AlignTop,
+                     QString("%1%").arg(percent, 0, 'f', 0));
+  }
+  painter.drawText(plot.adjusted(4, 2, -4, -2), Qt::AlignLeft | Qt::AlignTop,
+                   "Luma");
+}
@@ -0,0 +1,52 @@
+/*
+ * File:        colourstatisticswidget.h
+ * Module:      orc-gui
+ * Purpose:     Accumulated vectorscope density and luma histogram widget
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#ifndef COLOURSTATISTICSWIDGET_H
+#define COLOURSTATISTICSWIDGET_H
+
+#include <orc_colour_statistics.h>
+
+#include <QImage>
+#include <QRect>
+#include <QWidget>
+#include <memory>
+
+class QPainter;
+
+/**
+ * @brief Widget for displaying whole-recording colour statistics
+ *
+ * Draws the accumulated U/V density as a log-scaled vectorscope with 75 %
+ * colour-bar targets on the left, and the luma histogram with black and
+ * white markers on the right. Takes a shared snapshot of the counts, so
+ * partial results can be shown while the analysis is still running.
+ */
+class ColourStatisticsWidget : public QWidget {
+  Q_OBJECT
+
+ public:
+  explicit ColourStatisticsWidget(QWidget* parent = nullptr);
+
+  /// Show @p data (null clears the display).
+  void setData(std::shared_ptr<const orc::ColourStatisticsData> data);
+  void clear();
+
+ protected:
+  void paintEvent(QPaintEvent* event) override;
+
+ private:
+  void rebuildDensityImage();
+  void drawVectorscope(QPainter& painter, const QRect& area) const;
+  void drawLumaHistogram(QPainter& painter, const QRect& area) const;
+
+  std::shared_ptr<const orc::ColourStatisticsData> data_;
+  QImage density_image_;  // kUVBinCount square, +V up
+};
+
+#endif  // COLOURSTATISTICSWIDGET_H
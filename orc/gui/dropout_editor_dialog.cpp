@@ -23,7 +23,6 @@
 #include <algorithm>
 
 #include "logging.h"
-#include "preview_image_qt.h"
 
 namespace {
 
@@ -72,7 +71,7 @@ DropoutFrameView::DropoutFrameView(QWidget* parent)
 }
 
 void DropoutFrameView::setFrame(
-    const QImage& frame_image,
+    const orc::PreviewImage& frame_image,
     const std::vector<orc::presenters::DropoutRegion>& source_dropouts,
     const std::vector<orc::presenters::DropoutRegion>& additions,
     const std::vector<orc::presenters::DropoutRegion>& removals) {
@@ -697,7 +696,8 @@ void DropoutEditorRenderWorker::renderFrame(uint64_t frame_id) {
   result.success = false;
   try {
     result = render_presenter_->renderPreview(
-        input_node_id_, frame_output_type_, frame_id, render_option_id_);
+        input_node_id_, frame_output_type_, frame_id, render_option_id_,
+        nullptr);
   } catch (const std::exception& e) {
     result.error_message = e.what();
     ORC_LOG_ERROR("DropoutEditorRenderWorker: render of frame {} failed: {}",
@@ -1149,16 +1149,13 @@ void DropoutEditorDialog::onFrameReady(uint64_t frame_id,
     return;
   }
 
-  frame_image_ =
-      orc::gui::previewImageToQImage(result.image, std::move(frame_image_));
-
   // The sequential render reports source dropouts in image coordinates,
   // which equal frame-flat coordinates for this layout.
   std::vector<orc::presenters::DropoutRegion> source_dropouts =
       result.image.dropout_regions;
 
   const orc::presenters::FrameDropoutMap state = frameEditState(frame_id);
-  frame_view_->setFrame(frame_image_, source_dropouts, state.additions,
+  frame_view_->setFrame(result.image, source_dropouts, state.additions,
                         state.removals);
   loaded_frame_id_ = static_cast<orc::FrameID>(frame_id);
   refreshRegionTable();
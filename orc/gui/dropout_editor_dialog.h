@@ -17,7 +17,6 @@
 
 #include <QComboBox>
 #include <QDialog>
-#include <QImage>
 #include <QKeyEvent>
 #include <QLabel>
 #include <QMouseEvent>
@@ -92,7 +91,7 @@ class DropoutFrameView : public FrameViewportWidget {
    * @param removals Dropout regions to remove
    */
   void setFrame(
-      const QImage& frame_image,
+      const orc::PreviewImage& frame_image,
       const std::vector<orc::presenters::DropoutRegion>& source_dropouts,
       const std::vector<orc::presenters::DropoutRegion>& additions,
       const std::vector<orc::presenters::DropoutRegion>& removals);
@@ -453,7 +452,6 @@ class DropoutEditorDialog : public QDialog {
   size_t total_frames_;
   // Authoritative edit state; mutated only via applyFrameEditState()
   std::map<uint64_t, orc::presenters::FrameDropoutMap> dropout_map_;
-  QImage frame_image_;  // Reused buffer for PreviewImage conversion
   bool initial_fit_done_ = false;
   bool syncing_selection_ = false;  // Guard against table<->view echo
 
@@ -37,16 +37,13 @@ FieldPreviewWidget::FieldPreviewWidget(QWidget* parent) : QWidget(parent) {
 FieldPreviewWidget::~FieldPreviewWidget() {}
 
 void FieldPreviewWidget::setImage(const orc::PreviewImage& image) {
-  current_image_ =
-      orc::gui::previewImageToQImage(image, std::move(current_image_));
-
-  if (current_image_.isNull()) {
-    dropout_regions_.clear();
-  } else {
-    // Store dropout regions for visualization
-    dropout_regions_ = image.dropout_regions;
+  // Builds the mip levels and buckets the dropout regions per tile once per
+  // frame; every later repaint resamples from here.
+  pyramid_ = orc::PreviewImagePyramid(image);
+
+  if (!pyramid_.empty()) {
     ORC_LOG_DEBUG("FieldPreviewWidget::setImage - dropout regions count: {}",
-                  dropout_regions_.size());
+                  pyramid_.dropout_regions().size());
   }
 
   updateViewGeometry();
@@ -54,8 +51,8 @@ void FieldPreviewWidget::setImage(const orc::PreviewImage& image) {
 }
 
 void FieldPreviewWidget::clearImage() {
-  current_image_ = QImage();
-  dropout_regions_.clear();
+  pyramid_ = orc::PreviewImagePyramid();
+  view_image_ = QImage();
   updateViewGeometry();
   update();
 }
@@ -69,16 +66,18 @@ void FieldPreviewWidget::setAspectCorrection(double correction) {
 void FieldPreviewWidget::updateViewGeometry() {
   // Fit-to-widget presentation: the zoom always letterboxes the
   // aspect-corrected image inside the widget rect.
-  geometry_.setImageSize(current_image_.size());
+  geometry_.setImageSize(originalImageSize());
   geometry_.setViewportSize(size());
   geometry_.setZoom(geometry_.fitZoom());
   image_rect_ = geometry_.targetRect();
+  view_image_stale_ = true;
 }
 
 void FieldPreviewWidget::setShowDropouts(bool show) {
   show_dropouts_ = show;
+  view_image_stale_ = true;
   ORC_LOG_DEBUG("FieldPreviewWidget::setShowDropouts: {} (regions count: {})",
-                show, dropout_regions_.size());
+                show, pyramid_.dropout_regions().size());
   update();
 }
 
@@ -92,13 +91,13 @@ void FieldPreviewWidget::setCrosshairsEnabled(bool enabled) {
 }
 
 void FieldPreviewWidget::updateCrosshairsPosition(int image_x, int image_y) {
-  if (current_image_.isNull()) {
+  if (pyramid_.empty()) {
     return;
   }
 
   // Clamp coordinates to valid image bounds and store in image space; the
   // paint event maps to widget coordinates at the current scale.
-  QSize image_size = current_image_.size();
+  QSize image_size = originalImageSize();
   locked_crosshairs_image_ =
       QPoint(qBound(0, image_x, image_size.width() - 1),
              qBound(0, image_y, image_size.height() - 1));
@@ -117,54 +116,22 @@ void FieldPreviewWidget::paintEvent(QPaintEvent* event) {
 
   // Core always provides a renderable image (real content or placeholder)
   // so we don't need local "No preview available" handling
-  if (current_image_.isNull()) {
+  if (pyramid_.empty()) {
     return;
   }
 
-  // Scale image to fit widget with aspect-ratio correction (shared geometry)
-  const QRect dest_rect = image_rect_;
-  QSize image_size = current_image_.size();
-
-  // Use smooth transformation for better quality when scaling
-  // This is especially important for chroma information to avoid aliasing
-  // artifacts Modern systems should handle this fine, even during scrubbing
-  painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
-  painter.drawImage(dest_rect, current_image_);
-
-  // Draw dropout regions if enabled
-  if (show_dropouts_ && !dropout_regions_.empty()) {
-    painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-
-    // Draw each dropout region as a semi-transparent red rectangle
-    for (const auto& region : dropout_regions_) {
-      int line = static_cast<int>(region.line);
-      int start_sample = static_cast<int>(region.start_sample);
-      int end_sample = static_cast<int>(region.end_sample);
-
-      // Validate region bounds
-      if (line < 0 || line >= image_size.height() || start_sample < 0 ||
-          end_sample > image_size.width() || start_sample >= end_sample) {
-        continue;
-      }
-
-      // Map image coordinates to widget coordinates
-      const qreal widget_x1 =
-          geometry_.widgetFromImage(QPointF(start_sample, line)).x();
-      const qreal widget_x2 =
-          geometry_.widgetFromImage(QPointF(end_sample, line)).x();
-      const qreal widget_y =
-          geometry_.widgetFromImage(QPointF(start_sample, line)).y();
-
-      // Calculate thickness - scale with image height, 1-4 pixels
-      int thickness = std::max(1, std::min(4, image_rect_.height() / 200));
-
-      // Draw solid red region centered on the scanline
-      QColor color(255, 0, 0);  // Solid red
-      QRectF dropout_rect(widget_x1, widget_y - thickness / 2.0,
-                          widget_x2 - widget_x1, thickness);
-      painter.fillRect(dropout_rect, color);
-    }
+  // Render the widget-sized view once per frame, resize, aspect or overlay
+  // change, then draw it unscaled. The pyramid picks the mip level for the
+  // fit zoom (box-filtered, so minified chroma does not alias) and paints the
+  // dropouts of the visible tiles as 1-4 pixel red bands.
+  if (view_image_stale_) {
+    view_image_ = orc::gui::renderPreviewViewport(
+        pyramid_, geometry_.previewViewport(image_rect_), show_dropouts_,
+        std::move(view_image_));
+    view_image_stale_ = false;
   }
+  painter.drawImage(image_rect_.topLeft(), view_image_);
+  const QSize image_size = originalImageSize();
 
   // Draw cross-hairs if enabled. The locked position is stored in image
   // pixels and mapped to widget coordinates here, so the cross-hairs follow
@@ -221,7 +188,7 @@ void FieldPreviewWidget::mouseMoveEvent(QMouseEvent* event) {
   // If mouse button is pressed and we're over the image, request line scope
   // update
   if (mouse_button_pressed_ && image_rect_.contains(event->pos()) &&
-      !current_image_.isNull()) {
+      !pyramid_.empty()) {
     // Throttle updates using timer
     pending_line_scope_pos_ = event->pos();
     line_scope_update_pending_ = true;
@@ -241,7 +208,7 @@ void FieldPreviewWidget::mousePressEvent(QMouseEvent* event) {
 
     // Lock cross-hairs at the clicked image pixel and emit the click when
     // over the image area
-    if (image_rect_.contains(event->pos()) && !current_image_.isNull()) {
+    if (image_rect_.contains(event->pos()) && !pyramid_.empty()) {
       const QPoint image_pixel = geometry_.imagePixelFromWidget(event->pos());
       locked_crosshairs_image_ = image_pixel;
       emit lineClicked(image_pixel.x(), image_pixel.y());
@@ -259,7 +226,7 @@ void FieldPreviewWidget::mouseReleaseEvent(QMouseEvent* event) {
     line_scope_update_pending_ = false;
 
     // Lock cross-hairs at final position after drag
-    if (image_rect_.contains(event->pos()) && !current_image_.isNull()) {
+    if (image_rect_.contains(event->pos()) && !pyramid_.empty()) {
       locked_crosshairs_image_ = geometry_.imagePixelFromWidget(event->pos());
       update();
     }
@@ -269,7 +236,7 @@ void FieldPreviewWidget::mouseReleaseEvent(QMouseEvent* event) {
 }
 
 void FieldPreviewWidget::onLineScopeUpdateTimer() {
-  if (!line_scope_update_pending_ || current_image_.isNull()) {
+  if (!line_scope_update_pending_ || pyramid_.empty()) {
     return;
   }
 
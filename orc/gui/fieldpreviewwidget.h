@@ -11,6 +11,7 @@
 #define FIELDPREVIEWWIDGET_H
 
 #include <orc/stage/preview/orc_rendering.h>  // For public API types
+#include <preview_image_pyramid.h>
 
 #include <QImage>
 #include <QTimer>
@@ -34,9 +35,13 @@ struct PreviewImage;
  *
  * This widget is now a thin display client - all rendering
  * logic is in orc::PreviewRenderer. The widget only:
- * - Displays RGB888 data from core
+ * - Displays RGB888 data from core via a per-frame orc::PreviewImagePyramid
  * - Handles aspect ratio correction for display
  * - Manages widget sizing
+ *
+ * Each frame is drawn from a widget-sized render of the pyramid level that
+ * matches the fit zoom, with dropouts painted per visible tile, so resize and
+ * aspect changes cost the widget's pixel count rather than the frame's.
  */
 class FieldPreviewWidget : public QWidget {
   Q_OBJECT
@@ -67,7 +72,10 @@ class FieldPreviewWidget : public QWidget {
    * @brief Get the current original image size (uncorrected)
    * @return Size of the current image, or QSize(0,0) if no image
    */
-  QSize originalImageSize() const { return current_image_.size(); }
+  QSize originalImageSize() const {
+    return QSize(static_cast<int>(pyramid_.width()),
+                 static_cast<int>(pyramid_.height()));
+  }
 
   /**
    * @brief Get the current aspect correction value
@@ -116,10 +124,12 @@ class FieldPreviewWidget : public QWidget {
   /// Refresh the shared display geometry after image/aspect/size changes.
   void updateViewGeometry();
 
-  QImage current_image_;
+  orc::PreviewImagePyramid pyramid_;
+  // Widget-sized render of pyramid_ at image_rect_; rebuilt when stale.
+  QImage view_image_;
+  bool view_image_stale_ = true;
   // Shared display geometry (fit-to-widget: zoom is always fitZoom())
   orc::gui::FrameViewGeometry geometry_;
-  std::vector<orc::DropoutRegion> dropout_regions_;
   bool show_dropouts_ = false;
   QPoint mouse_pos_;         // Current mouse position
   bool mouse_over_ = false;  // Whether mouse is over the widget
@@ -107,6 +107,25 @@ bool FrameViewGeometry::widgetPointOnImage(const QPoint& widget_pos) const {
   return hasImage() && targetRect().contains(widget_pos);
 }
 
+orc::PreviewViewport FrameViewGeometry::previewViewport(
+    const QRect& widget_rect) const {
+  orc::PreviewViewport view;
+  const QRect exposed = widget_rect.intersected(targetRect());
+  if (!hasImage() || exposed.isEmpty()) {
+    return view;
+  }
+  const QPointF top_left = imageFromWidget(QPointF(exposed.topLeft()));
+  const QPointF bottom_right = imageFromWidget(QPointF(
+      exposed.x() + exposed.width(), exposed.y() + exposed.height()));
+  view.source_x = top_left.x();
+  view.source_y = top_left.y();
+  view.source_width = bottom_right.x() - top_left.x();
+  view.source_height = bottom_right.y() - top_left.y();
+  view.output_width = static_cast<uint32_t>(exposed.width());
+  view.output_height = static_cast<uint32_t>(exposed.height());
+  return view;
+}
+
 QPoint FrameViewGeometry::scrollAfterZoom(const QPoint& old_scroll,
                                           const QPoint& viewport_pos,
                                           double zoom_ratio) {
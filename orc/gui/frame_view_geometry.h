@@ -10,6 +10,8 @@
 #ifndef FRAME_VIEW_GEOMETRY_H
 #define FRAME_VIEW_GEOMETRY_H
 
+#include <preview_image_pyramid.h>
+
 #include <QPoint>
 #include <QPointF>
 #include <QRect>
@@ -79,6 +81,12 @@ class FrameViewGeometry {
   /// True when the widget-space point lies on the displayed image.
   bool widgetPointOnImage(const QPoint& widget_pos) const;
 
+  /// Pyramid viewport rendering the part of @p widget_rect that lies on the
+  /// displayed image one output pixel per widget pixel; draw the result at
+  /// widget_rect.intersected(targetRect()).topLeft(). Zero-sized when the
+  /// rect misses the image.
+  orc::PreviewViewport previewViewport(const QRect& widget_rect) const;
+
   /**
    * @brief Scroll offsets that keep the content point under the cursor
    * stationary across a zoom change.
@@ -9,25 +9,28 @@
 
 #include "frame_viewport_widget.h"
 
+#include <QPaintEvent>
 #include <QPainter>
 #include <QScrollArea>
 #include <QScrollBar>
 #include <QWheelEvent>
 #include <algorithm>
 
+#include "preview_image_qt.h"
+
 FrameViewportWidget::FrameViewportWidget(QWidget* parent) : QWidget(parent) {
   setMouseTracking(true);
   setCursor(Qt::CrossCursor);
 }
 
-void FrameViewportWidget::setImage(const QImage& image) {
-  image_ = image;
-  geometry_.setImageSize(image_.size());
+void FrameViewportWidget::setImage(const orc::PreviewImage& image) {
+  pyramid_ = orc::PreviewImagePyramid(image);
+  geometry_.setImageSize(imageSize());
   applyGeometry();
   update();
 }
 
-void FrameViewportWidget::clearImage() { setImage(QImage()); }
+void FrameViewportWidget::clearImage() { setImage(orc::PreviewImage()); }
 
 void FrameViewportWidget::setAspectCorrection(double correction) {
   geometry_.setAspectCorrection(correction);
@@ -80,16 +83,22 @@ QSize FrameViewportWidget::sizeHint() const {
 }
 
 void FrameViewportWidget::paintEvent(QPaintEvent* event) {
-  Q_UNUSED(event);
   QPainter painter(this);
-  painter.fillRect(rect(), palette().color(QPalette::Base));
+  painter.fillRect(event->rect(), palette().color(QPalette::Base));
 
   if (!hasImage()) {
     return;
   }
 
-  painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
-  painter.drawImage(geometry_.targetRect(), image_);
+  // Inside a scroll area only the visible part of the (possibly very large)
+  // zoomed widget is exposed; render just that, unscaled.
+  const QRect exposed = event->rect().intersected(geometry_.targetRect());
+  if (!exposed.isEmpty()) {
+    exposed_image_ = orc::gui::renderPreviewViewport(
+        pyramid_, geometry_.previewViewport(exposed), false,
+        std::move(exposed_image_));
+    painter.drawImage(exposed.topLeft(), exposed_image_);
+  }
 
   paintOverlay(painter);
 }
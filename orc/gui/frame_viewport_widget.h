@@ -10,6 +10,9 @@
 #ifndef FRAME_VIEWPORT_WIDGET_H
 #define FRAME_VIEWPORT_WIDGET_H
 
+#include <orc/stage/preview/orc_rendering.h>
+#include <preview_image_pyramid.h>
+
 #include <QImage>
 #include <QWidget>
 
@@ -21,14 +24,17 @@ class QScrollArea;
  * @brief Zoomable, aspect-corrected frame viewport for use inside a
  * QScrollArea
  *
- * Displays a rendered frame image with:
+ * Displays a rendered frame image, held as an orc::PreviewImagePyramid, with:
  * - Zoom (buttons/API plus Ctrl+wheel zoom-at-cursor)
  * - Aspect-ratio correction (width scale, matching the preview dialog)
  * - Fit-to-viewport
  * - Widget<->image coordinate mapping via orc::gui::FrameViewGeometry
  *
  * The widget resizes itself to the zoomed display size; panning is provided
- * by the enclosing QScrollArea (plain wheel events propagate to it).
+ * by the enclosing QScrollArea (plain wheel events propagate to it). Each
+ * paint resamples only the exposed part of the frame from the pyramid level
+ * matching the zoom, so zooming and panning cost follows the scroll-area
+ * viewport, not the frame or the zoomed widget size.
  *
  * Subclasses draw interactive overlays by overriding paintOverlay(), which is
  * called after the frame image is painted. Overlays are drawn in widget
@@ -43,11 +49,14 @@ class FrameViewportWidget : public QWidget {
   explicit FrameViewportWidget(QWidget* parent = nullptr);
   ~FrameViewportWidget() override = default;
 
-  /// Set the frame image to display (null image clears the display).
-  void setImage(const QImage& image);
+  /// Set the frame image to display (invalid image clears the display).
+  void setImage(const orc::PreviewImage& image);
   void clearImage();
-  bool hasImage() const { return !image_.isNull(); }
-  QSize imageSize() const { return image_.size(); }
+  bool hasImage() const { return !pyramid_.empty(); }
+  QSize imageSize() const {
+    return QSize(static_cast<int>(pyramid_.width()),
+                 static_cast<int>(pyramid_.height()));
+  }
 
   /// Width scale factor for display (1.0 = SAR 1:1; ~0.7 for DAR 4:3).
   void setAspectCorrection(double correction);
@@ -105,7 +114,8 @@ class FrameViewportWidget : public QWidget {
   QScrollArea* enclosingScrollArea() const;
 
   orc::gui::FrameViewGeometry geometry_;
-  QImage image_;
+  orc::PreviewImagePyramid pyramid_;
+  QImage exposed_image_;  // Reused render target for the exposed rect
   double min_zoom_ = 0.25;
   double max_zoom_ = 8.0;
 };
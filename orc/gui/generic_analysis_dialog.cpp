@@ -9,7 +9,9 @@
 
 #include "generic_analysis_dialog.h"
 
+#include "colourstatisticswidget.h"
 #include "presenters/include/analysis_presenter.h"
+#include "presenters/include/colour_statistics_presenter.h"
 #include "presenters/include/disc_mapper_presenter.h"
 #include "presenters/include/dropout_editor_presenter.h"
 #include "presenters/include/ffmpeg_preset_presenter.h"
@@ -52,7 +54,8 @@ class GenericAnalysisDialog::AnalysisWorker : public QThread {
       orc::presenters::SourceAlignmentPresenter* source_alignment_presenter,
       orc::presenters::MaskLinePresenter* mask_line_presenter,
       orc::presenters::FFmpegPresetPresenter* ffmpeg_preset_presenter,
-      orc::presenters::DropoutEditorPresenter* dropout_editor_presenter)
+      orc::presenters::DropoutEditorPresenter* dropout_editor_presenter,
+      orc::presenters::ColourStatisticsPresenter* colour_statistics_presenter)
       : tool_id_(tool_id),
         node_id_(node_id),
         parameters_(std::move(parameters)),
@@ -62,12 +65,15 @@ class GenericAnalysisDialog::AnalysisWorker : public QThread {
         source_alignment_presenter_(source_alignment_presenter),
         mask_line_presenter_(mask_line_presenter),
         ffmpeg_preset_presenter_(ffmpeg_preset_presenter),
-        dropout_editor_presenter_(dropout_editor_presenter) {}
+        dropout_editor_presenter_(dropout_editor_presenter),
+        colour_statistics_presenter_(colour_statistics_presenter) {}
 
   orc::AnalysisResult getResult() const { return result_; }
 
  signals:
   void progressUpdate(int percentage, QString status);
+  void colourStatisticsUpdate(
+      std::shared_ptr<const orc::ColourStatisticsData> data);
 
  protected:
   void run() override {
@@ -102,6 +108,15 @@ class GenericAnalysisDialog::AnalysisWorker : public QThread {
     } else if (dropout_editor_presenter_) {
       result_ = dropout_editor_presenter_->runAnalysis(
           node_id_, parameters_, progress_callback, cancel_check);
+    } else if (colour_statistics_presenter_) {
+      // Partial counts arrive a few times a second while the pass runs.
+      auto statistics_callback =
+          [this](std::shared_ptr<const orc::ColourStatisticsData> data) {
+            emit colourStatisticsUpdate(std::move(data));
+          };
+      result_ = colour_statistics_presenter_->runAnalysis(
+          node_id_, parameters_, progress_callback, cancel_check,
+          statistics_callback);
     } else {
       // Unknown tool
       result_.status = orc::AnalysisResult::Status::Failed;
@@ -121,6 +136,7 @@ class GenericAnalysisDialog::AnalysisWorker : public QThread {
   orc::presenters::MaskLinePresenter* mask_line_presenter_;
   orc::presenters::FFmpegPresetPresenter* ffmpeg_preset_presenter_;
   orc::presenters::DropoutEditorPresenter* dropout_editor_presenter_;
+  orc::presenters::ColourStatisticsPresenter* colour_statistics_presenter_;
   orc::AnalysisResult result_;
 };
 
@@ -139,6 +155,7 @@ GenericAnalysisDialog::GenericAnalysisDialog(
       mask_line_presenter_(nullptr),
       ffmpeg_preset_presenter_(nullptr),
       dropout_editor_presenter_(nullptr),
+      colour_statistics_presenter_(nullptr),
       project_(project),
       node_id_(node_id) {
   // Create specialized presenters when needed
@@ -163,6 +180,10 @@ GenericAnalysisDialog::GenericAnalysisDialog(
   } else if (tool_id_ == "dropout_editor") {
     dropout_editor_presenter_ = new orc::presenters::DropoutEditorPresenter(
         static_cast<orc::Project*>(project_));
+  } else if (tool_id_ == "colour_statistics") {
+    colour_statistics_presenter_ =
+        new orc::presenters::ColourStatisticsPresenter(
+            static_cast<orc::Project*>(project_));
   }
 
   setupUI();
@@ -186,6 +207,7 @@ GenericAnalysisDialog::~GenericAnalysisDialog() {
   delete mask_line_presenter_;
   delete ffmpeg_preset_presenter_;
   delete dropout_editor_presenter_;
+  delete colour_statistics_presenter_;
 }
 
 void GenericAnalysisDialog::setupUI() {
@@ -215,12 +237,22 @@ void GenericAnalysisDialog::setupUI() {
   progressGroup->setLayout(progLayout);
   layout->addWidget(progressGroup);
 
+  // Accumulated vectorscope and luma histogram (colour statistics only)
+  if (colour_statistics_presenter_) {
+    auto* statisticsGroup = new QGroupBox("Colour Statistics");
+    auto* statisticsLayout = new QVBoxLayout();
+    colourStatisticsWidget_ = new ColourStatisticsWidget();
+    statisticsLayout->addWidget(colourStatisticsWidget_);
+    statisticsGroup->setLayout(statisticsLayout);
+    layout->addWidget(statisticsGroup, 1);
+  }
+
   // Results/report text area
   auto* reportGroup = new QGroupBox("Report");
   auto* reportLayout = new QVBoxLayout();
   reportText_ = new QTextEdit();
   reportText_->setReadOnly(true);
-  reportText_->setMinimumHeight(300);
+  reportText_->setMinimumHeight(colourStatisticsWidget_ ? 120 : 300);
   reportText_->setLineWrapMode(QTextEdit::WidgetWidth);
   reportLayout->addWidget(reportText_);
   reportGroup->setLayout(reportLayout);
@@ -395,6 +427,9 @@ void GenericAnalysisDialog::runAnalysis() {
   applyButton_->setEnabled(false);
   closeButton_->setEnabled(false);
   reportText_->clear();
+  if (colourStatisticsWidget_) {
+    colourStatisticsWidget_->clear();
+  }
   statusLabel_->setText("Running analysis...");
   progressBar_->setValue(0);
 
@@ -451,11 +486,15 @@ void GenericAnalysisDialog::runAnalysis() {
       tool_id_, node_id_, parameters, frame_corruption_presenter_,
       disc_mapper_presenter_, frame_map_range_presenter_,
       source_alignment_presenter_, mask_line_presenter_,
-      ffmpeg_preset_presenter_, dropout_editor_presenter_);
+      ffmpeg_preset_presenter_, dropout_editor_presenter_,
+      colour_statistics_presenter_);
 
   // Connect signals for progress updates and completion
   connect(worker_, &AnalysisWorker::progressUpdate, this,
           &GenericAnalysisDialog::onAnalysisProgress, Qt::QueuedConnection);
+  connect(worker_, &AnalysisWorker::colourStatisticsUpdate, this,
+          &GenericAnalysisDialog::onColourStatisticsUpdate,
+          Qt::QueuedConnection);
   connect(worker_, &AnalysisWorker::finished, this,
           &GenericAnalysisDialog::onAnalysisComplete, Qt::QueuedConnection);
 
@@ -468,6 +507,13 @@ void GenericAnalysisDialog::onAnalysisProgress(int percentage, QString status) {
   progressBar_->setValue(percentage);
 }
 
+void GenericAnalysisDialog::onColourStatisticsUpdate(
+    std::shared_ptr<const orc::ColourStatisticsData> data) {
+  if (colourStatisticsWidget_) {
+    colourStatisticsWidget_->setData(std::move(data));
+  }
+}
+
 void GenericAnalysisDialog::onAnalysisComplete() {
   if (!worker_) {
     return;
@@ -484,7 +530,8 @@ void GenericAnalysisDialog::onAnalysisComplete() {
   cancelButton_->setEnabled(false);
   closeButton_->setEnabled(true);
   if (last_result_.status == orc::AnalysisResult::Status::Success) {
-    applyButton_->setEnabled(true);
+    // Colour statistics only report; there is nothing to apply.
+    applyButton_->setEnabled(!colour_statistics_presenter_);
     statusLabel_->setText("Analysis complete");
     progressBar_->setValue(100);
   } else {
@@ -12,6 +12,7 @@
 
 #include <orc/stage/node_id.h>
 #include <orc_analysis.h>
+#include <orc_colour_statistics.h>
 
 #include <QCheckBox>
 #include <QComboBox>
@@ -39,8 +40,11 @@ class SourceAlignmentPresenter;
 class MaskLinePresenter;
 class FFmpegPresetPresenter;
 class DropoutEditorPresenter;
+class ColourStatisticsPresenter;
 }  // namespace orc::presenters
 
+class ColourStatisticsWidget;
+
 namespace orc {
 namespace gui {
 
@@ -76,6 +80,8 @@ class GenericAnalysisDialog : public QDialog {
   void updateParameterDependencies();
   void onAnalysisComplete();
   void onAnalysisProgress(int percentage, QString status);
+  void onColourStatisticsUpdate(
+      std::shared_ptr<const orc::ColourStatisticsData> data);
 
  private:
   void setupUI();
@@ -106,7 +112,9 @@ class GenericAnalysisDialog : public QDialog {
       ffmpeg_preset_presenter_;  // Owned (if used)
   orc::presenters::DropoutEditorPresenter*
       dropout_editor_presenter_;  // Owned (if used)
-  void* project_;                 // Not owned (opaque handle)
+  orc::presenters::ColourStatisticsPresenter*
+      colour_statistics_presenter_;  // Owned (if used)
+  void* project_;                    // Not owned (opaque handle)
   orc::NodeID node_id_;
   orc::AnalysisResult last_result_;
   std::vector<orc::ParameterDescriptor> parameter_descriptors_;
@@ -135,6 +143,7 @@ class GenericAnalysisDialog : public QDialog {
   QPushButton* applyButton_;
   QPushButton* closeButton_;
   QFormLayout* parametersLayout_;
+  ColourStatisticsWidget* colourStatisticsWidget_ = nullptr;  // Colour stats
 
   // Parameter widgets
   struct ParameterWidget {
@@ -27,6 +27,7 @@
 #include "masklineconfigdialog.h"
 #include "ntscobserverdialog.h"
 #include "orcgraphicsview.h"
+#include "performancedialog.h"
 #include "pluginmanagerdialog.h"
 #include "presenters/include/analysis_presenter.h"
 #include "presenters/include/ntsc_observation_presenter.h"
@@ -377,6 +378,7 @@ MainWindow::MainWindow(QWidget* parent)
       preview_dialog_(nullptr),
       vbi_dialog_(nullptr),
       ntsc_observer_dialog_(nullptr),
+      performance_dialog_(nullptr),
       dag_view_(nullptr),
       dag_model_(nullptr),
       dag_scene_(nullptr),
@@ -433,14 +435,23 @@ MainWindow::MainWindow(QWidget* parent)
           &MainWindow::onWaveformMonitorDataReady, Qt::QueuedConnection);
   connect(render_coordinator_.get(), &RenderCoordinator::dropoutDataReady, this,
           &MainWindow::onDropoutDataReady, Qt::QueuedConnection);
+  connect(render_coordinator_.get(),
+          &RenderCoordinator::dropoutPartialDataReady, this,
+          &MainWindow::onDropoutPartialDataReady, Qt::QueuedConnection);
   connect(render_coordinator_.get(), &RenderCoordinator::dropoutProgress, this,
           &MainWindow::onDropoutProgress, Qt::QueuedConnection);
   connect(render_coordinator_.get(), &RenderCoordinator::snrDataReady, this,
           &MainWindow::onSNRDataReady, Qt::QueuedConnection);
+  connect(render_coordinator_.get(),
+          &RenderCoordinator::snrPartialDataReady, this,
+          &MainWindow::onSNRPartialDataReady, Qt::QueuedConnection);
   connect(render_coordinator_.get(), &RenderCoordinator::snrProgress, this,
           &MainWindow::onSNRProgress, Qt::QueuedConnection);
   connect(render_coordinator_.get(), &RenderCoordinator::burstLevelDataReady,
           this, &MainWindow::onBurstLevelDataReady, Qt::QueuedConnection);
+  connect(render_coordinator_.get(),
+          &RenderCoordinator::burstLevelPartialDataReady, this,
+          &MainWindow::onBurstLevelPartialDataReady, Qt::QueuedConnection);
   connect(render_coordinator_.get(), &RenderCoordinator::burstLevelProgress,
           this, &MainWindow::onBurstLevelProgress, Qt::QueuedConnection);
   connect(render_coordinator_.get(), &RenderCoordinator::triggerProgress, this,
@@ -883,6 +894,17 @@ void MainWindow::setupMenus() {
     settings.setValue("preview/auto_show_on_selection", checked);
   });
 
+  auto* show_performance_action =
+      view_menu->addAction("Show P&erformance Panel");
+  connect(show_performance_action, &QAction::triggered, this, [this]() {
+    if (!performance_dialog_) {
+      performance_dialog_ = new PerformanceDialog(this);
+    }
+    performance_dialog_->show();
+    performance_dialog_->raise();
+    performance_dialog_->activateWindow();
+  });
+
   view_menu->addSeparator();
 
   arrange_dag_action_ = view_menu->addAction("&Arrange DAG to Grid");
@@ -40,6 +40,7 @@ class PreviewDialog;
 class VBIDialog;
 class VideoParameterObserverDialog;
 class NtscObserverDialog;
+class PerformanceDialog;
 class DropoutAnalysisDialog;
 class SNRAnalysisDialog;
 class BurstLevelAnalysisDialog;
@@ -174,14 +175,23 @@ class MainWindow : public QMainWindow {
   void onDropoutDataReady(uint64_t request_id,
                           std::vector<orc::FrameDropoutStats> frame_stats,
                           int32_t total_frames);
+  void onDropoutPartialDataReady(
+      uint64_t request_id, std::vector<orc::FrameDropoutStats> frame_stats,
+      int32_t total_frames);
   void onDropoutProgress(size_t current, size_t total, QString message);
   void onSNRDataReady(uint64_t request_id,
                       std::vector<orc::FrameSNRStats> frame_stats,
                       int32_t total_frames);
+  void onSNRPartialDataReady(uint64_t request_id,
+                             std::vector<orc::FrameSNRStats> frame_stats,
+                             int32_t total_frames);
   void onSNRProgress(size_t current, size_t total, QString message);
   void onBurstLevelDataReady(uint64_t request_id,
                              std::vector<orc::FrameBurstLevelStats> frame_stats,
                              int32_t total_frames);
+  void onBurstLevelPartialDataReady(
+      uint64_t request_id, std::vector<orc::FrameBurstLevelStats> frame_stats,
+      int32_t total_frames);
   void onBurstLevelProgress(size_t current, size_t total, QString message);
   void onTriggerProgress(size_t current, size_t total, QString message);
   void onTriggerComplete(uint64_t request_id, bool success, QString status);
@@ -245,6 +255,18 @@ class MainWindow : public QMainWindow {
   void refreshVectorscopeForCurrentCoordinate();
   void refreshHistogramForCurrentCoordinate();
 
+  // Analysis graph helpers — shared by the partial and final data slots
+  void drawDropoutGraph(const orc::NodeID& node_id,
+                        const std::vector<orc::FrameDropoutStats>& frame_stats,
+                        int32_t total_frames, bool final);
+  void drawSNRGraph(const orc::NodeID& node_id,
+                    const std::vector<orc::FrameSNRStats>& frame_stats,
+                    int32_t total_frames, bool final);
+  void drawBurstLevelGraph(
+      const orc::NodeID& node_id,
+      const std::vector<orc::FrameBurstLevelStats>& frame_stats,
+      int32_t total_frames, bool final);
+
   // In-flight render state helpers — all "rendering" UX lives here
   void beginPreviewRenderInFlight();  // Set flag + start slow-title timer
   void endPreviewRenderInFlight();    // Clear flag + stop timer + restore title
@@ -308,6 +330,7 @@ class MainWindow : public QMainWindow {
   std::unique_ptr<orc::presenters::VbiPresenter> vbi_presenter_;
   // Note: project_presenter_ removed - use project_.presenter() instead
   NtscObserverDialog* ntsc_observer_dialog_;
+  PerformanceDialog* performance_dialog_;  // created on first show
   std::unordered_map<orc::NodeID, DropoutAnalysisDialog*>
       dropout_analysis_dialogs_;
   std::unordered_map<orc::NodeID, SNRAnalysisDialog*> snr_analysis_dialogs_;
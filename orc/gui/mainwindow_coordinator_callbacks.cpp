@@ -468,6 +468,25 @@ void MainWindow::onDropoutDataReady(
     pd->deleteLater();
   }
 
+  drawDropoutGraph(node_id, frame_stats, total_frames, true);
+}
+
+void MainWindow::onDropoutPartialDataReady(
+    uint64_t request_id, std::vector<orc::FrameDropoutStats> frame_stats,
+    int32_t total_frames) {
+  // Partial snapshots keep the request pending; the final dropout data
+  // response closes the progress dialog.
+  auto req_it = pending_dropout_requests_.find(request_id);
+  if (req_it == pending_dropout_requests_.end()) {
+    return;
+  }
+  drawDropoutGraph(req_it->second, frame_stats, total_frames, false);
+}
+
+void MainWindow::drawDropoutGraph(
+    const orc::NodeID& node_id,
+    const std::vector<orc::FrameDropoutStats>& frame_stats,
+    int32_t total_frames, bool final) {
   // Find the dialog for this stage
   auto dialog_it = dropout_analysis_dialogs_.find(node_id);
   if (dialog_it == dropout_analysis_dialogs_.end() || !dialog_it->second ||
@@ -477,8 +496,9 @@ void MainWindow::onDropoutDataReady(
 
   auto* dialog = dialog_it->second;
 
-  // If no data available, show message
+  // If no data available, show message once the analysis has finished
   if (frame_stats.empty() || total_frames == 0) {
+    if (!final) return;
     dialog->showNoDataMessage(
         "No dropout analysis data available.\n\n"
         "Make sure dropout detection is enabled in the pipeline.");
@@ -504,9 +524,11 @@ void MainWindow::onDropoutDataReady(
 
   dialog->finishUpdate(current_frame);
 
-  // Bring the graph window to the front now that it has data
-  dialog->raise();
-  dialog->activateWindow();
+  // Bring the graph window to the front once the final data is in
+  if (final) {
+    dialog->raise();
+    dialog->activateWindow();
+  }
 }
 
 void MainWindow::onSNRDataReady(uint64_t request_id,
@@ -539,6 +561,25 @@ void MainWindow::onSNRDataReady(uint64_t request_id,
     pd->deleteLater();
   }
 
+  drawSNRGraph(node_id, frame_stats, total_frames, true);
+}
+
+void MainWindow::onSNRPartialDataReady(
+    uint64_t request_id, std::vector<orc::FrameSNRStats> frame_stats,
+    int32_t total_frames) {
+  // Partial snapshots keep the request pending; the final SNR data
+  // response closes the progress dialog.
+  auto req_it = pending_snr_requests_.find(request_id);
+  if (req_it == pending_snr_requests_.end()) {
+    return;
+  }
+  drawSNRGraph(req_it->second, frame_stats, total_frames, false);
+}
+
+void MainWindow::drawSNRGraph(
+    const orc::NodeID& node_id,
+    const std::vector<orc::FrameSNRStats>& frame_stats, int32_t total_frames,
+    bool final) {
   // Find the dialog for this stage
   auto dialog_it = snr_analysis_dialogs_.find(node_id);
   if (dialog_it == snr_analysis_dialogs_.end() || !dialog_it->second ||
@@ -548,8 +589,9 @@ void MainWindow::onSNRDataReady(uint64_t request_id,
 
   auto* dialog = dialog_it->second;
 
-  // If no data available, show message
+  // If no data available, show message once the analysis has finished
   if (frame_stats.empty() || total_frames == 0) {
+    if (!final) return;
     dialog->showNoDataMessage(
         "No SNR analysis data available.\n\n"
         "Make sure VITS (Vertical Interval Test Signal) is present in the "
@@ -582,9 +624,11 @@ void MainWindow::onSNRDataReady(uint64_t request_id,
 
   dialog->finishUpdate(current_frame);
 
-  // Bring the graph window to the front now that it has data
-  dialog->raise();
-  dialog->activateWindow();
+  // Bring the graph window to the front once the final data is in
+  if (final) {
+    dialog->raise();
+    dialog->activateWindow();
+  }
 }
 
 void MainWindow::onDropoutProgress(size_t current, size_t total,
@@ -657,6 +701,25 @@ void MainWindow::onBurstLevelDataReady(
     pd->deleteLater();
   }
 
+  drawBurstLevelGraph(node_id, frame_stats, total_frames, true);
+}
+
+void MainWindow::onBurstLevelPartialDataReady(
+    uint64_t request_id, std::vector<orc::FrameBurstLevelStats> frame_stats,
+    int32_t total_frames) {
+  // Partial snapshots keep the request pending; the final burst level data
+  // response closes the progress dialog.
+  auto req_it = pending_burst_level_requests_.find(request_id);
+  if (req_it == pending_burst_level_requests_.end()) {
+    return;
+  }
+  drawBurstLevelGraph(req_it->second, frame_stats, total_frames, false);
+}
+
+void MainWindow::drawBurstLevelGraph(
+    const orc::NodeID& node_id,
+    const std::vector<orc::FrameBurstLevelStats>& frame_stats,
+    int32_t total_frames, bool final) {
   // Find the dialog for this stage
   auto dialog_it = burst_level_analysis_dialogs_.find(node_id);
   if (dialog_it == burst_level_analysis_dialogs_.end() || !dialog_it->second ||
@@ -666,8 +729,9 @@ void MainWindow::onBurstLevelDataReady(
 
   auto* dialog = dialog_it->second;
 
-  // If no data available, show message
+  // If no data available, show message once the analysis has finished
   if (frame_stats.empty() || total_frames == 0) {
+    if (!final) return;
     dialog->showNoDataMessage(
         "No burst level data available.\n\n"
         "Color burst detection may have failed.");
@@ -708,9 +772,11 @@ void MainWindow::onBurstLevelDataReady(
 
   dialog->finishUpdate(current_frame);
 
-  // Bring the graph window to the front now that it has data
-  dialog->raise();
-  dialog->activateWindow();
+  // Bring the graph window to the front once the final data is in
+  if (final) {
+    dialog->raise();
+    dialog->activateWindow();
+  }
 }
 
 void MainWindow::onBurstLevelProgress(size_t current, size_t total,
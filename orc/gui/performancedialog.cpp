@@ -0,0 +1,176 @@
+/*
+ * File:        performancedialog.cpp
+ * Module:      orc-gui
+ * Purpose:     Live pipeline performance panel implementation
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "performancedialog.h"
+
+#include <QHeaderView>
+#include <QLabel>
+#include <QTableWidget>
+#include <QTimer>
+#include <QVBoxLayout>
+
+namespace {
+
+constexpr int kRefreshIntervalMs = 1000;
+
+QString formatBytes(double bytes) {
+  static const char* const kUnits[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+  int unit = 0;
+  while (bytes >= 1024.0 && unit < 4) {
+    bytes /= 1024.0;
+    ++unit;
+  }
+  return QString("%1 %2")
+      .arg(bytes, 0, 'f', unit == 0 ? 0 : 1)
+      .arg(kUnits[unit]);
+}
+
+QString formatValue(const orc::presenters::PipelineMetric& metric) {
+  using orc::presenters::PipelineMetricKind;
+  if (metric.kind == PipelineMetricKind::Histogram) {
+    if (metric.count == 0) return "0 samples";
+    const double mean_ms = 1000.0 * metric.value /
+                           static_cast<double>(metric.count);
+    return QString("%1 samples, mean %2 ms")
+        .arg(metric.count)
+        .arg(mean_ms, 0, 'f', 2);
+  }
+  if (metric.name.find("_bytes") != std::string::npos) {
+    return formatBytes(metric.value);
+  }
+  return QString::number(metric.value, 'f', 0);
+}
+
+}  // namespace
+
+PerformanceDialog::PerformanceDialog(QWidget* parent) : QDialog(parent) {
+  setupUI();
+  setWindowTitle("Performance");
+
+  // Use Qt::Window flag to allow independent positioning
+  setWindowFlags(Qt::Window);
+
+  // Don't destroy on close, just hide
+  setAttribute(Qt::WA_DeleteOnClose, false);
+
+  resize(640, 480);
+  setMinimumSize(480, 300);
+
+  refresh_timer_ = new QTimer(this);
+  refresh_timer_->setInterval(kRefreshIntervalMs);
+  connect(refresh_timer_, &QTimer::timeout, this, &PerformanceDialog::refresh);
+}
+
+PerformanceDialog::~PerformanceDialog() = default;
+
+void PerformanceDialog::setupUI() {
+  auto* main_layout = new QVBoxLayout(this);
+
+  summary_label_ = new QLabel("-", this);
+  summary_label_->setWordWrap(true);
+  main_layout->addWidget(summary_label_);
+
+  metrics_table_ = new QTableWidget(0, 4, this);
+  metrics_table_->setHorizontalHeaderLabels(
+      {"Metric", "Labels", "Value", "Rate/s"});
+  metrics_table_->setSelectionBehavior(QAbstractItemView::SelectRows);
+  metrics_table_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  metrics_table_->verticalHeader()->setVisible(false);
+  metrics_table_->horizontalHeader()->setSectionResizeMode(
+      QHeaderView::ResizeToContents);
+  metrics_table_->horizontalHeader()->setStretchLastSection(true);
+  main_layout->addWidget(metrics_table_);
+}
+
+void PerformanceDialog::showEvent(QShowEvent* event) {
+  QDialog::showEvent(event);
+  has_previous_ = false;
+  refresh();
+  refresh_timer_->start();
+}
+
+void PerformanceDialog::hideEvent(QHideEvent* event) {
+  refresh_timer_->stop();
+  QDialog::hideEvent(event);
+}
+
+void PerformanceDialog::refresh() {
+  using orc::presenters::PipelineMetricKind;
+
+  const auto now = std::chrono::steady_clock::now();
+  const auto metrics = orc::presenters::snapshotPipelineMetrics();
+  const auto status = orc::presenters::summarizePipelineMetrics(metrics);
+  const double seconds =
+      has_previous_
+          ? std::chrono::duration<double>(now - previous_time_).count()
+          : 0.0;
+
+  auto rate = [seconds](double current, double previous) {
+    return seconds > 0.0 ? (current - previous) / seconds : 0.0;
+  };
+
+  // Summary line
+  const uint64_t lookups = status.cache_hits + status.cache_misses;
+  QString hit_rate = "n/a";
+  if (lookups > 0) {
+    const double percent = 100.0 * static_cast<double>(status.cache_hits) /
+                           static_cast<double>(lookups);
+    hit_rate = QString("%1%").arg(percent, 0, 'f', 1);
+  }
+  summary_label_->setText(
+      QString("Frames written: %1 (%2 fps)   Cache hits: %3   Sink queue: "
+              "%4   Read: %5/s   Memory: %6")
+          .arg(status.frames_written)
+          .arg(rate(static_cast<double>(status.frames_written),
+                    static_cast<double>(previous_status_.frames_written)),
+               0, 'f', 1)
+          .arg(hit_rate)
+          .arg(status.queue_depth, 0, 'f', 0)
+          .arg(formatBytes(rate(
+              static_cast<double>(status.source_bytes_read),
+              static_cast<double>(previous_status_.source_bytes_read))))
+          .arg(status.resident_bytes > 0
+                   ? formatBytes(static_cast<double>(status.resident_bytes))
+                   : QString("n/a")));
+
+  // Per-series table
+  std::map<std::pair<std::string, std::string>, double> values;
+  metrics_table_->setRowCount(static_cast<int>(metrics.size()));
+  int row = 0;
+  for (const auto& metric : metrics) {
+    const auto key = std::make_pair(metric.name, metric.labels);
+    const double current = metric.kind == PipelineMetricKind::Histogram
+                               ? static_cast<double>(metric.count)
+                               : metric.value;
+    values[key] = current;
+
+    QString rate_text;
+    if (metric.kind != PipelineMetricKind::Gauge && has_previous_) {
+      const auto previous = previous_values_.find(key);
+      rate_text = QString::number(
+          rate(current,
+               previous != previous_values_.end() ? previous->second : 0.0),
+          'f', 1);
+    }
+
+    auto* name_item = new QTableWidgetItem(QString::fromStdString(metric.name));
+    name_item->setToolTip(QString::fromStdString(metric.help));
+    metrics_table_->setItem(row, 0, name_item);
+    metrics_table_->setItem(
+        row, 1, new QTableWidgetItem(QString::fromStdString(metric.labels)));
+    metrics_table_->setItem(row, 2, new QTableWidgetItem(formatValue(metric)));
+    metrics_table_->setItem(row, 3, new QTableWidgetItem(rate_text));
+    ++row;
+  }
+
+  previous_values_ = std::move(values);
+  previous_status_ = status;
+  previous_time_ = now;
+  has_previous_ = true;
+}
@@ -0,0 +1,62 @@
+/*
+ * File:        performancedialog.h
+ * Module:      orc-gui
+ * Purpose:     Live pipeline performance panel (throughput, caches, queues,
+ *              memory)
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#ifndef PERFORMANCEDIALOG_H
+#define PERFORMANCEDIALOG_H
+
+#include <QDialog>
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+
+#include "presenters/include/pipeline_metrics_presenter.h"
+
+class QLabel;
+class QTableWidget;
+class QTimer;
+
+/**
+ * @brief Non-modal panel showing the host's live pipeline metrics
+ *
+ * Refreshes once a second while visible. The summary line shows frames
+ * written per second, overall cache hit rate, sink queue depth, source read
+ * rate and resident memory; the table lists every metric series with its
+ * per-second rate (counters) or mean latency (histograms).
+ */
+class PerformanceDialog : public QDialog {
+  Q_OBJECT
+
+ public:
+  explicit PerformanceDialog(QWidget* parent = nullptr);
+  ~PerformanceDialog();
+
+ protected:
+  void showEvent(QShowEvent* event) override;
+  void hideEvent(QHideEvent* event) override;
+
+ private slots:
+  void refresh();
+
+ private:
+  void setupUI();
+
+  QLabel* summary_label_;
+  QTableWidget* metrics_table_;
+  QTimer* refresh_timer_;
+
+  // Previous refresh, for rates. Keyed by (name, labels).
+  std::map<std::pair<std::string, std::string>, double> previous_values_;
+  orc::presenters::PipelineStatus previous_status_;
+  std::chrono::steady_clock::time_point previous_time_;
+  bool has_previous_ = false;
+};
+
+#endif  // PERFORMANCEDIALOG_H
@@ -21,7 +21,19 @@ class VectorscopeDialogPrivate {
   orc::NodeID node_id;
   QString scope_label{"Vectorscope"};
   uint64_t current_field_number = 0;
-  std::optional<orc::VectorscopeData> last_data;
+  std::shared_ptr<const orc::VectorscopeData> last_data;
+
+  // Last raster from the worker and whether its field carried chroma.
+  QImage raster;
+  bool has_chroma = false;
+  bool display_cleared = false;
+
+  // Accumulation and rendering (worker thread)
+  QThread worker_thread;
+  VectorscopeWorker* worker = nullptr;  // Owned by worker_thread finish hook
+  bool job_in_flight = false;
+  bool render_pending = false;
+  bool accumulate_pending = false;
 
   void drawColorZones(QPainter& painter, VectorscopeDialog* dialog,
                       orc::VideoSystem system, int32_t cvbs_white,
@@ -42,7 +54,7 @@ class VectorscopeDialogPrivate {
 #include <QSizePolicy>
 #include <QVBoxLayout>
 #include <cmath>
-#include <random>
+#include <utility>
 
 namespace {
 
@@ -66,11 +78,6 @@ constexpr double kZoneHalfRadialSpanPercent = 0.14;
 constexpr double kTargetBoxSizePixels = 42.0;
 constexpr double kTargetCrosshairSizePixels = 22.0;
 
-bool isPointWithinCanvas(const QPointF& point, int canvas_size) {
-  return point.x() >= 0.0 && point.x() < static_cast<double>(canvas_size) &&
-         point.y() >= 0.0 && point.y() < static_cast<double>(canvas_size);
-}
-
 QColor vectorscopeTargetColor(int rgb) {
   switch (rgb) {
     case 1:
@@ -229,33 +236,6 @@ void drawTargetBox(QPainter& painter,
   painter.restore();
 }
 
-// Bresenham line rasteriser — increments hit_count for every pixel on the
-// segment from (x0,y0) to (x1,y1), clamped to the canvas bounds.
-void accumulateLine(std::vector<uint32_t>& buf, int canvas_size, int x0, int y0,
-                    int x1, int y1) {
-  const int dx = std::abs(x1 - x0);
-  const int sx = (x0 < x1) ? 1 : -1;
-  const int dy = -std::abs(y1 - y0);
-  const int sy = (y0 < y1) ? 1 : -1;
-  int err = dx + dy;
-  for (;;) {
-    if (x0 >= 0 && x0 < canvas_size && y0 >= 0 && y0 < canvas_size) {
-      buf[static_cast<size_t>(y0) * static_cast<size_t>(canvas_size) +
-          static_cast<size_t>(x0)]++;
-    }
-    if (x0 == x1 && y0 == y1) break;
-    const int e2 = 2 * err;
-    if (e2 >= dy) {
-      err += dy;
-      x0 += sx;
-    }
-    if (e2 <= dx) {
-      err += dx;
-      y0 += sy;
-    }
-  }
-}
-
 }  // namespace
 
 // ============================================================================
@@ -307,9 +287,20 @@ VectorscopeDialog::VectorscopeDialog(QWidget* parent)
 
   setupUI();
   connectSignals();
+
+  d_->worker = new VectorscopeWorker();
+  d_->worker->moveToThread(&d_->worker_thread);
+  connect(&d_->worker_thread, &QThread::finished, d_->worker,
+          &QObject::deleteLater);
+  connect(d_->worker, &VectorscopeWorker::imageReady, this,
+          &VectorscopeDialog::onImageReady);
+  d_->worker_thread.start();
 }
 
-VectorscopeDialog::~VectorscopeDialog() = default;
+VectorscopeDialog::~VectorscopeDialog() {
+  d_->worker_thread.quit();
+  d_->worker_thread.wait();
+}
 
 int VectorscopeDialog::getGraticuleMode() const {
   return graticule_group_->checkedId();
@@ -473,9 +464,9 @@ void VectorscopeDialog::updateVectorscope(const orc::VectorscopeData& data) {
     return;
   }
 
-  d_->last_data = data;
+  d_->last_data = std::make_shared<const orc::VectorscopeData>(data);
   d_->current_field_number = data.field_number;
-  renderVectorscope(data);
+  renderVectorscope(*d_->last_data);
   ORC_LOG_DEBUG("Vectorscope updated for field {} ({} samples)",
                 data.field_number, data.samples.size());
 }
@@ -490,28 +481,10 @@ void VectorscopeDialog::renderVectorscope(const orc::VectorscopeData& data) {
     return;
   }
 
-  const orc::gui::VectorscopePlotGeometry geometry;
-  const int size = geometry.canvas_size;
-
-  // Check if this is mono/no-chroma data (all samples near origin).
-  constexpr double CHROMA_THRESHOLD = 1000.0;
-  bool has_chroma = false;
-  for (const auto& sample : data.samples) {
-    if (std::abs(sample.u) > CHROMA_THRESHOLD ||
-        std::abs(sample.v) > CHROMA_THRESHOLD) {
-      has_chroma = true;
-      break;
-    }
+  if (d_->last_data.get() != &data) {
+    d_->last_data = std::make_shared<const orc::VectorscopeData>(data);
   }
 
-  const int graticule_mode = graticule_group_->checkedId();
-  const bool colorize = blend_color_checkbox_->isChecked();
-  const bool defocus = defocus_checkbox_->isChecked();
-  const bool draw_trace_lines = draw_lines_checkbox_->isChecked();
-  const int field_select = field_select_group_->checkedId();
-  // Gain 1–10 from the spinbox maps directly to the brightness knee formula.
-  const float gain = static_cast<float>(point_size_spinbox_->value());
-
   // Calculate IRE range for debug logging (CVBS_U10_4FSC 10-bit domain).
   const double ire_range = data.cvbs_white - data.cvbs_blanking;
   const double black_percent = (data.cvbs_blanking / 1023.0) * 100.0;
@@ -519,11 +492,11 @@ void VectorscopeDialog::renderVectorscope(const orc::VectorscopeData& data) {
 
   ORC_LOG_DEBUG(
       "VectorscopeDialog: renderVectorscope field={} samples={} graticule={} "
-      "colorize={} defocus={} field_select={} system={} white={} blanking={} "
-      "chroma_detected={}",
-      data.field_number, data.samples.size(), graticule_mode, colorize, defocus,
-      field_select, static_cast<int>(data.system), data.cvbs_white,
-      data.cvbs_blanking, has_chroma);
+      "colorize={} defocus={} field_select={} system={} white={} blanking={}",
+      data.field_number, data.samples.size(), graticule_group_->checkedId(),
+      blend_color_checkbox_->isChecked(), defocus_checkbox_->isChecked(),
+      field_select_group_->checkedId(), static_cast<int>(data.system),
+      data.cvbs_white, data.cvbs_blanking);
   ORC_LOG_DEBUG(
       "VectorscopeDialog: CVBS levels - blanking={:.2f}% ({}) white={:.2f}% "
       "({}) range={:.0f} ({}=NTSC, {}=PAL)",
@@ -531,142 +504,115 @@ void VectorscopeDialog::renderVectorscope(const orc::VectorscopeData& data) {
       ire_range, static_cast<int>(orc::VideoSystem::NTSC),
       static_cast<int>(orc::VideoSystem::PAL));
 
-  // Create image; draw colour zones first so they sit behind the data plot.
-  QImage image(size, size, QImage::Format_RGB888);
-  image.fill(Qt::black);
-  {
-    QPainter painter(&image);
-    if (graticule_mode != 0) {
-      d_->drawColorZones(painter, this, data.system, data.cvbs_white,
-                         data.cvbs_blanking);
-    }
+  requestRender(/*reaccumulate=*/true);
+}
+
+orc::gui::VectorscopeLayout VectorscopeDialog::renderLayout() const {
+  const orc::gui::VectorscopePlotGeometry geometry;
+  orc::gui::VectorscopeLayout layout;
+  layout.canvas_size = geometry.canvas_size;
+  layout.centre_x = geometry.centre_point.x();
+  layout.centre_y = geometry.centre_point.y();
+  layout.pixels_per_uv_unit = geometry.pixels_per_uv_unit;
+  layout.signed_full_scale = orc::gui::kVectorscopeSignedFullScale;
+  layout.field_select = field_select_group_->checkedId();
+  layout.draw_lines = draw_lines_checkbox_->isChecked();
+  layout.defocus = defocus_checkbox_->isChecked();
+  return layout;
+}
+
+orc::gui::VectorscopeRenderStyle VectorscopeDialog::renderStyle() const {
+  orc::gui::VectorscopeRenderStyle style;
+  // Gain 1–10 from the spinbox maps directly to the brightness knee formula.
+  style.gain = static_cast<float>(point_size_spinbox_->value());
+  style.colorize = blend_color_checkbox_->isChecked();
+  return style;
+}
+
+// ---------------------------------------------------------------------------
+// Worker round trip
+// ---------------------------------------------------------------------------
+
+void VectorscopeWorker::process(const VectorscopeJob& job) {
+  if (job.data) {
+    histogram_.accumulate(job.data->samples.data(), job.data->samples.size(),
+                          job.layout);
+  }
+  // Always answer, even with a null image, so the dialog's in-flight flag is
+  // released.
+  QImage image;
+  if (!histogram_.empty()) {
+    const int size = histogram_.layout().canvas_size;
+    image = QImage(size, size, QImage::Format_ARGB32_Premultiplied);
+    histogram_.render(reinterpret_cast<uint32_t*>(image.bits()),
+                      static_cast<size_t>(image.bytesPerLine()) / 4,
+                      job.style);
   }
+  emit imageReady(std::move(image), histogram_.has_chroma());
+}
 
-  // -------------------------------------------------------------------------
-  // Pass 1 — accumulate sample hits into a 2-D count buffer.
-  //
-  // Consecutive samples within the same field are linked by Bresenham lines
-  // so the trace path between samples also accumulates hits, mimicking the
-  // continuous beam trace of an analogue vectorscope.
-  // -------------------------------------------------------------------------
-  const size_t buf_size = static_cast<size_t>(size) * static_cast<size_t>(size);
-  std::vector<uint32_t> hit_count(buf_size, 0);
-
-  std::minstd_rand random_engine(12345);
-  std::normal_distribution<double> normal_dist(0.0, 100.0);
-
-  std::optional<QPoint> prev_point;
-  uint8_t prev_field_id = 255;  // invalid sentinel
-
-  for (const auto& sample : data.samples) {
-    if (field_select == 1 && sample.field_id != 0) continue;
-    if (field_select == 2 && sample.field_id != 1) continue;
-
-    double u = sample.u;
-    double v = sample.v;
-    if (defocus) {
-      u += normal_dist(random_engine);
-      v += normal_dist(random_engine);
-    }
+void VectorscopeDialog::requestRender(bool reaccumulate) {
+  d_->display_cleared = false;
+  if (reaccumulate) d_->accumulate_pending = true;
+  if (d_->job_in_flight) {
+    // onImageReady() dispatches the latest state when the worker is done.
+    d_->render_pending = true;
+    return;
+  }
+  dispatchJob();
+}
 
-    const QPointF plot_point = geometry.mapUV(u, v);
+void VectorscopeDialog::dispatchJob() {
+  d_->render_pending = false;
+  if (!d_->last_data) return;
 
-    if (isPointWithinCanvas(plot_point, size)) {
-      const int px = static_cast<int>(plot_point.x());
-      const int py = static_cast<int>(plot_point.y());
+  VectorscopeJob job;
+  if (std::exchange(d_->accumulate_pending, false)) job.data = d_->last_data;
+  job.layout = renderLayout();
+  job.style = renderStyle();
 
-      hit_count[static_cast<size_t>(py) * static_cast<size_t>(size) +
-                static_cast<size_t>(px)]++;
+  d_->job_in_flight = true;
+  QMetaObject::invokeMethod(
+      d_->worker,
+      [worker = d_->worker, job = std::move(job)]() { worker->process(job); },
+      Qt::QueuedConnection);
+}
 
-      // Connect consecutive samples within the same field as a trace line.
-      if (draw_trace_lines && prev_point.has_value() &&
-          sample.field_id == prev_field_id) {
-        accumulateLine(hit_count, size, prev_point->x(), prev_point->y(), px,
-                       py);
-      }
-      prev_point = QPoint(px, py);
-      prev_field_id = sample.field_id;
-    } else {
-      prev_point.reset();
-    }
+void VectorscopeDialog::onImageReady(QImage image, bool has_chroma) {
+  d_->job_in_flight = false;
+  if (!d_->display_cleared && !image.isNull()) {
+    d_->raster = std::move(image);
+    d_->has_chroma = has_chroma;
+    composeDisplay();
   }
+  if (d_->render_pending) dispatchJob();
+}
 
-  // -------------------------------------------------------------------------
-  // Pass 2 — render each hit pixel with brightness from count and, when
-  // colorize is on, hue derived from the pixel's U/V canvas position.
-  //
-  // Brightness formula (matching WaveformMonitorWidget, ITU-R BT.601 norm):
-  //   brightness = min(count * 5 * gain + 128, 255) / 255
-  // A single hit → ~52% brightness; full saturation after ~26 hits at gain=1.
-  //
-  // Position color: for each pixel the U/V coordinates are recovered from the
-  // canvas geometry, then the BT.601 inverse matrix at Y=0.5 gives the RGB
-  // colour that would produce a signal at that chroma position (ITU-R
-  // BT.470-6 §1.1.2).  Max-component normalisation ensures every point has
-  // at least one full channel — achromatic samples near the origin render as
-  // white.
-  // -------------------------------------------------------------------------
-  const float k = 5.0f * gain;
-
-  for (int py = 0; py < size; ++py) {
-    for (int px = 0; px < size; ++px) {
-      const uint32_t count =
-          hit_count[static_cast<size_t>(py) * static_cast<size_t>(size) +
-                    static_cast<size_t>(px)];
-      if (count == 0) continue;
-
-      const float brightness =
-          std::min(1.0f, (static_cast<float>(count) * k + 128.0f) / 255.0f);
-
-      int cr, cg, cb;
-      if (colorize) {
-        // Recover U/V at this canvas pixel.
-        const double u_uv =
-            (px - geometry.centre_point.x()) / geometry.pixels_per_uv_unit;
-        const double v_uv =
-            -(py - geometry.centre_point.y()) / geometry.pixels_per_uv_unit;
-
-        // ITU-R BT.470-6 §1.1.2 / EBU Tech. 3280-E §2.1 inverse at Y=0.5:
-        //   B - Y = U / ku  (ku = 0.492111)
-        //   R - Y = V / kv  (kv = 0.877283)
-        //   G derived from BT.601 luminance equation
-        const double u_n = u_uv / orc::gui::kVectorscopeSignedFullScale;
-        const double v_n = v_uv / orc::gui::kVectorscopeSignedFullScale;
-        const double r_raw = 0.5 + v_n / 0.877283;
-        const double b_raw = 0.5 + u_n / 0.492111;
-        const double g_raw = (0.5 - 0.299 * r_raw - 0.114 * b_raw) / 0.587;
-
-        double r_c = std::clamp(r_raw, 0.0, 1.0);
-        double g_c = std::clamp(g_raw, 0.0, 1.0);
-        double b_c = std::clamp(b_raw, 0.0, 1.0);
-
-        // Normalise to max component so the hue direction is always vivid.
-        // The centre (U=V=0) gives equal components → normalises to white.
-        const double max_c = std::max({r_c, g_c, b_c});
-        if (max_c > 0.001) {
-          r_c /= max_c;
-          g_c /= max_c;
-          b_c /= max_c;
-        } else {
-          r_c = g_c = b_c = 1.0;
-        }
-
-        cr = static_cast<int>(r_c * brightness * 255.0f);
-        cg = static_cast<int>(g_c * brightness * 255.0f);
-        cb = static_cast<int>(b_c * brightness * 255.0f);
-      } else {
-        cr = 0;
-        cg = static_cast<int>(brightness * 255.0f);
-        cb = 0;
-      }
+void VectorscopeDialog::composeDisplay() {
+  if (!d_->last_data || d_->raster.isNull()) return;
+  d_->display_cleared = false;
+  const orc::VectorscopeData& data = *d_->last_data;
+  const int size = orc::gui::kVectorscopeCanvasSize;
+  const int graticule_mode = graticule_group_->checkedId();
 
-      image.setPixel(px, py, qRgb(cr, cg, cb));
+  // Colour zones sit behind the data plot; the raster is transparent where
+  // there are no hits.
+  QImage image(size, size, QImage::Format_RGB888);
+  image.fill(Qt::black);
+  {
+    QPainter painter(&image);
+    if (graticule_mode != 0) {
+      d_->drawColorZones(painter, this, data.system, data.cvbs_white,
+                         data.cvbs_blanking);
     }
   }
+  {
+    QPainter painter(&image);
+    painter.drawImage(0, 0, d_->raster);
+  }
 
   // Draw graticule overlay on top of the data plot (axes, circle, markers,
-  // target boxes and labels — colour zones were already drawn beneath the
-  // data).
+  // target boxes and labels).
   {
     QPainter painter(&image);
     if (graticule_mode != 0) {
@@ -676,7 +622,7 @@ void VectorscopeDialog::renderVectorscope(const orc::VectorscopeData& data) {
   }
 
   // Overlay "no chroma" warning when all samples are near the origin.
-  if (!has_chroma) {
+  if (!d_->has_chroma) {
     QPainter painter(&image);
     painter.setPen(Qt::yellow);
     QFont font = painter.font();
@@ -690,6 +636,7 @@ void VectorscopeDialog::renderVectorscope(const orc::VectorscopeData& data) {
   scope_label_->setPixmap(QPixmap::fromImage(image));
 
   // Update info label.
+  const int field_select = field_select_group_->checkedId();
   QString field_info;
   if (field_select == 0) {
     field_info = "Both fields";
@@ -843,12 +790,14 @@ void VectorscopeDialogPrivate::drawColorZones(QPainter& painter,
 }
 
 void VectorscopeDialog::clearDisplay() {
+  // A raster still in flight belongs to the data being cleared.
+  d_->display_cleared = true;
   QImage blank(orc::gui::kVectorscopeCanvasSize,
                orc::gui::kVectorscopeCanvasSize, QImage::Format_RGB888);
   blank.fill(Qt::black);
   {
     QPainter painter(&blank);
-    if (d_->last_data.has_value()) {
+    if (d_->last_data) {
       const auto& data = *d_->last_data;
       d_->drawColorZones(painter, this, data.system, data.cvbs_white,
                          data.cvbs_blanking);
@@ -883,55 +832,43 @@ void VectorscopeDialog::closeEvent(QCloseEvent* event) {
 void VectorscopeDialog::onBlendColorToggled() {
   ORC_LOG_DEBUG("VectorscopeDialog: Blend Color toggled -> {}",
                 blend_color_checkbox_->isChecked());
-  // Re-render with new blend mode
-  if (d_->last_data.has_value()) {
-    renderVectorscope(*d_->last_data);
-  }
+  // Colour is applied when rasterising; the counts are unchanged
+  requestRender(/*reaccumulate=*/false);
 }
 
 void VectorscopeDialog::onDefocusToggled() {
   ORC_LOG_DEBUG("VectorscopeDialog: Defocus toggled -> {}",
                 defocus_checkbox_->isChecked());
-  // Re-render with new defocus settings
-  if (d_->last_data.has_value()) {
-    renderVectorscope(*d_->last_data);
-  }
+  // Re-bin with new defocus settings
+  requestRender(/*reaccumulate=*/true);
 }
 
 void VectorscopeDialog::onFieldSelectionChanged() {
   ORC_LOG_DEBUG("VectorscopeDialog: Field selection changed -> {}",
                 field_select_group_->checkedId());
-  // Re-render with new field selection
-  if (d_->last_data.has_value()) {
-    renderVectorscope(*d_->last_data);
-  }
+  // Re-bin with new field selection
+  requestRender(/*reaccumulate=*/true);
 }
 
 void VectorscopeDialog::onGraticuleChanged() {
   ORC_LOG_DEBUG("VectorscopeDialog: Graticule mode changed -> {}",
                 graticule_group_->checkedId());
-  // Re-render with new graticule
-  if (d_->last_data.has_value()) {
-    renderVectorscope(*d_->last_data);
-  }
+  // The graticule is drawn around the existing raster
+  composeDisplay();
 }
 
 void VectorscopeDialog::onDrawLinesToggled() {
   ORC_LOG_DEBUG("VectorscopeDialog: Draw Lines toggled -> {}",
                 draw_lines_checkbox_->isChecked());
-  // Re-render with or without trace lines
-  if (d_->last_data.has_value()) {
-    renderVectorscope(*d_->last_data);
-  }
+  // Re-bin with or without trace lines
+  requestRender(/*reaccumulate=*/true);
 }
 
 void VectorscopeDialog::onPointSizeChanged() {
   int size = point_size_spinbox_->value();
   ORC_LOG_DEBUG("VectorscopeDialog: Point size changed -> {}", size);
-  // Re-render with new point size
-  if (d_->last_data.has_value()) {
-    renderVectorscope(*d_->last_data);
-  }
+  // Gain is applied when rasterising; the counts are unchanged
+  requestRender(/*reaccumulate=*/false);
 }
 
 void VectorscopeDialog::onActiveAreaOnlyToggled() {
@@ -22,13 +22,53 @@
 #include <QRadioButton>
 #include <QSlider>
 #include <QSpinBox>
+#include <QThread>
 #include <memory>
 #include <optional>
 #include <string>
 
+#include "vectorscope_histogram.h"
+
 // Forward declaration for pimpl
 class VectorscopeDialogPrivate;
 
+/**
+ * @brief One accumulate-and-render pass of the vectorscope worker.
+ *
+ * A job without samples only re-renders the existing histogram, e.g. after a
+ * gain or colour change.
+ */
+struct VectorscopeJob {
+  std::shared_ptr<const orc::VectorscopeData> data;
+  orc::gui::VectorscopeLayout layout;
+  orc::gui::VectorscopeRenderStyle style;
+};
+
+/**
+ * @brief Worker that accumulates and rasterises the vectorscope histogram
+ *
+ * Lives on a dedicated QThread owned by VectorscopeDialog and owns the
+ * histogram; the dialog communicates with it only through queued
+ * invocations and the imageReady() signal.
+ */
+class VectorscopeWorker : public QObject {
+  Q_OBJECT
+
+ public slots:
+  /**
+   * @brief Fold the job's field (if any) into the histogram and render it;
+   * emits imageReady() with the result.
+   */
+  void process(const VectorscopeJob& job);
+
+ signals:
+  /// Canvas-sized ARGB32 premultiplied raster, transparent where empty.
+  void imageReady(QImage image, bool has_chroma);
+
+ private:
+  orc::gui::VectorscopeHistogram histogram_;
+};
+
 /**
  * @brief QLabel subclass that maintains aspect ratio of the displayed pixmap
  */
@@ -55,6 +95,11 @@ class AspectRatioLabel : public QLabel {
  * This dialog displays U/V color components on a vectorscope for decoded
  * chroma output from a VideoSinkStage. It's a live visualization tool that
  * updates in real-time as the user navigates through fields.
+ *
+ * Binning and rasterisation of the samples run on a worker thread; the
+ * dialog draws the colour zones and graticule around the last raster it
+ * received. Fields submitted while the worker is busy are coalesced to the
+ * newest.
  */
 class VectorscopeDialog : public QDialog {
   Q_OBJECT
@@ -74,7 +119,11 @@ class VectorscopeDialog : public QDialog {
   void updateVectorscope(const orc::VectorscopeData& data);
 
   /**
-   * @brief Render vectorscope from extracted U/V data
+   * @brief Queue U/V data for rendering
+   *
+   * The plotted samples update when the worker has binned them; until then
+   * the previous raster stays on screen.
+   *
    * @param data Vectorscope data containing U/V samples
    */
   void renderVectorscope(const orc::VectorscopeData& data);
@@ -107,6 +156,12 @@ class VectorscopeDialog : public QDialog {
   void connectSignals();
   int getGraticuleMode() const;
   void updateWindowTitle();
+  void requestRender(bool reaccumulate);
+  void dispatchJob();
+  void onImageReady(QImage image, bool has_chroma);
+  void composeDisplay();
+  orc::gui::VectorscopeLayout renderLayout() const;
+  orc::gui::VectorscopeRenderStyle renderStyle() const;
 
   // Pimpl - hides core types from header
   std::unique_ptr<VectorscopeDialogPrivate> d_;
@@ -0,0 +1,242 @@
+/*
+ * File:        vectorscope_histogram.cpp
+ * Module:      orc-gui
+ * Purpose:     Vectorscope hit-count buffer and raster kernel
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "vectorscope_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace orc::gui {
+
+namespace {
+
+bool same_geometry(const VectorscopeLayout& a, const VectorscopeLayout& b) {
+  return a.canvas_size == b.canvas_size && a.centre_x == b.centre_x &&
+         a.centre_y == b.centre_y &&
+         a.pixels_per_uv_unit == b.pixels_per_uv_unit &&
+         a.signed_full_scale == b.signed_full_scale;
+}
+
+// Bresenham line rasteriser — increments counts for every pixel on the
+// segment from (x0,y0) to (x1,y1), clamped to the canvas bounds.
+void accumulate_line(uint32_t* counts, int canvas_size, int x0, int y0, int x1,
+                     int y1) {
+  const int dx = std::abs(x1 - x0);
+  const int sx = (x0 < x1) ? 1 : -1;
+  const int dy = -std::abs(y1 - y0);
+  const int sy = (y0 < y1) ? 1 : -1;
+  int err = dx + dy;
+  for (;;) {
+    if (x0 >= 0 && x0 < canvas_size && y0 >= 0 && y0 < canvas_size) {
+      counts[static_cast<size_t>(y0) * static_cast<size_t>(canvas_size) +
+             static_cast<size_t>(x0)]++;
+    }
+    if (x0 == x1 && y0 == y1) break;
+    const int e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+float channel(uint32_t argb, int shift) {
+  return static_cast<float>((argb >> shift) & 0xff);
+}
+
+}  // namespace
+
+bool VectorscopeLayout::operator==(const VectorscopeLayout& other) const {
+  return same_geometry(*this, other) && field_select == other.field_select &&
+         draw_lines == other.draw_lines && defocus == other.defocus;
+}
+
+void VectorscopeHistogram::clear() {
+  layout_ = VectorscopeLayout();
+  has_chroma_ = false;
+  counts_.clear();
+  hue_.clear();
+}
+
+uint32_t VectorscopeHistogram::count(int x, int y) const {
+  const int size = layout_.canvas_size;
+  if (x < 0 || x >= size || y < 0 || y >= size || counts_.empty()) return 0;
+  return counts_[static_cast<size_t>(y) * static_cast<size_t>(size) +
+                 static_cast<size_t>(x)];
+}
+
+void VectorscopeHistogram::accumulate(const orc::UVSample* samples,
+                                      size_t sample_count,
+                                      const VectorscopeLayout& layout) {
+  if (layout.canvas_size <= 0 || layout.pixels_per_uv_unit <= 0.0 ||
+      layout.signed_full_scale <= 0.0) {
+    clear();
+    return;
+  }
+
+  const int size = layout.canvas_size;
+  const size_t cells = static_cast<size_t>(size) * static_cast<size_t>(size);
+  const bool geometry_changed =
+      !same_geometry(layout, layout_) || hue_.size() != cells;
+  layout_ = layout;
+  if (geometry_changed) build_hue_table();
+  counts_.assign(cells, 0u);
+
+  has_chroma_ = false;
+  for (size_t i = 0; i < sample_count; ++i) {
+    if (std::abs(samples[i].u) > kChromaThreshold ||
+        std::abs(samples[i].v) > kChromaThreshold) {
+      has_chroma_ = true;
+      break;
+    }
+  }
+
+  // Fixed seed: re-accumulating the same field gives the same picture.
+  std::minstd_rand random_engine(12345);
+  std::normal_distribution<double> normal_dist(0.0, 100.0);
+
+  const double limit = static_cast<double>(size);
+  bool have_prev = false;
+  int prev_x = 0;
+  int prev_y = 0;
+  uint8_t prev_field_id = 255;  // invalid sentinel
+
+  for (size_t i = 0; i < sample_count; ++i) {
+    const orc::UVSample& sample = samples[i];
+    if (layout.field_select == 1 && sample.field_id != 0) continue;
+    if (layout.field_select == 2 && sample.field_id != 1) continue;
+
+    double u = sample.u;
+    double v = sample.v;
+    if (layout.defocus) {
+      u += normal_dist(random_engine);
+      v += normal_dist(random_engine);
+    }
+
+    const double fx = layout.centre_x + u * layout.pixels_per_uv_unit;
+    const double fy = layout.centre_y - v * layout.pixels_per_uv_unit;
+    if (!(fx >= 0.0 && fx < limit && fy >= 0.0 && fy < limit)) {
+      have_prev = false;
+      continue;
+    }
+
+    const int px = static_cast<int>(fx);
+    const int py = static_cast<int>(fy);
+    counts_[static_cast<size_t>(py) * static_cast<size_t>(size) +
+            static_cast<size_t>(px)]++;
+
+    // Connect consecutive samples within the same field as a trace line.
+    if (layout.draw_lines && have_prev && sample.field_id == prev_field_id) {
+      accumulate_line(counts_.data(), size, prev_x, prev_y, px, py);
+    }
+    have_prev = true;
+    prev_x = px;
+    prev_y = py;
+    prev_field_id = sample.field_id;
+  }
+}
+
+// Position colour: for each pixel the U/V coordinates are recovered from the
+// canvas geometry, then the BT.601 inverse matrix at Y=0.5 gives the RGB
+// colour that would produce a signal at that chroma position (ITU-R
+// BT.470-6 §1.1.2). Max-component normalisation ensures every point has at
+// least one full channel — achromatic samples near the origin render as
+// white.
+void VectorscopeHistogram::build_hue_table() {
+  const int size = layout_.canvas_size;
+  hue_.resize(static_cast<size_t>(size) * static_cast<size_t>(size));
+
+  for (int py = 0; py < size; ++py) {
+    for (int px = 0; px < size; ++px) {
+      const double u_uv = (px - layout_.centre_x) / layout_.pixels_per_uv_unit;
+      const double v_uv = -(py - layout_.centre_y) / layout_.pixels_per_uv_unit;
+
+      // ITU-R BT.470-6 §1.1.2 / EBU Tech. 3280-E §2.1 inverse at Y=0.5:
+      //   B - Y = U / ku  (ku = 0.492111)
+      //   R - Y = V / kv  (kv = 0.877283)
+      //   G derived from BT.601 luminance equation
+      const double u_n = u_uv / layout_.signed_full_scale;
+      const double v_n = v_uv / layout_.signed_full_scale;
+      const double r_raw = 0.5 + v_n / 0.877283;
+      const double b_raw = 0.5 + u_n / 0.492111;
+      const double g_raw = (0.5 - 0.299 * r_raw - 0.114 * b_raw) / 0.587;
+
+      double r_c = std::clamp(r_raw, 0.0, 1.0);
+      double g_c = std::clamp(g_raw, 0.0, 1.0);
+      double b_c = std::clamp(b_raw, 0.0, 1.0);
+
+      // Normalise to max component so the hue direction is always vivid.
+      // The centre (U=V=0) gives equal components → normalises to white.
+      const double max_c = std::max({r_c, g_c, b_c});
+      if (max_c > 0.001) {
+        r_c /= max_c;
+        g_c /= max_c;
+        b_c /= max_c;
+      } else {
+        r_c = g_c = b_c = 1.0;
+      }
+
+      hue_[static_cast<size_t>(py) * static_cast<size_t>(size) +
+           static_cast<size_t>(px)] =
+          (static_cast<uint32_t>(std::lround(r_c * 255.0)) << 16) |
+          (static_cast<uint32_t>(std::lround(g_c * 255.0)) << 8) |
+          static_cast<uint32_t>(std::lround(b_c * 255.0));
+    }
+  }
+}
+
+void VectorscopeHistogram::render(uint32_t* pixels, size_t stride,
+                                  const VectorscopeRenderStyle& style) const {
+  const int size = layout_.canvas_size;
+  if (size <= 0) return;
+
+  const size_t width = static_cast<size_t>(size);
+  if (counts_.empty()) {
+    for (int py = 0; py < size; ++py) {
+      std::fill_n(pixels + static_cast<size_t>(py) * stride, width, 0u);
+    }
+    return;
+  }
+
+  // Brightness formula (matching WaveformMonitorWidget, ITU-R BT.601 norm):
+  //   brightness = min(count * 5 * gain + bias, 255) / 255
+  // With the default bias a single hit is ~52% bright; full saturation after
+  // ~26 hits at gain=1.
+  const float k = 5.0f * style.gain;
+
+  for (int py = 0; py < size; ++py) {
+    const size_t row = static_cast<size_t>(py) * width;
+    const uint32_t* counts = counts_.data() + row;
+    const uint32_t* hues = hue_.data() + row;
+    uint32_t* line = pixels + static_cast<size_t>(py) * stride;
+    for (size_t px = 0; px < width; ++px) {
+      const uint32_t count = counts[px];
+      if (count == 0) {
+        line[px] = 0;  // transparent: the graticule shows through
+        continue;
+      }
+
+      const float b = std::min(
+          1.0f, (static_cast<float>(count) * k + style.brightness_bias) /
+                    255.0f);
+      const uint32_t colour = style.colorize ? hues[px] : style.trace;
+      const uint32_t cr = static_cast<uint32_t>(channel(colour, 16) * b);
+      const uint32_t cg = static_cast<uint32_t>(channel(colour, 8) * b);
+      const uint32_t cb = static_cast<uint32_t>(channel(colour, 0) * b);
+      line[px] = 0xff000000u | (cr << 16) | (cg << 8) | cb;
+    }
+  }
+}
+
+}  // namespace orc::gui
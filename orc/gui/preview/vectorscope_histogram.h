@@ -0,0 +1,118 @@
+/*
+ * File:        vectorscope_histogram.h
+ * Module:      orc-gui
+ * Purpose:     Vectorscope hit-count buffer and raster kernel
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#ifndef ORC_GUI_PREVIEW_VECTORSCOPE_HISTOGRAM_H
+#define ORC_GUI_PREVIEW_VECTORSCOPE_HISTOGRAM_H
+
+#include <orc/stage/preview/orc_vectorscope.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace orc::gui {
+
+/**
+ * @brief How U/V samples map onto the square vectorscope canvas, and which
+ * of them are plotted.
+ *
+ * A sample lands on pixel (centre_x + u * pixels_per_uv_unit,
+ * centre_y - v * pixels_per_uv_unit), matching VectorscopePlotGeometry::mapUV.
+ */
+struct VectorscopeLayout {
+  int canvas_size = 0;
+  double centre_x = 0.0;
+  double centre_y = 0.0;
+  double pixels_per_uv_unit = 0.0;
+  double signed_full_scale = 32768.0;  ///< U/V magnitude of the plot edge
+
+  int field_select = 0;     ///< 0 = both, 1 = first field, 2 = second field
+  bool draw_lines = false;  ///< Trace between consecutive samples of a field
+  bool defocus = false;     ///< Jitter samples to soften the trace
+
+  bool operator==(const VectorscopeLayout& other) const;
+  bool operator!=(const VectorscopeLayout& other) const {
+    return !(*this == other);
+  }
+};
+
+/// Colours and gain for VectorscopeHistogram::render().
+struct VectorscopeRenderStyle {
+  float gain = 1.0f;
+  float brightness_bias = 128.0f;
+  bool colorize = false;        ///< Hue from each pixel's U/V position
+  uint32_t trace = 0xff00ff00;  ///< 0xAARRGGBB, used when not colorizing
+};
+
+/**
+ * @brief Hit-count buffer of the vectorscope.
+ *
+ * accumulate() bins one field's samples (and, optionally, the Bresenham trace
+ * between consecutive samples) into a canvas-sized count buffer; render()
+ * turns the counts into pixels. Counts are stored row-major, so the raster
+ * pass runs over contiguous memory; the per-pixel hue used when colorizing
+ * depends only on the layout and is tabulated once per layout.
+ *
+ * Pure logic (no Qt) so it runs on a worker thread and is unit-testable.
+ *
+ * Thread safety: not thread-safe; use from a single thread.
+ */
+class VectorscopeHistogram {
+ public:
+  /// A field whose |U| and |V| all stay below this is treated as mono.
+  static constexpr double kChromaThreshold = 1000.0;
+
+  /**
+   * @brief Replace the buffer with the counts of one field.
+   *
+   * Samples outside the canvas are dropped and break the trace. An unusable
+   * layout clears the buffer.
+   */
+  void accumulate(const orc::UVSample* samples, size_t sample_count,
+                  const VectorscopeLayout& layout);
+
+  /// Discard all counts.
+  void clear();
+
+  bool empty() const { return counts_.empty(); }
+  const VectorscopeLayout& layout() const { return layout_; }
+
+  /// Whether the last accumulated field had any sample beyond
+  /// kChromaThreshold.
+  bool has_chroma() const { return has_chroma_; }
+
+  /// Hit count of canvas pixel (@p x, @p y).
+  uint32_t count(int x, int y) const;
+
+  /**
+   * @brief Rasterise into a canvas-sized 32-bit ARGB scanline buffer.
+   *
+   * Hit pixels take brightness min(1, (count * 5 * gain + bias) / 255) of the
+   * trace colour, or of the pixel's U/V hue when colorizing. Empty pixels are
+   * written fully transparent, so the buffer suits
+   * QImage::Format_ARGB32_Premultiplied drawn over a graticule.
+   *
+   * @param pixels First scanline
+   * @param stride Pixels between scanline starts (>= canvas size)
+   */
+  void render(uint32_t* pixels, size_t stride,
+              const VectorscopeRenderStyle& style) const;
+
+ private:
+  void build_hue_table();
+
+  VectorscopeLayout layout_;
+  bool has_chroma_ = false;
+  std::vector<uint32_t> counts_;  // [y * canvas_size + x]
+  std::vector<uint32_t> hue_;     // 0x00RRGGBB at full brightness, per pixel
+};
+
+}  // namespace orc::gui
+
+#endif  // ORC_GUI_PREVIEW_VECTORSCOPE_HISTOGRAM_H
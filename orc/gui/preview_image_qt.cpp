@@ -1,7 +1,7 @@
 /*
  * File:        preview_image_qt.cpp
  * Module:      orc-gui
- * Purpose:     Conversion from core PreviewImage RGB888 data to QImage
+ * Purpose:     Viewport rendering of core preview image pyramids into QImage
  *
  * SPDX-License-Identifier: GPL-3.0-or-later
  * SPDX-FileCopyrightText: 2026 Simon Inns
@@ -9,40 +9,28 @@
 
 #include "preview_image_qt.h"
 
-#include <orc/stage/preview/orc_rendering.h>
-
-#include <cstring>
-
 namespace orc::gui {
 
-QImage previewImageToQImage(const orc::PreviewImage& image, QImage reuse) {
-  if (image.rgb_data.empty() || image.width == 0 || image.height == 0) {
+QImage renderPreviewViewport(const orc::PreviewImagePyramid& pyramid,
+                             const orc::PreviewViewport& view,
+                             bool show_dropouts, QImage reuse) {
+  if (pyramid.empty() || view.output_width == 0 || view.output_height == 0) {
     return QImage();
   }
 
   QImage result = std::move(reuse);
-  if (result.width() != static_cast<int>(image.width) ||
-      result.height() != static_cast<int>(image.height) ||
+  if (result.width() != static_cast<int>(view.output_width) ||
+      result.height() != static_cast<int>(view.output_height) ||
       result.format() != QImage::Format_RGB888) {
-    result = QImage(static_cast<int>(image.width),
-                    static_cast<int>(image.height), QImage::Format_RGB888);
-  }
-
-  // QImage aligns scanlines to 4-byte boundaries, so check the stride.
-  const size_t source_bytes_per_line = static_cast<size_t>(image.width) * 3;
-  const size_t qimage_bytes_per_line =
-      static_cast<size_t>(result.bytesPerLine());
-
-  if (source_bytes_per_line == qimage_bytes_per_line) {
-    std::memcpy(result.bits(), image.rgb_data.data(), image.rgb_data.size());
-  } else {
-    for (size_t y = 0; y < image.height; ++y) {
-      auto* scan_line = result.scanLine(static_cast<int>(y));
-      const uint8_t* src = &image.rgb_data[y * source_bytes_per_line];
-      std::memcpy(scan_line, src, source_bytes_per_line);
-    }
+    result = QImage(static_cast<int>(view.output_width),
+                    static_cast<int>(view.output_height),
+                    QImage::Format_RGB888);
   }
+  result.fill(Qt::black);
 
+  // QImage aligns scanlines to 4-byte boundaries, so pass its stride.
+  pyramid.render(view, result.bits(),
+                 static_cast<size_t>(result.bytesPerLine()), show_dropouts);
   return result;
 }
 
@@ -1,7 +1,7 @@
 /*
  * File:        preview_image_qt.h
  * Module:      orc-gui
- * Purpose:     Conversion from core PreviewImage RGB888 data to QImage
+ * Purpose:     Viewport rendering of core preview image pyramids into QImage
  *
  * SPDX-License-Identifier: GPL-3.0-or-later
  * SPDX-FileCopyrightText: 2026 Simon Inns
@@ -10,26 +10,29 @@
 #ifndef PREVIEW_IMAGE_QT_H
 #define PREVIEW_IMAGE_QT_H
 
-#include <QImage>
+#include <preview_image_pyramid.h>
 
-namespace orc {
-struct PreviewImage;
-}  // namespace orc
+#include <QImage>
 
 namespace orc::gui {
 
 /**
- * @brief Convert a core PreviewImage (tightly packed RGB888) into a QImage.
+ * @brief Render one viewport of a preview pyramid into an RGB888 QImage.
  *
- * Handles QImage's 4-byte scanline alignment. When @p reuse has matching
- * dimensions and format its buffer is reused to avoid reallocation.
+ * The result is view.output_width x view.output_height, so it is drawn
+ * unscaled and its cost follows the on-screen size rather than the frame.
+ * Pixels outside the image are black. When @p reuse has matching dimensions
+ * and format its buffer is reused to avoid reallocation.
  *
- * @param image Source RGB888 preview image from the render presenter
+ * @param pyramid Pyramid built from the render presenter's PreviewImage
+ * @param view Source region and output size (see orc::PreviewViewport)
+ * @param show_dropouts Paint the pyramid's dropout regions in red
  * @param reuse Optional previous QImage whose buffer may be reused
- * @return Converted image, or a null QImage when @p image is empty/invalid
+ * @return Rendered image, or a null QImage when there is nothing to show
  */
-QImage previewImageToQImage(const orc::PreviewImage& image,
-                            QImage reuse = QImage());
+QImage renderPreviewViewport(const orc::PreviewImagePyramid& pyramid,
+                             const orc::PreviewViewport& view,
+                             bool show_dropouts, QImage reuse = QImage());
 
 }  // namespace orc::gui
 
@@ -12,6 +12,8 @@
 
 #include <orc/stage/common_types.h>  // For analysis result types
 
+#include <algorithm>
+
 #include "logging.h"
 #include "render_presenter.h"
 
@@ -30,9 +32,17 @@ class RenderPresenterAdapter final : public orc::presenters::IRenderPresenter {
 
   orc::PreviewRenderResult renderPreview(
       orc::NodeID node_id, orc::PreviewOutputType output_type,
-      uint64_t output_index, const std::string& option_id) override {
+      uint64_t output_index, const std::string& option_id,
+      std::function<bool()> cancel_check) override {
     return presenter_.renderPreview(node_id, output_type, output_index,
-                                    option_id);
+                                    option_id, std::move(cancel_check));
+  }
+
+  std::optional<orc::PreviewRenderResult> renderDraftPreview(
+      orc::NodeID node_id, orc::PreviewOutputType output_type,
+      uint64_t output_index, std::function<bool()> cancel_check) override {
+    return presenter_.renderDraftPreview(node_id, output_type, output_index,
+                                         std::move(cancel_check));
   }
 
   std::optional<orc::presenters::VBIFieldInfoView> getVBIData(
@@ -172,6 +182,66 @@ class RenderPresenterAdapter final : public orc::presenters::IRenderPresenter {
   orc::presenters::RenderPresenter presenter_;
 };
 
+// Field-wise equality of analysis buckets, used to forward each refinement
+// snapshot a sink publishes exactly once.
+bool sameStats(const orc::FrameDropoutStats& a,
+               const orc::FrameDropoutStats& b) {
+  return a.frame_number == b.frame_number &&
+         a.total_dropout_length == b.total_dropout_length &&
+         a.dropout_count == b.dropout_count && a.has_data == b.has_data;
+}
+
+bool sameStats(const orc::FrameSNRStats& a, const orc::FrameSNRStats& b) {
+  return a.frame_number == b.frame_number && a.white_snr == b.white_snr &&
+         a.black_psnr == b.black_psnr && a.has_white_snr == b.has_white_snr &&
+         a.has_black_psnr == b.has_black_psnr && a.has_data == b.has_data &&
+         a.field_count == b.field_count;
+}
+
+bool sameStats(const orc::FrameBurstLevelStats& a,
+               const orc::FrameBurstLevelStats& b) {
+  return a.frame_number == b.frame_number &&
+         a.median_burst_10bit == b.median_burst_10bit &&
+         a.has_data == b.has_data && a.field_count == b.field_count;
+}
+
+/**
+ * @brief Wrap a trigger progress callback so it also forwards partial results
+ *
+ * The progressive analysis sinks publish a coarse dataset and then throttled
+ * refinement snapshots while triggerStage() runs, always on the thread that
+ * called it, followed by a progress report. After each report the sink's
+ * current dataset is read through @p fetch (same thread, so no race with the
+ * publisher) and handed to @p emit_partial when it differs from the last one
+ * forwarded.
+ */
+template <typename Stats, typename Fetch, typename EmitPartial>
+orc::presenters::IRenderPresenter::TriggerProgressCallback
+withPartialResults(
+    orc::presenters::IRenderPresenter::TriggerProgressCallback progress,
+    Fetch fetch, EmitPartial emit_partial) {
+  auto last = std::make_shared<std::vector<Stats>>();
+  return [progress = std::move(progress), fetch = std::move(fetch),
+          emit_partial = std::move(emit_partial),
+          last](int current, int total, const std::string& message) {
+    progress(current, total, message);
+
+    std::vector<void*> data_ptr;
+    int32_t total_frames = 0;
+    if (!fetch(data_ptr, total_frames) || data_ptr.empty()) return;
+    const auto& stats = *static_cast<const std::vector<Stats>*>(data_ptr[0]);
+    const bool unchanged =
+        stats.size() == last->size() &&
+        std::equal(stats.begin(), stats.end(), last->begin(),
+                   [](const Stats& a, const Stats& b) {
+                     return sameStats(a, b);
+                   });
+    if (unchanged) return;
+    *last = stats;
+    emit_partial(*last, total_frames);
+  };
+}
+
 }  // namespace
 
 std::shared_ptr<orc::presenters::IRenderPresenter> makeRenderPresenterAdapter(
@@ -205,19 +275,22 @@ RenderCoordinator::RenderCoordinator(RenderPresenterFactory presenter_factory,
 RenderCoordinator::~RenderCoordinator() { stop(); }
 
 void RenderCoordinator::start() {
-  if (worker_thread_.joinable()) {
-    ORC_LOG_WARN("RenderCoordinator: Worker thread already running");
+  if (interactive_.thread.joinable()) {
+    ORC_LOG_WARN("RenderCoordinator: Worker lanes already running");
     return;
   }
 
   shutdown_requested_ = false;
-  worker_thread_ = std::thread(&RenderCoordinator::workerLoop, this);
+  for (WorkerLane* lane : {&interactive_, &background_}) {
+    lane->thread =
+        std::thread(&RenderCoordinator::workerLoop, this, std::ref(*lane));
+  }
 
-  ORC_LOG_DEBUG("RenderCoordinator: Worker thread started");
+  ORC_LOG_DEBUG("RenderCoordinator: Worker lanes started");
 }
 
 void RenderCoordinator::stop() {
-  if (!worker_thread_.joinable()) {
+  if (!interactive_.thread.joinable()) {
     return;
   }
 
@@ -226,41 +299,62 @@ void RenderCoordinator::stop() {
   // Send shutdown request
   shutdown_requested_ = true;
 
-  // Wake up worker if waiting
-  {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    queue_cv_.notify_one();
+  // Wake up workers if waiting
+  for (WorkerLane* lane : {&interactive_, &background_}) {
+    std::lock_guard<std::mutex> lock(lane->mutex);
+    lane->cv.notify_one();
   }
 
-  // Wait for worker to finish
-  if (worker_thread_.joinable()) {
-    worker_thread_.join();
+  // Wait for workers to finish
+  for (WorkerLane* lane : {&interactive_, &background_}) {
+    if (lane->thread.joinable()) {
+      lane->thread.join();
+    }
   }
 
-  ORC_LOG_DEBUG("RenderCoordinator: Worker thread stopped");
+  ORC_LOG_DEBUG("RenderCoordinator: Worker lanes stopped");
 }
 
 uint64_t RenderCoordinator::nextRequestId() {
   return next_request_id_.fetch_add(1);
 }
 
+RenderCoordinator::WorkerLane& RenderCoordinator::laneFor(
+    RenderRequestType type) {
+  switch (type) {
+    case RenderRequestType::GetDropoutData:
+    case RenderRequestType::GetSNRData:
+    case RenderRequestType::GetBurstLevelData:
+    case RenderRequestType::TriggerStage:
+      return background_;
+    default:
+      return interactive_;
+  }
+}
+
 void RenderCoordinator::enqueueRequest(std::unique_ptr<RenderRequest> request) {
+  WorkerLane& lane = laneFor(request->type);
   {
-    std::lock_guard<std::mutex> lock(queue_mutex_);
-    request_queue_.push(std::move(request));
+    std::lock_guard<std::mutex> lock(lane.mutex);
+    lane.queue.push_back(std::move(request));
   }
-  queue_cv_.notify_one();
+  lane.cv.notify_one();
 }
 
 void RenderCoordinator::updateDAG(std::shared_ptr<const void> dag) {
-  auto req =
-      std::make_unique<UpdateDAGRequest>(nextRequestId(), std::move(dag));
-  enqueueRequest(std::move(req));
+  // Each lane switches DAG in order with its own requests
+  const uint64_t id = nextRequestId();
+  for (WorkerLane* lane : {&interactive_, &background_}) {
+    {
+      std::lock_guard<std::mutex> lock(lane->mutex);
+      lane->queue.push_back(std::make_unique<UpdateDAGRequest>(id, dag));
+    }
+    lane->cv.notify_one();
+  }
 }
 
 void RenderCoordinator::setProject(void* project) {
-  std::lock_guard<std::mutex> lock(queue_mutex_);
-  worker_project_ = project;
+  worker_project_.store(project);
 }
 
 uint64_t RenderCoordinator::requestPreview(const orc::NodeID& node_id,
@@ -365,11 +459,11 @@ orc::ImageToFieldMappingResult RenderCoordinator::mapImageToField(
     uint64_t output_index, int image_y, int image_height) {
   // This is a synchronous call - safe to call render presenter directly
   // since it's just a calculation with no state changes
-  std::lock_guard<std::mutex> lock(queue_mutex_);
-  if (!worker_render_presenter_) {
+  std::lock_guard<std::mutex> lock(interactive_.mutex);
+  if (!interactive_.presenter) {
     return orc::ImageToFieldMappingResult{false, 0, 0};
   }
-  return worker_render_presenter_->mapImageToField(
+  return interactive_.presenter->mapImageToField(
       node_id, output_type, output_index, image_y, image_height);
 }
 
@@ -379,45 +473,45 @@ orc::FieldToImageMappingResult RenderCoordinator::mapFieldToImage(
     int image_height) {
   // This is a synchronous call - safe to call render presenter directly
   // since it's just a calculation with no state changes
-  std::lock_guard<std::mutex> lock(queue_mutex_);
-  if (!worker_render_presenter_) {
+  std::lock_guard<std::mutex> lock(interactive_.mutex);
+  if (!interactive_.presenter) {
     return orc::FieldToImageMappingResult{false, 0};
   }
-  return worker_render_presenter_->mapFieldToImage(node_id, output_type,
-                                                   output_index, field_index,
-                                                   field_line, image_height);
+  return interactive_.presenter->mapFieldToImage(node_id, output_type,
+                                                 output_index, field_index,
+                                                 field_line, image_height);
 }
 
 orc::FrameFieldsResult RenderCoordinator::getFrameFields(
     const orc::NodeID& node_id, uint64_t frame_index) {
   // This is a synchronous call - safe to call render presenter directly
   // since it's just a calculation with no state changes
-  std::lock_guard<std::mutex> lock(queue_mutex_);
-  if (!worker_render_presenter_) {
+  std::lock_guard<std::mutex> lock(interactive_.mutex);
+  if (!interactive_.presenter) {
     return orc::FrameFieldsResult{false, 0, 0};
   }
-  return worker_render_presenter_->getFrameFields(node_id, frame_index);
+  return interactive_.presenter->getFrameFields(node_id, frame_index);
 }
 
 std::vector<orc::PreviewViewDescriptor>
 RenderCoordinator::getAvailablePreviewViews(const orc::NodeID& node_id,
                                             orc::VideoDataType data_type) {
-  std::lock_guard<std::mutex> lock(queue_mutex_);
-  if (!worker_render_presenter_) {
+  std::lock_guard<std::mutex> lock(interactive_.mutex);
+  if (!interactive_.presenter) {
     return {};
   }
-  return worker_render_presenter_->getAvailablePreviewViews(node_id, data_type);
+  return interactive_.presenter->getAvailablePreviewViews(node_id, data_type);
 }
 
 orc::PreviewViewDataResult RenderCoordinator::requestPreviewViewData(
     const orc::NodeID& node_id, const std::string& view_id,
     orc::VideoDataType data_type, const orc::PreviewCoordinate& coordinate) {
-  std::lock_guard<std::mutex> lock(queue_mutex_);
-  if (!worker_render_presenter_) {
+  std::lock_guard<std::mutex> lock(interactive_.mutex);
+  if (!interactive_.presenter) {
     return {false, "Render presenter not initialized",
             orc::PreviewViewPayloadKind::None, std::nullopt, std::nullopt};
   }
-  return worker_render_presenter_->requestPreviewViewData(
+  return interactive_.presenter->requestPreviewViewData(
       node_id, view_id, data_type, coordinate);
 }
 
@@ -428,47 +522,98 @@ uint64_t RenderCoordinator::requestTrigger(const orc::NodeID& node_id) {
   return id;
 }
 
+void RenderCoordinator::setPrefetchDepth(size_t depth) {
+  prefetch_depth_.store(depth);
+}
+
+void RenderCoordinator::setDraftPreviews(bool enabled) {
+  draft_previews_.store(enabled);
+}
+
 void RenderCoordinator::cancelTrigger() {
-  // Call cancelTrigger on the presenter (thread-safe)
-  // The presenter's implementation sets a flag that the trigger operation will
-  // check
-  if (worker_render_presenter_) {
-    worker_render_presenter_->cancelTrigger();
+  // Triggers run on the background lane. The presenter's cancelTrigger() sets
+  // a flag that the trigger operation will check (thread-safe).
+  std::lock_guard<std::mutex> lock(background_.mutex);
+  for (const auto& queued : background_.queue) {
+    if (queued->type == RenderRequestType::TriggerStage) {
+      queued->cancelled->store(true);
+    }
+  }
+  const RenderRequest* in_flight = background_.in_flight;
+  if (in_flight && in_flight->type == RenderRequestType::TriggerStage) {
+    in_flight->cancelled->store(true);
+    if (background_.presenter) {
+      background_.presenter->cancelTrigger();
+    }
   }
   ORC_LOG_DEBUG("RenderCoordinator: Trigger cancellation requested");
 }
 
+void RenderCoordinator::cancelRequest(uint64_t request_id) {
+  for (WorkerLane* lane : {&interactive_, &background_}) {
+    std::lock_guard<std::mutex> lock(lane->mutex);
+    for (const auto& queued : lane->queue) {
+      if (queued->request_id == request_id) {
+        queued->cancelled->store(true);
+      }
+    }
+    if (lane->in_flight && lane->in_flight->request_id == request_id) {
+      lane->in_flight->cancelled->store(true);
+      // Analyses and triggers can only be stopped through the presenter
+      if (lane == &background_ && lane->presenter) {
+        lane->presenter->cancelTrigger();
+      }
+      ORC_LOG_DEBUG("RenderCoordinator: Cancelling {} request {}",
+                    lane->name, request_id);
+    }
+  }
+}
+
 // ============================================================================
 // Worker Thread Implementation
 // ============================================================================
 
-void RenderCoordinator::workerLoop() {
-  ORC_LOG_DEBUG("RenderCoordinator: Worker thread loop started");
+void RenderCoordinator::workerLoop(WorkerLane& lane) {
+  ORC_LOG_DEBUG("RenderCoordinator: {} lane loop started", lane.name);
+
+  // Speculative work (prefetch, draft refinement) belongs to the interactive
+  // lane; pending_refine_ and prefetch_queue_ are only touched by its thread.
+  const bool interactive = &lane == &interactive_;
 
   while (!shutdown_requested_) {
     std::unique_ptr<RenderRequest> request;
 
-    // Wait for a request
+    // Wait for a request; a pending refinement wakes the worker when its
+    // settle delay expires, and pending prefetch work keeps it awake.
     {
-      std::unique_lock<std::mutex> lock(queue_mutex_);
-      queue_cv_.wait(lock, [this] {
-        return !request_queue_.empty() || shutdown_requested_;
-      });
+      std::unique_lock<std::mutex> lock(lane.mutex);
+      if (interactive && pending_refine_) {
+        lane.cv.wait_until(lock, pending_refine_->due, [this, &lane] {
+          return !lane.queue.empty() || shutdown_requested_;
+        });
+      } else {
+        lane.cv.wait(lock, [this, &lane, interactive] {
+          return !lane.queue.empty() ||
+                 (interactive && !prefetch_queue_.empty()) ||
+                 shutdown_requested_;
+        });
+      }
 
       if (shutdown_requested_) {
         break;
       }
 
-      if (!request_queue_.empty()) {
-        request = std::move(request_queue_.front());
-        request_queue_.pop();
+      if (!lane.queue.empty()) {
+        request = std::move(lane.queue.front());
+        lane.queue.pop_front();
+        lane.in_flight = request.get();
       }
     }
 
     // Process the request
     if (request) {
       try {
-        processRequest(std::move(request));
+        processRequest(lane, *request);
       } catch (const std::exception& e) {
         ORC_LOG_ERROR("RenderCoordinator: Exception processing request: {}",
                       e.what());
@@ -478,68 +623,102 @@ void RenderCoordinator::workerLoop() {
             "RenderCoordinator: Unknown exception processing request");
         emit error(request->request_id, "Unknown error");
       }
+      std::lock_guard<std::mutex> lock(lane.mutex);
+      lane.in_flight = nullptr;
+    } else if (!interactive) {
+      continue;
+    } else if (pending_refine_) {
+      if (std::chrono::steady_clock::now() >= pending_refine_->due) {
+        runRefineStep();
+      }
+    } else {
+      runPrefetchStep();
     }
   }
 
-  ORC_LOG_DEBUG("RenderCoordinator: Worker thread loop exiting");
+  ORC_LOG_DEBUG("RenderCoordinator: {} lane loop exiting", lane.name);
 }
 
-void RenderCoordinator::processRequest(std::unique_ptr<RenderRequest> request) {
-  switch (request->type) {
+void RenderCoordinator::reportCancelled(const RenderRequest& request) {
+  ORC_LOG_DEBUG("RenderCoordinator: Dropping cancelled request {}",
+                request.request_id);
+  switch (request.type) {
+    case RenderRequestType::RenderPreview:
+      // Previews are superseded silently, like stale ones
+      break;
+    case RenderRequestType::TriggerStage:
+      emit triggerComplete(request.request_id, false, "Trigger cancelled");
+      break;
+    default:
+      emit error(request.request_id, "Request cancelled");
+      break;
+  }
+}
+
+void RenderCoordinator::processRequest(WorkerLane& lane,
+                                       const RenderRequest& request) {
+  // A DAG update shares its ID across lanes and is never dropped
+  if (request.type != RenderRequestType::UpdateDAG &&
+      request.cancelled->load()) {
+    reportCancelled(request);
+    return;
+  }
+
+  switch (request.type) {
     case RenderRequestType::UpdateDAG:
-      handleUpdateDAG(*static_cast<UpdateDAGRequest*>(request.get()));
+      handleUpdateDAG(lane, static_cast<const UpdateDAGRequest&>(request));
       break;
 
     case RenderRequestType::RenderPreview:
-      handleRenderPreview(*static_cast<RenderPreviewRequest*>(request.get()));
+      handleRenderPreview(static_cast<const RenderPreviewRequest&>(request));
       break;
 
     case RenderRequestType::GetVBIData:
-      handleGetVBIData(*static_cast<GetVBIDataRequest*>(request.get()));
+      handleGetVBIData(static_cast<const GetVBIDataRequest&>(request));
       break;
 
     case RenderRequestType::GetDropoutData:
-      handleGetDropoutData(*static_cast<GetDropoutDataRequest*>(request.get()));
+      handleGetDropoutData(static_cast<const GetDropoutDataRequest&>(request));
       break;
 
     case RenderRequestType::GetSNRData:
-      handleGetSNRData(*static_cast<GetSNRDataRequest*>(request.get()));
+      handleGetSNRData(static_cast<const GetSNRDataRequest&>(request));
       break;
 
     case RenderRequestType::GetBurstLevelData:
       handleGetBurstLevelData(
-          *static_cast<GetBurstLevelDataRequest*>(request.get()));
+          static_cast<const GetBurstLevelDataRequest&>(request));
       break;
 
     case RenderRequestType::GetAvailableOutputs:
       handleGetAvailableOutputs(
-          *static_cast<GetAvailableOutputsRequest*>(request.get()));
+          static_cast<const GetAvailableOutputsRequest&>(request));
       break;
 
     case RenderRequestType::GetLineSamples:
-      handleGetLineSamples(*static_cast<GetLineSamplesRequest*>(request.get()));
+      handleGetLineSamples(static_cast<const GetLineSamplesRequest&>(request));
       break;
 
     case RenderRequestType::GetFrameTiming:
-      handleGetFrameTiming(*static_cast<GetFrameTimingRequest*>(request.get()));
+      handleGetFrameTiming(static_cast<const GetFrameTimingRequest&>(request));
       break;
 
     case RenderRequestType::GetWaveformMonitor:
       handleGetWaveformMonitor(
-          *static_cast<GetWaveformMonitorRequest*>(request.get()));
+          static_cast<const GetWaveformMonitorRequest&>(request));
       break;
 
     case RenderRequestType::SavePNG:
-      handleSavePNG(*static_cast<SavePNGRequest*>(request.get()));
+      handleSavePNG(static_cast<const SavePNGRequest&>(request));
       break;
 
     case RenderRequestType::NavigateFrameLine:
       handleNavigateFrameLine(
-          *static_cast<NavigateFrameLineRequest*>(request.get()));
+          static_cast<const NavigateFrameLineRequest&>(request));
       break;
 
     case RenderRequestType::TriggerStage:
-      handleTriggerStage(*static_cast<TriggerStageRequest*>(request.get()));
+      handleTriggerStage(static_cast<const TriggerStageRequest&>(request));
       break;
 
     case RenderRequestType::Shutdown:
@@ -548,58 +727,75 @@ void RenderCoordinator::processRequest(std::unique_ptr<RenderRequest> request) {
 
     default:
       ORC_LOG_WARN("RenderCoordinator: Unknown request type: {}",
-                   static_cast<int>(request->type));
+                   static_cast<int>(request.type));
       break;
   }
 }
 
-void RenderCoordinator::handleUpdateDAG(const UpdateDAGRequest& req) {
-  ORC_LOG_DEBUG("RenderCoordinator: Updating DAG (request {})", req.request_id);
+void RenderCoordinator::handleUpdateDAG(WorkerLane& lane,
+                                        const UpdateDAGRequest& req) {
+  ORC_LOG_DEBUG("RenderCoordinator: Updating {} lane DAG (request {})",
+                lane.name, req.request_id);
+  const bool interactive = &lane == &interactive_;
+
+  // Previews rendered from the old DAG are no longer valid
+  if (interactive) {
+    preview_cache_.clear();
+    prefetch_queue_.clear();
+    pending_refine_.reset();
+    last_preview_key_.reset();
+  }
 
   if (!req.dag) {
     // Null DAG is valid - happens with empty projects or projects with no
     // stages
-    ORC_LOG_WARN(
-        "RenderCoordinator: Received null DAG (empty project with no stages)");
+    if (interactive) {
+      ORC_LOG_WARN(
+          "RenderCoordinator: Received null DAG (empty project with no "
+          "stages)");
+    }
 
-    // Clear all worker state
-    worker_dag_.reset();
-    worker_render_presenter_.reset();
+    // Clear all lane state
+    lane.dag.reset();
+    {
+      std::lock_guard<std::mutex> lock(lane.mutex);
+      lane.presenter.reset();
+    }
 
     ORC_LOG_DEBUG(
-        "RenderCoordinator: Cleared all rendering state for empty project");
+        "RenderCoordinator: Cleared {} lane rendering state for empty project",
+        lane.name);
     return;
   }
 
-  // Save current show_dropouts state before recreating presenter
-  bool show_dropouts = false;
-  if (worker_render_presenter_) {
-    show_dropouts = worker_render_presenter_->getShowDropouts();
-    ORC_LOG_DEBUG("RenderCoordinator: Preserving show_dropouts={}",
-                  show_dropouts);
-  }
+  lane.dag = req.dag;
 
-  // Update DAG
-  worker_dag_ = req.dag;
+  // The background lane builds its presenter when first needed
+  if (!interactive && !lane.presenter) {
+    return;
+  }
 
   // Create or update render presenter
   try {
-    if (!worker_project_) {
+    void* project = worker_project_.load();
+    if (!project) {
       ORC_LOG_ERROR("RenderCoordinator: No project set for presenter");
       return;
     }
 
-    if (!worker_render_presenter_) {
-      worker_render_presenter_ = presenter_factory_(worker_project_);
+    if (!lane.presenter) {
+      auto presenter = presenter_factory_(project);
+      std::lock_guard<std::mutex> lock(lane.mutex);
+      lane.presenter = std::move(presenter);
     }
 
     // Set the new DAG (cast away const since setDAG signature uses non-const
     // void*)
-    worker_render_presenter_->setDAG(
-        std::const_pointer_cast<void>(worker_dag_));
+    lane.presenter->setDAG(std::const_pointer_cast<void>(lane.dag));
 
     // Restore show_dropouts state
-    worker_render_presenter_->setShowDropouts(show_dropouts);
+    const bool show_dropouts = show_dropouts_.load();
+    lane.presenter->setShowDropouts(show_dropouts);
     ORC_LOG_DEBUG("RenderCoordinator: Restored show_dropouts={}",
                   show_dropouts);
 
@@ -611,25 +807,114 @@ void RenderCoordinator::handleUpdateDAG(const UpdateDAGRequest& req) {
   }
 }
 
+orc::presenters::IRenderPresenter* RenderCoordinator::backgroundPresenter() {
+  if (background_.presenter || !background_.dag) {
+    return background_.presenter.get();
+  }
+
+  void* project = worker_project_.load();
+  if (!project) {
+    ORC_LOG_ERROR("RenderCoordinator: No project set for presenter");
+    return nullptr;
+  }
+
+  try {
+    auto presenter = presenter_factory_(project);
+    presenter->setDAG(std::const_pointer_cast<void>(background_.dag));
+    presenter->setShowDropouts(show_dropouts_.load());
+    std::lock_guard<std::mutex> lock(background_.mutex);
+    background_.presenter = std::move(presenter);
+  } catch (const std::exception& e) {
+    ORC_LOG_ERROR(
+        "RenderCoordinator: Failed to create background presenter: {}",
+        e.what());
+    return nullptr;
+  }
+
+  ORC_LOG_DEBUG("RenderCoordinator: Background lane presenter created");
+  return background_.presenter.get();
+}
+
+orc::presenters::IRenderPresenter::TriggerProgressCallback
+RenderCoordinator::cancellableProgress(
+    const RenderRequest& req, orc::presenters::IRenderPresenter* presenter,
+    orc::presenters::IRenderPresenter::TriggerProgressCallback progress) {
+  // triggerStage() clears the presenter's cancel flag as it starts, so a
+  // cancellation that raced the start is re-applied on the next report
+  return [cancelled = req.cancelled, presenter, progress = std::move(progress)](
+             int current, int total, const std::string& message) {
+    if (cancelled->load()) {
+      presenter->cancelTrigger();
+    }
+    progress(current, total, message);
+  };
+}
+
 void RenderCoordinator::handleRenderPreview(const RenderPreviewRequest& req) {
+  // Coalesce: while scrubbing, only the newest queued preview is rendered.
+  if (req.request_id != latest_preview_request_id_.load()) {
+    ORC_LOG_DEBUG(
+        "RenderCoordinator: Coalescing preview request {} (latest {})",
+        req.request_id, latest_preview_request_id_.load());
+    return;
+  }
+
   ORC_LOG_DEBUG(
       "RenderCoordinator: Rendering preview for node '{}', type {}, index {} "
       "(request {})",
       req.node_id.to_string(), static_cast<int>(req.output_type),
       req.output_index, req.request_id);
 
-  if (!worker_render_presenter_) {
+  if (!interactive_.presenter) {
     ORC_LOG_ERROR("RenderCoordinator: Render presenter not initialized");
     emit error(req.request_id, "Render presenter not initialized");
     return;
   }
 
+  const PreviewKey key{req.node_id, req.output_type, req.output_index,
+                       req.option_id, show_dropouts_.load()};
+
+  // This preview supersedes any draft still waiting to be refined.
+  pending_refine_.reset();
+
   try {
-    auto result = worker_render_presenter_->renderPreview(
-        req.node_id, req.output_type, req.output_index, req.option_id);
+    orc::PreviewRenderResult result;
+    bool draft = false;
+    if (auto cached = preview_cache_.get(key)) {
+      ORC_LOG_DEBUG("RenderCoordinator: Preview cache hit for index {}",
+                    req.output_index);
+      result = std::move(*cached);
+    } else {
+      // Abandon the render as soon as a newer preview is requested or this
+      // one is cancelled
+      const uint64_t request_id = req.request_id;
+      auto cancelled = [this, request_id, token = req.cancelled] {
+        return token->load() ||
+               request_id != latest_preview_request_id_.load() ||
+               shutdown_requested_.load();
+      };
+      std::optional<orc::PreviewRenderResult> draft_result;
+      if (draft_previews_.load()) {
+        draft_result = interactive_.presenter->renderDraftPreview(
+            req.node_id, req.output_type, req.output_index, cancelled);
+      }
+      if (draft_result) {
+        // Drafts are not cached; the refinement caches the full render
+        draft = true;
+        result = std::move(*draft_result);
+      } else {
+        result = interactive_.presenter->renderPreview(
+            req.node_id, req.output_type, req.output_index, req.option_id,
+            cancelled);
+        if (result.success) {
+          preview_cache_.put(key, result);
+        }
+      }
+    }
 
     // Drop stale preview responses when a newer preview request exists.
-    if (req.request_id != latest_preview_request_id_.load()) {
+    if (req.request_id != latest_preview_request_id_.load() ||
+        req.cancelled->load()) {
       ORC_LOG_DEBUG(
           "RenderCoordinator: Dropping stale preview response {} (latest {})",
           req.request_id, latest_preview_request_id_.load());
@@ -643,9 +928,20 @@ void RenderCoordinator::handleRenderPreview(const RenderPreviewRequest& req) {
     ORC_LOG_DEBUG("RenderCoordinator: Preview render complete, success={}",
                   result.success);
 
+    const bool rendered = result.success;
+
     // Emit result on GUI thread
     emit previewReady(req.request_id, std::move(result));
 
+    if (rendered) {
+      if (draft) {
+        pending_refine_ = PendingRefine{
+            key, req.request_id, req.cancelled,
+            std::chrono::steady_clock::now() + kRefineDelay};
+      }
+      schedulePrefetch(key);
+    }
+
   } catch (const std::exception& e) {
     if (req.request_id != latest_preview_request_id_.load()) {
       ORC_LOG_DEBUG(
@@ -658,20 +954,134 @@ void RenderCoordinator::handleRenderPreview(const RenderPreviewRequest& req) {
   }
 }
 
+void RenderCoordinator::schedulePrefetch(const PreviewKey& key) {
+  // Infer the scrub direction from the previous preview of the same output;
+  // a repeated index keeps the current direction.
+  if (last_preview_key_ && last_preview_key_->node_id == key.node_id &&
+      last_preview_key_->output_type == key.output_type &&
+      last_preview_key_->option_id == key.option_id &&
+      last_preview_key_->output_index != key.output_index) {
+    scrub_direction_ =
+        key.output_index > last_preview_key_->output_index ? 1 : -1;
+  }
+  last_preview_key_ = key;
+
+  prefetch_queue_.clear();
+  const size_t depth = prefetch_depth_.load();
+  for (size_t step = 1; step <= depth; ++step) {
+    if (scrub_direction_ < 0 && key.output_index < step) {
+      break;
+    }
+    PreviewKey next = key;
+    next.output_index = scrub_direction_ > 0 ? key.output_index + step
+                                             : key.output_index - step;
+    if (!preview_cache_.contains(next)) {
+      prefetch_queue_.push_back(std::move(next));
+    }
+  }
+}
+
+void RenderCoordinator::runPrefetchStep() {
+  if (prefetch_queue_.empty()) {
+    return;
+  }
+  PreviewKey key = std::move(prefetch_queue_.front());
+  prefetch_queue_.pop_front();
+
+  // A dropout toggle since scheduling makes the whole run irrelevant
+  if (!interactive_.presenter || key.show_dropouts != show_dropouts_.load()) {
+    prefetch_queue_.clear();
+    return;
+  }
+  if (preview_cache_.contains(key)) {
+    return;
+  }
+
+  auto cancelled = [this] {
+    return shutdown_requested_.load() || hasPendingRequest();
+  };
+  try {
+    auto result = interactive_.presenter->renderPreview(
+        key.node_id, key.output_type, key.output_index, key.option_id,
+        cancelled);
+    if (result.success) {
+      preview_cache_.put(key, std::move(result));
+    } else if (cancelled()) {
+      // Resume after the request unless it schedules a new run
+      prefetch_queue_.push_front(std::move(key));
+    } else {
+      // Past the last output, or a render error: stop this run
+      prefetch_queue_.clear();
+    }
+  } catch (const std::exception& e) {
+    ORC_LOG_DEBUG("RenderCoordinator: Prefetch of index {} failed: {}",
+                  key.output_index, e.what());
+    prefetch_queue_.clear();
+  }
+}
+
+void RenderCoordinator::runRefineStep() {
+  PendingRefine refine = std::move(*pending_refine_);
+  pending_refine_.reset();
+
+  const uint64_t request_id = refine.request_id;
+  if (!interactive_.presenter || refine.cancelled->load() ||
+      request_id != latest_preview_request_id_.load() ||
+      refine.key.show_dropouts != show_dropouts_.load()) {
+    return;
+  }
+
+  auto cancelled = [this, request_id, token = refine.cancelled] {
+    return token->load() || request_id != latest_preview_request_id_.load() ||
+           shutdown_requested_.load() || hasPendingRequest();
+  };
+  try {
+    auto result = interactive_.presenter->renderPreview(
+        refine.key.node_id, refine.key.output_type, refine.key.output_index,
+        refine.key.option_id, cancelled);
+    if (result.success) {
+      preview_cache_.put(refine.key, result);
+      if (request_id == latest_preview_request_id_.load() &&
+          !refine.cancelled->load()) {
+        ORC_LOG_DEBUG("RenderCoordinator: Refined draft preview {}",
+                      request_id);
+        emit previewReady(request_id, std::move(result));
+      }
+    } else if (cancelled() && !refine.cancelled->load() &&
+               request_id == latest_preview_request_id_.load() &&
+               !shutdown_requested_.load()) {
+      // Another request arrived; resume once it has been served
+      refine.due = std::chrono::steady_clock::now();
+      pending_refine_ = std::move(refine);
+    } else if (!result.error_message.empty()) {
+      ORC_LOG_ERROR("RenderCoordinator: Preview refinement failed: {}",
+                    result.error_message);
+    }
+  } catch (const std::exception& e) {
+    ORC_LOG_ERROR("RenderCoordinator: Preview refinement failed: {}",
+                  e.what());
+  }
+}
+
+bool RenderCoordinator::hasPendingRequest() {
+  std::lock_guard<std::mutex> lock(interactive_.mutex);
+  return !interactive_.queue.empty();
+}
+
 void RenderCoordinator::handleGetVBIData(const GetVBIDataRequest& req) {
   ORC_LOG_DEBUG(
       "RenderCoordinator: Getting VBI data for node '{}', field {} (request "
       "{})",
       req.node_id.to_string(), req.field_id.value(), req.request_id);
 
-  if (!worker_render_presenter_) {
+  if (!interactive_.presenter) {
     emit vbiDataReady(req.request_id, orc::presenters::VBIFieldInfoView{});
     return;
   }
 
   try {
     auto vbi_info_opt =
-        worker_render_presenter_->getVBIData(req.node_id, req.field_id);
+        interactive_.presenter->getVBIData(req.node_id, req.field_id);
 
     if (vbi_info_opt.has_value()) {
       // Return the fully decoded VBI info directly
@@ -694,7 +1104,8 @@ void RenderCoordinator::handleGetDropoutData(const GetDropoutDataRequest& req) {
       req.node_id.to_string(), static_cast<int>(req.mode), req.request_id);
 
   try {
-    if (!worker_render_presenter_) {
+    auto* presenter = backgroundPresenter();
+    if (!presenter) {
       emit error(req.request_id, "Render presenter not initialized");
       return;
     }
@@ -703,23 +1114,31 @@ void RenderCoordinator::handleGetDropoutData(const GetDropoutDataRequest& req) {
     std::vector<void*> data_ptr;
     int32_t total_frames = 0;
 
-    if (!worker_render_presenter_->getDropoutAnalysisData(req.node_id, data_ptr,
-                                                          total_frames)) {
+    if (!presenter->getDropoutAnalysisData(req.node_id, data_ptr,
+                                           total_frames)) {
       // Stage has not been triggered yet — trigger it now so the data is
       // available.
       ORC_LOG_DEBUG(
           "RenderCoordinator: Dropout stage has no results, triggering now "
           "(request {})",
           req.request_id);
-      worker_render_presenter_->triggerStage(
-          req.node_id,
+      auto progress_cb = withPartialResults<orc::FrameDropoutStats>(
           [this](int current, int total, const std::string& message) {
             emit dropoutProgress(static_cast<size_t>(current),
                                  static_cast<size_t>(total),
                                  QString::fromStdString(message));
+          },
+          [presenter, &req](std::vector<void*>& ptr, int32_t& frames) {
+            return presenter->getDropoutAnalysisData(req.node_id, ptr, frames);
+          },
+          [this, &req](const std::vector<orc::FrameDropoutStats>& stats,
+                       int32_t frames) {
+            emit dropoutPartialDataReady(req.request_id, stats, frames);
           });
-      if (!worker_render_presenter_->getDropoutAnalysisData(
-              req.node_id, data_ptr, total_frames)) {
+      presenter->triggerStage(req.node_id,
+                              cancellableProgress(req, presenter, progress_cb));
+      if (!presenter->getDropoutAnalysisData(req.node_id, data_ptr,
+                                             total_frames)) {
         emit error(req.request_id,
                    "Failed to get dropout data - node may not be a "
                    "DropoutAnalysisSinkStage or trigger failed");
@@ -756,7 +1175,8 @@ void RenderCoordinator::handleGetSNRData(const GetSNRDataRequest& req) {
       req.node_id.to_string(), static_cast<int>(req.mode), req.request_id);
 
   try {
-    if (!worker_render_presenter_) {
+    auto* presenter = backgroundPresenter();
+    if (!presenter) {
       emit error(req.request_id, "Render presenter not initialized");
       return;
     }
@@ -765,23 +1185,30 @@ void RenderCoordinator::handleGetSNRData(const GetSNRDataRequest& req) {
     std::vector<void*> data_ptr;
     int32_t total_frames = 0;
 
-    if (!worker_render_presenter_->getSNRAnalysisData(req.node_id, data_ptr,
-                                                      total_frames)) {
+    if (!presenter->getSNRAnalysisData(req.node_id, data_ptr, total_frames)) {
       // Stage has not been triggered yet — trigger it now so the data is
       // available.
       ORC_LOG_DEBUG(
           "RenderCoordinator: SNR stage has no results, triggering now "
           "(request {})",
           req.request_id);
-      auto progress_cb = [this](int current, int total,
-                                const std::string& message) {
-        emit snrProgress(static_cast<size_t>(current),
-                         static_cast<size_t>(total),
-                         QString::fromStdString(message));
-      };
-      worker_render_presenter_->triggerStage(req.node_id, progress_cb);
-      if (!worker_render_presenter_->getSNRAnalysisData(req.node_id, data_ptr,
-                                                        total_frames)) {
+      auto progress_cb = withPartialResults<orc::FrameSNRStats>(
+          [this](int current, int total, const std::string& message) {
+            emit snrProgress(static_cast<size_t>(current),
+                             static_cast<size_t>(total),
+                             QString::fromStdString(message));
+          },
+          [presenter, &req](std::vector<void*>& ptr, int32_t& frames) {
+            return presenter->getSNRAnalysisData(req.node_id, ptr, frames);
+          },
+          [this, &req](const std::vector<orc::FrameSNRStats>& stats,
+                       int32_t frames) {
+            emit snrPartialDataReady(req.request_id, stats, frames);
+          });
+      presenter->triggerStage(req.node_id,
+                              cancellableProgress(req, presenter, progress_cb));
+      if (!presenter->getSNRAnalysisData(req.node_id, data_ptr,
+                                         total_frames)) {
         emit error(req.request_id,
                    "Failed to get SNR data - node may not be a "
                    "SNRAnalysisSinkStage or trigger failed");
@@ -817,7 +1244,8 @@ void RenderCoordinator::handleGetBurstLevelData(
       req.node_id.to_string(), req.request_id);
 
   try {
-    if (!worker_render_presenter_) {
+    auto* presenter = backgroundPresenter();
+    if (!presenter) {
       emit error(req.request_id, "Render presenter not initialized");
       return;
     }
@@ -826,23 +1254,32 @@ void RenderCoordinator::handleGetBurstLevelData(
     std::vector<void*> data_ptr;
     int32_t total_frames = 0;
 
-    if (!worker_render_presenter_->getBurstLevelAnalysisData(
-            req.node_id, data_ptr, total_frames)) {
+    if (!presenter->getBurstLevelAnalysisData(req.node_id, data_ptr,
+                                              total_frames)) {
       // Stage has not been triggered yet — trigger it now so the data is
       // available.
       ORC_LOG_DEBUG(
           "RenderCoordinator: Burst level stage has no results, triggering now "
           "(request {})",
           req.request_id);
-      auto progress_cb = [this](int current, int total,
-                                const std::string& message) {
-        emit burstLevelProgress(static_cast<size_t>(current),
-                                static_cast<size_t>(total),
-                                QString::fromStdString(message));
-      };
-      worker_render_presenter_->triggerStage(req.node_id, progress_cb);
-      if (!worker_render_presenter_->getBurstLevelAnalysisData(
-              req.node_id, data_ptr, total_frames)) {
+      auto progress_cb = withPartialResults<orc::FrameBurstLevelStats>(
+          [this](int current, int total, const std::string& message) {
+            emit burstLevelProgress(static_cast<size_t>(current),
+                                    static_cast<size_t>(total),
+                                    QString::fromStdString(message));
+          },
+          [presenter, &req](std::vector<void*>& ptr, int32_t& frames) {
+            return presenter->getBurstLevelAnalysisData(req.node_id, ptr,
+                                                        frames);
+          },
+          [this, &req](const std::vector<orc::FrameBurstLevelStats>& stats,
+                       int32_t frames) {
+            emit burstLevelPartialDataReady(req.request_id, stats, frames);
+          });
+      presenter->triggerStage(req.node_id,
+                              cancellableProgress(req, presenter, progress_cb));
+      if (!presenter->getBurstLevelAnalysisData(req.node_id, data_ptr,
+                                                total_frames)) {
         emit error(req.request_id,
                    "Failed to get burst data - node may not be a "
                    "BurstLevelAnalysisSinkStage or trigger failed");
@@ -878,14 +1315,14 @@ void RenderCoordinator::handleGetAvailableOutputs(
       "RenderCoordinator: Getting available outputs for node '{}' (request {})",
       req.node_id.to_string(), req.request_id);
 
-  if (!worker_render_presenter_) {
+  if (!interactive_.presenter) {
     ORC_LOG_ERROR("RenderCoordinator: Render presenter not initialized");
     emit error(req.request_id, "Render presenter not initialized");
     return;
   }
 
   try {
-    auto outputs = worker_render_presenter_->getAvailableOutputs(req.node_id);
+    auto outputs = interactive_.presenter->getAvailableOutputs(req.node_id);
 
     ORC_LOG_DEBUG("RenderCoordinator: Found {} available outputs",
                   outputs.size());
@@ -906,7 +1343,7 @@ void RenderCoordinator::handleGetLineSamples(const GetLineSamplesRequest& req) {
       "{})",
       req.node_id.to_string(), req.line_number, req.request_id);
 
-  if (!worker_render_presenter_) {
+  if (!interactive_.presenter) {
     ORC_LOG_ERROR("RenderCoordinator: Render presenter not initialized");
     emit error(req.request_id, "Render presenter not initialized");
     return;
@@ -914,7 +1351,7 @@ void RenderCoordinator::handleGetLineSamples(const GetLineSamplesRequest& req) {
 
   try {
     // Get line samples with Y/C separation if available
-    auto sample_data = worker_render_presenter_->getLineSamplesWithYC(
+    auto sample_data = interactive_.presenter->getLineSamplesWithYC(
         req.node_id, req.output_type, req.output_index, req.line_number,
         req.sample_x, req.preview_image_width);
 
@@ -931,7 +1368,7 @@ void RenderCoordinator::handleGetLineSamples(const GetLineSamplesRequest& req) {
 
     // Get video parameters from the representation
     auto video_params =
-        worker_render_presenter_->getVideoParameters(req.node_id);
+        interactive_.presenter->getVideoParameters(req.node_id);
 
     // Emit samples with Y/C separation when available
     if (sample_data.has_separate_channels) {
@@ -961,7 +1398,7 @@ void RenderCoordinator::handleGetFrameTiming(const GetFrameTimingRequest& req) {
       "(request {})",
       req.node_id.to_string(), req.output_index, req.request_id);
 
-  if (!worker_render_presenter_) {
+  if (!interactive_.presenter) {
     ORC_LOG_ERROR("RenderCoordinator: Render presenter not initialized");
     emit error(req.request_id, "Render presenter not initialized");
     return;
@@ -969,7 +1406,7 @@ void RenderCoordinator::handleGetFrameTiming(const GetFrameTimingRequest& req) {
 
   try {
     // Get field samples for timing view
-    auto sample_data = worker_render_presenter_->getFieldSamplesForTiming(
+    auto sample_data = interactive_.presenter->getFieldSamplesForTiming(
         req.node_id, req.output_type, req.output_index);
 
     if (sample_data.composite_samples.empty() &&
@@ -1031,14 +1468,14 @@ void RenderCoordinator::handleGetWaveformMonitor(
       "{} (request {})",
       req.node_id.to_string(), req.output_index, req.request_id);
 
-  if (!worker_render_presenter_) {
+  if (!interactive_.presenter) {
     ORC_LOG_ERROR("RenderCoordinator: Render presenter not initialized");
     emit error(req.request_id, "Render presenter not initialized");
     return;
   }
 
   try {
-    auto sample_data = worker_render_presenter_->getFieldSamplesForTiming(
+    auto sample_data = interactive_.presenter->getFieldSamplesForTiming(
         req.node_id, req.output_type, req.output_index);
 
     if (sample_data.composite_samples.empty() &&
@@ -1077,7 +1514,7 @@ void RenderCoordinator::handleNavigateFrameLine(
       req.node_id.to_string(), req.current_field, req.current_line,
       req.direction, req.request_id);
 
-  if (!worker_render_presenter_) {
+  if (!interactive_.presenter) {
     ORC_LOG_ERROR("RenderCoordinator: Render presenter not initialized");
     emit error(req.request_id, "Render presenter not initialized");
     return;
@@ -1085,7 +1522,7 @@ void RenderCoordinator::handleNavigateFrameLine(
 
   try {
     // Use the render presenter's method to navigate
-    auto result = worker_render_presenter_->navigateFrameLine(
+    auto result = interactive_.presenter->navigateFrameLine(
         req.node_id, req.output_type, req.current_field, req.current_line,
         req.direction, req.field_height);
 
@@ -1103,7 +1540,8 @@ void RenderCoordinator::handleTriggerStage(const TriggerStageRequest& req) {
   ORC_LOG_DEBUG("RenderCoordinator: Triggering stage '{}' (request {})",
                 req.node_id.to_string(), req.request_id);
 
-  if (!worker_render_presenter_) {
+  auto* presenter = backgroundPresenter();
+  if (!presenter) {
     ORC_LOG_ERROR("RenderCoordinator: Render presenter not initialized");
     emit error(req.request_id, "Render presenter not initialized");
     emit triggerComplete(req.request_id, false,
@@ -1114,12 +1552,15 @@ void RenderCoordinator::handleTriggerStage(const TriggerStageRequest& req) {
   try {
     // Use RenderPresenter to handle triggering
     // The presenter abstracts all DAG access and stage interaction
-    worker_render_presenter_->triggerStage(
+    presenter->triggerStage(
         req.node_id,
-        [this](int current, int total, const std::string& message) {
-          // Emit progress updates (Qt will queue to GUI thread)
-          emit triggerProgress(current, total, QString::fromStdString(message));
-        });
+        cancellableProgress(
+            req, presenter,
+            [this](int current, int total, const std::string& message) {
+              // Emit progress updates (Qt will queue to GUI thread)
+              emit triggerProgress(current, total,
+                                   QString::fromStdString(message));
+            }));
 
     ORC_LOG_DEBUG("RenderCoordinator: Trigger complete successfully");
     emit triggerComplete(req.request_id, true,
@@ -1134,10 +1575,14 @@ void RenderCoordinator::handleTriggerStage(const TriggerStageRequest& req) {
 }
 
 void RenderCoordinator::setShowDropouts(bool show) {
-  if (worker_render_presenter_) {
-    worker_render_presenter_->setShowDropouts(show);
-    ORC_LOG_DEBUG("RenderCoordinator: Show dropouts set to {}", show);
+  show_dropouts_.store(show);
+  for (WorkerLane* lane : {&interactive_, &background_}) {
+    std::lock_guard<std::mutex> lock(lane->mutex);
+    if (lane->presenter) {
+      lane->presenter->setShowDropouts(show);
+    }
   }
+  ORC_LOG_DEBUG("RenderCoordinator: Show dropouts set to {}", show);
 }
 
 void RenderCoordinator::handleSavePNG(const SavePNGRequest& req) {
@@ -1146,7 +1591,7 @@ void RenderCoordinator::handleSavePNG(const SavePNGRequest& req) {
       req.node_id.to_string(), static_cast<int>(req.output_type),
       req.output_index, req.filename);
 
-  if (!worker_render_presenter_) {
+  if (!interactive_.presenter) {
     ORC_LOG_ERROR("RenderCoordinator: Render presenter not initialized");
     emit error(req.request_id, "Render presenter not initialized");
     return;
@@ -1154,7 +1599,7 @@ void RenderCoordinator::handleSavePNG(const SavePNGRequest& req) {
 
   try {
     // Use presenter's PNG save functionality
-    bool success = worker_render_presenter_->savePNG(
+    bool success = interactive_.presenter->savePNG(
         req.node_id, req.output_type, req.output_index, req.filename,
         req.option_id, req.aspect_correction);
 
@@ -5,8 +5,10 @@
  * presenters
  *
  * This class implements an Actor Model pattern where rendering state
- * is owned by a single worker thread. The GUI thread sends requests via
- * a thread-safe queue and receives responses via Qt signals.
+ * is owned by worker lanes: an interactive lane for previews and queries
+ * and a background lane for analyses and triggers, each a thread with its
+ * own request queue and presenter. The GUI thread sends requests via
+ * thread-safe queues and receives responses via Qt signals.
  *
  * SPDX-License-Identifier: GPL-3.0-or-later
  * SPDX-FileCopyrightText: 2025-2026 Simon Inns
@@ -21,17 +23,20 @@
 #include <orc/stage/orc_source_parameters.h>   // Public API VideoParameters
 #include <orc/stage/params/parameter_types.h>  // ParameterValue
 #include <orc/stage/preview/orc_rendering.h>  // Public API rendering types (includes mapping result types)
+#include <orc/support/lru_cache.h>
 #include <orc_preview_views.h>
 
 #include <QObject>
 #include <QString>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <optional>
 #include <string>
 #include <thread>
 
@@ -72,6 +77,9 @@ enum class RenderRequestType {
 struct RenderRequest {
   RenderRequestType type;
   uint64_t request_id;  // Unique ID to match responses
+  // Set by RenderCoordinator::cancelRequest(); shared with cancel checks
+  std::shared_ptr<std::atomic<bool>> cancelled =
+      std::make_shared<std::atomic<bool>>(false);
 
   virtual ~RenderRequest() = default;
 
@@ -422,9 +430,16 @@ class IRenderPresenter {
   virtual bool getShowDropouts() const = 0;
   virtual void setShowDropouts(bool show) = 0;
 
+  // cancel_check may be null; when it returns true the render is abandoned
+  // and an unsuccessful result is returned.
   virtual orc::PreviewRenderResult renderPreview(
       NodeID node_id, orc::PreviewOutputType output_type, uint64_t output_index,
-      const std::string& option_id) = 0;
+      const std::string& option_id, std::function<bool()> cancel_check) = 0;
+  // Fast reduced-quality preview for interactive navigation; std::nullopt
+  // when the node has no draft for this output.
+  virtual std::optional<orc::PreviewRenderResult> renderDraftPreview(
+      NodeID node_id, orc::PreviewOutputType output_type, uint64_t output_index,
+      std::function<bool()> cancel_check) = 0;
 
   virtual std::optional<VBIFieldInfoView> getVBIData(NodeID node_id,
                                                      FieldID field_id) = 0;
@@ -490,21 +505,28 @@ class IRenderPresenter {
 }  // namespace orc::presenters
 
 /**
- * @brief Coordinator that owns all core rendering state in a worker thread
+ * @brief Coordinator that owns all core rendering state in worker lanes
  *
  * Architecture:
- * - Worker thread owns: DAG, PreviewRenderer, DAGFrameRenderer, all decoders
- * - GUI thread sends requests via thread-safe queue
- * - Worker thread processes requests serially (no races possible)
+ * - Two worker lanes, each a thread with its own request queue and its own
+ *   presenter (PreviewRenderer, DAGFrameRenderer, decoders) over the shared
+ *   DAG snapshot
+ * - Interactive lane: previews, sample queries, PNG export, plus speculative
+ *   prefetch and draft refinement when idle
+ * - Background lane: dropout/SNR/burst analyses and stage triggers, so a
+ *   long analysis never delays a preview; its presenter is created on first
+ *   use
+ * - Each lane processes its own requests serially
  * - Responses sent back via Qt signals (thread-safe)
  *
  * Thread Safety:
  * - ALL public methods are thread-safe (called from GUI thread)
- * - Worker thread methods are private and run on worker thread only
- * - No shared mutable state between threads
+ * - Worker methods are private and run on the lane that owns the request
+ * - Lane state is owned by its thread; queues and presenter handles are
+ *   guarded by the lane mutex
  */
 // Thread-safe: all public methods are safe to call from the GUI thread;
-// worker-thread state is fully private.
+// lane state is private to its worker thread.
 class RenderCoordinator : public QObject {
   Q_OBJECT
 
@@ -762,6 +784,17 @@ class RenderCoordinator : public QObject {
    */
   void cancelTrigger();
 
+  /**
+   * @brief Cancel a request by ID (thread-safe)
+   *
+   * A queued request is dropped when it reaches the front of its lane; a
+   * preview in flight is abandoned, and an analysis or trigger in flight is
+   * asked to stop. Cancelled triggers complete with success=false; other
+   * cancelled non-preview requests emit error(). Unknown or finished IDs are
+   * ignored.
+   */
+  void cancelRequest(uint64_t request_id);
+
   /**
    * @brief Set whether to render dropout regions onto images
    *
@@ -771,6 +804,27 @@ class RenderCoordinator : public QObject {
    */
   void setShowDropouts(bool show);
 
+  /**
+   * @brief Set how many previews are rendered ahead while scrubbing
+   *
+   * After each preview the worker renders up to @p depth further outputs in
+   * the direction of travel into a small preview cache whenever it has no
+   * other request to serve, so stepping to the next frame is a cache hit.
+   * 0 disables prefetching. Thread-safe.
+   */
+  void setPrefetchDepth(size_t depth);
+
+  /**
+   * @brief Set whether previews are drafted while navigating
+   *
+   * When enabled, a preview of a node that offers a draft (a fast,
+   * reduced-quality colour decode) is first rendered and emitted as a draft.
+   * Once no other preview has been requested for a short settle delay, the
+   * worker renders it at full quality and emits previewReady again with the
+   * same request ID to replace the draft. Enabled by default. Thread-safe.
+   */
+  void setDraftPreviews(bool enabled);
+
  signals:
   /**
    * @brief Emitted when a preview render completes
@@ -793,6 +847,16 @@ class RenderCoordinator : public QObject {
                         std::vector<orc::FrameDropoutStats> frame_stats,
                         int32_t total_frames);
 
+  /**
+   * @brief Emitted with each partial dataset while a dropout analysis runs
+   *
+   * Carries the coarse overview and then each refinement snapshot, under the
+   * request ID that dropoutDataReady() will complete.
+   */
+  void dropoutPartialDataReady(uint64_t request_id,
+                               std::vector<orc::FrameDropoutStats> frame_stats,
+                               int32_t total_frames);
+
   /**
    * @brief Emitted during dropout analysis progress
    */
@@ -805,6 +869,13 @@ class RenderCoordinator : public QObject {
                     std::vector<orc::FrameSNRStats> frame_stats,
                     int32_t total_frames);
 
+  /**
+   * @brief Emitted with each partial dataset while an SNR analysis runs
+   */
+  void snrPartialDataReady(uint64_t request_id,
+                           std::vector<orc::FrameSNRStats> frame_stats,
+                           int32_t total_frames);
+
   /**
    * @brief Emitted during SNR analysis progress
    */
@@ -817,6 +888,14 @@ class RenderCoordinator : public QObject {
                            std::vector<orc::FrameBurstLevelStats> frame_stats,
                            int32_t total_frames);
 
+  /**
+   * @brief Emitted with each partial dataset while a burst level analysis
+   * runs
+   */
+  void burstLevelPartialDataReady(
+      uint64_t request_id, std::vector<orc::FrameBurstLevelStats> frame_stats,
+      int32_t total_frames);
+
   /**
    * @brief Emitted during burst level analysis progress
    */
@@ -887,26 +966,124 @@ class RenderCoordinator : public QObject {
   // Worker thread methods (run on worker thread only)
   // ========================================================================
 
+  /// A worker thread with its own request queue and presenter.
+  struct WorkerLane {
+    const char* name;
+    std::thread thread;
+
+    std::mutex mutex;  // guards queue, in_flight and presenter
+    std::condition_variable cv;
+    std::deque<std::unique_ptr<RenderRequest>> queue;
+    const RenderRequest* in_flight{nullptr};
+
+    // Written only by the lane thread
+    std::shared_ptr<const void> dag;
+    std::shared_ptr<orc::presenters::IRenderPresenter> presenter;
+
+    explicit WorkerLane(const char* lane_name) : name(lane_name) {}
+  };
+
+  /**
+   * @brief Main loop of a worker lane
+   */
+  void workerLoop(WorkerLane& lane);
+
   /**
-   * @brief Main worker thread loop
+   * @brief Lane that serves requests of @p type
    */
-  void workerLoop();
+  WorkerLane& laneFor(RenderRequestType type);
 
   /**
-   * @brief Process a single request
+   * @brief Process a single request on the lane that owns it
    */
-  void processRequest(std::unique_ptr<RenderRequest> request);
+  void processRequest(WorkerLane& lane, const RenderRequest& request);
+
+  /**
+   * @brief Report a request cancelled before it started
+   */
+  void reportCancelled(const RenderRequest& request);
 
   /**
    * @brief Handle UpdateDAG request
+   *
+   * The interactive lane rebuilds its presenter at once; the background lane
+   * only records the DAG until it needs a presenter.
+   */
+  void handleUpdateDAG(WorkerLane& lane, const UpdateDAGRequest& req);
+
+  /**
+   * @brief Background lane presenter, created on first use
+   */
+  orc::presenters::IRenderPresenter* backgroundPresenter();
+
+  /**
+   * @brief Wrap a trigger progress callback so that cancelling @p req stops
+   * the trigger running on @p presenter
    */
-  void handleUpdateDAG(const UpdateDAGRequest& req);
+  static orc::presenters::IRenderPresenter::TriggerProgressCallback
+  cancellableProgress(
+      const RenderRequest& req, orc::presenters::IRenderPresenter* presenter,
+      orc::presenters::IRenderPresenter::TriggerProgressCallback progress);
 
   /**
    * @brief Handle RenderPreview request
    */
   void handleRenderPreview(const RenderPreviewRequest& req);
 
+  /// Identity of a rendered preview, including the state that alters it.
+  struct PreviewKey {
+    orc::NodeID node_id;
+    orc::PreviewOutputType output_type;
+    uint64_t output_index;
+    std::string option_id;
+    bool show_dropouts;
+
+    bool operator==(const PreviewKey& o) const {
+      return output_index == o.output_index && node_id == o.node_id &&
+             output_type == o.output_type && option_id == o.option_id &&
+             show_dropouts == o.show_dropouts;
+    }
+  };
+
+  struct PreviewKeyHash {
+    std::size_t operator()(const PreviewKey& k) const noexcept {
+      std::size_t h1 = std::hash<orc::NodeID>{}(k.node_id);
+      std::size_t h2 = std::hash<uint64_t>{}(k.output_index);
+      std::size_t h3 = std::hash<std::string>{}(k.option_id);
+      return h1 ^ (h2 << 1) ^ (h3 << 2) ^
+             (static_cast<std::size_t>(k.output_type) << 3) ^
+             static_cast<std::size_t>(k.show_dropouts);
+    }
+  };
+
+  /**
+   * @brief Queue speculative renders following @p key in the scrub direction
+   */
+  void schedulePrefetch(const PreviewKey& key);
+
+  /**
+   * @brief Render the next queued prefetch into the preview cache
+   *
+   * Called only when the request queue is empty; the render is cancelled as
+   * soon as a request arrives.
+   */
+  void runPrefetchStep();
+
+  /**
+   * @brief Render the pending refinement of a draft preview at full quality
+   *
+   * Called once the settle delay has passed with no request waiting; the
+   * render is cancelled as soon as a request arrives and resumed after it
+   * unless that request was a newer preview.
+   */
+  void runRefineStep();
+
+  /**
+   * @brief True when a request is waiting in the interactive lane
+   * (thread-safe)
+   */
+  bool hasPendingRequest();
+
   /**
    * @brief Handle GetVBIData request
    */
@@ -960,7 +1137,7 @@ class RenderCoordinator : public QObject {
   void handleTriggerStage(const TriggerStageRequest& req);
 
   /**
-   * @brief Enqueue a request (thread-safe)
+   * @brief Enqueue a request on the lane that serves it (thread-safe)
    */
   void enqueueRequest(std::unique_ptr<RenderRequest> request);
 
@@ -973,24 +1150,46 @@ class RenderCoordinator : public QObject {
   // Thread synchronization
   // ========================================================================
 
-  std::thread worker_thread_;
   std::atomic<bool> shutdown_requested_{false};
 
-  std::mutex queue_mutex_;
-  std::condition_variable queue_cv_;
-  std::queue<std::unique_ptr<RenderRequest>> request_queue_;
+  WorkerLane interactive_{"interactive"};
+  WorkerLane background_{"background"};
 
   std::atomic<uint64_t> next_request_id_{1};
   std::atomic<uint64_t> latest_preview_request_id_{0};
 
+  static constexpr size_t kDefaultPrefetchDepth = 4;
+  static constexpr size_t kPreviewCacheSize = 16;
+  std::atomic<size_t> prefetch_depth_{kDefaultPrefetchDepth};
+  // Quiet period after a draft before it is refined; long enough to span the
+  // gap between requests while scrubbing.
+  static constexpr std::chrono::milliseconds kRefineDelay{150};
+  std::atomic<bool> draft_previews_{true};
+  std::atomic<bool> show_dropouts_{false};
+
+  // Non-owning opaque handle for lane presenters
+  std::atomic<void*> worker_project_{nullptr};
+  RenderPresenterFactory presenter_factory_;
+
   // ========================================================================
-  // Worker thread state (owned by worker thread, never accessed from GUI)
+  // Interactive lane state (owned by its thread, never accessed from GUI)
   // ========================================================================
 
-  std::shared_ptr<const void> worker_dag_;
-  std::shared_ptr<orc::presenters::IRenderPresenter> worker_render_presenter_;
-  void* worker_project_{nullptr};  // Non-owning opaque handle for presenter
-  RenderPresenterFactory presenter_factory_;
+  // Rendered previews, both requested and prefetched; cleared with the DAG
+  orc::LRUCache<PreviewKey, orc::PreviewRenderResult, PreviewKeyHash>
+      preview_cache_{kPreviewCacheSize};
+  std::deque<PreviewKey> prefetch_queue_;
+  std::optional<PreviewKey> last_preview_key_;
+
+  // Draft preview awaiting its full-quality render; runs before prefetches
+  struct PendingRefine {
+    PreviewKey key;
+    uint64_t request_id;
+    std::shared_ptr<std::atomic<bool>> cancelled;
+    std::chrono::steady_clock::time_point due;
+  };
+  std::optional<PendingRefine> pending_refine_;
+  int scrub_direction_{1};  // +1 forwards, -1 backwards
 
   // Phase 2.7: Trigger state now managed by RenderPresenter
   // Removed: trigger_cancel_requested_ and current_trigger_stage_
@@ -0,0 +1,253 @@
+/*
+ * File:        waveform_histogram.cpp
+ * Module:      orc-gui
+ * Purpose:     Waveform monitor density histogram and raster kernel
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "waveform_histogram.h"
+
+#include <amplitude_conversion.h>
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ORC_WAVEFORM_HISTOGRAM_SSE2 1
+#endif
+
+namespace orc::gui {
+
+namespace {
+
+// bins[x] = trunc(src[x] * scale + offset): the millivolt bin of each sample
+// of one line, truncated toward zero like the scalar conversion it replaces.
+// Out-of-range results are rejected by the caller's unsigned bounds check.
+void bin_line(const int16_t* src, size_t count, float scale, float offset,
+              int32_t* bins) {
+  size_t x = 0;
+#if defined(ORC_WAVEFORM_HISTOGRAM_SSE2)
+  const __m128 s = _mm_set1_ps(scale);
+  const __m128 o = _mm_set1_ps(offset);
+  for (; x + 8 <= count; x += 8) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+    // Sign-extend the eight int16 samples to two vectors of int32.
+    const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+    const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+    const __m128 flo = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(lo), s), o);
+    const __m128 fhi = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(hi), s), o);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bins + x),
+                     _mm_cvttps_epi32(flo));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bins + x + 4),
+                     _mm_cvttps_epi32(fhi));
+  }
+#endif
+  for (; x < count; ++x) {
+    bins[x] = static_cast<int32_t>(static_cast<float>(src[x]) * scale + offset);
+  }
+}
+
+// counts[i] *= decay, flushing results below WaveformHistogram::kVisibleCount
+// to zero.
+void decay_counts(float* counts, size_t count, float decay) {
+  const float floor = WaveformHistogram::kVisibleCount;
+  size_t i = 0;
+#if defined(ORC_WAVEFORM_HISTOGRAM_SSE2)
+  const __m128 d = _mm_set1_ps(decay);
+  const __m128 f = _mm_set1_ps(floor);
+  for (; i + 4 <= count; i += 4) {
+    const __m128 v = _mm_mul_ps(_mm_loadu_ps(counts + i), d);
+    _mm_storeu_ps(counts + i, _mm_and_ps(_mm_cmpge_ps(v, f), v));
+  }
+#endif
+  for (; i < count; ++i) {
+    const float v = counts[i] * decay;
+    counts[i] = v >= floor ? v : 0.0f;
+  }
+}
+
+// acc[i] = max(acc[i], row[i])
+void max_rows(float* acc, const float* row, size_t count) {
+  size_t i = 0;
+#if defined(ORC_WAVEFORM_HISTOGRAM_SSE2)
+  for (; i + 4 <= count; i += 4) {
+    _mm_storeu_ps(acc + i,
+                  _mm_max_ps(_mm_loadu_ps(acc + i), _mm_loadu_ps(row + i)));
+  }
+#endif
+  for (; i < count; ++i) {
+    acc[i] = std::max(acc[i], row[i]);
+  }
+}
+
+float channel(uint32_t argb, int shift) {
+  return static_cast<float>((argb >> shift) & 0xff) / 255.0f;
+}
+
+}  // namespace
+
+bool WaveformLayout::operator==(const WaveformLayout& other) const {
+  return samples_per_line == other.samples_per_line &&
+         total_lines == other.total_lines &&
+         active_start == other.active_start &&
+         active_width == other.active_width && y_bins == other.y_bins &&
+         y_min_mv == other.y_min_mv &&
+         blanking_level == other.blanking_level &&
+         white_level == other.white_level && system == other.system;
+}
+
+void WaveformHistogram::clear() {
+  layout_ = WaveformLayout();
+  counts_.clear();
+}
+
+float WaveformHistogram::count(int x, int bin) const {
+  if (x < 0 || x >= layout_.active_width || bin < 0 ||
+      bin >= layout_.y_bins || counts_.empty()) {
+    return 0.0f;
+  }
+  return counts_[static_cast<size_t>(bin) *
+                     static_cast<size_t>(layout_.active_width) +
+                 static_cast<size_t>(x)];
+}
+
+void WaveformHistogram::accumulate(const int16_t* samples, size_t sample_count,
+                                   const WaveformLayout& layout, float decay) {
+  if (layout.samples_per_line <= 0 || layout.total_lines <= 0 ||
+      layout.active_width <= 0 || layout.y_bins <= 0 ||
+      layout.active_start < 0 ||
+      layout.active_start + layout.active_width > layout.samples_per_line) {
+    clear();
+    return;
+  }
+
+  const size_t width = static_cast<size_t>(layout.active_width);
+  const size_t cells = width * static_cast<size_t>(layout.y_bins);
+  if (layout != layout_ || counts_.size() != cells) {
+    layout_ = layout;
+    counts_.assign(cells, 0.0f);
+  } else if (decay <= 0.0f) {
+    std::fill(counts_.begin(), counts_.end(), 0.0f);
+  } else {
+    decay_counts(counts_.data(), cells, std::min(decay, 1.0f));
+  }
+
+  // Sample-to-bin mapping folded into one affine transform:
+  //   mv  = (raw - blanking) / (white - blanking) * active_video_mv
+  //   bin = (mv - y_min_mv) / kBinWidthMv
+  double scale = 1.0;
+  double offset = -layout.y_min_mv;
+  if (layout.blanking_level >= 0 &&
+      layout.white_level > layout.blanking_level) {
+    scale = orc::active_video_mv(layout.system) /
+            static_cast<double>(layout.white_level - layout.blanking_level);
+    offset = -static_cast<double>(layout.blanking_level) * scale -
+             layout.y_min_mv;
+  }
+  scale /= kBinWidthMv;
+  offset /= kBinWidthMv;
+
+  line_bins_.resize(width);
+  const uint32_t y_bins = static_cast<uint32_t>(layout.y_bins);
+  const size_t samples_per_line = static_cast<size_t>(layout.samples_per_line);
+  const size_t active_start = static_cast<size_t>(layout.active_start);
+
+  for (size_t line = 0; line < static_cast<size_t>(layout.total_lines);
+       ++line) {
+    const size_t line_start = line * samples_per_line;
+    // Guard against truncated data (non-orthogonal PAL lines).
+    if (line_start + active_start + width > sample_count) break;
+
+    bin_line(samples + line_start + active_start, width,
+             static_cast<float>(scale), static_cast<float>(offset),
+             line_bins_.data());
+    for (size_t x = 0; x < width; ++x) {
+      const uint32_t bin = static_cast<uint32_t>(line_bins_[x]);
+      if (bin < y_bins) {
+        counts_[bin * width + x] += 1.0f;
+      }
+    }
+  }
+}
+
+void WaveformHistogram::render(uint32_t* pixels, int width, int height,
+                               size_t stride,
+                               const WaveformRenderStyle& style) const {
+  if (width <= 0 || height <= 0) return;
+
+  const size_t out_width = static_cast<size_t>(width);
+  if (counts_.empty()) {
+    for (int py = 0; py < height; ++py) {
+      std::fill_n(pixels + static_cast<size_t>(py) * stride, out_width, 0u);
+    }
+    return;
+  }
+
+  const int x_samples = layout_.active_width;
+  const int y_bins = layout_.y_bins;
+  const size_t columns = static_cast<size_t>(x_samples);
+
+  // Each output pixel covers the columns and bins of its fractional range,
+  // so no bin is skipped when the buffer is larger than the image.
+  std::vector<int> x_lo(out_width);
+  std::vector<int> x_hi(out_width);
+  for (int px = 0; px < width; ++px) {
+    x_lo[static_cast<size_t>(px)] =
+        static_cast<int>(static_cast<double>(px) / width * x_samples);
+    x_hi[static_cast<size_t>(px)] = std::min(
+        static_cast<int>(static_cast<double>(px + 1) / width * x_samples),
+        x_samples - 1);
+  }
+
+  // Brightness mapping adapted from the Color Tools VirtualDub plugin:
+  //   brightness = min(count * 5 * gain + bias, 255) / 255
+  // The gain moves the saturation knee: higher gain saturates sooner.
+  const float k = 5.0f * style.gain;
+  const float br = channel(style.background, 16);
+  const float bg = channel(style.background, 8);
+  const float bb = channel(style.background, 0);
+  const float pr = channel(style.trace, 16);
+  const float pg = channel(style.trace, 8);
+  const float pb = channel(style.trace, 0);
+
+  std::vector<float> row_max(columns);
+  for (int py = 0; py < height; ++py) {
+    // Bin 0 is the bottom scanline.
+    const int yi_lo = static_cast<int>(static_cast<double>(height - py - 1) /
+                                       height * y_bins);
+    const int yi_hi = std::min(
+        static_cast<int>(static_cast<double>(height - py) / height * y_bins),
+        y_bins - 1);
+
+    const float* first = counts_.data() + static_cast<size_t>(yi_lo) * columns;
+    std::copy(first, first + columns, row_max.begin());
+    for (int yi = yi_lo + 1; yi <= yi_hi; ++yi) {
+      max_rows(row_max.data(),
+               counts_.data() + static_cast<size_t>(yi) * columns, columns);
+    }
+
+    uint32_t* line = pixels + static_cast<size_t>(py) * stride;
+    for (size_t px = 0; px < out_width; ++px) {
+      float max_count = 0.0f;
+      for (int xi = x_lo[px]; xi <= x_hi[px]; ++xi) {
+        max_count = std::max(max_count, row_max[static_cast<size_t>(xi)]);
+      }
+      if (max_count < kVisibleCount) {
+        line[px] = 0;  // transparent: the grid shows through
+        continue;
+      }
+
+      const float b =
+          std::min(1.0f, (max_count * k + style.brightness_bias) / 255.0f);
+      const uint32_t cr = static_cast<uint32_t>((br + (pr - br) * b) * 255.0f);
+      const uint32_t cg = static_cast<uint32_t>((bg + (pg - bg) * b) * 255.0f);
+      const uint32_t cb = static_cast<uint32_t>((bb + (pb - bb) * b) * 255.0f);
+      line[px] = 0xff000000u | (cr << 16) | (cg << 8) | cb;
+    }
+  }
+}
+
+}  // namespace orc::gui
@@ -0,0 +1,121 @@
+/*
+ * File:        waveform_histogram.h
+ * Module:      orc-gui
+ * Purpose:     Waveform monitor density histogram and raster kernel
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#ifndef WAVEFORM_HISTOGRAM_H
+#define WAVEFORM_HISTOGRAM_H
+
+#include <orc/stage/common_types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace orc::gui {
+
+/**
+ * @brief How a frame's flat sample buffer maps onto the histogram.
+ *
+ * Each line contributes samples [active_start, active_start + active_width)
+ * to columns 0..active_width-1. Samples convert to millivolts through the
+ * blanking/white levels (raw values when the levels are unusable) and land in
+ * WaveformHistogram::kBinWidthMv bins from y_min_mv upwards.
+ */
+struct WaveformLayout {
+  int samples_per_line = 0;
+  int total_lines = 0;
+  int active_start = 0;
+  int active_width = 0;
+  int y_bins = 0;
+  double y_min_mv = 0.0;
+  int32_t blanking_level = -1;
+  int32_t white_level = -1;
+  orc::VideoSystem system = orc::VideoSystem::Unknown;
+
+  bool operator==(const WaveformLayout& other) const;
+  bool operator!=(const WaveformLayout& other) const {
+    return !(*this == other);
+  }
+};
+
+/// Colours and gain for WaveformHistogram::render().
+struct WaveformRenderStyle {
+  float gain = 1.0f;
+  float brightness_bias = 64.0f;
+  uint32_t background = 0xff000000;  ///< 0xAARRGGBB, opaque
+  uint32_t trace = 0xff00e600;       ///< 0xAARRGGBB, opaque
+};
+
+/**
+ * @brief Sample-luminance density buffer of the waveform monitor.
+ *
+ * Counts are stored bin-major (one contiguous row of columns per millivolt
+ * bin) so both the per-line binning and the raster pass run over contiguous
+ * memory; the hot loops use SSE2 where available. accumulate() folds a frame
+ * into the buffer with exponential decay, so a live view keeps a fading trace
+ * of recent frames.
+ *
+ * Pure logic (no Qt) so it runs on a worker thread and is unit-testable.
+ *
+ * Thread safety: not thread-safe; use from a single thread.
+ */
+class WaveformHistogram {
+ public:
+  /// Height of one histogram bin.
+  static constexpr double kBinWidthMv = 1.0;
+
+  /// Smallest count render() draws; lower decayed counts are cleared.
+  static constexpr float kVisibleCount = 0.5f;
+
+  /**
+   * @brief Fold one frame into the buffer.
+   *
+   * Existing counts are multiplied by @p decay before the frame's counts are
+   * added; 0 shows the frame alone. Decayed counts below kVisibleCount are
+   * flushed to zero, so a trace fades out after a few frames rather than
+   * lingering at the brightness floor. A layout change discards the history.
+   * Lines past the end of @p samples are ignored.
+   */
+  void accumulate(const int16_t* samples, size_t sample_count,
+                  const WaveformLayout& layout, float decay);
+
+  /// Discard all accumulated counts.
+  void clear();
+
+  bool empty() const { return counts_.empty(); }
+  const WaveformLayout& layout() const { return layout_; }
+
+  /// Accumulated (decayed) count of column @p x in bin @p bin.
+  float count(int x, int bin) const;
+
+  /**
+   * @brief Rasterise into a 32-bit ARGB scanline buffer.
+   *
+   * Each output pixel takes the maximum count over the columns and bins it
+   * covers (bin 0 at the bottom row), mapped to brightness as
+   * min(1, (count * 5 * gain + bias) / 255) between the background and
+   * trace colours. Empty pixels are written fully transparent, so the buffer
+   * suits QImage::Format_ARGB32_Premultiplied drawn over a grid.
+   *
+   * @param pixels First scanline
+   * @param width Pixels per scanline
+   * @param height Scanlines
+   * @param stride Pixels between scanline starts (>= width)
+   */
+  void render(uint32_t* pixels, int width, int height, size_t stride,
+              const WaveformRenderStyle& style) const;
+
+ private:
+  WaveformLayout layout_;
+  std::vector<float> counts_;       // [bin * active_width + x]
+  std::vector<int32_t> line_bins_;  // bin of each sample of one line
+};
+
+}  // namespace orc::gui
+
+#endif  // WAVEFORM_HISTOGRAM_H
@@ -43,6 +43,7 @@ WaveformMonitorDialog::WaveformMonitorDialog(QWidget* parent)
       channel_combo_(nullptr),
       range_combo_(nullptr),
       phosphor_check_(nullptr),
+      persistence_check_(nullptr),
       gain_slider_(nullptr),
       gain_value_label_(nullptr) {
   setWindowFlags(Qt::Window);
@@ -65,6 +66,11 @@ WaveformMonitorDialog::WaveformMonitorDialog(QWidget* parent)
       settings.value("WaveformMonitorDialog/phosphorMode", false).toBool();
   phosphor_check_->setChecked(phosphor);
   monitor_widget_->setPhosphorMode(phosphor);
+
+  const bool persistence =
+      settings.value("WaveformMonitorDialog/persistence", false).toBool();
+  persistence_check_->setChecked(persistence);
+  monitor_widget_->setPersistence(persistence);
 }
 
 WaveformMonitorDialog::~WaveformMonitorDialog() {
@@ -74,6 +80,10 @@ WaveformMonitorDialog::~WaveformMonitorDialog() {
     settings.setValue("WaveformMonitorDialog/phosphorMode",
                       phosphor_check_->isChecked());
   }
+  if (persistence_check_) {
+    settings.setValue("WaveformMonitorDialog/persistence",
+                      persistence_check_->isChecked());
+  }
 }
 
 void WaveformMonitorDialog::setupUI() {
@@ -123,6 +133,14 @@ void WaveformMonitorDialog::setupUI() {
   controls->addWidget(phosphor_check_);
   controls->addSpacing(12);
 
+  // Persistence — blend successive frames into a fading trace.
+  persistence_check_ = new QCheckBox("Persistence");
+  persistence_check_->setToolTip(
+      "Keep a fading trace of the previous few frames, like a long-persistence "
+      "phosphor, so changes stand out while scrubbing.");
+  controls->addWidget(persistence_check_);
+  controls->addSpacing(12);
+
   controls->addWidget(new QLabel("Intensity:"));
   gain_slider_ = new QSlider(Qt::Horizontal);
   gain_slider_->setRange(kSliderMin, kSliderMax);
@@ -152,14 +170,25 @@ void WaveformMonitorDialog::setupUI() {
                                QString::fromUtf8("×"));
   });
 
+  // A different channel or range is a different signal: start its trace
+  // afresh rather than blending it with the previous one.
   connect(channel_combo_, QOverload<int>::of(&QComboBox::currentIndexChanged),
-          this, [this](int) { updateWidgetForCurrentChannel(); });
+          this, [this](int) {
+            monitor_widget_->clearHistory();
+            updateWidgetForCurrentChannel();
+          });
 
   connect(range_combo_, QOverload<int>::of(&QComboBox::currentIndexChanged),
-          this, [this](int) { updateWidgetForCurrentChannel(); });
+          this, [this](int) {
+            monitor_widget_->clearHistory();
+            updateWidgetForCurrentChannel();
+          });
 
   connect(phosphor_check_, &QCheckBox::toggled, this,
           [this](bool checked) { monitor_widget_->setPhosphorMode(checked); });
+
+  connect(persistence_check_, &QCheckBox::toggled, this,
+          [this](bool checked) { monitor_widget_->setPersistence(checked); });
 }
 
 // ---------------------------------------------------------------------------
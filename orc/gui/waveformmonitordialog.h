@@ -42,7 +42,8 @@ enum class WaveformChannel { YPlusC, YOnly };
  * Displays a sample-luminance histogram across all active video lines in a
  * frame.  Brightness encodes how many lines share a given (sample, mV) pair.
  * An intensity gain control lets the user brighten sparse signals or prevent
- * saturation in high-uniformity scenes without requiring re-accumulation.
+ * saturation in high-uniformity scenes without requiring re-accumulation, and
+ * a persistence toggle keeps a fading trace of recent frames.
  */
 class WaveformMonitorDialog : public QDialog {
   Q_OBJECT
@@ -90,6 +91,7 @@ class WaveformMonitorDialog : public QDialog {
   QComboBox* channel_combo_;
   QComboBox* range_combo_;
   QCheckBox* phosphor_check_;
+  QCheckBox* persistence_check_;
   QSlider* gain_slider_;
   QLabel* gain_value_label_;
 
@@ -17,6 +17,7 @@
 #include <QSizePolicy>
 #include <algorithm>
 #include <cmath>
+#include <utility>
 
 #include "plotwidget.h"  // PlotWidget::isDarkTheme()
 #include "theme_color_tokens.h"
@@ -34,10 +35,49 @@ static orc::VideoSystem toOrcVideoSystem(orc::presenters::VideoSystem sys) {
   }
 }
 
+// ---------------------------------------------------------------------------
+// Worker
+// ---------------------------------------------------------------------------
+
+void WaveformMonitorWorker::process(const WaveformMonitorJob& job) {
+  if (job.clear_history) histogram_.clear();
+  if (job.samples) {
+    histogram_.accumulate(job.samples->data(), job.samples->size(), job.layout,
+                          job.decay);
+  }
+  // Always answer, even with a null image, so the widget's in-flight flag is
+  // released.
+  QImage image;
+  if (!job.size.isEmpty()) {
+    image = QImage(job.size, QImage::Format_ARGB32_Premultiplied);
+    histogram_.render(reinterpret_cast<uint32_t*>(image.bits()), image.width(),
+                      image.height(),
+                      static_cast<size_t>(image.bytesPerLine()) / 4,
+                      job.style);
+  }
+  emit imageReady(std::move(image));
+}
+
+// ---------------------------------------------------------------------------
+// Widget
+// ---------------------------------------------------------------------------
+
 WaveformMonitorWidget::WaveformMonitorWidget(QWidget* parent)
-    : QWidget(parent) {
+    : QWidget(parent), worker_(nullptr) {
   setMinimumSize(400, 300);
   setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+
+  worker_ = new WaveformMonitorWorker();
+  worker_->moveToThread(&worker_thread_);
+  connect(&worker_thread_, &QThread::finished, worker_, &QObject::deleteLater);
+  connect(worker_, &WaveformMonitorWorker::imageReady, this,
+          &WaveformMonitorWidget::onImageReady);
+  worker_thread_.start();
+}
+
+WaveformMonitorWidget::~WaveformMonitorWidget() {
+  worker_thread_.quit();
+  worker_thread_.wait();
 }
 
 QRect WaveformMonitorWidget::plotArea() const {
@@ -81,29 +121,21 @@ void WaveformMonitorWidget::setData(
       }
     }
   }
-  y_bins_ = static_cast<int>((y_max_mv_ - y_min_mv_) / kBinWidthMv) + 1;
+  y_bins_ = static_cast<int>((y_max_mv_ - y_min_mv_) /
+                             orc::gui::WaveformHistogram::kBinWidthMv) +
+            1;
 
   const int total_lines =
       first_field_height + (second_field_height > 0 ? second_field_height : 0);
   if (total_lines <= 0 || composite_samples.empty()) {
-    count_buffer_.clear();
-    x_samples_ = 0;
-    active_video_start_ = 0;
-    line_count_ = 0;
-    image_dirty_ = true;
-    update();
+    clearData();
     return;
   }
 
   const int samples_per_line =
       static_cast<int>(composite_samples.size()) / total_lines;
   if (samples_per_line <= 0) {
-    count_buffer_.clear();
-    x_samples_ = 0;
-    active_video_start_ = 0;
-    line_count_ = 0;
-    image_dirty_ = true;
-    update();
+    clearData();
     return;
   }
 
@@ -144,51 +176,33 @@ void WaveformMonitorWidget::setData(
     }
   }
 
-  accumulate(composite_samples, total_lines, active_start, active_end,
-             blanking_level, white_level, sys);
-  line_count_ = total_lines;
-  image_dirty_ = true;
+  x_samples_ = active_end - active_start + 1;
+
+  // A frame not yet picked up by the worker is superseded by this one.
+  orc::gui::WaveformLayout layout;
+  layout.samples_per_line = samples_per_line;
+  layout.total_lines = total_lines;
+  layout.active_start = active_start;
+  layout.active_width = x_samples_;
+  layout.y_bins = y_bins_;
+  layout.y_min_mv = y_min_mv_;
+  layout.blanking_level = blanking_level;
+  layout.white_level = white_level;
+  layout.system = sys;
+  pending_layout_ = layout;
+  pending_samples_ =
+      std::make_shared<const std::vector<int16_t>>(composite_samples);
+  requestRender();
   update();
 }
 
-void WaveformMonitorWidget::accumulate(const std::vector<int16_t>& samples,
-                                       int total_lines, int active_start,
-                                       int active_end, int32_t blanking_level,
-                                       int32_t white_level,
-                                       orc::VideoSystem sys) {
-  const int active_width = active_end - active_start + 1;
-  if (active_width <= 0 || total_lines <= 0) return;
-
-  const int samples_per_line = static_cast<int>(samples.size()) / total_lines;
-  if (samples_per_line <= 0) return;
-
-  x_samples_ = active_width;
-  count_buffer_.assign(static_cast<size_t>(x_samples_),
-                       std::vector<uint32_t>(static_cast<size_t>(y_bins_), 0));
-
-  const bool have_levels =
-      (blanking_level >= 0 && white_level > blanking_level);
-
-  for (int line = 0; line < total_lines; ++line) {
-    const int line_start = line * samples_per_line;
-    // Guard against truncated data (non-orthogonal PAL lines).
-    if (line_start + active_end >= static_cast<int>(samples.size())) break;
-
-    for (int x = 0; x < active_width; ++x) {
-      const int16_t raw =
-          samples[static_cast<size_t>(line_start) +
-                  static_cast<size_t>(active_start) + static_cast<size_t>(x)];
-
-      const double mv = have_levels ? orc::samples10_to_mv(raw, blanking_level,
-                                                           white_level, sys)
-                                    : static_cast<double>(raw);
-
-      const int y_bin = static_cast<int>((mv - y_min_mv_) / kBinWidthMv);
-      if (y_bin >= 0 && y_bin < y_bins_) {
-        count_buffer_[static_cast<size_t>(x)][static_cast<size_t>(y_bin)]++;
-      }
-    }
-  }
+void WaveformMonitorWidget::clearData() {
+  x_samples_ = 0;
+  active_video_start_ = 0;
+  pending_samples_.reset();
+  clear_pending_ = true;
+  cached_image_ = QImage();
+  update();
 }
 
 // ---------------------------------------------------------------------------
@@ -197,24 +211,80 @@ void WaveformMonitorWidget::accumulate(const std::vector<int16_t>& samples,
 
 void WaveformMonitorWidget::setGain(double gain) {
   gain_ = std::clamp(gain, 0.1, 10.0);
-  image_dirty_ = true;
-  update();
+  requestRender();
 }
 
 void WaveformMonitorWidget::setPhosphorMode(bool enabled) {
   if (phosphor_mode_ == enabled) return;
   phosphor_mode_ = enabled;
-  image_dirty_ = true;
+  requestRender();
   update();
 }
 
+void WaveformMonitorWidget::setPersistence(bool enabled) {
+  // Takes effect with the next frame; turning it off shows that frame alone.
+  persistence_ = enabled;
+}
+
+void WaveformMonitorWidget::clearHistory() { clear_pending_ = true; }
+
 void WaveformMonitorWidget::setYOnlyMode(bool y_only) {
   if (y_only_mode_ == y_only) return;
   y_only_mode_ = y_only;
-  image_dirty_ = true;
   update();
 }
 
+// ---------------------------------------------------------------------------
+// Worker round trip
+// ---------------------------------------------------------------------------
+
+void WaveformMonitorWidget::requestRender() {
+  if (job_in_flight_) {
+    // onImageReady() dispatches the latest state when the worker is done.
+    render_pending_ = true;
+    return;
+  }
+  dispatchJob();
+}
+
+void WaveformMonitorWidget::dispatchJob() {
+  render_pending_ = false;
+  if (x_samples_ == 0) return;
+
+  WaveformMonitorJob job;
+  job.samples = std::move(pending_samples_);
+  pending_samples_.reset();
+  job.layout = pending_layout_;
+  job.decay = persistence_ ? kPersistenceDecay : 0.0f;
+  job.clear_history = std::exchange(clear_pending_, false);
+  job.size = plotArea().size();
+  job.style = renderStyle();
+
+  job_in_flight_ = true;
+  QMetaObject::invokeMethod(
+      worker_,
+      [worker = worker_, job = std::move(job)]() { worker->process(job); },
+      Qt::QueuedConnection);
+}
+
+void WaveformMonitorWidget::onImageReady(QImage image) {
+  job_in_flight_ = false;
+  if (x_samples_ > 0 && !image.isNull()) {
+    cached_image_ = std::move(image);
+    update();
+  }
+  if (render_pending_) dispatchJob();
+}
+
+orc::gui::WaveformRenderStyle WaveformMonitorWidget::renderStyle() const {
+  orc::gui::WaveformRenderStyle style;
+  style.gain = static_cast<float>(gain_);
+  style.brightness_bias = kBrightnessBias;
+  style.background = displayBackground().rgba();
+  style.trace = displayTrace().rgba();
+  return style;
+}
+
 // ---------------------------------------------------------------------------
 // Color helpers
 // ---------------------------------------------------------------------------
@@ -246,7 +316,7 @@ QColor WaveformMonitorWidget::displayGrid() const {
 
 void WaveformMonitorWidget::resizeEvent(QResizeEvent* event) {
   QWidget::resizeEvent(event);
-  image_dirty_ = true;
+  requestRender();
 }
 
 void WaveformMonitorWidget::paintEvent(QPaintEvent*) {
@@ -257,7 +327,7 @@ void WaveformMonitorWidget::paintEvent(QPaintEvent*) {
   const QRect pa = plotArea();
   if (pa.isEmpty()) return;
 
-  if (count_buffer_.empty() || x_samples_ == 0 || y_bins_ == 0) {
+  if (x_samples_ == 0 || y_bins_ == 0) {
     painter.setPen(displayAxis());
     painter.drawText(pa, Qt::AlignCenter, "No data");
     drawYAxis(painter, pa);
@@ -265,105 +335,16 @@ void WaveformMonitorWidget::paintEvent(QPaintEvent*) {
     return;
   }
 
-  if (image_dirty_ || cached_image_.size() != pa.size()) {
-    rebuildImage(pa);
-    image_dirty_ = false;
-  }
-
   drawGrid(painter, pa);
-  painter.drawImage(pa.topLeft(), cached_image_);
+  // Until the worker delivers a raster for a new plot size, the previous one
+  // is stretched to fit.
+  if (!cached_image_.isNull()) painter.drawImage(pa, cached_image_);
 
   drawLevelMarkers(painter, pa);
   drawYAxis(painter, pa);
   drawXAxis(painter, pa);
 }
 
-// ---------------------------------------------------------------------------
-// Image rebuild — area-max accumulation + separable Gaussian blur
-// ---------------------------------------------------------------------------
-
-void WaveformMonitorWidget::rebuildImage(const QRect& pa) {
-  if (pa.isEmpty() || x_samples_ == 0 || y_bins_ == 0) return;
-
-  // ARGB32 with transparent background so grid lines drawn before drawImage()
-  // remain visible through unpopulated pixels.
-  cached_image_ = QImage(pa.size(), QImage::Format_ARGB32_Premultiplied);
-  cached_image_.fill(Qt::transparent);
-
-  const int img_w = pa.width();
-  const int img_h = pa.height();
-  const size_t w = static_cast<size_t>(img_w);
-  const size_t buf_sz = w * static_cast<size_t>(img_h);
-
-  // For each output pixel, find the maximum count across all buffer cells that
-  // map into its fractional range.  This avoids missed-bin aliasing when
-  // x_samples_ >> img_w.
-  //
-  // Brightness mapping adapted from the Color Tools VirtualDub plugin
-  // reference:
-  //   clamp[0] = 0
-  //   clamp[j] = min(j + kBrightnessBias, 255)   for j >= 1
-  //   brightness = clamp[count * 5 * gain] / 255
-  //
-  // Full saturation is reached after ~(255 - kBrightnessBias) / (5*gain)
-  // occurrences (ITU-R BT.601 broadcast norm).
-  // The gain control moves the saturation knee: higher gain saturates faster.
-  const float k = 5.0f * static_cast<float>(gain_);
-
-  std::vector<float> bright(buf_sz, 0.0f);
-
-  for (int px = 0; px < img_w; ++px) {
-    const int xi_lo =
-        static_cast<int>(static_cast<double>(px) / img_w * x_samples_);
-    const int xi_hi = std::min(
-        static_cast<int>(static_cast<double>(px + 1) / img_w * x_samples_),
-        x_samples_ - 1);
-
-    for (int py = 0; py < img_h; ++py) {
-      const int yi_lo = static_cast<int>(static_cast<double>(img_h - py - 1) /
-                                         img_h * y_bins_);
-      const int yi_hi = std::min(
-          static_cast<int>(static_cast<double>(img_h - py) / img_h * y_bins_),
-          y_bins_ - 1);
-
-      uint32_t max_count = 0;
-      for (int xi = xi_lo; xi <= xi_hi; ++xi) {
-        const auto& col = count_buffer_[static_cast<size_t>(xi)];
-        for (int yi = yi_lo; yi <= yi_hi; ++yi) {
-          max_count = std::max(max_count, col[static_cast<size_t>(yi)]);
-        }
-      }
-      if (max_count == 0) continue;
-
-      const float b = std::min(
-          1.0f, (static_cast<float>(max_count) * k + kBrightnessBias) / 255.0f);
-      bright[static_cast<size_t>(py) * w + static_cast<size_t>(px)] = b;
-    }
-  }
-
-  // Write QImage — interpolate background → trace color by brightness.
-  const QColor back_color = displayBackground();
-  const QColor plot_color = displayTrace();
-  const float br = static_cast<float>(back_color.redF());
-  const float bg = static_cast<float>(back_color.greenF());
-  const float bb = static_cast<float>(back_color.blueF());
-  const float pr = static_cast<float>(plot_color.redF());
-  const float pg = static_cast<float>(plot_color.greenF());
-  const float pb = static_cast<float>(plot_color.blueF());
-
-  for (int py = 0; py < img_h; ++py) {
-    const size_t row = static_cast<size_t>(py) * w;
-    for (int px = 0; px < img_w; ++px) {
-      const float b = bright[row + static_cast<size_t>(px)];
-      if (b <= 0.0f) continue;
-      const int cr = static_cast<int>((br + (pr - br) * b) * 255.0f);
-      const int cg = static_cast<int>((bg + (pg - bg) * b) * 255.0f);
-      const int cb = static_cast<int>((bb + (pb - bb) * b) * 255.0f);
-      cached_image_.setPixel(px, py, qRgb(cr, cg, cb));
-    }
-  }
-}
-
 // ---------------------------------------------------------------------------
 // Axis and markers
 // ---------------------------------------------------------------------------
@@ -612,6 +593,5 @@ void WaveformMonitorWidget::drawLevelMarkers(QPainter& painter,
 void WaveformMonitorWidget::setAmplitudeUnit(orc::AmplitudeDisplayUnit unit) {
   if (amplitude_unit_ == unit) return;
   amplitude_unit_ = unit;
-  image_dirty_ = true;
   update();
 }
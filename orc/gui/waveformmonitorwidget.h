@@ -14,20 +14,69 @@
 #include <orc/stage/common_types.h>
 
 #include <QImage>
+#include <QSize>
+#include <QThread>
 #include <QWidget>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <vector>
 
 #include "presenters/include/hints_view_models.h"
+#include "waveform_histogram.h"
+
+/**
+ * @brief One accumulate-and-render pass of the waveform monitor worker.
+ *
+ * A job without samples only re-renders the existing histogram, e.g. after a
+ * gain change or resize.
+ */
+struct WaveformMonitorJob {
+  std::shared_ptr<const std::vector<int16_t>> samples;
+  orc::gui::WaveformLayout layout;
+  float decay = 0.0f;
+  bool clear_history = false;
+  QSize size;
+  orc::gui::WaveformRenderStyle style;
+};
+
+/**
+ * @brief Worker that accumulates and rasterises the waveform histogram
+ *
+ * Lives on a dedicated QThread owned by WaveformMonitorWidget and owns the
+ * (persistent) histogram; the widget communicates with it only through
+ * queued invocations and the imageReady() signal.
+ */
+class WaveformMonitorWorker : public QObject {
+  Q_OBJECT
+
+ public slots:
+  /**
+   * @brief Fold the job's frame (if any) into the histogram and render it;
+   * emits imageReady() with the result.
+   */
+  void process(const WaveformMonitorJob& job);
+
+ signals:
+  /// Plot-area-sized ARGB32 premultiplied raster, transparent where empty.
+  void imageReady(QImage image);
+
+ private:
+  orc::gui::WaveformHistogram histogram_;
+};
 
 /**
  * @brief Waveform monitor widget — sample-luminance histogram across all lines
  *
  * Accumulates a 2D count buffer: for every active video line in the frame,
- * for every sample position x, it increments count[x][mv_bin].  The buffer
- * is rendered as a QImage using area-max mapping followed by a Gaussian blur
- * (phosphor-glow effect), coloured with the theme's CompositePrimary token.
+ * for every sample position x, it increments count[x][mv_bin].  Accumulation
+ * and rasterisation (area-max mapping, coloured with the theme's
+ * CompositePrimary token) run on a worker thread; the widget keeps drawing
+ * the last raster, scaled to the plot area, until the next one arrives.
+ * Frames submitted while the worker is busy are coalesced to the newest.
+ *
+ * With persistence enabled each frame is blended into an exponentially
+ * decaying history, so scrubbing leaves a short fading trace.
  *
  * Five normative level markers (sync tip, blanking, black, white, peak) are
  * drawn on top of the raster image, matching the Frame-scope style exactly.
@@ -40,9 +89,13 @@ class WaveformMonitorWidget : public QWidget {
 
  public:
   explicit WaveformMonitorWidget(QWidget* parent = nullptr);
+  ~WaveformMonitorWidget() override;
 
   /**
-   * @brief Load frame data and rebuild the accumulation buffer.
+   * @brief Load frame data and queue it for accumulation.
+   *
+   * The axes update immediately; the raster follows when the worker has
+   * folded the frame into the histogram.
    *
    * @param composite_samples Flat concatenation of all field samples
    * @param first_field_height  Lines in the first field
@@ -60,6 +113,13 @@ class WaveformMonitorWidget : public QWidget {
   void setPhosphorMode(bool enabled);
   bool phosphorMode() const { return phosphor_mode_; }
 
+  /// Blend each new frame into a decaying history of previous frames.
+  void setPersistence(bool enabled);
+  bool persistence() const { return persistence_; }
+
+  /// Drop the accumulated history; the next frame starts from empty.
+  void clearHistory();
+
   // Constrain the Y-axis to the legal luma range when displaying a Y-only
   // channel.  Must be called before setData() to take effect on the current
   // frame.
@@ -72,10 +132,11 @@ class WaveformMonitorWidget : public QWidget {
   void resizeEvent(QResizeEvent* event) override;
 
  private:
-  void accumulate(const std::vector<int16_t>& samples, int total_lines,
-                  int active_start, int active_end, int32_t blanking_level,
-                  int32_t white_level, orc::VideoSystem sys);
-  void rebuildImage(const QRect& plot_area);
+  void clearData();
+  void requestRender();
+  void dispatchJob();
+  void onImageReady(QImage image);
+  orc::gui::WaveformRenderStyle renderStyle() const;
   void drawGrid(QPainter& painter, const QRect& plot_area) const;
   void drawYAxis(QPainter& painter, const QRect& plot_area) const;
   void drawXAxis(QPainter& painter, const QRect& plot_area) const;
@@ -90,24 +151,31 @@ class WaveformMonitorWidget : public QWidget {
   QColor displayAxis() const;
   QColor displayGrid() const;
 
-  // Accumulation buffer: count_buffer_[x_sample][y_bin]
-  std::vector<std::vector<uint32_t>> count_buffer_;
+  // Axis state of the current frame (the histogram itself lives on the
+  // worker).
   int x_samples_ = 0;
   int active_video_start_ = 0;
   double us_per_sample_ = 1000000.0 / 14318181.8;  // default: NTSC 4FSC
   int y_bins_ = 0;
   double y_min_mv_ = -350.0;
   double y_max_mv_ = 950.0;
-  static constexpr double kBinWidthMv = 1.0;
-  int line_count_ = 0;
 
   double gain_ = 1.0;
   bool phosphor_mode_ = false;
+  bool persistence_ = false;
   bool y_only_mode_ = false;
   orc::AmplitudeDisplayUnit amplitude_unit_ = orc::AmplitudeDisplayUnit::IRE;
-  bool image_dirty_ = true;
   QImage cached_image_;
 
+  // Accumulation and rendering (worker thread)
+  QThread worker_thread_;
+  WaveformMonitorWorker* worker_;  // Owned by worker_thread_ finish hook
+  bool job_in_flight_ = false;
+  bool render_pending_ = false;
+  std::shared_ptr<const std::vector<int16_t>> pending_samples_;
+  orc::gui::WaveformLayout pending_layout_;
+  bool clear_pending_ = false;
+
   std::optional<orc::presenters::VideoParametersView> video_params_;
 
   // Additive brightness floor applied to every non-zero count before dividing
@@ -116,6 +184,10 @@ class WaveformMonitorWidget : public QWidget {
   // more usable gradient (~27 % minimum).
   static constexpr float kBrightnessBias = 64.0f;
 
+  // Per-frame decay of the persistence history: a single hit stays visible
+  // for three frames (0.75^3 falls below the histogram's visible floor).
+  static constexpr float kPersistenceDecay = 0.75f;
+
   static constexpr int kLeftMargin = 55;
   static constexpr int kRightMargin = 10;
   static constexpr int kTopMargin = 15;
@@ -14,6 +14,7 @@
 
 #include "ByteWithErasureFlag.h"
 #include "GFValue.h"
+#include "gf256/gf256.h"
 
 enum DecodingStrategy {
   RS_NONE,  // No correction at all
@@ -40,15 +41,8 @@ class ReedSolomon {
         m_create_diagnotics(create_diagnotics),
         m_alpha_inverse(m_alpha.inverse()),
         m_alpha_squared(m_alpha * m_alpha),
-        H() {
-    for (int row = 0; row < n - k; row++) {
-      std::vector<GF> h_row;
-      for (int col = 0; col < n; col++) {
-        h_row.push_back(GF::alpha_pow((row + fcr) * col));
-      }
-      H.push_back(h_row);
-    }
-  }
+        m_syndrome_kernel(n, n - k, irreducible_poly, fcr),
+        m_word(n) {}
 
   // The first symbol in the input is the highest order coefficient
   void decode(std::vector<ByteWithErasureFlag>& data);
@@ -93,7 +87,11 @@ class ReedSolomon {
   GF m_alpha_inverse;
   GF m_alpha_squared;
 
-  std::vector<std::vector<GF>> H;
+  // orc adaptation: the syndromes come from the shared orc-gf256 kernel (one
+  // split-nibble table lookup per symbol for all n - k syndromes) instead of
+  // a parity-check matrix product.
+  orc::gf256::SyndromeKernel m_syndrome_kernel;
+  std::vector<uint8_t> m_word;
   std::map<std::string, int> m_statistics;
   std::map<std::string, int> m_diagnostics;
   std::map<std::string, int> m_total_statistics;
@@ -112,15 +110,15 @@ class ReedSolomon {
 
   void doDecode(std::vector<ByteWithErasureFlag>& data);
 
+  // |data| is in decode order (location 0 first); the kernel takes the
+  // highest-order coefficient first, i.e. the received order.
   std::vector<GF> computeSyndromes(
       std::vector<ByteWithErasureFlag> const& data) {
+    for (int j = 0; j < m_n; j++) m_word[j] = data[m_n - 1 - j].byteValue();
+    uint8_t values[orc::gf256::SyndromeKernel::kMaxRoots];
+    m_syndrome_kernel.compute(m_word.data(), values);
     std::vector<GF> syndromes;
-    for (int i = 0; i < m_n - m_k; i++) {
-      GF s = GF(0);
-      for (int j = 0; j < m_n; j++)
-        s = s + H[i][j] * data[j].gfValue<irreducible_poly, alpha_decimal>();
-      syndromes.push_back(s);
-    }
+    for (int i = 0; i < m_n - m_k; i++) syndromes.push_back(GF(values[i]));
     return syndromes;
   }
 
@@ -42,27 +42,6 @@ std::optional<int32_t> parse_pair_index(const std::string& text) {
   return static_cast<int32_t>(parsed);
 }
 
-// Frame index n whose audio window contains absolute stereo-pair position
-// |pos|: audio_pair_offset(n) <= pos < audio_pair_offset(n + 1). The cadence
-// is exactly periodic (PAL 1920 pairs/frame; NTSC/PAL-M 8008 pairs per
-// 5-frame sequence, SMPTE 272M-1994 §14.3), so the rational estimate is at
-// most one frame off and each adjustment loop runs at most once.
-uint64_t frame_containing_pair(uint64_t pos, VideoSystem system) {
-  switch (system) {
-    case VideoSystem::PAL:
-      return pos / 1920u;
-    case VideoSystem::NTSC:
-    case VideoSystem::PAL_M: {
-      uint64_t n = pos * 5u / 8008u;
-      while (audio_pair_offset(n + 1, system) <= pos) ++n;
-      while (n > 0 && audio_pair_offset(n, system) > pos) --n;
-      return n;
-    }
-    default:
-      return 0;
-  }
-}
-
 }  // namespace
 
 // ============================================================================
@@ -74,67 +53,62 @@ std::vector<int32_t> AlignedAudioChannelPairRepresentation::get_audio_samples(
   if (!source_) return {};
   if (pair >= source_->audio_channel_pair_count()) return {};
   if (pair != target_pair_) return source_->get_audio_samples(pair, id);
-  return assemble_shifted_window(id);
-}
 
-std::vector<int32_t>
-AlignedAudioChannelPairRepresentation::assemble_shifted_window(
-    FrameID id) const {
-  // The output window for frame |id| covers absolute stream pair positions
-  // [audio_pair_offset(id) - offset, audio_pair_offset(id + 1) - offset).
-  // Cumulative audio_pair_offset() arithmetic — never a constant per-frame
-  // stride — keeps the NTSC/PAL-M 1602/1601 cadence exact when the window
-  // crosses frame boundaries.
   const auto params = source_->get_video_parameters();
   const VideoSystem system = params ? params->system : VideoSystem::Unknown;
-  const int64_t pairs = static_cast<int64_t>(audio_pairs_in_frame(id, system));
-  if (pairs <= 0) return {};
+  const uint32_t pairs = audio_pairs_in_frame(id, system);
+  const auto range = source_->frame_range();
+  if (pairs == 0 || range.empty() || id < range.first || id > range.last) {
+    return {};
+  }
+  std::vector<int32_t> out(static_cast<size_t>(pairs) * 2);
+  read_audio(pair, audio_pair_offset(id, system), pairs, out.data());
+  return out;
+}
 
+bool AlignedAudioChannelPairRepresentation::read_audio(size_t pair,
+                                                       uint64_t start_pair,
+                                                       size_t count,
+                                                       int32_t* out) const {
+  if (!source_ || pair != target_pair_) {
+    return VideoFrameRepresentationWrapper::read_audio(pair, start_pair, count,
+                                                       out);
+  }
+  std::fill(out, out + count * 2, 0);
+  if (pair >= source_->audio_channel_pair_count()) return false;
+  const auto params = source_->get_video_parameters();
+  const VideoSystem system = params ? params->system : VideoSystem::Unknown;
   const auto range = source_->frame_range();
-  if (range.empty() || id < range.first || id > range.last) return {};
+  if (audio_pairs_in_frame(0, system) == 0 || range.empty()) return false;
 
-  // Stream extent in absolute pair coordinates.
+  // Stream extent in absolute pair coordinates. Cumulative
+  // audio_pair_offset() arithmetic — never a constant per-frame stride —
+  // keeps the NTSC/PAL-M 1602/1601 cadence exact across frame boundaries.
   const int64_t stream_begin =
       static_cast<int64_t>(audio_pair_offset(range.first, system));
   const int64_t stream_end =
       static_cast<int64_t>(audio_pair_offset(range.last + 1, system));
 
+  // Only positions inside the output frames' windows are served.
+  const int64_t begin = static_cast<int64_t>(start_pair);
+  const int64_t end = begin + static_cast<int64_t>(count);
+  const int64_t lo = std::max(begin, stream_begin);
+  const int64_t hi = std::min(end, stream_end);
+  if (lo >= hi) return false;
+  bool complete = lo == begin && hi == end;
+
   // A positive offset delays the audio relative to the video, so output
-  // position q reads source position q - offset.
-  std::vector<int32_t> out(static_cast<size_t>(pairs) * 2, 0);
-  int64_t src_pos =
-      static_cast<int64_t>(audio_pair_offset(id, system)) - offset_pairs_;
-  int64_t out_pair = 0;
-  while (out_pair < pairs) {
-    if (src_pos < stream_begin) {
-      // Before the start of the stream: leave silence.
-      const int64_t skip = std::min(stream_begin - src_pos, pairs - out_pair);
-      src_pos += skip;
-      out_pair += skip;
-      continue;
-    }
-    if (src_pos >= stream_end) break;  // past the end: silence tail
-
-    const uint64_t src_frame =
-        frame_containing_pair(static_cast<uint64_t>(src_pos), system);
-    const int64_t frame_start =
-        static_cast<int64_t>(audio_pair_offset(src_frame, system));
-    const int64_t frame_pairs =
-        static_cast<int64_t>(audio_pairs_in_frame(src_frame, system));
-    const int64_t within = src_pos - frame_start;
-    const int64_t take = std::min(frame_pairs - within, pairs - out_pair);
-    const auto src = source_->get_audio_samples(target_pair_, src_frame);
-    for (int64_t p = 0; p < take; ++p) {
-      const size_t sp = static_cast<size_t>(within + p) * 2;
-      if (sp + 1 < src.size()) {
-        out[static_cast<size_t>(out_pair + p) * 2] = src[sp];
-        out[static_cast<size_t>(out_pair + p) * 2 + 1] = src[sp + 1];
-      }
-    }
-    src_pos += take;
-    out_pair += take;
+  // position q reads source position q - offset; source positions past
+  // either end of the stream are silence.
+  const int64_t src_lo = std::max(lo - offset_pairs_, stream_begin);
+  const int64_t src_hi = std::min(hi - offset_pairs_, stream_end);
+  if (src_lo < src_hi) {
+    complete &= source_->read_audio(
+        pair, static_cast<uint64_t>(src_lo),
+        static_cast<size_t>(src_hi - src_lo),
+        out + static_cast<size_t>(src_lo + offset_pairs_ - begin) * 2);
   }
-  return out;
+  return complete;
 }
 
 // ============================================================================
@@ -60,19 +60,33 @@ class AlignedAudioChannelPairRepresentation
     return "aligned_audio_channel_pair_representation";
   }
 
+  // Video samples and hints pass through unchanged, so hand out the upstream
+  // frame handle instead of the wrapper default's copy.
+  FrameHandle acquire_frame(FrameID id) const override {
+    return source_ ? source_->acquire_frame(id) : nullptr;
+  }
+  // Forward batched line reads so scans keep the source's coalesced reads.
+  bool read_lines(FrameIDRange frames, const std::vector<size_t>& lines,
+                  std::vector<sample_type>& out) const override {
+    if (!source_) {
+      out.clear();
+      return false;
+    }
+    return source_->read_lines(frames, lines, out);
+  }
+
   // --- Audio: only the target channel pair's samples change -----------------
   // (pair count and descriptors forward untouched; per-frame pair counts are
   // a model invariant and unchanged by the shift)
 
   std::vector<int32_t> get_audio_samples(size_t pair,
                                          FrameID id) const override;
+  // The target pair is read as one shifted source range, silence-filled
+  // past either end of the stream; other pairs forward.
+  bool read_audio(size_t pair, uint64_t start_pair, size_t count,
+                  int32_t* out) const override;
 
  private:
-  // Assembles the shifted window of the target channel pair for frame |id|
-  // from the neighbouring frames' samples, silence-filling past either end
-  // of the stream.
-  std::vector<int32_t> assemble_shifted_window(FrameID id) const;
-
   size_t target_pair_;
   int64_t offset_pairs_;
 };
@@ -13,6 +13,7 @@
 #include <orc/support/logging.h>
 #include <orc/support/preview_helpers.h>
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -108,13 +109,12 @@ ChannelMappedRepresentation::fill_for_pair(size_t pair) const {
   return is_result_pair(pair) ? mono_fill() : ChannelFill::kNone;
 }
 
-void ChannelMappedRepresentation::apply_fill(std::vector<int32_t>& samples,
+void ChannelMappedRepresentation::apply_fill(int32_t* samples, size_t pairs,
                                              ChannelFill fill) {
   if (fill == ChannelFill::kNone) return;
-  // Interleaved stereo pairs (L, R, L, R, …); ignore a trailing odd sample.
+  // Interleaved stereo pairs (L, R, L, R, …).
   // SMPTE 272M-1994 §6.4: a mono programme occupies the left channel only; the
   // right channel is silenced (all zeros), never a duplicate of the left.
-  const size_t pairs = samples.size() / 2;
   switch (fill) {
     case ChannelFill::kLeftMono:
       for (size_t p = 0; p < pairs; ++p) {
@@ -155,10 +155,24 @@ std::vector<int32_t> ChannelMappedRepresentation::get_audio_samples(
     size_t pair, FrameID id) const {
   if (!source_ || pair >= audio_channel_pair_count()) return {};
   auto samples = source_->get_audio_samples(source_pair_for(pair), id);
-  apply_fill(samples, fill_for_pair(pair));
+  // Ignore a trailing odd sample.
+  apply_fill(samples.data(), samples.size() / 2, fill_for_pair(pair));
   return samples;
 }
 
+bool ChannelMappedRepresentation::read_audio(size_t pair, uint64_t start_pair,
+                                             size_t count,
+                                             int32_t* out) const {
+  if (!source_ || pair >= audio_channel_pair_count()) {
+    std::fill(out, out + count * 2, 0);
+    return false;
+  }
+  const bool complete =
+      source_->read_audio(source_pair_for(pair), start_pair, count, out);
+  apply_fill(out, count, fill_for_pair(pair));
+  return complete;
+}
+
 // ============================================================================
 // AudioChannelMapStage
 // ============================================================================
@@ -84,6 +84,21 @@ class ChannelMappedRepresentation : public VideoFrameRepresentationWrapper,
     return "channel_mapped_representation";
   }
 
+  // Video samples and hints pass through unchanged, so hand out the upstream
+  // frame handle instead of the wrapper default's copy.
+  FrameHandle acquire_frame(FrameID id) const override {
+    return source_ ? source_->acquire_frame(id) : nullptr;
+  }
+  // Forward batched line reads so scans keep the source's coalesced reads.
+  bool read_lines(FrameIDRange frames, const std::vector<size_t>& lines,
+                  std::vector<sample_type>& out) const override {
+    if (!source_) {
+      out.clear();
+      return false;
+    }
+    return source_->read_lines(frames, lines, out);
+  }
+
   // --- Audio channel pairs --------------------------------------------------
 
   size_t audio_channel_pair_count() const override;
@@ -91,6 +106,8 @@ class ChannelMappedRepresentation : public VideoFrameRepresentationWrapper,
       size_t pair) const override;
   std::vector<int32_t> get_audio_samples(size_t pair,
                                          FrameID id) const override;
+  bool read_audio(size_t pair, uint64_t start_pair, size_t count,
+                  int32_t* out) const override;
 
  private:
   // How the channels of an output pair derive from its source pair.
@@ -125,8 +142,8 @@ class ChannelMappedRepresentation : public VideoFrameRepresentationWrapper,
   size_t source_pair_for(size_t pair) const;
   ChannelFill fill_for_pair(size_t pair) const;
 
-  // Applies |fill| in place to interleaved stereo samples.
-  static void apply_fill(std::vector<int32_t>& samples, ChannelFill fill);
+  // Applies |fill| in place to |pairs| interleaved stereo pairs.
+  static void apply_fill(int32_t* samples, size_t pairs, ChannelFill fill);
 
   size_t source_pair_;
   AudioChannelMapOperation operation_;
@@ -13,9 +13,10 @@
 #include <orc/support/logging.h>
 #include <orc/support/preview_helpers.h>
 
+#include <algorithm>
 #include <variant>
 
-#include "audio-resample/audio_resampler.h"
+#include "audio-resample/streaming_audio_resampler.h"
 #include "audio_import_stage_deps.h"
 
 namespace orc {
@@ -37,6 +38,40 @@ std::string file_stem(const std::string& path) {
 // ImportedAudioChannelPairRepresentation
 // ============================================================================
 
+ImportedAudioChannelPairRepresentation::ImportedAudioChannelPairRepresentation(
+    std::shared_ptr<const VideoFrameRepresentation> source,
+    std::shared_ptr<IAudioImportDeps> deps,
+    AudioChannelPairDescriptor descriptor, uint32_t wav_sample_rate_hz,
+    uint16_t wav_bits_per_sample, VideoSystem system, size_t frame_count)
+    : VideoFrameRepresentationWrapper(std::move(source)),
+      Artifact(ArtifactID("audio_import"), Provenance{}),
+      deps_(std::move(deps)),
+      descriptor_(std::move(descriptor)),
+      system_(system) {
+  // 16-bit material is widened to the 24-bit-in-int32 carrier; 24-bit
+  // material is already unpacked (sign-extended) by the deps.
+  auto reader = [deps = deps_, wav_bits_per_sample](
+                    uint64_t first_pair, size_t count, int32_t* out) {
+    if (wav_bits_per_sample == 16) {
+      const std::vector<int16_t> raw = deps->read_pairs_16(first_pair, count);
+      std::transform(raw.begin(), raw.end(), out, [](int16_t s) {
+        return static_cast<int32_t>(s) << 8;
+      });
+      return raw.size() / 2;
+    }
+    const std::vector<int32_t> raw = deps->read_pairs_24(first_pair, count);
+    std::copy(raw.begin(), raw.end(), out);
+    return raw.size() / 2;
+  };
+  // Cadence-sized per-frame blocks (SMPTE 272M-1994 §14.3), zero-padded or
+  // truncated to exactly audio_pair_offset(frame_count) total pairs.
+  resampler_ = std::make_unique<StreamingAudioResampler>(
+      std::move(reader), wav_sample_rate_hz, system_, frame_count);
+}
+
+ImportedAudioChannelPairRepresentation::
+    ~ImportedAudioChannelPairRepresentation() = default;
+
 std::optional<AudioChannelPairDescriptor>
 ImportedAudioChannelPairRepresentation::get_audio_channel_pair_descriptor(
     size_t pair) const {
@@ -56,28 +91,34 @@ std::vector<int32_t> ImportedAudioChannelPairRepresentation::get_audio_samples(
   if (!source_ || !source_->has_frame(id)) return {};
   const auto range = source_->frame_range();
   if (id < range.first) return {};
-  const uint64_t index = id - range.first;
-
-  ensure_converted();
-  if (index >= frame_blocks_.size()) return {};
-  return frame_blocks_[static_cast<size_t>(index)];
+  return resampler_->frame_block(id - range.first);
 }
 
-void ImportedAudioChannelPairRepresentation::ensure_converted() const {
-  std::call_once(convert_once_, [this] {
-    // 16-bit material is widened to the 24-bit-in-int32 carrier; 24-bit
-    // material is already unpacked (sign-extended) by the deps.
-    const std::vector<int32_t> raw =
-        (wav_bits_per_sample_ == 16)
-            ? AudioResampler::widen_16_to_24(deps_->read_all_pairs_16())
-            : deps_->read_all_pairs_24();
-    // Convert to the synchronous pipeline form: 48000 Hz, segmented into
-    // cadence-sized per-frame blocks (SMPTE 272M-1994 §14.3), zero-padded or
-    // truncated to exactly audio_pair_offset(frame_count_) total pairs. A
-    // 48000 Hz input passes through the resampler unchanged.
-    frame_blocks_ = AudioResampler::resample_to_synchronous(
-        raw, static_cast<double>(wav_sample_rate_hz_), system_, frame_count_);
-  });
+bool ImportedAudioChannelPairRepresentation::read_audio(size_t pair,
+                                                        uint64_t start_pair,
+                                                        size_t count,
+                                                        int32_t* out) const {
+  if (pair != imported_pair_index()) {
+    return VideoFrameRepresentationWrapper::read_audio(pair, start_pair, count,
+                                                       out);
+  }
+  std::fill(out, out + count * 2, 0);
+  if (!source_ || audio_pairs_in_frame(0, system_) == 0) return false;
+  const auto range = source_->frame_range();
+
+  bool complete = true;
+  for_each_audio_frame_span(
+      start_pair, count, system_,
+      [&](uint64_t frame, size_t within, size_t pairs, size_t at) {
+        if (frame < range.first || !source_->has_frame(frame)) {
+          complete = false;
+          return;
+        }
+        const uint64_t first =
+            audio_pair_offset(frame - range.first, system_) + within;
+        if (!resampler_->read(first, pairs, out + at * 2)) complete = false;
+      });
+  return complete;
 }
 
 // ============================================================================
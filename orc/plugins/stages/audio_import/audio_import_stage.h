@@ -18,7 +18,6 @@
 #include <orc/stage/video_frame_representation.h>
 
 #include <memory>
-#include <mutex>
 #include <string>
 #include <vector>
 
@@ -26,6 +25,8 @@
 
 namespace orc {
 
+class StreamingAudioResampler;
+
 // ============================================================================
 // ImportedAudioChannelPairRepresentation
 // ============================================================================
@@ -35,14 +36,14 @@ namespace orc {
 // untouched.
 //
 // The WAV is converted to the pipeline form (48000 Hz synchronous,
-// 24-bit-in-int32 stereo — see audio_channel_pair.h) lazily on first audio
-// access: 16-bit material is widened, 24-bit unpacked, then the stream is
-// resampled and segmented into cadence-sized per-frame blocks. A 48000 Hz
-// input whose length already equals audio_pair_offset(frame_count) passes
-// through the resampler unchanged.
+// 24-bit-in-int32 stereo — see audio_channel_pair.h) lazily as frames are
+// requested: StreamingAudioResampler reads the WAV data a piece at a time,
+// widens 16-bit material, resamples and serves cadence-sized per-frame
+// blocks, so neither the WAV nor the converted stream is ever held whole. A
+// 48000 Hz input is served straight from the file.
 //
-// Thread safety: safe for concurrent reads; the one-time ingest conversion
-// is guarded by std::call_once.
+// Thread safety: safe for concurrent reads; conversion is serialised inside
+// the resampler.
 class ImportedAudioChannelPairRepresentation
     : public VideoFrameRepresentationWrapper,
       public Artifact {
@@ -51,20 +52,28 @@ class ImportedAudioChannelPairRepresentation
       std::shared_ptr<const VideoFrameRepresentation> source,
       std::shared_ptr<IAudioImportDeps> deps,
       AudioChannelPairDescriptor descriptor, uint32_t wav_sample_rate_hz,
-      uint16_t wav_bits_per_sample, VideoSystem system, size_t frame_count)
-      : VideoFrameRepresentationWrapper(std::move(source)),
-        Artifact(ArtifactID("audio_import"), Provenance{}),
-        deps_(std::move(deps)),
-        descriptor_(std::move(descriptor)),
-        wav_sample_rate_hz_(wav_sample_rate_hz),
-        wav_bits_per_sample_(wav_bits_per_sample),
-        system_(system),
-        frame_count_(frame_count) {}
+      uint16_t wav_bits_per_sample, VideoSystem system, size_t frame_count);
+  ~ImportedAudioChannelPairRepresentation() override;
 
   std::string type_name() const override {
     return "imported_audio_channel_pair_representation";
   }
 
+  // Video samples and hints pass through unchanged, so hand out the upstream
+  // frame handle instead of the wrapper default's copy.
+  FrameHandle acquire_frame(FrameID id) const override {
+    return source_ ? source_->acquire_frame(id) : nullptr;
+  }
+  // Forward batched line reads so scans keep the source's coalesced reads.
+  bool read_lines(FrameIDRange frames, const std::vector<size_t>& lines,
+                  std::vector<sample_type>& out) const override {
+    if (!source_) {
+      out.clear();
+      return false;
+    }
+    return source_->read_lines(frames, lines, out);
+  }
+
   // --- Audio channel pairs: source pairs forward; one pair is appended -----
 
   size_t audio_channel_pair_count() const override {
@@ -74,6 +83,8 @@ class ImportedAudioChannelPairRepresentation
       size_t pair) const override;
   std::vector<int32_t> get_audio_samples(size_t pair,
                                          FrameID id) const override;
+  bool read_audio(size_t pair, uint64_t start_pair, size_t count,
+                  int32_t* out) const override;
 
  private:
   size_t source_pair_count() const {
@@ -83,21 +94,10 @@ class ImportedAudioChannelPairRepresentation
   // through the DAG; pair-adding stages append).
   size_t imported_pair_index() const { return source_pair_count(); }
 
-  // One-time ingest conversion: reads the whole WAV via deps_, widens 16-bit
-  // material to the 24-bit-in-int32 carrier, and resamples/segments into
-  // cadence-sized per-frame blocks totalling audio_pair_offset(frame_count_)
-  // stereo pairs.
-  void ensure_converted() const;
-
   std::shared_ptr<IAudioImportDeps> deps_;
   AudioChannelPairDescriptor descriptor_;
-  uint32_t wav_sample_rate_hz_;
-  uint16_t wav_bits_per_sample_;  // 16 or 24
   VideoSystem system_;
-  size_t frame_count_;
-
-  mutable std::once_flag convert_once_;
-  mutable std::vector<std::vector<int32_t>> frame_blocks_;
+  std::unique_ptr<StreamingAudioResampler> resampler_;
 };
 
 // ============================================================================
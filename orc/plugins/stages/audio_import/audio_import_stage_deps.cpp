@@ -9,6 +9,7 @@
 
 #include "audio_import_stage_deps.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <fstream>
@@ -146,15 +147,20 @@ WavProbeResult AudioImportDeps::open(const std::string& wav_path) {
   return result;
 }
 
-std::vector<int16_t> AudioImportDeps::read_all_pairs_16() const {
-  if (wav_path_.empty() || bits_per_sample_ != 16 || data_pairs_ == 0) {
+std::vector<int16_t> AudioImportDeps::read_pairs_16(uint64_t first_pair,
+                                                    size_t count) const {
+  if (wav_path_.empty() || bits_per_sample_ != 16 ||
+      first_pair >= data_pairs_) {
     return {};
   }
+  const auto pairs =
+      static_cast<size_t>(std::min<uint64_t>(count, data_pairs_ - first_pair));
 
   std::ifstream file(wav_path_, std::ios::binary);
   if (!file) return {};
-  file.seekg(static_cast<std::streamoff>(data_offset_), std::ios::beg);
-  std::vector<int16_t> samples(static_cast<size_t>(data_pairs_) * 2);
+  file.seekg(static_cast<std::streamoff>(data_offset_ + first_pair * 4),
+             std::ios::beg);
+  std::vector<int16_t> samples(pairs * 2);
   file.read(reinterpret_cast<char*>(samples.data()),
             static_cast<std::streamsize>(samples.size() * sizeof(int16_t)));
   const auto words_read = static_cast<size_t>(file.gcount()) / sizeof(int16_t);
@@ -162,15 +168,20 @@ std::vector<int16_t> AudioImportDeps::read_all_pairs_16() const {
   return samples;
 }
 
-std::vector<int32_t> AudioImportDeps::read_all_pairs_24() const {
-  if (wav_path_.empty() || bits_per_sample_ != 24 || data_pairs_ == 0) {
+std::vector<int32_t> AudioImportDeps::read_pairs_24(uint64_t first_pair,
+                                                    size_t count) const {
+  if (wav_path_.empty() || bits_per_sample_ != 24 ||
+      first_pair >= data_pairs_) {
     return {};
   }
+  const auto pairs =
+      static_cast<size_t>(std::min<uint64_t>(count, data_pairs_ - first_pair));
 
   std::ifstream file(wav_path_, std::ios::binary);
   if (!file) return {};
-  file.seekg(static_cast<std::streamoff>(data_offset_), std::ios::beg);
-  std::vector<uint8_t> bytes(static_cast<size_t>(data_pairs_) * 6);
+  file.seekg(static_cast<std::streamoff>(data_offset_ + first_pair * 6),
+             std::ios::beg);
+  std::vector<uint8_t> bytes(pairs * 6);
   file.read(reinterpret_cast<char*>(bytes.data()),
             static_cast<std::streamsize>(bytes.size()));
   const auto pairs_read = static_cast<size_t>(file.gcount()) / 6;
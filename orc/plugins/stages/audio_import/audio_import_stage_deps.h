@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -20,12 +21,14 @@ namespace orc {
 
 // Production implementation: walks the RIFF chunk list to validate the
 // format ("fmt " chunk: PCM, stereo, 16- or 24-bit) and locate the "data"
-// chunk, then serves whole-chunk sample reads from it.
+// chunk, then serves ranged sample reads from it.
 class AudioImportDeps : public IAudioImportDeps {
  public:
   WavProbeResult open(const std::string& wav_path) override;
-  std::vector<int16_t> read_all_pairs_16() const override;
-  std::vector<int32_t> read_all_pairs_24() const override;
+  std::vector<int16_t> read_pairs_16(uint64_t first_pair,
+                                     size_t count) const override;
+  std::vector<int32_t> read_pairs_24(uint64_t first_pair,
+                                     size_t count) const override;
 
  private:
   std::string wav_path_;
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -29,13 +30,13 @@ struct WavProbeResult {
   uint64_t pair_count{0};       // stereo pairs in the data chunk
 };
 
-// Dependency seam for AudioImportStage: probes the WAV header and serves the
-// data chunk as interleaved stereo samples. Split out so unit tests can mock
-// the file access (no filesystem in unit tests).
+// Dependency seam for AudioImportStage: probes the WAV header and serves
+// ranges of the data chunk as interleaved stereo samples. Split out so unit
+// tests can mock the file access (no filesystem in unit tests).
 //
-// The whole data chunk is read in one call because ingest conversion
-// (widening + SoXR resampling to the synchronous 48 kHz form) operates on
-// the complete stream.
+// Ingest conversion (widening + SoXR resampling to the synchronous 48 kHz
+// form) streams the data chunk through StreamingAudioResampler, which reads
+// it a chunk at a time as frames are requested.
 //
 // Thread safety: open() is called once before the wrapped representation is
 // published; the read methods may then be called concurrently from any
@@ -48,15 +49,17 @@ class IAudioImportDeps {
   // file and the read methods serve its data chunk.
   virtual WavProbeResult open(const std::string& wav_path) = 0;
 
-  // Entire data chunk of a 16-bit file as interleaved stereo samples
-  // (native 16-bit values, not widened; whole pairs only). Empty when the
+  // Up to |count| stereo pairs of a 16-bit file's data chunk from pair
+  // |first_pair|, interleaved (native 16-bit values, not widened; whole
+  // pairs only). Short at the end of the chunk; empty past it or when the
   // opened file is not 16-bit.
-  virtual std::vector<int16_t> read_all_pairs_16() const = 0;
+  virtual std::vector<int16_t> read_pairs_16(uint64_t first_pair,
+                                             size_t count) const = 0;
 
-  // Entire data chunk of a 24-bit file, each 3-byte little-endian sample
-  // unpacked and sign-extended into the 24-bit-in-int32 carrier (whole pairs
-  // only). Empty when the opened file is not 24-bit.
-  virtual std::vector<int32_t> read_all_pairs_24() const = 0;
+  // As read_pairs_16() for a 24-bit file, each 3-byte little-endian sample
+  // unpacked and sign-extended into the 24-bit-in-int32 carrier.
+  virtual std::vector<int32_t> read_pairs_24(uint64_t first_pair,
+                                             size_t count) const = 0;
 };
 
 }  // namespace orc
@@ -26,21 +26,22 @@ uint32_t clamp_to_uint32(uint64_t value) {
              : static_cast<uint32_t>(value);
 }
 
-// Pack the 24-bit-in-int32 pipeline carrier into 24-bit signed LE PCM:
-// exactly |expected_values| samples (2 × stereo pairs), zero-padded when the
-// input is short, truncated when long, saturated to the 24-bit range
-// defensively (producers already guarantee cadence-sized, in-range frames).
-std::vector<uint8_t> pack_s24le(const std::vector<int32_t>& samples,
-                                size_t expected_values) {
-  std::vector<uint8_t> bytes(expected_values * 3, 0);
-  const size_t copy_values = std::min(samples.size(), expected_values);
-  for (size_t i = 0; i < copy_values; ++i) {
+// Frames per read_audio() call: large enough that a long export makes few
+// calls, small enough that cancel and progress stay responsive.
+constexpr uint64_t kFramesPerChunk = 25;
+
+// Pack |values| samples of the 24-bit-in-int32 pipeline carrier into 24-bit
+// signed LE PCM in |bytes|, saturated to the 24-bit range defensively
+// (producers already guarantee in-range samples).
+void pack_s24le(const int32_t* samples, size_t values,
+                std::vector<uint8_t>& bytes) {
+  bytes.resize(values * 3);
+  for (size_t i = 0; i < values; ++i) {
     const int32_t v = std::clamp(samples[i], -8388608, 8388607);
     bytes[i * 3] = static_cast<uint8_t>(v & 0xFF);
     bytes[i * 3 + 1] = static_cast<uint8_t>((v >> 8) & 0xFF);
     bytes[i * 3 + 2] = static_cast<uint8_t>((v >> 16) & 0xFF);
   }
-  return bytes;
 }
 
 }  // namespace
@@ -133,10 +134,16 @@ AudioSinkWriteResult AudioSinkStageDeps::write_audio_wav(
 
   writer->write(build_wav_header(clamp_to_uint32(total_pairs)));
 
+  // Cadence-sized payload in chunks of whole frames, read as one contiguous
+  // range each: pairs the input cannot serve come back as silence of the
+  // same size, keeping the payload aligned with the header and preserving
+  // A/V sync. The sample and byte buffers are reused across chunks.
   const uint64_t total_frames = frame_rng.count();
+  std::vector<int32_t> samples;
+  std::vector<uint8_t> bytes;
   uint64_t pairs_written = 0;
   uint64_t current_frame = 0;
-  for (FrameID fid = frame_rng.first; fid <= frame_rng.last; ++fid) {
+  while (current_frame < total_frames) {
     if (cancel_requested_ && cancel_requested_->load()) {
       writer->close();
       if (is_processing_) {
@@ -145,16 +152,20 @@ AudioSinkWriteResult AudioSinkStageDeps::write_audio_wav(
       return {false, 0, "Cancelled by user"};
     }
 
-    // Cadence-sized payload per frame: frames that yield no audio become
-    // silence of the same size, keeping the payload aligned with the header
-    // and preserving A/V sync.
-    const uint32_t frame_pairs = audio_pairs_in_frame(fid, system);
-    const auto samples = representation->get_audio_samples(pair, fid);
-    writer->write(pack_s24le(samples, static_cast<size_t>(frame_pairs) * 2));
-    pairs_written += frame_pairs;
-
-    ++current_frame;
-    if (progress_callback_ && current_frame % 10 == 0) {
+    const FrameID first = frame_rng.first + current_frame;
+    const uint64_t frames =
+        std::min(kFramesPerChunk, total_frames - current_frame);
+    const uint64_t start_pair = audio_pair_offset(first, system);
+    const size_t chunk_pairs = static_cast<size_t>(
+        audio_pair_offset(first + frames, system) - start_pair);
+    samples.resize(chunk_pairs * 2);
+    representation->read_audio(pair, start_pair, chunk_pairs, samples.data());
+    pack_s24le(samples.data(), samples.size(), bytes);
+    writer->write(bytes);
+    pairs_written += chunk_pairs;
+
+    current_frame += frames;
+    if (progress_callback_) {
       progress_callback_(current_frame, total_frames,
                          "Writing audio frame " +
                              std::to_string(current_frame) + "/" +
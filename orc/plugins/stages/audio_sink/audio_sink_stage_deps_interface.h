@@ -27,9 +27,9 @@ class IAudioSinkStageDeps {
   virtual ~IAudioSinkStageDeps() = default;
 
   // Write the audio channel pair |pair| to output_path as a stereo 24-bit
-  // signed LE WAV at kAudioSampleRateHz (48000 Hz). Samples are gathered per
-  // frame via get_audio_samples(); frames that yield no audio are written as
-  // silence sized by audio_pairs_in_frame().
+  // signed LE WAV at kAudioSampleRateHz (48000 Hz). Samples are streamed in
+  // multi-frame ranges via read_audio(); pairs the input cannot serve are
+  // written as silence, so the payload always follows the cadence.
   virtual AudioSinkWriteResult write_audio_wav(
       const VideoFrameRepresentation* representation,
       const std::string& output_path, size_t pair) = 0;
@@ -18,7 +18,48 @@
 #include <utility>
 #include <variant>
 
+#include "progressive-analysis/local_observation_context.h"
+#include "progressive-analysis/progressive_analysis.h"
+
 namespace orc {
+namespace {
+// Running sum of the per-frame burst level over the frames of one bucket
+// analysed so far.
+struct BurstBucketAccumulator {
+  double sum = 0.0;
+  size_t count = 0;
+
+  void merge(const BurstBucketAccumulator& other) {
+    sum += other.sum;
+    count += other.count;
+  }
+};
+
+std::vector<FrameBurstLevelStats> build_frame_stats(
+    const std::vector<AnalysisBucket>& buckets,
+    const std::vector<BurstBucketAccumulator>& accums) {
+  std::vector<FrameBurstLevelStats> frame_stats;
+  frame_stats.reserve(buckets.size());
+  for (size_t b = 0; b < buckets.size(); ++b) {
+    FrameBurstLevelStats frame_stat;
+    // Use the center frame of the bucket as the representative frame number
+    // (1-based for display).
+    frame_stat.frame_number =
+        static_cast<int32_t>(buckets[b].first +
+                             (buckets[b].last - buckets[b].first) / 2U) +
+        1;
+    if (accums[b].count > 0) {
+      frame_stat.median_burst_10bit =
+          accums[b].sum / static_cast<double>(accums[b].count);
+      frame_stat.has_data = true;
+      frame_stat.field_count = accums[b].count;
+    }
+    frame_stats.push_back(frame_stat);
+  }
+  return frame_stats;
+}
+}  // namespace
+
 void BurstLevelAnalysisSinkStageDeps::init(
     TriggerProgressCallback progress_callback,
     std::atomic<bool>* cancel_requested) {
@@ -30,6 +71,11 @@ BurstAnalysisComputeResult BurstLevelAnalysisSinkStageDeps::compute_and_analyze(
     VideoFrameRepresentation* representation,
     IObservationContext& observation_context,
     BurstAnalysisComputeOptions options) {
+  // Workers observe into their own LocalObservationContext; the pipeline
+  // context is not thread-safe and the burst level observations are scratch
+  // values read back immediately, so nothing is written to it.
+  (void)observation_context;
+
   if (!representation) {
     return {false, "Input representation is null", {}, 0};
   }
@@ -47,110 +93,73 @@ BurstAnalysisComputeResult BurstLevelAnalysisSinkStageDeps::compute_and_analyze(
     return result;
   }
 
-  // A single observer session is reused across every sampled frame (the burst
-  // level observer holds no cross-frame state; its observation field is read
-  // and cleared each iteration). A null service — e.g. an older host — leaves
-  // the handle null and the per-frame observation is skipped.
-  std::unique_ptr<IObserverHandle> burst_level_handle;
-  if (observation_service_) {
-    burst_level_handle = observation_service_->create_observer("burst_level");
-  } else {
+  if (!observation_service_) {
     logger_.warn(
         "BurstLevelAnalysisSinkDeps: observation service unavailable; burst "
         "level observations skipped");
   }
 
-  // Bucket-sampled analysis: divide the recording into at most kDefaultBuckets
-  // display points and, within each bucket, analyze at most kSamplesPerBucket
-  // evenly-spaced frames.  For small sources (bucket size <= kSamplesPerBucket)
-  // every frame in the bucket is analyzed.  This keeps wall-clock time near-
-  // constant regardless of recording length.
+  // Progressive bucketed analysis: divide the recording into at most
+  // kDefaultBuckets display points. The coarse pass analyses the first frame
+  // of every bucket and is published immediately (the overview the sink has
+  // always produced); the refinement pass then folds every remaining frame of
+  // each bucket in, in parallel, so short burst-level excursions between
+  // coarse samples are not missed.
   constexpr uint64_t kDefaultBuckets = 1000;
-  constexpr uint64_t kSamplesPerBucket = 1;
-  const uint64_t bucket_count =
-      (total_frames < kDefaultBuckets) ? total_frames : kDefaultBuckets;
+  ProgressiveAnalysisConfig config;
+  config.refine = options.refine;
+  ProgressiveAnalysisEngine<BurstBucketAccumulator> engine(
+      make_even_analysis_buckets(frame_rng, kDefaultBuckets), config);
 
   logger_.debug(
-      "BurstLevelAnalysisSinkDeps: {} frames → {} buckets (~{} samples/bucket)",
-      total_frames, bucket_count, kSamplesPerBucket);
-
-  result.frame_stats.reserve(static_cast<size_t>(bucket_count));
-
-  for (uint64_t b = 0; b < bucket_count; ++b) {
-    if (cancel_requested_ && cancel_requested_->load()) {
-      logger_.warn("BurstLevelAnalysisSinkDeps: Cancel requested at bucket {}",
-                   b);
-      result.success = false;
-      result.message = "Cancelled by user";
-      result.frame_stats.clear();
-      result.total_frames = 0;
-      return result;
-    }
-
-    // Inclusive frame range for this bucket (no frame is missed or counted
-    // twice across adjacent buckets).
-    const FrameID bucket_start =
-        frame_rng.first + (b * total_frames) / bucket_count;
-    const FrameID bucket_end =
-        frame_rng.first + ((b + 1) * total_frames) / bucket_count - 1;
-    const uint64_t bucket_size = bucket_end - bucket_start + 1;
-    const uint64_t n_samples =
-        (kSamplesPerBucket < bucket_size) ? kSamplesPerBucket : bucket_size;
-
-    double sum = 0.0;
-    size_t count = 0;
-
-    for (uint64_t s = 0; s < n_samples; ++s) {
-      // Evenly distribute sample frames across the bucket so the first and last
-      // frames are always included.
-      const FrameID fid =
-          (n_samples == 1U)
-              ? bucket_start
-              : bucket_start + (s * (bucket_size - 1U)) / (n_samples - 1U);
-
-      if (burst_level_handle) {
-        burst_level_handle->process_frame(*representation, fid,
-                                          observation_context);
-      }
-
-      const FieldID frame_fid(fid * 2U);
-      auto val = observation_context.get(frame_fid, "burst_level",
-                                         "median_burst_10bit");
-      logger_.debug(
-          "BurstLevelAnalysisSinkDeps: fid={} field_id={} val_present={} "
-          "type_ok={}",
-          fid, frame_fid.value(), val.has_value(),
-          val.has_value() && std::holds_alternative<double>(*val));
+      "BurstLevelAnalysisSinkDeps: {} frames → {} buckets (refine={})",
+      total_frames, engine.buckets().size(), options.refine);
+
+  // One observer session and observation context per worker thread (the burst
+  // level observer holds no cross-frame state, but a handle must not be shared
+  // between threads). A null service leaves the handle null and the per-frame
+  // observation is skipped.
+  IObservationService* service = observation_service_;
+  const auto make_visitor = [service, representation]() {
+    std::shared_ptr<IObserverHandle> handle;
+    if (service) handle = service->create_observer("burst_level");
+    auto context = std::make_shared<LocalObservationContext>();
+    return [representation, handle, context](FrameID fid,
+                                             BurstBucketAccumulator& accum) {
+      if (!handle) return;
+      handle->process_frame(*representation, fid, *context);
+      const auto val = context->get(FieldID(fid * 2U), "burst_level",
+                                    "median_burst_10bit");
       if (val && std::holds_alternative<double>(*val)) {
-        sum += std::get<double>(*val);
-        ++count;
+        accum.sum += std::get<double>(*val);
+        ++accum.count;
       }
-      observation_context.clear_field(frame_fid);
-    }
-
-    FrameBurstLevelStats frame_stat;
-    // Use the center frame of the bucket as the representative frame number
-    // (1-based for display).
-    frame_stat.frame_number =
-        static_cast<int32_t>(bucket_start + (bucket_end - bucket_start) / 2U) +
-        1;
-
-    if (count > 0) {
-      frame_stat.median_burst_10bit = sum / static_cast<double>(count);
-      frame_stat.has_data = true;
-      frame_stat.field_count = count;
-    }
-
-    result.frame_stats.push_back(frame_stat);
-
-    if (progress_callback_ && (b % 50 == 0 || b + 1 == bucket_count)) {
-      progress_callback_(b + 1, bucket_count,
-                         "Analysing bucket " + std::to_string(b + 1) + "/" +
-                             std::to_string(bucket_count));
-    }
+      context->clear();
+    };
+  };
+
+  const int32_t total_frames_i32 = static_cast<int32_t>(total_frames);
+  const auto publish = [&](const std::vector<BurstBucketAccumulator>& accums,
+                           ProgressivePass pass) {
+    if (!options.on_partial_result) return;
+    options.on_partial_result(build_frame_stats(engine.buckets(), accums),
+                              total_frames_i32,
+                              pass == ProgressivePass::Complete);
+  };
+
+  const auto status =
+      engine.run(make_visitor, publish, progress_callback_, cancel_requested_);
+  if (status == ProgressiveAnalysisStatus::Cancelled) {
+    logger_.warn("BurstLevelAnalysisSinkDeps: Cancel requested");
+    result.success = false;
+    result.message = "Cancelled by user";
+    result.total_frames = 0;
+    return result;
   }
 
-  result.total_frames = static_cast<int32_t>(total_frames);
+  result.frame_stats =
+      build_frame_stats(engine.buckets(), engine.accumulators());
+  result.total_frames = total_frames_i32;
   logger_.debug(
       "BurstLevelAnalysisSinkDeps: Complete — {} buckets from {} frames",
       result.frame_stats.size(), total_frames);
@@ -17,15 +17,27 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
 #include "burst_level_analysis_types.h"
 
 namespace orc {
+// Receives intermediate datasets while compute_and_analyze() runs: first the
+// coarse one-frame-per-bucket result, then periodic snapshots as buckets are
+// refined to full-frame coverage, and finally the complete result (complete ==
+// true). Always invoked on the thread that called compute_and_analyze().
+using BurstAnalysisPartialResultCallback =
+    std::function<void(const std::vector<FrameBurstLevelStats>& frame_stats,
+                       int32_t total_frames, bool complete)>;
+
 struct BurstAnalysisComputeOptions {
   std::string output_path;
   bool write_csv{false};
+  // Refine every bucket to full-frame coverage after the coarse pass.
+  bool refine{true};
+  BurstAnalysisPartialResultCallback on_partial_result;
 };
 
 struct BurstAnalysisComputeResult {
@@ -160,14 +160,33 @@ bool BurstLevelAnalysisSinkStage::trigger(
     BurstAnalysisComputeOptions compute_options;
     compute_options.output_path = cfg.output_path;
     compute_options.write_csv = cfg.write_csv;
+    // Publish the coarse dataset as soon as it exists and replace it as
+    // buckets are refined, so results (and the CSV) are usable long before
+    // full-resolution coverage completes. The complete dataset is handled
+    // below once compute_and_analyze() returns.
+    compute_options.on_partial_result =
+        [this, &cfg, &deps](const std::vector<FrameBurstLevelStats>& stats,
+                            int32_t total_frames, bool complete) {
+          if (complete) return;
+          frame_stats_ = stats;
+          total_frames_ = total_frames;
+          has_results_ = true;
+          if (cfg.write_csv && !cfg.output_path.empty()) {
+            deps->write_csv(cfg.output_path, frame_stats_);
+          }
+        };
 
     const BurstAnalysisComputeResult compute_result = deps->compute_and_analyze(
         vfr.get(), observation_context, compute_options);
 
     if (!compute_result.success) {
-      has_results_ = false;
-      frame_stats_.clear();
-      total_frames_ = 0;
+      // A cancelled run keeps the last partial dataset it published (at least
+      // the coarse overview); any other failure discards it.
+      if (compute_result.message != "Cancelled by user") {
+        frame_stats_.clear();
+        total_frames_ = 0;
+      }
+      has_results_ = !frame_stats_.empty();
       last_status_ = compute_result.message.empty()
                          ? "Error: Burst level analysis failed"
                          : (compute_result.message == "Cancelled by user"
@@ -36,7 +36,9 @@ namespace orc {
  * @brief Burst Level Analysis Sink Stage
  *
  * Trigger to compute burst level stats across input fields. Optionally writes
- * CSV. Dataset is cached for GUI retrieval after trigger.
+ * CSV. Dataset is cached for GUI retrieval after trigger; the coarse
+ * one-frame-per-bucket dataset is available (has_results() true) while the
+ * full-resolution refinement is still running.
  */
 class BurstLevelAnalysisSinkStage : public DAGStage,
                                     public ParameterizedStage,
@@ -0,0 +1,223 @@
+/*
+ * File:        streaming_audio_resampler.cpp
+ * Module:      orc-audio-resample (shared stage-plugin library)
+ * Purpose:     Chunked, randomly addressable conversion of any-rate stereo
+ *              audio to the synchronous 48 kHz pipeline stream
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "streaming_audio_resampler.h"
+
+#include <orc/support/logging.h>
+#include <soxr.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace orc {
+
+namespace {
+
+// Output pairs per segment (one second), rounded down to a whole number of
+// rate-ratio periods.
+constexpr uint64_t kSegmentPairs = kAudioSampleRateHz;
+// Input pairs handed to SoXR per input callback.
+constexpr size_t kInputChunkPairs = 8192;
+// Segments kept converted; enough for a reader straddling a boundary plus
+// a few concurrent readers.
+constexpr size_t kCachedSegments = 4;
+
+}  // namespace
+
+StreamingAudioResampler::StreamingAudioResampler(InputReader reader,
+                                                 uint32_t in_rate_hz,
+                                                 VideoSystem system,
+                                                 size_t frame_count)
+    : reader_(std::move(reader)),
+      in_rate_hz_(in_rate_hz),
+      system_(system),
+      total_pairs_(0),
+      passthrough_(in_rate_hz == kAudioSampleRateHz) {
+  if (system_ == VideoSystem::Unknown || in_rate_hz_ == 0) return;
+  total_pairs_ = audio_pair_offset(frame_count, system_);
+
+  // Input pair k * period_in falls exactly on output pair k * period_out.
+  const uint64_t g = std::gcd<uint64_t>(in_rate_hz_, kAudioSampleRateHz);
+  const uint64_t period_in = in_rate_hz_ / g;
+  const uint64_t period_out = kAudioSampleRateHz / g;
+  const uint64_t periods = std::max<uint64_t>(1, kSegmentPairs / period_out);
+  segment_in_ = period_in * periods;
+  segment_out_ = period_out * periods;
+
+  // A quarter of a second lets the SoXR HQ filter settle after a restart.
+  const uint64_t settle = in_rate_hz_ / 4;
+  preroll_in_ = period_in * ((settle + period_in - 1) / period_in);
+}
+
+StreamingAudioResampler::~StreamingAudioResampler() { close(); }
+
+bool StreamingAudioResampler::read(uint64_t start_pair, size_t count,
+                                   int32_t* out) {
+  std::fill(out, out + count * 2, 0);
+  const uint64_t end = std::min<uint64_t>(start_pair + count, total_pairs_);
+  bool complete = start_pair + count <= total_pairs_;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (uint64_t pos = start_pair; pos < end;) {
+    const uint64_t index = pos / segment_out_;
+    const uint64_t first = index * segment_out_;
+    const uint64_t last = std::min(first + segment_out_, end);
+    const std::vector<int32_t>* samples = segment(index);
+    if (!samples) {
+      complete = false;
+      break;
+    }
+    std::copy(samples->begin() + static_cast<ptrdiff_t>((pos - first) * 2),
+              samples->begin() + static_cast<ptrdiff_t>((last - first) * 2),
+              out + (pos - start_pair) * 2);
+    pos = last;
+  }
+  return complete;
+}
+
+std::vector<int32_t> StreamingAudioResampler::frame_block(uint64_t frame) {
+  if (system_ == VideoSystem::Unknown ||
+      audio_pair_offset(frame, system_) >= total_pairs_) {
+    return {};
+  }
+  std::vector<int32_t> block(
+      static_cast<size_t>(audio_pairs_in_frame(frame, system_)) * 2);
+  read(audio_pair_offset(frame, system_), block.size() / 2, block.data());
+  return block;
+}
+
+size_t StreamingAudioResampler::segment_pairs(uint64_t index) const {
+  return static_cast<size_t>(
+      std::min(segment_out_, total_pairs_ - index * segment_out_));
+}
+
+const std::vector<int32_t>* StreamingAudioResampler::segment(uint64_t index) {
+  ++use_clock_;
+  for (Segment& cached : cache_) {
+    if (cached.index == index) {
+      cached.last_use = use_clock_;
+      return &cached.samples;
+    }
+  }
+
+  // Convert into a new slot, or over the least recently used one.
+  Segment* slot = nullptr;
+  if (cache_.size() < kCachedSegments) {
+    slot = &cache_.emplace_back();
+  } else {
+    slot = &*std::min_element(cache_.begin(), cache_.end(),
+                              [](const Segment& a, const Segment& b) {
+                                return a.last_use < b.last_use;
+                              });
+  }
+  if (!convert_segment(index, slot->samples)) {
+    slot->index = UINT64_MAX;
+    slot->last_use = 0;
+    return nullptr;
+  }
+  slot->index = index;
+  slot->last_use = use_clock_;
+  return &slot->samples;
+}
+
+bool StreamingAudioResampler::convert_segment(uint64_t index,
+                                              std::vector<int32_t>& samples) {
+  const size_t pairs = segment_pairs(index);
+  const uint64_t first_out = index * segment_out_;
+  samples.assign(pairs * 2, 0);
+
+  // Short reads leave the remainder silent, as resample_to_synchronous()
+  // pads short material.
+  if (passthrough_) {
+    reader_(first_out, pairs, samples.data());
+    return true;
+  }
+
+  // Past the end of a fully converted input there is only padding.
+  if (live_ && live_drained_ && first_out >= live_out_) return true;
+
+  if (!live_ || live_out_ != first_out) {
+    // Not the continuation of the live stream: restart one pre-roll before
+    // this segment's checkpoint and discard output up to it.
+    const uint64_t checkpoint = index * segment_in_;
+    if (!restart(checkpoint > preroll_in_ ? checkpoint - preroll_in_ : 0)) {
+      return false;
+    }
+    while (live_out_ < first_out) {
+      const size_t want = static_cast<size_t>(
+          std::min<uint64_t>(first_out - live_out_, kInputChunkPairs));
+      discard_.resize(want * 2);
+      const size_t got = soxr_output(live_, discard_.data(), want);
+      live_out_ += got;
+      if (got < want) {  // input ended inside the pre-roll
+        live_drained_ = true;
+        break;
+      }
+    }
+  }
+
+  if (live_out_ == first_out) {
+    const size_t got = soxr_output(live_, samples.data(), pairs);
+    live_out_ += got;
+    live_drained_ = got < pairs;
+  }
+  if (const soxr_error_t err = soxr_error(live_)) {
+    ORC_LOG_ERROR("StreamingAudioResampler: soxr_output failed: {}", err);
+    close();
+    return false;
+  }
+  return true;
+}
+
+bool StreamingAudioResampler::restart(uint64_t input_pair) {
+  close();
+
+  // Same SoXR configuration as AudioResampler::resample().
+  const soxr_io_spec_t io_spec = soxr_io_spec(SOXR_INT32_I, SOXR_INT32_I);
+  const soxr_quality_spec_t quality = soxr_quality_spec(SOXR_HQ, 0);
+  soxr_error_t err = nullptr;
+  live_ = soxr_create(static_cast<double>(in_rate_hz_),
+                      static_cast<double>(kAudioSampleRateHz), 2, &err,
+                      &io_spec, &quality, nullptr);
+  if (live_ && !err) {
+    err = soxr_set_input_fn(live_, &StreamingAudioResampler::soxr_input, this,
+                            kInputChunkPairs);
+  }
+  if (!live_ || err) {
+    ORC_LOG_ERROR("StreamingAudioResampler: soxr_create failed: {}",
+                  err ? err : "null handle");
+    close();
+    return false;
+  }
+
+  live_in_ = input_pair;
+  live_drained_ = false;
+  live_out_ = input_pair / segment_in_ * segment_out_ +
+              input_pair % segment_in_ * segment_out_ / segment_in_;
+  return true;
+}
+
+void StreamingAudioResampler::close() {
+  if (live_) soxr_delete(live_);
+  live_ = nullptr;
+}
+
+size_t StreamingAudioResampler::soxr_input(void* state, const void** data,
+                                           size_t requested) {
+  auto* self = static_cast<StreamingAudioResampler*>(state);
+  self->input_.resize(requested * 2);
+  const size_t got = self->reader_(self->live_in_, requested,
+                                   self->input_.data());
+  self->live_in_ += got;
+  *data = self->input_.data();
+  return got;  // 0 ends the input and flushes SoXR
+}
+
+}  // namespace orc
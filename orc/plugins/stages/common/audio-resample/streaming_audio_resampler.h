@@ -0,0 +1,123 @@
+/*
+ * File:        streaming_audio_resampler.h
+ * Module:      orc-audio-resample (shared stage-plugin library)
+ * Purpose:     Chunked, randomly addressable conversion of any-rate stereo
+ *              audio to the synchronous 48 kHz pipeline stream
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#pragma once
+
+#include <orc/stage/audio/audio_channel_pair.h>
+#include <orc/stage/common_types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+struct soxr;  // <soxr.h>
+
+namespace orc {
+
+// ---------------------------------------------------------------------------
+// StreamingAudioResampler
+// ---------------------------------------------------------------------------
+// The streaming counterpart of AudioResampler::resample_to_synchronous():
+// serves the same synchronous 48 kHz stream (SoXR HQ, zero-padded or
+// truncated to audio_pair_offset(frame_count) pairs), but pulls the input
+// through |reader| one chunk at a time instead of holding the whole
+// recording. Memory use is a few seconds of audio whatever the length of
+// the input, and the first frame is available after one segment has been
+// converted.
+//
+// The output is produced in segments of about one second. Segment
+// boundaries are checkpoints: each starts on an input pair whose time is an
+// exact multiple of the output sample period, so a fresh SoXR instance
+// started a short pre-roll before a checkpoint produces the same output
+// grid as one that ran from the start of the stream. Sequential reads keep
+// one SoXR instance running; a read elsewhere restarts it at the nearest
+// checkpoint. Recently converted segments are cached.
+//
+// 48000 Hz input is served straight from |reader|, without SoXR.
+//
+// Thread-safety: read() and frame_block() may be called from any thread;
+// conversions are serialised by an internal mutex.
+class StreamingAudioResampler {
+ public:
+  // Copies up to |count| input stereo pairs from input pair |first_pair|
+  // into |out| as interleaved 24-bit-in-int32 samples and returns the number
+  // of pairs copied; fewer than |count| (including 0) marks the end of the
+  // input.
+  using InputReader =
+      std::function<size_t(uint64_t first_pair, size_t count, int32_t* out)>;
+
+  StreamingAudioResampler(InputReader reader, uint32_t in_rate_hz,
+                          VideoSystem system, size_t frame_count);
+  ~StreamingAudioResampler();
+
+  StreamingAudioResampler(const StreamingAudioResampler&) = delete;
+  StreamingAudioResampler& operator=(const StreamingAudioResampler&) = delete;
+
+  // Length of the synchronous stream: audio_pair_offset(frame_count) pairs,
+  // or 0 for an unknown video system.
+  uint64_t total_pairs() const { return total_pairs_; }
+
+  // Fills |out| with |count| pairs of the synchronous stream starting at
+  // pair |start_pair|. Pairs past total_pairs() are silence and make the
+  // call return false; so does a SoXR failure, which leaves silence from
+  // the failing segment onwards.
+  bool read(uint64_t start_pair, size_t count, int32_t* out);
+
+  // One cadence-sized block (audio_pairs_in_frame(frame) pairs), the same
+  // block resample_to_synchronous() would return for |frame|. Empty past
+  // the last frame.
+  std::vector<int32_t> frame_block(uint64_t frame);
+
+ private:
+  struct Segment {
+    uint64_t index = 0;
+    uint64_t last_use = 0;
+    std::vector<int32_t> samples;
+  };
+
+  // Output pairs of segment |index| (the last one may be short).
+  size_t segment_pairs(uint64_t index) const;
+  // Cached or freshly converted samples of segment |index|. Called with
+  // mutex_ held.
+  const std::vector<int32_t>* segment(uint64_t index);
+  bool convert_segment(uint64_t index, std::vector<int32_t>& samples);
+
+  // Starts a fresh SoXR instance reading from input pair |input_pair|,
+  // which must be a checkpoint-aligned position.
+  bool restart(uint64_t input_pair);
+  void close();
+  static size_t soxr_input(void* state, const void** data, size_t requested);
+
+  InputReader reader_;
+  uint32_t in_rate_hz_;
+  VideoSystem system_;
+  uint64_t total_pairs_;
+  bool passthrough_;
+
+  // Input and output pairs between checkpoints (the rate ratio in lowest
+  // terms, scaled up to about one second of output).
+  uint64_t segment_in_ = 0;
+  uint64_t segment_out_ = 0;
+  uint64_t preroll_in_ = 0;  // multiple of the ratio's input term
+
+  std::mutex mutex_;
+  soxr* live_ = nullptr;   // running SoXR instance, if any
+  uint64_t live_in_ = 0;   // next input pair it will read
+  uint64_t live_out_ = 0;  // next output pair it will produce
+  bool live_drained_ = false;  // input ended and all output produced
+  std::vector<int32_t> input_;
+  std::vector<int32_t> discard_;
+  std::vector<Segment> cache_;
+  uint64_t use_clock_ = 0;
+};
+
+}  // namespace orc
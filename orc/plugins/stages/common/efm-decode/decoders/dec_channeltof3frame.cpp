@@ -13,12 +13,17 @@
 #include <algorithm>
 #include <cmath>
 #include <queue>
+#include <utility>
 
 #include "efm_constants.h"
 #include "efm_exception.h"
 
 ChannelToF3Frame::ChannelToF3Frame() {
   // Statistics
+  resetStatistics();
+}
+
+void ChannelToF3Frame::resetStatistics() {
   m_goodFrames = 0;
   m_undershootFrames = 0;
   m_overshootFrames = 0;
@@ -30,20 +35,26 @@ ChannelToF3Frame::ChannelToF3Frame() {
   m_invalidSubcodeSymbols = 0;
 }
 
-void ChannelToF3Frame::pushFrame(const std::vector<uint8_t>& data) {
-  // Add the data to the input buffer
-  m_inputBuffer.push(data);
+void ChannelToF3Frame::mergeStatistics(const ChannelToF3Frame& other) {
+  m_goodFrames += other.m_goodFrames;
+  m_undershootFrames += other.m_undershootFrames;
+  m_overshootFrames += other.m_overshootFrames;
+
+  m_validEfmSymbols += other.m_validEfmSymbols;
+  m_invalidEfmSymbols += other.m_invalidEfmSymbols;
 
-  // Process queue
-  processQueue();
+  m_validSubcodeSymbols += other.m_validSubcodeSymbols;
+  m_invalidSubcodeSymbols += other.m_invalidSubcodeSymbols;
 }
 
-void ChannelToF3Frame::pushFrame(std::vector<uint8_t>&& data) {
-  // Move the data into the input buffer to avoid a deep copy.
-  m_inputBuffer.push(std::move(data));
+void ChannelToF3Frame::pushFrame(const std::vector<uint8_t>& data) {
+  // Each channel frame is converted as soon as it arrives, so there is no
+  // need to copy it into an input queue first.
+  processFrame(data);
+}
 
-  // Process queue
-  processQueue();
+void ChannelToF3Frame::pushFrame(std::vector<uint8_t>&& data) {
+  processFrame(data);
 }
 
 F3Frame ChannelToF3Frame::popFrame() {
@@ -58,35 +69,29 @@ bool ChannelToF3Frame::isReady() const {
   return !m_outputBuffer.empty();
 }
 
-void ChannelToF3Frame::processQueue() {
-  while (!m_inputBuffer.empty()) {
-    // Extract the first item in the input buffer
-    std::vector<uint8_t> frameData = m_inputBuffer.front();
-    m_inputBuffer.pop();
-
-    // Count the number of bits in the frame
-    int bitCount = 0;
-    for (int i = 0; i < frameData.size(); ++i) {
-      bitCount += frameData.at(i);
-    }
+void ChannelToF3Frame::processFrame(const std::vector<uint8_t>& frameData) {
+  // Count the number of bits in the frame
+  int bitCount = 0;
+  for (int i = 0; i < frameData.size(); ++i) {
+    bitCount += frameData.at(i);
+  }
 
-    // Generate statistics
-    if (bitCount != efm::kEfmFrameChannelBits) {
-      ORC_LOG_DEBUG(
-          "ChannelToF3Frame::processQueue() - Frame data is {} bits (should be "
-          "588)",
-          bitCount);
-    }
-    if (bitCount == efm::kEfmFrameChannelBits) m_goodFrames++;
-    if (bitCount < efm::kEfmFrameChannelBits) m_undershootFrames++;
-    if (bitCount > efm::kEfmFrameChannelBits) m_overshootFrames++;
+  // Generate statistics
+  if (bitCount != efm::kEfmFrameChannelBits) {
+    ORC_LOG_DEBUG(
+        "ChannelToF3Frame::processFrame() - Frame data is {} bits (should be "
+        "588)",
+        bitCount);
+  }
+  if (bitCount == efm::kEfmFrameChannelBits) m_goodFrames++;
+  if (bitCount < efm::kEfmFrameChannelBits) m_undershootFrames++;
+  if (bitCount > efm::kEfmFrameChannelBits) m_overshootFrames++;
 
-    // Create an F3 frame
-    F3Frame f3Frame = createF3Frame(frameData);
+  // Create an F3 frame
+  F3Frame f3Frame = createF3Frame(frameData);
 
-    // Place the frame into the output buffer
-    m_outputBuffer.push(f3Frame);
-  }
+  // Place the frame into the output buffer
+  m_outputBuffer.push(std::move(f3Frame));
 }
 
 F3Frame ChannelToF3Frame::createF3Frame(const std::vector<uint8_t>& tValues) {
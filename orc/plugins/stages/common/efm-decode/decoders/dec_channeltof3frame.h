@@ -26,8 +26,13 @@ class ChannelToF3Frame : public Decoder {
 
   void showStatistics() const;
 
+  // Segmented decode support (see SegmentedFrontEnd). The decoder has no
+  // state beyond its statistics: each channel frame is converted on its own.
+  void resetStatistics();
+  void mergeStatistics(const ChannelToF3Frame& other);
+
  private:
-  void processQueue();
+  void processFrame(const std::vector<uint8_t>& frameData);
   F3Frame createF3Frame(const std::vector<uint8_t>& data);
 
   std::vector<uint8_t> tvaluesToData(const std::vector<uint8_t>& tvalues);
@@ -35,7 +40,6 @@ class ChannelToF3Frame : public Decoder {
 
   Efm m_efm;
 
-  std::queue<std::vector<uint8_t>> m_inputBuffer;
   std::queue<F3Frame> m_outputBuffer;
 
   // Statistics
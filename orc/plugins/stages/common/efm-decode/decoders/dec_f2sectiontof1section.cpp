@@ -38,7 +38,9 @@ F2SectionToF1Section::F2SectionToF1Section()
       m_invalidNonPaddedF1FramesCount(0),
       m_lastFrameNumber(-1),
       m_haveSectionMetadata(false),
-      m_draining(false) {}
+      m_draining(false) {
+  m_frames.resize(efm::kFramesPerSection);
+}
 
 void F2SectionToF1Section::pushSection(const F2Section& f2Section) {
   // Add the data to the input buffer
@@ -112,9 +114,12 @@ void F2SectionToF1Section::processQueue() {
 
     for (int index = 0; index < efm::kFramesPerSection; index++) {
       const F2Frame& f2Frame = f2Section.frame(index);
-      std::vector<uint8_t> data = f2Frame.data();
-      std::vector<uint8_t> errorData = f2Frame.errorData();
-      std::vector<uint8_t> paddedData = f2Frame.paddedData();
+      CircFrame& frame = m_frames[index];
+      frame.data.assign(f2Frame.data().begin(), f2Frame.data().end());
+      frame.errorData.assign(f2Frame.errorData().begin(),
+                             f2Frame.errorData().end());
+      frame.paddedData.assign(f2Frame.paddedData().begin(),
+                              f2Frame.paddedData().end());
 
       // Check F2 frame for errors (counts only when errorData = 1)
       uint32_t inFrameErrors = f2Frame.countErrors();
@@ -124,10 +129,8 @@ void F2SectionToF1Section::processQueue() {
         m_invalidInputF2FramesCount++;
         m_inputByteErrors += inFrameErrors;
       }
-
-      processF2FrameData(std::move(data), std::move(errorData),
-                         std::move(paddedData), f1Section);
     }
+    decodeSectionFrames(f1Section);
 
     // All frames in the section are processed
     f1Section.metadata = f2Section.metadata;
@@ -160,73 +163,110 @@ void F2SectionToF1Section::pushSubstituteF1Frame(F1Section& f1Section) {
   if (!m_draining) m_warmupLostFramesCount++;
 }
 
-void F2SectionToF1Section::processF2FrameData(std::vector<uint8_t> data,
-                                              std::vector<uint8_t> errorData,
-                                              std::vector<uint8_t> paddedData,
-                                              F1Section& f1Section) {
-  m_delayLine1.push(data, errorData, paddedData);
-  if (data.empty()) {
-    pushSubstituteF1Frame(f1Section);
-    return;
+void F2SectionToF1Section::decodeSectionFrames(F1Section& f1Section) {
+  constexpr size_t kC1Length = 32;
+  constexpr size_t kC2Length = 28;
+  constexpr size_t kRoots = ReedSolomon::kSyndromes;
+  const int32_t frameCount = static_cast<int32_t>(m_frames.size());
+
+  // Delay line 1 and parity inversion. Note: We will only get valid data once
+  // the delay lines are all full; until then a line returns empty vectors.
+  m_codewords.resize(frameCount * kC1Length);
+  m_c1Frames.clear();
+  for (int32_t index = 0; index < frameCount; ++index) {
+    CircFrame& frame = m_frames[index];
+    m_delayLine1.push(frame.data, frame.errorData, frame.paddedData);
+    if (frame.data.empty()) continue;
+
+    m_inverter.invertParity(frame.data);
+    std::copy(frame.data.begin(), frame.data.end(),
+              m_codewords.begin() + m_c1Frames.size() * kC1Length);
+    m_c1Frames.push_back(index);
   }
 
-  // Process the data
-  // Note: We will only get valid data if the delay lines are all full
-  m_inverter.invertParity(data);
-
-  m_circ.c1Decode(data, errorData, paddedData);
-
-  m_delayLineM.push(data, errorData, paddedData);
-  if (data.empty()) {
-    pushSubstituteF1Frame(f1Section);
-    return;
+  // C1 decode, then delay line M
+  m_syndromes.resize(m_c1Frames.size() * kRoots);
+  ReedSolomon::c1Syndromes(m_codewords.data(), kC1Length, m_c1Frames.size(),
+                           m_syndromes.data());
+  m_c2Frames.clear();
+  for (size_t word = 0; word < m_c1Frames.size(); ++word) {
+    CircFrame& frame = m_frames[m_c1Frames[word]];
+    m_circ.c1Decode(frame.data, frame.errorData, frame.paddedData,
+                    &m_syndromes[word * kRoots]);
+
+    m_delayLineM.push(frame.data, frame.errorData, frame.paddedData);
+    if (frame.data.empty()) continue;
+
+    std::copy(frame.data.begin(), frame.data.end(),
+              m_codewords.begin() + m_c2Frames.size() * kC2Length);
+    m_c2Frames.push_back(m_c1Frames[word]);
   }
 
-  // Only perform C2 decode if delay line 1 is full and delay line M is full
-  m_circ.c2Decode(data, errorData, paddedData);
+  // Only perform C2 decode if delay line 1 is full and delay line M is full.
+  // The C1 codewords are finished with (their syndromes are taken), so the
+  // C2 codewords reuse the buffer.
+  m_syndromes.resize(m_c2Frames.size() * kRoots);
+  ReedSolomon::c2Syndromes(m_codewords.data(), kC2Length, m_c2Frames.size(),
+                           m_syndromes.data());
+
+  // C2 decode, de-interleave and delay line 2, emitting the F1 frames in
+  // stream order. A frame still held by one of the delay lines gets a
+  // substitute in its place.
+  size_t word = 0;
+  for (int32_t index = 0; index < frameCount; ++index) {
+    if (word == m_c2Frames.size() || m_c2Frames[word] != index) {
+      pushSubstituteF1Frame(f1Section);
+      continue;
+    }
 
-  if (std::any_of(errorData.begin(), errorData.end(),
-                  [](uint8_t value) { return value != 0; })) {
-    ORC_LOG_DEBUG("F2SectionToF1Section - F2 Frame: C2 Failed");
-  }
+    CircFrame& frame = m_frames[index];
+    m_circ.c2Decode(frame.data, frame.errorData, frame.paddedData,
+                    &m_syndromes[word * kRoots]);
+    ++word;
 
-  m_interleave.deinterleave(data, errorData, paddedData);
+    if (std::any_of(frame.errorData.begin(), frame.errorData.end(),
+                    [](uint8_t value) { return value != 0; })) {
+      ORC_LOG_DEBUG("F2SectionToF1Section - F2 Frame: C2 Failed");
+    }
 
-  m_delayLine2.push(data, errorData, paddedData);
-  if (data.empty()) {
-    pushSubstituteF1Frame(f1Section);
-    return;
-  }
+    m_interleave.deinterleave(frame.data, frame.errorData, frame.paddedData);
 
-  // Put the resulting data (and error data) into an F1 frame and
-  // push it to the output buffer
-  F1Frame f1Frame;
-  f1Frame.setData(data);
-  f1Frame.setErrorData(errorData);
-  f1Frame.setPaddedData(paddedData);
-
-  // Check F1 frame for errors
-  // Note: The error C2 count will differ from the overall error F1 count
-  // due to the the interleaving which will distribute the errors over more
-  // than on frame (potentially)
-  uint32_t outFrameErrors = f1Frame.countErrors();
-  uint32_t outFramePadding = f1Frame.countPadded();
-
-  if (outFrameErrors == 0 && outFramePadding == 0) {
-    m_validOutputF1FramesCount++;
-  } else {
-    m_invalidOutputF1FramesCount++;
-    m_outputByteErrors += outFrameErrors;
-
-    // Invalid with or without padding?
-    if (outFramePadding > 0) {
-      m_invalidPaddedF1FramesCount++;
+    m_delayLine2.push(frame.data, frame.errorData, frame.paddedData);
+    if (frame.data.empty()) {
+      pushSubstituteF1Frame(f1Section);
+      continue;
+    }
+
+    // Put the resulting data (and error data) into an F1 frame and
+    // push it to the output buffer
+    F1Frame f1Frame;
+    f1Frame.setData(frame.data);
+    f1Frame.setErrorData(frame.errorData);
+    f1Frame.setPaddedData(frame.paddedData);
+
+    // Check F1 frame for errors
+    // Note: The error C2 count will differ from the overall error F1 count
+    // due to the the interleaving which will distribute the errors over more
+    // than on frame (potentially)
+    uint32_t outFrameErrors = f1Frame.countErrors();
+    uint32_t outFramePadding = f1Frame.countPadded();
+
+    if (outFrameErrors == 0 && outFramePadding == 0) {
+      m_validOutputF1FramesCount++;
     } else {
-      m_invalidNonPaddedF1FramesCount++;
+      m_invalidOutputF1FramesCount++;
+      m_outputByteErrors += outFrameErrors;
+
+      // Invalid with or without padding?
+      if (outFramePadding > 0) {
+        m_invalidPaddedF1FramesCount++;
+      } else {
+        m_invalidNonPaddedF1FramesCount++;
+      }
     }
-  }
 
-  f1Section.pushFrame(f1Frame);
+    f1Section.pushFrame(f1Frame);
+  }
 }
 
 void F2SectionToF1Section::flush() {
@@ -261,12 +301,13 @@ void F2SectionToF1Section::flush() {
     metadata.setSectionTime(metadata.sectionTime() + 1);
 
     F1Section f1Section;
-    for (int32_t index = 0; index < kFramesPerSection; ++index) {
+    for (CircFrame& frame : m_frames) {
       // Feed an all-padding F2 frame (32 symbols) into the chain.
-      processF2FrameData(std::vector<uint8_t>(32, 0),
-                         std::vector<uint8_t>(32, 0),
-                         std::vector<uint8_t>(32, 1), f1Section);
+      frame.data.assign(32, 0);
+      frame.errorData.assign(32, 0);
+      frame.paddedData.assign(32, 1);
     }
+    decodeSectionFrames(f1Section);
     f1Section.metadata = metadata;
     m_outputBuffer.push_back(f1Section);
     // Every frame emitted by the drain is filler-contaminated: it was assembled
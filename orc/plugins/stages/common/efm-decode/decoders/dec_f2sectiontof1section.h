@@ -54,13 +54,14 @@ class F2SectionToF1Section : public Decoder {
  private:
   void processQueue();
 
-  // Push a single F2 frame's data through the CIRC delay-line / Reed-Solomon
-  // chain, appending exactly one F1 frame to f1Section (a padded substitute
-  // while the delay lines are still filling, otherwise the decoded frame).
-  void processF2FrameData(std::vector<uint8_t> data,
-                          std::vector<uint8_t> errorData,
-                          std::vector<uint8_t> paddedData,
-                          F1Section& f1Section);
+  // Push the section's F2 frames (loaded into m_frames) through the CIRC
+  // delay-line / Reed-Solomon chain, appending exactly one F1 frame per F2
+  // frame to f1Section (a padded substitute while the delay lines are still
+  // filling, otherwise the decoded frame). The chain runs a stage at a time
+  // over the whole section so the C1 and C2 syndromes of all its codewords
+  // can be computed in one batch; each delay line still sees its frames in
+  // stream order, so the result is the same as running frame by frame.
+  void decodeSectionFrames(F1Section& f1Section);
 
   // Append a padded substitute F1 frame (fabricated filler emitted while the
   // CIRC delay lines fill; marked padded=1 so downstream never mistakes the
@@ -71,6 +72,22 @@ class F2SectionToF1Section : public Decoder {
                 const std::string& timeString, std::vector<uint8_t>& data,
                 std::vector<uint8_t>& dataError);
 
+  // One frame's symbols on their way through the CIRC chain. The vectors are
+  // reused from section to section, so their capacity is kept (P-6).
+  struct CircFrame {
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> errorData;
+    std::vector<uint8_t> paddedData;
+  };
+  std::vector<CircFrame> m_frames;
+
+  // Codewords gathered for the batch syndrome computation, and the indices of
+  // the frames they came from (frames still filling a delay line have none).
+  std::vector<uint8_t> m_codewords;
+  std::vector<uint8_t> m_syndromes;
+  std::vector<int32_t> m_c1Frames;
+  std::vector<int32_t> m_c2Frames;
+
   std::deque<F2Section> m_inputBuffer;
   std::deque<F1Section> m_outputBuffer;
 
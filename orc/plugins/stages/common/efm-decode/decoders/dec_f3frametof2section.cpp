@@ -10,6 +10,7 @@
 
 #include <orc/support/logging.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 
@@ -22,6 +23,7 @@ F3FrameToF2Section::F3FrameToF2Section()
       m_currentState(ExpectingInitialSync),
       m_inputF3Frames(0),
       m_presyncDiscardedF3Frames(0),
+      m_presyncDiscardRestarted(false),
       m_goodSync0(0),
       m_missingSync0(0),
       m_undershootSync0(0),
@@ -101,6 +103,7 @@ F3FrameToF2Section::State F3FrameToF2Section::expectingInitialSync() {
         "discarding {} frames",
         m_presyncDiscardedF3Frames);
     m_presyncDiscardedF3Frames = 0;
+    m_presyncDiscardRestarted = true;
     nextState = ExpectingSync;
   } else {
     m_presyncDiscardedF3Frames += m_internalBuffer.size();
@@ -347,6 +350,78 @@ void F3FrameToF2Section::outputSection(bool showAddress) {
   }
 }
 
+namespace {
+
+bool sameF3Frame(const F3Frame& a, const F3Frame& b) {
+  return a.f3FrameType() == b.f3FrameType() &&
+         a.subcodeByte() == b.subcodeByte() && a.data() == b.data() &&
+         a.errorData() == b.errorData() && a.paddedData() == b.paddedData();
+}
+
+bool sameF3Frames(const std::vector<F3Frame>& a,
+                  const std::vector<F3Frame>& b) {
+  return a.size() == b.size() &&
+         std::equal(a.begin(), a.end(), b.begin(), sameF3Frame);
+}
+
+}  // namespace
+
+bool F3FrameToF2Section::hasSameDecodeState(
+    const F3FrameToF2Section& other) const {
+  // Queued output is not decode state; callers compare drained decoders.
+  if (isReady() || other.isReady()) return false;
+  if (m_currentState != other.m_currentState ||
+      m_badSyncCounter != other.m_badSyncCounter) {
+    return false;
+  }
+  // Only the absolute time of the last valid section is consulted (by the
+  // repaired-Q-channel sanity check in outputSection()).
+  if (m_lastSectionMetadata.absoluteSectionTime().frames() !=
+      other.m_lastSectionMetadata.absoluteSectionTime().frames()) {
+    return false;
+  }
+  if (!sameF3Frames(m_internalBuffer, other.m_internalBuffer)) return false;
+  // The pending section frames are consumed by the next transition in the
+  // handle states and overwritten before use in all others.
+  const bool sectionPending = m_currentState == HandleValid ||
+                              m_currentState == HandleUndershoot ||
+                              m_currentState == HandleOvershoot;
+  return !sectionPending ||
+         sameF3Frames(m_sectionFrames, other.m_sectionFrames);
+}
+
+void F3FrameToF2Section::resetStatistics() {
+  m_inputF3Frames = 0;
+  m_presyncDiscardedF3Frames = 0;
+  m_presyncDiscardRestarted = false;
+  m_goodSync0 = 0;
+  m_missingSync0 = 0;
+  m_undershootSync0 = 0;
+  m_overshootSync0 = 0;
+  m_discardedF3Frames = 0;
+  m_paddedF3Frames = 0;
+  m_lostSyncCounter = 0;
+}
+
+void F3FrameToF2Section::mergeStatistics(const F3FrameToF2Section& other) {
+  m_inputF3Frames += other.m_inputF3Frames;
+  // The pre-sync discard count only covers the frames since the most recent
+  // initial sync, so a later restart replaces rather than adds to it.
+  if (other.m_presyncDiscardRestarted) {
+    m_presyncDiscardedF3Frames = other.m_presyncDiscardedF3Frames;
+    m_presyncDiscardRestarted = true;
+  } else {
+    m_presyncDiscardedF3Frames += other.m_presyncDiscardedF3Frames;
+  }
+  m_goodSync0 += other.m_goodSync0;
+  m_missingSync0 += other.m_missingSync0;
+  m_undershootSync0 += other.m_undershootSync0;
+  m_overshootSync0 += other.m_overshootSync0;
+  m_discardedF3Frames += other.m_discardedF3Frames;
+  m_paddedF3Frames += other.m_paddedF3Frames;
+  m_lostSyncCounter += other.m_lostSyncCounter;
+}
+
 void F3FrameToF2Section::showStatistics() const {
   ORC_LOG_INFO("F3 Frame to F2 Section statistics:");
   ORC_LOG_INFO("  F3 Frames:");
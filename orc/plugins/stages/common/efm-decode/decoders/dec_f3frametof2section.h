@@ -27,6 +27,12 @@ class F3FrameToF2Section : public Decoder {
 
   void showStatistics() const;
 
+  // Segmented decode support (see SegmentedFrontEnd). Two decoders with the
+  // same decode state produce identical sections from identical input.
+  bool hasSameDecodeState(const F3FrameToF2Section& other) const;
+  void resetStatistics();
+  void mergeStatistics(const F3FrameToF2Section& other);
+
  private:
   void processStateMachine();
   void outputSection(bool showAddress);
@@ -61,7 +67,8 @@ class F3FrameToF2Section : public Decoder {
 
   // Statistics
   uint64_t m_inputF3Frames;
-  uint64_t m_presyncDiscardedF3Frames;
+  uint64_t m_presyncDiscardedF3Frames;  // restarts at every initial sync
+  bool m_presyncDiscardRestarted;        // restarted since resetStatistics()
   uint64_t m_goodSync0;
   uint64_t m_missingSync0;
   uint64_t m_undershootSync0;
@@ -13,50 +13,62 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <queue>
+#include <cstring>
 
 #include "efm_constants.h"
 #include "efm_exception.h"
 
 TvaluesToChannel::TvaluesToChannel() {
   // Statistics
-  m_consumedTValues = 0;
-  m_discardedTValues = 0;
-  m_channelFrameCount = 0;
-
-  m_perfectFrames = 0;
-  m_longFrames = 0;
-  m_shortFrames = 0;
-
-  m_overshootSyncs = 0;
-  m_undershootSyncs = 0;
-  m_perfectSyncs = 0;
+  resetStatistics();
 
   // Set the initial state
   m_currentState = ExpectingInitialSync;
 
   m_tvalueDiscardCount = 0;
+
+  m_head = 0;
+  m_outputRead = 0;
 }
 
 void TvaluesToChannel::pushFrame(const std::vector<uint8_t>& data) {
-  // P-7: append straight into the internal T-value buffer rather than staging
-  // through a one-element queue.
-  m_internalBuffer.insert(m_internalBuffer.end(), data.begin(), data.end());
+  // Drop the T-values consumed since the last call. processStateMachine()
+  // leaves at most kMaxTvalueBufferSize of them unconsumed, so this is one
+  // short move per chunk instead of an erase from the front per frame.
+  if (m_head > 0) {
+    m_tValues.erase(m_tValues.begin(),
+                    m_tValues.begin() + static_cast<std::ptrdiff_t>(m_head));
+    m_head = 0;
+  }
+  m_tValues.insert(m_tValues.end(), data.begin(), data.end());
 
   // Process the state machine
   processStateMachine();
 }
 
 std::vector<uint8_t> TvaluesToChannel::popFrame() {
-  // Move the first item out of the output buffer to avoid a deep copy.
-  std::vector<uint8_t> frame = std::move(m_outputBuffer.front());
-  m_outputBuffer.pop();
+  std::vector<uint8_t> frame;
+  popFrame(frame);
   return frame;
 }
 
+void TvaluesToChannel::popFrame(std::vector<uint8_t>& frame) {
+  const OutputFrame& next = m_outputFrames[m_outputRead++];
+  const uint8_t* first = m_outputTValues.data() + next.offset;
+  frame.assign(first, first + next.length);
+
+  // Once everything queued has been popped, rewind the output storage so the
+  // next batch of frames reuses it.
+  if (m_outputRead == m_outputFrames.size()) {
+    m_outputTValues.clear();
+    m_outputFrames.clear();
+    m_outputRead = 0;
+  }
+}
+
 bool TvaluesToChannel::isReady() const {
   // Return true if the output buffer is not empty
-  return !m_outputBuffer.empty();
+  return m_outputRead < m_outputFrames.size();
 }
 
 void TvaluesToChannel::processStateMachine() {
@@ -65,7 +77,7 @@ void TvaluesToChannel::processStateMachine() {
   // the maximum number of t-values we can have is 191.  This upper limit
   // is where we need to maintain the buffer size (at 382 for 2 frames).
 
-  while (m_internalBuffer.size() > efm::kMaxTvalueBufferSize) {
+  while (bufferedCount() > efm::kMaxTvalueBufferSize) {
     switch (m_currentState) {
       case ExpectingInitialSync:
         // ORC_LOG_DEBUG("TvaluesToChannel::processStateMachine() - State:
@@ -94,18 +106,8 @@ void TvaluesToChannel::processStateMachine() {
 TvaluesToChannel::State TvaluesToChannel::expectingInitialSync() {
   State nextState = ExpectingInitialSync;
 
-  // Expected sync header
-  std::vector<uint8_t> t11_t11 = {efm::kSyncSymbolT11, efm::kSyncSymbolT11};
-
   // Does the buffer contain a T11+T11 sequence?
-  auto it = std::search(m_internalBuffer.begin(), m_internalBuffer.end(),
-                        t11_t11.begin(), t11_t11.end());
-  int initialSyncIndex =
-      (it != m_internalBuffer.end())
-          ? static_cast<int>(std::distance(m_internalBuffer.begin(), it))
-          : -1;
-
-  if (initialSyncIndex != -1) {
+  if (findSync(0) != -1) {
     ORC_LOG_DEBUG(
         "TvaluesToChannel::expectingInitialSync() - Initial sync header "
         "found{}{}",
@@ -118,10 +120,8 @@ TvaluesToChannel::State TvaluesToChannel::expectingInitialSync() {
     nextState = ExpectingSync;
   } else {
     // Drop all but the last T-value in the buffer
-    m_tvalueDiscardCount += static_cast<int32_t>(m_internalBuffer.size()) - 1;
-    m_discardedTValues += static_cast<int32_t>(m_internalBuffer.size()) - 1;
-    m_internalBuffer.erase(m_internalBuffer.begin(),
-                           m_internalBuffer.end() - 1);
+    m_tvalueDiscardCount += bufferedCount() - 1;
+    consumeAllButLast();
   }
 
   return nextState;
@@ -132,23 +132,17 @@ TvaluesToChannel::State TvaluesToChannel::expectingSync() {
 
   // The internal buffer contains a valid sync at the start
   // Find the next sync header after it
-  std::vector<uint8_t> t11_t11 = {efm::kSyncSymbolT11, efm::kSyncSymbolT11};
-  auto it = std::search(m_internalBuffer.begin() + 2, m_internalBuffer.end(),
-                        t11_t11.begin(), t11_t11.end());
-  int syncIndex =
-      (it != m_internalBuffer.end())
-          ? static_cast<int>(std::distance(m_internalBuffer.begin(), it))
-          : -1;
+  const int64_t syncIndex = findSync(2);
 
   // Do we have a valid second sync header?
   if (syncIndex != -1) {
-    // Extract the frame data from (and including) the first sync header until
-    // (but not including) the second sync header
-    std::vector<uint8_t> frameData(m_internalBuffer.begin(),
-                                   m_internalBuffer.begin() + syncIndex);
+    // The frame runs from (and including) the first sync header until (but not
+    // including) the second sync header
+    size_t first = 0;
+    size_t last = static_cast<size_t>(syncIndex);
 
     // Do we have exactly 588 bits of data?  Count the T-values
-    int bitCount = static_cast<int>(countBits(frameData));
+    int bitCount = static_cast<int>(countBits(first, last));
 
     // If the frame data is 550 to 600 bits, we have a valid frame
     if (bitCount > efm::kFrameBitCountAcceptMin &&
@@ -159,18 +153,18 @@ TvaluesToChannel::State TvaluesToChannel::expectingSync() {
             "Treating as valid",
             bitCount);
         if (bitCount > efm::kEfmFrameChannelBits) {
-          attemptToFixOvershootFrame(frameData);
+          attemptToFixOvershootFrame(first, last);
         }
         if (bitCount < efm::kEfmFrameChannelBits) {
-          attemptToFixUndershootFrame(0, syncIndex, frameData);
+          attemptToFixUndershootFrame(first, last);
         }
       }
 
       // We have a valid frame
       // Place the frame data into the output buffer
-      m_outputBuffer.push(frameData);
+      emitFrame(first, last);
 
-      m_consumedTValues += frameData.size();
+      m_consumedTValues += last - first;
       m_channelFrameCount++;
       m_perfectSyncs++;
 
@@ -179,8 +173,7 @@ TvaluesToChannel::State TvaluesToChannel::expectingSync() {
       if (bitCount < efm::kEfmFrameChannelBits) m_shortFrames++;
 
       // Remove the frame data from the internal buffer
-      m_internalBuffer.erase(m_internalBuffer.begin(),
-                             m_internalBuffer.begin() + syncIndex);
+      consume(static_cast<size_t>(syncIndex));
       nextState = ExpectingSync;
     } else {
       // This is most likely a missing sync header issue rather than
@@ -198,10 +191,10 @@ TvaluesToChannel::State TvaluesToChannel::expectingSync() {
     ORC_LOG_DEBUG(
         "TvaluesToChannel::expectingSync() - No second sync header found, sync "
         "lost - dropping {} T-values",
-        m_internalBuffer.size());
+        bufferedCount());
 
-    m_discardedTValues += m_internalBuffer.size();
-    m_internalBuffer.clear();
+    m_discardedTValues += bufferedCount();
+    consume(bufferedCount());
     nextState = ExpectingInitialSync;
   }
 
@@ -215,40 +208,24 @@ TvaluesToChannel::State TvaluesToChannel::handleUndershoot() {
   m_undershootSyncs++;
 
   // Find the second sync header
-  std::vector<uint8_t> t11_t11 = {efm::kSyncSymbolT11, efm::kSyncSymbolT11};
-  auto it = std::search(m_internalBuffer.begin() + 2, m_internalBuffer.end(),
-                        t11_t11.begin(), t11_t11.end());
-  int secondSyncIndex =
-      (it != m_internalBuffer.end())
-          ? static_cast<int>(std::distance(m_internalBuffer.begin(), it))
-          : -1;
+  const int64_t secondSyncIndex = findSync(2);
 
   // R-5(d): if there is no second sync header there cannot be a third one
-  // bracketing a frame either. Guard against indexing the buffer with -1
-  // (begin() + secondSyncIndex would be begin() - 1, an out-of-bounds iterator
-  // that traps under the hardened libc++, and m_discardedTValues += -1 would
-  // corrupt the statistic). Treat it as a lost sync: drop all but the last
+  // bracketing a frame either. Treat it as a lost sync: drop all but the last
   // T-value and re-hunt for an initial sync.
   if (secondSyncIndex == -1) {
     ORC_LOG_DEBUG(
         "TvaluesToChannel::handleUndershoot() - No second sync header found - "
         "Sync lost.  Dropping {} T-values",
-        m_internalBuffer.size() - 1);
+        bufferedCount() - 1);
 
-    m_discardedTValues += static_cast<int32_t>(m_internalBuffer.size()) - 1;
-    m_internalBuffer.erase(m_internalBuffer.begin(),
-                           m_internalBuffer.end() - 1);
+    consumeAllButLast();
     return ExpectingInitialSync;
   }
 
   // Find the third sync header
-  auto it3 =
-      std::search(m_internalBuffer.begin() + secondSyncIndex + 2,
-                  m_internalBuffer.end(), t11_t11.begin(), t11_t11.end());
-  int thirdSyncIndex =
-      (it3 != m_internalBuffer.end())
-          ? static_cast<int>(std::distance(m_internalBuffer.begin(), it3))
-          : -1;
+  const int64_t thirdSyncIndex =
+      findSync(static_cast<size_t>(secondSyncIndex) + 2);
 
   // So, unless the data is completely corrupt we should have 588 bits between
   // the first and third sync headers (i.e. the second was a corrupt sync
@@ -259,13 +236,14 @@ TvaluesToChannel::State TvaluesToChannel::handleUndershoot() {
   // have to drop it
 
   if (thirdSyncIndex != -1) {
+    const size_t second = static_cast<size_t>(secondSyncIndex);
+    const size_t third = static_cast<size_t>(thirdSyncIndex);
+
     // Value of the Ts between the first and third sync header
-    int fttBitCount =
-        static_cast<int>(countBits(m_internalBuffer, 0, thirdSyncIndex));
+    int fttBitCount = static_cast<int>(countBits(0, third));
 
     // Value of the Ts between the second and third sync header
-    int sttBitCount = static_cast<int>(
-        countBits(m_internalBuffer, secondSyncIndex, thirdSyncIndex));
+    int sttBitCount = static_cast<int>(countBits(second, third));
 
     if (fttBitCount > efm::kFrameBitCountAcceptMin &&
         fttBitCount < efm::kFrameBitCountAcceptMax) {
@@ -274,24 +252,23 @@ TvaluesToChannel::State TvaluesToChannel::handleUndershoot() {
           "from first to third sync_header = {} bits - treating as valid",
           fttBitCount);
       // Valid frame between the first and third sync headers
-      std::vector<uint8_t> frameData(m_internalBuffer.begin(),
-                                     m_internalBuffer.begin() + thirdSyncIndex);
-      int32_t bitCount = static_cast<int32_t>(countBits(frameData));
-      if (bitCount != efm::kEfmFrameChannelBits) {
+      size_t first = 0;
+      size_t last = third;
+      if (fttBitCount != efm::kEfmFrameChannelBits) {
         ORC_LOG_DEBUG(
             "TvaluesToChannel::handleUndershoot1() - Got frame with {} bits - "
             "Treating as valid",
             sttBitCount);
-        if (bitCount > efm::kEfmFrameChannelBits) {
-          attemptToFixOvershootFrame(frameData);
+        if (fttBitCount > efm::kEfmFrameChannelBits) {
+          attemptToFixOvershootFrame(first, last);
         }
-        if (bitCount < efm::kEfmFrameChannelBits) {
-          attemptToFixUndershootFrame(0, thirdSyncIndex, frameData);
+        if (fttBitCount < efm::kEfmFrameChannelBits) {
+          attemptToFixUndershootFrame(first, last);
         }
       }
-      m_outputBuffer.push(frameData);
+      emitFrame(first, last);
 
-      m_consumedTValues += frameData.size();
+      m_consumedTValues += last - first;
       m_channelFrameCount++;
 
       if (fttBitCount == efm::kEfmFrameChannelBits) m_perfectFrames++;
@@ -299,8 +276,7 @@ TvaluesToChannel::State TvaluesToChannel::handleUndershoot() {
       if (fttBitCount < efm::kEfmFrameChannelBits) m_shortFrames++;
 
       // Remove the frame data from the internal buffer
-      m_internalBuffer.erase(m_internalBuffer.begin(),
-                             m_internalBuffer.begin() + thirdSyncIndex);
+      consume(third);
       nextState = ExpectingSync;
     } else if (sttBitCount > efm::kFrameBitCountAcceptMin &&
                sttBitCount < efm::kFrameBitCountAcceptMax) {
@@ -309,25 +285,23 @@ TvaluesToChannel::State TvaluesToChannel::handleUndershoot() {
           "from second to third sync_header = {} bits - treating as valid",
           sttBitCount);
       // Valid frame between the second and third sync headers
-      std::vector<uint8_t> frameData(m_internalBuffer.begin() + secondSyncIndex,
-                                     m_internalBuffer.begin() + thirdSyncIndex);
-      int32_t bitCount = static_cast<int32_t>(countBits(frameData));
-      if (bitCount != efm::kEfmFrameChannelBits) {
+      size_t first = second;
+      size_t last = third;
+      if (sttBitCount != efm::kEfmFrameChannelBits) {
         ORC_LOG_DEBUG(
             "TvaluesToChannel::handleUndershoot2() - Got frame with {} bits - "
             "Treating as valid",
             sttBitCount);
-        if (bitCount > efm::kEfmFrameChannelBits) {
-          attemptToFixOvershootFrame(frameData);
+        if (sttBitCount > efm::kEfmFrameChannelBits) {
+          attemptToFixOvershootFrame(first, last);
         }
-        if (bitCount < efm::kEfmFrameChannelBits) {
-          attemptToFixUndershootFrame(secondSyncIndex, thirdSyncIndex,
-                                      frameData);
+        if (sttBitCount < efm::kEfmFrameChannelBits) {
+          attemptToFixUndershootFrame(first, last);
         }
       }
-      m_outputBuffer.push(frameData);
+      emitFrame(first, last);
 
-      m_consumedTValues += frameData.size();
+      m_consumedTValues += last - first;
       m_channelFrameCount++;
 
       if (sttBitCount == efm::kEfmFrameChannelBits) m_perfectFrames++;
@@ -335,9 +309,8 @@ TvaluesToChannel::State TvaluesToChannel::handleUndershoot() {
       if (sttBitCount < efm::kEfmFrameChannelBits) m_shortFrames++;
 
       // Remove the frame data from the internal buffer
-      m_discardedTValues += secondSyncIndex;
-      m_internalBuffer.erase(m_internalBuffer.begin(),
-                             m_internalBuffer.begin() + thirdSyncIndex);
+      m_discardedTValues += second;
+      consume(third);
       nextState = ExpectingSync;
     } else {
       ORC_LOG_DEBUG(
@@ -347,9 +320,8 @@ TvaluesToChannel::State TvaluesToChannel::handleUndershoot() {
       nextState = ExpectingSync;
 
       // Remove the frame data from the internal buffer
-      m_discardedTValues += secondSyncIndex;
-      m_internalBuffer.erase(m_internalBuffer.begin(),
-                             m_internalBuffer.begin() + thirdSyncIndex);
+      m_discardedTValues += second;
+      consume(third);
     }
   } else {
     // R-5(d): processStateMachine() only dispatches here when the buffer
@@ -360,11 +332,9 @@ TvaluesToChannel::State TvaluesToChannel::handleUndershoot() {
     ORC_LOG_DEBUG(
         "TvaluesToChannel::handleUndershoot() - No third sync header found - "
         "Sync lost.  Dropping {} T-values",
-        m_internalBuffer.size() - 1);
+        bufferedCount() - 1);
 
-    m_discardedTValues += static_cast<int32_t>(m_internalBuffer.size()) - 1;
-    m_internalBuffer.erase(m_internalBuffer.begin(),
-                           m_internalBuffer.end() - 1);
+    consumeAllButLast();
     nextState = ExpectingInitialSync;
   }
 
@@ -380,29 +350,19 @@ TvaluesToChannel::State TvaluesToChannel::handleOvershoot() {
   // Is the overshoot due to a missing/corrupt sync header?
   // Count the bits between the first and second sync headers, if they are
   // 588*2, split the frame data into two frames
-  std::vector<uint8_t> t11_t11 = {efm::kSyncSymbolT11, efm::kSyncSymbolT11};
 
   // Find the second sync header
-  auto it = std::search(m_internalBuffer.begin() + 2, m_internalBuffer.end(),
-                        t11_t11.begin(), t11_t11.end());
-  int syncIndex =
-      (it != m_internalBuffer.end())
-          ? static_cast<int>(std::distance(m_internalBuffer.begin(), it))
-          : -1;
+  const int64_t syncIndex = findSync(2);
 
   // Do we have a valid second sync header?
   if (syncIndex != -1) {
-    // Extract the frame data from (and including) the first sync header until
+    // The frame data runs from (and including) the first sync header until
     // (but not including) the second sync header
-    std::vector<uint8_t> frameData(m_internalBuffer.begin(),
-                                   m_internalBuffer.begin() + syncIndex);
-
-    // Remove the frame data from the internal buffer
-    m_internalBuffer.erase(m_internalBuffer.begin(),
-                           m_internalBuffer.begin() + syncIndex);
+    const size_t frameEnd = static_cast<size_t>(syncIndex);
+    const uint8_t* tValues = buffered();
 
     // How many bits of data do we have?  Count the T-values
-    int bitCount = static_cast<int>(countBits(frameData));
+    int bitCount = static_cast<int>(countBits(0, frameEnd));
 
     // If the frame data is within the range of n frames, we have n frames
     // separated by corrupt sync headers
@@ -416,36 +376,28 @@ TvaluesToChannel::State TvaluesToChannel::handleOvershoot() {
       if (bitCount > frameSize * n - tolerance &&
           bitCount < frameSize * n + tolerance) {
         validFrames = true;
-        int accumulatedBits = 0;
-        int endOfFrameIndex = 0;
+        size_t frameStart = 0;
 
         for (int i = 0; i < n; ++i) {
-          std::vector<uint8_t> singleFrameData;
-          while (accumulatedBits < frameSize &&
-                 endOfFrameIndex < frameData.size()) {
-            accumulatedBits += frameData.at(endOfFrameIndex);
+          uint32_t singleFrameBitCount = 0;
+          size_t endOfFrameIndex = frameStart;
+          while (singleFrameBitCount < static_cast<uint32_t>(frameSize) &&
+                 endOfFrameIndex < frameEnd) {
+            singleFrameBitCount += tValues[endOfFrameIndex];
             ++endOfFrameIndex;
           }
 
-          singleFrameData = std::vector<uint8_t>(
-              frameData.begin(), frameData.begin() + endOfFrameIndex);
-          frameData = std::vector<uint8_t>(frameData.begin() + endOfFrameIndex,
-                                           frameData.end());
-          accumulatedBits = 0;
-          endOfFrameIndex = 0;
-
-          uint32_t singleFrameBitCount = countBits(singleFrameData);
-
           // Place the frame into the output buffer
-          m_outputBuffer.push(singleFrameData);
+          emitFrame(frameStart, endOfFrameIndex);
 
           ORC_LOG_DEBUG(
               "TvaluesToChannel::handleOvershoot() - Overshoot frame split - "
               "{} bits - frame split #{}",
               singleFrameBitCount, i + 1);
 
-          m_consumedTValues += singleFrameData.size();
+          m_consumedTValues += endOfFrameIndex - frameStart;
           m_channelFrameCount++;
+          frameStart = endOfFrameIndex;
 
           // E-8: a frame with fewer bits than nominal is a *short* frame and
           // more bits is a *long* frame (matching the convention above); these
@@ -458,6 +410,9 @@ TvaluesToChannel::State TvaluesToChannel::handleOvershoot() {
       }
     }
 
+    // Remove the frame data from the internal buffer
+    consume(frameEnd);
+
     if (!validFrames) {
       ORC_LOG_DEBUG(
           "TvaluesToChannel::handleOvershoot() - Attempted overshoot recovery, "
@@ -466,10 +421,8 @@ TvaluesToChannel::State TvaluesToChannel::handleOvershoot() {
       ORC_LOG_DEBUG(
           "TvaluesToChannel::handleOvershoot() - Overshoot by {} bits, but no "
           "sync header found, dropping {} T-values",
-          bitCount, m_internalBuffer.size() - 1);
-      m_discardedTValues += static_cast<int32_t>(m_internalBuffer.size()) - 1;
-      m_internalBuffer.erase(m_internalBuffer.begin(),
-                             m_internalBuffer.end() - 1);
+          bitCount, bufferedCount() - 1);
+      consumeAllButLast();
       nextState = ExpectingInitialSync;
     } else {
       nextState = ExpectingSync;
@@ -485,63 +438,57 @@ TvaluesToChannel::State TvaluesToChannel::handleOvershoot() {
 }
 
 // This function tries some basic tricks to fix a frame that is more than 588
-// bits long
-void TvaluesToChannel::attemptToFixOvershootFrame(
-    std::vector<uint8_t>& frameData) {
-  int32_t bitCount = static_cast<int32_t>(countBits(frameData));
+// bits long. [first, last) index the buffered T-values and are narrowed in
+// place when a fix is found.
+void TvaluesToChannel::attemptToFixOvershootFrame(size_t& first,
+                                                  size_t& last) const {
+  int32_t bitCount = static_cast<int32_t>(countBits(first, last));
 
   if (bitCount > efm::kEfmFrameChannelBits) {
-    // We have too many bits, so we'll try to remove some
-    // We'll remove the first T-value in the frame
-    std::vector<uint8_t> lframeData(frameData.begin(), frameData.end() - 1);
-    // ... and the last T-value in the frame
-    std::vector<uint8_t> rframeData(frameData.begin() + 1, frameData.end());
-    int32_t lbitCount = static_cast<int32_t>(countBits(lframeData));
-    int32_t rbitCount = static_cast<int32_t>(countBits(rframeData));
+    const uint8_t* tValues = buffered();
+    // We have too many bits, so we'll try to remove some: first the last
+    // T-value in the frame, then the first
+    int32_t lbitCount = bitCount - tValues[last - 1];
+    int32_t rbitCount = bitCount - tValues[first];
 
     if (lbitCount == efm::kEfmFrameChannelBits) {
-      frameData = lframeData;
+      --last;
       ORC_LOG_DEBUG(
-          "TvaluesToChannel::attemptToFixOvershootFrame() - Removed first "
+          "TvaluesToChannel::attemptToFixOvershootFrame() - Removed last "
           "T-value to fix frame");
     } else if (rbitCount == efm::kEfmFrameChannelBits) {
-      frameData = rframeData;
+      ++first;
       ORC_LOG_DEBUG(
-          "TvaluesToChannel::attemptToFixOvershootFrame() - Removed last "
+          "TvaluesToChannel::attemptToFixOvershootFrame() - Removed first "
           "T-value to fix frame");
     }
   }
 }
 
 // This function tries some basic tricks to fix a frame that is less than 588
-// bits long Note: the start and end indexes refer to m_internalBuffer
-void TvaluesToChannel::attemptToFixUndershootFrame(
-    uint32_t startIndex, uint32_t endIndex, std::vector<uint8_t>& frameData) {
-  int32_t bitCount = static_cast<int32_t>(countBits(frameData));
+// bits long. [first, last) index the buffered T-values and are widened in
+// place (by the T-value either side) when a fix is found.
+void TvaluesToChannel::attemptToFixUndershootFrame(size_t& first,
+                                                   size_t& last) const {
+  int32_t bitCount = static_cast<int32_t>(countBits(first, last));
 
   if (bitCount < efm::kEfmFrameChannelBits) {
-    std::vector<uint8_t> lframeData(
-        m_internalBuffer.begin() + static_cast<std::ptrdiff_t>(startIndex),
-        m_internalBuffer.begin() + static_cast<std::ptrdiff_t>(endIndex) + 1);
-    int32_t lbitCount = static_cast<int32_t>(countBits(lframeData));
+    const uint8_t* tValues = buffered();
+    int32_t lbitCount = bitCount + tValues[last];
 
     if (lbitCount == efm::kEfmFrameChannelBits) {
-      frameData = lframeData;
+      ++last;
       ORC_LOG_DEBUG(
           "TvaluesToChannel::attemptToFixUndershootFrame() - Added additional "
           "last T-value to fix frame");
       return;
     }
 
-    if (startIndex > 0) {
-      std::vector<uint8_t> rframeData(
-          m_internalBuffer.begin() + static_cast<std::ptrdiff_t>(startIndex) -
-              1,
-          m_internalBuffer.begin() + static_cast<std::ptrdiff_t>(endIndex));
-      int32_t rbitCount = static_cast<int32_t>(countBits(rframeData));
+    if (first > 0) {
+      int32_t rbitCount = bitCount + tValues[first - 1];
 
       if (rbitCount == efm::kEfmFrameChannelBits) {
-        frameData = rframeData;
+        --first;
         ORC_LOG_DEBUG(
             "TvaluesToChannel::attemptToFixUndershootFrame() - Added "
             "additional first T-value to fix frame");
@@ -550,19 +497,91 @@ void TvaluesToChannel::attemptToFixUndershootFrame(
   }
 }
 
-// Count the number of bits in the array of T-values
-uint32_t TvaluesToChannel::countBits(const std::vector<uint8_t>& data,
-                                     int32_t startPosition,
-                                     int32_t endPosition) {
-  if (endPosition == -1) endPosition = static_cast<int32_t>(data.size());
-
+// Count the number of bits in the buffered T-values [first, last)
+uint32_t TvaluesToChannel::countBits(size_t first, size_t last) const {
+  const uint8_t* tValues = buffered();
   uint32_t bitCount = 0;
-  for (int i = startPosition; i < endPosition; i++) {
-    bitCount += data.at(i);
+  for (size_t i = first; i < last; i++) {
+    bitCount += tValues[i];
   }
   return bitCount;
 }
 
+void TvaluesToChannel::consumeAllButLast() {
+  const size_t dropped = bufferedCount() - 1;
+  m_discardedTValues += dropped;
+  consume(dropped);
+}
+
+int64_t TvaluesToChannel::findSync(size_t from) const {
+  // memchr() for the first T11 (a vectorised scan in every mainstream libc),
+  // then check the T-value after it. T11 is rare outside sync headers, so
+  // almost every hit is a real sync and the scan runs at memory speed.
+  const uint8_t* tValues = buffered();
+  const size_t count = bufferedCount();
+
+  size_t position = from;
+  while (position + 1 < count) {
+    const void* hit = std::memchr(tValues + position, efm::kSyncSymbolT11,
+                                  count - 1 - position);
+    if (hit == nullptr) return -1;
+
+    const size_t index = static_cast<size_t>(
+        static_cast<const uint8_t*>(hit) - tValues);
+    if (tValues[index + 1] == efm::kSyncSymbolT11) {
+      return static_cast<int64_t>(index);
+    }
+    // tValues[index + 1] is not T11, so no pattern can start there either
+    position = index + 2;
+  }
+  return -1;
+}
+
+void TvaluesToChannel::emitFrame(size_t first, size_t last) {
+  const uint8_t* tValues = buffered();
+  m_outputFrames.push_back({m_outputTValues.size(), last - first});
+  m_outputTValues.insert(m_outputTValues.end(), tValues + first,
+                         tValues + last);
+}
+
+bool TvaluesToChannel::hasSameDecodeState(
+    const TvaluesToChannel& other) const {
+  // Queued output is not decode state; callers compare drained decoders.
+  if (isReady() || other.isReady()) return false;
+  return m_currentState == other.m_currentState &&
+         bufferedCount() == other.bufferedCount() &&
+         std::equal(buffered(), buffered() + bufferedCount(),
+                    other.buffered());
+}
+
+void TvaluesToChannel::resetStatistics() {
+  m_consumedTValues = 0;
+  m_discardedTValues = 0;
+  m_channelFrameCount = 0;
+
+  m_perfectFrames = 0;
+  m_longFrames = 0;
+  m_shortFrames = 0;
+
+  m_overshootSyncs = 0;
+  m_undershootSyncs = 0;
+  m_perfectSyncs = 0;
+}
+
+void TvaluesToChannel::mergeStatistics(const TvaluesToChannel& other) {
+  m_consumedTValues += other.m_consumedTValues;
+  m_discardedTValues += other.m_discardedTValues;
+  m_channelFrameCount += other.m_channelFrameCount;
+
+  m_perfectFrames += other.m_perfectFrames;
+  m_longFrames += other.m_longFrames;
+  m_shortFrames += other.m_shortFrames;
+
+  m_overshootSyncs += other.m_overshootSyncs;
+  m_undershootSyncs += other.m_undershootSyncs;
+  m_perfectSyncs += other.m_perfectSyncs;
+}
+
 void TvaluesToChannel::showStatistics() const {
   ORC_LOG_INFO("T-values to Channel Frame statistics:");
   ORC_LOG_INFO("  T-Values:");
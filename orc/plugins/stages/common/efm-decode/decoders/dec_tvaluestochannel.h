@@ -9,8 +9,8 @@
 #ifndef DEC_TVALUESTOCHANNEL_H
 #define DEC_TVALUESTOCHANNEL_H
 
+#include <cstddef>
 #include <cstdint>
-#include <queue>
 #include <vector>
 
 #include "decoders.h"
@@ -20,17 +20,38 @@ class TvaluesToChannel : public Decoder {
   TvaluesToChannel();
   void pushFrame(const std::vector<uint8_t>& data);
   std::vector<uint8_t> popFrame();
+  // Copies the next channel frame into |frame|, reusing its capacity, so a
+  // caller that keeps one scratch vector pays no allocation per frame.
+  void popFrame(std::vector<uint8_t>& frame);
   bool isReady() const;
 
   void showStatistics() const;
 
+  // Segmented decode support (see SegmentedFrontEnd). Two decoders that have
+  // been fed the same stream up to the same point and have the same decode
+  // state produce identical frames from then on, whatever they saw before.
+  bool hasSameDecodeState(const TvaluesToChannel& other) const;
+  void resetStatistics();
+  void mergeStatistics(const TvaluesToChannel& other);
+
  private:
   void processStateMachine();
-  void attemptToFixOvershootFrame(std::vector<uint8_t>& frameData);
-  void attemptToFixUndershootFrame(uint32_t startIndex, uint32_t endIndex,
-                                   std::vector<uint8_t>& frameData);
-  uint32_t countBits(const std::vector<uint8_t>& data,
-                     int32_t startPosition = 0, int32_t endPosition = -1);
+  void attemptToFixOvershootFrame(size_t& first, size_t& last) const;
+  void attemptToFixUndershootFrame(size_t& first, size_t& last) const;
+  uint32_t countBits(size_t first, size_t last) const;
+
+  // View of the unconsumed T-values. Indices used by the state machine are
+  // relative to this window; pointers into it stay valid until the next
+  // pushFrame(), which is the only place the window is compacted.
+  const uint8_t* buffered() const { return m_tValues.data() + m_head; }
+  size_t bufferedCount() const { return m_tValues.size() - m_head; }
+  void consume(size_t count) { m_head += count; }
+  void consumeAllButLast();
+
+  // Index of the first T11+T11 sync pattern at or after |from|, or -1.
+  int64_t findSync(size_t from) const;
+
+  void emitFrame(size_t first, size_t last);
 
   // State machine states
   enum State {
@@ -55,9 +76,24 @@ class TvaluesToChannel : public Decoder {
   uint64_t m_perfectSyncs;
 
   State m_currentState;
-  std::vector<uint8_t> m_internalBuffer;
 
-  std::queue<std::vector<uint8_t>> m_outputBuffer;
+  // Input window: m_tValues[m_head..] holds the unconsumed T-values. Consuming
+  // only advances m_head; the consumed prefix is dropped once per pushFrame()
+  // rather than with an erase per frame, and the storage is reused, so steady
+  // state ingestion does not allocate.
+  std::vector<uint8_t> m_tValues;
+  size_t m_head;
+
+  // Output frames are stored back to back in m_outputTValues; m_outputFrames
+  // holds each frame's [offset, offset + length) and m_outputRead the next
+  // frame to pop. Both are cleared (keeping capacity) once drained.
+  struct OutputFrame {
+    size_t offset;
+    size_t length;
+  };
+  std::vector<uint8_t> m_outputTValues;
+  std::vector<OutputFrame> m_outputFrames;
+  size_t m_outputRead;
 
   uint64_t m_tvalueDiscardCount;
 
@@ -15,6 +15,7 @@
 
 #include "efm_exception.h"
 #include "ezpwd_compat.h"
+#include "gf256/gf256.h"
 
 // ezpwd ECMA-130 CIRC configuration. Both the C1 (32,28) and C2 (28,24)
 // shortened codes carry 4 parity symbols over GF(2^8) with POLY=0x11D, FCR=0,
@@ -35,6 +36,13 @@ struct CircRS<255, PAYLOAD>
 // disc and is sensitive to per-access thread-local storage overhead.
 CircRS<255, 255 - 4> circRs;
 
+// The same two codes for the shared GF(2^8) syndrome kernels. Nearly every
+// word read from a disc is already a codeword; its syndromes alone show that,
+// so the ezpwd decode (which recomputes them before Berlekamp-Massey and the
+// Chien search) is only run for the rest. Read-only, and shared like circRs.
+const orc::gf256::SyndromeKernel c1Kernel(32, ReedSolomon::kSyndromes);
+const orc::gf256::SyndromeKernel c2Kernel(28, ReedSolomon::kSyndromes);
+
 ReedSolomon::ReedSolomon() {
   // Initialise statistics
   m_validC1s = 0;
@@ -59,13 +67,19 @@ bool containsPadding(const std::vector<uint8_t>& paddedData) {
                      [](uint8_t value) { return value != 0; });
 }
 
+bool allZero(const uint8_t* syndromes) {
+  return std::all_of(syndromes, syndromes + ReedSolomon::kSyndromes,
+                     [](uint8_t value) { return value == 0; });
+}
+
 }  // namespace
 
 // Perform a C1 Reed-Solomon decoding operation on the input data
 // This is a (32,28) Reed-Solomon encode - 32 bytes in, 28 bytes out
 void ReedSolomon::c1Decode(std::vector<uint8_t>& inputData,
                            std::vector<uint8_t>& errorData,
-                           std::vector<uint8_t>& paddedData) {
+                           std::vector<uint8_t>& paddedData,
+                           const uint8_t* syndromes) {
   // Ensure input data is 32 bytes long
   if (inputData.size() != 32) {
     ORC_LOG_ERROR("ReedSolomon::c1Decode - Input data must be 32 bytes long");
@@ -89,26 +103,18 @@ void ReedSolomon::c1Decode(std::vector<uint8_t>& inputData,
     std::fill(paddedData.begin(), paddedData.end(), 1);
   }
 
-  // Copy input into reusable scratch for the ezpwd decoder (which modifies in
-  // place). assign() retains the scratch buffer's capacity (P-6).
-  m_scratchData.assign(inputData.begin(), inputData.end());
-  m_erasures.clear();
-  m_position.clear();
-
   // Convert the errorData into a list of erasure positions
+  m_erasures.clear();
   for (int index = 0; index < static_cast<int>(errorData.size()); ++index) {
     if (errorData[index]) m_erasures.push_back(index);
   }
 
-  // Snapshot the supplied erasures before decode prunes them (see c2Decode).
-  const std::vector<int> suppliedErasures = m_erasures;
-
   // E-2: the (32,28) C1 code has minimum distance 5, so it can attempt an
   // in-capacity erasure decode for up to 4 supplied erasures. C1 erasure flags
   // come from the EFM demodulator (invalid 14-bit symbols - reliable erasures),
   // so passing 3-4 of them straight through as uncorrectable without attempting
   // the decode discarded correctable words. More than 4 exceeds capacity.
-  if (suppliedErasures.size() > 4) {
+  if (m_erasures.size() > 4) {
     inputData.resize(inputData.size() - 4);  // keep received bytes 0..27
     errorData.assign(inputData.size(), 1);
     if (partiallyPopulated) {
@@ -119,6 +125,32 @@ void ReedSolomon::c1Decode(std::vector<uint8_t>& inputData,
     return;
   }
 
+  // Already a codeword: ezpwd would return 0 with no corrections, which is
+  // accepted below with the received payload unchanged.
+  uint8_t ownSyndromes[kSyndromes];
+  if (syndromes == nullptr) {
+    c1Kernel.compute(inputData.data(), ownSyndromes);
+    syndromes = ownSyndromes;
+  }
+  if (allZero(syndromes)) {
+    inputData.resize(inputData.size() - 4);
+    errorData.assign(inputData.size(), 0);
+    if (partiallyPopulated) {
+      ++m_paddedC1s;
+    } else {
+      ++m_validC1s;
+    }
+    return;
+  }
+
+  // Copy input into reusable scratch for the ezpwd decoder (which modifies in
+  // place). assign() retains the scratch buffer's capacity (P-6).
+  m_scratchData.assign(inputData.begin(), inputData.end());
+  m_position.clear();
+
+  // Snapshot the supplied erasures before decode prunes them (see c2Decode).
+  const std::vector<int> suppliedErasures = m_erasures;
+
   // Decode the data
   int result = circRs.decode(m_scratchData, m_erasures, &m_position);
 
@@ -168,7 +200,8 @@ void ReedSolomon::c1Decode(std::vector<uint8_t>& inputData,
 // This is a (28,24) Reed-Solomon encode - 28 bytes in, 24 bytes out
 void ReedSolomon::c2Decode(std::vector<uint8_t>& inputData,
                            std::vector<uint8_t>& errorData,
-                           std::vector<uint8_t>& paddedData) {
+                           std::vector<uint8_t>& paddedData,
+                           const uint8_t* syndromes) {
   // Ensure input data is 28 bytes long
   if (inputData.size() != 28) {
     ORC_LOG_ERROR("ReedSolomon::c2Decode - Input data must be 28 bytes long");
@@ -193,25 +226,15 @@ void ReedSolomon::c2Decode(std::vector<uint8_t>& inputData,
     std::fill(paddedData.begin(), paddedData.end(), 1);
   }
 
-  // Copy input into reusable scratch for the ezpwd decoder (which modifies in
-  // place). assign() retains the scratch buffer's capacity (P-6).
-  m_scratchData.assign(inputData.begin(), inputData.end());
-  m_erasures.clear();
-  m_position.clear();
-
   // Convert the errorData into a list of erasure positions
+  m_erasures.clear();
   for (int index = 0; index < static_cast<int>(errorData.size()); ++index) {
     if (errorData[index] != 0) m_erasures.push_back(index);
   }
 
-  // Snapshot the supplied erasures: ezpwd's decode() prunes erasures it finds
-  // were actually correct, so we need the original list to classify the
-  // corrections it reports in 'position'.
-  const std::vector<int> suppliedErasures = m_erasures;
-
   // The (28,24) C2 code has minimum distance 5, so more than 4 supplied
   // erasures already exceeds capacity and cannot be corrected.
-  if (suppliedErasures.size() > 4) {
+  if (m_erasures.size() > 4) {
     // Remove parity byte positions 12-15 and assign result
     inputData.erase(inputData.begin() + 12, inputData.begin() + 16);
     errorData.assign(inputData.size(), 1);
@@ -223,6 +246,33 @@ void ReedSolomon::c2Decode(std::vector<uint8_t>& inputData,
     return;
   }
 
+  // Already a codeword (see c1Decode).
+  uint8_t ownSyndromes[kSyndromes];
+  if (syndromes == nullptr) {
+    c2Kernel.compute(inputData.data(), ownSyndromes);
+    syndromes = ownSyndromes;
+  }
+  if (allZero(syndromes)) {
+    inputData.erase(inputData.begin() + 12, inputData.begin() + 16);
+    errorData.assign(inputData.size(), 0);
+    if (partiallyPopulated) {
+      ++m_paddedC2s;
+    } else {
+      ++m_validC2s;
+    }
+    return;
+  }
+
+  // Copy input into reusable scratch for the ezpwd decoder (which modifies in
+  // place). assign() retains the scratch buffer's capacity (P-6).
+  m_scratchData.assign(inputData.begin(), inputData.end());
+  m_position.clear();
+
+  // Snapshot the supplied erasures: ezpwd's decode() prunes erasures it finds
+  // were actually correct, so we need the original list to classify the
+  // corrections it reports in 'position'.
+  const std::vector<int> suppliedErasures = m_erasures;
+
   // Decode the data
   int result = circRs.decode(m_scratchData, m_erasures, &m_position);
 
@@ -282,6 +332,16 @@ void ReedSolomon::c2Decode(std::vector<uint8_t>& inputData,
   return;
 }
 
+void ReedSolomon::c1Syndromes(const uint8_t* words, size_t stride,
+                              size_t count, uint8_t* syndromes) {
+  c1Kernel.computeBatch(words, stride, count, syndromes);
+}
+
+void ReedSolomon::c2Syndromes(const uint8_t* words, size_t stride,
+                              size_t count, uint8_t* syndromes) {
+  c2Kernel.computeBatch(words, stride, count, syndromes);
+}
+
 // Getter functions for the statistics
 int32_t ReedSolomon::validC1s() const { return m_validC1s; }
 
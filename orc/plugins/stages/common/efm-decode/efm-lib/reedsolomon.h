@@ -9,6 +9,7 @@
 #ifndef REEDSOLOMON_H
 #define REEDSOLOMON_H
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -37,13 +38,30 @@
 
 class ReedSolomon {
  public:
+  // Both CIRC codes carry 4 parity symbols, so each word has 4 syndromes.
+  static constexpr size_t kSyndromes = 4;
+
   ReedSolomon();
+  // |syndromes|, if given, are the kSyndromes syndromes of inputData as
+  // computed by c1Syndromes()/c2Syndromes(); otherwise they are computed here.
+  // A word whose syndromes are all zero is already a codeword and skips the
+  // ezpwd decode.
   void c1Decode(std::vector<uint8_t>& inputData,
                 std::vector<uint8_t>& errorData,
-                std::vector<uint8_t>& paddedData);
+                std::vector<uint8_t>& paddedData,
+                const uint8_t* syndromes = nullptr);
   void c2Decode(std::vector<uint8_t>& inputData,
                 std::vector<uint8_t>& errorData,
-                std::vector<uint8_t>& paddedData);
+                std::vector<uint8_t>& paddedData,
+                const uint8_t* syndromes = nullptr);
+
+  // Syndromes of |count| C1 (32-symbol) or C2 (28-symbol) words, word k at
+  // words + k * stride, written kSyndromes per word. Batching lets the SIMD
+  // kernels work on many words at once (see gf256::SyndromeKernel).
+  static void c1Syndromes(const uint8_t* words, size_t stride, size_t count,
+                          uint8_t* syndromes);
+  static void c2Syndromes(const uint8_t* words, size_t stride, size_t count,
+                          uint8_t* syndromes);
 
   // Codewords that were fully populated with received disc data. These are the
   // only ones whose outcome says anything about the input's quality.
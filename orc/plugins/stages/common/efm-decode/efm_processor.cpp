@@ -28,7 +28,8 @@ EfmProcessor::EfmProcessor()
       m_zeroPad(false),
       m_noWavHeader(false),
       m_outputMetadata(false),
-      m_reportOutput(false) {}
+      m_reportOutput(false),
+      m_frontEndWorkers(1) {}
 
 EfmProcessor::~EfmProcessor() {
   // If beginStream() started the back-end thread but finishStream() was never
@@ -49,6 +50,10 @@ void EfmProcessor::setNoTimecodes(bool noTimecodes) {
   m_noTimecodes = noTimecodes;
 }
 
+void EfmProcessor::setFrontEndWorkers(uint32_t workers) {
+  m_frontEndWorkers = workers;
+}
+
 void EfmProcessor::setAudacityLabels(bool audacityLabels) {
   m_audacityLabels = audacityLabels;
 }
@@ -95,6 +100,19 @@ bool EfmProcessor::beginStream(const std::string& outputFilename,
   // Apply decoder configuration
   m_f2SectionCorrection.setNoTimecodes(m_noTimecodes);
 
+  uint32_t frontEndWorkers = m_frontEndWorkers;
+  if (frontEndWorkers == 0) {
+    frontEndWorkers = std::thread::hardware_concurrency();
+    if (frontEndWorkers == 0) frontEndWorkers = 4;  // Fallback
+  }
+  if (frontEndWorkers > 1) {
+    ORC_LOG_DEBUG("Decoding the EFM front end in segments on {} threads",
+                  frontEndWorkers);
+    m_segmentedFrontEnd = std::make_unique<SegmentedFrontEnd>(frontEndWorkers);
+  } else {
+    m_segmentedFrontEnd.reset();
+  }
+
   // Open output writers based on mode
   if (m_audioMode) {
     if (m_noWavHeader) {
@@ -152,11 +170,22 @@ void EfmProcessor::pushChunk(const std::vector<uint8_t>& chunk) {
     }
   }
 
-  m_tValuesToChannel.pushFrame(chunk);
+  if (m_segmentedFrontEnd) {
+    m_segmentedFrontEnd->pushChunk(chunk);
+  } else {
+    m_frontEnd.pushChunk(chunk, m_frontEndSections);
+  }
   drainFrontEnd();
 }
 
 bool EfmProcessor::finishStream() {
+  // Segmented mode: decode the last segment and stitch everything still in
+  // flight, then take over the statistics of the stitched stream.
+  if (m_segmentedFrontEnd) {
+    m_segmentedFrontEnd->finish();
+    m_frontEnd.mergeStatistics(m_segmentedFrontEnd->statistics());
+  }
+
   // Final front-end drain with no new input (mirrors the empty-chunk
   // end-of-data pass that the old buffer loop performed before breaking).
   drainFrontEnd();
@@ -254,35 +283,23 @@ bool EfmProcessor::finishStream() {
 
 bool EfmProcessor::drainFrontEnd() {
   // -----------------------------------------------------------------------
-  // Front end: T-values → Channel → F3 → F2Section → F2SectionCorrection
+  // Front end: T-values → Channel → F3 → F2Section (FrontEndChain, or
+  // SegmentedFrontEnd in segmented mode) → F2SectionCorrection
   // -----------------------------------------------------------------------
 
-  auto t0 = std::chrono::high_resolution_clock::now();
-  while (m_tValuesToChannel.isReady()) {
-    m_channelToF3.pushFrame(m_tValuesToChannel.popFrame());
-  }
-  m_pipelineStats.channelToF3Time +=
-      std::chrono::duration_cast<std::chrono::microseconds>(
-          std::chrono::high_resolution_clock::now() - t0)
-          .count();
-
-  t0 = std::chrono::high_resolution_clock::now();
-  while (m_channelToF3.isReady()) {
-    F3Frame f3Frame = m_channelToF3.popFrame();
-    // P-1: move the frame into the next stage to avoid a deep copy.
-    m_f3FrameToF2Section.pushFrame(std::move(f3Frame));
+  if (m_segmentedFrontEnd) {
+    while (m_segmentedFrontEnd->isReady()) {
+      m_frontEndSections.push_back(m_segmentedFrontEnd->popSection());
+    }
   }
-  m_pipelineStats.f3ToF2Time +=
-      std::chrono::duration_cast<std::chrono::microseconds>(
-          std::chrono::high_resolution_clock::now() - t0)
-          .count();
 
-  t0 = std::chrono::high_resolution_clock::now();
-  while (m_f3FrameToF2Section.isReady()) {
+  auto t0 = std::chrono::high_resolution_clock::now();
+  for (auto& f2Section : m_frontEndSections) {
     // P-1: move the section into the next stage (F2SectionCorrection has an
     // rvalue pushSection overload) to avoid a whole-section deep copy.
-    m_f2SectionCorrection.pushSection(m_f3FrameToF2Section.popSection());
+    m_f2SectionCorrection.pushSection(std::move(f2Section));
   }
+  m_frontEndSections.clear();
   m_pipelineStats.f2CorrectionTime +=
       std::chrono::duration_cast<std::chrono::microseconds>(
           std::chrono::high_resolution_clock::now() - t0)
@@ -502,14 +519,19 @@ void EfmProcessor::drainDataPipeline() {
 
 void EfmProcessor::showGeneralPipelineStatistics() const {
   [[maybe_unused]] int64_t totalMs =
-      (m_pipelineStats.channelToF3Time + m_pipelineStats.f3ToF2Time +
+      (m_frontEnd.channelToF3Time + m_frontEnd.f3ToF2Time +
        m_pipelineStats.f2CorrectionTime) /
       1000;
   ORC_LOG_INFO("Decoder processing summary (general):");
+  if (m_segmentedFrontEnd) {
+    // The channel and F3 stage times are summed over the worker threads.
+    ORC_LOG_INFO("  Segmented front end: {} segment(s) re-decoded serially",
+                 m_segmentedFrontEnd->resyncedSegments());
+  }
   ORC_LOG_INFO("  Channel to F3 processing time: {} ms",
-               m_pipelineStats.channelToF3Time / 1000);
+               m_frontEnd.channelToF3Time / 1000);
   ORC_LOG_INFO("  F3 to F2 section processing time: {} ms",
-               m_pipelineStats.f3ToF2Time / 1000);
+               m_frontEnd.f3ToF2Time / 1000);
   ORC_LOG_INFO("  F2 correction processing time: {} ms",
                m_pipelineStats.f2CorrectionTime / 1000);
   ORC_LOG_INFO("  Total processing time: {} ms ({:.2f} seconds)", totalMs,
@@ -1358,11 +1380,11 @@ void EfmProcessor::showAllStatistics() const {
   ORC_LOG_INFO("{}", bannerBottom());
   ORC_LOG_INFO("");
 
-  m_tValuesToChannel.showStatistics();
+  m_frontEnd.tValuesToChannel.showStatistics();
   ORC_LOG_INFO("");
-  m_channelToF3.showStatistics();
+  m_frontEnd.channelToF3.showStatistics();
   ORC_LOG_INFO("");
-  m_f3FrameToF2Section.showStatistics();
+  m_frontEnd.f3FrameToF2Section.showStatistics();
   ORC_LOG_INFO("");
   m_f2SectionCorrection.showStatistics();
   ORC_LOG_INFO("");
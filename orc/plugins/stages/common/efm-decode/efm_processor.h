@@ -20,6 +20,7 @@
 #include "bounded_queue.h"
 #include "decoders.h"
 #include "section.h"
+#include "segmented_front_end.h"
 
 // General pipeline decoders
 #include "dec_channeltof3frame.h"
@@ -74,6 +75,11 @@ class EfmProcessor {
 
   // EFM options
   void setNoTimecodes(bool noTimecodes);
+  // Worker threads for the bit-level front end (T-values -> F2 sections).
+  // 1 (the default) decodes on the caller's thread; anything else decodes the
+  // stream in segments on that many threads (0 = one per hardware thread),
+  // with output identical to the serial decode (see SegmentedFrontEnd).
+  void setFrontEndWorkers(uint32_t workers);
 
   // Audio options
   void setAudacityLabels(bool audacityLabels);
@@ -113,15 +119,17 @@ class EfmProcessor {
   bool m_outputMetadata;
   bool m_reportOutput;
   std::string m_reportFilename;  // empty = derive from m_outputFilename
+  uint32_t m_frontEndWorkers;
 
   // -----------------------------------------------------------------------
   // Pipeline decoder instances
   // -----------------------------------------------------------------------
 
-  // General pipeline (EFM → F2 section)
-  TvaluesToChannel m_tValuesToChannel;
-  ChannelToF3Frame m_channelToF3;
-  F3FrameToF2Section m_f3FrameToF2Section;
+  // General pipeline (EFM → F2 section). In segmented mode m_frontEnd is not
+  // fed; it receives the merged statistics at the end of the stream.
+  FrontEndChain m_frontEnd;
+  std::unique_ptr<SegmentedFrontEnd> m_segmentedFrontEnd;
+  std::vector<F2Section> m_frontEndSections;  // reused F2 section hand-off
   F2SectionCorrection m_f2SectionCorrection;
 
   // D24 pipeline (F2 section → Data24 section)
@@ -151,9 +159,8 @@ class EfmProcessor {
   // Pipeline statistics
   // -----------------------------------------------------------------------
   struct AllPipelineStatistics {
-    // General pipeline timing (µs)
-    int64_t channelToF3Time{0};
-    int64_t f3ToF2Time{0};
+    // General pipeline timing (µs). The channel -> F3 and F3 -> F2 times are
+    // kept by FrontEndChain.
     int64_t f2CorrectionTime{0};
 
     // D24 pipeline timing (µs)
@@ -190,7 +197,10 @@ class EfmProcessor {
   //
   // The pipeline is divided at the F2-section boundary. The bit-level FRONT END
   // (t-values -> Channel -> F3 -> F2 -> F2SectionCorrection) runs on the
-  // caller's thread inside pushChunk(); each completed F2 section is handed to
+  // caller's thread inside pushChunk() (with setFrontEndWorkers() > 1 the
+  // T-values -> F2 part is spread over SegmentedFrontEnd's workers, and the
+  // stitched sections still reach F2SectionCorrection in stream order); each
+  // completed F2 section is handed to
   // the section-level BACK END (F2 -> F1 -> Data24 -> audio/data -> writers),
   // which runs on m_backEndThread and consumes sections from m_sectionQueue.
   //
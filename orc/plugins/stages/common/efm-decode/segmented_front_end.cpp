@@ -0,0 +1,220 @@
+/*
+ * File:        segmented_front_end.cpp
+ * Purpose:     efm-decoder - Parallel, segmented T-value to F2 front end
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "segmented_front_end.h"
+
+#include <orc/support/logging.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <utility>
+
+// ---------------------------------------------------------------------------
+// FrontEndChain
+// ---------------------------------------------------------------------------
+
+void FrontEndChain::pushChunk(const std::vector<uint8_t>& chunk,
+                              std::vector<F2Section>& sections) {
+  tValuesToChannel.pushFrame(chunk);
+
+  auto t0 = std::chrono::high_resolution_clock::now();
+  while (tValuesToChannel.isReady()) {
+    tValuesToChannel.popFrame(m_channelFrame);
+    channelToF3.pushFrame(m_channelFrame);
+  }
+  channelToF3Time += std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::high_resolution_clock::now() - t0)
+                         .count();
+
+  t0 = std::chrono::high_resolution_clock::now();
+  while (channelToF3.isReady()) {
+    // P-1: move the frame into the next stage to avoid a deep copy.
+    f3FrameToF2Section.pushFrame(channelToF3.popFrame());
+  }
+  f3ToF2Time += std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::high_resolution_clock::now() - t0)
+                    .count();
+
+  while (f3FrameToF2Section.isReady()) {
+    sections.push_back(f3FrameToF2Section.popSection());
+  }
+}
+
+void FrontEndChain::resetStatistics() {
+  tValuesToChannel.resetStatistics();
+  channelToF3.resetStatistics();
+  f3FrameToF2Section.resetStatistics();
+}
+
+void FrontEndChain::mergeStatistics(const FrontEndChain& other) {
+  tValuesToChannel.mergeStatistics(other.tValuesToChannel);
+  channelToF3.mergeStatistics(other.channelToF3);
+  f3FrameToF2Section.mergeStatistics(other.f3FrameToF2Section);
+  channelToF3Time += other.channelToF3Time;
+  f3ToF2Time += other.f3ToF2Time;
+}
+
+// ---------------------------------------------------------------------------
+// SegmentedFrontEnd
+// ---------------------------------------------------------------------------
+
+SegmentedFrontEnd::SegmentedFrontEnd(size_t workerCount,
+                                     size_t chunksPerSegment,
+                                     size_t warmUpChunks)
+    : m_workerCount(std::max<size_t>(workerCount, 1)),
+      m_chunksPerSegment(std::max<size_t>(chunksPerSegment, 1)),
+      m_warmUpChunks(warmUpChunks),
+      m_continuation(std::make_unique<FrontEndChain>()) {}
+
+SegmentedFrontEnd::~SegmentedFrontEnd() {
+  // Abandoned mid-stream (cancel, or an exception further down the pipeline):
+  // stop the workers at their next chunk and wait for them, since they read
+  // segments this object owns.
+  m_abort.store(true);
+  for (auto& inFlight : m_inFlight) {
+    if (inFlight.result.valid()) inFlight.result.wait();
+  }
+}
+
+void SegmentedFrontEnd::pushChunk(const std::vector<uint8_t>& chunk) {
+  m_pendingChunks.push_back(
+      std::make_shared<const std::vector<uint8_t>>(chunk));
+
+  if (m_pendingChunks.size() >= m_chunksPerSegment) {
+    // Back-pressure: at most m_workerCount segments are decoded at once, which
+    // also bounds the T-values held in memory.
+    while (m_inFlight.size() >= m_workerCount) {
+      stitch(m_inFlight.front());
+      m_inFlight.pop_front();
+    }
+    dispatchSegment();
+  }
+
+  // Stitch whatever has already finished so sections flow downstream promptly.
+  while (!m_inFlight.empty() &&
+         m_inFlight.front().result.wait_for(std::chrono::seconds(0)) ==
+             std::future_status::ready) {
+    stitch(m_inFlight.front());
+    m_inFlight.pop_front();
+  }
+}
+
+void SegmentedFrontEnd::finish() {
+  dispatchSegment();
+  while (!m_inFlight.empty()) {
+    stitch(m_inFlight.front());
+    m_inFlight.pop_front();
+  }
+
+  // The last chain's statistics have not been merged yet.
+  m_statistics.mergeStatistics(*m_continuation);
+
+  ORC_LOG_DEBUG(
+      "SegmentedFrontEnd::finish() - {} segment(s) had to be re-decoded "
+      "serially",
+      m_resyncedSegments);
+}
+
+bool SegmentedFrontEnd::isReady() const { return !m_outputBuffer.empty(); }
+
+F2Section SegmentedFrontEnd::popSection() {
+  F2Section section = std::move(m_outputBuffer.front());
+  m_outputBuffer.pop_front();
+  return section;
+}
+
+void SegmentedFrontEnd::dispatchSegment() {
+  if (m_pendingChunks.empty()) return;
+
+  auto segment = std::make_shared<Segment>();
+  segment->warmUp = m_warmUp;
+  segment->chunks = std::move(m_pendingChunks);
+  m_pendingChunks.clear();
+  m_pendingChunks.reserve(m_chunksPerSegment);
+
+  // The next segment warms up on the tail of this one.
+  const size_t keep = std::min(m_warmUpChunks, segment->chunks.size());
+  m_warmUp.assign(segment->chunks.end() - static_cast<std::ptrdiff_t>(keep),
+                  segment->chunks.end());
+
+  InFlight inFlight;
+  inFlight.segment = segment;
+  inFlight.result = std::async(std::launch::async, [this, segment] {
+    return decodeSegment(*segment, m_abort);
+  });
+  m_inFlight.push_back(std::move(inFlight));
+}
+
+SegmentedFrontEnd::SegmentResult SegmentedFrontEnd::decodeSegment(
+    const Segment& segment, const std::atomic<bool>& abort) {
+  SegmentResult result;
+  result.chain = std::make_unique<FrontEndChain>();
+  FrontEndChain& chain = *result.chain;
+
+  // Warm up on the previous segment's tail; its sections belong to that
+  // segment and are dropped.
+  std::vector<F2Section> discarded;
+  for (const auto& chunk : segment.warmUp) {
+    if (abort.load()) return result;
+    chain.pushChunk(*chunk, discarded);
+    discarded.clear();
+  }
+
+  chain.resetStatistics();
+  result.entry.tValuesToChannel = chain.tValuesToChannel;
+  result.entry.f3FrameToF2Section = chain.f3FrameToF2Section;
+
+  for (const auto& chunk : segment.chunks) {
+    if (abort.load()) return result;
+    chain.pushChunk(*chunk, result.sections);
+  }
+  return result;
+}
+
+void SegmentedFrontEnd::stitch(InFlight& inFlight) {
+  SegmentResult result;
+  bool decoded = true;
+  try {
+    result = inFlight.result.get();
+  } catch (...) {
+    // A worker that started cold can hit a decoder invariant the serial decode
+    // never reaches from its state. Decode the segment serially below: if the
+    // failure is genuine it is raised again from there, on this thread.
+    decoded = false;
+  }
+
+  if (decoded &&
+      m_continuation->tValuesToChannel.hasSameDecodeState(
+          result.entry.tValuesToChannel) &&
+      m_continuation->f3FrameToF2Section.hasSameDecodeState(
+          result.entry.f3FrameToF2Section)) {
+    // The worker's chain was where the serial decode is now: take its
+    // sections and continue from its chain.
+    m_statistics.mergeStatistics(*m_continuation);
+    m_continuation = std::move(result.chain);
+    for (auto& section : result.sections) {
+      m_outputBuffer.push_back(std::move(section));
+    }
+    return;
+  }
+
+  // The warm-up did not converge: decode the segment from the serial state.
+  ++m_resyncedSegments;
+  ORC_LOG_DEBUG(
+      "SegmentedFrontEnd::stitch() - Segment warm-up did not converge, "
+      "decoding {} chunks serially",
+      inFlight.segment->chunks.size());
+  for (const auto& chunk : inFlight.segment->chunks) {
+    m_continuation->pushChunk(*chunk, m_continuationSections);
+    for (auto& section : m_continuationSections) {
+      m_outputBuffer.push_back(std::move(section));
+    }
+    m_continuationSections.clear();
+  }
+}
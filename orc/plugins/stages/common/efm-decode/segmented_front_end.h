@@ -0,0 +1,156 @@
+/*
+ * File:        segmented_front_end.h
+ * Purpose:     efm-decoder - Parallel, segmented T-value to F2 front end
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#ifndef SEGMENTED_FRONT_END_H
+#define SEGMENTED_FRONT_END_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "dec_channeltof3frame.h"
+#include "dec_f3frametof2section.h"
+#include "dec_tvaluestochannel.h"
+#include "section.h"
+
+// The bit-level front end of the decoder, T-values -> channel frames -> F3
+// frames -> F2 sections, as one unit. EfmProcessor runs a single chain on the
+// caller's thread; SegmentedFrontEnd runs one per segment on a worker pool.
+struct FrontEndChain {
+  TvaluesToChannel tValuesToChannel;
+  ChannelToF3Frame channelToF3;
+  F3FrameToF2Section f3FrameToF2Section;
+
+  // Processing time (µs) spent in the channel -> F3 and F3 -> F2 stages.
+  int64_t channelToF3Time{0};
+  int64_t f3ToF2Time{0};
+
+  // Feeds one chunk of T-values through the chain and appends every F2
+  // section it completes to |sections|.
+  void pushChunk(const std::vector<uint8_t>& chunk,
+                 std::vector<F2Section>& sections);
+
+  void resetStatistics();
+  void mergeStatistics(const FrontEndChain& other);
+
+ private:
+  std::vector<uint8_t> m_channelFrame;  // reused T-values -> F3 hand-off
+};
+
+// ---------------------------------------------------------------------------
+// SegmentedFrontEnd
+// ---------------------------------------------------------------------------
+// Decodes the T-value stream to F2 sections on a pool of worker threads while
+// producing exactly the sections (and statistics) of a single serial chain.
+//
+// Incoming chunks are grouped into segments of chunksPerSegment chunks. Each
+// segment is decoded by a fresh FrontEndChain on its own thread, after first
+// being fed the previous segment's last warmUpChunks chunks so that it has
+// acquired frame and section sync by the time it reaches its own first chunk.
+// The chain's decode state at that point is recorded.
+//
+// Segments are stitched in stream order on the caller's thread. The stitcher
+// keeps the chain that produced the previous segment, which is exactly where a
+// serial decode would be at the segment boundary. If its decode state matches
+// the recorded state of the next segment's chain, both would emit identical
+// sections from there on, so the segment's sections are taken as they are
+// and its chain becomes the stitcher's. If not (the warm-up did not converge,
+// e.g. in a badly damaged region) the stitcher decodes that segment itself,
+// serially, continuing from the previous chain. Either way the output is
+// identical to a serial decode; only the work distribution differs.
+//
+// Sections from later segments are held until every earlier segment has been
+// stitched, and at most workerCount segments are in flight; pushChunk()
+// blocks when that limit is reached.
+class SegmentedFrontEnd {
+ public:
+  // With 1024-value chunks: ~2 Mi T-values (~160 sections, ~2 s of audio)
+  // per segment and a ~5-section warm-up. Section sync needs about three
+  // sections to settle, and about 3 % of the stream is decoded twice.
+  static constexpr size_t kDefaultChunksPerSegment = 2048;
+  static constexpr size_t kDefaultWarmUpChunks = 64;
+
+  explicit SegmentedFrontEnd(
+      size_t workerCount, size_t chunksPerSegment = kDefaultChunksPerSegment,
+      size_t warmUpChunks = kDefaultWarmUpChunks);
+  ~SegmentedFrontEnd();
+
+  SegmentedFrontEnd(const SegmentedFrontEnd&) = delete;
+  SegmentedFrontEnd& operator=(const SegmentedFrontEnd&) = delete;
+
+  void pushChunk(const std::vector<uint8_t>& chunk);
+  // Decodes the final (partial) segment and stitches everything outstanding.
+  // Call once, after the last pushChunk().
+  void finish();
+
+  bool isReady() const;
+  F2Section popSection();
+
+  // Statistics of the stitched stream, equal to those of a serial chain.
+  // Complete once finish() has returned.
+  const FrontEndChain& statistics() const { return m_statistics; }
+
+  // Segments the stitcher had to decode itself because the warm-up had not
+  // converged.
+  uint64_t resyncedSegments() const { return m_resyncedSegments; }
+
+ private:
+  using Chunk = std::shared_ptr<const std::vector<uint8_t>>;
+
+  struct Segment {
+    std::vector<Chunk> warmUp;
+    std::vector<Chunk> chunks;
+  };
+
+  // Decode state of a worker's chain at its segment's first chunk.
+  struct EntryState {
+    TvaluesToChannel tValuesToChannel;
+    F3FrameToF2Section f3FrameToF2Section;
+  };
+
+  struct SegmentResult {
+    EntryState entry;
+    std::unique_ptr<FrontEndChain> chain;  // statistics from the entry on
+    std::vector<F2Section> sections;       // sections from the entry on
+  };
+
+  struct InFlight {
+    std::shared_ptr<const Segment> segment;
+    std::future<SegmentResult> result;
+  };
+
+  static SegmentResult decodeSegment(const Segment& segment,
+                                     const std::atomic<bool>& abort);
+
+  void dispatchSegment();
+  void stitch(InFlight& inFlight);
+
+  size_t m_workerCount;
+  size_t m_chunksPerSegment;
+  size_t m_warmUpChunks;
+
+  std::vector<Chunk> m_pendingChunks;  // segment being filled
+  std::vector<Chunk> m_warmUp;         // tail of the last dispatched segment
+  std::deque<InFlight> m_inFlight;
+
+  // The chain whose state matches a serial decode at the last stitched
+  // segment boundary, and the statistics merged from retired chains.
+  std::unique_ptr<FrontEndChain> m_continuation;
+  FrontEndChain m_statistics;
+  std::vector<F2Section> m_continuationSections;
+
+  std::deque<F2Section> m_outputBuffer;
+  std::atomic<bool> m_abort{false};
+  uint64_t m_resyncedSegments{0};
+};
+
+#endif  // SEGMENTED_FRONT_END_H
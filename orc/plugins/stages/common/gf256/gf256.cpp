@@ -0,0 +1,221 @@
+/*
+ * File:        gf256.cpp
+ * Module:      orc-gf256 (shared stage-plugin library)
+ * Purpose:     GF(2^8) arithmetic and Reed-Solomon syndrome kernels
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "gf256.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+#if defined(ORC_GF256_X86_KERNELS)
+#include "gf256_x86.h"
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+#endif
+
+namespace orc::gf256 {
+
+namespace {
+
+Tables buildTables(uint16_t polynomial) {
+  if ((polynomial & 0xFF00) != 0x100) {
+    throw std::invalid_argument("gf256: polynomial must have degree 8");
+  }
+  Tables t{};
+  uint16_t value = 1;
+  for (int i = 0; i < 255; ++i) {
+    // x generates the whole multiplicative group only if it first returns
+    // to 1 after 255 steps.
+    if (i > 0 && value == 1) {
+      throw std::invalid_argument("gf256: x is not primitive for polynomial");
+    }
+    t.exp[i] = static_cast<uint8_t>(value);
+    t.exp[i + 255] = static_cast<uint8_t>(value);
+    t.log[value] = static_cast<uint8_t>(i);
+    value <<= 1;
+    if (value & 0x100) value ^= polynomial;
+  }
+
+  const auto logMultiply = [&t](int a, int b) -> uint8_t {
+    if (a == 0 || b == 0) return 0;
+    return t.exp[t.log[a] + t.log[b]];
+  };
+  for (int c = 0; c < 256; ++c) {
+    for (int v = 0; v < 16; ++v) {
+      t.mulLow[c][v] = logMultiply(c, v);
+      t.mulHigh[c][v] = logMultiply(c, v << 4);
+    }
+  }
+  return t;
+}
+
+Isa detectIsa() {
+#if defined(ORC_GF256_X86_KERNELS)
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  const int maxLeaf = info[0];
+  __cpuid(info, 1);
+  const bool ssse3 = (info[2] & (1 << 9)) != 0;
+  const bool osxsave = (info[2] & (1 << 27)) != 0;
+  const bool avx = (info[2] & (1 << 28)) != 0;
+  bool avx2 = false;
+  // AVX2 also needs the OS to save the YMM state (XCR0 bits 1 and 2).
+  if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+    __cpuidex(info, 7, 0);
+    avx2 = (info[1] & (1 << 5)) != 0;
+  }
+#else
+  __builtin_cpu_init();
+  const bool ssse3 = __builtin_cpu_supports("ssse3");
+  const bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+  if (avx2) return Isa::Avx2;
+  if (ssse3) return Isa::Ssse3;
+#endif
+  return Isa::Scalar;
+}
+
+}  // namespace
+
+const Tables& tables() {
+  static const Tables instance = buildTables(kPrimitivePolynomial);
+  return instance;
+}
+
+const Tables& tables(uint16_t polynomial) {
+  if (polynomial == kPrimitivePolynomial) return tables();
+
+  // Entries are never removed, so references stay valid after the lock.
+  static std::mutex mutex;
+  static std::map<uint16_t, std::unique_ptr<const Tables>> fields;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& entry = fields[polynomial];
+  if (!entry) {
+    try {
+      entry = std::make_unique<const Tables>(buildTables(polynomial));
+    } catch (...) {
+      fields.erase(polynomial);
+      throw;
+    }
+  }
+  return *entry;
+}
+
+uint8_t multiply(uint8_t a, uint8_t b) { return tables().multiply(a, b); }
+
+uint8_t alphaPower(uint32_t n) { return tables().exp[n % 255]; }
+
+Isa bestIsa() {
+  static const Isa isa = detectIsa();
+  return isa;
+}
+
+const char* isaName(Isa isa) {
+  switch (isa) {
+    case Isa::Avx2:
+      return "avx2";
+    case Isa::Ssse3:
+      return "ssse3";
+    case Isa::Scalar:
+      break;
+  }
+  return "scalar";
+}
+
+// ---------------------------------------------------------------------------
+// SyndromeKernel
+// ---------------------------------------------------------------------------
+
+SyndromeKernel::SyndromeKernel(size_t length, size_t roots, Isa isa)
+    : SyndromeKernel(length, roots, kPrimitivePolynomial, 0, isa) {}
+
+SyndromeKernel::SyndromeKernel(size_t length, size_t roots,
+                               uint16_t polynomial, uint32_t firstRoot,
+                               Isa isa)
+    : m_length(length),
+      m_roots(roots),
+      m_isa(isa < bestIsa() ? isa : bestIsa()) {
+  if (roots == 0 || roots > kMaxRoots || length <= roots || length > 255) {
+    throw std::invalid_argument(
+        "SyndromeKernel: unsupported code length or number of roots");
+  }
+
+  const Tables& t = tables(polynomial);
+  const auto power = [&t](uint32_t n) { return t.exp[n % 255]; };
+  m_packedLow.assign(length * 16, 0);
+  m_packedHigh.assign(length * 16, 0);
+  for (size_t j = 0; j < length; ++j) {
+    const auto degree = static_cast<uint32_t>(length - 1 - j);
+    for (size_t i = 0; i < roots; ++i) {
+      const uint32_t root = (firstRoot + static_cast<uint32_t>(i)) % 255;
+      const uint8_t weight = power(root * degree);
+      for (size_t v = 0; v < 16; ++v) {
+        const unsigned shift = static_cast<unsigned>(8 * i);
+        m_packedLow[j * 16 + v] |=
+            static_cast<uint64_t>(t.mulLow[weight][v]) << shift;
+        m_packedHigh[j * 16 + v] |=
+            static_cast<uint64_t>(t.mulHigh[weight][v]) << shift;
+      }
+    }
+  }
+
+  m_rootTables.resize(roots * 32);
+  for (size_t i = 0; i < roots; ++i) {
+    const uint8_t root = power(firstRoot + static_cast<uint32_t>(i));
+    for (size_t v = 0; v < 16; ++v) {
+      m_rootTables[i * 32 + v] = t.mulLow[root][v];
+      m_rootTables[i * 32 + 16 + v] = t.mulHigh[root][v];
+    }
+  }
+}
+
+bool SyndromeKernel::compute(const uint8_t* word, uint8_t* syndromes) const {
+  // Every root's product for a symbol comes from one table pair, so the
+  // syndromes accumulate side by side in the bytes of |acc|.
+  const uint64_t* low = m_packedLow.data();
+  const uint64_t* high = m_packedHigh.data();
+  uint64_t acc = 0;
+  for (size_t j = 0; j < m_length; ++j, low += 16, high += 16) {
+    const uint8_t symbol = word[j];
+    acc ^= low[symbol & 0x0F] ^ high[symbol >> 4];
+  }
+  for (size_t i = 0; i < m_roots; ++i) {
+    syndromes[i] = static_cast<uint8_t>(acc >> (8 * i));
+  }
+  return acc == 0;
+}
+
+void SyndromeKernel::computeBatch(const uint8_t* words, size_t stride,
+                                  size_t count, uint8_t* syndromes) const {
+  size_t done = 0;
+#if defined(ORC_GF256_X86_KERNELS)
+  // The kernels transpose 16 symbols at a time, so shorter words stay scalar.
+  if (m_length >= 16) {
+    if (m_isa == Isa::Avx2) {
+      done = detail::computeSyndromesAvx2(words, stride, m_length, count,
+                                          m_rootTables.data(), m_roots,
+                                          syndromes);
+    }
+    if (m_isa >= Isa::Ssse3 && count - done >= 16) {
+      done += detail::computeSyndromesSsse3(
+          words + done * stride, stride, m_length, count - done,
+          m_rootTables.data(), m_roots, syndromes + done * m_roots);
+    }
+  }
+#endif
+  for (; done < count; ++done) {
+    compute(words + done * stride, syndromes + done * m_roots);
+  }
+}
+
+}  // namespace orc::gf256
@@ -0,0 +1,129 @@
+/*
+ * File:        gf256.h
+ * Module:      orc-gf256 (shared stage-plugin library)
+ * Purpose:     GF(2^8) arithmetic and Reed-Solomon syndrome kernels
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace orc::gf256 {
+
+// The field generated by P(x) = x^8 + x^4 + x^3 + x^2 + 1 (0x11D) with
+// primitive element alpha = x (2): the field of the CD CIRC and CD-ROM RSPC
+// codes (ECMA-130 / IEC 60908). The default field of every function below.
+// Other fields (the LaserDisc AC-3 RF code uses 0x187) are selected by passing
+// their polynomial; alpha is always x.
+constexpr uint16_t kPrimitivePolynomial = 0x11D;
+
+// ---------------------------------------------------------------------------
+// Tables
+// ---------------------------------------------------------------------------
+// Built once, on first use, and read-only thereafter (safe to share between
+// threads).
+struct Tables {
+  // exp[i] = alpha^i for i in [0, 510): doubled so that exp[log a + log b]
+  // needs no modulo.
+  uint8_t exp[510];
+  // log[a] = i such that alpha^i = a, for a != 0 (log[0] is unused).
+  uint8_t log[256];
+  // Split-nibble products: mulLow[c][v] = c * v and
+  // mulHigh[c][v] = c * (v << 4) for v in [0, 16), so
+  // c * x = mulLow[c][x & 15] ^ mulHigh[c][x >> 4]. These are the 16-entry
+  // tables the SIMD kernels feed to pshufb.
+  uint8_t mulLow[256][16];
+  uint8_t mulHigh[256][16];
+
+  uint8_t multiply(uint8_t a, uint8_t b) const {
+    return (a == 0 || b == 0) ? 0 : exp[log[a] + log[b]];
+  }
+  // a^-1 for a != 0.
+  uint8_t inverse(uint8_t a) const { return exp[255 - log[a]]; }
+};
+
+const Tables& tables();
+// Tables of the field generated by |polynomial| (bit 8 set). Built once per
+// polynomial on first use. Throws std::invalid_argument unless x is a
+// primitive element of that field.
+const Tables& tables(uint16_t polynomial);
+
+uint8_t multiply(uint8_t a, uint8_t b);
+// alpha^n for any n >= 0.
+uint8_t alphaPower(uint32_t n);
+
+// ---------------------------------------------------------------------------
+// Instruction set selection
+// ---------------------------------------------------------------------------
+enum class Isa { Scalar, Ssse3, Avx2 };
+
+// The widest kernel this build and CPU support.
+Isa bestIsa();
+const char* isaName(Isa isa);
+
+// ---------------------------------------------------------------------------
+// SyndromeKernel
+// ---------------------------------------------------------------------------
+// Computes the syndromes S_i = r(alpha^(firstRoot + i)), i in [0, roots), of
+// received words of a fixed length (primitive element step 1). The CD codes
+// use the default field with first consecutive root 0; the AC-3 RF codes
+// use 0x187 with first root 120. Symbol 0 of a word is the
+// highest-order coefficient, as in ezpwd / Phil Karn's decoders, so the
+// syndromes match the ones those decoders compute internally. All syndromes are
+// zero exactly when the word is a codeword, which lets a decoder skip
+// Berlekamp-Massey and Chien search for the (vast majority of) clean words.
+//
+// compute() handles one word with per-position split-nibble tables that yield
+// all syndromes at once (one table pair lookup per symbol). computeBatch()
+// additionally runs 16 (SSSE3) or 32 (AVX2) words side by side with pshufb,
+// one word per byte lane, when the CPU supports it.
+//
+// Thread-safety: immutable after construction; compute() and computeBatch()
+// may be called concurrently.
+class SyndromeKernel {
+ public:
+  static constexpr size_t kMaxRoots = 8;
+
+  // Throws std::invalid_argument unless 0 < roots <= kMaxRoots and
+  // roots < length <= 255. |isa| is lowered to bestIsa() if unsupported.
+  SyndromeKernel(size_t length, size_t roots, Isa isa = bestIsa());
+  // As above, over the field of |polynomial| with first consecutive root
+  // alpha^firstRoot.
+  SyndromeKernel(size_t length, size_t roots, uint16_t polynomial,
+                 uint32_t firstRoot, Isa isa = bestIsa());
+
+  size_t length() const { return m_length; }
+  size_t roots() const { return m_roots; }
+  Isa isa() const { return m_isa; }
+
+  // Writes roots() syndromes for |word| (length() symbols). Returns true if
+  // they are all zero, i.e. |word| is a codeword.
+  bool compute(const uint8_t* word, uint8_t* syndromes) const;
+
+  // Syndromes of |count| words, word k starting at words + k * stride; word k's
+  // syndromes are written to syndromes[k * roots(), (k + 1) * roots()).
+  void computeBatch(const uint8_t* words, size_t stride, size_t count,
+                    uint8_t* syndromes) const;
+
+ private:
+  size_t m_length;
+  size_t m_roots;
+  Isa m_isa;
+
+  // Position j, nibble v: the products of v (low) or v << 4 (high) with
+  // alpha^((firstRoot + i) * (length - 1 - j)) for every root i, packed one
+  // per byte.
+  std::vector<uint64_t> m_packedLow;
+  std::vector<uint64_t> m_packedHigh;
+
+  // Root i: mulLow / mulHigh rows of alpha^(firstRoot + i), the Horner step of the SIMD
+  // kernels (32 bytes per root).
+  std::vector<uint8_t> m_rootTables;
+};
+
+}  // namespace orc::gf256
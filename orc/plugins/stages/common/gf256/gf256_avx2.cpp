@@ -0,0 +1,73 @@
+/*
+ * File:        gf256_avx2.cpp
+ * Module:      orc-gf256 (shared stage-plugin library)
+ * Purpose:     AVX2 (vpshufb) batch syndrome kernel, 32 words at a time
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+// Built with -mavx2 (see CMakeLists.txt) and only called after a runtime
+// CPU check. Keep standard-library templates out of this file: instantiations
+// compiled here could be shared with callers on CPUs without AVX2.
+
+#include <immintrin.h>
+
+#include "gf256_x86.h"
+#include "gf256_x86_transpose.h"
+
+namespace orc::gf256::detail {
+
+size_t computeSyndromesAvx2(const uint8_t* words, size_t stride,
+                            size_t length, size_t count,
+                            const uint8_t* rootTables, size_t roots,
+                            uint8_t* syndromes) {
+  constexpr size_t kLanes = 32;
+  alignas(32) uint8_t rows[255 * kLanes];
+  alignas(32) uint8_t lanes[kLanes];
+
+  // vpshufb looks up within each 128-bit half, so both halves get the table.
+  __m256i low[8];
+  __m256i high[8];
+  for (size_t i = 0; i < roots; ++i) {
+    low[i] = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(rootTables + i * 32)));
+    high[i] = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(rootTables + i * 32 + 16)));
+  }
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+  size_t done = 0;
+  for (; done + kLanes <= count; done += kLanes) {
+    const uint8_t* block = words + done * stride;
+    transposeWords(block, stride, length, rows, kLanes);
+    transposeWords(block + 16 * stride, stride, length, rows + 16, kLanes);
+
+    // Horner's rule in every lane: acc_i = acc_i * alpha^i ^ r_j.
+    __m256i acc[8];
+    for (size_t i = 0; i < roots; ++i) acc[i] = _mm256_setzero_si256();
+    for (size_t j = 0; j < length; ++j) {
+      const __m256i symbol = _mm256_load_si256(
+          reinterpret_cast<const __m256i*>(rows + j * kLanes));
+      for (size_t i = 0; i < roots; ++i) {
+        const __m256i lo = _mm256_and_si256(acc[i], nibble);
+        const __m256i hi =
+            _mm256_and_si256(_mm256_srli_epi16(acc[i], 4), nibble);
+        acc[i] = _mm256_xor_si256(
+            _mm256_xor_si256(_mm256_shuffle_epi8(low[i], lo),
+                             _mm256_shuffle_epi8(high[i], hi)),
+            symbol);
+      }
+    }
+
+    for (size_t i = 0; i < roots; ++i) {
+      _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc[i]);
+      for (size_t k = 0; k < kLanes; ++k) {
+        syndromes[(done + k) * roots + i] = lanes[k];
+      }
+    }
+  }
+  return done;
+}
+
+}  // namespace orc::gf256::detail
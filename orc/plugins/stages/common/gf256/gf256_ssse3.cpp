@@ -0,0 +1,68 @@
+/*
+ * File:        gf256_ssse3.cpp
+ * Module:      orc-gf256 (shared stage-plugin library)
+ * Purpose:     SSSE3 (pshufb) batch syndrome kernel, 16 words at a time
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+// Built with -mssse3 (see CMakeLists.txt) and only called after a runtime
+// CPU check. Keep standard-library templates out of this file: instantiations
+// compiled here could be shared with callers on CPUs without SSSE3.
+
+#include <tmmintrin.h>
+
+#include "gf256_x86.h"
+#include "gf256_x86_transpose.h"
+
+namespace orc::gf256::detail {
+
+size_t computeSyndromesSsse3(const uint8_t* words, size_t stride,
+                             size_t length, size_t count,
+                             const uint8_t* rootTables, size_t roots,
+                             uint8_t* syndromes) {
+  constexpr size_t kLanes = 16;
+  alignas(16) uint8_t rows[255 * kLanes];
+  alignas(16) uint8_t lanes[kLanes];
+
+  __m128i low[8];
+  __m128i high[8];
+  for (size_t i = 0; i < roots; ++i) {
+    low[i] = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(rootTables + i * 32));
+    high[i] = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(rootTables + i * 32 + 16));
+  }
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+
+  size_t done = 0;
+  for (; done + kLanes <= count; done += kLanes) {
+    transposeWords(words + done * stride, stride, length, rows, kLanes);
+
+    // Horner's rule in every lane: acc_i = acc_i * alpha^i ^ r_j.
+    __m128i acc[8];
+    for (size_t i = 0; i < roots; ++i) acc[i] = _mm_setzero_si128();
+    for (size_t j = 0; j < length; ++j) {
+      const __m128i symbol =
+          _mm_load_si128(reinterpret_cast<const __m128i*>(rows + j * kLanes));
+      for (size_t i = 0; i < roots; ++i) {
+        const __m128i lo = _mm_and_si128(acc[i], nibble);
+        const __m128i hi = _mm_and_si128(_mm_srli_epi16(acc[i], 4), nibble);
+        acc[i] = _mm_xor_si128(_mm_xor_si128(_mm_shuffle_epi8(low[i], lo),
+                                             _mm_shuffle_epi8(high[i], hi)),
+                               symbol);
+      }
+    }
+
+    for (size_t i = 0; i < roots; ++i) {
+      _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc[i]);
+      for (size_t k = 0; k < kLanes; ++k) {
+        syndromes[(done + k) * roots + i] = lanes[k];
+      }
+    }
+  }
+  return done;
+}
+
+}  // namespace orc::gf256::detail
@@ -0,0 +1,31 @@
+/*
+ * File:        gf256_x86.h
+ * Module:      orc-gf256 (shared stage-plugin library)
+ * Purpose:     Internal: x86 SIMD batch syndrome kernels
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace orc::gf256::detail {
+
+// Batch syndrome kernels (gf256_ssse3.cpp / gf256_avx2.cpp). Each handles
+// whole groups of 16 (SSSE3) or 32 (AVX2) words, one word per byte lane, and
+// returns how many words it handled; the caller finishes the remainder.
+// |rootTables| holds 32 bytes per root: the split-nibble product tables of
+// alpha^i. Requires 16 <= length <= 255 and roots <= 8.
+size_t computeSyndromesSsse3(const uint8_t* words, size_t stride,
+                             size_t length, size_t count,
+                             const uint8_t* rootTables, size_t roots,
+                             uint8_t* syndromes);
+size_t computeSyndromesAvx2(const uint8_t* words, size_t stride,
+                            size_t length, size_t count,
+                            const uint8_t* rootTables, size_t roots,
+                            uint8_t* syndromes);
+
+}  // namespace orc::gf256::detail
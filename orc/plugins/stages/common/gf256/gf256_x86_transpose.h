@@ -0,0 +1,75 @@
+/*
+ * File:        gf256_x86_transpose.h
+ * Module:      orc-gf256 (shared stage-plugin library)
+ * Purpose:     Internal: SSE2 byte-matrix transpose for the SIMD kernels
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <emmintrin.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace orc::gf256::detail {
+
+// The helpers below are compiled into both kernel translation units, each
+// built with its own -m flags. They must have internal linkage: an inline
+// function with external linkage would be merged across the two, and the
+// linker could keep the AVX2-encoded copy for the SSSE3 path.
+namespace {
+
+// In place: m[k] holds row k (16 bytes) on entry and column k on return.
+inline void transpose16x16(__m128i m[16]) {
+  __m128i a[16];
+  __m128i b[16];
+  for (int i = 0; i < 8; ++i) {
+    a[i] = _mm_unpacklo_epi8(m[2 * i], m[2 * i + 1]);
+    a[i + 8] = _mm_unpackhi_epi8(m[2 * i], m[2 * i + 1]);
+  }
+  for (int i = 0; i < 4; ++i) {
+    b[i] = _mm_unpacklo_epi16(a[2 * i], a[2 * i + 1]);
+    b[i + 4] = _mm_unpackhi_epi16(a[2 * i], a[2 * i + 1]);
+    b[i + 8] = _mm_unpacklo_epi16(a[2 * i + 8], a[2 * i + 9]);
+    b[i + 12] = _mm_unpackhi_epi16(a[2 * i + 8], a[2 * i + 9]);
+  }
+  for (int g = 0; g < 4; ++g) {
+    a[4 * g] = _mm_unpacklo_epi32(b[4 * g], b[4 * g + 1]);
+    a[4 * g + 1] = _mm_unpackhi_epi32(b[4 * g], b[4 * g + 1]);
+    a[4 * g + 2] = _mm_unpacklo_epi32(b[4 * g + 2], b[4 * g + 3]);
+    a[4 * g + 3] = _mm_unpackhi_epi32(b[4 * g + 2], b[4 * g + 3]);
+  }
+  for (int g = 0; g < 4; ++g) {
+    m[4 * g] = _mm_unpacklo_epi64(a[4 * g], a[4 * g + 2]);
+    m[4 * g + 1] = _mm_unpackhi_epi64(a[4 * g], a[4 * g + 2]);
+    m[4 * g + 2] = _mm_unpacklo_epi64(a[4 * g + 1], a[4 * g + 3]);
+    m[4 * g + 3] = _mm_unpackhi_epi64(a[4 * g + 1], a[4 * g + 3]);
+  }
+}
+
+// Transposes 16 words (word k at block + k * stride) so that symbol j of
+// word k lands in rows[j * rowStride + k]. Columns are taken 16 at a time;
+// the last group is re-aligned to end at |length| (overlapping the previous
+// one) so that no load reads past the end of a word.
+inline void transposeWords(const uint8_t* block, size_t stride, size_t length,
+                           uint8_t* rows, size_t rowStride) {
+  __m128i m[16];
+  for (size_t column = 0; column < length; column += 16) {
+    const size_t start = column + 16 <= length ? column : length - 16;
+    for (size_t k = 0; k < 16; ++k) {
+      m[k] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(block + k * stride + start));
+    }
+    transpose16x16(m);
+    for (size_t j = 0; j < 16; ++j) {
+      uint8_t* row = rows + (start + j) * rowStride;
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(row), m[j]);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace orc::gf256::detail
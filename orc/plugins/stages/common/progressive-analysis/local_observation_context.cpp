@@ -0,0 +1,77 @@
+/*
+ * File:        local_observation_context.cpp
+ * Module:      orc-progressive-analysis (shared stage-plugin library)
+ * Purpose:     Plugin-local scratch observation context for worker threads
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "local_observation_context.h"
+
+namespace orc {
+
+void LocalObservationContext::set(FieldID field_id,
+                                  const std::string& namespace_,
+                                  const std::string& key,
+                                  const ObservationValue& value) {
+  observations_[field_id][namespace_][key] = value;
+}
+
+std::optional<ObservationValue> LocalObservationContext::get(
+    FieldID field_id, const std::string& namespace_,
+    const std::string& key) const {
+  const auto field_it = observations_.find(field_id);
+  if (field_it == observations_.end()) return std::nullopt;
+  const auto ns_it = field_it->second.find(namespace_);
+  if (ns_it == field_it->second.end()) return std::nullopt;
+  const auto key_it = ns_it->second.find(key);
+  if (key_it == ns_it->second.end()) return std::nullopt;
+  return key_it->second;
+}
+
+bool LocalObservationContext::has(FieldID field_id,
+                                  const std::string& namespace_,
+                                  const std::string& key) const {
+  return get(field_id, namespace_, key).has_value();
+}
+
+std::vector<std::string> LocalObservationContext::get_keys(
+    FieldID field_id, const std::string& namespace_) const {
+  std::vector<std::string> keys;
+  const auto field_it = observations_.find(field_id);
+  if (field_it == observations_.end()) return keys;
+  const auto ns_it = field_it->second.find(namespace_);
+  if (ns_it == field_it->second.end()) return keys;
+  for (const auto& [key, value] : ns_it->second) keys.push_back(key);
+  return keys;
+}
+
+std::vector<std::string> LocalObservationContext::get_namespaces(
+    FieldID field_id) const {
+  std::vector<std::string> namespaces;
+  const auto field_it = observations_.find(field_id);
+  if (field_it == observations_.end()) return namespaces;
+  for (const auto& [ns, keys] : field_it->second) namespaces.push_back(ns);
+  return namespaces;
+}
+
+std::map<std::string, std::map<std::string, ObservationValue>>
+LocalObservationContext::get_all_observations(FieldID field_id) const {
+  const auto field_it = observations_.find(field_id);
+  if (field_it == observations_.end()) return {};
+  return field_it->second;
+}
+
+void LocalObservationContext::clear() { observations_.clear(); }
+
+void LocalObservationContext::clear_field(FieldID field_id) {
+  observations_.erase(field_id);
+}
+
+void LocalObservationContext::register_schema(
+    const std::vector<ObservationKey>& keys) {
+  (void)keys;
+}
+
+}  // namespace orc
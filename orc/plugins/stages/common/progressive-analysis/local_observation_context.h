@@ -0,0 +1,59 @@
+/*
+ * File:        local_observation_context.h
+ * Module:      orc-progressive-analysis (shared stage-plugin library)
+ * Purpose:     Plugin-local scratch observation context for worker threads
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <orc/stage/observation/observation_context_interface.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace orc {
+
+// ---------------------------------------------------------------------------
+// LocalObservationContext
+// ---------------------------------------------------------------------------
+// Minimal IObservationContext owned by a single analysis worker thread. The
+// host ObservationContext lives in orc-core and cannot be instantiated from a
+// plugin, and the pipeline context handed to trigger() is not thread-safe, so
+// each progressive-analysis worker observes into one of these and clears the
+// field after reading it back.
+//
+// Schema registration is accepted but not enforced: the context only ever
+// holds values written by the host's standard observers.
+//
+// Thread-safety: none. One instance per thread.
+class LocalObservationContext : public IObservationContext {
+ public:
+  void set(FieldID field_id, const std::string& namespace_,
+           const std::string& key, const ObservationValue& value) override;
+  std::optional<ObservationValue> get(FieldID field_id,
+                                      const std::string& namespace_,
+                                      const std::string& key) const override;
+  bool has(FieldID field_id, const std::string& namespace_,
+           const std::string& key) const override;
+  std::vector<std::string> get_keys(
+      FieldID field_id, const std::string& namespace_) const override;
+  std::vector<std::string> get_namespaces(FieldID field_id) const override;
+  std::map<std::string, std::map<std::string, ObservationValue>>
+  get_all_observations(FieldID field_id) const override;
+  void clear() override;
+  void clear_field(FieldID field_id) override;
+  void register_schema(const std::vector<ObservationKey>& keys) override;
+  void clear_schema() override {}
+
+ private:
+  std::map<FieldID,
+           std::map<std::string, std::map<std::string, ObservationValue>>>
+      observations_;
+};
+
+}  // namespace orc
@@ -0,0 +1,80 @@
+/*
+ * File:        progressive_analysis.cpp
+ * Module:      orc-progressive-analysis (shared stage-plugin library)
+ * Purpose:     Bucket layout and scheduling helpers for the progressive
+ *              analysis engine
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "progressive_analysis.h"
+
+namespace orc {
+
+std::vector<AnalysisBucket> make_even_analysis_buckets(FrameIDRange range,
+                                                       uint64_t max_buckets) {
+  std::vector<AnalysisBucket> buckets;
+  const uint64_t total_frames = range.count();
+  if (total_frames == 0 || max_buckets == 0) return buckets;
+
+  const uint64_t bucket_count = std::min(total_frames, max_buckets);
+  buckets.reserve(static_cast<size_t>(bucket_count));
+  for (uint64_t b = 0; b < bucket_count; ++b) {
+    AnalysisBucket bucket;
+    bucket.first = range.first + (b * total_frames) / bucket_count;
+    bucket.last = range.first + ((b + 1) * total_frames) / bucket_count - 1;
+    buckets.push_back(bucket);
+  }
+  return buckets;
+}
+
+std::vector<AnalysisBucket> make_fixed_width_analysis_buckets(
+    FrameIDRange range, uint64_t target_buckets) {
+  std::vector<AnalysisBucket> buckets;
+  const uint64_t total_frames = range.count();
+  if (total_frames == 0 || target_buckets == 0) return buckets;
+
+  const uint64_t frames_per_bucket = std::max<uint64_t>(
+      1, (total_frames + target_buckets - 1) / target_buckets);
+  for (FrameID first = range.first; first <= range.last;
+       first += frames_per_bucket) {
+    AnalysisBucket bucket;
+    bucket.first = first;
+    bucket.last = std::min<FrameID>(first + frames_per_bucket - 1, range.last);
+    buckets.push_back(bucket);
+  }
+  return buckets;
+}
+
+std::vector<size_t> progressive_bucket_order(size_t count) {
+  std::vector<size_t> order;
+  if (count == 0) return order;
+  order.reserve(count);
+
+  size_t step = 1;
+  while (step * 2 <= count) step *= 2;
+
+  std::vector<bool> queued(count, false);
+  for (; step > 0; step /= 2) {
+    for (size_t i = 0; i < count; i += step) {
+      if (!queued[i]) {
+        queued[i] = true;
+        order.push_back(i);
+      }
+    }
+  }
+  return order;
+}
+
+size_t resolve_analysis_worker_count(size_t requested, size_t work_items) {
+  size_t workers = requested;
+  if (workers == 0) {
+    workers = std::thread::hardware_concurrency();
+    if (workers == 0) workers = 4;  // Fallback
+  }
+  workers = std::min(workers, work_items);
+  return std::max<size_t>(workers, 1);
+}
+
+}  // namespace orc
@@ -0,0 +1,320 @@
+/*
+ * File:        progressive_analysis.h
+ * Module:      orc-progressive-analysis (shared stage-plugin library)
+ * Purpose:     Coarse-then-refined, multi-threaded bucketed analysis engine
+ *              for the whole-recording analysis sinks
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <orc/stage/frame_id.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace orc {
+
+// One display point of a whole-recording analysis graph: an inclusive range of
+// frames whose per-frame measurements are merged into a single value.
+struct AnalysisBucket {
+  FrameID first = 0;
+  FrameID last = 0;  // inclusive
+
+  uint64_t size() const { return last - first + 1; }
+};
+
+// Divide |range| into min(count, max_buckets) buckets whose boundaries are
+// b * count / bucket_count, so no frame is missed or counted twice and bucket
+// sizes differ by at most one frame. Used by the burst-level and SNR sinks.
+std::vector<AnalysisBucket> make_even_analysis_buckets(FrameIDRange range,
+                                                       uint64_t max_buckets);
+
+// Divide |range| into consecutive buckets of ceil(count / target_buckets)
+// frames; the final bucket holds the remainder. Used by the dropout sink.
+std::vector<AnalysisBucket> make_fixed_width_analysis_buckets(
+    FrameIDRange range, uint64_t target_buckets);
+
+// Coarse-to-fine visiting order over |count| buckets: every 2^k-th bucket
+// first, then the midpoints between them, and so on. Refining buckets in this
+// order makes a partially refined graph uniformly sharper rather than sharp on
+// the left and coarse on the right.
+std::vector<size_t> progressive_bucket_order(size_t count);
+
+// Worker count for |work_items| items: |requested| when non-zero, otherwise
+// std::thread::hardware_concurrency() (4 if unknown), never more than the
+// number of items and never less than one.
+size_t resolve_analysis_worker_count(size_t requested, size_t work_items);
+
+enum class ProgressivePass {
+  Coarse,    // one frame per bucket analysed
+  Refining,  // some buckets cover every frame, others are still coarse
+  Complete   // every frame of every bucket analysed
+};
+
+enum class ProgressiveAnalysisStatus { Complete, Cancelled };
+
+struct ProgressiveAnalysisConfig {
+  // Worker threads (0 = hardware concurrency).
+  size_t worker_count = 0;
+  // When false only the coarse pass runs (one frame per bucket).
+  bool refine = true;
+  // Minimum interval between Refining snapshots handed to the publish
+  // callback. The Coarse and Complete snapshots are always published.
+  std::chrono::milliseconds publish_interval{500};
+};
+
+// ---------------------------------------------------------------------------
+// ProgressiveAnalysisEngine
+// ---------------------------------------------------------------------------
+// Runs a per-frame analysis over a set of buckets in two passes:
+//
+//   1. Coarse: the first frame of every bucket is analysed. As soon as every
+//      bucket has its sample the Coarse snapshot is published, giving the
+//      caller the same 1000-point overview the sinks always produced.
+//   2. Refinement: the remaining frames of each bucket are analysed and merged
+//      in, buckets claimed in progressive_bucket_order(). Refining snapshots
+//      are published at most once per publish_interval, and the Complete
+//      snapshot once every frame has been covered.
+//
+// Both passes run on a pool of worker threads. Each worker calls the visitor
+// factory once, on its own thread, so the visitor it gets back can own
+// per-thread state (observer handles, an observation context, scratch
+// buffers) without locking. A worker accumulates a whole bucket locally and
+// merges it into the shared result under a single mutex.
+//
+// Accumulator requirements: default-constructible, copyable, and
+//   void merge(const Accumulator& other);
+// merge() must be associative and commutative: coarse and refinement
+// contributions for a bucket can arrive in either order.
+//
+// Publish and progress callbacks are always invoked on the thread that called
+// run(), never on a worker, so callers need no synchronisation of their own.
+// A visitor that throws aborts the run; the first exception is rethrown from
+// run() after all workers have stopped.
+template <typename Accumulator>
+class ProgressiveAnalysisEngine {
+ public:
+  using FrameVisitor = std::function<void(FrameID, Accumulator&)>;
+  using VisitorFactory = std::function<FrameVisitor()>;
+  using PublishFn =
+      std::function<void(const std::vector<Accumulator>&, ProgressivePass)>;
+  using ProgressFn = std::function<void(size_t current, size_t total,
+                                        const std::string& message)>;
+
+  ProgressiveAnalysisEngine(std::vector<AnalysisBucket> buckets,
+                            ProgressiveAnalysisConfig config)
+      : buckets_(std::move(buckets)), config_(config) {}
+
+  const std::vector<AnalysisBucket>& buckets() const { return buckets_; }
+
+  ProgressiveAnalysisStatus run(const VisitorFactory& make_visitor,
+                                const PublishFn& publish,
+                                const ProgressFn& progress,
+                                const std::atomic<bool>* cancel_requested) {
+    const size_t bucket_count = buckets_.size();
+    accumulators_.assign(bucket_count, Accumulator{});
+    if (bucket_count == 0) {
+      if (publish) publish(accumulators_, ProgressivePass::Complete);
+      return ProgressiveAnalysisStatus::Complete;
+    }
+
+    size_t total_frames = 0;
+    for (const auto& bucket : buckets_) total_frames += bucket.size();
+
+    refine_order_.clear();
+    if (config_.refine) {
+      for (size_t b : progressive_bucket_order(bucket_count)) {
+        if (buckets_[b].size() > 1) refine_order_.push_back(b);
+      }
+    }
+
+    next_coarse_.store(0);
+    next_refine_.store(0);
+    frames_done_ = 0;
+    coarse_done_ = 0;
+    refined_done_ = 0;
+    stop_.store(false);
+    worker_error_ = nullptr;
+
+    const size_t worker_count = resolve_analysis_worker_count(
+        config_.worker_count, std::max(bucket_count, refine_order_.size()));
+
+    std::vector<std::thread> workers;
+    workers.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+      workers.emplace_back(
+          [this, &make_visitor] { worker_loop(make_visitor); });
+    }
+
+    bool cancelled = false;
+    try {
+      cancelled = coordinate(publish, progress, cancel_requested, total_frames);
+    } catch (...) {
+      // A throwing callback must not leave joinable workers behind.
+      stop_.store(true);
+      for (auto& worker : workers) worker.join();
+      throw;
+    }
+
+    for (auto& worker : workers) worker.join();
+
+    if (worker_error_) std::rethrow_exception(worker_error_);
+    if (cancelled) return ProgressiveAnalysisStatus::Cancelled;
+
+    if (publish) publish(accumulators_, ProgressivePass::Complete);
+    return ProgressiveAnalysisStatus::Complete;
+  }
+
+  // Merged result of the last run(); complete unless the run was cancelled.
+  const std::vector<Accumulator>& accumulators() const { return accumulators_; }
+
+ private:
+  // Runs on the caller's thread until every work item has been committed, the
+  // caller cancels, or a worker fails; publishes snapshots and reports
+  // progress along the way. Returns true when cancelled.
+  bool coordinate(const PublishFn& publish, const ProgressFn& progress,
+                  const std::atomic<bool>* cancel_requested,
+                  size_t total_frames) {
+    const size_t bucket_count = buckets_.size();
+    bool coarse_published = false;
+    size_t last_published_refined = 0;
+    auto last_publish_time = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      state_changed_.wait_for(lock, std::chrono::milliseconds(50));
+
+      if (cancel_requested && cancel_requested->load()) {
+        stop_.store(true);
+        return true;
+      }
+      if (worker_error_) {
+        stop_.store(true);
+        return false;
+      }
+
+      const bool all_done = coarse_done_ == bucket_count &&
+                            refined_done_ == refine_order_.size();
+      const size_t frames_done = frames_done_;
+      const size_t coarse_done = coarse_done_;
+
+      std::vector<Accumulator> snapshot;
+      ProgressivePass pass = ProgressivePass::Coarse;
+      bool do_publish = false;
+      if (all_done) {
+        // The Complete snapshot is published by run() after the join.
+      } else if (!coarse_published && coarse_done == bucket_count) {
+        coarse_published = true;
+        last_publish_time = std::chrono::steady_clock::now();
+        snapshot = accumulators_;
+        do_publish = true;
+      } else if (coarse_published && refined_done_ != last_published_refined &&
+                 std::chrono::steady_clock::now() - last_publish_time >=
+                     config_.publish_interval) {
+        last_published_refined = refined_done_;
+        last_publish_time = std::chrono::steady_clock::now();
+        snapshot = accumulators_;
+        pass = ProgressivePass::Refining;
+        do_publish = true;
+      }
+
+      lock.unlock();
+      if (do_publish && publish) publish(snapshot, pass);
+      if (progress) {
+        const std::string message =
+            coarse_published
+                ? "Refining: " + std::to_string(frames_done) + "/" +
+                      std::to_string(total_frames) + " frames"
+                : "Coarse pass: " + std::to_string(coarse_done) + "/" +
+                      std::to_string(bucket_count) + " buckets";
+        progress(frames_done, total_frames, message);
+      }
+      if (all_done) return false;
+      lock.lock();
+    }
+  }
+
+  void worker_loop(const VisitorFactory& make_visitor) {
+    try {
+      FrameVisitor visit = make_visitor();
+
+      // Coarse pass: the first frame of each bucket.
+      while (!stop_.load()) {
+        const size_t b = next_coarse_.fetch_add(1);
+        if (b >= buckets_.size()) break;
+        Accumulator local{};
+        visit(buckets_[b].first, local);
+        commit(b, local, 1, true);
+      }
+
+      // Refinement: every other frame of each bucket, a bucket at a time.
+      while (!stop_.load()) {
+        const size_t i = next_refine_.fetch_add(1);
+        if (i >= refine_order_.size()) break;
+        const size_t b = refine_order_[i];
+        const AnalysisBucket& bucket = buckets_[b];
+        Accumulator local{};
+        size_t visited = 0;
+        for (FrameID fid = bucket.first + 1; fid <= bucket.last; ++fid) {
+          if (stop_.load()) return;
+          visit(fid, local);
+          ++visited;
+        }
+        commit(b, local, visited, false);
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> guard(mutex_);
+      if (!worker_error_) worker_error_ = std::current_exception();
+      stop_.store(true);
+      state_changed_.notify_all();
+    }
+  }
+
+  void commit(size_t bucket, const Accumulator& local, size_t frames,
+              bool coarse) {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      accumulators_[bucket].merge(local);
+      frames_done_ += frames;
+      if (coarse) {
+        ++coarse_done_;
+      } else {
+        ++refined_done_;
+      }
+    }
+    state_changed_.notify_all();
+  }
+
+  std::vector<AnalysisBucket> buckets_;
+  ProgressiveAnalysisConfig config_;
+  std::vector<size_t> refine_order_;
+
+  std::atomic<size_t> next_coarse_{0};
+  std::atomic<size_t> next_refine_{0};
+  std::atomic<bool> stop_{false};
+
+  // Guarded by mutex_.
+  std::mutex mutex_;
+  std::condition_variable state_changed_;
+  std::vector<Accumulator> accumulators_;
+  size_t frames_done_ = 0;
+  size_t coarse_done_ = 0;
+  size_t refined_done_ = 0;
+  std::exception_ptr worker_error_;
+};
+
+}  // namespace orc
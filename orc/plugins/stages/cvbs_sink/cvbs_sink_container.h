@@ -112,20 +112,29 @@ inline std::vector<uint8_t> make_cvbs_audio_wav_header(uint32_t data_bytes) {
   return header;
 }
 
-// Pack pipeline audio (24-bit-in-int32 carrier) into the container's 24-bit
-// signed LE payload: exactly |expected_values| samples (2 × stereo pairs),
-// zero-padded when the input is short, truncated when long, saturated to the
-// 24-bit range (−8388608 … 8388607) defensively.
-inline std::vector<uint8_t> pack_audio_s24le(const std::vector<int32_t>& audio,
-                                             size_t expected_values) {
-  std::vector<uint8_t> bytes(expected_values * 3, 0);
-  const size_t copy_values = std::min(audio.size(), expected_values);
-  for (size_t i = 0; i < copy_values; ++i) {
+// Pack |values| samples of pipeline audio (24-bit-in-int32 carrier) into the
+// container's 24-bit signed LE payload in |bytes|, reusing its capacity, and
+// saturated to the 24-bit range (−8388608 … 8388607) defensively.
+inline void pack_audio_s24le(const int32_t* audio, size_t values,
+                             std::vector<uint8_t>& bytes) {
+  bytes.resize(values * 3);
+  for (size_t i = 0; i < values; ++i) {
     const int32_t v = std::clamp(audio[i], -8388608, 8388607);
     bytes[i * 3] = static_cast<uint8_t>(v & 0xFF);
     bytes[i * 3 + 1] = static_cast<uint8_t>((v >> 8) & 0xFF);
     bytes[i * 3 + 2] = static_cast<uint8_t>((v >> 16) & 0xFF);
   }
+}
+
+// As above for one frame's samples: exactly |expected_values| samples
+// (2 × stereo pairs), zero-padded when the input is short, truncated when
+// long.
+inline std::vector<uint8_t> pack_audio_s24le(const std::vector<int32_t>& audio,
+                                             size_t expected_values) {
+  std::vector<uint8_t> bytes;
+  pack_audio_s24le(audio.data(), std::min(audio.size(), expected_values),
+                   bytes);
+  bytes.resize(expected_values * 3, 0);
   return bytes;
 }
 
@@ -500,6 +500,8 @@ CVBSSinkWriteResult CVBSSinkStageDeps::write_cvbs(
   // --- Frame loop ---
   std::vector<DropoutRow> dropout_rows;
   std::vector<uint16_t> encode_buffer;
+  std::vector<int32_t> audio_buffer;
+  std::vector<uint8_t> audio_bytes;
   uint64_t frames_written = 0;
 
   // Encode one flat frame plane and append it to the stream.
@@ -560,17 +562,18 @@ CVBSSinkWriteResult CVBSSinkStageDeps::write_cvbs(
                                         run.sample_count, run.severity});
     }
 
+    // Each pair file gets exactly audio_pairs_in_frame(fid) stereo pairs;
+    // read_audio() silence-fills whatever the producer cannot serve, so all
+    // pair files stay frame-aligned and equal-length by construction.
+    const size_t frame_pairs = audio_pairs_in_frame(fid, system);
+    audio_buffer.resize(frame_pairs * 2);
     for (AudioChannelPairOutput& pair_out : pair_outputs) {
-      // The producer serves exactly audio_pairs_in_frame(fid) stereo pairs;
-      // frames without audio get cadence-sized silence so all pair files
-      // stay frame-aligned and equal-length by construction.
-      const auto audio = representation->get_audio_samples(pair_out.pair, fid);
-      const size_t expected_values =
-          static_cast<size_t>(audio_pairs_in_frame(fid, system)) * 2;
-      const auto bytes = pack_audio_s24le(audio, expected_values);
-      pair_out.out.write(reinterpret_cast<const char*>(bytes.data()),
-                         static_cast<std::streamsize>(bytes.size()));
-      pair_out.data_bytes += static_cast<uint32_t>(bytes.size());
+      representation->read_audio(pair_out.pair, audio_pair_offset(fid, system),
+                                 frame_pairs, audio_buffer.data());
+      pack_audio_s24le(audio_buffer.data(), audio_buffer.size(), audio_bytes);
+      pair_out.out.write(reinterpret_cast<const char*>(audio_bytes.data()),
+                         static_cast<std::streamsize>(audio_bytes.size()));
+      pair_out.data_bytes += static_cast<uint32_t>(audio_bytes.size());
     }
 
     if (write_efm) {
@@ -0,0 +1,172 @@
+/*
+ * File:        cvbs_file_reader.cpp
+ * Module:      orc-stage-plugin-cvbs-source
+ * Purpose:     Persistent-descriptor CVBS sample file reader
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "cvbs_file_reader.h"
+
+#include <algorithm>
+#include <limits>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <share.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <mutex>
+#ifndef _SSIZE_T_DEFINED
+using ssize_t = intptr_t;
+#define _SSIZE_T_DEFINED
+#endif
+// Windows has no pread: emulate it with lseek + read under a mutex (see
+// tbc_reader.cpp).
+namespace {
+std::mutex windows_pread_mutex;
+ssize_t pread(int fd, void* buf, size_t count, __int64 offset) {
+  std::lock_guard<std::mutex> lock(windows_pread_mutex);
+  if (_lseeki64(fd, offset, SEEK_SET) == -1) {
+    return -1;
+  }
+  return _read(fd, buf, static_cast<unsigned int>(count));
+}
+}  // namespace
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+namespace orc {
+
+CVBSFileReader::~CVBSFileReader() { close(); }
+
+bool CVBSFileReader::open(const std::string& filename,
+                          std::string& error_message) {
+  close();
+
+#ifdef _WIN32
+  if (_sopen_s(&fd_, filename.c_str(), _O_RDONLY | _O_BINARY, _SH_DENYNO, 0) !=
+      0) {
+    fd_ = -1;
+  }
+#else
+  fd_ = ::open(filename.c_str(), O_RDONLY);
+#endif
+  if (fd_ < 0) {
+    error_message = "Failed to open '" + filename + "'";
+    return false;
+  }
+
+#ifdef _WIN32
+  struct _stat64 st;
+  const bool stat_ok = _fstat64(fd_, &st) == 0;
+#else
+  struct stat st;
+  const bool stat_ok = fstat(fd_, &st) == 0;
+#endif
+  if (!stat_ok) {
+    close();
+    error_message = "Failed to stat '" + filename + "'";
+    return false;
+  }
+
+  filename_ = filename;
+  file_bytes_ = st.st_size > 0 ? static_cast<uint64_t>(st.st_size) : 0;
+  next_sequential_offset_.store(0, std::memory_order_relaxed);
+  return true;
+}
+
+void CVBSFileReader::close() {
+  if (fd_ >= 0) {
+#ifdef _WIN32
+    _close(fd_);
+#else
+    ::close(fd_);
+#endif
+    fd_ = -1;
+  }
+  file_bytes_ = 0;
+}
+
+int64_t CVBSFileReader::read_words(size_t word_offset, size_t word_count,
+                                   uint16_t* out,
+                                   std::string& error_message) const {
+  if (fd_ < 0) {
+    error_message = "CVBS file not open";
+    return -1;
+  }
+
+  const uint64_t byte_offset = static_cast<uint64_t>(word_offset) * 2;
+  if (byte_offset >= file_bytes_) return 0;
+  const uint64_t byte_count = std::min<uint64_t>(
+      static_cast<uint64_t>(word_count) * 2, file_bytes_ - byte_offset);
+#ifndef _WIN32
+  if (byte_offset + byte_count >
+      static_cast<uint64_t>(std::numeric_limits<off_t>::max())) {
+    error_message = "Read offset exceeds platform file offset range in '" +
+                    filename_ + "'";
+    return -1;
+  }
+#endif
+
+  // Sequential access: prefetch what the next reads will want. The exchange
+  // keeps one thread's read-ahead request per position when several threads
+  // read at once.
+  const uint64_t end = byte_offset + byte_count;
+  if (next_sequential_offset_.exchange(end, std::memory_order_relaxed) ==
+          byte_offset &&
+      end < file_bytes_) {
+    read_ahead(end, std::min<uint64_t>(byte_count * kReadAheadReads,
+                                       file_bytes_ - end));
+  }
+
+  // pread may return short counts (signals, very large requests); loop until
+  // the range is read or the file ends.
+  char* dest = reinterpret_cast<char*>(out);
+  uint64_t done = 0;
+  while (done < byte_count) {
+#ifdef _WIN32
+    const ssize_t got =
+        pread(fd_, dest + done, static_cast<size_t>(byte_count - done),
+              static_cast<__int64>(byte_offset + done));
+#else
+    const ssize_t got =
+        pread(fd_, dest + done, static_cast<size_t>(byte_count - done),
+              static_cast<off_t>(byte_offset + done));
+#endif
+    if (got < 0) {
+      error_message = "Read failed from '" + filename_ + "'";
+      return -1;
+    }
+    if (got == 0) break;
+    done += static_cast<uint64_t>(got);
+  }
+  return static_cast<int64_t>(done / 2);
+}
+
+void CVBSFileReader::read_ahead(uint64_t byte_offset,
+                                uint64_t byte_count) const {
+#if defined(POSIX_FADV_WILLNEED)
+  posix_fadvise(fd_, static_cast<off_t>(byte_offset),
+                static_cast<off_t>(byte_count), POSIX_FADV_WILLNEED);
+#elif defined(F_RDADVISE)
+  struct radvisory advice;
+  advice.ra_offset = static_cast<off_t>(byte_offset);
+  advice.ra_count = static_cast<int>(
+      std::min<uint64_t>(byte_count, std::numeric_limits<int>::max()));
+  fcntl(fd_, F_RDADVISE, &advice);
+#else
+  // No read-ahead hint on this platform; the OS's own heuristics apply.
+  (void)byte_offset;
+  (void)byte_count;
+#endif
+}
+
+}  // namespace orc
@@ -0,0 +1,67 @@
+/*
+ * File:        cvbs_file_reader.h
+ * Module:      orc-stage-plugin-cvbs-source
+ * Purpose:     Persistent-descriptor CVBS sample file reader
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace orc {
+
+/**
+ * @brief Reader for the 16-bit word payload of a .composite/.y/.c CVBS file
+ *
+ * The file stays open for the reader's lifetime and every read is a single
+ * positioned read (pread) straight into the caller's buffer, so concurrent
+ * readers share one descriptor without seeking or locking (as TBCReader).
+ *
+ * Read-ahead: when a read starts where the previous one ended the access is
+ * treated as sequential (an export walking the frames in order) and the OS is
+ * asked to start fetching the next kReadAheadReads reads' worth of the file,
+ * so the following frames are already in the page cache when requested.
+ */
+class CVBSFileReader {
+ public:
+  // Number of reads of the current size to prefetch on sequential access.
+  static constexpr size_t kReadAheadReads = 4;
+
+  CVBSFileReader() = default;
+  ~CVBSFileReader();
+
+  CVBSFileReader(const CVBSFileReader&) = delete;
+  CVBSFileReader& operator=(const CVBSFileReader&) = delete;
+
+  // Open |filename| for reading. On failure returns false and sets
+  // |error_message|.
+  bool open(const std::string& filename, std::string& error_message);
+  void close();
+
+  bool is_open() const { return fd_ >= 0; }
+  const std::string& filename() const { return filename_; }
+
+  // Read up to |word_count| 16-bit words starting at |word_offset| into
+  // |out|. Returns the number of words read (fewer at end of file), or -1 on
+  // an I/O error with |error_message| set. Safe to call concurrently.
+  int64_t read_words(size_t word_offset, size_t word_count, uint16_t* out,
+                     std::string& error_message) const;
+
+ private:
+  void read_ahead(uint64_t byte_offset, uint64_t byte_count) const;
+
+  int fd_ = -1;
+  std::string filename_;
+  uint64_t file_bytes_ = 0;
+
+  // Byte offset just past the most recent read, for sequential detection.
+  mutable std::atomic<uint64_t> next_sequential_offset_{0};
+};
+
+}  // namespace orc
@@ -9,9 +9,13 @@
 
 #include "cvbs_source_stage.h"
 
+#include <orc/abi/orc_plugin_services.h>
 #include <orc/stage/audio/audio_channel_pair.h>
 #include <orc/stage/cvbs_signal_constants.h>
 #include <orc/stage/error_types.h>
+#include <orc/stage/frame_buffer_pool.h>
+#include <orc/stage/metrics.h>
+#include <orc/stage/trace.h>
 #include <orc/support/frame_line_util.h>
 #include <orc/support/logging.h>
 #include <orc/support/lru_cache.h>
@@ -24,6 +28,7 @@
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -31,6 +36,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "cvbs_file_reader.h"
+
 namespace orc {
 
 namespace {
@@ -90,33 +97,38 @@ constexpr uint64_t kAudioBytesPerPair = 6;
 // Sample encoding normalisation
 // ---------------------------------------------------------------------------
 
-// CVBS file format spec §3.1: normalise a raw 16-bit word from any of the
+// CVBS file format spec §3.1: normalise raw 16-bit words from any of the
 // four declared sample encodings to the CVBS_U10_4FSC domain (int16_t).
 // No output clamping — headroom values outside [0, 1023] are preserved.
-inline int16_t normalize_to_cvbs_u10(uint16_t raw, const std::string& encoding,
-                                     int32_t blanking_10bit) {
+// The encoding is chosen once per call rather than per sample.  out may
+// alias raw: frames are read into their own sample buffer and normalised in
+// place.
+void normalize_to_cvbs_u10(const uint16_t* raw, int16_t* out, size_t count,
+                           const std::string& encoding,
+                           int32_t blanking_10bit) {
   if (encoding == "CVBS_U10_4FSC") {
     // CVBS file format spec §3.1: int16_t stored bitwise as uint16_t.
-    return static_cast<int16_t>(raw);
-  }
-  if (encoding == "CVBS_U16_4FSC") {
-    // CVBS file format spec §3.1: unsigned value = 10-bit × 64.
-    return static_cast<int16_t>(static_cast<int32_t>(raw) / 64);
-  }
-  if (encoding == "CVBS_TPG21_4FSC") {
+    for (size_t i = 0; i < count; ++i) out[i] = static_cast<int16_t>(raw[i]);
+  } else if (encoding == "CVBS_TPG21_4FSC") {
     // CVBS file format spec §3.1: signed, device offset 508, ×64 scale.
-    const int32_t decoded =
-        static_cast<int32_t>(static_cast<int16_t>(raw)) / 64 + 508;
-    return static_cast<int16_t>(decoded);
-  }
-  if (encoding == "CVBS_S16_4FSC") {
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = static_cast<int16_t>(
+          static_cast<int32_t>(static_cast<int16_t>(raw[i])) / 64 + 508);
+    }
+  } else if (encoding == "CVBS_S16_4FSC") {
     // CVBS file format spec §3.1: signed, blanking-centred, ×32 scale.
-    const int32_t decoded =
-        static_cast<int32_t>(static_cast<int16_t>(raw)) / 32 + blanking_10bit;
-    return static_cast<int16_t>(decoded);
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = static_cast<int16_t>(
+          static_cast<int32_t>(static_cast<int16_t>(raw[i])) / 32 +
+          blanking_10bit);
+    }
+  } else {
+    // CVBS file format spec §3.1: unsigned value = 10-bit × 64
+    // (CVBS_U16_4FSC).  Unknown encodings fall back to the same.
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = static_cast<int16_t>(static_cast<int32_t>(raw[i]) / 64);
+    }
   }
-  // Fallback — treat unknown encoding as CVBS_U16_4FSC.
-  return static_cast<int16_t>(static_cast<int32_t>(raw) / 64);
 }
 
 // ---------------------------------------------------------------------------
@@ -233,7 +245,12 @@ class CVBSDecodedFrameRepresentation final : public VideoFrameRepresentation,
         has_ac3_(has_ac3),
         ac3_data_path_(std::move(ac3_data_path)),
         ac3_table_(std::move(ac3_table)),
-        c_path_(std::move(c_path)) {}
+        c_path_(std::move(c_path)) {
+    // The chroma cache is only consulted alongside this one, so it is left
+    // uncounted.
+    frame_cache_.bind_metrics(plugin::get_metrics(), "cvbs_source.frames",
+                              FrameCache::CountedLookup::kContains);
+  }
 
   // --------------------------------------------------------------------------
   // Artifact
@@ -281,8 +298,8 @@ class CVBSDecodedFrameRepresentation final : public VideoFrameRepresentation,
   const sample_type* get_frame(FrameID id) const override {
     if (!has_frame(id)) return nullptr;
     ensure_frame_cached(id);
-    const DecodedFrame* df = frame_cache_.get_ptr(id);
-    return df ? df->samples.data() : nullptr;
+    const auto* df = frame_cache_.get_ptr(id);
+    return df ? (*df)->data() : nullptr;
   }
 
   std::vector<sample_type> get_frame_copy(FrameID id) const override {
@@ -292,6 +309,21 @@ class CVBSDecodedFrameRepresentation final : public VideoFrameRepresentation,
     return std::vector<sample_type>(ptr, ptr + frame_samples_);
   }
 
+  // Shares the cached decode buffers (for YC, the Y file is also the flat
+  // frame), so no samples are copied.
+  FrameHandle acquire_frame(FrameID id) const override {
+    if (!has_frame(id)) return nullptr;
+    auto frame = std::make_shared<AcquiredFrame>();
+    frame->frame_id = id;
+    frame->samples = cached_frame(id, false);
+    if (has_separate_channels()) {
+      frame->luma = frame->samples;
+      frame->chroma = cached_frame(id, true);
+    }
+    frame->dropouts = get_dropout_hints(id);
+    return frame;
+  }
+
   // --------------------------------------------------------------------------
   // Hints
   // --------------------------------------------------------------------------
@@ -345,6 +377,33 @@ class CVBSDecodedFrameRepresentation final : public VideoFrameRepresentation,
     return samples;
   }
 
+  // One sidecar read for the part of the range inside the stream.
+  bool read_audio(size_t pair, uint64_t start_pair, size_t count,
+                  int32_t* out) const override {
+    std::fill(out, out + count * 2, 0);
+    const FrameIDRange range = frame_range();
+    if (pair >= audio_pairs_.size() || range.empty() ||
+        audio_pairs_in_frame(0, system_) == 0) {
+      return false;
+    }
+    const uint64_t end_pair = start_pair + count;
+    const uint64_t first = std::max(start_pair,
+                                    audio_pair_offset(range.first, system_));
+    const uint64_t last =
+        std::min(end_pair, audio_pair_offset(range.last + 1, system_));
+    const bool clipped = first != start_pair || last != end_pair;
+    if (first >= last) return false;
+    const CVBSAudioChannelPairState& state = audio_pairs_[pair];
+    if (state.wav_path.empty()) return !clipped;  // placeholder: silence
+    // Short sidecars leave the silence pad, as get_audio_samples() does.
+    const size_t pairs = static_cast<size_t>(last - first);
+    const auto samples =
+        deps_->read_audio_pairs_at(state.wav_path, first, pairs);
+    std::copy_n(samples.begin(), std::min(samples.size(), pairs * 2),
+                out + (first - start_pair) * 2);
+    return !clipped;
+  }
+
   // --------------------------------------------------------------------------
   // EFM
   // --------------------------------------------------------------------------
@@ -396,20 +455,18 @@ class CVBSDecodedFrameRepresentation final : public VideoFrameRepresentation,
     const size_t word_offset =
         static_cast<size_t>(id) * frame_samples_ + line_offset;
 
-    std::vector<uint16_t> raw_words;
+    std::vector<sample_type> result(line_count);
+    uint16_t* words = reinterpret_cast<uint16_t*>(result.data());
+    size_t words_read = 0;
     std::string err;
-    if (!deps_->read_input_words_at(input_path_, word_offset, line_count,
-                                    raw_words, err)) {
+    if (!deps_->read_input_words_into(input_path_, word_offset, line_count,
+                                      words, words_read, err)) {
       return {};
     }
-    if (raw_words.size() < line_count) return {};
+    if (words_read < line_count) return {};
 
-    std::vector<sample_type> result;
-    result.reserve(line_count);
-    for (const uint16_t raw : raw_words) {
-      result.push_back(
-          normalize_to_cvbs_u10(raw, sample_encoding_, blanking_level_));
-    }
+    normalize_to_cvbs_u10(words, result.data(), line_count, sample_encoding_,
+                          blanking_level_);
     return result;
   }
 
@@ -425,8 +482,8 @@ class CVBSDecodedFrameRepresentation final : public VideoFrameRepresentation,
   const sample_type* get_frame_chroma(FrameID id) const override {
     if (c_path_.empty() || !has_frame(id)) return nullptr;
     ensure_c_frame_cached(id);
-    const DecodedFrame* df = c_frame_cache_.get_ptr(id);
-    return df ? df->samples.data() : nullptr;
+    const auto* df = c_frame_cache_.get_ptr(id);
+    return df ? (*df)->data() : nullptr;
   }
 
   const sample_type* get_line_luma(FrameID id, size_t line) const override {
@@ -442,40 +499,81 @@ class CVBSDecodedFrameRepresentation final : public VideoFrameRepresentation,
   }
 
  private:
-  struct DecodedFrame {
-    std::vector<sample_type> samples;
-  };
+  // Cache entries are shared so acquire_frame() handles outlive eviction;
+  // the buffers come from the host frame buffer pool and return to it once
+  // the last reference is dropped.
+  using FrameCache = LRUCache<FrameID, SharedSampleBuffer>;
 
   void ensure_frame_cached(FrameID id) const {
     if (frame_cache_.contains(id)) return;
+    if (!c_path_.empty() && !c_frame_cache_.contains(id)) {
+      load_yc_frame(id);
+      return;
+    }
     frame_cache_.put(id, decode_channel_frame(input_path_, id));
   }
 
   void ensure_c_frame_cached(FrameID id) const {
     if (c_frame_cache_.contains(id)) return;
+    if (!frame_cache_.contains(id)) {
+      load_yc_frame(id);
+      return;
+    }
     c_frame_cache_.put(id, decode_channel_frame(c_path_, id));
   }
 
-  DecodedFrame decode_channel_frame(const std::string& path, FrameID id) const {
+  // YC consumers want both channels of a frame, from two separate files, so
+  // read them concurrently: chroma on a worker while this thread reads luma.
+  void load_yc_frame(FrameID id) const {
+    auto chroma = std::async(std::launch::async, [this, id] {
+      return decode_channel_frame(c_path_, id);
+    });
+    SharedSampleBuffer luma = decode_channel_frame(input_path_, id);
+    c_frame_cache_.put(id, chroma.get());
+    frame_cache_.put(id, std::move(luma));
+  }
+
+  // Shared reference to the cached Y/composite (or, with |chroma|, C) decode
+  // of frame |id|. Falls back to a private decode if concurrent readers
+  // evicted the entry in between.
+  SharedSampleBuffer cached_frame(FrameID id, bool chroma) const {
+    if (chroma) {
+      ensure_c_frame_cached(id);
+    } else {
+      ensure_frame_cached(id);
+    }
+    auto cached = (chroma ? c_frame_cache_ : frame_cache_).get(id);
+    if (cached) return *cached;
+    return decode_channel_frame(chroma ? c_path_ : input_path_, id);
+  }
+
+  // The file's words are read straight into the frame's sample buffer and
+  // normalised in place, so the buffer that lands in the cache is the only
+  // copy of the frame.
+  SharedSampleBuffer decode_channel_frame(const std::string& path,
+                                          FrameID id) const {
+    static_assert(sizeof(sample_type) == sizeof(uint16_t),
+                  "CVBS words are decoded in place");
+    ORC_TRACE_FRAME_SCOPE(plugin::get_tracer(), "source", "cvbs_read_frame",
+                          "cvbs_source", id);
     const size_t word_offset = static_cast<size_t>(id) * frame_samples_;
-    std::vector<uint16_t> raw_words;
+    auto result =
+        acquire_sample_buffer(plugin::get_frame_buffer_pool(), frame_samples_);
+    uint16_t* words = reinterpret_cast<uint16_t*>(result->data());
+    size_t words_read = 0;
     std::string err;
-    if (!deps_->read_input_words_at(path, word_offset, frame_samples_,
-                                    raw_words, err)) {
+    if (!deps_->read_input_words_into(path, word_offset, frame_samples_, words,
+                                      words_read, err)) {
       throw std::runtime_error("CVBS: failed to read frame " +
                                std::to_string(id) + " from '" + path +
                                "': " + err);
     }
-    if (raw_words.size() < frame_samples_) {
+    if (words_read < frame_samples_) {
       throw std::runtime_error("CVBS: short read at frame " +
                                std::to_string(id) + " in '" + path + "'");
     }
-    DecodedFrame result;
-    result.samples.reserve(frame_samples_);
-    for (size_t i = 0; i < frame_samples_; ++i) {
-      result.samples.push_back(normalize_to_cvbs_u10(
-          raw_words[i], sample_encoding_, blanking_level_));
-    }
+    normalize_to_cvbs_u10(words, result->data(), frame_samples_,
+                          sample_encoding_, blanking_level_);
     return result;
   }
 
@@ -493,7 +591,7 @@ class CVBSDecodedFrameRepresentation final : public VideoFrameRepresentation,
   int32_t blanking_level_;
 
   static constexpr size_t kFrameCacheSize = 150;
-  mutable LRUCache<FrameID, DecodedFrame> frame_cache_{kFrameCacheSize};
+  mutable FrameCache frame_cache_{kFrameCacheSize};
 
   std::vector<DropoutRun> dropout_runs_;
 
@@ -508,7 +606,7 @@ class CVBSDecodedFrameRepresentation final : public VideoFrameRepresentation,
   std::vector<CVBSExtensionFrameRef> ac3_table_;
 
   std::string c_path_;
-  mutable LRUCache<FrameID, DecodedFrame> c_frame_cache_{kFrameCacheSize};
+  mutable FrameCache c_frame_cache_{kFrameCacheSize};
 };
 
 // ---------------------------------------------------------------------------
@@ -517,8 +615,23 @@ class CVBSDecodedFrameRepresentation final : public VideoFrameRepresentation,
 
 class CVBSSourceStageDeps final : public ICVBSSourceStageDeps {
  public:
+  CVBSSourceStageDeps() {
+    if (IMetricsRegistry* metrics = plugin::get_metrics()) {
+      bytes_read_ = metrics->counter("orc_source_read_bytes_total",
+                                     "Sample bytes read from source files",
+                                     "source=cvbs_source");
+    }
+  }
+
   bool validate_input_file(const std::string& input_path,
                            std::string& error_message) const override {
+    // The stage validates before (re)loading a source: drop any reader still
+    // open on this path so a file replaced on disk is read afresh.
+    {
+      std::lock_guard<std::mutex> lock(readers_mutex_);
+      readers_.erase(input_path);
+    }
+
     namespace fs = std::filesystem;
     std::error_code ec;
     if (!fs::exists(input_path, ec)) {
@@ -629,28 +742,31 @@ class CVBSSourceStageDeps final : public ICVBSSourceStageDeps {
   bool read_input_words_at(const std::string& input_path, size_t word_offset,
                            size_t word_count, std::vector<uint16_t>& out_words,
                            std::string& error_message) const override {
-    std::ifstream ifs(input_path, std::ios::binary);
-    if (!ifs.is_open()) {
-      error_message = "Failed to open '" + input_path + "'";
-      return false;
-    }
-    ifs.seekg(static_cast<std::streamoff>(word_offset) * 2, std::ios::beg);
-    if (!ifs.good()) {
-      error_message = "Seek failed in '" + input_path + "'";
-      return false;
-    }
     out_words.resize(word_count);
-    ifs.read(reinterpret_cast<char*>(out_words.data()),
-             static_cast<std::streamsize>(word_count * 2));
-    if (!ifs.good() && !ifs.eof()) {
-      error_message = "Read failed from '" + input_path + "'";
+    size_t words_read = 0;
+    if (!read_input_words_into(input_path, word_offset, word_count,
+                               out_words.data(), words_read, error_message)) {
       return false;
     }
-    const size_t words_read = static_cast<size_t>(ifs.gcount()) / 2;
     if (words_read < word_count) out_words.resize(words_read);
     return true;
   }
 
+  bool read_input_words_into(const std::string& input_path,
+                             size_t word_offset, size_t word_count,
+                             uint16_t* out, size_t& words_read,
+                             std::string& error_message) const override {
+    const std::shared_ptr<CVBSFileReader> reader =
+        get_reader(input_path, error_message);
+    if (!reader) return false;
+    const int64_t got =
+        reader->read_words(word_offset, word_count, out, error_message);
+    if (got < 0) return false;
+    words_read = static_cast<size_t>(got);
+    if (bytes_read_) bytes_read_->add(words_read * sizeof(uint16_t));
+    return true;
+  }
+
   std::vector<DropoutRun> load_dropout_sidecar(
       const std::string& dropout_meta_path,
       std::string& error_message) const override {
@@ -878,6 +994,27 @@ class CVBSSourceStageDeps final : public ICVBSSourceStageDeps {
     return table;
   }
 
+  // One persistent reader per sample file (composite, or Y and C), opened on
+  // first use: frame reads then cost a pread rather than an open, seek, read
+  // and close each.  Shared so a read in progress keeps its reader alive if
+  // validate_input_file() drops it meanwhile.
+  std::shared_ptr<CVBSFileReader> get_reader(const std::string& path,
+                                             std::string& error_message) const {
+    std::lock_guard<std::mutex> lock(readers_mutex_);
+    auto it = readers_.find(path);
+    if (it != readers_.end()) return it->second;
+    auto reader = std::make_shared<CVBSFileReader>();
+    if (!reader->open(path, error_message)) return nullptr;
+    readers_.emplace(path, reader);
+    return reader;
+  }
+
+  mutable std::mutex readers_mutex_;
+  mutable std::unordered_map<std::string, std::shared_ptr<CVBSFileReader>>
+      readers_;
+
+  IMetricCounter* bytes_read_ = nullptr;  // host-owned; null without a host
+
   std::vector<uint8_t> read_binary_at(const std::string& path,
                                       uint64_t byte_offset,
                                       uint32_t count) const {
@@ -947,6 +1084,19 @@ const char* system_name(VideoSystem sys) {
 
 }  // namespace
 
+bool ICVBSSourceStageDeps::read_input_words_into(
+    const std::string& input_path, size_t word_offset, size_t word_count,
+    uint16_t* out, size_t& words_read, std::string& error_message) const {
+  std::vector<uint16_t> words;
+  if (!read_input_words_at(input_path, word_offset, word_count, words,
+                           error_message)) {
+    return false;
+  }
+  words_read = std::min(words.size(), word_count);
+  std::memcpy(out, words.data(), words_read * sizeof(uint16_t));
+  return true;
+}
+
 // ---------------------------------------------------------------------------
 // FixedFormatCVBSSourceStage
 // ---------------------------------------------------------------------------
@@ -86,6 +86,15 @@ class ICVBSSourceStageDeps {
                                    std::vector<uint16_t>& out_words,
                                    std::string& error_message) const = 0;
 
+  // Read up to word_count 16-bit words starting at word_offset straight into
+  // out (which must have room for word_count words), setting words_read
+  // (fewer at end of file).  Frame decode uses this to fill its cache buffer
+  // without an intermediate copy; the default forwards to read_input_words_at.
+  virtual bool read_input_words_into(const std::string& input_path,
+                                     size_t word_offset, size_t word_count,
+                                     uint16_t* out, size_t& words_read,
+                                     std::string& error_message) const;
+
   // Load all DropoutRun rows from <basename>.dropouts.meta.
   // Returns an empty vector (no error) when the file is absent.
   virtual std::vector<DropoutRun> load_dropout_sidecar(
@@ -11,11 +11,131 @@
 
 #include <algorithm>
 #include <fstream>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
+#include "progressive-analysis/progressive_analysis.h"
+
 namespace orc {
+namespace {
+// Dropout totals over the frames of one bin analysed so far.
+struct DropoutBucketAccumulator {
+  double total_dropout_length = 0.0;
+  double dropout_count = 0.0;
+  uint64_t frames = 0;  // frames analysed (with or without dropouts)
+  bool has_data = false;
+
+  void merge(const DropoutBucketAccumulator& other) {
+    total_dropout_length += other.total_dropout_length;
+    dropout_count += other.dropout_count;
+    frames += other.frames;
+    has_data = has_data || other.has_data;
+  }
+};
+
+// Add the dropouts of frame |fid| (filtered and clamped to the active area in
+// VISIBLE_AREA mode) to |accum|.
+void accum_frame_dropouts(const VideoFrameRepresentation& representation,
+                          FrameID fid, DropoutAnalysisMode mode,
+                          const std::optional<SourceParameters>& video_params,
+                          int32_t nominal_spl,
+                          DropoutBucketAccumulator& accum) {
+  ++accum.frames;
+
+  const auto desc = representation.get_frame_descriptor(fid);
+  if (!desc) return;
+
+  const auto runs = representation.get_dropout_hints(fid);
+
+  double frame_dropout_length = 0.0;
+  size_t frame_dropout_count = 0;
+
+  for (const auto& run : runs) {
+    bool include = true;
+
+    if (mode == DropoutAnalysisMode::VISIBLE_AREA) {
+      // Approximate frame-flat line of this run's start position.
+      const int32_t approx_line = static_cast<int32_t>(
+          run.sample_start / static_cast<uint64_t>(nominal_spl));
+      const int32_t approx_sample = static_cast<int32_t>(
+          run.sample_start % static_cast<uint64_t>(nominal_spl));
+
+      // Filter by active frame line range.
+      if (video_params && video_params->first_active_frame_line >= 0 &&
+          video_params->last_active_frame_line >= 0) {
+        if (approx_line < video_params->first_active_frame_line ||
+            approx_line > video_params->last_active_frame_line) {
+          include = false;
+        }
+      }
+
+      // Filter by active video sample range within line.
+      if (include && video_params && video_params->active_video_start >= 0 &&
+          video_params->active_video_end >= 0) {
+        if (approx_sample >= video_params->active_video_end ||
+            approx_sample + static_cast<int32_t>(run.sample_count) <=
+                video_params->active_video_start) {
+          include = false;
+        }
+      }
+    }
+
+    if (include) {
+      uint64_t length = run.sample_count;
+
+      // Clamp to active_video_start / active_video_end within the line.
+      if (mode == DropoutAnalysisMode::VISIBLE_AREA && video_params &&
+          video_params->active_video_start >= 0 &&
+          video_params->active_video_end >= 0) {
+        const int32_t approx_sample = static_cast<int32_t>(
+            run.sample_start % static_cast<uint64_t>(nominal_spl));
+        const int32_t clamped_start =
+            std::max(approx_sample, video_params->active_video_start);
+        const int32_t clamped_end =
+            std::min(approx_sample + static_cast<int32_t>(run.sample_count),
+                     video_params->active_video_end);
+        length =
+            static_cast<uint64_t>(std::max(0, clamped_end - clamped_start));
+      }
+
+      frame_dropout_length += static_cast<double>(length);
+      frame_dropout_count++;
+    }
+  }
+
+  accum.total_dropout_length += frame_dropout_length;
+  accum.dropout_count += static_cast<double>(frame_dropout_count);
+  if (frame_dropout_count > 0) accum.has_data = true;
+}
+
+// One FrameDropoutStats per bin, labelled with the bin's last frame number
+// (1-based). A bin not yet fully analysed reports its partial totals scaled up
+// to the bin width so coarse and refined graphs share one scale.
+std::vector<FrameDropoutStats> build_frame_stats(
+    const std::vector<AnalysisBucket>& buckets,
+    const std::vector<DropoutBucketAccumulator>& accums) {
+  std::vector<FrameDropoutStats> frame_stats;
+  frame_stats.reserve(buckets.size());
+  for (size_t b = 0; b < buckets.size(); ++b) {
+    const DropoutBucketAccumulator& accum = accums[b];
+    FrameDropoutStats bin{};
+    bin.frame_number = static_cast<int32_t>(buckets[b].last) + 1;
+    bin.total_dropout_length = accum.total_dropout_length;
+    bin.dropout_count = accum.dropout_count;
+    if (accum.frames > 0 && accum.frames < buckets[b].size()) {
+      const double scale = static_cast<double>(buckets[b].size()) /
+                           static_cast<double>(accum.frames);
+      bin.total_dropout_length *= scale;
+      bin.dropout_count *= scale;
+    }
+    bin.has_data = accum.has_data;
+    frame_stats.push_back(bin);
+  }
+  return frame_stats;
+}
+}  // namespace
 
 void DropoutAnalysisSinkStageDeps::init(
     TriggerProgressCallback progress_callback,
@@ -45,7 +165,7 @@ DropoutAnalysisComputeResult DropoutAnalysisSinkStageDeps::compute_and_analyze(
     return result;
   }
 
-  const size_t total_frames_count = static_cast<size_t>(range.count());
+  const size_t total_frames = static_cast<size_t>(range.count());
   const auto video_params = representation->get_video_parameters();
 
   // Nominal samples per line for line-position approximation in visible-area
@@ -53,134 +173,53 @@ DropoutAnalysisComputeResult DropoutAnalysisSinkStageDeps::compute_and_analyze(
   int32_t nominal_spl = 910;
   if (video_params) nominal_spl = video_params->frame_width_nominal;
 
-  // Pre-allocated contiguous vector: O(1) per-frame access, single allocation.
-  // Frames are visited in monotonically increasing order so std::map's O(log n)
-  // tree insertions and per-node heap allocations are unnecessary here.
-  std::vector<FrameDropoutStats> frame_data(total_frames_count);
-
-  for (size_t i = 0; i < total_frames_count; ++i) {
-    if (cancel_requested_ && cancel_requested_->load()) {
-      logger_.warn("DropoutAnalysisSinkDeps: Cancel requested at frame {}", i);
-      result.success = false;
-      result.message = "Cancelled by user";
-      result.frame_stats.clear();
-      result.total_frames = 0;
-      return result;
-    }
-
-    const FrameID fid = range.first + i;
-    const int32_t frame_num = static_cast<int32_t>(fid) + 1;
-
-    auto& accum = frame_data[i];
-    accum.frame_number = frame_num;
-
-    const auto desc = representation->get_frame_descriptor(fid);
-    if (!desc) continue;
-
-    const auto runs = representation->get_dropout_hints(fid);
-
-    double frame_dropout_length = 0.0;
-    size_t frame_dropout_count = 0;
-
-    for (const auto& run : runs) {
-      bool include = true;
-
-      if (options.mode == DropoutAnalysisMode::VISIBLE_AREA) {
-        // Approximate frame-flat line of this run's start position.
-        const int32_t approx_line = static_cast<int32_t>(
-            run.sample_start / static_cast<uint64_t>(nominal_spl));
-        const int32_t approx_sample = static_cast<int32_t>(
-            run.sample_start % static_cast<uint64_t>(nominal_spl));
-
-        // Filter by active frame line range.
-        if (video_params && video_params->first_active_frame_line >= 0 &&
-            video_params->last_active_frame_line >= 0) {
-          if (approx_line < video_params->first_active_frame_line ||
-              approx_line > video_params->last_active_frame_line) {
-            include = false;
-          }
-        }
-
-        // Filter by active video sample range within line.
-        if (include && video_params && video_params->active_video_start >= 0 &&
-            video_params->active_video_end >= 0) {
-          if (approx_sample >= video_params->active_video_end ||
-              approx_sample + static_cast<int32_t>(run.sample_count) <=
-                  video_params->active_video_start) {
-            include = false;
-          }
-        }
-      }
-
-      if (include) {
-        uint64_t length = run.sample_count;
-
-        // Clamp to active_video_start / active_video_end within the line.
-        if (options.mode == DropoutAnalysisMode::VISIBLE_AREA && video_params &&
-            video_params->active_video_start >= 0 &&
-            video_params->active_video_end >= 0) {
-          const int32_t approx_sample = static_cast<int32_t>(
-              run.sample_start % static_cast<uint64_t>(nominal_spl));
-          const int32_t clamped_start =
-              std::max(approx_sample, video_params->active_video_start);
-          const int32_t clamped_end =
-              std::min(approx_sample + static_cast<int32_t>(run.sample_count),
-                       video_params->active_video_end);
-          length =
-              static_cast<uint64_t>(std::max(0, clamped_end - clamped_start));
-        }
-
-        frame_dropout_length += static_cast<double>(length);
-        frame_dropout_count++;
-      }
-    }
-
-    accum.total_dropout_length += frame_dropout_length;
-    accum.dropout_count += static_cast<double>(frame_dropout_count);
-    if (frame_dropout_count > 0) accum.has_data = true;
-
-    if (progress_callback_ && (i % 100 == 0 || i + 1 == total_frames_count)) {
-      progress_callback_(i + 1, total_frames_count,
-                         "Processing frame " + std::to_string(i));
-    }
-  }
-
-  const size_t total_frames = total_frames_count;
-  result.total_frames = static_cast<int32_t>(total_frames);
-
+  // Fixed-width bins of ceil(total / 1000) frames. The coarse pass measures
+  // the first frame of each bin and extrapolates; the refinement pass then
+  // measures every remaining frame in parallel, after which the bins hold
+  // exact totals.
   const size_t TARGET_DATA_POINTS = 1000;
-  size_t frames_per_bin = std::max<size_t>(
-      1, (total_frames + TARGET_DATA_POINTS - 1) / TARGET_DATA_POINTS);
-
-  logger_.debug("DropoutAnalysisSinkDeps: {} total frames, {} frames per bin",
-                total_frames, frames_per_bin);
-
-  FrameDropoutStats current_bin{};
-  size_t frames_in_bin = 0;
-  [[maybe_unused]] int32_t bin_start_frame = 0;
-
-  for (const auto& entry : frame_data) {
-    if (frames_in_bin == 0) {
-      bin_start_frame = entry.frame_number;
-    }
-
-    current_bin.frame_number = entry.frame_number;
-    current_bin.total_dropout_length += entry.total_dropout_length;
-    current_bin.dropout_count += entry.dropout_count;
-    current_bin.has_data = current_bin.has_data || entry.has_data;
-
-    frames_in_bin++;
-
-    if (frames_in_bin >= frames_per_bin) {
-      result.frame_stats.push_back(current_bin);
-      current_bin = FrameDropoutStats{};
-      frames_in_bin = 0;
-    }
+  ProgressiveAnalysisConfig config;
+  config.refine = options.refine;
+  ProgressiveAnalysisEngine<DropoutBucketAccumulator> engine(
+      make_fixed_width_analysis_buckets(range, TARGET_DATA_POINTS), config);
+
+  logger_.debug("DropoutAnalysisSinkDeps: {} total frames, {} bins",
+                total_frames, engine.buckets().size());
+
+  // Dropout hints need no per-thread state, so every worker shares one
+  // stateless visitor.
+  const auto make_visitor = [representation, &options, &video_params,
+                             nominal_spl]() {
+    return [representation, &options, &video_params, nominal_spl](
+               FrameID fid, DropoutBucketAccumulator& accum) {
+      accum_frame_dropouts(*representation, fid, options.mode, video_params,
+                           nominal_spl, accum);
+    };
+  };
+
+  const int32_t total_frames_i32 = static_cast<int32_t>(total_frames);
+  const auto publish = [&](const std::vector<DropoutBucketAccumulator>& accums,
+                           ProgressivePass pass) {
+    if (!options.on_partial_result) return;
+    options.on_partial_result(build_frame_stats(engine.buckets(), accums),
+                              total_frames_i32,
+                              pass == ProgressivePass::Complete);
+  };
+
+  const auto status =
+      engine.run(make_visitor, publish, progress_callback_, cancel_requested_);
+  if (status == ProgressiveAnalysisStatus::Cancelled) {
+    logger_.warn("DropoutAnalysisSinkDeps: Cancel requested");
+    result.success = false;
+    result.message = "Cancelled by user";
+    result.frame_stats.clear();
+    result.total_frames = 0;
+    return result;
   }
 
-  if (frames_in_bin > 0) {
-    result.frame_stats.push_back(current_bin);
-  }
+  result.frame_stats =
+      build_frame_stats(engine.buckets(), engine.accumulators());
+  result.total_frames = total_frames_i32;
 
   logger_.debug("DropoutAnalysisSinkDeps: {} data buckets from {} total frames",
                 result.frame_stats.size(), total_frames);
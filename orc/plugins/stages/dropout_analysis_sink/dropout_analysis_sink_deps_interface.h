@@ -17,16 +17,29 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
 #include "dropout_analysis_types.h"
 
 namespace orc {
+// Receives intermediate datasets while compute_and_analyze() runs: first the
+// coarse one-frame-per-bucket estimate, then periodic snapshots as buckets are
+// refined to full-frame coverage, and finally the complete result (complete ==
+// true). Always invoked on the thread that called compute_and_analyze().
+using DropoutAnalysisPartialResultCallback =
+    std::function<void(const std::vector<FrameDropoutStats>& frame_stats,
+                       int32_t total_frames, bool complete)>;
+
 struct DropoutAnalysisComputeOptions {
   std::string output_path;
   bool write_csv{false};
   DropoutAnalysisMode mode{DropoutAnalysisMode::FULL_FIELD};
+  // Refine every bucket to full-frame coverage after the coarse pass. When
+  // false the published totals are extrapolated from one frame per bucket.
+  bool refine{true};
+  DropoutAnalysisPartialResultCallback on_partial_result;
 };
 
 struct DropoutAnalysisComputeResult {
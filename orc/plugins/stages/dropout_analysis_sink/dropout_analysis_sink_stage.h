@@ -37,7 +37,8 @@ namespace orc {
  *
  * Trigger to compute dropout statistics across input fields. Optionally writes
  * CSV. The computed dataset is cached in the stage instance and can be
- * requested by the GUI after a trigger completes.
+ * requested by the GUI after a trigger completes; a coarse estimate is
+ * available while the full-resolution refinement is still running.
  */
 class DropoutAnalysisSinkStage : public DAGStage,
                                  public ParameterizedStage,
@@ -9,14 +9,27 @@
 
 #include "dropout_correct_stage.h"
 
+#include <orc/abi/orc_plugin_services.h>
 #include <orc/stage/cvbs_signal_constants.h>
 #include <orc/stage/error_types.h>
+#include <orc/stage/frame_buffer_pool.h>
+#include <orc/stage/metrics.h>
+#include <orc/stage/trace.h>
 #include <orc/support/frame_line_util.h>
 #include <orc/support/logging.h>
 #include <orc/support/preview_helpers.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
 
 namespace orc {
 
@@ -41,6 +54,245 @@ size_t field1_lines_for_system(VideoSystem sys) {
 
 bool is_pal(VideoSystem sys) { return sys == VideoSystem::PAL; }
 
+// Below this many line-dropouts a frame is corrected on the calling thread;
+// handing bands to helpers would cost more than the search.
+constexpr size_t kMinDropoutsForParallel = 64;
+
+// Start of every line of |plane| in the source sample layout; nullptr for
+// lines the buffer does not cover.
+std::vector<const int16_t*> line_table(const SharedSampleBuffer& plane,
+                                       VideoSystem system, size_t spl,
+                                       size_t height) {
+  std::vector<const int16_t*> lines(height, nullptr);
+  if (!plane) {
+    return lines;
+  }
+  for (size_t line = 0; line < height; ++line) {
+    const size_t base = frame_line_sample_offset(system, spl, line);
+    if (base + frame_line_sample_count(system, spl, line) <= plane->size()) {
+      lines[line] = plane->data() + base;
+    }
+  }
+  return lines;
+}
+
+// Helper threads currently correcting bands, across every frame being
+// corrected in the process. Frames are usually fetched by several threads at
+// once (exports, prefetch, stacking), and each of those already occupies a
+// core; sharing one budget keeps the helpers of all frames together within
+// the configured thread count instead of multiplying it per caller.
+std::atomic<size_t> g_band_helpers_in_use{0};
+
+// Claims up to |wanted| helpers while fewer than |limit| are in use, and
+// returns them on destruction.
+class BandHelperLease {
+ public:
+  BandHelperLease(size_t wanted, size_t limit) {
+    size_t in_use = g_band_helpers_in_use.load(std::memory_order_relaxed);
+    do {
+      granted_ = in_use < limit ? std::min(wanted, limit - in_use) : 0;
+    } while (granted_ > 0 && !g_band_helpers_in_use.compare_exchange_weak(
+                                 in_use, in_use + granted_,
+                                 std::memory_order_relaxed));
+  }
+  ~BandHelperLease() {
+    g_band_helpers_in_use.fetch_sub(granted_, std::memory_order_relaxed);
+  }
+  BandHelperLease(const BandHelperLease&) = delete;
+  BandHelperLease& operator=(const BandHelperLease&) = delete;
+
+  size_t granted() const { return granted_; }
+
+ private:
+  size_t granted_ = 0;
+};
+
+// Helper threads that correct bands, started on first use and parked between
+// frames so a parallel frame does not pay for thread creation.
+class BandWorkerPool {
+ public:
+  static BandWorkerPool& instance() {
+    static BandWorkerPool pool;
+    return pool;
+  }
+
+  ~BandWorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  // Queues |task|, starting workers until |workers| exist. |task| must not
+  // throw. If no worker can be started the task waits for an existing one,
+  // so callers must not depend on it running promptly.
+  void post(std::function<void()> task, size_t workers) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.push_back(std::move(task));
+      while (workers_.size() < workers) {
+        try {
+          workers_.emplace_back(&BandWorkerPool::work, this);
+        } catch (const std::system_error&) {
+          break;
+        }
+      }
+    }
+    wake_.notify_one();
+  }
+
+ private:
+  BandWorkerPool() = default;
+
+  void work() {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::deque<std::function<void()>> tasks_;
+  std::vector<std::thread> workers_;
+  bool stopping_ = false;
+};
+
+// Bands of one frame, claimed in order by the calling thread and its helpers.
+// Helpers hold the state by shared_ptr: one that starts after every band was
+// claimed finds nothing left and never touches the caller's frame.
+struct BandRun {
+  size_t bands = 0;
+  std::function<void(size_t)> run_band;
+  std::atomic<size_t> next{0};
+
+  std::mutex mutex;
+  std::condition_variable finished;
+  size_t done = 0;           // guarded by mutex
+  std::exception_ptr error;  // first failure; guarded by mutex
+
+  // Runs unclaimed bands until none are left. Never throws.
+  void drain() {
+    for (;;) {
+      const size_t b = next.fetch_add(1, std::memory_order_relaxed);
+      if (b >= bands) {
+        return;
+      }
+      std::exception_ptr failure;
+      try {
+        run_band(b);
+      } catch (...) {
+        failure = std::current_exception();
+      }
+      std::lock_guard<std::mutex> lock(mutex);
+      if (failure && !error) {
+        error = failure;
+      }
+      if (++done == bands) {
+        finished.notify_all();
+      }
+    }
+  }
+};
+
+// Calls |correct|(dropout, cache) for every dropout, split into bands of
+// whole lines, each with its own |Cache|. The calling thread and helpers from
+// the shared budget above (at most |thread_count| - 1 in the whole process)
+// claim bands until none are left; with no helper free the frame is
+// corrected on the calling thread alone. The call returns only once every
+// band has finished, and rethrows the first exception any band raised.
+// All dropouts of one line run on one thread in their original order, so
+// overlapping regions resolve exactly as in a serial pass, and different
+// lines write disjoint samples: the output does not depend on the thread
+// count. Returns how many calls returned true.
+template <typename Cache, typename Fn>
+size_t for_each_line_band(const std::vector<LineDropout>& dropouts,
+                          size_t thread_count, Fn&& correct) {
+  auto correct_serially = [&]() {
+    Cache cache;
+    size_t corrected = 0;
+    for (const auto& d : dropouts) {
+      corrected += correct(d, cache) ? 1 : 0;
+    }
+    return corrected;
+  };
+  if (thread_count <= 1 || dropouts.size() < kMinDropoutsForParallel) {
+    return correct_serially();
+  }
+  const BandHelperLease helpers(thread_count - 1, thread_count - 1);
+  if (helpers.granted() == 0) {
+    return correct_serially();
+  }
+
+  std::vector<size_t> order(dropouts.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return dropouts[a].line < dropouts[b].line;
+  });
+
+  // Cut into roughly equal dropout counts, moving each cut to a line start.
+  const size_t band_target = helpers.granted() + 1;
+  std::vector<size_t> cuts{0};
+  const size_t per_band = (order.size() + band_target - 1) / band_target;
+  while (cuts.back() < order.size()) {
+    size_t cut = std::min(cuts.back() + per_band, order.size());
+    while (cut < order.size() &&
+           dropouts[order[cut]].line == dropouts[order[cut - 1]].line) {
+      ++cut;
+    }
+    cuts.push_back(cut);
+  }
+
+  const size_t bands = cuts.size() - 1;
+  std::vector<size_t> band_corrected(bands, 0);
+  auto run = std::make_shared<BandRun>();
+  run->bands = bands;
+  run->run_band = [&](size_t b) {
+    Cache cache;
+    for (size_t i = cuts[b]; i < cuts[b + 1]; ++i) {
+      band_corrected[b] += correct(dropouts[order[i]], cache) ? 1 : 0;
+    }
+  };
+  auto& pool = BandWorkerPool::instance();
+  const size_t helper_count = std::min(helpers.granted(), bands - 1);
+  for (size_t h = 0; h < helper_count; ++h) {
+    try {
+      pool.post([run] { run->drain(); },
+                g_band_helpers_in_use.load(std::memory_order_relaxed));
+    } catch (...) {
+      break;  // the calling thread drains whatever no helper picks up
+    }
+  }
+  run->drain();
+  {
+    std::unique_lock<std::mutex> lock(run->mutex);
+    run->finished.wait(lock, [&] { return run->done == bands; });
+    if (run->error) {
+      std::rethrow_exception(run->error);
+    }
+  }
+  size_t corrected = 0;
+  for (size_t n : band_corrected) {
+    corrected += n;
+  }
+  return corrected;
+}
+
 }  // namespace
 
 // ============================================================================
@@ -123,7 +375,14 @@ CorrectedVideoFrameRepresentation::CorrectedVideoFrameRepresentation(
       highlight_corrections_(highlight_corrections),
       corrected_frames_(MAX_CACHED_FRAMES),
       corrected_luma_frames_(MAX_CACHED_FRAMES),
-      corrected_chroma_frames_(MAX_CACHED_FRAMES) {}
+      corrected_chroma_frames_(MAX_CACHED_FRAMES) {
+  // ensure_frame_corrected() leads with these caches.
+  IMetricsRegistry* metrics = plugin::get_metrics();
+  corrected_frames_.bind_metrics(metrics, "dropout_correct.frames",
+                                 FrameCache::CountedLookup::kContains);
+  corrected_luma_frames_.bind_metrics(metrics, "dropout_correct.yc_frames",
+                                      FrameCache::CountedLookup::kContains);
+}
 
 void CorrectedVideoFrameRepresentation::ensure_frame_corrected(
     FrameID frame_id) const {
@@ -144,8 +403,8 @@ void CorrectedVideoFrameRepresentation::ensure_frame_corrected(
 const int16_t* CorrectedVideoFrameRepresentation::get_frame(FrameID id) const {
   ensure_frame_corrected(id);
   const auto* cached = corrected_frames_.get_ptr(id);
-  if (cached && !cached->empty()) {
-    return cached->data();
+  if (cached && *cached) {
+    return (*cached)->data();
   }
   return source_->get_frame(id);
 }
@@ -154,11 +413,12 @@ const int16_t* CorrectedVideoFrameRepresentation::get_line(FrameID id,
                                                            size_t line) const {
   ensure_frame_corrected(id);
   const auto* cached = corrected_frames_.get_ptr(id);
-  if (cached && !cached->empty()) {
+  if (cached && *cached) {
     auto desc = source_->get_frame_descriptor(id);
     if (desc && line < desc->height) {
-      return &(*cached)[frame_line_sample_offset(
-          desc->system, desc->samples_per_line_nominal, line)];
+      return (*cached)->data() +
+             frame_line_sample_offset(desc->system,
+                                      desc->samples_per_line_nominal, line);
     }
   }
   return source_->get_line(id, line);
@@ -168,12 +428,47 @@ std::vector<int16_t> CorrectedVideoFrameRepresentation::get_frame_copy(
     FrameID id) const {
   ensure_frame_corrected(id);
   const auto* cached = corrected_frames_.get_ptr(id);
-  if (cached && !cached->empty()) {
-    return *cached;
+  if (cached && *cached) {
+    return **cached;
   }
   return source_->get_frame_copy(id);
 }
 
+// Corrected planes are shared from the correction caches; planes that needed
+// no correction come from the source's own handle.
+FrameHandle CorrectedVideoFrameRepresentation::acquire_frame(FrameID id) const {
+  if (!source_) {
+    return nullptr;
+  }
+  ensure_frame_corrected(id);
+  const auto corrected = [id](auto& cache) -> SharedSampleBuffer {
+    auto entry = cache.get(id);
+    return entry ? *entry : nullptr;
+  };
+
+  auto frame = std::make_shared<AcquiredFrame>();
+  if (auto samples = corrected(corrected_frames_)) {
+    frame->frame_id = id;
+    frame->samples = std::move(samples);
+  } else {
+    const FrameHandle upstream = source_->acquire_frame(id);
+    if (!upstream) {
+      return nullptr;
+    }
+    *frame = *upstream;
+  }
+  if (source_->has_separate_channels()) {
+    if (auto luma = corrected(corrected_luma_frames_)) {
+      frame->luma = std::move(luma);
+    }
+    if (auto chroma = corrected(corrected_chroma_frames_)) {
+      frame->chroma = std::move(chroma);
+    }
+  }
+  frame->dropouts = get_dropout_hints(id);
+  return frame;
+}
+
 const int16_t* CorrectedVideoFrameRepresentation::get_frame_luma(
     FrameID id) const {
   if (!source_ || !source_->has_separate_channels()) {
@@ -181,8 +476,8 @@ const int16_t* CorrectedVideoFrameRepresentation::get_frame_luma(
   }
   ensure_frame_corrected(id);
   const auto* cached = corrected_luma_frames_.get_ptr(id);
-  if (cached && !cached->empty()) {
-    return cached->data();
+  if (cached && *cached) {
+    return (*cached)->data();
   }
   return source_->get_frame_luma(id);
 }
@@ -194,11 +489,12 @@ const int16_t* CorrectedVideoFrameRepresentation::get_line_luma(
   }
   ensure_frame_corrected(id);
   const auto* cached = corrected_luma_frames_.get_ptr(id);
-  if (cached && !cached->empty()) {
+  if (cached && *cached) {
     auto desc = source_->get_frame_descriptor(id);
     if (desc && line < desc->height) {
-      return &(*cached)[frame_line_sample_offset(
-          desc->system, desc->samples_per_line_nominal, line)];
+      return (*cached)->data() +
+             frame_line_sample_offset(desc->system,
+                                      desc->samples_per_line_nominal, line);
     }
   }
   return source_->get_line_luma(id, line);
@@ -211,8 +507,8 @@ const int16_t* CorrectedVideoFrameRepresentation::get_frame_chroma(
   }
   ensure_frame_corrected(id);
   const auto* cached = corrected_chroma_frames_.get_ptr(id);
-  if (cached && !cached->empty()) {
-    return cached->data();
+  if (cached && *cached) {
+    return (*cached)->data();
   }
   return source_->get_frame_chroma(id);
 }
@@ -224,11 +520,12 @@ const int16_t* CorrectedVideoFrameRepresentation::get_line_chroma(
   }
   ensure_frame_corrected(id);
   const auto* cached = corrected_chroma_frames_.get_ptr(id);
-  if (cached && !cached->empty()) {
+  if (cached && *cached) {
     auto desc = source_->get_frame_descriptor(id);
     if (desc && line < desc->height) {
-      return &(*cached)[frame_line_sample_offset(
-          desc->system, desc->samples_per_line_nominal, line)];
+      return (*cached)->data() +
+             frame_line_sample_offset(desc->system,
+                                      desc->samples_per_line_nominal, line);
     }
   }
   return source_->get_line_chroma(id, line);
@@ -307,90 +604,95 @@ std::vector<LineDropout> DropoutCorrectStage::split_dropout_regions(
 // ============================================================================
 
 DropoutCorrectStage::ReplacementLine DropoutCorrectStage::find_replacement_line(
-    const VideoFrameRepresentation& source, FrameID frame_id, uint32_t line,
-    const LineDropout& dropout, bool intrafield,
-    bool match_chroma_phase_override, size_t field1_lines,
-    const std::vector<LineDropout>& frame_dropouts, Channel channel) const {
+    const FrameSearchContext& frame, uint32_t line, const LineDropout& dropout,
+    bool intrafield, bool match_chroma_phase_override, Channel channel,
+    QualityCache& quality_cache) const {
   ReplacementLine best;
 
-  const auto desc_opt = source.get_frame_descriptor(frame_id);
-  if (!desc_opt) {
-    return best;
-  }
-  const auto& desc = *desc_opt;
-
-  const int32_t height = static_cast<int32_t>(desc.height);
-  const size_t spl = desc.samples_per_line_nominal;
-
+  const int32_t height = frame.height;
+  const size_t field1_lines = frame.field1_lines;
   const bool is_field1 = (line < field1_lines);
 
   uint32_t step = 1;
   int32_t other_field_off = 0;
 
-  if (match_chroma_phase_override) {
-    auto vp = source.get_video_parameters();
-    if (vp) {
-      // Step values are the field-sequential line offsets that keep the colour
-      // subcarrier (and PAL V-switch) in phase.  Verified empirically by burst
-      // correlation against neighbouring lines: for NTSC only even offsets stay
-      // in phase (odd offsets invert), and for PAL only offsets that are a
-      // multiple of 4 stay in phase for every line.  Smaller offsets invert the
-      // burst and decode to the wrong hue.
-      if (is_pal(vp->system)) {
-        step = 4;
-        other_field_off = is_field1 ? -3 : -1;
-      } else {
-        step = 2;
-        other_field_off = -1;
-      }
+  if (match_chroma_phase_override && frame.system) {
+    // Step values are the field-sequential line offsets that keep the colour
+    // subcarrier (and PAL V-switch) in phase.  Verified empirically by burst
+    // correlation against neighbouring lines: for NTSC only even offsets stay
+    // in phase (odd offsets invert), and for PAL only offsets that are a
+    // multiple of 4 stay in phase for every line.  Smaller offsets invert the
+    // burst and decode to the wrong hue.
+    if (is_pal(*frame.system)) {
+      step = 4;
+      other_field_off = is_field1 ? -3 : -1;
+    } else {
+      step = 2;
+      other_field_off = -1;
     }
   }
 
-  // Active picture line range as a FIELD-line range.  first/last_active_frame_
-  // line are interlaced frame numbers (2x the field line); the replacement
-  // search works in field-sequential flat lines, so the bounds must be applied
-  // per field.  Restricting with the raw frame numbers would let the search
-  // descend into a field's VBI/blanking lines, which carry no subcarrier and
-  // decode to a black line with no chroma.
-  int32_t active_field_first = 0;
-  int32_t active_field_last = height;  // permissive fallback (whole field)
-  const auto vp = source.get_video_parameters();
-  if (vp && vp->first_active_frame_line >= 0 &&
-      vp->last_active_frame_line >= 0) {
-    active_field_first = vp->first_active_frame_line / 2;
-    active_field_last = vp->last_active_frame_line / 2;
-  }
-
-  auto get_line_fn = [&source, frame_id, channel](size_t ln) -> const int16_t* {
-    switch (channel) {
-      case Channel::LUMA:
-        return source.get_line_luma(frame_id, ln);
-      case Channel::CHROMA:
-        return source.get_line_chroma(frame_id, ln);
-      default:
-        return source.get_line(frame_id, ln);
-    }
-  };
+  const int32_t active_field_first = frame.active_field_first;
+  const int32_t active_field_last = frame.active_field_last;
+
+  const std::vector<const int16_t*>& lines =
+      channel == Channel::LUMA     ? frame.luma_lines
+      : channel == Channel::CHROMA ? frame.chroma_lines
+                                   : frame.composite_lines;
 
   // Reject a candidate replacement line whose own dropouts overlap the sample
   // range being corrected — copying corrupted samples would not repair the
-  // dropout.  frame_dropouts holds every line-dropout in this frame (linear
-  // scan; dropout counts per frame are small in practice).
-  auto has_overlap = [&frame_dropouts, &dropout](uint32_t chk_line) -> bool {
-    for (const auto& d : frame_dropouts) {
-      if (d.line != chk_line) {
-        continue;
-      }
-      if (d.start_sample <= dropout.end_sample &&
-          dropout.start_sample <= d.end_sample) {
+  // dropout.
+  auto has_overlap = [&frame, &dropout](uint32_t chk_line) -> bool {
+    for (const auto& [start, end] : frame.dropouts_by_line[chk_line]) {
+      if (start <= dropout.end_sample && dropout.start_sample <= end) {
         return true;
       }
     }
     return false;
   };
 
+  // Overlapping and split dropouts on neighbouring lines revisit the same
+  // candidates with the same sample range; score each one once per frame.
+  auto quality_of = [&](uint32_t cl, const int16_t* data) {
+    const uint64_t key = (static_cast<uint64_t>(channel) << 60) |
+                         (static_cast<uint64_t>(cl) << 40) |
+                         (static_cast<uint64_t>(dropout.start_sample) << 20) |
+                         static_cast<uint64_t>(dropout.end_sample);
+    auto [it, inserted] = quality_cache.try_emplace(key, 0.0);
+    if (inserted) {
+      it->second = calculate_line_quality(data, frame.spl, dropout);
+    }
+    return it->second;
+  };
+
   std::vector<ReplacementLine> candidates;
 
+  // Walk from |from| in steps of |delta| while inside [lo, hi) and keep the
+  // first usable line as a candidate.
+  auto search = [&](int32_t from, int32_t delta, int32_t lo, int32_t hi) {
+    for (int32_t sl = from; sl >= lo && sl < hi; sl += delta) {
+      const uint32_t cl = static_cast<uint32_t>(sl);
+      if (has_overlap(cl)) {
+        continue;
+      }
+      const int16_t* data = lines[cl];
+      if (data) {
+        ReplacementLine c;
+        c.found = true;
+        c.source_frame = frame.frame_id;
+        c.source_line = cl;
+        c.quality = quality_of(cl, data);
+        c.distance =
+            static_cast<uint32_t>(std::abs(static_cast<int32_t>(line) - sl));
+        c.cached_data = data;
+        candidates.push_back(c);
+        return;
+      }
+    }
+  };
+
+  const int32_t istep = static_cast<int32_t>(step);
   if (intrafield) {
     const int32_t field_start =
         is_field1 ? 0 : static_cast<int32_t>(field1_lines);
@@ -401,49 +703,8 @@ DropoutCorrectStage::ReplacementLine DropoutCorrectStage::find_replacement_line(
     const int32_t active_hi =
         field_start + std::min(active_field_last + 1, field_end - field_start);
 
-    // Search upward
-    int32_t sl = static_cast<int32_t>(line) - static_cast<int32_t>(step);
-    while (sl >= active_lo) {
-      const uint32_t cl = static_cast<uint32_t>(sl);
-      if (!has_overlap(cl)) {
-        const int16_t* data = get_line_fn(cl);
-        if (data) {
-          ReplacementLine c;
-          c.found = true;
-          c.source_frame = frame_id;
-          c.source_line = cl;
-          c.quality = calculate_line_quality(data, spl, dropout);
-          c.distance =
-              static_cast<uint32_t>(std::abs(static_cast<int32_t>(line) - sl));
-          c.cached_data = data;
-          candidates.push_back(c);
-          break;
-        }
-      }
-      sl -= static_cast<int32_t>(step);
-    }
-
-    // Search downward
-    sl = static_cast<int32_t>(line) + static_cast<int32_t>(step);
-    while (sl < active_hi) {
-      const uint32_t cl = static_cast<uint32_t>(sl);
-      if (!has_overlap(cl)) {
-        const int16_t* data = get_line_fn(cl);
-        if (data) {
-          ReplacementLine c;
-          c.found = true;
-          c.source_frame = frame_id;
-          c.source_line = cl;
-          c.quality = calculate_line_quality(data, spl, dropout);
-          c.distance =
-              static_cast<uint32_t>(std::abs(static_cast<int32_t>(line) - sl));
-          c.cached_data = data;
-          candidates.push_back(c);
-          break;
-        }
-      }
-      sl += static_cast<int32_t>(step);
-    }
+    search(static_cast<int32_t>(line) - istep, -istep, active_lo, height);
+    search(static_cast<int32_t>(line) + istep, istep, 0, active_hi);
   } else {
     const int32_t field_offset = is_field1
                                      ? static_cast<int32_t>(field1_lines)
@@ -465,49 +726,8 @@ DropoutCorrectStage::ReplacementLine DropoutCorrectStage::find_replacement_line(
       return best;
     }
 
-    // Search up in other field
-    int32_t sl = start_line;
-    while (sl >= active_lo) {
-      const uint32_t cl = static_cast<uint32_t>(sl);
-      if (!has_overlap(cl)) {
-        const int16_t* data = get_line_fn(cl);
-        if (data) {
-          ReplacementLine c;
-          c.found = true;
-          c.source_frame = frame_id;
-          c.source_line = cl;
-          c.quality = calculate_line_quality(data, spl, dropout);
-          c.distance =
-              static_cast<uint32_t>(std::abs(static_cast<int32_t>(line) - sl));
-          c.cached_data = data;
-          candidates.push_back(c);
-          break;
-        }
-      }
-      sl -= static_cast<int32_t>(step);
-    }
-
-    // Search down in other field
-    sl = start_line + static_cast<int32_t>(step);
-    while (sl < active_hi) {
-      const uint32_t cl = static_cast<uint32_t>(sl);
-      if (!has_overlap(cl)) {
-        const int16_t* data = get_line_fn(cl);
-        if (data) {
-          ReplacementLine c;
-          c.found = true;
-          c.source_frame = frame_id;
-          c.source_line = cl;
-          c.quality = calculate_line_quality(data, spl, dropout);
-          c.distance =
-              static_cast<uint32_t>(std::abs(static_cast<int32_t>(line) - sl));
-          c.cached_data = data;
-          candidates.push_back(c);
-          break;
-        }
-      }
-      sl += static_cast<int32_t>(step);
-    }
+    search(start_line, -istep, active_lo, height);
+    search(start_line + istep, istep, 0, active_hi);
   }
 
   for (const auto& c : candidates) {
@@ -552,6 +772,8 @@ void DropoutCorrectStage::correct_single_frame(
     FrameID frame_id) const {
   ORC_LOG_DEBUG("DropoutCorrectStage::correct_single_frame - frame {}",
                 frame_id);
+  ORC_TRACE_FRAME_SCOPE(plugin::get_tracer(), "transform", "correct_frame",
+                        "dropout_correct", frame_id);
 
   const auto desc_opt = source->get_frame_descriptor(frame_id);
   if (!desc_opt) {
@@ -577,13 +799,10 @@ void DropoutCorrectStage::correct_single_frame(
   // get_frame() pointer still refers to.
   if (dropouts.empty()) {
     if (source->has_separate_channels()) {
-      corrected->corrected_luma_frames_.put_if_absent(frame_id,
-                                                      std::vector<int16_t>{});
-      corrected->corrected_chroma_frames_.put_if_absent(frame_id,
-                                                        std::vector<int16_t>{});
+      corrected->corrected_luma_frames_.put_if_absent(frame_id, nullptr);
+      corrected->corrected_chroma_frames_.put_if_absent(frame_id, nullptr);
     } else {
-      corrected->corrected_frames_.put_if_absent(frame_id,
-                                                 std::vector<int16_t>{});
+      corrected->corrected_frames_.put_if_absent(frame_id, nullptr);
     }
     return;
   }
@@ -613,6 +832,47 @@ void DropoutCorrectStage::correct_single_frame(
   const auto split_dropouts =
       split_dropout_regions(dropouts, desc, video_params);
 
+  size_t thread_count = config_.thread_count;
+  if (thread_count == 0) {
+    thread_count = std::thread::hardware_concurrency();
+    if (thread_count == 0) {
+      thread_count = 4;
+    }
+  }
+
+  // Replacement-search state shared by every dropout in the frame. Candidate
+  // lines are served from the frame acquired below rather than fetched from
+  // the source one get_line() call at a time.
+  FrameSearchContext frame;
+  frame.frame_id = frame_id;
+  frame.spl = spl;
+  frame.height = static_cast<int32_t>(height);
+  frame.field1_lines = field1_lines;
+  // Active picture line range as a FIELD-line range.  first/last_active_frame_
+  // line are interlaced frame numbers (2x the field line); the replacement
+  // search works in field-sequential flat lines, so the bounds must be applied
+  // per field.  Restricting with the raw frame numbers would let the search
+  // descend into a field's VBI/blanking lines, which carry no subcarrier and
+  // decode to a black line with no chroma.
+  frame.active_field_last = frame.height;  // permissive fallback (whole field)
+  if (video_params) {
+    frame.system = video_params->system;
+    if (video_params->first_active_frame_line >= 0 &&
+        video_params->last_active_frame_line >= 0) {
+      frame.active_field_first = video_params->first_active_frame_line / 2;
+      frame.active_field_last = video_params->last_active_frame_line / 2;
+    }
+  }
+  // Every line-dropout in the frame (before splitting), so a candidate line
+  // carrying its own dropout over the samples being corrected is skipped.
+  frame.dropouts_by_line.resize(height);
+  for (const auto& d : dropouts) {
+    if (d.line < height) {
+      frame.dropouts_by_line[d.line].emplace_back(d.start_sample,
+                                                  d.end_sample);
+    }
+  }
+
   // -----------------------------------------------------------------------
   // YC source path
   // -----------------------------------------------------------------------
@@ -621,20 +881,29 @@ void DropoutCorrectStage::correct_single_frame(
     // keep the source sample layout (see composite path note); consumers read
     // them whole via get_frame_luma()/get_frame_chroma().
     const size_t frame_samples = desc.samples_total;
-    const int16_t* src_luma = source->get_frame_luma(frame_id);
-    const int16_t* src_chroma = source->get_frame_chroma(frame_id);
-    std::vector<int16_t> luma_data =
-        src_luma ? std::vector<int16_t>(src_luma, src_luma + frame_samples)
-                 : std::vector<int16_t>(frame_samples, int16_t{0});
-    std::vector<int16_t> chroma_data =
-        src_chroma
-            ? std::vector<int16_t>(src_chroma, src_chroma + frame_samples)
-            : std::vector<int16_t>(frame_samples, int16_t{0});
-
-    size_t corrections = 0;
-    for (const auto& d : split_dropouts) {
+    const FrameHandle src = source->acquire_frame(frame_id);
+    const auto copy_plane = [frame_samples](const SharedSampleBuffer& plane) {
+      auto data =
+          acquire_sample_buffer(plugin::get_frame_buffer_pool(), frame_samples);
+      if (plane && plane->size() >= frame_samples) {
+        std::copy_n(plane->begin(), frame_samples, data->begin());
+      } else {
+        std::fill(data->begin(), data->end(), int16_t{0});
+      }
+      return data;
+    };
+    auto luma_buffer = copy_plane(src ? src->luma : nullptr);
+    auto chroma_buffer = copy_plane(src ? src->chroma : nullptr);
+    std::vector<int16_t>& luma_data = *luma_buffer;
+    std::vector<int16_t>& chroma_data = *chroma_buffer;
+    frame.luma_lines =
+        line_table(src ? src->luma : nullptr, desc.system, spl, height);
+    frame.chroma_lines =
+        line_table(src ? src->chroma : nullptr, desc.system, spl, height);
+
+    auto correct_yc = [&](const LineDropout& d, QualityCache& cache) {
       if (d.line >= height) {
-        continue;
+        return false;
       }
       const size_t line_base =
           frame_line_sample_offset(desc.system, spl, d.line);
@@ -645,34 +914,28 @@ void DropoutCorrectStage::correct_single_frame(
       // Luma carries no subcarrier, so it may borrow the spatially nearest
       // line, falling back to the other field when no intrafield line is found.
       auto luma_repl = find_replacement_line(
-          *source, frame_id, d.line, d, /*intrafield=*/true,
-          /*match_chroma_phase_override=*/false, field1_lines, dropouts,
-          Channel::LUMA);
+          frame, d.line, d, /*intrafield=*/true,
+          /*match_chroma_phase_override=*/false, Channel::LUMA, cache);
       if (!luma_repl.found) {
         luma_repl = find_replacement_line(
-            *source, frame_id, d.line, d, /*intrafield=*/false,
-            /*match_chroma_phase_override=*/false, field1_lines, dropouts,
-            Channel::LUMA);
+            frame, d.line, d, /*intrafield=*/false,
+            /*match_chroma_phase_override=*/false, Channel::LUMA, cache);
       }
 
       // Chroma must preserve subcarrier phase, so it is restricted to a
       // phase-matched intrafield line; an interfield line would invert the
       // colour and is never used.
-      auto chroma_repl = find_replacement_line(
-          *source, frame_id, d.line, d, /*intrafield=*/true,
-          config_.match_chroma_phase, field1_lines, dropouts, Channel::CHROMA);
+      auto chroma_repl =
+          find_replacement_line(frame, d.line, d, /*intrafield=*/true,
+                                config_.match_chroma_phase, Channel::CHROMA,
+                                cache);
 
       if (!luma_repl.found && !chroma_repl.found) {
-        continue;
+        return false;
       }
 
-      const int16_t* ry = luma_repl.found ? source->get_line_luma(
-                                                frame_id, luma_repl.source_line)
-                                          : nullptr;
-      const int16_t* rc =
-          chroma_repl.found
-              ? source->get_line_chroma(frame_id, chroma_repl.source_line)
-              : nullptr;
+      const int16_t* ry = luma_repl.cached_data;
+      const int16_t* rc = chroma_repl.cached_data;
       for (uint32_t s = d.start_sample; s <= d.end_sample && s < line_len;
            ++s) {
         if (luma_repl.found) {
@@ -686,13 +949,15 @@ void DropoutCorrectStage::correct_single_frame(
                                                         : int16_t{0};
         }
       }
-      corrections++;
-    }
+      return true;
+    };
+    const size_t corrections = for_each_line_band<QualityCache>(
+        split_dropouts, thread_count, correct_yc);
 
     corrected->corrected_luma_frames_.put_if_absent(frame_id,
-                                                    std::move(luma_data));
+                                                    std::move(luma_buffer));
     corrected->corrected_chroma_frames_.put_if_absent(frame_id,
-                                                      std::move(chroma_data));
+                                                      std::move(chroma_buffer));
     ORC_LOG_DEBUG("DropoutCorrectStage: YC frame {} done - {} corrections",
                   frame_id, corrections);
     return;
@@ -704,14 +969,23 @@ void DropoutCorrectStage::correct_single_frame(
   // Start from an exact copy of the source frame so the corrected buffer keeps
   // the source sample layout (PAL frames are non-uniform: lines 312 and 624
   // carry two extra samples).  Consumers that read the whole frame via
-  // get_frame() — e.g. the chroma decoder — depend on this layout.
-  std::vector<int16_t> frame_data = source->get_frame_copy(frame_id);
-
-  size_t corrections = 0;
+  // get_frame() — e.g. the chroma decoder — depend on this layout. The copy
+  // lands in a buffer from the host frame buffer pool.
+  const FrameHandle src = source->acquire_frame(frame_id);
+  if (!src || !src->samples || src->samples->empty()) {
+    // No source data: recorded like an uncorrected frame.
+    corrected->corrected_frames_.put_if_absent(frame_id, nullptr);
+    return;
+  }
+  auto frame_buffer = acquire_sample_buffer(plugin::get_frame_buffer_pool(),
+                                            src->samples->size());
+  std::copy(src->samples->begin(), src->samples->end(), frame_buffer->begin());
+  std::vector<int16_t>& frame_data = *frame_buffer;
+  frame.composite_lines = line_table(src->samples, desc.system, spl, height);
 
-  for (const auto& d : split_dropouts) {
+  auto correct_composite = [&](const LineDropout& d, QualityCache& cache) {
     if (d.line >= height) {
-      continue;
+      return false;
     }
     const size_t line_base = frame_line_sample_offset(desc.system, spl, d.line);
     const size_t line_len = frame_line_sample_count(desc.system, spl, d.line);
@@ -722,22 +996,25 @@ void DropoutCorrectStage::correct_single_frame(
     // Replacement is restricted to an intrafield (same-field) line: an
     // interfield line does not preserve subcarrier phase and would invert the
     // colour, so it is never used here.
-    auto repl = find_replacement_line(
-        *source, frame_id, d.line, d, /*intrafield=*/true,
-        config_.match_chroma_phase, field1_lines, dropouts, Channel::COMPOSITE);
-    if (repl.found) {
-      const int16_t* rep = source->get_line(frame_id, repl.source_line);
-      for (uint32_t s = d.start_sample; s <= d.end_sample && s < line_len;
-           ++s) {
-        line_ptr[s] = corrected->highlight_corrections_ ? highlight_val
-                      : rep                             ? rep[s]
-                                                        : int16_t{0};
-      }
-      corrections++;
+    auto repl = find_replacement_line(frame, d.line, d, /*intrafield=*/true,
+                                      config_.match_chroma_phase,
+                                      Channel::COMPOSITE, cache);
+    if (!repl.found) {
+      return false;
     }
-  }
+    const int16_t* rep = repl.cached_data;
+    for (uint32_t s = d.start_sample; s <= d.end_sample && s < line_len; ++s) {
+      line_ptr[s] = corrected->highlight_corrections_ ? highlight_val
+                    : rep                             ? rep[s]
+                                                      : int16_t{0};
+    }
+    return true;
+  };
+  const size_t corrections = for_each_line_band<QualityCache>(
+      split_dropouts, thread_count, correct_composite);
 
-  corrected->corrected_frames_.put_if_absent(frame_id, std::move(frame_data));
+  corrected->corrected_frames_.put_if_absent(frame_id,
+                                             std::move(frame_buffer));
   ORC_LOG_DEBUG("DropoutCorrectStage: composite frame {} done - {} corrections",
                 frame_id, corrections);
 }
@@ -21,6 +21,9 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace orc {
@@ -29,6 +32,11 @@ struct DropoutCorrectionConfig {
   uint32_t overcorrect_extension = 0;
   bool match_chroma_phase = true;
   bool highlight_corrections = false;
+  // Threads correcting dropouts (0 = hardware concurrency): each frame's
+  // calling thread plus helper threads drawn from one budget shared by all
+  // frames corrected at once. Frames with few dropouts are always corrected
+  // on the calling thread.
+  uint32_t thread_count = 0;
 };
 
 // Forward declaration
@@ -61,6 +69,7 @@ class CorrectedVideoFrameRepresentation
   const int16_t* get_frame(FrameID id) const override;
   const int16_t* get_line(FrameID id, size_t line) const override;
   std::vector<int16_t> get_frame_copy(FrameID id) const override;
+  FrameHandle acquire_frame(FrameID id) const override;
 
   const int16_t* get_frame_luma(FrameID id) const override;
   const int16_t* get_line_luma(FrameID id, size_t line) const override;
@@ -80,9 +89,13 @@ class CorrectedVideoFrameRepresentation
 
   static constexpr size_t MAX_CACHED_FRAMES = 150;
 
-  mutable LRUCache<FrameID, std::vector<int16_t>> corrected_frames_;
-  mutable LRUCache<FrameID, std::vector<int16_t>> corrected_luma_frames_;
-  mutable LRUCache<FrameID, std::vector<int16_t>> corrected_chroma_frames_;
+  // Corrected buffers, shared so acquire_frame() handles outlive eviction. A
+  // null entry records a frame that needed no correction (served from the
+  // source).
+  using FrameCache = LRUCache<FrameID, SharedSampleBuffer>;
+  mutable FrameCache corrected_frames_;
+  mutable FrameCache corrected_luma_frames_;
+  mutable FrameCache corrected_chroma_frames_;
 
   void ensure_frame_corrected(FrameID frame_id) const;
 };
@@ -169,12 +182,36 @@ class DropoutCorrectStage : public DAGStage,
     const int16_t* cached_data = nullptr;
   };
 
-  ReplacementLine find_replacement_line(
-      const VideoFrameRepresentation& source, FrameID frame_id, uint32_t line,
-      const LineDropout& dropout, bool intrafield,
-      bool match_chroma_phase_override, size_t field1_lines,
-      const std::vector<LineDropout>& frame_dropouts,
-      Channel channel = Channel::COMPOSITE) const;
+  // Everything the replacement search needs about one frame, gathered once
+  // before any dropout is corrected: geometry, every source line of each
+  // channel (pointers into the acquired source frame), and the frame's
+  // dropouts indexed by line. Read-only while the frame is corrected, so
+  // shared by all worker threads.
+  struct FrameSearchContext {
+    FrameID frame_id = 0;
+    size_t spl = 0;
+    int32_t height = 0;
+    size_t field1_lines = 0;
+    std::optional<VideoSystem> system;  // from the video parameters
+    int32_t active_field_first = 0;
+    int32_t active_field_last = 0;
+    std::vector<const int16_t*> composite_lines;
+    std::vector<const int16_t*> luma_lines;
+    std::vector<const int16_t*> chroma_lines;
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> dropouts_by_line;
+  };
+
+  // Candidate-line quality memoised per frame, keyed by channel, line and
+  // dropout sample range. One per worker thread.
+  using QualityCache = std::unordered_map<uint64_t, double>;
+
+  ReplacementLine find_replacement_line(const FrameSearchContext& frame,
+                                        uint32_t line,
+                                        const LineDropout& dropout,
+                                        bool intrafield,
+                                        bool match_chroma_phase_override,
+                                        Channel channel,
+                                        QualityCache& quality_cache) const;
 
   double calculate_line_quality(const int16_t* line_data, size_t width,
                                 const LineDropout& dropout) const;
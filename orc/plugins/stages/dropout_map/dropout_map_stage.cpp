@@ -9,10 +9,12 @@
 
 #include "dropout_map_stage.h"
 
+#include <orc/abi/orc_plugin_services.h>
 #include <orc/stage/cvbs_signal_constants.h>
 #include <orc/stage/error_types.h>
 #include <orc/support/frame_line_util.h>
 #include <orc/support/logging.h>
+#include <orc/support/parsed_param_cache.h>
 #include <orc/support/preview_helpers.h>
 
 #include <algorithm>
@@ -27,10 +29,16 @@ namespace orc {
 
 DropoutMappedFrameRepresentation::DropoutMappedFrameRepresentation(
     std::shared_ptr<const VideoFrameRepresentation> source,
-    const std::map<uint64_t, FrameDropoutMapEntry>& dropout_map)
-    : VideoFrameRepresentationWrapper(std::move(source)),
+    std::shared_ptr<const DropoutMap> dropout_map)
+    : LineOverlayFrameRepresentation(std::move(source)),
       Artifact(ArtifactID("dropout_map"), Provenance{}),
-      dropout_map_(dropout_map) {}
+      dropout_map_(std::move(dropout_map)) {}
+
+DropoutMappedFrameRepresentation::DropoutMappedFrameRepresentation(
+    std::shared_ptr<const VideoFrameRepresentation> source,
+    const DropoutMap& dropout_map)
+    : DropoutMappedFrameRepresentation(
+          std::move(source), std::make_shared<const DropoutMap>(dropout_map)) {}
 
 std::optional<DropoutRun> DropoutMappedFrameRepresentation::entry_to_run(
     VideoSystem sys, int32_t nominal_spl, FrameID frame_id,
@@ -51,8 +59,8 @@ std::vector<DropoutRun> DropoutMappedFrameRepresentation::get_dropout_hints(
   std::vector<DropoutRun> result;
   if (source_) result = source_->get_dropout_hints(id);
 
-  auto it = dropout_map_.find(id);
-  if (it == dropout_map_.end()) return result;
+  auto it = dropout_map_->find(id);
+  if (it == dropout_map_->end()) return result;
 
   const FrameDropoutMapEntry& entry = it->second;
 
@@ -139,13 +147,21 @@ std::vector<ArtifactPtr> DropoutMapStage::execute(
 
   if (!parameters.empty()) set_parameters(parameters);
 
-  std::map<uint64_t, FrameDropoutMapEntry> dropout_map =
-      parse_dropout_map(dropout_map_str_);
+  // Every DAG rebuild creates a new stage instance; the cache parses each
+  // map value once for all of them.
+  static ParsedParamCache<DropoutMap> parsed_maps;
+  auto dropout_map = parsed_maps.get(
+      dropout_map_str_, plugin::get_blob_store(), &parse_dropout_map);
+  if (!dropout_map) {
+    throw DAGExecutionError("DropoutMapStage: dropout map " +
+                            dropout_map_str_ +
+                            " is missing from the project's .blobs directory");
+  }
   ORC_LOG_DEBUG("DropoutMapStage: {} frame mappings loaded",
-                dropout_map.size());
+                dropout_map->size());
 
-  auto mapped =
-      std::make_shared<DropoutMappedFrameRepresentation>(source, dropout_map);
+  auto mapped = std::make_shared<DropoutMappedFrameRepresentation>(
+      source, std::move(dropout_map));
   cached_output_ = mapped;
 
   std::vector<ArtifactPtr> out;
@@ -172,6 +188,7 @@ std::vector<ParameterDescriptor> DropoutMapStage::get_parameter_descriptors(
   desc.type = ParameterType::STRING;
   desc.constraints.default_value = std::string("[]");
   desc.constraints.required = false;
+  desc.blob_storage = true;
   return {desc};
 }
 
@@ -203,9 +220,8 @@ StagePreviewCapability DropoutMapStage::get_preview_capability() const {
 // Parse/Encode helpers (public for GUI dropout editor)
 // ============================================================================
 
-std::map<uint64_t, FrameDropoutMapEntry> DropoutMapStage::parse_dropout_map(
-    const std::string& map_str) {
-  std::map<uint64_t, FrameDropoutMapEntry> result;
+DropoutMap DropoutMapStage::parse_dropout_map(const std::string& map_str) {
+  DropoutMap result;
 
   if (map_str.empty() || map_str == "[]") return result;
 
@@ -309,8 +325,7 @@ std::map<uint64_t, FrameDropoutMapEntry> DropoutMapStage::parse_dropout_map(
   return result;
 }
 
-std::string DropoutMapStage::encode_dropout_map(
-    const std::map<uint64_t, FrameDropoutMapEntry>& map) {
+std::string DropoutMapStage::encode_dropout_map(const DropoutMap& map) {
   if (map.empty()) return "[]";
 
   std::ostringstream oss;
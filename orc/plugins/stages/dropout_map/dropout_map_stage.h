@@ -14,6 +14,7 @@
 #include <orc/plugin/orc_stage_tooling.h>
 #include <orc/stage/artifact.h>
 #include <orc/stage/dropout/dropout_run.h>
+#include <orc/stage/line_overlay_representation.h>
 #include <orc/stage/params/stage_parameter.h>
 #include <orc/stage/video_frame_representation.h>
 #include <orc/support/dropout_util.h>
@@ -43,15 +44,26 @@ struct FrameDropoutMapEntry {
   std::vector<DropoutEntrySpec> removals;
 };
 
+using DropoutMap = std::map<uint64_t, FrameDropoutMapEntry>;
+
 // ============================================================================
 // DropoutMappedFrameRepresentation
 // ============================================================================
-class DropoutMappedFrameRepresentation : public VideoFrameRepresentationWrapper,
+// This stage modifies only dropout hints, never sample data: the line-overlay
+// base serves every frame and line straight from the wrapped input, keeping
+// its seek-one-line-from-disk fast path for analysis sinks scanning whole
+// recordings.
+class DropoutMappedFrameRepresentation : public LineOverlayFrameRepresentation,
                                          public Artifact {
  public:
+  // The parsed map is shared with every other representation built from the
+  // same parameter value (see DropoutMapStage::execute()).
+  DropoutMappedFrameRepresentation(
+      std::shared_ptr<const VideoFrameRepresentation> source,
+      std::shared_ptr<const DropoutMap> dropout_map);
   DropoutMappedFrameRepresentation(
       std::shared_ptr<const VideoFrameRepresentation> source,
-      const std::map<uint64_t, FrameDropoutMapEntry>& dropout_map);
+      const DropoutMap& dropout_map);
 
   std::string type_name() const override {
     return "dropout_mapped_frame_representation";
@@ -59,26 +71,11 @@ class DropoutMappedFrameRepresentation : public VideoFrameRepresentationWrapper,
 
   std::vector<DropoutRun> get_dropout_hints(FrameID id) const override;
 
-  // This stage modifies only dropout hints, never sample data, so line reads
-  // may forward to the wrapped input to preserve its seek-one-line-from-disk
-  // fast path (important for analysis sinks scanning whole recordings).
-  std::vector<sample_type> get_line_samples(FrameID id,
-                                            size_t line) const override {
-    return source_ ? source_->get_line_samples(id, line)
-                   : std::vector<sample_type>{};
-  }
-  const sample_type* get_line(FrameID id, size_t line) const override {
-    return source_ ? source_->get_line(id, line) : nullptr;
-  }
-  const sample_type* get_line_luma(FrameID id, size_t line) const override {
-    return source_ ? source_->get_line_luma(id, line) : nullptr;
-  }
-  const sample_type* get_line_chroma(FrameID id, size_t line) const override {
-    return source_ ? source_->get_line_chroma(id, line) : nullptr;
-  }
+ protected:
+  bool has_overlay(FrameID /*id*/) const override { return false; }
 
  private:
-  std::map<uint64_t, FrameDropoutMapEntry> dropout_map_;
+  std::shared_ptr<const DropoutMap> dropout_map_;
 
   // Convert (frame_id, line, sample_start, sample_end) to a DropoutRun.
   static std::optional<DropoutRun> entry_to_run(VideoSystem sys,
@@ -136,10 +133,8 @@ class DropoutMapStage : public DAGStage,
       const std::map<std::string, ParameterValue>& params) override;
 
   // Parse/encode helpers (public for GUI dropout editor)
-  static std::map<uint64_t, FrameDropoutMapEntry> parse_dropout_map(
-      const std::string& map_str);
-  static std::string encode_dropout_map(
-      const std::map<uint64_t, FrameDropoutMapEntry>& map);
+  static DropoutMap parse_dropout_map(const std::string& map_str);
+  static std::string encode_dropout_map(const DropoutMap& map);
 
   std::vector<StageToolDescriptor> get_stage_tools() const override {
     return {StageToolDescriptor{"dropout_editor", "Dropout Editor",
@@ -149,7 +144,7 @@ class DropoutMapStage : public DAGStage,
   }
 
  private:
-  std::string dropout_map_str_ = "[]";
+  std::string dropout_map_str_ = "[]";  // Inline text or blob reference
   mutable std::shared_ptr<const VideoFrameRepresentation> cached_output_;
 };
 
@@ -75,6 +75,42 @@ std::vector<int32_t> EFMAudioChannelPairRepresentation::get_audio_samples(
   return samples;
 }
 
+bool EFMAudioChannelPairRepresentation::read_audio(size_t pair,
+                                                   uint64_t start_pair,
+                                                   size_t count,
+                                                   int32_t* out) const {
+  if (pair != efm_pair_index()) {
+    return VideoFrameRepresentationWrapper::read_audio(pair, start_pair, count,
+                                                       out);
+  }
+  std::fill(out, out + count * 2, 0);
+  if (!source_) return false;
+
+  ensure_decoded();
+
+  const auto params = source_->get_video_parameters();
+  const VideoSystem system = params ? params->system : VideoSystem::Unknown;
+  const FrameIDRange range = source_->frame_range();
+  if (audio_pairs_in_frame(0, system) == 0 || range.empty()) return false;
+
+  // One cache read for the part of the range inside the stream; a failed
+  // decode or short read leaves silence, as get_audio_samples() does.
+  const uint64_t end_pair = start_pair + count;
+  const uint64_t first =
+      std::max(start_pair, audio_pair_offset(range.first, system));
+  const uint64_t last =
+      std::min(end_pair, audio_pair_offset(range.last + 1, system));
+  if (first >= last) return false;
+  if (synchronous_audio_ready_) {
+    const size_t pairs = static_cast<size_t>(last - first);
+    const std::vector<int32_t> cached = deps_->read_synchronous_pairs(
+        first, static_cast<uint32_t>(pairs));
+    std::copy_n(cached.begin(), std::min(cached.size(), pairs * 2),
+                out + (first - start_pair) * 2);
+  }
+  return first == start_pair && last == end_pair;
+}
+
 void EFMAudioChannelPairRepresentation::ensure_decoded(
     const AudioDecodeProgressFn& progress) const {
   std::call_once(decode_once_, [this, &progress] {
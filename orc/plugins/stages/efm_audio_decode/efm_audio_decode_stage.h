@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "efm_audio_decode_stage_deps_interface.h"
 
@@ -67,6 +68,21 @@ class EFMAudioChannelPairRepresentation
     return "efm_audio_channel_pair_representation";
   }
 
+  // Video samples and hints pass through unchanged, so hand out the upstream
+  // frame handle instead of the wrapper default's copy.
+  FrameHandle acquire_frame(FrameID id) const override {
+    return source_ ? source_->acquire_frame(id) : nullptr;
+  }
+  // Forward batched line reads so scans keep the source's coalesced reads.
+  bool read_lines(FrameIDRange frames, const std::vector<size_t>& lines,
+                  std::vector<sample_type>& out) const override {
+    if (!source_) {
+      out.clear();
+      return false;
+    }
+    return source_->read_lines(frames, lines, out);
+  }
+
   // --- Audio channel pairs: source pairs forward; one EFM pair is appended --
 
   size_t audio_channel_pair_count() const override {
@@ -78,6 +94,8 @@ class EFMAudioChannelPairRepresentation
 
   std::vector<int32_t> get_audio_samples(size_t pair,
                                          FrameID id) const override;
+  bool read_audio(size_t pair, uint64_t start_pair, size_t count,
+                  int32_t* out) const override;
 
   // Runs the deferred whole-stream decode now (overrides the base VFR hook),
   // forwarding its per-frame progress. Lets a sink meter the decode on its
@@ -80,6 +80,9 @@ EFMAudioDecodeResult EFMAudioDecodeDeps::decode_to_cache(
   processor.setAudioMode(true);
   processor.setNoWavHeader(true);
   processor.setNoTimecodes(options.no_timecodes);
+  // Decode the bit-level front end on every hardware thread; the output is
+  // identical to a serial decode.
+  processor.setFrontEndWorkers(0);
   processor.setNoAudioConcealment(options.no_audio_concealment);
   processor.setIgnorePreemphasis(options.ignore_preemphasis);
 
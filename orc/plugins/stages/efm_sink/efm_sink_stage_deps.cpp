@@ -57,6 +57,9 @@ EFMSinkDecodeResult EFMSinkStageDeps::decode_efm(
     EfmProcessor processor;
     processor.setAudioMode(options.audio_mode);
     processor.setNoTimecodes(options.no_timecodes);
+    // Decode the bit-level front end on every hardware thread; the output is
+    // identical to a serial decode.
+    processor.setFrontEndWorkers(0);
     processor.setAudacityLabels(options.audacity_labels);
     processor.setNoAudioConcealment(options.no_audio_concealment);
     processor.setIgnorePreemphasis(options.ignore_preemphasis);
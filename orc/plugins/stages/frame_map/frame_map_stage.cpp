@@ -9,8 +9,10 @@
 
 #include "frame_map_stage.h"
 
+#include <orc/abi/orc_plugin_services.h>
 #include <orc/stage/error_types.h>
 #include <orc/support/logging.h>
+#include <orc/support/parsed_param_cache.h>
 #include <orc/support/preview_helpers.h>
 
 #include <sstream>
@@ -27,7 +29,7 @@ FrameMappedRepresentation::FrameMappedRepresentation(
     std::shared_ptr<const VideoFrameRepresentation> source,
     std::vector<FrameID> frame_mapping,
     std::vector<PaddingDescriptor> padding_descriptors, const std::string& tag)
-    : VideoFrameRepresentationWrapper(std::move(source)),
+    : LineOverlayFrameRepresentation(std::move(source)),
       Artifact(ArtifactID("frame_map_" + tag), Provenance{}),
       frame_mapping_(std::move(frame_mapping)),
       padding_descriptors_(std::move(padding_descriptors)) {}
@@ -52,43 +54,22 @@ FrameMappedRepresentation::find_padding(FrameID output_id) const {
   return nullptr;
 }
 
-void FrameMappedRepresentation::ensure_black_frame() const {
-  if (!black_frame_.empty()) return;
-  if (!source_) return;
-  auto params = source_->get_video_parameters();
-  if (!params) return;
-  size_t total =
-      static_cast<size_t>(params->number_of_sequential_frames > 0
-                              ? params->frame_width_nominal
-                              : 0) *
-      static_cast<size_t>(params->frame_height > 0 ? params->frame_height : 0);
-  if (total == 0) {
-    // Fallback: use first real frame size
-    auto range = source_->frame_range();
-    for (FrameID fid = range.first; fid <= range.last; ++fid) {
-      auto desc = source_->get_frame_descriptor(fid);
-      if (desc) {
-        total = desc->samples_total;
-        break;
-      }
-    }
-  }
-  black_frame_.assign(total,
-                      static_cast<sample_type>(
-                          source_->get_video_parameters()->blanking_level));
-}
-
 FrameIDRange FrameMappedRepresentation::frame_range() const {
   if (frame_mapping_.empty()) return FrameIDRange{FrameID{0}, FrameID{0}};
   // FrameIDRange.last is inclusive; the last valid index is size() - 1.
   return FrameIDRange{FrameID{0}, FrameID{frame_mapping_.size() - 1}};
 }
 
-bool FrameMappedRepresentation::has_frame(FrameID id) const {
+std::optional<FrameID> FrameMappedRepresentation::source_frame_id(
+    FrameID id) const {
   auto idx = resolve_index(id);
-  if (!idx) return false;
-  if (is_padding(*idx)) return true;
-  return source_ && source_->has_frame(frame_mapping_[*idx]);
+  if (!idx || is_padding(*idx)) return std::nullopt;
+  return frame_mapping_[*idx];
+}
+
+bool FrameMappedRepresentation::is_synthetic_frame(FrameID id) const {
+  auto idx = resolve_index(id);
+  return idx && is_padding(*idx);
 }
 
 std::optional<FrameDescriptor> FrameMappedRepresentation::get_frame_descriptor(
@@ -137,145 +118,6 @@ std::optional<FrameDescriptor> FrameMappedRepresentation::get_frame_descriptor(
   return desc;
 }
 
-const VideoFrameRepresentation::sample_type*
-FrameMappedRepresentation::get_frame(FrameID id) const {
-  auto idx = resolve_index(id);
-  if (!idx) return nullptr;
-  if (is_padding(*idx)) {
-    ensure_black_frame();
-    return black_frame_.empty() ? nullptr : black_frame_.data();
-  }
-  return source_ ? source_->get_frame(frame_mapping_[*idx]) : nullptr;
-}
-
-const VideoFrameRepresentation::sample_type*
-FrameMappedRepresentation::get_line(FrameID id, size_t line) const {
-  auto idx = resolve_index(id);
-  if (!idx) return nullptr;
-  if (is_padding(*idx)) {
-    ensure_black_frame();
-    return black_frame_.empty() ? nullptr : black_frame_.data();
-  }
-  return source_ ? source_->get_line(frame_mapping_[*idx], line) : nullptr;
-}
-
-std::vector<VideoFrameRepresentation::sample_type>
-FrameMappedRepresentation::get_frame_copy(FrameID id) const {
-  auto idx = resolve_index(id);
-  if (!idx) return {};
-  if (is_padding(*idx)) {
-    ensure_black_frame();
-    return black_frame_;
-  }
-  return source_ ? source_->get_frame_copy(frame_mapping_[*idx])
-                 : std::vector<sample_type>{};
-}
-
-const VideoFrameRepresentation::sample_type*
-FrameMappedRepresentation::get_frame_luma(FrameID id) const {
-  auto idx = resolve_index(id);
-  if (!idx) return nullptr;
-  if (is_padding(*idx)) return nullptr;
-  return source_ ? source_->get_frame_luma(frame_mapping_[*idx]) : nullptr;
-}
-
-const VideoFrameRepresentation::sample_type*
-FrameMappedRepresentation::get_frame_chroma(FrameID id) const {
-  auto idx = resolve_index(id);
-  if (!idx) return nullptr;
-  if (is_padding(*idx)) return nullptr;
-  return source_ ? source_->get_frame_chroma(frame_mapping_[*idx]) : nullptr;
-}
-
-const VideoFrameRepresentation::sample_type*
-FrameMappedRepresentation::get_line_luma(FrameID id, size_t line) const {
-  auto idx = resolve_index(id);
-  if (!idx) return nullptr;
-  if (is_padding(*idx)) return nullptr;
-  return source_ ? source_->get_line_luma(frame_mapping_[*idx], line) : nullptr;
-}
-
-const VideoFrameRepresentation::sample_type*
-FrameMappedRepresentation::get_line_chroma(FrameID id, size_t line) const {
-  auto idx = resolve_index(id);
-  if (!idx) return nullptr;
-  if (is_padding(*idx)) return nullptr;
-  return source_ ? source_->get_line_chroma(frame_mapping_[*idx], line)
-                 : nullptr;
-}
-
-std::vector<DropoutRun> FrameMappedRepresentation::get_dropout_hints(
-    FrameID id) const {
-  auto idx = resolve_index(id);
-  if (!idx) return {};
-  if (is_padding(*idx)) return {};
-  if (!source_) return {};
-  // Rewrite frame IDs so the runs describe this representation's frame, not
-  // the source frame they were mapped from (consumers such as dropout_map
-  // may rely on the frame_id field).
-  auto runs = source_->get_dropout_hints(frame_mapping_[*idx]);
-  for (auto& run : runs) {
-    run.frame_id = id;
-  }
-  return runs;
-}
-
-std::vector<int32_t> FrameMappedRepresentation::get_audio_samples(
-    size_t pair, FrameID id) const {
-  auto idx = resolve_index(id);
-  if (!idx || !source_) return {};
-  if (pair >= source_->audio_channel_pair_count()) return {};
-
-  const auto params = source_->get_video_parameters();
-  const VideoSystem system = params ? params->system : VideoSystem::Unknown;
-  // Every output frame must serve exactly audio_pairs_in_frame(id) stereo
-  // pairs regardless of the mapped source frame's native count.
-  const size_t out_pairs = audio_pairs_in_frame(id, system);
-
-  if (is_padding(*idx)) {
-    // Padding frames carry cadence-sized silence.
-    return std::vector<int32_t>(out_pairs * 2, 0);
-  }
-
-  auto samples = source_->get_audio_samples(pair, frame_mapping_[*idx]);
-  if (samples.empty() || out_pairs == 0) return samples;
-  // SMPTE 272M-1994 §14.3: NTSC/PAL-M frames carry 1602 or 1601 stereo pairs
-  // by position in the five-frame audio sequence. A mapping that breaks the
-  // sequence phase changes the required count by one pair — truncate one
-  // trailing pair or append one trailing silence pair. Phase-preserving
-  // mappings and all PAL mappings leave the window untouched.
-  samples.resize(out_pairs * 2, 0);
-  return samples;
-}
-
-uint32_t FrameMappedRepresentation::get_efm_sample_count(FrameID id) const {
-  auto idx = resolve_index(id);
-  if (!idx || is_padding(*idx)) return 0;
-  return source_ ? source_->get_efm_sample_count(frame_mapping_[*idx]) : 0;
-}
-
-std::vector<uint8_t> FrameMappedRepresentation::get_efm_samples(
-    FrameID id) const {
-  auto idx = resolve_index(id);
-  if (!idx || is_padding(*idx)) return {};
-  return source_ ? source_->get_efm_samples(frame_mapping_[*idx])
-                 : std::vector<uint8_t>{};
-}
-
-uint32_t FrameMappedRepresentation::get_ac3_symbol_count(FrameID id) const {
-  auto idx = resolve_index(id);
-  if (!idx || is_padding(*idx)) return 0;
-  return source_ ? source_->get_ac3_symbol_count(frame_mapping_[*idx]) : 0;
-}
-
-std::vector<uint8_t> FrameMappedRepresentation::get_ac3_symbols(
-    FrameID id) const {
-  auto idx = resolve_index(id);
-  if (!idx || is_padding(*idx)) return {};
-  return source_ ? source_->get_ac3_symbols(frame_mapping_[*idx])
-                 : std::vector<uint8_t>{};
-}
-
 // ============================================================================
 // FrameMapStage
 // ============================================================================
@@ -565,8 +407,8 @@ std::vector<ArtifactPtr> FrameMapStage::execute(
 
   // Build initial frame mapping from range specification
   std::vector<FrameID> mapping;
-  if (!range_spec_.empty() && !cached_ranges_.empty()) {
-    mapping = build_frame_mapping(cached_ranges_, *source);
+  if (!range_spec_.empty() && cached_ranges_) {
+    mapping = build_frame_mapping(*cached_ranges_, *source);
     if (mapping.empty()) {
       ORC_LOG_WARN("FrameMapStage: range spec produced empty mapping");
       cached_output_ = source;
@@ -627,7 +469,7 @@ std::vector<ArtifactPtr> FrameMapStage::execute(
 
 std::vector<ParameterDescriptor> FrameMapStage::get_parameter_descriptors(
     VideoSystem /*project_format*/, SourceType /*source_type*/) const {
-  return {
+  std::vector<ParameterDescriptor> descriptors = {
       ParameterDescriptor{
           "ranges", "Frame Ranges",
           "Comma-separated frame ranges, 1-based as shown in the preview "
@@ -671,6 +513,9 @@ std::vector<ParameterDescriptor> FrameMapStage::get_parameter_descriptors(
                                false,
                                std::nullopt}},
   };
+  // A disc mapped from a damaged capture can need thousands of ranges.
+  descriptors[0].blob_storage = true;
+  return descriptors;
 }
 
 std::map<std::string, ParameterValue> FrameMapStage::get_parameters() const {
@@ -687,14 +532,21 @@ bool FrameMapStage::set_parameters(
       if (auto* v = std::get_if<std::string>(&value)) {
         range_spec_ = *v;
         if (!range_spec_.empty()) {
-          cached_ranges_ = parse_ranges(range_spec_);
-          if (cached_ranges_.empty()) {
-            ORC_LOG_ERROR("FrameMapStage: invalid range spec '{}'",
-                          range_spec_);
+          // Every DAG rebuild creates a new stage instance; the cache parses
+          // each range spec once for all of them.
+          static ParsedParamCache<std::vector<std::pair<uint64_t, uint64_t>>>
+              parsed_ranges;
+          cached_ranges_ = parsed_ranges.get(
+              range_spec_, plugin::get_blob_store(), &parse_ranges);
+          if (!cached_ranges_ || cached_ranges_->empty()) {
+            ORC_LOG_ERROR(
+                "FrameMapStage: invalid or unavailable range spec '{}'",
+                range_spec_);
+            cached_ranges_.reset();
             return false;
           }
         } else {
-          cached_ranges_.clear();
+          cached_ranges_.reset();
         }
       } else {
         return false;
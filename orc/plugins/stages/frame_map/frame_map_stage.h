@@ -13,6 +13,7 @@
 #include <orc/plugin/orc_stage_runtime.h>
 #include <orc/stage/frame_descriptor.h>
 #include <orc/stage/frame_id.h>
+#include <orc/stage/line_overlay_representation.h>
 #include <orc/stage/params/stage_parameter.h>
 #include <orc/stage/video_frame_representation.h>
 
@@ -29,14 +30,16 @@ namespace orc {
 // ============================================================================
 // FrameMappedRepresentation
 // ============================================================================
-// VideoFrameRepresentationWrapper that presents frames in a user-specified
+// LineOverlayFrameRepresentation that presents frames in a user-specified
 // order without copying sample data.  Each output FrameID maps to a source
-// FrameID through a lookup table built at stage execute() time.
+// FrameID through a lookup table built at stage execute() time; the base
+// translates every per-frame accessor (samples, hints, audio, EFM, AC3).
 //
 // Padding frames (is_padding_frame == true) are synthesised with a descriptor
-// derived from the source's video parameters; their sample data comes from a
-// single black frame whose layout matches the source geometry.
-class FrameMappedRepresentation : public VideoFrameRepresentationWrapper,
+// derived from the source's video parameters; their sample data comes from
+// the base's single blanking-level frame whose layout matches the source
+// geometry, and their audio is cadence-sized silence.
+class FrameMappedRepresentation : public LineOverlayFrameRepresentation,
                                   public Artifact {
  public:
   struct PaddingDescriptor {
@@ -63,50 +66,17 @@ class FrameMappedRepresentation : public VideoFrameRepresentationWrapper,
   // Navigation
   FrameIDRange frame_range() const override;
   size_t frame_count() const override { return frame_mapping_.size(); }
-  bool has_frame(FrameID id) const override;
   std::optional<FrameDescriptor> get_frame_descriptor(
       FrameID id) const override;
 
-  // Flat access — delegate to source via mapped ID; return black for padding
-  const sample_type* get_frame(FrameID id) const override;
-  const sample_type* get_line(FrameID id, size_t line) const override;
-  std::vector<sample_type> get_frame_copy(FrameID id) const override;
-
-  // YC
-  bool has_separate_channels() const override {
-    return source_ ? source_->has_separate_channels() : false;
-  }
-  const sample_type* get_frame_luma(FrameID id) const override;
-  const sample_type* get_frame_chroma(FrameID id) const override;
-  const sample_type* get_line_luma(FrameID id, size_t line) const override;
-  const sample_type* get_line_chroma(FrameID id, size_t line) const override;
-
-  // Hints
-  std::vector<DropoutRun> get_dropout_hints(FrameID id) const override;
-  std::optional<SourceParameters> get_video_parameters() const override {
-    return source_ ? source_->get_video_parameters() : std::nullopt;
-  }
-
-  // Audio — channel pairs remap in lockstep with the frame mapping; pair
-  // count and descriptors forward from the source via the wrapper base.
-  // Every output frame p serves exactly audio_pairs_in_frame(p) stereo
-  // pairs: padding frames carry cadence-sized silence, and a mapping that
-  // breaks the NTSC/PAL-M five-frame audio sequence phase
-  // (SMPTE 272M-1994 §14.3) truncates one trailing pair or appends one
-  // trailing silence pair. Phase-preserving mappings and all PAL mappings
-  // are sample-exact.
-  std::vector<int32_t> get_audio_samples(size_t pair,
-                                         FrameID id) const override;
-
-  // EFM / AC3
-  bool has_efm() const override { return source_ ? source_->has_efm() : false; }
-  uint32_t get_efm_sample_count(FrameID id) const override;
-  std::vector<uint8_t> get_efm_samples(FrameID id) const override;
-  bool has_ac3_rf() const override {
-    return source_ ? source_->has_ac3_rf() : false;
-  }
-  uint32_t get_ac3_symbol_count(FrameID id) const override;
-  std::vector<uint8_t> get_ac3_symbols(FrameID id) const override;
+ protected:
+  // Audio: a mapping that breaks the NTSC/PAL-M five-frame audio sequence
+  // phase (SMPTE 272M-1994 §14.3) truncates one trailing pair or appends one
+  // trailing silence pair (see the base). Phase-preserving mappings and all
+  // PAL mappings are sample-exact.
+  std::optional<FrameID> source_frame_id(FrameID id) const override;
+  bool is_synthetic_frame(FrameID id) const override;
+  bool has_overlay(FrameID /*id*/) const override { return false; }
 
  private:
   // Maps output index (0-based) → source FrameID.
@@ -120,10 +90,6 @@ class FrameMappedRepresentation : public VideoFrameRepresentationWrapper,
   std::optional<size_t> resolve_index(FrameID id) const;
   bool is_padding(size_t index) const;
   const PaddingDescriptor* find_padding(FrameID output_id) const;
-
-  // Black sample buffer for padding frames
-  mutable std::vector<sample_type> black_frame_;
-  void ensure_black_frame() const;
 };
 
 // ============================================================================
@@ -218,13 +184,14 @@ class FrameMapStage : public DAGStage,
   static int next_colour_index(int current, VideoSystem sys);
 
   // Current parameters
-  std::string range_spec_;
+  std::string range_spec_;  // Inline text or blob reference
   bool remove_duplicates_ = false;
   bool pad_gaps_ = false;
   std::string pad_strategy_ = "black";
 
-  // Cached parsed ranges
-  std::vector<std::pair<uint64_t, uint64_t>> cached_ranges_;
+  // Parsed ranges, shared by every instance with the same range_spec_
+  std::shared_ptr<const std::vector<std::pair<uint64_t, uint64_t>>>
+      cached_ranges_;
 
   // Cached output for preview rendering
   mutable std::shared_ptr<const VideoFrameRepresentation> cached_output_;
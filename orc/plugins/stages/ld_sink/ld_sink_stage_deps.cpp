@@ -48,6 +48,13 @@ inline uint16_t cvbs_to_tbc(int16_t cvbs, int32_t tbc_blanking,
   return static_cast<uint16_t>(std::max(0, std::min(65535, result)));
 }
 
+// Samples per TBC line: the nominal line width (PAL's extra sample dropped).
+int32_t tbc_line_width(VideoSystem sys) {
+  if (sys == VideoSystem::PAL) return kPalSamplesPerLineNominal;  // 1135
+  if (sys == VideoSystem::PAL_M) return kPalMSamplesPerLine;
+  return kNtscSamplesPerLine;
+}
+
 // Split a DropoutRun (frame-flat coordinates) into per-field DropoutInfo
 // entries and append them to the appropriate output vectors.
 // tbc_f1_dropouts ← entries that belong to TBC field 1 (is_first_field=true)
@@ -134,7 +141,21 @@ bool LDSinkStageDeps::write_tbc_and_metadata(
     ORC_LOG_DEBUG("Opening TBC file for writing: {}", final_tbc_path);
     ORC_LOG_DEBUG("Opening metadata database: {}", db_path);
 
-    // Open TBC writer (16 MB buffer).
+    // Retrieve source parameters for TBC-domain signal levels; they also fix
+    // the TBC file size, so it can be preallocated.
+    auto video_params = representation->get_video_parameters();
+
+    // Open TBC writer: 16 MB buffers written out on a host I/O thread, so
+    // field conversion overlaps with the disk.
+    AsyncFileWriterOptions writer_options;
+    writer_options.buffer_size = 16UL * 1024 * 1024;
+    if (video_params) {
+      writer_options.expected_size =
+          static_cast<uint64_t>(expected_field_count) *
+          calculate_padded_field_height(video_params->system) *
+          static_cast<uint64_t>(tbc_line_width(video_params->system)) *
+          sizeof(uint16_t);
+    }
     std::shared_ptr<IFileWriter<uint16_t>> tbc_writer;
     if (stage_services_) {
       class FileWriter16Adapter final : public IFileWriter<uint16_t> {
@@ -170,8 +191,8 @@ bool LDSinkStageDeps::write_tbc_and_metadata(
         std::string path_;
       };
 
-      auto writer16 = stage_services_->create_buffered_file_writer_uint16(
-          static_cast<size_t>(16 * 1024 * 1024));
+      auto writer16 =
+          stage_services_->create_async_file_writer_uint16(writer_options);
       if (writer16) {
         tbc_writer = std::make_shared<FileWriter16Adapter>(writer16);
       }
@@ -192,8 +213,6 @@ bool LDSinkStageDeps::write_tbc_and_metadata(
       return false;
     }
 
-    // Retrieve source parameters for TBC-domain signal levels.
-    auto video_params = representation->get_video_parameters();
     if (!video_params) {
       ORC_LOG_ERROR("No video parameters available");
       metadata_writer_->close();
@@ -222,19 +241,17 @@ bool LDSinkStageDeps::write_tbc_and_metadata(
     const size_t padded_lines = calculate_padded_field_height(sys);
 
     // Signal geometry.
-    int32_t frame_lines_total, field1_cvbs_line_count, nominal_line_width;
+    const int32_t nominal_line_width = tbc_line_width(sys);
+    int32_t frame_lines_total, field1_cvbs_line_count;
     if (sys == VideoSystem::PAL) {
       frame_lines_total = kPalFrameLines;
       field1_cvbs_line_count = kPalField1Lines;
-      nominal_line_width = kPalSamplesPerLineNominal;  // 1135
     } else if (sys == VideoSystem::PAL_M) {
       frame_lines_total = kPalMFrameLines;
       field1_cvbs_line_count = kPalMField1Lines;
-      nominal_line_width = kPalMSamplesPerLine;
     } else {
       frame_lines_total = kNtscFrameLines;
       field1_cvbs_line_count = kNtscField1Lines;
-      nominal_line_width = kNtscSamplesPerLine;
     }
 
     // Store total frame count; the writer derives number_of_sequential_fields
@@ -13,13 +13,13 @@
 #include <orc/plugin/orc_stage_runtime.h>
 #include <orc/plugin/orc_stage_tooling.h>
 #include <orc/stage/artifact.h>
+#include <orc/stage/line_overlay_representation.h>
 #include <orc/stage/params/stage_parameter.h>
 #include <orc/stage/video_frame_representation.h>
 
 #include <cstdint>
 #include <map>
 #include <memory>
-#include <mutex>
 #include <vector>
 
 namespace orc {
@@ -35,7 +35,12 @@ namespace orc {
 //   "21,334-336" – mask line 21 and lines 334-336
 //
 // Mask value is a 10-bit sample level (0–1023, CVBS_U10_4FSC domain).
-class MaskedFrameRepresentation : public VideoFrameRepresentationWrapper,
+//
+// Only the masked lines are rendered: unmasked lines and frames come straight
+// from the source, and flat frames containing masked lines are materialised
+// into the line-overlay base's bounded cache (see
+// line_overlay_representation.h).
+class MaskedFrameRepresentation : public LineOverlayFrameRepresentation,
                                   public Artifact {
  public:
   MaskedFrameRepresentation(
@@ -46,14 +51,11 @@ class MaskedFrameRepresentation : public VideoFrameRepresentationWrapper,
     return "masked_frame_representation";
   }
 
-  const sample_type* get_frame(FrameID id) const override;
-  const sample_type* get_frame_luma(FrameID id) const override;
-  const sample_type* get_frame_chroma(FrameID id) const override;
-  const sample_type* get_line(FrameID id, size_t line) const override;
-  std::vector<sample_type> get_frame_copy(FrameID id) const override;
-
-  const sample_type* get_line_luma(FrameID id, size_t line) const override;
-  const sample_type* get_line_chroma(FrameID id, size_t line) const override;
+ protected:
+  bool overlays_line(FrameID id, size_t line) const override;
+  void render_overlay_line(FrameID id, size_t line, Plane plane,
+                           sample_type* out, size_t count) const override;
+  bool has_overlay(FrameID id) const override;
 
  private:
   struct LineRange {
@@ -66,20 +68,6 @@ class MaskedFrameRepresentation : public VideoFrameRepresentationWrapper,
 
   std::vector<LineRange> line_ranges_;
   int32_t mask_sample_level_;
-
-  mutable std::vector<int16_t> masked_line_buffer_;
-  mutable std::vector<int16_t> masked_luma_buffer_;
-  mutable std::vector<int16_t> masked_chroma_buffer_;
-
-  // Frame-level caches for get_frame() / get_frame_luma() / get_frame_chroma().
-  // The chroma sink reads flat frame buffers via these pointer-returning
-  // methods, so the masking must be applied here as well as in the line-level
-  // accessors.
-  mutable std::mutex frame_cache_mutex_;
-  mutable std::map<FrameID, std::vector<sample_type>> masked_frame_cache_;
-  mutable std::map<FrameID, std::vector<sample_type>> masked_luma_frame_cache_;
-  mutable std::map<FrameID, std::vector<sample_type>>
-      masked_chroma_frame_cache_;
 };
 
 // ============================================================================
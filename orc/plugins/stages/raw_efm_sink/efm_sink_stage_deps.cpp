@@ -41,10 +41,14 @@ RawEFMSinkWriteResult RawEFMSinkStageDeps::write_raw_efm(
     return {false, 0, "Error: No EFM t-values found in frame range"};
   }
 
+  // One byte per t-value, so the output size is known up front.
+  AsyncFileWriterOptions writer_options;
+  writer_options.buffer_size = 4UL * 1024 * 1024;
+  writer_options.expected_size = total_tvalues;
+
   std::shared_ptr<IFileWriterUint8> writer;
   if (stage_services_) {
-    writer = stage_services_->create_buffered_file_writer_uint8(
-        static_cast<size_t>(4 * 1024 * 1024));
+    writer = stage_services_->create_async_file_writer_uint8(writer_options);
   }
   if (!writer) {
     return {false, 0, "Error: File writer service unavailable"};
@@ -256,8 +256,10 @@ void Comb::decodeFramesComposite(const std::vector<SourceField>& inputFields,
       // Extract chroma using 1D filter
       nextFrameBuffer->split1D();
 
-      // Extract chroma using 2D filter
-      nextFrameBuffer->split2D();
+      // Extract chroma using 2D filter (only read by 2D and 3D decoding)
+      if (configuration.dimensions > 1) {
+        nextFrameBuffer->split2D();
+      }
     }
 
     if (fieldIndex < startIndex) {
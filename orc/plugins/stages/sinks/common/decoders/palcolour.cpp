@@ -465,8 +465,10 @@ void PalColour::apply2DChromaFilter(const SourceField& inputField,
   // Apply 2D filters to get U and V components
   double pu[MAX_WIDTH], qu[MAX_WIDTH], pv[MAX_WIDTH], qv[MAX_WIDTH];
   const auto endPos = std::min(videoParameters.active_video_end, MAX_WIDTH);
+  const int32_t step = std::max(configuration.horizontalStep, 1);
+  const int32_t firstDecoded = firstDecodedSample();
 
-  for (int32_t i = videoParameters.active_video_start; i < endPos; i++) {
+  for (int32_t i = firstDecoded; i < endPos; i += step) {
     double PU = 0, QU = 0, PV = 0, QV = 0;
 
     // Apply 2D filter coefficients
@@ -501,7 +503,7 @@ void PalColour::apply2DChromaFilter(const SourceField& inputField,
   // Rotate filtered quadrature components by burst phase to recover U and V
   // Apply V-switch for PAL alternating lines
   // Multiply by 2.0 because filtering extracts chroma at half amplitude
-  for (int32_t i = videoParameters.active_video_start; i < endPos; i++) {
+  for (int32_t i = firstDecoded; i < endPos; i += step) {
     int32_t outIdx = videoParameters.active_area_cropping_applied
                          ? (i - videoParameters.active_video_start)
                          : i;
@@ -511,6 +513,15 @@ void PalColour::apply2DChromaFilter(const SourceField& inputField,
   }
 }
 
+int32_t PalColour::firstDecodedSample() const {
+  const int32_t start = videoParameters.active_video_start;
+  const int32_t step = configuration.horizontalStep;
+  if (step <= 1 || videoParameters.active_area_cropping_applied) {
+    return start;
+  }
+  return (start + step - 1) / step * step;
+}
+
 PalColour::LineInfo::LineInfo(int32_t _number) : number(_number) {}
 
 // Detect the colourburst on a line.
@@ -713,6 +724,8 @@ void PalColour::decodeLine(const SourceField& inputField,
   if (endPos < videoParameters.active_video_end) {
     ORC_LOG_WARN("Tried to decode video outside max width!");
   }
+  const int32_t step = std::max(configuration.horizontalStep, 1);
+  const int32_t firstDecoded = firstDecodedSample();
 
   double pu[MAX_WIDTH], qu[MAX_WIDTH], pv[MAX_WIDTH], qv[MAX_WIDTH],
       py[MAX_WIDTH], qy[MAX_WIDTH];
@@ -788,7 +801,7 @@ void PalColour::decodeLine(const SourceField& inputField,
       n[3][i] = (-(static_cast<double>(in5[i])) + in6[i]) * cosine[i];
     }
 
-    for (int32_t i = videoParameters.active_video_start; i < endPos; i++) {
+    for (int32_t i = firstDecoded; i < endPos; i += step) {
       double PU = 0, QU = 0, PV = 0, QV = 0, PY = 0, QY = 0;
 
       for (int32_t b = 0; b <= FILTER_SIZE; b++) {
@@ -841,7 +854,7 @@ void PalColour::decodeLine(const SourceField& inputField,
   double* outU = componentFrame.u(lineNumber);
   double* outV = componentFrame.v(lineNumber);
 
-  for (int32_t i = videoParameters.active_video_start; i < endPos; i++) {
+  for (int32_t i = firstDecoded; i < endPos; i += step) {
     int32_t outIdx = videoParameters.active_area_cropping_applied
                          ? (i - videoParameters.active_video_start)
                          : i;
@@ -867,7 +880,9 @@ void PalColour::decodeLine(const SourceField& inputField,
     outV[outIdx] = line.Vsw * -(qv[i] * line.bp - pv[i] * line.bq) * 2.0;
   }
 
-  if (configuration.yNRLevel > 0.0) {
+  // YNR filters across neighbouring samples, which a stepped decode leaves
+  // black, so it is skipped there.
+  if (configuration.yNRLevel > 0.0 && step == 1) {
     doYNR(outY);
   }
 }
@@ -49,6 +49,12 @@ class PalColour {
     ChromaFilterMode chromaFilter = palColourFilter;
     double transformThreshold = 0.4;
     std::vector<double> transformThresholds;
+    // Decode only every Nth sample of each active line: those whose output
+    // index (frame x, or x from the active start when cropping is applied)
+    // is a multiple of N. The others are left black, and composite luma
+    // noise reduction is skipped. Draft previews use this to avoid running
+    // the chroma filter for samples they discard.
+    int32_t horizontalStep = 1;
     bool showFFTs = false;
     int32_t showPositionX = 200;
     int32_t showPositionY = 200;
@@ -101,6 +107,8 @@ class PalColour {
                            int32_t fieldLine, int32_t firstLine,
                            int32_t lastLine, double* outU, double* outV);
   void doYNR(double* Yline);
+  // First active sample decoded under configuration.horizontalStep.
+  int32_t firstDecodedSample() const;
 
   // Configuration parameters
   bool configurationSet;
@@ -1801,17 +1801,24 @@ bool FFmpegOutputBackend::setupAudioEncoderForPair(AudioPairEncoder& pair) {
   return true;
 }
 
-std::vector<int32_t> FFmpegOutputBackend::gatherAudioForFrame(
-    AudioPairEncoder& pair, FrameID frame_id) {
-  std::vector<int32_t> carrier =
-      vfr_->get_audio_samples(pair.pair_index, frame_id);
-  if (carrier.empty()) {
-    // No audio for this frame — cadence-sized silence maintains A/V sync
-    // (SMPTE 272M-1994 §14.3 audio frame sequence).
-    const uint32_t pair_count = audio_pairs_in_frame(frame_id, video_system_);
-    return std::vector<int32_t>(static_cast<size_t>(pair_count) * 2, 0);
-  }
-  return carrier;
+void FFmpegOutputBackend::appendAudioForFrame(AudioPairEncoder& pair,
+                                              FrameID frame_id) {
+  // Silence where the input has no audio maintains A/V sync
+  // (SMPTE 272M-1994 §14.3 audio frame sequence).
+  const size_t pair_count = audio_pairs_in_frame(frame_id, video_system_);
+  const size_t old_size = pair.buffer.size();
+  pair.buffer.resize(old_size + pair_count * 2);
+  int32_t* samples = pair.buffer.data() + old_size;
+  vfr_->read_audio(pair.pair_index, audio_pair_offset(frame_id, video_system_),
+                   pair_count, samples);
+
+  // Apply the configured gain in the 24-bit carrier domain, saturating at
+  // full scale. Silence stays silence, so gain-adjusted padding is fine too.
+  if (audio_gain_ != 1.0) {
+    for (size_t i = 0; i < pair_count * 2; ++i) {
+      samples[i] = audio_apply_gain(samples[i], audio_gain_);
+    }
+  }
 }
 
 bool FFmpegOutputBackend::sendAudioFrame(AudioPairEncoder& pair,
@@ -1900,18 +1907,7 @@ bool FFmpegOutputBackend::encodeAudioForFrame() {
     const orc::FrameID frame_id = current_field_for_audio_ / 2;
 
     for (AudioPairEncoder& pair : audio_encoders_) {
-      auto samples = gatherAudioForFrame(pair, frame_id);
-
-      // Apply the configured gain in the 24-bit carrier domain, saturating
-      // at full scale. Silence stays silence, so gain-adjusted padding is
-      // fine too.
-      if (audio_gain_ != 1.0) {
-        for (auto& sample : samples) {
-          sample = audio_apply_gain(sample, audio_gain_);
-        }
-      }
-
-      pair.buffer.insert(pair.buffer.end(), samples.begin(), samples.end());
+      appendAudioForFrame(pair, frame_id);
     }
     current_field_for_audio_ += 2;  // Advance by 2 fields (= 1 frame)
   }
@@ -162,12 +162,12 @@ class FFmpegOutputBackend : public OutputBackend {
   // (audio_channel_pairs_option_).
   bool setupAudioEncoders();
   bool setupAudioEncoderForPair(AudioPairEncoder& pair);
-  // Gather one video frame's worth of 24-bit-in-int32 carrier samples for
-  // the given channel pair; frames without audio yield cadence-sized silence
+  // Append one video frame's worth of 24-bit-in-int32 carrier samples for
+  // the given channel pair to its pending buffer, read in place with
+  // read_audio(); pairs without audio are cadence-sized silence
   // (audio_pairs_in_frame()). Conversion to the encoder's sample format
   // happens at encode time (audio_sample_feed.h).
-  std::vector<int32_t> gatherAudioForFrame(AudioPairEncoder& pair,
-                                           FrameID frame_id);
+  void appendAudioForFrame(AudioPairEncoder& pair, FrameID frame_id);
   // Encode full encoder-frame-size chunks from the pair's pending buffer.
   bool encodeBufferedAudio(AudioPairEncoder& pair);
   // Send one audio frame (nullptr flushes) and write the resulting packets.
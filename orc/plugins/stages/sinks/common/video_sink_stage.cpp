@@ -11,7 +11,9 @@
 
 #include <orc/abi/orc_plugin_services.h>
 #include <orc/stage/cvbs_signal_constants.h>
+#include <orc/stage/metrics.h>
 #include <orc/stage/observation/observation_service_interface.h>
+#include <orc/stage/trace.h>
 #include <orc/support/colour_preview_conversion.h>
 #include <orc/support/frame_line_util.h>
 #include <orc/support/logging.h>
@@ -34,7 +36,6 @@
 #include <atomic>
 #include <chrono>
 #include <cmath>
-#include <deque>
 #include <fstream>
 #include <mutex>
 #include <thread>
@@ -68,6 +69,21 @@ chroma_sink::DecoderVideoProfile decoder_video_profile_for_type(
   return chroma_sink::DecoderVideoProfile::NtscColour;
 }
 
+// Decoder for draft previews: a single-frame decoder from the configured
+// decoder's family. PAL drafts use pal2d (skipping Transform PAL's FFTs) at a
+// horizontal step of kDraftColourPreviewDecimation; NTSC drafts use the 1D
+// comb, whose per-sample cost is a few taps.
+std::string draft_decoder_type(const std::string& decoder_type) {
+  if (decoder_type == "transform2d" || decoder_type == "transform3d") {
+    return "pal2d";
+  }
+  if (decoder_type == "ntsc2d" || decoder_type == "ntsc3d" ||
+      decoder_type == "ntsc3dnoadapt") {
+    return "ntsc1d";
+  }
+  return decoder_type;
+}
+
 // Decode parameters carried from the stage into the decoder factory, so the
 // factory does not reach back into VideoSinkStage.
 struct DecoderParams {
@@ -80,6 +96,7 @@ struct DecoderParams {
   double transformThreshold;
   double chromaWeight;
   double adaptThreshold;
+  int32_t horizontalStep = 1;
 };
 
 // Build the decoder for an already-resolved decoder_type (the caller has
@@ -112,6 +129,7 @@ std::unique_ptr<Decoder> make_decoder(const std::string& decoder_type,
     config.yNRLevel = params.lumaNr;
     config.simplePAL = params.simplePal;
     config.transformThreshold = params.transformThreshold;
+    config.horizontalStep = params.horizontalStep;
     config.showFFTs = false;
     if (decoder_type == "transform3d") {
       config.chromaFilter = PalColour::transform3DFilter;
@@ -181,6 +199,14 @@ bool apply_decoder_safe_video_parameters(
   return true;
 }
 
+// Serialises building and destroying colour preview decoders, which happens
+// on several threads at once (the preview lanes and decode sessions); FFTW
+// planning in the Transform PAL factory is not thread-safe.
+std::mutex& preview_decoder_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
 bool is_raw_output_format(const std::string& format) {
   return format == "rgb" || format == "yuv" || format == "y4m";
 }
@@ -1666,6 +1692,25 @@ bool VideoSinkStage::run_export_trigger(
   std::atomic<int32_t> nextFrameToWrite{0};
   std::mutex outputMutex;  // Protects backend writes and frame buffering
 
+  // Live metrics: frames written, per-frame decode time, and decoded frames
+  // held back until every earlier frame has been written.
+  IMetricsRegistry* metrics = plugin::get_metrics();
+  IMetricCounter* framesWritten =
+      metrics ? metrics->counter("orc_sink_frames_total",
+                                 "Frames written by sinks", "sink=video_sink")
+              : nullptr;
+  IMetricHistogram* decodeSeconds =
+      metrics ? metrics->histogram("orc_sink_frame_decode_seconds",
+                                   "Per-frame chroma decode time",
+                                   "sink=video_sink")
+              : nullptr;
+  IMetricGauge* queueDepth =
+      metrics ? metrics->gauge("orc_sink_queue_depth",
+                               "Decoded frames waiting to be written in order",
+                               "sink=video_sink")
+              : nullptr;
+  int32_t queuedFrames = 0;  // guarded by outputMutex
+
   // CRITICAL: FFTW plan creation with FFTW_MEASURE is NOT thread-safe
   // (see FFTW docs: http://www.fftw.org/fftw3_doc/Thread-safety.html)
   // We must serialize all decoder instantiations that create FFTW plans
@@ -1673,6 +1718,7 @@ bool VideoSinkStage::run_export_trigger(
 
   // Worker thread function - each worker creates its own decoder instance.
   auto workerFunc = [&]() {
+    ITracer* tracer = plugin::get_tracer();
     // Transform PAL builds FFTW plans in the factory (FFTW_MEASURE is not
     // thread-safe), so serialise construction across workers.
     std::unique_ptr<Decoder> threadDecoder;
@@ -1700,10 +1746,9 @@ bool VideoSinkStage::run_export_trigger(
       // SourceFields.
       std::vector<SourceField> frameFields;
 
-      // Owned buffers backing every SourceField (blank padding and copies of
-      // VFrameR frame data); must outlive frameFields. Use a deque so that
-      // push_back never invalidates existing data() pointers.
-      std::deque<std::vector<int16_t>> ownedFieldBuffers;
+      // Buffers backing every SourceField (blank padding and VFrameR frame
+      // data held through acquire_frame()); must outlive frameFields.
+      std::vector<orc::SharedSampleBuffer> ownedFieldBuffers;
 
       // The actual frame number we're processing
       int32_t actualFrameNum = static_cast<int32_t>(start_frame) + frameIdx;
@@ -1748,8 +1793,10 @@ bool VideoSinkStage::run_export_trigger(
       // ownedFieldBuffers
       auto makeBlankField = [&](bool is_first_field) -> SourceField {
         size_t samples = fieldSampleCount(is_first_field);
-        ownedFieldBuffers.emplace_back(samples, blankingLevel);
-        const int16_t* buf = ownedFieldBuffers.back().data();
+        ownedFieldBuffers.push_back(
+            std::make_shared<const std::vector<int16_t>>(samples,
+                                                         blankingLevel));
+        const int16_t* buf = ownedFieldBuffers.back()->data();
 
         SourceField sf;
         sf.is_first_field = is_first_field;
@@ -1795,17 +1842,21 @@ bool VideoSinkStage::run_export_trigger(
         return sf;
       };
 
-      for (int32_t i = copyStartIdx; i < copyEndIdx; i++) {
-        const auto& fi = frameInfoList[i];
-
-        if (fi.use_blank ||
-            !appendSourceFields(vfr.get(), fi.frame_id, videoParams,
-                                ownedFieldBuffers, frameFields)) {
-          // Blank padding, or the frame unexpectedly had no data; substitute
-          // black fields so the window keeps two fields per frame and the
-          // target frame stays at the expected Z-position.
-          frameFields.push_back(makeBlankField(true));
-          frameFields.push_back(makeBlankField(false));
+      {
+        ORC_TRACE_FRAME_SCOPE(tracer, "sink", "load_fields", "video_sink",
+                              actualFrameNum);
+        for (int32_t i = copyStartIdx; i < copyEndIdx; i++) {
+          const auto& fi = frameInfoList[i];
+
+          if (fi.use_blank ||
+              !appendSourceFields(vfr.get(), fi.frame_id, videoParams,
+                                  ownedFieldBuffers, frameFields)) {
+            // Blank padding, or the frame unexpectedly had no data;
+            // substitute black fields so the window keeps two fields per
+            // frame and the target frame stays at the expected Z-position.
+            frameFields.push_back(makeBlankField(true));
+            frameFields.push_back(makeBlankField(false));
+          }
         }
       }
 
@@ -1846,17 +1897,25 @@ bool VideoSinkStage::run_export_trigger(
 
       // Decode this ONE frame using the thread-local decoder.  Y/C splitting
       // and luma merge happen inside the decoder for Y/C sources.
-      threadDecoder->decodeFrames(frameFields, frameStartIndex, frameEndIndex,
-                                  singleOutput);
+      {
+        ORC_TRACE_FRAME_SCOPE(tracer, "sink", "chroma_decode", "video_sink",
+                              actualFrameNum);
+        MetricTimer decodeTimer(decodeSeconds);
+        threadDecoder->decodeFrames(frameFields, frameStartIndex,
+                                    frameEndIndex, singleOutput);
+      }
 
       // Store the result in the buffer
       {
         std::lock_guard<std::mutex> lock(outputMutex);
         outputFrames[frameIdx] = singleOutput[0];
+        ++queuedFrames;
 
         // Write completed frames to backend in sequential order
         while (nextFrameToWrite < numFrames &&
                outputFrames[nextFrameToWrite].has_value()) {
+          ORC_TRACE_FRAME_SCOPE(tracer, "sink", "backend_write", "video_sink",
+                                start_frame + nextFrameToWrite.load());
           if (!backend->writeFrame(*outputFrames[nextFrameToWrite])) {
             int32_t failedFrame = nextFrameToWrite.load();
             ORC_LOG_ERROR("VideoSink: Failed to write frame {}", failedFrame);
@@ -1866,7 +1925,10 @@ bool VideoSinkStage::run_export_trigger(
           // Free the frame memory immediately after writing
           outputFrames[nextFrameToWrite].reset();
           nextFrameToWrite++;
+          --queuedFrames;
+          if (framesWritten) framesWritten->add(1);
         }
+        if (queueDepth) queueDepth->set(queuedFrames);
       }
 
       // Update progress
@@ -1891,6 +1953,7 @@ bool VideoSinkStage::run_export_trigger(
   for (auto& worker : workers) {
     worker.join();
   }
+  if (queueDepth) queueDepth->set(0);
 
   // Check if cancelled or error
   if (cancel_requested_.load() || abortFlag.load()) {
@@ -1953,42 +2016,32 @@ std::string VideoSinkStage::get_trigger_status() const {
 bool VideoSinkStage::appendSourceFields(
     const orc::VideoFrameRepresentation* vfr, orc::FrameID frame_id,
     const orc::SourceParameters& videoParams,
-    std::deque<std::vector<int16_t>>& owned_buffers,
+    std::vector<orc::SharedSampleBuffer>& owned_buffers,
     std::vector<SourceField>& out_fields) const {
   // SDK contract (video_frame_representation.h): pointers returned by
   // get_frame()/get_frame_luma()/get_frame_chroma() are only valid until the
   // next call on the representation. Decoders with temporal look-around
   // (Transform 3D, NTSC 3D) hold fields from several frames at once while
   // worker threads pull neighbouring frames through the same upstream caches,
-  // so the decoder input must view sink-owned copies.
-  std::vector<int16_t> composite = vfr->get_frame_copy(frame_id);
-  if (composite.empty()) {
+  // so the decoder input views buffers held through a frame handle, which
+  // upstream eviction cannot free.
+  const orc::FrameHandle frame = vfr->acquire_frame(frame_id);
+  if (!frame || !frame->samples || frame->samples->empty()) {
     ORC_LOG_WARN("VideoSink: Frame {} has no data in VFrameR", frame_id);
     return false;
   }
-  const size_t frame_samples = composite.size();
-  owned_buffers.push_back(std::move(composite));
-  const int16_t* frame_ptr = owned_buffers.back().data();
+  owned_buffers.push_back(frame->samples);
+  const int16_t* frame_ptr = frame->samples->data();
 
   const bool is_yc = vfr->has_separate_channels();
   const int16_t* luma_ptr = nullptr;
   const int16_t* chroma_ptr = nullptr;
-  if (is_yc) {
-    // Luma and chroma planes share the composite frame buffer layout.
-    const int16_t* src_luma = vfr->get_frame_luma(frame_id);
-    if (src_luma) {
-      owned_buffers.emplace_back(src_luma, src_luma + frame_samples);
-      luma_ptr = owned_buffers.back().data();
-    }
-    const int16_t* src_chroma = vfr->get_frame_chroma(frame_id);
-    if (src_chroma) {
-      owned_buffers.emplace_back(src_chroma, src_chroma + frame_samples);
-      chroma_ptr = owned_buffers.back().data();
-    }
-    if (!luma_ptr || !chroma_ptr) {
-      luma_ptr = nullptr;
-      chroma_ptr = nullptr;
-    }
+  // Luma and chroma planes share the composite frame buffer layout.
+  if (is_yc && frame->luma && frame->chroma) {
+    owned_buffers.push_back(frame->luma);
+    owned_buffers.push_back(frame->chroma);
+    luma_ptr = frame->luma->data();
+    chroma_ptr = frame->chroma->data();
   }
 
   std::optional<int32_t> frame_phase_id;
@@ -2196,10 +2249,28 @@ StagePreviewCapability VideoSinkStage::get_preview_capability() const {
 
 std::optional<ColourFrameCarrier> VideoSinkStage::get_colour_preview_carrier(
     uint64_t index, PreviewNavigationHint hint [[maybe_unused]]) const {
+  return build_colour_preview_carrier(index, false, nullptr);
+}
+
+std::optional<ColourFrameCarrier>
+VideoSinkStage::get_draft_colour_preview_carrier(uint64_t index) const {
+  return build_colour_preview_carrier(index, true, nullptr);
+}
+
+std::optional<ColourFrameCarrier>
+VideoSinkStage::get_cancellable_colour_preview_carrier(
+    uint64_t index, PreviewNavigationHint hint [[maybe_unused]], bool draft,
+    const ColourPreviewCancelCheck& cancelled) const {
+  return build_colour_preview_carrier(index, draft, cancelled);
+}
+
+std::optional<ColourFrameCarrier> VideoSinkStage::build_colour_preview_carrier(
+    uint64_t index, bool draft,
+    const ColourPreviewCancelCheck& cancelled) const {
   ORC_LOG_DEBUG(
-      "VideoSink: get_colour_preview_carrier called on instance {} for frame "
-      "{}, has_cached_input={}",
-      static_cast<const void*>(this), index, (cached_input_ != nullptr));
+      "VideoSink: colour preview carrier requested on instance {} for frame "
+      "{} (draft={}), has_cached_input={}",
+      static_cast<const void*>(this), index, draft, (cached_input_ != nullptr));
 
   std::shared_ptr<const orc::VideoFrameRepresentation> local_input;
   {
@@ -2207,9 +2278,68 @@ std::optional<ColourFrameCarrier> VideoSinkStage::get_colour_preview_carrier(
     local_input = cached_input_;
   }
 
+  return decode_colour_carrier(
+      local_input, index, draft, true,
+      draft ? draft_decoder_cache_ : preview_decoder_cache_, cancelled);
+}
+
+/**
+ * @brief Decode session with its own full-quality decoder.
+ *
+ * Holds the input the stage had when the session was opened, so a
+ * re-execution of the stage does not change the frames under a running
+ * analysis.
+ */
+class VideoSinkStage::ColourDecodeSession : public IColourDecodeSession {
+ public:
+  ColourDecodeSession(const VideoSinkStage& stage,
+                      std::shared_ptr<const VideoFrameRepresentation> input)
+      : stage_(stage), input_(std::move(input)) {}
+
+  ~ColourDecodeSession() override {
+    std::lock_guard<std::mutex> lock(preview_decoder_mutex());
+    decoder_cache_.decoder.reset();
+  }
+
+  uint64_t frame_count() const override { return input_->frame_count(); }
+
+  std::optional<ColourFrameCarrier> decode_colour_frame(
+      uint64_t frame_index) override {
+    return stage_.decode_colour_carrier(input_, frame_index, false, false,
+                                        decoder_cache_);
+  }
+
+ private:
+  const VideoSinkStage& stage_;
+  std::shared_ptr<const VideoFrameRepresentation> input_;
+  PreviewDecoderCache decoder_cache_;
+};
+
+std::unique_ptr<IColourDecodeSession>
+VideoSinkStage::open_colour_decode_session() const {
+  std::shared_ptr<const orc::VideoFrameRepresentation> local_input;
+  {
+    std::lock_guard<std::mutex> lock(cached_input_mutex_);
+    local_input = cached_input_;
+  }
+
+  if (!local_input) {
+    return nullptr;
+  }
+  return std::make_unique<ColourDecodeSession>(*this, std::move(local_input));
+}
+
+std::optional<ColourFrameCarrier> VideoSinkStage::decode_colour_carrier(
+    const std::shared_ptr<const VideoFrameRepresentation>& local_input,
+    uint64_t index, bool draft, bool with_vectorscope,
+    PreviewDecoderCache& decoder_cache,
+    const ColourPreviewCancelCheck& cancelled) const {
   if (!local_input) {
     return std::nullopt;
   }
+  const auto cancel_requested = [&cancelled] {
+    return cancelled && cancelled();
+  };
 
   auto video_params_opt = local_input->get_video_parameters();
   if (!video_params_opt) {
@@ -2237,7 +2367,8 @@ std::optional<ColourFrameCarrier> VideoSinkStage::get_colour_preview_carrier(
   // Build (or reuse) the preview decoder before gathering fields so the
   // look-around comes from the decoder itself, matching the render path
   // instead of duplicating per-type values here.
-  std::string effectiveDecoderType = decoder_type_;
+  std::string effectiveDecoderType =
+      draft ? draft_decoder_type(decoder_type_) : decoder_type_;
 
   // Transform PAL filters operate on composite chroma; a Y/C source has no
   // composite chroma to filter, so fall back to pal2d.  The render path applies
@@ -2248,45 +2379,52 @@ std::optional<ColourFrameCarrier> VideoSinkStage::get_colour_preview_carrier(
     effectiveDecoderType = "pal2d";
   }
 
-  if (!preview_decoder_cache_.matches_config(
-          effectiveDecoderType, chroma_gain_, chroma_phase_, luma_nr_,
-          chroma_nr_, ntsc_phase_comp_, simple_pal_, false,
+  // Drafts skip noise reduction.
+  const double luma_nr = draft ? 0.0 : luma_nr_;
+  const double chroma_nr = draft ? 0.0 : chroma_nr_;
+
+  if (!decoder_cache.matches_config(
+          effectiveDecoderType, chroma_gain_, chroma_phase_, luma_nr,
+          chroma_nr, ntsc_phase_comp_, simple_pal_, false,
           transform_threshold_, chroma_weight_, adapt_threshold_)) {
-    preview_decoder_cache_.decoder.reset();
-    preview_decoder_cache_.decoder_type = effectiveDecoderType;
-    preview_decoder_cache_.chroma_gain = chroma_gain_;
-    preview_decoder_cache_.chroma_phase = chroma_phase_;
-    preview_decoder_cache_.luma_nr = luma_nr_;
-    preview_decoder_cache_.chroma_nr = chroma_nr_;
-    preview_decoder_cache_.ntsc_phase_comp = ntsc_phase_comp_;
-    preview_decoder_cache_.simple_pal = simple_pal_;
-    preview_decoder_cache_.blackandwhite = false;
-    preview_decoder_cache_.transform_threshold = transform_threshold_;
-    preview_decoder_cache_.chroma_weight = chroma_weight_;
-    preview_decoder_cache_.adapt_threshold = adapt_threshold_;
+    std::lock_guard<std::mutex> lock(preview_decoder_mutex());
+    decoder_cache.decoder.reset();
+    decoder_cache.decoder_type = effectiveDecoderType;
+    decoder_cache.chroma_gain = chroma_gain_;
+    decoder_cache.chroma_phase = chroma_phase_;
+    decoder_cache.luma_nr = luma_nr;
+    decoder_cache.chroma_nr = chroma_nr;
+    decoder_cache.ntsc_phase_comp = ntsc_phase_comp_;
+    decoder_cache.simple_pal = simple_pal_;
+    decoder_cache.blackandwhite = false;
+    decoder_cache.transform_threshold = transform_threshold_;
+    decoder_cache.chroma_weight = chroma_weight_;
+    decoder_cache.adapt_threshold = adapt_threshold_;
 
     DecoderParams decoderParams;
     decoderParams.chromaGain = chroma_gain_;
     decoderParams.chromaPhase = chroma_phase_;
-    decoderParams.lumaNr = luma_nr_;
-    decoderParams.chromaNr = chroma_nr_;
+    decoderParams.lumaNr = luma_nr;
+    decoderParams.chromaNr = chroma_nr;
     decoderParams.ntscPhaseComp = ntsc_phase_comp_;
     decoderParams.simplePal = simple_pal_;
     decoderParams.transformThreshold = transform_threshold_;
     decoderParams.chromaWeight = chroma_weight_;
     decoderParams.adaptThreshold = adapt_threshold_;
-    preview_decoder_cache_.decoder =
+    // Drafts keep only every kDraftColourPreviewDecimation-th sample, so PAL
+    // decodes skip the others; the draft cache is never used at full width.
+    decoderParams.horizontalStep =
+        draft ? static_cast<int32_t>(kDraftColourPreviewDecimation) : 1;
+    decoder_cache.decoder =
         make_decoder(effectiveDecoderType, decoderParams, safeVideoParams);
   }
 
-  if (!preview_decoder_cache_.decoder) {
+  if (!decoder_cache.decoder) {
     return std::nullopt;
   }
 
-  const int32_t num_lookbehind_frames =
-      preview_decoder_cache_.decoder->getLookBehind();
-  const int32_t num_lookahead_frames =
-      preview_decoder_cache_.decoder->getLookAhead();
+  const int32_t num_lookbehind_frames = decoder_cache.decoder->getLookBehind();
+  const int32_t num_lookahead_frames = decoder_cache.decoder->getLookAhead();
 
   int64_t start_frame_idx =
       static_cast<int64_t>(frame_a_index) - num_lookbehind_frames;
@@ -2300,9 +2438,9 @@ std::optional<ColourFrameCarrier> VideoSinkStage::get_colour_preview_carrier(
       preview_is_pal ? static_cast<int16_t>(orc::kPalBlanking)
                      : static_cast<int16_t>(orc::kNtscBlanking);
 
-  // Owned buffers backing every preview SourceField (blank padding and copies
-  // of VFrameR frame data); must outlive inputFields.
-  std::deque<std::vector<int16_t>> previewOwnedBuffers;
+  // Buffers backing every preview SourceField (blank padding and VFrameR
+  // frame data held through acquire_frame()); must outlive inputFields.
+  std::vector<orc::SharedSampleBuffer> previewOwnedBuffers;
 
   // Helper: build a blank SourceField for preview
   auto makePreviewBlankField = [&](int64_t fi,
@@ -2340,8 +2478,10 @@ std::optional<ColourFrameCarrier> VideoSinkStage::get_colour_preview_carrier(
       blank.line_count = fl;
     }
 
-    previewOwnedBuffers.emplace_back(samples, preview_blanking);
-    const int16_t* buf = previewOwnedBuffers.back().data();
+    previewOwnedBuffers.push_back(
+        std::make_shared<const std::vector<int16_t>>(samples,
+                                                     preview_blanking));
+    const int16_t* buf = previewOwnedBuffers.back()->data();
 
     blank.data = buf;
     if (is_yc_source) {
@@ -2370,6 +2510,9 @@ std::optional<ColourFrameCarrier> VideoSinkStage::get_colour_preview_carrier(
   };
 
   for (int64_t fi = start_frame_idx; fi <= end_frame_idx; ++fi) {
+    if (cancel_requested()) {
+      return std::nullopt;
+    }
     orc::FrameID fid = static_cast<orc::FrameID>(fi);
     if (fi < 0 || !local_input->has_frame(fid) ||
         !appendSourceFields(local_input.get(), fid, safeVideoParams,
@@ -2381,7 +2524,7 @@ std::optional<ColourFrameCarrier> VideoSinkStage::get_colour_preview_carrier(
     }
   }
 
-  if (inputFields.size() < 2) {
+  if (inputFields.size() < 2 || cancel_requested()) {
     return std::nullopt;
   }
 
@@ -2392,8 +2535,11 @@ std::optional<ColourFrameCarrier> VideoSinkStage::get_colour_preview_carrier(
   std::vector<::ComponentFrame> outputFrames(1);
   const int32_t frameEndIndex = frameStartIndex + 2;
 
-  preview_decoder_cache_.decoder->decodeFrames(inputFields, frameStartIndex,
-                                               frameEndIndex, outputFrames);
+  decoder_cache.decoder->decodeFrames(inputFields, frameStartIndex,
+                                      frameEndIndex, outputFrames);
+  if (cancel_requested()) {
+    return std::nullopt;
+  }
 
   ::ComponentFrame& frame = outputFrames[0];
   int32_t width = frame.getWidth();
@@ -2440,28 +2586,56 @@ std::optional<ColourFrameCarrier> VideoSinkStage::get_colour_preview_carrier(
   carrier.cvbs_black = videoParams.black_level;
   carrier.cvbs_white = videoParams.white_level;
 
-  carrier.vectorscope_data = extract_vectorscope_from_component_frame(
-      frame, videoParams, frame_a_index * 2, 4);
-  if (carrier.vectorscope_data.has_value()) {
-    carrier.vectorscope_data->system = videoParams.system;
-    carrier.vectorscope_data->cvbs_white = videoParams.white_level;
-    carrier.vectorscope_data->cvbs_blanking = videoParams.blanking_level;
-  }
-
-  const size_t samples =
-      static_cast<size_t>(width) * static_cast<size_t>(height);
-  carrier.y_plane.reserve(samples);
-  carrier.u_plane.reserve(samples);
-  carrier.v_plane.reserve(samples);
-
-  for (int32_t y = 0; y < height; ++y) {
-    const double* yLine = frame.y(y);
-    const double* uLine = frame.u(y);
-    const double* vLine = frame.v(y);
-    for (int32_t x = 0; x < width; ++x) {
-      carrier.y_plane.push_back(yLine[x]);
-      carrier.u_plane.push_back(uLine[x]);
-      carrier.v_plane.push_back(vLine[x]);
+  if (draft) {
+    // Keep every kDraftColourPreviewDecimation-th sample: those are the ones
+    // a stepped PAL decode fills in. An odd final blanking sample is dropped.
+    constexpr uint32_t kStep = kDraftColourPreviewDecimation;
+    carrier.width = static_cast<uint32_t>(width) / kStep;
+    carrier.active_x_start /= kStep;
+    carrier.active_x_end =
+        std::min(carrier.width, (carrier.active_x_end + kStep - 1) / kStep);
+    const size_t samples =
+        static_cast<size_t>(carrier.width) * static_cast<size_t>(height);
+    carrier.y_plane.resize(samples);
+    carrier.u_plane.resize(samples);
+    carrier.v_plane.resize(samples);
+    size_t out = 0;
+    for (int32_t y = 0; y < height; ++y) {
+      const double* yLine = frame.y(y);
+      const double* uLine = frame.u(y);
+      const double* vLine = frame.v(y);
+      for (uint32_t x = 0; x < carrier.width; ++x, ++out) {
+        carrier.y_plane[out] = yLine[x * kStep];
+        carrier.u_plane[out] = uLine[x * kStep];
+        carrier.v_plane[out] = vLine[x * kStep];
+      }
+    }
+  } else {
+    if (with_vectorscope) {
+      carrier.vectorscope_data = extract_vectorscope_from_component_frame(
+          frame, videoParams, frame_a_index * 2, 4);
+      if (carrier.vectorscope_data.has_value()) {
+        carrier.vectorscope_data->system = videoParams.system;
+        carrier.vectorscope_data->cvbs_white = videoParams.white_level;
+        carrier.vectorscope_data->cvbs_blanking = videoParams.blanking_level;
+      }
+    }
+
+    const size_t samples =
+        static_cast<size_t>(width) * static_cast<size_t>(height);
+    carrier.y_plane.reserve(samples);
+    carrier.u_plane.reserve(samples);
+    carrier.v_plane.reserve(samples);
+
+    for (int32_t y = 0; y < height; ++y) {
+      const double* yLine = frame.y(y);
+      const double* uLine = frame.u(y);
+      const double* vLine = frame.v(y);
+      for (int32_t x = 0; x < width; ++x) {
+        carrier.y_plane.push_back(yLine[x]);
+        carrier.u_plane.push_back(uLine[x]);
+        carrier.v_plane.push_back(vLine[x]);
+      }
     }
   }
 
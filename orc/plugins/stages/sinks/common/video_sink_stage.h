@@ -26,7 +26,6 @@
 #include <orc/stage/video_frame_representation.h>
 
 #include <atomic>
-#include <deque>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -96,6 +95,9 @@ class VideoSinkStage : public DAGStage,
                        public TriggerableStage,
                        public IStagePreviewCapability,
                        public IColourPreviewProvider,
+                       public IDraftColourPreviewProvider,
+                       public ICancellableColourPreviewProvider,
+                       public IColourDecodeSessionProvider,
                        public StageToolProvider {
  public:
   ORC_STAGE_INSTRUCTIONS_MD
@@ -149,6 +151,22 @@ class VideoSinkStage : public DAGStage,
   std::optional<ColourFrameCarrier> get_colour_preview_carrier(
       uint64_t frame_index, PreviewNavigationHint hint) const override;
 
+  // IDraftColourPreviewProvider interface. Decodes the frame alone with the
+  // 2D member of the configured decoder family and no noise reduction.
+  std::optional<ColourFrameCarrier> get_draft_colour_preview_carrier(
+      uint64_t frame_index) const override;
+
+  // ICancellableColourPreviewProvider interface. Polls `cancelled` between
+  // field fetches and around the decode.
+  std::optional<ColourFrameCarrier> get_cancellable_colour_preview_carrier(
+      uint64_t frame_index, PreviewNavigationHint hint, bool draft,
+      const ColourPreviewCancelCheck& cancelled) const override;
+
+  // IColourDecodeSessionProvider interface. Each session builds its own
+  // full-quality decoder and skips vectorscope extraction.
+  std::unique_ptr<IColourDecodeSession> open_colour_decode_session()
+      const override;
+
   // StageToolProvider interface
   std::vector<StageToolDescriptor> get_stage_tools() const override {
     return {StageToolDescriptor{"ffmpeg_preset_config", "FFmpeg Preset Config",
@@ -193,6 +211,27 @@ class VideoSinkStage : public DAGStage,
     }
   };
   mutable PreviewDecoderCache preview_decoder_cache_;
+  // Separate cache for draft previews, so alternating draft and full-quality
+  // previews does not rebuild either decoder.
+  mutable PreviewDecoderCache draft_decoder_cache_;
+
+  // Preview path: decodes from cached_input_ with the preview or draft cache.
+  std::optional<ColourFrameCarrier> build_colour_preview_carrier(
+      uint64_t index, bool draft,
+      const ColourPreviewCancelCheck& cancelled) const;
+
+  // Shared body of the preview and decode-session paths. Decodes frame
+  // `index` of `input` with `decoder_cache`, rebuilding its decoder when the
+  // configuration changed. Full-quality carriers get vectorscope data only
+  // when `with_vectorscope` is set. Returns std::nullopt once `cancelled`
+  // (may be empty) reports true.
+  std::optional<ColourFrameCarrier> decode_colour_carrier(
+      const std::shared_ptr<const VideoFrameRepresentation>& input,
+      uint64_t index, bool draft, bool with_vectorscope,
+      PreviewDecoderCache& decoder_cache,
+      const ColourPreviewCancelCheck& cancelled = nullptr) const;
+
+  class ColourDecodeSession;
 
   // Current parameters
   std::string output_path_;
@@ -249,17 +288,17 @@ class VideoSinkStage : public DAGStage,
 
   // Helper methods for integration
 
-  // Copy frame_id's buffers out of the VFrameR into owned_buffers and append
-  // SourceFields for field 1 and field 2 viewing those copies. The SDK
+  // Acquire frame_id's buffers from the VFrameR into owned_buffers and
+  // append SourceFields for field 1 and field 2 viewing them. The SDK
   // forbids retaining get_frame() pointers across calls (upstream caches may
   // evict or replace buffers while other threads still read them), so
-  // decoder input must view sink-owned memory. owned_buffers must outlive
-  // the appended fields. Returns false (appending nothing) when the frame
-  // has no data.
+  // decoder input views buffers the sink holds a reference to. owned_buffers
+  // must outlive the appended fields. Returns false (appending nothing) when
+  // the frame has no data.
   bool appendSourceFields(const orc::VideoFrameRepresentation* vfr,
                           orc::FrameID frame_id,
                           const orc::SourceParameters& videoParams,
-                          std::deque<std::vector<int16_t>>& owned_buffers,
+                          std::vector<orc::SharedSampleBuffer>& owned_buffers,
                           std::vector<SourceField>& out_fields) const;
 
   // Build a SourceField view over caller-owned frame buffers. For PAL,
@@ -11,13 +11,69 @@
 
 #include <orc/stage/field_id.h>
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <memory>
 #include <utility>
 #include <variant>
 
+#include "progressive-analysis/local_observation_context.h"
+#include "progressive-analysis/progressive_analysis.h"
+
 namespace orc {
+namespace {
+// Running white SNR / black PSNR sums over the frames of one bucket analysed
+// so far.
+struct SNRBucketAccumulator {
+  double white_sum = 0.0;
+  double black_sum = 0.0;
+  size_t white_count = 0;
+  size_t black_count = 0;
+
+  void merge(const SNRBucketAccumulator& other) {
+    white_sum += other.white_sum;
+    black_sum += other.black_sum;
+    white_count += other.white_count;
+    black_count += other.black_count;
+  }
+};
+
+std::vector<FrameSNRStats> build_frame_stats(
+    const std::vector<AnalysisBucket>& buckets,
+    const std::vector<SNRBucketAccumulator>& accums) {
+  std::vector<FrameSNRStats> frame_stats;
+  frame_stats.reserve(buckets.size());
+  for (size_t b = 0; b < buckets.size(); ++b) {
+    const SNRBucketAccumulator& accum = accums[b];
+    FrameSNRStats frame_stat;
+    // Use the center frame of the bucket as the representative frame number
+    // (1-based for display).
+    frame_stat.frame_number =
+        static_cast<int32_t>(buckets[b].first +
+                             (buckets[b].last - buckets[b].first) / 2U) +
+        1;
+
+    if (accum.white_count > 0) {
+      frame_stat.white_snr =
+          accum.white_sum / static_cast<double>(accum.white_count);
+      frame_stat.white_snr_count = accum.white_count;
+      frame_stat.has_white_snr = true;
+    }
+    if (accum.black_count > 0) {
+      frame_stat.black_psnr =
+          accum.black_sum / static_cast<double>(accum.black_count);
+      frame_stat.black_psnr_count = accum.black_count;
+      frame_stat.has_black_psnr = true;
+    }
+    frame_stat.has_data = frame_stat.has_white_snr || frame_stat.has_black_psnr;
+    frame_stat.field_count = std::max(accum.white_count, accum.black_count);
+    frame_stats.push_back(frame_stat);
+  }
+  return frame_stats;
+}
+}  // namespace
+
 void SNRAnalysisSinkStageDeps::init(TriggerProgressCallback progress_callback,
                                     std::atomic<bool>* cancel_requested) {
   progress_callback_ = std::move(progress_callback);
@@ -28,6 +84,11 @@ SNRAnalysisComputeResult SNRAnalysisSinkStageDeps::compute_and_analyze(
     VideoFrameRepresentation* representation,
     IObservationContext& observation_context,
     SNRAnalysisComputeOptions options) {
+  // Workers observe into their own LocalObservationContext; the pipeline
+  // context is not thread-safe and the SNR observations are scratch values
+  // read back immediately, so nothing is written to it.
+  (void)observation_context;
+
   if (!representation) {
     return {false, "Input representation is null", {}, 0};
   }
@@ -48,130 +109,95 @@ SNRAnalysisComputeResult SNRAnalysisSinkStageDeps::compute_and_analyze(
     return result;
   }
 
-  // Observer sessions are created once and reused across every sampled frame
-  // (these observers hold no cross-frame state; the observation field is read
-  // and cleared each iteration). A null service — e.g. an older host — leaves
-  // the handles null and the per-frame observation is skipped.
-  std::unique_ptr<IObserverHandle> white_snr_handle;
-  std::unique_ptr<IObserverHandle> black_psnr_handle;
-  if (observation_service_) {
-    white_snr_handle = observation_service_->create_observer("white_snr");
-    black_psnr_handle = observation_service_->create_observer("black_psnr");
-  } else {
+  if (!observation_service_) {
     logger_.warn(
         "SNRAnalysisSinkDeps: observation service unavailable; SNR "
         "observations skipped");
   }
 
-  // Bucket-sampled analysis: divide the recording into at most kDefaultBuckets
-  // display points and, within each bucket, analyze at most kSamplesPerBucket
-  // evenly-spaced frames.  For small sources (bucket size <= kSamplesPerBucket)
-  // every frame in the bucket is analyzed.  This keeps wall-clock time near-
-  // constant regardless of recording length.
+  // Progressive bucketed analysis: divide the recording into at most
+  // kDefaultBuckets display points. The coarse pass analyses the first frame
+  // of every bucket and is published immediately; the refinement pass then
+  // folds every remaining frame of each bucket in, in parallel.
   constexpr uint64_t kDefaultBuckets = 1000;
-  constexpr uint64_t kSamplesPerBucket = 1;
-  const uint64_t bucket_count =
-      (total_frames < kDefaultBuckets) ? total_frames : kDefaultBuckets;
-
-  logger_.debug(
-      "SNRAnalysisSinkDeps: {} frames → {} buckets (~{} samples/bucket)",
-      total_frames, bucket_count, kSamplesPerBucket);
-
-  result.frame_stats.reserve(static_cast<size_t>(bucket_count));
-
-  for (uint64_t b = 0; b < bucket_count; ++b) {
-    if (cancel_requested_ && cancel_requested_->load()) {
-      logger_.warn("SNRAnalysisSinkDeps: Cancel requested at bucket {}", b);
-      result.success = false;
-      result.message = "Cancelled by user";
-      result.frame_stats.clear();
-      result.total_frames = 0;
-      return result;
+  ProgressiveAnalysisConfig config;
+  config.refine = options.refine;
+  ProgressiveAnalysisEngine<SNRBucketAccumulator> engine(
+      make_even_analysis_buckets(frame_rng, kDefaultBuckets), config);
+
+  logger_.debug("SNRAnalysisSinkDeps: {} frames → {} buckets (refine={})",
+                total_frames, engine.buckets().size(), options.refine);
+
+  const bool want_white = options.snr_mode == SNRAnalysisMode::WHITE ||
+                          options.snr_mode == SNRAnalysisMode::BOTH;
+  const bool want_black = options.snr_mode == SNRAnalysisMode::BLACK ||
+                          options.snr_mode == SNRAnalysisMode::BOTH;
+
+  // Observer sessions and an observation context per worker thread (these
+  // observers hold no cross-frame state, but a handle must not be shared
+  // between threads). A null service leaves the handles null and the
+  // per-frame observation is skipped.
+  IObservationService* service = observation_service_;
+  const auto make_visitor = [service, representation, want_white,
+                             want_black]() {
+    std::shared_ptr<IObserverHandle> white_snr_handle;
+    std::shared_ptr<IObserverHandle> black_psnr_handle;
+    if (service) {
+      if (want_white) white_snr_handle = service->create_observer("white_snr");
+      if (want_black) {
+        black_psnr_handle = service->create_observer("black_psnr");
+      }
     }
-
-    // Inclusive frame range for this bucket (no frame is missed or counted
-    // twice across adjacent buckets).
-    const FrameID bucket_start =
-        frame_rng.first + (b * total_frames) / bucket_count;
-    const FrameID bucket_end =
-        frame_rng.first + ((b + 1) * total_frames) / bucket_count - 1;
-    const uint64_t bucket_size = bucket_end - bucket_start + 1;
-    const uint64_t n_samples =
-        (kSamplesPerBucket < bucket_size) ? kSamplesPerBucket : bucket_size;
-
-    double white_sum = 0.0;
-    double black_sum = 0.0;
-    size_t white_count = 0;
-    size_t black_count = 0;
-
-    for (uint64_t s = 0; s < n_samples; ++s) {
-      // Evenly distribute sample frames across the bucket so the first and last
-      // frames are always included.
-      const FrameID fid =
-          (n_samples == 1U)
-              ? bucket_start
-              : bucket_start + (s * (bucket_size - 1U)) / (n_samples - 1U);
-
-      if (white_snr_handle && (options.snr_mode == SNRAnalysisMode::WHITE ||
-                               options.snr_mode == SNRAnalysisMode::BOTH)) {
-        white_snr_handle->process_frame(*representation, fid,
-                                        observation_context);
+    auto context = std::make_shared<LocalObservationContext>();
+    return [representation, white_snr_handle, black_psnr_handle, context](
+               FrameID fid, SNRBucketAccumulator& accum) {
+      if (white_snr_handle) {
+        white_snr_handle->process_frame(*representation, fid, *context);
       }
-      if (black_psnr_handle && (options.snr_mode == SNRAnalysisMode::BLACK ||
-                                options.snr_mode == SNRAnalysisMode::BOTH)) {
-        black_psnr_handle->process_frame(*representation, fid,
-                                         observation_context);
+      if (black_psnr_handle) {
+        black_psnr_handle->process_frame(*representation, fid, *context);
       }
 
       const FieldID frame_fid(fid * 2U);
 
-      auto white_val =
-          observation_context.get(frame_fid, "white_snr", "snr_db");
+      const auto white_val = context->get(frame_fid, "white_snr", "snr_db");
       if (white_val && std::holds_alternative<double>(*white_val)) {
-        white_sum += std::get<double>(*white_val);
-        ++white_count;
+        accum.white_sum += std::get<double>(*white_val);
+        ++accum.white_count;
       }
 
-      auto black_val =
-          observation_context.get(frame_fid, "black_psnr", "psnr_db");
+      const auto black_val = context->get(frame_fid, "black_psnr", "psnr_db");
       if (black_val && std::holds_alternative<double>(*black_val)) {
-        black_sum += std::get<double>(*black_val);
-        ++black_count;
+        accum.black_sum += std::get<double>(*black_val);
+        ++accum.black_count;
       }
 
-      observation_context.clear_field(frame_fid);
-    }
-
-    FrameSNRStats frame_stat;
-    // Use the center frame of the bucket as the representative frame number
-    // (1-based for display).
-    frame_stat.frame_number =
-        static_cast<int32_t>(bucket_start + (bucket_end - bucket_start) / 2U) +
-        1;
-
-    if (white_count > 0) {
-      frame_stat.white_snr = white_sum / static_cast<double>(white_count);
-      frame_stat.white_snr_count = white_count;
-      frame_stat.has_white_snr = true;
-    }
-    if (black_count > 0) {
-      frame_stat.black_psnr = black_sum / static_cast<double>(black_count);
-      frame_stat.black_psnr_count = black_count;
-      frame_stat.has_black_psnr = true;
-    }
-    frame_stat.has_data = frame_stat.has_white_snr || frame_stat.has_black_psnr;
-    frame_stat.field_count = std::max(white_count, black_count);
-
-    result.frame_stats.push_back(frame_stat);
-
-    if (progress_callback_ && (b % 50 == 0 || b + 1 == bucket_count)) {
-      progress_callback_(b + 1, bucket_count,
-                         "Analysing bucket " + std::to_string(b + 1) + "/" +
-                             std::to_string(bucket_count));
-    }
+      context->clear();
+    };
+  };
+
+  const int32_t total_frames_i32 = static_cast<int32_t>(total_frames);
+  const auto publish = [&](const std::vector<SNRBucketAccumulator>& accums,
+                           ProgressivePass pass) {
+    if (!options.on_partial_result) return;
+    options.on_partial_result(build_frame_stats(engine.buckets(), accums),
+                              total_frames_i32,
+                              pass == ProgressivePass::Complete);
+  };
+
+  const auto status =
+      engine.run(make_visitor, publish, progress_callback_, cancel_requested_);
+  if (status == ProgressiveAnalysisStatus::Cancelled) {
+    logger_.warn("SNRAnalysisSinkDeps: Cancel requested");
+    result.success = false;
+    result.message = "Cancelled by user";
+    result.total_frames = 0;
+    return result;
   }
 
-  result.total_frames = static_cast<int32_t>(total_frames);
+  result.frame_stats =
+      build_frame_stats(engine.buckets(), engine.accumulators());
+  result.total_frames = total_frames_i32;
   logger_.debug("SNRAnalysisSinkDeps: Complete — {} buckets from {} frames",
                 result.frame_stats.size(), total_frames);
 
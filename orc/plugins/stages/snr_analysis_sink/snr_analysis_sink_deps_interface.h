@@ -16,16 +16,28 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
 #include "snr_analysis_types.h"
 
 namespace orc {
+// Receives intermediate datasets while compute_and_analyze() runs: first the
+// coarse one-frame-per-bucket result, then periodic snapshots as buckets are
+// refined to full-frame coverage, and finally the complete result (complete ==
+// true). Always invoked on the thread that called compute_and_analyze().
+using SNRAnalysisPartialResultCallback =
+    std::function<void(const std::vector<FrameSNRStats>& frame_stats,
+                       int32_t total_frames, bool complete)>;
+
 struct SNRAnalysisComputeOptions {
   std::string output_path;
   bool write_csv{false};
   SNRAnalysisMode snr_mode{SNRAnalysisMode::BOTH};
+  // Refine every bucket to full-frame coverage after the coarse pass.
+  bool refine{true};
+  SNRAnalysisPartialResultCallback on_partial_result;
 };
 
 struct SNRAnalysisComputeResult {
@@ -183,14 +183,31 @@ bool SNRAnalysisSinkStage::trigger(
     compute_options.output_path = cfg.output_path;
     compute_options.write_csv = cfg.write_csv;
     compute_options.snr_mode = cfg.mode;
+    // Publish the coarse dataset as soon as it exists and replace it as
+    // buckets are refined; the complete dataset is handled below.
+    compute_options.on_partial_result =
+        [this, &cfg, &deps](const std::vector<FrameSNRStats>& stats,
+                            int32_t total_frames, bool complete) {
+          if (complete) return;
+          frame_stats_ = stats;
+          total_frames_ = total_frames;
+          has_results_ = true;
+          if (cfg.write_csv && !cfg.output_path.empty()) {
+            deps->write_csv(cfg.output_path, frame_stats_);
+          }
+        };
 
     const SNRAnalysisComputeResult compute_result = deps->compute_and_analyze(
         vfr.get(), observation_context, compute_options);
 
     if (!compute_result.success) {
-      has_results_ = false;
-      frame_stats_.clear();
-      total_frames_ = 0;
+      // A cancelled run keeps the last partial dataset it published; any
+      // other failure discards it.
+      if (compute_result.message != "Cancelled by user") {
+        frame_stats_.clear();
+        total_frames_ = 0;
+      }
+      has_results_ = !frame_stats_.empty();
       last_status_ = compute_result.message.empty()
                          ? "Error: SNR analysis failed"
                          : (compute_result.message == "Cancelled by user"
@@ -35,7 +35,9 @@ namespace orc {
  * @brief SNR Analysis Sink Stage
  *
  * Trigger to compute SNR/PSNR across input fields. Optionally writes CSV.
- * The dataset is cached and can be requested by the GUI after trigger.
+ * The dataset is cached and can be requested by the GUI after trigger; the
+ * coarse one-frame-per-bucket dataset is available while the full-resolution
+ * refinement is still running.
  */
 class SNRAnalysisSinkStage : public DAGStage,
                              public ParameterizedStage,
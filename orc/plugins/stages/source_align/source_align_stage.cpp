@@ -10,6 +10,7 @@
 #include "source_align_stage.h"
 
 #include <orc/stage/artifact.h>
+#include <orc/stage/line_overlay_representation.h>
 #include <orc/support/logging.h>
 #include <orc/support/preview_helpers.h>
 
@@ -23,24 +24,19 @@ namespace orc {
 // AlignedSourceFrameRepresentation
 // ============================================================================
 // Wraps a VFrameR and remaps frame IDs by adding a fixed offset so that
-// output frame_id 0 maps to source frame_id `offset_`.
-class AlignedSourceFrameRepresentation : public VideoFrameRepresentationWrapper,
+// output frame_id 0 maps to source frame_id `offset_`. Samples, hints, audio
+// and EFM/AC3 follow the shifted IDs through the line-overlay base.
+class AlignedSourceFrameRepresentation : public LineOverlayFrameRepresentation,
                                          public Artifact {
  public:
   AlignedSourceFrameRepresentation(
       std::shared_ptr<const VideoFrameRepresentation> source, FrameID offset,
       size_t source_index)
-      : VideoFrameRepresentationWrapper(std::move(source)),
+      : LineOverlayFrameRepresentation(std::move(source)),
         Artifact(ArtifactID("aligned_source_" + std::to_string(source_index) +
                             "_offset_" + std::to_string(offset)),
                  Provenance{}),
-        offset_(offset) {
-    if (source_) {
-      if (auto params = source_->get_video_parameters()) {
-        system_ = params->system;
-      }
-    }
-  }
+        offset_(offset) {}
 
   std::string type_name() const override {
     return "aligned_source_frame_representation";
@@ -69,104 +65,19 @@ class AlignedSourceFrameRepresentation : public VideoFrameRepresentationWrapper,
     return static_cast<size_t>(src.count() - offset_);
   }
 
-  bool has_frame(FrameID id) const override {
-    return source_ ? source_->has_frame(id + offset_) : false;
-  }
-
-  std::optional<FrameDescriptor> get_frame_descriptor(
-      FrameID id) const override {
-    if (!source_) {
-      return std::nullopt;
-    }
-    auto desc = source_->get_frame_descriptor(id + offset_);
-    if (desc) {
-      desc->frame_id = id;
-    }
-    return desc;
-  }
-
-  const sample_type* get_frame(FrameID id) const override {
-    return source_ ? source_->get_frame(id + offset_) : nullptr;
-  }
-
-  const sample_type* get_line(FrameID id, size_t line) const override {
-    return source_ ? source_->get_line(id + offset_, line) : nullptr;
-  }
-
-  std::vector<sample_type> get_frame_copy(FrameID id) const override {
-    return source_ ? source_->get_frame_copy(id + offset_)
-                   : std::vector<sample_type>{};
-  }
-
-  bool has_separate_channels() const override {
-    return source_ ? source_->has_separate_channels() : false;
-  }
-
-  const sample_type* get_frame_luma(FrameID id) const override {
-    return source_ ? source_->get_frame_luma(id + offset_) : nullptr;
-  }
-
-  const sample_type* get_frame_chroma(FrameID id) const override {
-    return source_ ? source_->get_frame_chroma(id + offset_) : nullptr;
-  }
-
-  const sample_type* get_line_luma(FrameID id, size_t line) const override {
-    return source_ ? source_->get_line_luma(id + offset_, line) : nullptr;
-  }
-
-  const sample_type* get_line_chroma(FrameID id, size_t line) const override {
-    return source_ ? source_->get_line_chroma(id + offset_, line) : nullptr;
-  }
-
-  std::vector<DropoutRun> get_dropout_hints(FrameID id) const override {
-    if (!source_) {
-      return {};
-    }
-    auto runs = source_->get_dropout_hints(id + offset_);
-    for (auto& run : runs) {
-      run.frame_id = id;
-    }
-    return runs;
-  }
-
-  // Audio channel pairs must follow the shifted frame IDs; pair count and
-  // descriptors forward from the source via the wrapper base. Every output
-  // frame must serve exactly audio_pairs_in_frame(id) stereo pairs, so an
-  // offset that breaks the NTSC/PAL-M five-frame audio sequence phase
-  // (SMPTE 272M-1994 §14.3: 1602/1601 pairs by sequence position) truncates
-  // one trailing pair or appends one trailing silence pair. Offsets that
-  // preserve the phase (multiples of 5) and all PAL offsets are sample-exact.
-  std::vector<int32_t> get_audio_samples(size_t pair,
-                                         FrameID id) const override {
-    if (!source_) return {};
-    auto samples = source_->get_audio_samples(pair, id + offset_);
-    const size_t out_pairs = audio_pairs_in_frame(id, system_);
-    if (samples.empty() || out_pairs == 0) return samples;
-    samples.resize(out_pairs * 2, 0);
-    return samples;
-  }
-
-  uint32_t get_efm_sample_count(FrameID id) const override {
-    return source_ ? source_->get_efm_sample_count(id + offset_) : 0;
-  }
-
-  std::vector<uint8_t> get_efm_samples(FrameID id) const override {
-    return source_ ? source_->get_efm_samples(id + offset_)
-                   : std::vector<uint8_t>{};
-  }
-
-  uint32_t get_ac3_symbol_count(FrameID id) const override {
-    return source_ ? source_->get_ac3_symbol_count(id + offset_) : 0;
-  }
-
-  std::vector<uint8_t> get_ac3_symbols(FrameID id) const override {
-    return source_ ? source_->get_ac3_symbols(id + offset_)
-                   : std::vector<uint8_t>{};
+ protected:
+  // Audio channel pairs follow the shifted frame IDs. An offset that breaks
+  // the NTSC/PAL-M five-frame audio sequence phase (SMPTE 272M-1994 §14.3)
+  // changes the pair count by one; the base truncates or silence-pads the
+  // shifted window. Offsets that preserve the phase (multiples of 5) and all
+  // PAL offsets are sample-exact.
+  std::optional<FrameID> source_frame_id(FrameID id) const override {
+    return id + offset_;
   }
+  bool has_overlay(FrameID /*id*/) const override { return false; }
 
  private:
   FrameID offset_;
-  VideoSystem system_ = VideoSystem::Unknown;
 };
 
 // ============================================================================
@@ -175,14 +86,16 @@ class AlignedSourceFrameRepresentation : public VideoFrameRepresentationWrapper,
 // Wraps a VFrameR and prepends `pad_count_` synthetic padding frames so that
 // output frame_id 0 maps to the globally earliest VBI frame position.
 // Padding frames carry is_padding_frame=true in their FrameDescriptor so that
-// downstream stages (e.g. stacker) skip them correctly.
-class PaddedSourceFrameRepresentation : public VideoFrameRepresentationWrapper,
+// downstream stages (e.g. stacker) skip them correctly. Their samples are a
+// single shared blanking-level frame; they carry no dropouts, EFM or AC3, and
+// their audio is cadence-sized silence.
+class PaddedSourceFrameRepresentation : public LineOverlayFrameRepresentation,
                                         public Artifact {
  public:
   PaddedSourceFrameRepresentation(
       std::shared_ptr<const VideoFrameRepresentation> source, size_t pad_count,
       size_t source_index)
-      : VideoFrameRepresentationWrapper(std::move(source)),
+      : LineOverlayFrameRepresentation(std::move(source)),
         Artifact(ArtifactID("padded_source_" + std::to_string(source_index) +
                             "_pad_" + std::to_string(pad_count)),
                  Provenance{}),
@@ -194,7 +107,6 @@ class PaddedSourceFrameRepresentation : public VideoFrameRepresentationWrapper,
         pad_samples_per_line_ =
             static_cast<size_t>(params->frame_width_nominal);
         pad_samples_total_ = pad_height_ * pad_samples_per_line_;
-        blanking_level_ = static_cast<sample_type>(params->blanking_level);
       }
     }
   }
@@ -227,128 +139,29 @@ class PaddedSourceFrameRepresentation : public VideoFrameRepresentationWrapper,
       desc.is_padding_frame = true;
       return desc;
     }
-    if (!source_) return std::nullopt;
-    auto desc = source_->get_frame_descriptor(id - pad_count_);
-    if (desc) desc->frame_id = id;
-    return desc;
-  }
-
-  const sample_type* get_frame(FrameID id) const override {
-    if (id < pad_count_) {
-      ensure_black_frame();
-      return black_frame_.empty() ? nullptr : black_frame_.data();
-    }
-    return source_ ? source_->get_frame(id - pad_count_) : nullptr;
-  }
-
-  const sample_type* get_line(FrameID id, size_t line) const override {
-    if (id < pad_count_) {
-      ensure_black_frame();
-      return black_frame_.empty() ? nullptr : black_frame_.data();
-    }
-    return source_ ? source_->get_line(id - pad_count_, line) : nullptr;
-  }
-
-  std::vector<sample_type> get_frame_copy(FrameID id) const override {
-    if (id < pad_count_) {
-      ensure_black_frame();
-      return black_frame_;
-    }
-    return source_ ? source_->get_frame_copy(id - pad_count_)
-                   : std::vector<sample_type>{};
-  }
-
-  bool has_separate_channels() const override {
-    return source_ ? source_->has_separate_channels() : false;
-  }
-
-  const sample_type* get_frame_luma(FrameID id) const override {
-    if (id < pad_count_) return nullptr;
-    return source_ ? source_->get_frame_luma(id - pad_count_) : nullptr;
-  }
-
-  const sample_type* get_frame_chroma(FrameID id) const override {
-    if (id < pad_count_) return nullptr;
-    return source_ ? source_->get_frame_chroma(id - pad_count_) : nullptr;
-  }
-
-  const sample_type* get_line_luma(FrameID id, size_t line) const override {
-    if (id < pad_count_) return nullptr;
-    return source_ ? source_->get_line_luma(id - pad_count_, line) : nullptr;
-  }
-
-  const sample_type* get_line_chroma(FrameID id, size_t line) const override {
-    if (id < pad_count_) return nullptr;
-    return source_ ? source_->get_line_chroma(id - pad_count_, line) : nullptr;
-  }
-
-  std::vector<DropoutRun> get_dropout_hints(FrameID id) const override {
-    if (id < pad_count_) return {};
-    if (!source_) return {};
-    auto runs = source_->get_dropout_hints(id - pad_count_);
-    for (auto& run : runs) {
-      run.frame_id = id;
-    }
-    return runs;
-  }
-
-  // Audio channel pairs must follow the shifted frame IDs; pair count and
-  // descriptors forward from the source via the wrapper base. Every output
-  // frame must serve exactly audio_pairs_in_frame(id) stereo pairs: padding
-  // frames carry cadence-sized silence, and a pad count that breaks the
-  // NTSC/PAL-M five-frame audio sequence phase (SMPTE 272M-1994 §14.3:
-  // 1602/1601 pairs by sequence position) truncates one trailing pair or
-  // appends one trailing silence pair on the shifted real frames. Pad counts
-  // that preserve the phase (multiples of 5) and all PAL pad counts are
-  // sample-exact.
-  std::vector<int32_t> get_audio_samples(size_t pair,
-                                         FrameID id) const override {
-    if (!source_) return {};
-    if (pair >= source_->audio_channel_pair_count()) return {};
-    const size_t out_pairs = audio_pairs_in_frame(id, pad_system_);
-    if (id < pad_count_) {
-      // Padding frames carry cadence-sized silence.
-      return std::vector<int32_t>(out_pairs * 2, 0);
-    }
-    auto samples = source_->get_audio_samples(pair, id - pad_count_);
-    if (samples.empty() || out_pairs == 0) return samples;
-    samples.resize(out_pairs * 2, 0);
-    return samples;
-  }
-
-  uint32_t get_efm_sample_count(FrameID id) const override {
-    if (id < pad_count_ || !source_) return 0;
-    return source_->get_efm_sample_count(id - pad_count_);
+    return LineOverlayFrameRepresentation::get_frame_descriptor(id);
   }
 
-  std::vector<uint8_t> get_efm_samples(FrameID id) const override {
-    if (id < pad_count_ || !source_) return {};
-    return source_->get_efm_samples(id - pad_count_);
+ protected:
+  // A pad count that breaks the NTSC/PAL-M five-frame audio sequence phase
+  // (SMPTE 272M-1994 §14.3) truncates or silence-pads one trailing pair on
+  // the shifted real frames (see the base). Pad counts that preserve the
+  // phase (multiples of 5) and all PAL pad counts are sample-exact.
+  std::optional<FrameID> source_frame_id(FrameID id) const override {
+    if (id < pad_count_) return std::nullopt;
+    return id - pad_count_;
   }
-
-  uint32_t get_ac3_symbol_count(FrameID id) const override {
-    if (id < pad_count_ || !source_) return 0;
-    return source_->get_ac3_symbol_count(id - pad_count_);
-  }
-
-  std::vector<uint8_t> get_ac3_symbols(FrameID id) const override {
-    if (id < pad_count_ || !source_) return {};
-    return source_->get_ac3_symbols(id - pad_count_);
+  bool is_synthetic_frame(FrameID id) const override {
+    return id < pad_count_;
   }
+  bool has_overlay(FrameID /*id*/) const override { return false; }
 
  private:
-  void ensure_black_frame() const {
-    if (!black_frame_.empty() || pad_samples_total_ == 0) return;
-    black_frame_.assign(pad_samples_total_, blanking_level_);
-  }
-
   size_t pad_count_;
   VideoSystem pad_system_ = VideoSystem::Unknown;
   size_t pad_height_ = 0;
   size_t pad_samples_total_ = 0;
   size_t pad_samples_per_line_ = 0;
-  sample_type blanking_level_ = 0;
-  mutable std::vector<sample_type> black_frame_;
 };
 
 // ============================================================================
@@ -7,6 +7,10 @@
  * SPDX-FileCopyrightText: 2025-2026 Simon Inns
  */
 
+#include <orc/abi/orc_plugin_services.h>
+#include <orc/stage/frame_buffer_pool.h>
+#include <orc/stage/metrics.h>
+#include <orc/stage/trace.h>
 #include <orc/support/frame_line_util.h>
 #include <orc/support/logging.h>
 #include <orc/support/preview_helpers.h>
@@ -37,6 +41,12 @@ StackedVideoFrameRepresentation::StackedVideoFrameRepresentation(
       stacked_audio_(kMaxCachedFrames),
       stacked_efm_(kMaxCachedFrames),
       best_source_cache_(kMaxCachedFrames) {
+  // The ensure_frame_stacked*() checks lead with these caches.
+  IMetricsRegistry* metrics = plugin::get_metrics();
+  stacked_frames_.bind_metrics(metrics, "stacker.frames",
+                               FrameCache::CountedLookup::kContains);
+  stacked_luma_.bind_metrics(metrics, "stacker.yc_frames",
+                             FrameCache::CountedLookup::kContains);
   if (!sources_.empty()) {
     bool first_yc = sources_[0]->has_separate_channels();
     for (size_t i = 1; i < sources_.size(); ++i) {
@@ -201,12 +211,14 @@ void StackedVideoFrameRepresentation::ensure_frame_stacked(FrameID id) const {
   }
 
   ORC_LOG_DEBUG("StackedVideoFrameRepresentation: stacking frame {}", id);
+  ORC_TRACE_FRAME_SCOPE(plugin::get_tracer(), "transform", "stack_frame",
+                        "stacker", id);
 
   auto src_ids = collect_source_frame_ids(id);
-  std::vector<sample_type> stacked_samples;
+  auto stacked_samples = pooled_frame_buffer();
   std::vector<DropoutRun> stacked_do;
 
-  stage_->stack_frame(src_ids, sources_, stacked_samples, stacked_do);
+  stage_->stack_frame(src_ids, sources_, *stacked_samples, stacked_do);
 
   // stack_frame builds runs without frame context; stamp this frame's ID so
   // downstream consumers (e.g. dropout_map) see consistent hints.
@@ -226,12 +238,15 @@ void StackedVideoFrameRepresentation::ensure_frame_stacked_yc(
   }
 
   ORC_LOG_DEBUG("StackedVideoFrameRepresentation: stacking YC frame {}", id);
+  ORC_TRACE_FRAME_SCOPE(plugin::get_tracer(), "transform", "stack_frame",
+                        "stacker", id);
 
   auto src_ids = collect_source_frame_ids(id);
-  std::vector<sample_type> luma, chroma;
+  auto luma = pooled_frame_buffer();
+  auto chroma = pooled_frame_buffer();
   std::vector<DropoutRun> dos;
 
-  stage_->stack_frame_yc(src_ids, sources_, luma, chroma, dos);
+  stage_->stack_frame_yc(src_ids, sources_, *luma, *chroma, dos);
 
   // stack_frame_yc builds runs without frame context; stamp this frame's ID
   // so downstream consumers (e.g. dropout_map) see consistent hints.
@@ -244,6 +259,23 @@ void StackedVideoFrameRepresentation::ensure_frame_stacked_yc(
   stacked_dropouts_.put(id, std::move(dos));
 }
 
+std::shared_ptr<std::vector<VideoFrameRepresentation::sample_type>>
+StackedVideoFrameRepresentation::pooled_frame_buffer() const {
+  IFrameBufferPool* pool = plugin::get_frame_buffer_pool();
+  auto params = get_video_parameters();
+  if (!pool || !params) {
+    return std::make_shared<std::vector<sample_type>>();
+  }
+  const size_t samples = frame_line_sample_offset(
+      params->system, static_cast<size_t>(params->frame_width_nominal),
+      static_cast<size_t>(params->frame_height));
+  auto buffer = acquire_sample_buffer(pool, samples);
+  // stack_frame() sizes and fills its output from empty; clearing keeps the
+  // recycled capacity, so that fill never reallocates.
+  buffer->clear();
+  return buffer;
+}
+
 // ── Flat access ──────────────────────────────────────────────────────────────
 
 const VideoFrameRepresentation::sample_type*
@@ -251,7 +283,7 @@ StackedVideoFrameRepresentation::get_frame(FrameID id) const {
   std::lock_guard<std::mutex> lk(cache_mutex_);
   ensure_frame_stacked(id);
   const auto* p = stacked_frames_.get_ptr(id);
-  return (p && !p->empty()) ? p->data() : nullptr;
+  return (p && !(*p)->empty()) ? (*p)->data() : nullptr;
 }
 
 const VideoFrameRepresentation::sample_type*
@@ -273,15 +305,15 @@ StackedVideoFrameRepresentation::get_frame_copy(FrameID id) const {
     if (stacked_frames_.contains(id) && stacked_dropouts_.contains(id)) {
       const auto* p = stacked_frames_.get_ptr(id);
       if (p) {
-        return *p;
+        return **p;
       }
     }
   }
 
-  std::vector<sample_type> samples;
+  auto samples = pooled_frame_buffer();
   std::vector<DropoutRun> dos;
   auto src_ids = collect_source_frame_ids(id);
-  stage_->stack_frame(src_ids, sources_, samples, dos);
+  stage_->stack_frame(src_ids, sources_, *samples, dos);
 
   // stack_frame builds runs without frame context; stamp this frame's ID so
   // downstream consumers (e.g. dropout_map) see consistent hints.
@@ -296,7 +328,30 @@ StackedVideoFrameRepresentation::get_frame_copy(FrameID id) const {
       stacked_dropouts_.put(id, std::move(dos));
     }
   }
-  return samples;
+  return *samples;
+}
+
+// Shares the cached stacked buffers; the handle keeps them alive after
+// eviction.
+FrameHandle StackedVideoFrameRepresentation::acquire_frame(FrameID id) const {
+  std::lock_guard<std::mutex> lk(cache_mutex_);
+  ensure_frame_stacked(id);
+  auto samples = stacked_frames_.get(id);
+  if (!samples || (*samples)->empty()) {
+    return nullptr;
+  }
+  auto frame = std::make_shared<AcquiredFrame>();
+  frame->frame_id = id;
+  frame->samples = std::move(*samples);
+  if (has_separate_channels()) {
+    ensure_frame_stacked_yc(id);
+    if (auto luma = stacked_luma_.get(id)) frame->luma = std::move(*luma);
+    if (auto chroma = stacked_chroma_.get(id)) {
+      frame->chroma = std::move(*chroma);
+    }
+  }
+  if (auto dos = stacked_dropouts_.get(id)) frame->dropouts = std::move(*dos);
+  return frame;
 }
 
 // ── YC access ────────────────────────────────────────────────────────────────
@@ -309,7 +364,7 @@ StackedVideoFrameRepresentation::get_frame_luma(FrameID id) const {
   std::lock_guard<std::mutex> lk(cache_mutex_);
   ensure_frame_stacked_yc(id);
   const auto* p = stacked_luma_.get_ptr(id);
-  return (p && !p->empty()) ? p->data() : nullptr;
+  return (p && !(*p)->empty()) ? (*p)->data() : nullptr;
 }
 
 const VideoFrameRepresentation::sample_type*
@@ -320,7 +375,7 @@ StackedVideoFrameRepresentation::get_frame_chroma(FrameID id) const {
   std::lock_guard<std::mutex> lk(cache_mutex_);
   ensure_frame_stacked_yc(id);
   const auto* p = stacked_chroma_.get_ptr(id);
-  return (p && !p->empty()) ? p->data() : nullptr;
+  return (p && !(*p)->empty()) ? (*p)->data() : nullptr;
 }
 
 const VideoFrameRepresentation::sample_type*
@@ -331,15 +386,15 @@ StackedVideoFrameRepresentation::get_line_luma(FrameID id, size_t line) const {
   std::lock_guard<std::mutex> lk(cache_mutex_);
   ensure_frame_stacked_yc(id);
   const auto* p = stacked_luma_.get_ptr(id);
-  if (!p || p->empty()) {
+  if (!p || (*p)->empty()) {
     return nullptr;
   }
   auto desc = source_ ? source_->get_frame_descriptor(id) : std::nullopt;
   if (!desc || line >= desc->height) {
     return nullptr;
   }
-  return p->data() + frame_line_sample_offset(
-                         desc->system, desc->samples_per_line_nominal, line);
+  return (*p)->data() + frame_line_sample_offset(
+                            desc->system, desc->samples_per_line_nominal, line);
 }
 
 const VideoFrameRepresentation::sample_type*
@@ -351,15 +406,15 @@ StackedVideoFrameRepresentation::get_line_chroma(FrameID id,
   std::lock_guard<std::mutex> lk(cache_mutex_);
   ensure_frame_stacked_yc(id);
   const auto* p = stacked_chroma_.get_ptr(id);
-  if (!p || p->empty()) {
+  if (!p || (*p)->empty()) {
     return nullptr;
   }
   auto desc = source_ ? source_->get_frame_descriptor(id) : std::nullopt;
   if (!desc || line >= desc->height) {
     return nullptr;
   }
-  return p->data() + frame_line_sample_offset(
-                         desc->system, desc->samples_per_line_nominal, line);
+  return (*p)->data() + frame_line_sample_offset(
+                            desc->system, desc->samples_per_line_nominal, line);
 }
 
 // ── Dropout hints
@@ -460,6 +515,98 @@ std::vector<int32_t> StackedVideoFrameRepresentation::get_audio_samples(
   return result;
 }
 
+bool StackedVideoFrameRepresentation::read_audio(size_t pair,
+                                                 uint64_t start_pair,
+                                                 size_t count,
+                                                 int32_t* out) const {
+  std::fill(out, out + count * 2, 0);
+  const auto ref = reference_audio_source();
+  if (!ref || pair >= ref->audio_channel_pair_count()) return false;
+  const auto params = get_video_parameters();
+  const VideoSystem system = params ? params->system : VideoSystem::Unknown;
+  if (audio_pairs_in_frame(0, system) == 0) return false;
+
+  const bool disabled = stage_->m_audio_stacking_mode ==
+                        StackerStage::AudioStackingMode::DISABLED;
+  const bool stacked = pair_in_all_sources(pair) && !disabled;
+  // Per-source slices and the per-sample value list are reused across every
+  // frame of the range.
+  std::vector<std::vector<int32_t>> slices(stacked ? sources_.size() : 0);
+  std::vector<size_t> slice_pairs(slices.size());
+  std::vector<int32_t> vals;
+  vals.reserve(sources_.size());
+  bool complete = true;
+
+  for_each_audio_frame_span(
+      start_pair, count, system,
+      [&](uint64_t frame, size_t within, size_t pairs, size_t at) {
+        int32_t* dst = out + at * 2;
+        if (!has_frame(frame)) {
+          complete = false;
+          return;
+        }
+        const auto src_ids = collect_source_frame_ids(frame);
+        const size_t best = get_best_source_index(frame);
+        auto carries = [&](size_t i) {
+          return i < sources_.size() && sources_[i] &&
+                 src_ids[i] != UINT64_MAX &&
+                 pair < sources_[i]->audio_channel_pair_count();
+        };
+        // Reads pairs [within, within + n) of source |i|'s frame window,
+        // clipped to that window's length.
+        auto read_slice = [&](size_t i, size_t n, int32_t* slice) {
+          const size_t window = audio_pairs_in_frame(src_ids[i], system);
+          const size_t take =
+              within < window ? std::min(n, window - within) : 0;
+          if (take > 0) {
+            sources_[i]->read_audio(
+                pair, audio_pair_offset(src_ids[i], system) + within, take,
+                slice);
+          }
+          return take;
+        };
+
+        if (!stacked) {
+          // Pass through from the best source (falling back to the first
+          // source that carries the frame unless stacking is disabled), as
+          // get_audio_samples() does.
+          size_t chosen = carries(best) ? best : sources_.size();
+          for (size_t i = 0;
+               !disabled && chosen == sources_.size() && i < sources_.size();
+               ++i) {
+            if (carries(i)) chosen = i;
+          }
+          if (chosen == sources_.size()) {
+            complete = false;
+            return;
+          }
+          read_slice(chosen, pairs, dst);
+          return;
+        }
+
+        size_t contributing = 0;
+        for (size_t i = 0; i < sources_.size(); ++i) {
+          slice_pairs[i] = 0;
+          if (!carries(i) || !sources_[i]->has_frame(src_ids[i])) continue;
+          slices[i].assign(pairs * 2, 0);
+          slice_pairs[i] = read_slice(i, pairs, slices[i].data());
+          if (slice_pairs[i] > 0) ++contributing;
+        }
+        if (contributing == 0) {
+          complete = false;
+          return;
+        }
+        for (size_t v = 0; v < pairs * 2; ++v) {
+          vals.clear();
+          for (size_t i = 0; i < sources_.size(); ++i) {
+            if (v < slice_pairs[i] * 2) vals.push_back(slices[i][v]);
+          }
+          dst[v] = vals.empty() ? 0 : stage_->combine_audio(vals);
+        }
+      });
+  return complete;
+}
+
 // ── EFM ──────────────────────────────────────────────────────────────────────
 
 bool StackedVideoFrameRepresentation::has_efm() const {
@@ -635,7 +782,9 @@ void StackerStage::stack_frame(
   output_samples.resize(total, static_cast<sample_type>(black_level));
   output_dropouts.clear();
 
-  std::vector<std::vector<sample_type>> all_frames(sources.size());
+  // Frames are held through shared handles rather than copied; the buffers
+  // stay valid while the worker threads read them.
+  std::vector<SharedSampleBuffer> all_frames(sources.size());
   std::vector<bool> frame_valid(sources.size(), false);
   std::vector<std::vector<DropoutRun>> all_dropouts(sources.size());
 
@@ -650,10 +799,11 @@ void StackerStage::stack_frame(
     if (!d || d->is_padding_frame) {
       continue;
     }
-    all_frames[i] = sources[i]->get_frame_copy(source_ids[i]);
-    if (!all_frames[i].empty()) {
+    const FrameHandle frame = sources[i]->acquire_frame(source_ids[i]);
+    if (frame && frame->samples && !frame->samples->empty()) {
+      all_frames[i] = frame->samples;
       frame_valid[i] = true;
-      all_dropouts[i] = sources[i]->get_dropout_hints(source_ids[i]);
+      all_dropouts[i] = frame->dropouts;
     }
   }
 
@@ -750,8 +900,8 @@ void StackerStage::stack_frame_yc(
   output_chroma.resize(total, static_cast<sample_type>(black_level));
   output_dropouts.clear();
 
-  std::vector<std::vector<sample_type>> all_luma(sources.size());
-  std::vector<std::vector<sample_type>> all_chroma(sources.size());
+  std::vector<SharedSampleBuffer> all_luma(sources.size());
+  std::vector<SharedSampleBuffer> all_chroma(sources.size());
   std::vector<bool> frame_valid(sources.size(), false);
   std::vector<std::vector<DropoutRun>> all_dropouts(sources.size());
 
@@ -766,15 +916,14 @@ void StackerStage::stack_frame_yc(
     if (!d || d->is_padding_frame) {
       continue;
     }
-    const sample_type* lp = sources[i]->get_frame_luma(source_ids[i]);
-    const sample_type* cp = sources[i]->get_frame_chroma(source_ids[i]);
-    if (!lp || !cp) {
+    const FrameHandle frame = sources[i]->acquire_frame(source_ids[i]);
+    if (!frame || !frame->luma || !frame->chroma) {
       continue;
     }
-    all_luma[i].assign(lp, lp + total);
-    all_chroma[i].assign(cp, cp + total);
+    all_luma[i] = frame->luma;
+    all_chroma[i] = frame->chroma;
     frame_valid[i] = true;
-    all_dropouts[i] = sources[i]->get_dropout_hints(source_ids[i]);
+    all_dropouts[i] = frame->dropouts;
   }
 
   size_t n_threads = static_cast<size_t>(m_thread_count);
@@ -852,7 +1001,7 @@ bool is_sample_dropout(const std::vector<DropoutRun>& runs, size_t line,
 
 void StackerStage::process_lines_range(
     size_t start_line, size_t end_line, size_t width, VideoSystem system,
-    const std::vector<std::vector<sample_type>>& all_frames,
+    const std::vector<SharedSampleBuffer>& all_frames,
     const std::vector<bool>& frame_valid,
     const std::vector<std::vector<DropoutRun>>& all_dropouts,
     size_t num_sources, int32_t black_level, int32_t /*nominal_width*/,
@@ -872,10 +1021,10 @@ void StackerStage::process_lines_range(
 
       const size_t off = line_base + x;
       for (size_t si = 0; si < num_sources; ++si) {
-        if (!frame_valid[si] || off >= all_frames[si].size()) {
+        if (!frame_valid[si] || off >= all_frames[si]->size()) {
           continue;
         }
-        int16_t val = all_frames[si][off];
+        int16_t val = (*all_frames[si])[off];
         bool do_flag = is_sample_dropout(all_dropouts[si], y, x, width, system);
         is_do[si] = do_flag;
         if (!do_flag) {
@@ -937,8 +1086,8 @@ void StackerStage::process_lines_range(
 
 void StackerStage::process_lines_range_yc(
     size_t start_line, size_t end_line, size_t width, VideoSystem system,
-    const std::vector<std::vector<sample_type>>& all_luma,
-    const std::vector<std::vector<sample_type>>& all_chroma,
+    const std::vector<SharedSampleBuffer>& all_luma,
+    const std::vector<SharedSampleBuffer>& all_chroma,
     const std::vector<bool>& frame_valid,
     const std::vector<std::vector<DropoutRun>>& all_dropouts,
     size_t num_sources, int32_t black_level, int32_t /*nominal_width*/,
@@ -959,15 +1108,15 @@ void StackerStage::process_lines_range_yc(
 
       const size_t off = line_base + x;
       for (size_t si = 0; si < num_sources; ++si) {
-        if (!frame_valid[si] || off >= all_luma[si].size()) {
+        if (!frame_valid[si] || off >= all_luma[si]->size()) {
           continue;
         }
         bool do_flag = is_sample_dropout(all_dropouts[si], y, x, width, system);
         is_do[si] = do_flag;
         if (!do_flag) {
-          good_luma.push_back(all_luma[si][off]);
-          if (off < all_chroma[si].size()) {
-            good_chroma.push_back(all_chroma[si][off]);
+          good_luma.push_back((*all_luma[si])[off]);
+          if (off < all_chroma[si]->size()) {
+            good_chroma.push_back((*all_chroma[si])[off]);
           }
         }
       }
@@ -1135,22 +1284,25 @@ std::vector<int32_t> StackerStage::stack_audio(
 
   size_t n = all_audio[0].size();
   std::vector<int32_t> result(n);
+  std::vector<int32_t> vals;
+  vals.reserve(all_audio.size());
   for (size_t si = 0; si < n; ++si) {
-    std::vector<int32_t> vals;
+    vals.clear();
     for (const auto& a : all_audio) {
       if (si < a.size()) {
         vals.push_back(a[si]);
       }
     }
-    if (m_audio_stacking_mode == AudioStackingMode::MEDIAN) {
-      result[si] = audio_median(vals);
-    } else {
-      result[si] = audio_mean(vals);
-    }
+    result[si] = combine_audio(vals);
   }
   return result;
 }
 
+int32_t StackerStage::combine_audio(std::vector<int32_t>& vals) const {
+  return m_audio_stacking_mode == AudioStackingMode::MEDIAN ? audio_median(vals)
+                                                            : audio_mean(vals);
+}
+
 std::vector<uint8_t> StackerStage::stack_efm(
     const std::vector<FrameID>& source_ids,
     const std::vector<std::shared_ptr<const VideoFrameRepresentation>>& sources,
@@ -1225,7 +1377,7 @@ int32_t StackerStage::audio_mean(const std::vector<int32_t>& v) const {
   return saturate_audio_24bit(s / static_cast<int64_t>(v.size()));
 }
 
-int32_t StackerStage::audio_median(std::vector<int32_t> v) const {
+int32_t StackerStage::audio_median(std::vector<int32_t>& v) const {
   if (v.empty()) {
     return 0;
   }
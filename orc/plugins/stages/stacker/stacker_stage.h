@@ -13,6 +13,7 @@
 #include <orc/plugin/orc_stage_runtime.h>
 #include <orc/stage/dropout/dropout_run.h>
 #include <orc/stage/frame_descriptor.h>
+#include <orc/stage/frame_handle.h>
 #include <orc/stage/frame_id.h>
 #include <orc/stage/params/stage_parameter.h>
 #include <orc/stage/video_frame_representation.h>
@@ -68,6 +69,7 @@ class StackedVideoFrameRepresentation : public VideoFrameRepresentationWrapper,
   const sample_type* get_frame(FrameID id) const override;
   const sample_type* get_line(FrameID id, size_t line) const override;
   std::vector<sample_type> get_frame_copy(FrameID id) const override;
+  FrameHandle acquire_frame(FrameID id) const override;
 
   // YC
   bool has_separate_channels() const override;
@@ -90,6 +92,11 @@ class StackedVideoFrameRepresentation : public VideoFrameRepresentationWrapper,
       size_t pair) const override;
   std::vector<int32_t> get_audio_samples(size_t pair,
                                          FrameID id) const override;
+  // Streams the same result over a range: each frame's slice is read from
+  // every contributing source with read_audio() and combined in place,
+  // bypassing the per-frame audio cache.
+  bool read_audio(size_t pair, uint64_t start_pair, size_t count,
+                  int32_t* out) const override;
 
   // EFM
   bool has_efm() const override;
@@ -109,11 +116,13 @@ class StackedVideoFrameRepresentation : public VideoFrameRepresentationWrapper,
   std::vector<std::shared_ptr<const VideoFrameRepresentation>> sources_;
   StackerStage* stage_;
 
-  // LRU caches for stacked frames — composite and YC paths
   static constexpr size_t kMaxCachedFrames = 300;
-  mutable LRUCache<FrameID, std::vector<sample_type>> stacked_frames_;
-  mutable LRUCache<FrameID, std::vector<sample_type>> stacked_luma_;
-  mutable LRUCache<FrameID, std::vector<sample_type>> stacked_chroma_;
+  using FrameCache = LRUCache<FrameID, SharedSampleBuffer>;
+  // LRU caches for stacked frames — composite and YC paths. Sample buffers
+  // are shared so acquire_frame() handles outlive eviction.
+  mutable FrameCache stacked_frames_;
+  mutable FrameCache stacked_luma_;
+  mutable FrameCache stacked_chroma_;
   mutable LRUCache<FrameID, std::vector<DropoutRun>> stacked_dropouts_;
   mutable LRUCache<FrameID, std::vector<int32_t>> stacked_audio_;
   mutable LRUCache<FrameID, std::vector<uint8_t>> stacked_efm_;
@@ -127,6 +136,10 @@ class StackedVideoFrameRepresentation : public VideoFrameRepresentationWrapper,
   // Ensure both YC stacked frames are in cache (must hold cache_mutex_)
   void ensure_frame_stacked_yc(FrameID id) const;
 
+  // Empty output buffer with capacity for one frame, drawn from the host
+  // frame buffer pool (a plain empty vector without a pool)
+  std::shared_ptr<std::vector<sample_type>> pooled_frame_buffer() const;
+
   // Find the source index with the fewest dropout samples for this frame
   size_t get_best_source_index(FrameID id) const;
 
@@ -250,10 +263,11 @@ class StackerStage : public DAGStage,
   std::vector<int16_t> diff_dod(const std::vector<int16_t>& input,
                                 int32_t black_level) const;
 
-  // Line processing (parallel-friendly)
+  // Line processing (parallel-friendly). Source frames are held through
+  // acquire_frame() buffers, shared with the upstream caches.
   void process_lines_range(
       size_t start_line, size_t end_line, size_t width, VideoSystem system,
-      const std::vector<std::vector<sample_type>>& all_frames,
+      const std::vector<SharedSampleBuffer>& all_frames,
       const std::vector<bool>& frame_valid,
       const std::vector<std::vector<DropoutRun>>& all_dropouts,
       size_t num_sources, int32_t black_level, int32_t nominal_width,
@@ -263,8 +277,8 @@ class StackerStage : public DAGStage,
 
   void process_lines_range_yc(
       size_t start_line, size_t end_line, size_t width, VideoSystem system,
-      const std::vector<std::vector<sample_type>>& all_luma,
-      const std::vector<std::vector<sample_type>>& all_chroma,
+      const std::vector<SharedSampleBuffer>& all_luma,
+      const std::vector<SharedSampleBuffer>& all_chroma,
       const std::vector<bool>& frame_valid,
       const std::vector<std::vector<DropoutRun>>& all_dropouts,
       size_t num_sources, int32_t black_level, int32_t nominal_width,
@@ -288,8 +302,11 @@ class StackerStage : public DAGStage,
           sources,
       size_t best_src) const;
 
+  // Mean or median of one sample's values per audio_stacking; |vals| is
+  // scratch and may be reordered.
+  int32_t combine_audio(std::vector<int32_t>& vals) const;
   int32_t audio_mean(const std::vector<int32_t>& v) const;
-  int32_t audio_median(std::vector<int32_t> v) const;
+  int32_t audio_median(std::vector<int32_t>& v) const;
   uint8_t efm_mean(const std::vector<uint8_t>& v) const;
   uint8_t efm_median(std::vector<uint8_t> v) const;
 };
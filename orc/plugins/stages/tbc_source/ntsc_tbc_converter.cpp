@@ -36,9 +36,18 @@ int16_t NtscTBCConverter::tbc_to_cvbs(uint16_t tbc_sample, int32_t tbc_blanking,
 // ---------------------------------------------------------------------------
 
 std::vector<int16_t> NtscTBCConverter::assemble_frame(
+    const std::vector<uint16_t>& tbc_field1,
+    const std::vector<uint16_t>& tbc_field2, int32_t tbc_blanking,
+    int32_t tbc_white) {
+  std::vector<int16_t> frame;
+  assemble_frame_into(tbc_field1, tbc_field2, tbc_blanking, tbc_white, frame);
+  return frame;
+}
+
+void NtscTBCConverter::assemble_frame_into(
     const std::vector<uint16_t>& tbc_field1,  // 263 × 910 samples
     const std::vector<uint16_t>& tbc_field2,  // 262 × 910 samples
-    int32_t tbc_blanking, int32_t tbc_white) {
+    int32_t tbc_blanking, int32_t tbc_white, std::vector<int16_t>& frame) {
   // SMPTE 244M-2003 §4.1 / SMPTE 170M-2004 §11.3: NTSC frame assembly.
   // TBC field ordering (ld-decode convention for NTSC):
   //   TBC field 1 (even file index) = odd-scan/first temporal, 263 real lines
@@ -61,19 +70,17 @@ std::vector<int16_t> NtscTBCConverter::assemble_frame(
         "NtscTBCConverter::assemble_frame: unexpected field sample counts");
   }
 
-  std::vector<int16_t> frame;
-  frame.reserve(static_cast<size_t>(kNtscFrameSamples));
+  frame.resize(static_cast<size_t>(kNtscFrameSamples));
+  int16_t* out = frame.data();
 
   // VFR field 1 (top, 263 lines) ← TBC field 1 (odd-scan, first temporal)
   for (const uint16_t s : tbc_field1) {
-    frame.push_back(tbc_to_cvbs(s, tbc_blanking, tbc_white));
+    *out++ = tbc_to_cvbs(s, tbc_blanking, tbc_white);
   }
   // VFR field 2 (bottom, 262 lines) ← TBC field 2 (even-scan, second temporal)
   for (const uint16_t s : tbc_field2) {
-    frame.push_back(tbc_to_cvbs(s, tbc_blanking, tbc_white));
+    *out++ = tbc_to_cvbs(s, tbc_blanking, tbc_white);
   }
-
-  return frame;
 }
 
 // ---------------------------------------------------------------------------
@@ -36,9 +36,18 @@ int16_t PalMTBCConverter::tbc_to_cvbs(uint16_t tbc_sample, int32_t tbc_blanking,
 // ---------------------------------------------------------------------------
 
 std::vector<int16_t> PalMTBCConverter::assemble_frame(
+    const std::vector<uint16_t>& tbc_field1,
+    const std::vector<uint16_t>& tbc_field2, int32_t tbc_blanking,
+    int32_t tbc_white) {
+  std::vector<int16_t> frame;
+  assemble_frame_into(tbc_field1, tbc_field2, tbc_blanking, tbc_white, frame);
+  return frame;
+}
+
+void PalMTBCConverter::assemble_frame_into(
     const std::vector<uint16_t>& tbc_field1,  // 263 × 909 samples
     const std::vector<uint16_t>& tbc_field2,  // 262 × 909 samples
-    int32_t tbc_blanking, int32_t tbc_white) {
+    int32_t tbc_blanking, int32_t tbc_white, std::vector<int16_t>& frame) {
   // ITU-R BT.1700-1 Annex 1 Part B §1: PAL_M frame assembly.
   // TBC field ordering (ld-decode convention, identical to NTSC):
   //   TBC field 1 (even file index) = odd-scan/first temporal, 263 real lines
@@ -61,19 +70,17 @@ std::vector<int16_t> PalMTBCConverter::assemble_frame(
         "PalMTBCConverter::assemble_frame: unexpected field sample counts");
   }
 
-  std::vector<int16_t> frame;
-  frame.reserve(static_cast<size_t>(kPalMFrameSamples));
+  frame.resize(static_cast<size_t>(kPalMFrameSamples));
+  int16_t* out = frame.data();
 
   // VFR field 1 (top, 263 lines) ← TBC field 1 (odd-scan, first temporal)
   for (const uint16_t s : tbc_field1) {
-    frame.push_back(tbc_to_cvbs(s, tbc_blanking, tbc_white));
+    *out++ = tbc_to_cvbs(s, tbc_blanking, tbc_white);
   }
   // VFR field 2 (bottom, 262 lines) ← TBC field 2 (even-scan, second temporal)
   for (const uint16_t s : tbc_field2) {
-    frame.push_back(tbc_to_cvbs(s, tbc_blanking, tbc_white));
+    *out++ = tbc_to_cvbs(s, tbc_blanking, tbc_white);
   }
-
-  return frame;
 }
 
 // ---------------------------------------------------------------------------
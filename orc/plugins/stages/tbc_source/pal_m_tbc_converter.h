@@ -74,6 +74,14 @@ class PalMTBCConverter {
       const std::vector<uint16_t>& tbc_field2,  // 262 × 909 samples
       int32_t tbc_blanking, int32_t tbc_white);
 
+  // As assemble_frame(), writing into |frame| (resized to the frame sample
+  // count; existing capacity is reused) so callers can assemble into a
+  // recycled buffer.
+  static void assemble_frame_into(
+      const std::vector<uint16_t>& tbc_field1,  // 263 × 909 samples
+      const std::vector<uint16_t>& tbc_field2,  // 262 × 909 samples
+      int32_t tbc_blanking, int32_t tbc_white, std::vector<int16_t>& frame);
+
   // -------------------------------------------------------------------------
   // Colour frame sequence
   // -------------------------------------------------------------------------
@@ -35,15 +35,15 @@ int16_t PalTBCConverter::tbc_to_cvbs(uint16_t tbc_sample, int32_t tbc_blanking,
 // Private helpers: linear interpolation of extra PAL samples
 // ---------------------------------------------------------------------------
 
-// Append 2 linearly-interpolated bridge samples at t=1/3 and t=2/3.
+// Write 2 linearly-interpolated bridge samples at t=1/3 and t=2/3 to |out|.
 // EBU Tech. 3280-E §1.3.1: the two extra samples on lines 312 and 624 bridge
 // the signal from the last nominal sample to the first sample of the next line.
-static void append_two_extra_samples(std::vector<int16_t>& buf, int16_t last,
-                                     int16_t first_next) {
+static void write_two_extra_samples(int16_t* out, int16_t last,
+                                    int16_t first_next) {
   const int32_t a = static_cast<int32_t>(last);
   const int32_t b = static_cast<int32_t>(first_next);
-  buf.push_back(static_cast<int16_t>((2 * a + b) / 3));
-  buf.push_back(static_cast<int16_t>((a + 2 * b) / 3));
+  out[0] = static_cast<int16_t>((2 * a + b) / 3);
+  out[1] = static_cast<int16_t>((a + 2 * b) / 3);
 }
 
 // ---------------------------------------------------------------------------
@@ -51,9 +51,18 @@ static void append_two_extra_samples(std::vector<int16_t>& buf, int16_t last,
 // ---------------------------------------------------------------------------
 
 std::vector<int16_t> PalTBCConverter::assemble_frame(
+    const std::vector<uint16_t>& tbc_field1,
+    const std::vector<uint16_t>& tbc_field2, int32_t tbc_blanking,
+    int32_t tbc_white) {
+  std::vector<int16_t> frame;
+  assemble_frame_into(tbc_field1, tbc_field2, tbc_blanking, tbc_white, frame);
+  return frame;
+}
+
+void PalTBCConverter::assemble_frame_into(
     const std::vector<uint16_t>& tbc_field1,  // 313 lines × 1135 samples
     const std::vector<uint16_t>& tbc_field2,  // 312 lines × 1135 samples
-    int32_t tbc_blanking, int32_t tbc_white) {
+    int32_t tbc_blanking, int32_t tbc_white, std::vector<int16_t>& frame) {
   // TBC field ordering (EBU Tech. 3280-E §1.3 / ld-decode PAL convention):
   //   TBC field 1 = odd-scan (earlier temporal), 313 lines → CVBS field 1
   //   TBC field 2 = even-scan (later temporal),  312 lines → CVBS field 2
@@ -75,62 +84,31 @@ std::vector<int16_t> PalTBCConverter::assemble_frame(
         "PalTBCConverter::assemble_frame: unexpected field sample counts");
   }
 
-  // Pre-convert all field samples to CVBS domain.
-  std::vector<int16_t> cvbs1(expected_field1);
-  std::vector<int16_t> cvbs2(expected_field2);
-
-  for (size_t i = 0; i < expected_field1; ++i) {
-    cvbs1[i] = tbc_to_cvbs(tbc_field1[i], tbc_blanking, tbc_white);
-  }
-  for (size_t i = 0; i < expected_field2; ++i) {
-    cvbs2[i] = tbc_to_cvbs(tbc_field2[i], tbc_blanking, tbc_white);
-  }
-
-  // Build flat frame buffer: [CVBS field 1 (313 lines)] [CVBS field 2 (312
-  // lines)] with 2 extra interpolated samples appended to the last line of
-  // each field (frame-flat lines 312 and 624) per EBU Tech. 3280-E §1.3.1.
-  std::vector<int16_t> frame;
-  frame.reserve(static_cast<size_t>(kPalFrameSamples));
+  // Flat frame buffer: [CVBS field 1 (313 lines)] [CVBS field 2 (312 lines)]
+  // with 2 extra interpolated samples appended to the last line of each field
+  // (frame-flat lines 312 and 624) per EBU Tech. 3280-E §1.3.1. Fields are
+  // stored line-contiguously, so each field converts as one run straight into
+  // the output.
+  frame.resize(static_cast<size_t>(kPalFrameSamples));
+  int16_t* out = frame.data();
 
   // ---- CVBS field 1: sourced from TBC field 1 (313 lines, odd-scan) ----
-  for (int32_t line = 0; line < kField1Lines; ++line) {
-    const size_t src_start =
-        static_cast<size_t>(line) * static_cast<size_t>(kLineWidth);
-
-    frame.insert(
-        frame.end(), cvbs1.begin() + static_cast<ptrdiff_t>(src_start),
-        cvbs1.begin() + static_cast<ptrdiff_t>(
-                            src_start + static_cast<size_t>(kLineWidth)));
-
-    // Frame-flat line 312 (last of field 1) gets 2 extra bridge samples.
-    if (line == kField1Lines - 1) {
-      const int16_t last_this =
-          cvbs1[src_start + static_cast<size_t>(kLineWidth) - 1];
-      const int16_t first_next = cvbs2[0];  // first sample of CVBS field 2
-      append_two_extra_samples(frame, last_this, first_next);
-    }
+  for (const uint16_t s : tbc_field1) {
+    *out++ = tbc_to_cvbs(s, tbc_blanking, tbc_white);
   }
+  // Frame-flat line 312 (last of field 1) gets 2 extra bridge samples toward
+  // the first sample of CVBS field 2.
+  write_two_extra_samples(out, *(out - 1),
+                          tbc_to_cvbs(tbc_field2[0], tbc_blanking, tbc_white));
+  out += 2;
 
   // ---- CVBS field 2: sourced from TBC field 2 (312 lines, even-scan) ----
-  for (int32_t line = 0; line < kField2Lines; ++line) {
-    const size_t src_start =
-        static_cast<size_t>(line) * static_cast<size_t>(kLineWidth);
-
-    frame.insert(
-        frame.end(), cvbs2.begin() + static_cast<ptrdiff_t>(src_start),
-        cvbs2.begin() + static_cast<ptrdiff_t>(
-                            src_start + static_cast<size_t>(kLineWidth)));
-
-    // Frame-flat line 624 (last of field 2) gets 2 extra bridge samples.
-    // No following line in this frame; bridge toward the last sample itself.
-    if (line == kField2Lines - 1) {
-      const int16_t last_this =
-          cvbs2[src_start + static_cast<size_t>(kLineWidth) - 1];
-      append_two_extra_samples(frame, last_this, last_this);
-    }
+  for (const uint16_t s : tbc_field2) {
+    *out++ = tbc_to_cvbs(s, tbc_blanking, tbc_white);
   }
-
-  return frame;
+  // Frame-flat line 624 (last of field 2) gets 2 extra bridge samples.
+  // No following line in this frame; bridge toward the last sample itself.
+  write_two_extra_samples(out, *(out - 1), *(out - 1));
 }
 
 // ---------------------------------------------------------------------------
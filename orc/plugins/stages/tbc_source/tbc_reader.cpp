@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <numeric>
 #include <stdexcept>
 
 #ifdef _WIN32
@@ -38,11 +39,28 @@ ssize_t pread(int fd, void* buf, size_t count, __int64 offset) {
   }
   return _read(fd, buf, static_cast<unsigned int>(count));
 }
+struct iovec {
+  void* iov_base;
+  size_t iov_len;
+};
+// Nor preadv: read the segments one after another under the same mutex.
+ssize_t preadv(int fd, const iovec* iov, int iovcnt, __int64 offset) {
+  ssize_t total = 0;
+  for (int i = 0; i < iovcnt; ++i) {
+    const ssize_t n = pread(fd, iov[i].iov_base, iov[i].iov_len,
+                            offset + static_cast<__int64>(total));
+    if (n < 0) return n;
+    total += n;
+    if (static_cast<size_t>(n) != iov[i].iov_len) break;
+  }
+  return total;
+}
 }  // namespace
 #else
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
 
@@ -204,4 +222,90 @@ std::vector<TBCReader::sample_type> TBCReader::read_line(FieldID field_id,
   return read_field_lines(field_id, line_number, line_number + 1);
 }
 
+size_t TBCReader::read_sample_runs(const std::vector<SampleRun>& runs,
+                                   std::vector<sample_type>& out) {
+  if (!is_open_) {
+    throw std::runtime_error("TBC file not open");
+  }
+
+  // Destination of each run in |out|, and the runs in file order
+  std::vector<size_t> out_offsets(runs.size());
+  size_t total_samples = 0;
+  for (size_t i = 0; i < runs.size(); ++i) {
+    const auto& run = runs[i];
+    if (!run.field_id.is_valid() ||
+        run.sample_offset + run.sample_count > field_length_ ||
+        (field_count_ > 0 && run.field_id.value() >= field_count_)) {
+      throw std::out_of_range("Sample run outside the TBC file");
+    }
+    out_offsets[i] = total_samples;
+    total_samples += run.sample_count;
+  }
+  out.resize(total_samples);
+
+  auto file_position = [this](const SampleRun& run) {
+    return static_cast<uint64_t>(run.field_id.value()) * field_byte_length_ +
+           static_cast<uint64_t>(run.sample_offset) * sizeof(sample_type);
+  };
+  std::vector<size_t> order(runs.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return file_position(runs[a]) < file_position(runs[b]);
+  });
+
+  // Keeps each vectored read well under IOV_MAX (1024 on Linux)
+  constexpr size_t kMaxRunsPerRead = 256;
+  std::vector<char> gap_scratch(kMaxCoalesceGapBytes);
+  std::vector<iovec> iov;
+  iov.reserve(kMaxRunsPerRead * 2);
+  size_t bytes_read_total = 0;
+
+  size_t next = 0;
+  while (next < order.size()) {
+    const uint64_t start = file_position(runs[order[next]]);
+    uint64_t end = start;
+    iov.clear();
+    size_t in_read = 0;
+    while (next < order.size() && in_read < kMaxRunsPerRead) {
+      const auto& run = runs[order[next]];
+      const uint64_t position = file_position(run);
+      const size_t bytes = run.sample_count * sizeof(sample_type);
+      if (position < end) {
+        // Overlapping runs are read separately
+        if (in_read > 0) break;
+      } else if (position - end > kMaxCoalesceGapBytes && in_read > 0) {
+        break;
+      } else if (position > end) {
+        const auto gap = static_cast<size_t>(position - end);
+        iov.push_back({gap_scratch.data(), gap});
+      }
+      iov.push_back({out.data() + out_offsets[order[next]], bytes});
+      end = position + bytes;
+      ++in_read;
+      ++next;
+    }
+
+    const uint64_t span = end - start;
+#ifdef _WIN32
+    ssize_t bytes_read = preadv(fd_, iov.data(), static_cast<int>(iov.size()),
+                                static_cast<__int64>(start));
+#else
+    if (end > static_cast<uint64_t>(std::numeric_limits<off_t>::max())) {
+      throw std::out_of_range(
+          "Field byte offset exceeds platform file offset range");
+    }
+    ssize_t bytes_read = preadv(fd_, iov.data(), static_cast<int>(iov.size()),
+                                static_cast<off_t>(start));
+#endif
+    if (bytes_read < 0) {
+      throw std::runtime_error("Failed to read lines from file: " + filename_);
+    }
+    if (static_cast<uint64_t>(bytes_read) != span) {
+      throw std::runtime_error("Short read from file: " + filename_);
+    }
+    bytes_read_total += static_cast<size_t>(span);
+  }
+  return bytes_read_total;
+}
+
 }  // namespace orc
@@ -42,6 +42,32 @@ class TBCReader {
                                             size_t end_line);
   std::vector<sample_type> read_line(FieldID field_id, size_t line_number);
 
+  /// A run of consecutive samples at a field-relative offset.
+  struct SampleRun {
+    FieldID field_id;
+    size_t sample_offset;
+    size_t sample_count;
+  };
+
+  /**
+   * @brief Read many short sample runs in a few coalesced reads
+   *
+   * Runs are visited in file order; runs whose gap is at most
+   * kMaxCoalesceGapBytes share one vectored read (preadv) that scatters the
+   * gap into a scratch buffer, so a sparse-line scan over many fields costs
+   * one system call per cluster of lines rather than one per line or a full
+   * field each. Bypasses the field cache.
+   *
+   * @param runs Runs to read, in any order
+   * @param out Receives the samples of each run back to back, in the order
+   *        of @p runs
+   * @return Bytes read from the file, gaps included
+   */
+  size_t read_sample_runs(const std::vector<SampleRun>& runs,
+                          std::vector<sample_type>& out);
+
+  static constexpr size_t kMaxCoalesceGapBytes = 32 * 1024;
+
  private:
   int fd_;
   std::string filename_;
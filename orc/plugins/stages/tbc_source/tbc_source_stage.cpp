@@ -9,9 +9,13 @@
 
 #include "tbc_source_stage.h"
 
+#include <orc/abi/orc_plugin_services.h>
 #include <orc/stage/audio/audio_channel_pair.h>
 #include <orc/stage/cvbs_signal_constants.h>
 #include <orc/stage/error_types.h>
+#include <orc/stage/frame_buffer_pool.h>
+#include <orc/stage/metrics.h>
+#include <orc/stage/trace.h>
 #include <orc/support/dropout_util.h>
 #include <orc/support/frame_line_util.h>
 #include <orc/support/logging.h>
@@ -181,6 +185,8 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
     compute_audio_total_raw_pairs();
     compute_efm_offsets();
     compute_ac3_offsets();
+    frame_cache_.bind_metrics(plugin::get_metrics(), "tbc_source.frames",
+                              FrameCache::CountedLookup::kContains);
   }
 
   // --------------------------------------------------------------------------
@@ -232,8 +238,8 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
   const sample_type* get_frame(FrameID id) const override {
     if (!has_frame(id)) return nullptr;
     ensure_frame_cached(id);
-    const CachedFrame* cf = frame_cache_.get_ptr(id);
-    return cf ? cf->samples.data() : nullptr;
+    const auto* cf = frame_cache_.get_ptr(id);
+    return cf ? (*cf)->samples->data() : nullptr;
   }
 
   std::vector<sample_type> get_frame_copy(FrameID id) const override {
@@ -243,6 +249,20 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
     return std::vector<sample_type>(ptr, ptr + frame_samples_total());
   }
 
+  // Shares the cached buffers: the handle keeps them alive after eviction,
+  // so no samples are copied.
+  FrameHandle acquire_frame(FrameID id) const override {
+    if (!has_frame(id)) return nullptr;
+    const auto cf = cached_frame(id);
+    auto frame = std::make_shared<AcquiredFrame>();
+    frame->frame_id = id;
+    frame->samples = cf->samples;
+    frame->luma = cf->luma;
+    frame->chroma = cf->chroma;
+    frame->dropouts = get_dropout_hints(id);
+    return frame;
+  }
+
   // --------------------------------------------------------------------------
   // YC channels
   // --------------------------------------------------------------------------
@@ -251,15 +271,15 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
   const sample_type* get_frame_luma(FrameID id) const override {
     if (!is_yc_ || !has_frame(id)) return nullptr;
     ensure_frame_cached(id);
-    const CachedFrame* cf = frame_cache_.get_ptr(id);
-    return (cf && !cf->luma.empty()) ? cf->luma.data() : nullptr;
+    const auto* cf = frame_cache_.get_ptr(id);
+    return (cf && (*cf)->luma) ? (*cf)->luma->data() : nullptr;
   }
 
   const sample_type* get_frame_chroma(FrameID id) const override {
     if (!is_yc_ || !has_frame(id)) return nullptr;
     ensure_frame_cached(id);
-    const CachedFrame* cf = frame_cache_.get_ptr(id);
-    return (cf && !cf->chroma.empty()) ? cf->chroma.data() : nullptr;
+    const auto* cf = frame_cache_.get_ptr(id);
+    return (cf && (*cf)->chroma) ? (*cf)->chroma->data() : nullptr;
   }
 
   const sample_type* get_line_luma(FrameID id, size_t line) const override {
@@ -365,6 +385,30 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
     return audio_frames_[idx];
   }
 
+  bool read_audio(size_t pair, uint64_t start_pair, size_t count,
+                  int32_t* out) const override {
+    std::fill(out, out + count * 2, 0);
+    const VideoSystem system = source_params_.system;
+    if (pair != 0 || !has_audio_ || audio_pairs_in_frame(0, system) == 0) {
+      return false;
+    }
+    ensure_audio_converted();
+    bool complete = true;
+    for_each_audio_frame_span(
+        start_pair, count, system,
+        [&](uint64_t frame, size_t within, size_t pairs, size_t at) {
+          const size_t idx = static_cast<size_t>(frame);
+          if (!has_frame(frame) || idx >= audio_frames_.size() ||
+              audio_frames_[idx].size() < (within + pairs) * 2) {
+            complete = false;
+            return;
+          }
+          const int32_t* block = audio_frames_[idx].data() + within * 2;
+          std::copy(block, block + pairs * 2, out + at * 2);
+        });
+    return complete;
+  }
+
   // --------------------------------------------------------------------------
   // EFM
   // --------------------------------------------------------------------------
@@ -426,52 +470,12 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
   std::vector<sample_type> get_line_samples(FrameID id,
                                             size_t line) const override {
     if (!has_frame(id)) return {};
-    if (line >= static_cast<size_t>(source_params_.frame_height)) return {};
-
-    // Determine field geometry per video system.
-    int32_t tbc_field_idx;
-    int32_t field_line;
-    int32_t stored_spl;
-    int32_t stored_field_size;
-    const int32_t frame_idx = static_cast<int32_t>(id);
-
-    switch (video_params_.system) {
-      case VideoSystem::PAL: {
-        constexpr int32_t kF1Lines = kPalField1Lines;          // 313
-        constexpr int32_t kLineW = kPalSamplesPerLineNominal;  // 1135
-        if (line < static_cast<size_t>(kF1Lines)) {
-          tbc_field_idx = frame_idx * 2;
-          field_line = static_cast<int32_t>(line);
-        } else {
-          tbc_field_idx = frame_idx * 2 + 1;
-          field_line = static_cast<int32_t>(line) - kF1Lines;
-        }
-        stored_spl = kLineW;
-        stored_field_size = kF1Lines * kLineW;
-        break;
-      }
-      case VideoSystem::NTSC:
-      case VideoSystem::PAL_M: {
-        // Both 525-line systems store fields at 263 lines; only SPL differs.
-        const int32_t kF1Lines =
-            static_cast<int32_t>(field1_lines(video_params_.system));
-        const int32_t kLineW =
-            samples_per_line_from_system(video_params_.system);
-        if (line < static_cast<size_t>(kF1Lines)) {
-          tbc_field_idx = frame_idx * 2;
-          field_line = static_cast<int32_t>(line);
-        } else {
-          tbc_field_idx = frame_idx * 2 + 1;
-          field_line = static_cast<int32_t>(line) - kF1Lines;
-        }
-        stored_spl = kLineW;
-        stored_field_size = kF1Lines * kLineW;
-        break;
-      }
-      default:
-        return {};
-    }
-
+    const auto geometry = stored_line_geometry();
+    if (!geometry || line >= static_cast<size_t>(source_params_.frame_height))
+      return {};
+    const auto [tbc_field_idx, field_line] =
+        locate_line(*geometry, static_cast<int32_t>(id), line);
+    const int32_t stored_spl = geometry->samples_per_line;
     const int32_t line_sample_offset = field_line * stored_spl;
 
     // Field-level buffer: the first call for a given tbc_field_idx loads the
@@ -483,9 +487,9 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
 
     if (line_buffer_field_idx_ != tbc_field_idx) {
       std::string buf_err;
-      line_buffer_ =
-          deps_->read_field_samples(tbc_path_, tbc_field_idx, stored_field_size,
-                                    stored_field_size, buf_err);
+      line_buffer_ = deps_->read_field_samples(
+          tbc_path_, tbc_field_idx, geometry->stored_field_size,
+          geometry->stored_field_size, buf_err);
       if (line_buffer_.empty()) {
         line_buffer_field_idx_ = -1;
         return {};
@@ -498,7 +502,92 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
       return {};
     }
 
-    // Convert TBC 16-bit unsigned → CVBS_U10_4FSC int16_t.
+    std::vector<sample_type> result(static_cast<size_t>(stored_spl));
+    convert_raw_samples(line_buffer_.data() + offset, result.size(),
+                        result.data());
+    return result;
+  }
+
+  // Whole-range scans (VBI, VITS): every requested line of every frame is
+  // fetched with one batched, coalesced read of just those lines — a few KB
+  // per field — instead of a full field per frame as above.
+  bool read_lines(FrameIDRange frames, const std::vector<size_t>& lines,
+                  std::vector<sample_type>& out) const override {
+    const auto geometry = stored_line_geometry();
+    const bool in_range =
+        !frames.empty() && has_frame(frames.first) && has_frame(frames.last) &&
+        std::all_of(lines.begin(), lines.end(), [this](size_t line) {
+          return line < static_cast<size_t>(source_params_.frame_height);
+        });
+    if (!geometry || !in_range) {
+      return VideoFrameRepresentation::read_lines(frames, lines, out);
+    }
+
+    const int32_t spl = geometry->samples_per_line;
+    std::vector<TBCSampleRun> runs;
+    runs.reserve(frames.count() * lines.size());
+    for (FrameID id = frames.first; id <= frames.last; ++id) {
+      for (const size_t line : lines) {
+        const auto [field_idx, field_line] =
+            locate_line(*geometry, static_cast<int32_t>(id), line);
+        runs.push_back({field_idx, field_line * spl, spl});
+      }
+    }
+
+    std::vector<uint16_t> raw;
+    std::string error;
+    if (!deps_->read_field_runs(tbc_path_, geometry->stored_field_size, runs,
+                                raw, error) ||
+        raw.size() != runs.size() * static_cast<size_t>(spl)) {
+      ORC_LOG_WARN("TBC source: batched line read failed ({}); reading lines "
+                   "individually",
+                   error);
+      return VideoFrameRepresentation::read_lines(frames, lines, out);
+    }
+    out.resize(raw.size());
+    convert_raw_samples(raw.data(), raw.size(), out.data());
+    return true;
+  }
+
+ private:
+  // Layout of one frame's lines within the stored TBC fields.
+  struct StoredLineGeometry {
+    int32_t field1_lines;       // frame lines held by the first field
+    int32_t samples_per_line;   // stored (and returned) line width
+    int32_t stored_field_size;  // samples per stored field
+  };
+
+  std::optional<StoredLineGeometry> stored_line_geometry() const {
+    switch (video_params_.system) {
+      case VideoSystem::PAL:
+        return StoredLineGeometry{kPalField1Lines, kPalSamplesPerLineNominal,
+                                  kPalField1Lines * kPalSamplesPerLineNominal};
+      case VideoSystem::NTSC:
+      case VideoSystem::PAL_M: {
+        // Both 525-line systems store fields at 263 lines; only SPL differs.
+        const int32_t f1_lines =
+            static_cast<int32_t>(field1_lines(video_params_.system));
+        const int32_t spl = samples_per_line_from_system(video_params_.system);
+        return StoredLineGeometry{f1_lines, spl, f1_lines * spl};
+      }
+      default:
+        return std::nullopt;
+    }
+  }
+
+  // (TBC field index, line within that field) holding frame line |line|.
+  static std::pair<int32_t, int32_t> locate_line(
+      const StoredLineGeometry& geometry, int32_t frame_idx, size_t line) {
+    const int32_t frame_line = static_cast<int32_t>(line);
+    if (frame_line < geometry.field1_lines) {
+      return {frame_idx * 2, frame_line};
+    }
+    return {frame_idx * 2 + 1, frame_line - geometry.field1_lines};
+  }
+
+  // Converts TBC 16-bit unsigned samples to the CVBS_U10_4FSC int16_t domain.
+  void convert_raw_samples(const uint16_t* raw, size_t count,
+                           sample_type* dst) const {
     const double tbc_blank = static_cast<double>(video_params_.blanking_16b);
     const double scale = static_cast<double>(source_params_.white_level -
                                              source_params_.blanking_level) /
@@ -506,24 +595,19 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
                                              video_params_.blanking_16b);
     const double cvbs_blank =
         static_cast<double>(source_params_.blanking_level);
-
-    std::vector<sample_type> result(static_cast<size_t>(stored_spl));
-    const uint16_t* raw_line = line_buffer_.data() + offset;
-    for (int32_t i = 0; i < stored_spl; ++i) {
-      const double v =
-          (static_cast<double>(raw_line[static_cast<size_t>(i)]) - tbc_blank) *
-              scale +
-          cvbs_blank;
-      result[static_cast<size_t>(i)] = static_cast<sample_type>(std::lround(v));
+    for (size_t i = 0; i < count; ++i) {
+      const double v = (static_cast<double>(raw[i]) - tbc_blank) * scale +
+                       cvbs_blank;
+      dst[i] = static_cast<sample_type>(std::lround(v));
     }
-    return result;
   }
 
- private:
+  // Planes are drawn from the host frame buffer pool and return to it when
+  // the last reference (cache entry or FrameHandle) is dropped.
   struct CachedFrame {
-    std::vector<sample_type> samples;  // assembled composite frame
-    std::vector<sample_type> luma;     // YC: luma channel (empty for composite)
-    std::vector<sample_type> chroma;   // YC: chroma channel
+    SharedSampleBuffer samples;  // assembled composite frame
+    SharedSampleBuffer luma;     // YC: same buffer as |samples|; else null
+    SharedSampleBuffer chroma;   // YC: chroma channel; else null
     int colour_frame_index = -1;
   };
 
@@ -531,6 +615,17 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
     return static_cast<size_t>(frame_samples_from_system(video_params_.system));
   }
 
+  // Assembles one plane from two TBC fields into a pooled buffer.
+  template <typename Converter>
+  SharedSampleBuffer assemble_plane(const std::vector<uint16_t>& field1,
+                                    const std::vector<uint16_t>& field2) const {
+    auto plane = acquire_sample_buffer(plugin::get_frame_buffer_pool(),
+                                       frame_samples_total());
+    Converter::assemble_frame_into(field1, field2, video_params_.blanking_16b,
+                                   video_params_.white_16b, *plane);
+    return plane;
+  }
+
   // Compute the colour_frame_index for a frame from its field metadata.
   // Uses TBC field 1 (even index = 2×id) which carries the frame phase.
   int compute_colour_frame_index(FrameID id) const {
@@ -551,14 +646,24 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
 
   void ensure_frame_cached(FrameID id) const {
     if (frame_cache_.contains(id)) return;
-    CachedFrame frame = assemble_frame(id);
+    auto frame = std::make_shared<const CachedFrame>(assemble_frame(id));
     // put_if_absent: two threads can race past the contains() check and both
     // assemble the frame; replacing the cached entry would free the buffer
     // that the first thread's get_frame() pointer still refers to.
     frame_cache_.put_if_absent(id, std::move(frame));
   }
 
+  // Shared reference to the cached assembly of frame |id|. Falls back to a
+  // private assembly if concurrent readers evicted the entry in between.
+  std::shared_ptr<const CachedFrame> cached_frame(FrameID id) const {
+    ensure_frame_cached(id);
+    if (auto cached = frame_cache_.get(id)) return *cached;
+    return std::make_shared<const CachedFrame>(assemble_frame(id));
+  }
+
   CachedFrame assemble_frame(FrameID id) const {
+    ORC_TRACE_FRAME_SCOPE(plugin::get_tracer(), "source", "tbc_read_frame",
+                          "tbc_source", id);
     switch (video_params_.system) {
       case VideoSystem::PAL:
         return assemble_pal_frame(id);
@@ -601,8 +706,7 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
     }
 
     CachedFrame result;
-    result.samples = PalTBCConverter::assemble_frame(
-        raw_f1, raw_f2, video_params_.blanking_16b, video_params_.white_16b);
+    result.samples = assemble_plane<PalTBCConverter>(raw_f1, raw_f2);
     result.colour_frame_index = compute_colour_frame_index(id);
 
     if (is_yc_) {
@@ -616,8 +720,7 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
             std::to_string(id) + ": " + err);
       }
       result.luma = result.samples;
-      result.chroma = PalTBCConverter::assemble_frame(
-          raw_c1, raw_c2, video_params_.blanking_16b, video_params_.white_16b);
+      result.chroma = assemble_plane<PalTBCConverter>(raw_c1, raw_c2);
     }
     return result;
   }
@@ -657,8 +760,7 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
     }
 
     CachedFrame result;
-    result.samples = NtscTBCConverter::assemble_frame(
-        raw_f1, raw_f2, video_params_.blanking_16b, video_params_.white_16b);
+    result.samples = assemble_plane<NtscTBCConverter>(raw_f1, raw_f2);
     result.colour_frame_index = compute_colour_frame_index(id);
 
     if (is_yc_) {
@@ -672,8 +774,7 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
             std::to_string(id) + ": " + err);
       }
       result.luma = result.samples;
-      result.chroma = NtscTBCConverter::assemble_frame(
-          raw_c1, raw_c2, video_params_.blanking_16b, video_params_.white_16b);
+      result.chroma = assemble_plane<NtscTBCConverter>(raw_c1, raw_c2);
     }
     return result;
   }
@@ -710,8 +811,7 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
     }
 
     CachedFrame result;
-    result.samples = PalMTBCConverter::assemble_frame(
-        raw_f1, raw_f2, video_params_.blanking_16b, video_params_.white_16b);
+    result.samples = assemble_plane<PalMTBCConverter>(raw_f1, raw_f2);
     result.colour_frame_index = compute_colour_frame_index(id);
 
     if (is_yc_) {
@@ -726,8 +826,7 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
             std::to_string(id) + ": " + err);
       }
       result.luma = result.samples;
-      result.chroma = PalMTBCConverter::assemble_frame(
-          raw_c1, raw_c2, video_params_.blanking_16b, video_params_.white_16b);
+      result.chroma = assemble_plane<PalMTBCConverter>(raw_c1, raw_c2);
     }
     return result;
   }
@@ -888,7 +987,9 @@ class TBCDecodedFrameRepresentation final : public VideoFrameRepresentation,
   mutable std::vector<std::vector<int32_t>> audio_frames_;
 
   static constexpr size_t kFrameCacheSize = 150;
-  mutable LRUCache<FrameID, CachedFrame> frame_cache_{kFrameCacheSize};
+  using FrameCache = LRUCache<FrameID, std::shared_ptr<const CachedFrame>>;
+  // Entries are shared so acquire_frame() handles outlive eviction.
+  mutable FrameCache frame_cache_{kFrameCacheSize};
 
   mutable std::mutex line_buffer_mutex_;
   mutable int32_t line_buffer_field_idx_{-1};
@@ -983,6 +1084,14 @@ std::vector<TBCFieldMeta> build_field_meta_from_reader(
 
 class TBCSourceStageDeps final : public ITBCSourceStageDeps {
  public:
+  TBCSourceStageDeps() {
+    if (IMetricsRegistry* metrics = plugin::get_metrics()) {
+      bytes_read_ = metrics->counter("orc_source_read_bytes_total",
+                                     "Sample bytes read from source files",
+                                     "source=tbc_source");
+    }
+  }
+
   bool validate_input_file(const std::string& path,
                            std::string& error_message) const override {
     namespace fs = std::filesystem;
@@ -1091,6 +1200,7 @@ class TBCSourceStageDeps final : public ITBCSourceStageDeps {
     std::vector<uint16_t> samples(static_cast<size_t>(use_sample_count));
     ifs.read(reinterpret_cast<char*>(samples.data()),
              static_cast<std::streamsize>(use_sample_count) * 2LL);
+    count_bytes_read(ifs.gcount());
     const size_t words_read = static_cast<size_t>(ifs.gcount()) / 2;
     if (words_read < static_cast<size_t>(use_sample_count)) {
       error_message = "Short read for field " + std::to_string(field_index) +
@@ -1123,6 +1233,7 @@ class TBCSourceStageDeps final : public ITBCSourceStageDeps {
     std::vector<uint16_t> samples(static_cast<size_t>(use_sample_count));
     ifs.read(reinterpret_cast<char*>(samples.data()),
              static_cast<std::streamsize>(use_sample_count) * 2LL);
+    count_bytes_read(ifs.gcount());
     const size_t words_read = static_cast<size_t>(ifs.gcount()) / 2;
     if (words_read < static_cast<size_t>(use_sample_count)) {
       error_message = "Short read for field " + std::to_string(field_index) +
@@ -1133,6 +1244,35 @@ class TBCSourceStageDeps final : public ITBCSourceStageDeps {
     return samples;
   }
 
+  bool read_field_runs(const std::string& tbc_path,
+                       int32_t stored_samples_per_field,
+                       const std::vector<TBCSampleRun>& runs,
+                       std::vector<uint16_t>& out,
+                       std::string& error_message) const override {
+    TBCReader reader;
+    if (!reader.open(tbc_path,
+                     static_cast<size_t>(stored_samples_per_field))) {
+      error_message = "Failed to open TBC data file: '" + tbc_path + "'";
+      return false;
+    }
+    std::vector<TBCReader::SampleRun> reader_runs;
+    reader_runs.reserve(runs.size());
+    for (const auto& run : runs) {
+      reader_runs.push_back({FieldID(run.field_index),
+                             static_cast<size_t>(run.sample_offset),
+                             static_cast<size_t>(run.sample_count)});
+    }
+    try {
+      count_bytes_read(static_cast<std::streamsize>(
+          reader.read_sample_runs(reader_runs, out)));
+    } catch (const std::exception& e) {
+      error_message = e.what();
+      out.clear();
+      return false;
+    }
+    return true;
+  }
+
   bool has_audio_file(const std::string& pcm_path) const override {
     namespace fs = std::filesystem;
     std::error_code ec;
@@ -1235,6 +1375,12 @@ class TBCSourceStageDeps final : public ITBCSourceStageDeps {
   }
 
  private:
+  void count_bytes_read(std::streamsize bytes) const {
+    if (bytes_read_ && bytes > 0) {
+      bytes_read_->add(static_cast<uint64_t>(bytes));
+    }
+  }
+
   // Opening a legacy .tbc.json parses the entire document, which is expensive
   // for large captures; video params, per-field meta, and configuration
   // validation all need it. Cache the most recently parsed file (keyed by
@@ -1271,6 +1417,8 @@ class TBCSourceStageDeps final : public ITBCSourceStageDeps {
   mutable std::string json_cache_path_;
   mutable uintmax_t json_cache_size_ = 0;
   mutable std::filesystem::file_time_type json_cache_mtime_{};
+
+  IMetricCounter* bytes_read_ = nullptr;  // host-owned; null without a host
 };
 
 }  // namespace
@@ -71,6 +71,15 @@ struct TBCFieldMeta {
   std::vector<DropoutInfo> dropouts;     // field-local TBC dropout regions
 };
 
+// ---------------------------------------------------------------------------
+// TBCSampleRun — one run of samples within a stored TBC field
+// ---------------------------------------------------------------------------
+struct TBCSampleRun {
+  int32_t field_index = 0;    // 0-based field in the TBC file
+  int32_t sample_offset = 0;  // relative to the start of the field
+  int32_t sample_count = 0;
+};
+
 // ---------------------------------------------------------------------------
 // ITBCSourceStageDeps — dependency injection interface
 // ---------------------------------------------------------------------------
@@ -118,6 +127,29 @@ class ITBCSourceStageDeps {
       int32_t stored_samples_per_field, int32_t sample_offset,
       int32_t use_sample_count, std::string& error_message) const = 0;
 
+  // Batched variant for sparse-line scans: reads every run in |runs| and
+  // stores the samples back to back in |out|, in the order given.
+  // Implementations coalesce nearby runs into as few file reads as possible.
+  // Returns false (with error_message set) when any run cannot be read.
+  // Default: one read_field_samples_at() per run.
+  virtual bool read_field_runs(const std::string& tbc_path,
+                               int32_t stored_samples_per_field,
+                               const std::vector<TBCSampleRun>& runs,
+                               std::vector<uint16_t>& out,
+                               std::string& error_message) const {
+    out.clear();
+    for (const auto& run : runs) {
+      const auto samples = read_field_samples_at(
+          tbc_path, run.field_index, stored_samples_per_field,
+          run.sample_offset, run.sample_count, error_message);
+      if (samples.size() != static_cast<size_t>(run.sample_count)) {
+        return false;
+      }
+      out.insert(out.end(), samples.begin(), samples.end());
+    }
+    return true;
+  }
+
   // Audio: returns true when the PCM sidecar exists.
   virtual bool has_audio_file(const std::string& pcm_path) const = 0;
 
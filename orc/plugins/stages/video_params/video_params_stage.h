@@ -48,6 +48,12 @@ class VideoParamsOverrideFrameRepresentation
     return "video_params_override_frame_representation";
   }
 
+  // Video samples and hints pass through unchanged, so hand out the upstream
+  // frame handle instead of the wrapper default's copy.
+  FrameHandle acquire_frame(FrameID id) const override {
+    return source_ ? source_->acquire_frame(id) : nullptr;
+  }
+
   std::optional<SourceParameters> get_video_parameters() const override {
     return cached_params_;
   }
@@ -64,6 +70,14 @@ class VideoParamsOverrideFrameRepresentation
   const sample_type* get_line(FrameID id, size_t line) const override {
     return source_ ? source_->get_line(id, line) : nullptr;
   }
+  bool read_lines(FrameIDRange frames, const std::vector<size_t>& lines,
+                  std::vector<sample_type>& out) const override {
+    if (!source_) {
+      out.clear();
+      return false;
+    }
+    return source_->read_lines(frames, lines, out);
+  }
   const sample_type* get_line_luma(FrameID id, size_t line) const override {
     return source_ ? source_->get_line_luma(id, line) : nullptr;
   }
@@ -0,0 +1,58 @@
+/*
+ * File:        colour_statistics_presenter.h
+ * Module:      orc-presenters
+ * Purpose:     Presenter for the Colour Statistics analysis tool
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#ifndef ORC_PRESENTERS_COLOUR_STATISTICS_PRESENTER_H
+#define ORC_PRESENTERS_COLOUR_STATISTICS_PRESENTER_H
+
+#include <orc_colour_statistics.h>
+
+#include <functional>
+#include <memory>
+
+#include "analysis_tool_presenter.h"
+
+namespace orc::presenters {
+
+/**
+ * @brief Presenter for the Colour Statistics analysis tool
+ *
+ * Prepares DAG/project context, maps progress/results for the GUI and
+ * forwards the merged U/V density and luma histogram as the pass runs.
+ */
+class ColourStatisticsPresenter : public AnalysisToolPresenter {
+ public:
+  explicit ColourStatisticsPresenter(void* project_handle);
+
+  /**
+   * @brief Run the colour statistics analysis
+   * @param node_id Video sink node to analyse
+   * @param parameters Tool parameters (frameStride/startFrame/frameCount/
+   *                   threads)
+   * @param progress_callback Optional (percentage, status) progress sink
+   * @param cancel_check Optional poll; return true to cancel the analysis
+   * @param statistics_callback Optional sink for the accumulated counts,
+   *                            called with partial counts while the pass
+   *                            runs and once more with the final counts
+   */
+  orc::AnalysisResult runAnalysis(
+      NodeID node_id,
+      const std::map<std::string, orc::ParameterValue>& parameters,
+      std::function<void(int, const std::string&)> progress_callback = nullptr,
+      std::function<bool()> cancel_check = nullptr,
+      std::function<void(std::shared_ptr<const orc::ColourStatisticsData>)>
+          statistics_callback = nullptr);
+
+ protected:
+  std::string toolId() const override;
+  std::string toolName() const override;
+};
+
+}  // namespace orc::presenters
+
+#endif  // ORC_PRESENTERS_COLOUR_STATISTICS_PRESENTER_H
@@ -0,0 +1,69 @@
+/*
+ * File:        pipeline_metrics_presenter.h
+ * Module:      orc-presenters
+ * Purpose:     Live pipeline metrics (throughput, caches, queues, memory) for
+ *              the CLI status line and the GUI performance panel
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace orc::presenters {
+
+enum class PipelineMetricKind { Counter, Gauge, Histogram };
+
+/**
+ * @brief Current value of one metric series published by the core or a stage
+ */
+struct PipelineMetric {
+  std::string name;    ///< Prometheus name, e.g. "orc_sink_frames_total"
+  std::string labels;  ///< "key=value,..." (e.g. "cache=stacker.frames")
+  std::string help;
+  PipelineMetricKind kind = PipelineMetricKind::Counter;
+  double value = 0.0;  ///< Counter/gauge value; histogram sum (seconds)
+  uint64_t count = 0;  ///< Histogram observations
+};
+
+/**
+ * @brief Whole-pipeline totals derived from a metrics snapshot
+ *
+ * Counters are cumulative since process start; callers derive rates (such as
+ * frames per second) from the difference between two summaries.
+ */
+struct PipelineStatus {
+  uint64_t frames_written = 0;     ///< All sinks
+  uint64_t cache_hits = 0;         ///< All frame/artifact caches
+  uint64_t cache_misses = 0;       ///< All frame/artifact caches
+  uint64_t source_bytes_read = 0;  ///< All sources
+  double queue_depth = 0.0;        ///< Frames waiting in sink write queues
+  uint64_t resident_bytes = 0;     ///< Process RSS; 0 if unknown
+};
+
+/**
+ * @brief Snapshot every metric series, sorted by name then labels
+ */
+std::vector<PipelineMetric> snapshotPipelineMetrics();
+
+/**
+ * @brief Aggregate a snapshot into whole-pipeline totals
+ */
+PipelineStatus summarizePipelineMetrics(
+    const std::vector<PipelineMetric>& metrics);
+
+/**
+ * @brief Write all metrics in Prometheus text format to @p path
+ *
+ * The file is replaced atomically, so it suits node_exporter's textfile
+ * collector.
+ *
+ * @return false, with @p error set, if the file cannot be written
+ */
+bool writePipelineMetricsTextfile(const std::string& path, std::string& error);
+
+}  // namespace orc::presenters
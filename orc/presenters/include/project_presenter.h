@@ -14,6 +14,7 @@
 #include <orc/stage/orc_source_parameters.h>  // For public_api::SourceParameters
 #include <orc/stage/params/parameter_types.h>
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <optional>
@@ -47,6 +48,33 @@ void initCoreLogging(
     const std::string& pattern = "[%Y-%m-%d %H:%M:%S.%e] [%n] [%^%l%$] %v",
     const std::string& log_file = "");
 
+/**
+ * @brief Span counts of a finished trace capture
+ */
+struct TraceSummary {
+  uint64_t spans = 0;    ///< Spans recorded
+  uint64_t dropped = 0;  ///< Oldest spans lost to full per-thread buffers
+  uint64_t threads = 0;  ///< Threads that recorded spans
+};
+
+/**
+ * @brief Start capturing an execution trace
+ *
+ * Discards any previous capture. Until stopTracing(), the DAG executor and the
+ * stages record stage- and frame-tagged spans of their work.
+ */
+void startTracing();
+
+/**
+ * @brief Stop the trace capture and write it as a Chrome trace JSON file
+ * @param output_path Destination file; loads in chrome://tracing or Perfetto
+ * @param summary Receives the span counts of the capture
+ * @param error Receives a description of the failure when writing fails
+ * @return true if the file was written
+ */
+bool stopTracing(const std::string& output_path, TraceSummary& summary,
+                 std::string& error);
+
 /**
  * @brief ProjectPresenter - Manages project creation, loading, and modification
  *
@@ -573,6 +601,8 @@ class ProjectPresenter : public IProjectPresenter {
    *
    * Rebuilds the executable DAG from the project graph.
    * Call this whenever the DAG structure changes (nodes/edges added/removed).
+   * Nodes whose configuration and upstream are unchanged since the previous
+   * build keep their stage instances (see orc::project_to_dag()).
    */
   std::shared_ptr<void> buildDAG() override;
 
@@ -607,7 +637,8 @@ class ProjectPresenter : public IProjectPresenter {
   /**
    * @brief Get current parameters for a specific node
    * @param node_id Node to query
-   * @return Map of parameter name -> current value
+   * @return Map of parameter name -> current value. Values the project keeps
+   *         in its blob store are returned as their full text.
    */
   std::map<std::string, ParameterValue> getNodeParameters(
       NodeID node_id) override;
@@ -660,6 +691,9 @@ class ProjectPresenter : public IProjectPresenter {
   std::string project_path_;
   bool is_modified_;
   mutable std::shared_ptr<void> dag_;  ///< Cached DAG instance
+  /// Most recent DAG built by buildDAG(); kept across edits so the next build
+  /// can reuse the stage instances of unchanged nodes.
+  std::shared_ptr<void> last_built_dag_;
 };
 
 }  // namespace orc::presenters
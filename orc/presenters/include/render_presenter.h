@@ -140,14 +140,36 @@ class RenderPresenter {
    * @param output_type Type of output (Field, Frame, Luma, etc.)
    * @param output_index Index of the output (0-based)
    * @param option_id Optional rendering option ID
+   * @param cancel_check Optional poll; returning true abandons the render and
+   *        yields an unsuccessful result
    * @return Preview render result with RGB image
    *
    * Thread-safe: Yes (uses internal DAG)
    */
-  orc::PreviewRenderResult renderPreview(NodeID node_id,
-                                         orc::PreviewOutputType output_type,
-                                         uint64_t output_index,
-                                         const std::string& option_id = "");
+  orc::PreviewRenderResult renderPreview(
+      NodeID node_id, orc::PreviewOutputType output_type,
+      uint64_t output_index, const std::string& option_id = "",
+      std::function<bool()> cancel_check = nullptr);
+
+  /**
+   * @brief Render a fast draft preview, when the node offers one
+   *
+   * Drafts are reduced-quality colour previews for interactive navigation;
+   * a renderPreview() of the same output replaces them once navigation
+   * pauses.
+   *
+   * @param node_id Node to render from
+   * @param output_type Type of output (Field, Frame, Luma, etc.)
+   * @param output_index Index of the output (0-based)
+   * @param cancel_check Optional poll; returning true abandons the render and
+   *        yields an unsuccessful result
+   * @return std::nullopt when the node has no draft for this output
+   *
+   * Thread-safe: Yes (uses internal DAG)
+   */
+  std::optional<orc::PreviewRenderResult> renderDraftPreview(
+      NodeID node_id, orc::PreviewOutputType output_type,
+      uint64_t output_index, std::function<bool()> cancel_check = nullptr);
 
   /**
    * @brief Get available output types for a node
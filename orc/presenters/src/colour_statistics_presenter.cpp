@@ -0,0 +1,196 @@
+/*
+ * File:        colour_statistics_presenter.cpp
+ * Module:      orc-presenters
+ * Purpose:     Presenter for the Colour Statistics analysis tool
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#include "../include/colour_statistics_presenter.h"
+
+#include <orc/stage/stage.h>
+#include <orc/support/logging.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "../../core/analysis/analysis_progress.h"
+#include "../../core/analysis/analysis_registry.h"
+#include "../../core/analysis/analysis_tool.h"
+#include "../../core/analysis/colour_statistics/colour_statistics_analysis.h"
+#include "../../core/include/dag_executor.h"
+#include "../../core/include/project.h"
+
+namespace orc::presenters {
+
+ColourStatisticsPresenter::ColourStatisticsPresenter(void* project_handle)
+    : AnalysisToolPresenter(project_handle) {}
+
+std::string ColourStatisticsPresenter::toolId() const {
+  return "colour_statistics";
+}
+
+std::string ColourStatisticsPresenter::toolName() const {
+  return "Colour Statistics";
+}
+
+orc::AnalysisResult ColourStatisticsPresenter::runAnalysis(
+    NodeID node_id,
+    const std::map<std::string, orc::ParameterValue>& parameters,
+    std::function<void(int, const std::string&)> progress_callback,
+    std::function<bool()> cancel_check,
+    std::function<void(std::shared_ptr<const orc::ColourStatisticsData>)>
+        statistics_callback) {
+  orc::AnalysisResult result;
+  result.status = orc::AnalysisResult::Status::Failed;
+
+  class ProgressAdapter : public orc::ColourStatisticsProgress {
+   public:
+    ProgressAdapter(
+        std::function<void(int, const std::string&)> cb,
+        std::function<bool()> cancel_check,
+        std::function<void(std::shared_ptr<const orc::ColourStatisticsData>)>
+            statistics_cb)
+        : callback_(std::move(cb)),
+          cancel_check_(std::move(cancel_check)),
+          statistics_callback_(std::move(statistics_cb)) {}
+
+    void setProgress(int percentage) override {
+      last_progress_ = percentage;
+      if (callback_) {
+        callback_(percentage, status_);
+      }
+    }
+
+    void setStatus(const std::string& status) override {
+      status_ = status;
+      if (callback_) {
+        callback_(last_progress_, status_);
+      }
+    }
+
+    void setSubStatus(const std::string& sub_status) override {
+      if (callback_) {
+        std::string combined = status_;
+        if (!combined.empty() && !sub_status.empty()) {
+          combined += " - ";
+        }
+        combined += sub_status;
+        callback_(last_progress_, combined);
+      }
+    }
+
+    bool isCancelled() const override {
+      return cancel_check_ && cancel_check_();
+    }
+
+    void reportPartialResult(const orc::AnalysisResult::ResultItem&) override {}
+
+    void reportColourStatistics(
+        const orc::ColourStatisticsData& data) override {
+      if (statistics_callback_) {
+        // Copied once here so the GUI can keep it after the pass moves on.
+        statistics_callback_(
+            std::make_shared<const orc::ColourStatisticsData>(data));
+      }
+    }
+
+   private:
+    std::function<void(int, const std::string&)> callback_;
+    std::function<bool()> cancel_check_;
+    std::function<void(std::shared_ptr<const orc::ColourStatisticsData>)>
+        statistics_callback_;
+    int last_progress_ = 0;
+    std::string status_;
+  } progress(progress_callback, cancel_check, statistics_callback);
+
+  if (progress_callback) {
+    progress_callback(0, "Initializing colour statistics...");
+  }
+
+  auto* tool = orc::AnalysisRegistry::instance().findById(toolId());
+  if (!tool) {
+    result.summary = "Colour Statistics tool not found in registry";
+    ORC_LOG_ERROR("{}", result.summary);
+    return result;
+  }
+
+  auto dag_void = getOrBuildDAG();
+  if (!dag_void) {
+    result.summary = "Failed to build DAG from project";
+    ORC_LOG_ERROR("{}", result.summary);
+    return result;
+  }
+  auto dag = std::static_pointer_cast<orc::DAG>(dag_void);
+
+  const auto& nodes = dag->nodes();
+  auto node_it = std::find_if(
+      nodes.begin(), nodes.end(),
+      [&node_id](const DAGNode& n) { return n.node_id == node_id; });
+
+  if (node_it == nodes.end()) {
+    result.summary = "Node not found in DAG";
+    ORC_LOG_ERROR("{}", result.summary);
+    return result;
+  }
+
+  if (!node_it->stage ||
+      node_it->stage->get_node_type_info().stage_name != "video_sink") {
+    result.summary = "Colour Statistics only applies to video_sink stages";
+    ORC_LOG_ERROR("{}", result.summary);
+    return result;
+  }
+
+  orc::AnalysisContext ctx;
+  ctx.source_type = orc::AnalysisSourceType::LaserDisc;
+  ctx.node_id = node_id;
+  ctx.parameters = parameters;
+  ctx.dag = dag;
+  ctx.project = std::make_shared<orc::Project>(
+      *static_cast<orc::Project*>(getProjectPointer()));
+
+  orc::AnalysisResult core_result = tool->analyze(ctx, &progress);
+
+  if (progress_callback) {
+    if (core_result.status == orc::AnalysisResult::Success) {
+      progress_callback(100, "Analysis complete");
+    } else if (core_result.status == orc::AnalysisResult::Cancelled) {
+      progress_callback(0, "Analysis cancelled");
+    } else {
+      progress_callback(0, "Analysis failed");
+    }
+  }
+
+  switch (core_result.status) {
+    case orc::AnalysisResult::Success:
+      result.status = orc::AnalysisResult::Status::Success;
+      break;
+    case orc::AnalysisResult::Failed:
+      result.status = orc::AnalysisResult::Status::Failed;
+      break;
+    case orc::AnalysisResult::Cancelled:
+      result.status = orc::AnalysisResult::Status::Cancelled;
+      break;
+  }
+
+  result.summary = core_result.summary;
+  result.statistics = core_result.statistics;
+  result.graphData = core_result.graphData;
+  result.parameterChanges = core_result.parameterChanges;
+
+  for (const auto& item : core_result.items) {
+    orc::AnalysisResultItem api_item;
+    api_item.type = item.type;
+    api_item.message = item.message;
+    api_item.startFrame = item.startFrame;
+    api_item.endFrame = item.endFrame;
+    api_item.metadata = item.metadata;
+    result.items.push_back(std::move(api_item));
+  }
+
+  return result;
+}
+
+}  // namespace orc::presenters
@@ -1,7 +1,8 @@
 /*
  * File:        core_init.cpp
  * Module:      orc-presenters
- * Purpose:     Core initialization functions for presenters layer
+ * Purpose:     Core initialization and tracing functions for presenters
+ *              layer
  *
  * SPDX-License-Identifier: GPL-3.0-or-later
  * SPDX-FileCopyrightText: 2026 Simon Inns
@@ -10,6 +11,7 @@
 #include <orc/support/logging.h>
 
 #include "../include/project_presenter.h"
+#include "core_tracer.h"
 
 namespace orc::presenters {
 
@@ -18,4 +20,17 @@ void initCoreLogging(const std::string& level, const std::string& pattern,
   orc::init_logging(level, pattern, log_file);
 }
 
+void startTracing() { orc::host_tracer().start(); }
+
+bool stopTracing(const std::string& output_path, TraceSummary& summary,
+                 std::string& error) {
+  auto& tracer = orc::host_tracer();
+  tracer.stop();
+  const auto stats = tracer.stats();
+  summary.spans = stats.recorded;
+  summary.dropped = stats.dropped;
+  summary.threads = stats.threads;
+  return tracer.write_chrome_trace(output_path, error);
+}
+
 }  // namespace orc::presenters
@@ -0,0 +1,69 @@
+/*
+ * File:        pipeline_metrics_presenter.cpp
+ * Module:      orc-presenters
+ * Purpose:     Live pipeline metrics (throughput, caches, queues, memory) for
+ *              the CLI status line and the GUI performance panel
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#include "pipeline_metrics_presenter.h"
+
+#include "core_metrics.h"
+
+namespace orc::presenters {
+
+std::vector<PipelineMetric> snapshotPipelineMetrics() {
+  std::vector<PipelineMetric> metrics;
+  for (const auto& sample : orc::host_metrics().snapshot()) {
+    PipelineMetric metric;
+    metric.name = sample.name;
+    metric.labels = sample.labels;
+    metric.help = sample.help;
+    switch (sample.kind) {
+      case orc::MetricKind::Counter:
+        metric.kind = PipelineMetricKind::Counter;
+        break;
+      case orc::MetricKind::Gauge:
+        metric.kind = PipelineMetricKind::Gauge;
+        break;
+      case orc::MetricKind::Histogram:
+        metric.kind = PipelineMetricKind::Histogram;
+        break;
+    }
+    metric.value = sample.value;
+    metric.count = sample.count;
+    metrics.push_back(std::move(metric));
+  }
+  return metrics;
+}
+
+PipelineStatus summarizePipelineMetrics(
+    const std::vector<PipelineMetric>& metrics) {
+  PipelineStatus status;
+  for (const auto& metric : metrics) {
+    const auto count = static_cast<uint64_t>(metric.value);
+    if (metric.name == "orc_sink_frames_total") {
+      status.frames_written += count;
+    } else if (metric.name == "orc_cache_hits_total") {
+      status.cache_hits += count;
+    } else if (metric.name == "orc_cache_misses_total") {
+      status.cache_misses += count;
+    } else if (metric.name == "orc_source_read_bytes_total") {
+      status.source_bytes_read += count;
+    } else if (metric.name == "orc_sink_queue_depth") {
+      status.queue_depth += metric.value;
+    } else if (metric.name == "orc_process_resident_memory_bytes") {
+      status.resident_bytes = count;
+    }
+  }
+  return status;
+}
+
+bool writePipelineMetricsTextfile(const std::string& path,
+                                  std::string& error) {
+  return orc::host_metrics().write_prometheus_textfile(path, error);
+}
+
+}  // namespace orc::presenters
@@ -27,6 +27,7 @@
 #include <set>
 #include <stdexcept>
 
+#include "../core/include/core_blob_store.h"
 #include "../core/include/curl_http_fetcher.h"
 #include "../core/include/plugin_index_client.h"
 #include "../core/include/plugin_remote_loader.h"
@@ -268,7 +269,8 @@ ProjectPresenter::ProjectPresenter(ProjectPresenter&& other) noexcept
     : project_(std::move(other.project_)),
       project_path_(std::move(other.project_path_)),
       is_modified_(other.is_modified_),
-      dag_(std::move(other.dag_)) {
+      dag_(std::move(other.dag_)),
+      last_built_dag_(std::move(other.last_built_dag_)) {
   ORC_LOG_DEBUG("ProjectPresenter move constructor: project = {}",
                 static_cast<void*>(project_.get()));
 }
@@ -282,6 +284,7 @@ ProjectPresenter& ProjectPresenter::operator=(
     project_path_ = std::move(other.project_path_);
     is_modified_ = other.is_modified_;
     dag_ = std::move(other.dag_);
+    last_built_dag_ = std::move(other.last_built_dag_);
   }
   return *this;
 }
@@ -296,6 +299,7 @@ bool ProjectPresenter::createQuickProject(
   // Create empty project with format
   project_ = std::make_unique<Project>(orc::project_io::create_empty_project(
       "Quick Project", toVideoSystem(format), toSourceType(source)));
+  last_built_dag_.reset();
 
   // Add source nodes for each input file
   double y_offset = 0.0;
@@ -356,6 +360,7 @@ bool ProjectPresenter::loadProject(const std::string& project_path) {
         std::make_unique<Project>(orc::project_io::load_project(project_path));
     project_path_ = project_path;
     is_modified_ = false;
+    last_built_dag_.reset();
     return true;
   } catch (const std::exception&) {
     throw;
@@ -375,6 +380,7 @@ bool ProjectPresenter::saveProject(const std::string& project_path) {
 
 void ProjectPresenter::clearProject() {
   orc::project_io::clear_project(*getProject());
+  last_built_dag_.reset();
   is_modified_ = true;
 }
 
@@ -1532,8 +1538,12 @@ std::shared_ptr<void> ProjectPresenter::buildDAG() {
   if (!project_.get()) return nullptr;
 
   try {
-    // Build and cache the DAG
-    dag_ = std::static_pointer_cast<void>(orc::project_to_dag(*getProject()));
+    // Build and cache the DAG. Unchanged nodes keep the stage instances of
+    // the last DAG built, so an edit does not reload untouched sources.
+    auto previous = std::static_pointer_cast<const orc::DAG>(last_built_dag_);
+    dag_ = std::static_pointer_cast<void>(
+        orc::project_to_dag(*getProject(), previous.get()));
+    last_built_dag_ = dag_;
     return dag_;
   } catch (const std::exception&) {
     dag_.reset();
@@ -1608,7 +1618,8 @@ std::map<std::string, ParameterValue> ProjectPresenter::getNodeParameters(
     return {};
   }
 
-  return it->parameters;
+  // Edit maps are held as blob references; callers see and edit the text.
+  return orc::resolve_blob_parameters(it->parameters);
 }
 
 bool ProjectPresenter::setNodeParameters(
@@ -76,26 +76,25 @@ class RenderPresenter::Impl {
       return;
     }
 
-    // Save dropout state if exists
-    bool show_dropouts = false;
-    if (preview_renderer_) {
-      show_dropouts = preview_renderer_->get_show_dropouts();
+    if (preview_renderer_ && field_renderer_ && obs_cache_) {
+      // Incremental update: each renderer drops only the cached results of
+      // nodes whose stage instance the rebuild replaced, so an edit keeps the
+      // untouched subgraph (typically the sources) warm.
+      obs_cache_->update_dag(dag);
+      preview_renderer_->update_dag(dag);
+      field_renderer_->update_dag(dag);
+    } else {
+      obs_cache_ = std::make_shared<orc::ObservationCache>(dag);
+      preview_renderer_ = std::make_unique<orc::PreviewRenderer>(dag);
+      field_renderer_ = std::make_unique<orc::DAGFrameRenderer>(dag);
+    }
+    if (!vbi_decoder_) {
+      vbi_decoder_ = std::make_unique<orc::VBIDecoder>();
     }
-
-    // Rebuild renderers
-    obs_cache_ = std::make_shared<orc::ObservationCache>(dag);
-    preview_renderer_ = std::make_unique<orc::PreviewRenderer>(dag);
-    field_renderer_ = std::make_unique<orc::DAGFrameRenderer>(dag);
-    vbi_decoder_ = std::make_unique<orc::VBIDecoder>();
 
     preview_view_registry_ = orc::PreviewViewRegistry{};
     orc::PreviewViewRegistry::register_default_views(
         preview_view_registry_, dag, preview_renderer_.get());
-
-    // Restore dropout state
-    if (preview_renderer_) {
-      preview_renderer_->set_show_dropouts(show_dropouts);
-    }
   }
 };
 
@@ -110,7 +109,9 @@ RenderPresenter& RenderPresenter::operator=(RenderPresenter&&) noexcept =
 
 bool RenderPresenter::updateDAG() {
   try {
-    impl_->getConcreteDAG() = orc::project_to_dag(*impl_->project_);
+    auto previous = impl_->getConcreteDAG();
+    impl_->dag_void_ = std::static_pointer_cast<void>(
+        orc::project_to_dag(*impl_->project_, previous.get()));
     impl_->rebuildRenderersFromDAG();
     return true;
   } catch (const std::exception&) {
@@ -125,7 +126,7 @@ void RenderPresenter::setDAG(std::shared_ptr<void> dag_handle) {
 
 orc::PreviewRenderResult RenderPresenter::renderPreview(
     NodeID node_id, orc::PreviewOutputType output_type, uint64_t output_index,
-    const std::string& option_id) {
+    const std::string& option_id, std::function<bool()> cancel_check) {
   if (!impl_->preview_renderer_) {
     return orc::PreviewRenderResult{
         {},      false,       "Preview renderer not initialized",
@@ -135,10 +136,12 @@ orc::PreviewRenderResult RenderPresenter::renderPreview(
   try {
     // Call core preview renderer
     auto core_result = impl_->preview_renderer_->render_output(
-        node_id, output_type, output_index, option_id);
+        node_id, output_type, output_index, option_id,
+        orc::PreviewNavigationHint::Random, cancel_check);
 
-    // Populate observation cache for the rendered field(s)
-    if (impl_->obs_cache_) {
+    // Populate observation cache for the rendered field(s); a cancelled
+    // render leaves it for the request that superseded this one
+    if (impl_->obs_cache_ && core_result.success) {
       if (output_type == orc::PreviewOutputType::Frame_Field1 ||
           output_type == orc::PreviewOutputType::Frame_Field2 ||
           output_type == orc::PreviewOutputType::Luma) {
@@ -172,6 +175,22 @@ orc::PreviewRenderResult RenderPresenter::renderPreview(
   }
 }
 
+std::optional<orc::PreviewRenderResult> RenderPresenter::renderDraftPreview(
+    NodeID node_id, orc::PreviewOutputType output_type, uint64_t output_index,
+    std::function<bool()> cancel_check) {
+  if (!impl_->preview_renderer_) {
+    return std::nullopt;
+  }
+
+  try {
+    return impl_->preview_renderer_->render_draft_output(
+        node_id, output_type, output_index, cancel_check);
+  } catch (const std::exception& e) {
+    return orc::PreviewRenderResult{{},      false,       e.what(),
+                                    node_id, output_type, output_index};
+  }
+}
+
 std::vector<orc::PreviewOutputInfo> RenderPresenter::getAvailableOutputs(
     NodeID node_id) {
   if (!impl_->preview_renderer_) {
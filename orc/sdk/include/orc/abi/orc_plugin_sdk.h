@@ -81,7 +81,8 @@
 // types work.)
 #include <orc/abi/orc_plugin_services.h>
 
-// Plugin service helpers: ORC_PLUGIN_LOG_* logging macros.
+// Plugin service helpers: ORC_PLUGIN_LOG_* logging and ORC_PLUGIN_TRACE_*
+// tracing macros.
 // (Must come after all other includes so that preview types are fully defined
 // when inline functions are instantiated.)
 #include <orc/plugin/orc_plugin_services_helpers.h>
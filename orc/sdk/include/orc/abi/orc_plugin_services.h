@@ -51,6 +51,10 @@ struct PreviewImage;
 struct ColourFrameCarrier;
 class IStageServices;
 class IObservationService;
+class IFrameBufferPool;
+class ITracer;
+class IMetricsRegistry;
+class IBlobStore;
 
 // =============================================================================
 // Log level enum
@@ -125,6 +129,56 @@ struct OrcPluginServices {
   /// hosts (services_size below the offset of this field) never populate it,
   /// so plugins must reach it via plugin::get_observation_service().
   IObservationService* observation_service;
+
+  // -------------------------------------------------------------------------
+  // v12 fields (ABI version 12; append-only, guarded by services_size)
+  // -------------------------------------------------------------------------
+
+  /// Host-owned frame buffer pool shared by every stage. Frame producers
+  /// acquire their per-frame sample buffers here so that buffers released by
+  /// cache eviction are recycled; see <orc/stage/frame_buffer_pool.h>.
+  ///
+  /// Host may set this to nullptr when the capability is not available.
+  /// Plugins must reach it via plugin::get_frame_buffer_pool().
+  IFrameBufferPool* frame_buffer_pool;
+
+  // -------------------------------------------------------------------------
+  // v13 fields (ABI version 13; append-only, guarded by services_size)
+  // -------------------------------------------------------------------------
+
+  /// Host execution tracer. Plugins record stage- and frame-tagged spans here
+  /// so a trace capture shows where processing time goes; see
+  /// <orc/stage/trace.h> and the ORC_PLUGIN_TRACE_* macros.
+  ///
+  /// Host may set this to nullptr when the capability is not available.
+  /// Plugins must reach it via plugin::get_tracer().
+  ITracer* tracer;
+
+  // -------------------------------------------------------------------------
+  // v14 fields (ABI version 14; append-only, guarded by services_size)
+  // -------------------------------------------------------------------------
+
+  /// Host pipeline metrics registry. Plugins publish throughput, cache and
+  /// queue counters, gauges and latency histograms here for the CLI status
+  /// line, the Prometheus textfile and the GUI performance panel; see
+  /// <orc/stage/metrics.h>.
+  ///
+  /// Host may set this to nullptr when the capability is not available.
+  /// Plugins must reach it via plugin::get_metrics().
+  IMetricsRegistry* metrics;
+
+  // -------------------------------------------------------------------------
+  // v16 fields (ABI version 16; append-only, guarded by services_size)
+  // -------------------------------------------------------------------------
+
+  /// Host blob store holding large parameter values (edit maps) that the
+  /// project keeps in content-addressed sidecar files. Stages resolve the
+  /// `blob:sha256:` references they receive as parameter values here; see
+  /// <orc/stage/blob_store.h>.
+  ///
+  /// Host may set this to nullptr when the capability is not available.
+  /// Plugins must reach it via plugin::get_blob_store().
+  IBlobStore* blob_store;
 };
 
 // =============================================================================
@@ -176,5 +230,62 @@ inline IObservationService* get_observation_service() {
   return g_services->observation_service;
 }
 
+inline IFrameBufferPool* get_frame_buffer_pool() {
+  if (!g_services) {
+    return nullptr;
+  }
+
+  const auto required_size =
+      static_cast<uint32_t>(offsetof(OrcPluginServices, frame_buffer_pool) +
+                            sizeof(IFrameBufferPool*));
+  if (g_services->services_size < required_size) {
+    return nullptr;
+  }
+
+  return g_services->frame_buffer_pool;
+}
+
+inline ITracer* get_tracer() {
+  if (!g_services) {
+    return nullptr;
+  }
+
+  const auto required_size = static_cast<uint32_t>(
+      offsetof(OrcPluginServices, tracer) + sizeof(ITracer*));
+  if (g_services->services_size < required_size) {
+    return nullptr;
+  }
+
+  return g_services->tracer;
+}
+
+inline IMetricsRegistry* get_metrics() {
+  if (!g_services) {
+    return nullptr;
+  }
+
+  const auto required_size = static_cast<uint32_t>(
+      offsetof(OrcPluginServices, metrics) + sizeof(IMetricsRegistry*));
+  if (g_services->services_size < required_size) {
+    return nullptr;
+  }
+
+  return g_services->metrics;
+}
+
+inline IBlobStore* get_blob_store() {
+  if (!g_services) {
+    return nullptr;
+  }
+
+  const auto required_size = static_cast<uint32_t>(
+      offsetof(OrcPluginServices, blob_store) + sizeof(IBlobStore*));
+  if (g_services->services_size < required_size) {
+    return nullptr;
+  }
+
+  return g_services->blob_store;
+}
+
 }  // namespace plugin
 }  // namespace orc
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <orc/abi/orc_plugin_services.h>
+#include <orc/stage/trace.h>
 
 #include <string>
 
@@ -89,3 +90,22 @@
   } while (0)
 
 #endif  // FMT_VERSION
+
+// =============================================================================
+// Tracing macros
+// =============================================================================
+//
+// Plugin-side counterparts of ORC_TRACE_SCOPE / ORC_TRACE_FRAME_SCOPE: they
+// time the rest of the enclosing block and record it on the host tracer (see
+// <orc/stage/trace.h>). Without a host tracer, or outside a trace capture,
+// they cost one check.
+//
+// Usage:
+//   ORC_PLUGIN_TRACE_SCOPE("sink", "finalize");
+//   ORC_PLUGIN_TRACE_FRAME_SCOPE("source", "assemble_frame", "TBCSource", id);
+
+#define ORC_PLUGIN_TRACE_SCOPE(category_, name_) \
+  ORC_TRACE_SCOPE(::orc::plugin::get_tracer(), category_, name_)
+#define ORC_PLUGIN_TRACE_FRAME_SCOPE(category_, name_, stage_, frame_) \
+  ORC_TRACE_FRAME_SCOPE(::orc::plugin::get_tracer(), category_, name_,   \
+                        stage_, frame_)
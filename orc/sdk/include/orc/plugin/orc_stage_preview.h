@@ -12,7 +12,9 @@
 
 #pragma once
 
+#include <orc/stage/preview/colour_decode_session.h>
 #include <orc/stage/preview/colour_preview_provider.h>
+#include <orc/stage/preview/draft_colour_preview_provider.h>
 #include <orc/stage/preview/orc_preview_carriers.h>
 #include <orc/stage/preview/orc_preview_types.h>
 #include <orc/stage/preview/orc_rendering.h>
@@ -54,6 +54,31 @@ class IFileWriterInt16 {
   virtual void close() = 0;
 };
 
+/**
+ * @brief Tuning for the asynchronous file writers (ABI 15).
+ *
+ * The host keeps @c buffer_count buffers of @c buffer_size bytes. The stage
+ * fills one while a host I/O thread writes the others, so write() only blocks
+ * when every buffer is waiting for the disk.
+ */
+struct AsyncFileWriterOptions {
+  /// Bytes per buffer; rounded up to the 4 KiB direct-I/O alignment.
+  size_t buffer_size = 16UL * 1024 * 1024;
+  /// Buffers in the ring; at least 2.
+  uint32_t buffer_count = 3;
+  /// Expected final file size in bytes. When non-zero the host reserves the
+  /// space when the file is opened so it is laid out contiguously; any unused
+  /// reservation is released on close().
+  uint64_t expected_size = 0;
+  /// Bypass the page cache (O_DIRECT, F_NOCACHE) where the platform and
+  /// filesystem allow it; otherwise ignored.
+  bool direct_io = false;
+  /// Start writeback every this many bytes and wait for the previous range,
+  /// so dirty pages never build up behind a long export (Linux only). 0 leaves
+  /// writeback to the kernel.
+  uint64_t writeback_interval = 64ULL * 1024 * 1024;
+};
+
 class IStageServices {
  public:
   virtual ~IStageServices() = default;
@@ -67,6 +92,16 @@ class IStageServices {
       size_t buffer_size) = 0;
   virtual std::shared_ptr<IFileWriterInt16> create_buffered_file_writer_int16(
       size_t buffer_size) = 0;
+
+  // Asynchronous writers (ABI 15); see AsyncFileWriterOptions. Write errors
+  // from the I/O thread are thrown as std::runtime_error by the next write(),
+  // flush() or close().
+  virtual std::shared_ptr<IFileWriterUint8> create_async_file_writer_uint8(
+      const AsyncFileWriterOptions& options) = 0;
+  virtual std::shared_ptr<IFileWriterUint16> create_async_file_writer_uint16(
+      const AsyncFileWriterOptions& options) = 0;
+  virtual std::shared_ptr<IFileWriterInt16> create_async_file_writer_int16(
+      const AsyncFileWriterOptions& options) = 0;
 };
 
 }  // namespace orc
@@ -16,6 +16,7 @@
 
 #include <orc/stage/common_types.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -104,4 +105,49 @@ inline constexpr uint32_t audio_pairs_in_frame(uint64_t frame_index,
                                audio_pair_offset(frame_index, system));
 }
 
+// Frame index n whose audio window contains absolute stereo-pair position
+// |pos|: audio_pair_offset(n) <= pos < audio_pair_offset(n + 1). The cadence
+// is exactly periodic, so the rational estimate is at most one frame off and
+// each adjustment loop runs at most once. Returns 0 for VideoSystem::Unknown.
+inline constexpr uint64_t audio_frame_containing_pair(uint64_t pos,
+                                                      VideoSystem system) {
+  switch (system) {
+    case VideoSystem::PAL:
+      return pos / 1920u;
+    case VideoSystem::NTSC:
+    case VideoSystem::PAL_M: {
+      uint64_t n = pos * 5u / 8008u;
+      while (audio_pair_offset(n + 1, system) <= pos) ++n;
+      while (n > 0 && audio_pair_offset(n, system) > pos) --n;
+      return n;
+    }
+    default:
+      return 0;
+  }
+}
+
+// Splits the stereo-pair range [start_pair, start_pair + count) at frame
+// window boundaries and calls fn(frame, within, pairs, at) for each piece in
+// order: |pairs| pairs of frame |frame| starting |within| pairs into its
+// window, landing |at| pairs from |start_pair|. Range readers
+// (VideoFrameRepresentation::read_audio) use it to map stream positions to
+// per-frame storage. Does nothing for VideoSystem::Unknown.
+template <typename Fn>
+void for_each_audio_frame_span(uint64_t start_pair, uint64_t count,
+                               VideoSystem system, Fn&& fn) {
+  if (audio_pairs_in_frame(0, system) == 0) return;
+  uint64_t frame = audio_frame_containing_pair(start_pair, system);
+  uint64_t pos = start_pair;
+  const uint64_t end = start_pair + count;
+  while (pos < end) {
+    const uint64_t frame_start = audio_pair_offset(frame, system);
+    const uint64_t frame_end = audio_pair_offset(frame + 1, system);
+    const uint64_t take = (frame_end < end ? frame_end : end) - pos;
+    fn(frame, static_cast<size_t>(pos - frame_start),
+       static_cast<size_t>(take), static_cast<size_t>(pos - start_pair));
+    pos += take;
+    ++frame;
+  }
+}
+
 }  // namespace orc
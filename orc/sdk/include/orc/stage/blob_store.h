@@ -0,0 +1,64 @@
+/*
+ * File:        blob_store.h
+ * Module:      decode-orc Plugin SDK (stage contract)
+ * Purpose:     Content-addressed store for large stage parameter values
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+// SDK TIER: stage — stage contract type crossing the plugin boundary. A layout
+// change here bumps the host ABI version.
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace orc {
+
+/// Prefix of a blob reference; followed by 64 lowercase hex digits.
+inline constexpr std::string_view kBlobRefPrefix = "blob:sha256:";
+
+/// True when @p value is a blob reference rather than inline parameter text.
+/// The digest must be exactly 64 lowercase hex digits: the host derives sidecar
+/// file names from it, so anything else is rejected rather than trusted.
+inline bool is_blob_ref(std::string_view value) {
+  if (value.size() != kBlobRefPrefix.size() + 64 ||
+      value.substr(0, kBlobRefPrefix.size()) != kBlobRefPrefix) {
+    return false;
+  }
+  for (char c : value.substr(kBlobRefPrefix.size())) {
+    if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Host store of large parameter values, addressed by content hash.
+ *
+ * STRING parameters declared with ParameterDescriptor::blob_storage (edit
+ * maps such as dropout maps and frame ranges) are kept out of the project
+ * YAML: the project stores a `blob:sha256:<hex>` reference and the text lives
+ * in a sidecar file. Stages receive the reference in set_parameters() and
+ * execute(), and resolve it here. Short values stay inline, so a stage must
+ * accept both forms; ParsedParamCache (<orc/support/parsed_param_cache.h>)
+ * does this and shares one parsed copy per distinct value.
+ *
+ * Thread-safety: get() may be called concurrently from any thread.
+ */
+class IBlobStore {
+ public:
+  virtual ~IBlobStore() = default;
+
+  /// Contents of the blob named by @p ref, or nullptr when it is unknown or
+  /// its sidecar file is missing or corrupt. The returned text is immutable
+  /// and stays valid for as long as the caller holds it.
+  virtual std::shared_ptr<const std::string> get(
+      const std::string& ref) const = 0;
+};
+
+}  // namespace orc
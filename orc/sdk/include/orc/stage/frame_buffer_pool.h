@@ -0,0 +1,94 @@
+/*
+ * File:        frame_buffer_pool.h
+ * Module:      decode-orc Plugin SDK (stage contract)
+ * Purpose:     Host-owned pool of recyclable frame sample buffers
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+// SDK TIER: stage — stage contract type crossing the plugin boundary. A layout
+// change here bumps the host ABI version.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace orc {
+
+/**
+ * @brief Counter snapshot reported by IFrameBufferPool::stats().
+ *
+ * Counters are cumulative since the pool was created, except
+ * @ref pooled_buffers / @ref pooled_bytes, which describe the buffers parked
+ * in the pool at the time of the call.
+ */
+struct FrameBufferPoolStats {
+  uint64_t allocations = 0;    ///< Buffers freshly allocated from the heap.
+  uint64_t reuses = 0;         ///< Acquisitions served by a recycled buffer.
+  uint64_t magazine_hits = 0;  ///< Reuses served by a thread-local magazine.
+  uint64_t recycles = 0;       ///< Released buffers kept for reuse.
+  uint64_t discards = 0;       ///< Released buffers freed (pool full).
+  uint64_t pooled_buffers = 0;
+  uint64_t pooled_bytes = 0;
+  uint64_t minor_faults = 0;  ///< Process minor page faults (0 if unknown).
+  uint64_t major_faults = 0;  ///< Process major page faults (0 if unknown).
+};
+
+/**
+ * @brief Host service handing out recyclable frame sample buffers.
+ *
+ * Frame producers (source assembly, stacking, dropout correction, line
+ * overlays) allocate one buffer per output frame and drop it when their cache
+ * evicts the frame. Acquiring through the pool instead of std::make_shared
+ * recycles those buffers: the deleter of a pooled buffer returns its storage
+ * to the pool, so a steady-state pipeline stops faulting fresh pages in for
+ * every frame.
+ *
+ * Buffers are grouped into size classes, so a recycled buffer may have a
+ * larger capacity() than requested; size() is always exactly the requested
+ * sample count. Contents are unspecified — callers overwrite every sample (or
+ * fill the buffer) before publishing it.
+ *
+ * Thread-safety: all methods may be called concurrently from any thread, and
+ * a buffer may be released on a different thread from the one that acquired
+ * it. Buffers may outlive the pool; they are then freed normally.
+ *
+ * Boundary safety: no method throws across the plugin boundary. acquire()
+ * returns nullptr when it cannot allocate; use acquire_sample_buffer() to fall
+ * back to a plain heap allocation.
+ */
+class IFrameBufferPool {
+ public:
+  virtual ~IFrameBufferPool() = default;
+
+  /**
+   * @brief Acquire a buffer of exactly @p samples samples.
+   *
+   * @return An exclusively owned buffer (use_count() == 1), or nullptr if
+   *         @p samples is zero or the allocation failed.
+   */
+  virtual std::shared_ptr<std::vector<int16_t>> acquire(size_t samples) = 0;
+
+  /// Snapshot of the pool counters.
+  virtual FrameBufferPoolStats stats() const = 0;
+};
+
+/**
+ * @brief Acquire @p samples samples from @p pool, or from the heap.
+ *
+ * @p pool may be nullptr (older hosts, unit tests without a host). Heap
+ * fallbacks are value-initialised; pooled buffers have unspecified contents.
+ */
+inline std::shared_ptr<std::vector<int16_t>> acquire_sample_buffer(
+    IFrameBufferPool* pool, size_t samples) {
+  if (pool) {
+    if (auto buffer = pool->acquire(samples)) return buffer;
+  }
+  return std::make_shared<std::vector<int16_t>>(samples);
+}
+
+}  // namespace orc
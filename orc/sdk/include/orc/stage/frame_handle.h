@@ -0,0 +1,60 @@
+/*
+ * File:        frame_handle.h
+ * Module:      decode-orc Plugin SDK (stage contract)
+ * Purpose:     Shared-ownership frame handles for VideoFrameRepresentation
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <orc/stage/dropout/dropout_run.h>
+#include <orc/stage/frame_id.h>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace orc {
+
+// Immutable sample buffer with shared ownership. Producers hand out buffers
+// they already hold (typically via the shared_ptr aliasing constructor over a
+// cached frame), so taking a reference never copies samples.
+using SharedSampleBuffer = std::shared_ptr<const std::vector<int16_t>>;
+
+// ============================================================================
+// AcquiredFrame / FrameHandle
+// ============================================================================
+// Snapshot of one output frame of a VideoFrameRepresentation, as returned by
+// VideoFrameRepresentation::acquire_frame(). Buffers use the flat frame
+// layout of get_frame(); |luma| and |chroma| are set only for YC sources.
+// Dropout runs describe this frame (frame_id == |frame_id|).
+//
+// Unlike the pointers returned by get_frame(), a handle stays valid for as
+// long as it is held, on any thread: upstream caches may evict the frame
+// without invalidating it. Handles are immutable; a consumer that needs to
+// modify samples copies the buffer it modifies.
+struct AcquiredFrame {
+  FrameID frame_id = 0;
+  SharedSampleBuffer samples;
+  SharedSampleBuffer luma;
+  SharedSampleBuffer chroma;
+  std::vector<DropoutRun> dropouts;
+};
+
+using FrameHandle = std::shared_ptr<const AcquiredFrame>;
+
+// Re-labels |upstream| as output frame |id| with |dropouts|, sharing its
+// sample buffers. For pass-through stages that remap IDs or change hints.
+inline FrameHandle forward_frame_handle(const FrameHandle& upstream, FrameID id,
+                                        std::vector<DropoutRun> dropouts) {
+  if (!upstream) return nullptr;
+  auto frame = std::make_shared<AcquiredFrame>(*upstream);
+  frame->frame_id = id;
+  frame->dropouts = std::move(dropouts);
+  return frame;
+}
+
+}  // namespace orc
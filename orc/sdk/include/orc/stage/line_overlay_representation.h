@@ -0,0 +1,596 @@
+/*
+ * File:        line_overlay_representation.h
+ * Module:      decode-orc Plugin SDK (stage contract)
+ * Purpose:     Line-overlay VFrameR base for pass-through transform stages
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+#include <orc/abi/orc_plugin_services.h>
+#include <orc/stage/frame_buffer_pool.h>
+#include <orc/stage/trace.h>
+#include <orc/stage/video_frame_representation.h>
+#include <orc/support/frame_line_util.h>
+#include <orc/support/lru_cache.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace orc {
+
+// ============================================================================
+// LineOverlayFrameRepresentation
+// ============================================================================
+// Base for transform stages whose output is the wrapped input with, at most,
+// (a) frame IDs remapped, (b) synthetic frames of uniform level inserted, and
+// (c) whole lines substituted. Such stages never need a private copy of the
+// recording: unchanged frames and lines are served straight from the
+// upstream buffers, and only the substituted lines are rendered.
+//
+// A flat frame containing substituted lines is materialised on demand (the
+// flat accessors must return one contiguous buffer) into a byte-budgeted LRU
+// cache, so memory is bounded by the budget rather than by the number of
+// frames read. Substituted lines requested on their own are rendered into a
+// separate, smaller line cache without materialising the frame.
+//
+// Subclasses describe the output through the protected hooks:
+//   source_frame_id()     output FrameID -> upstream FrameID (identity by
+//                         default; nullopt for IDs that do not exist)
+//   is_synthetic_frame()  frames with no upstream, uniformly filled at
+//                         synthetic_fill_level() (e.g. alignment padding)
+//   overlays_line() / render_overlay_line()
+//                         lines replaced in the output and their content
+//
+// Every per-frame accessor of the wrapper is implemented in terms of these
+// hooks, so ID translation reaches hints, audio, EFM and AC3 as well as the
+// samples. Subclasses still own navigation (frame_range / frame_count) and
+// any descriptor they synthesise for synthetic frames.
+//
+// Pointers returned for materialised frames and rendered lines stay valid
+// until the entry is evicted from the cache; the budget always holds several
+// frames, which covers the "valid until the next call" contract of
+// VideoFrameRepresentation for concurrent readers.
+class LineOverlayFrameRepresentation : public VideoFrameRepresentationWrapper {
+ public:
+  // Which buffer a substituted line belongs to.
+  enum class Plane : uint8_t { Composite, Luma, Chroma };
+
+  // Default cache budget: about 20 PAL frames.
+  static constexpr size_t kDefaultCacheBudgetBytes = 32 * 1024 * 1024;
+
+  ~LineOverlayFrameRepresentation() override = default;
+
+  // Navigation
+  bool has_frame(FrameID id) const override {
+    if (is_synthetic_frame(id)) return true;
+    const auto src = source_frame_id(id);
+    return src && source_ && source_->has_frame(*src);
+  }
+  std::optional<FrameDescriptor> get_frame_descriptor(
+      FrameID id) const override {
+    const auto src = source_frame_id(id);
+    if (!src || !source_ || is_synthetic_frame(id)) return std::nullopt;
+    auto desc = source_->get_frame_descriptor(*src);
+    if (desc) desc->frame_id = id;
+    return desc;
+  }
+
+  // Flat access
+  const sample_type* get_frame(FrameID id) const override {
+    return frame_plane(id, Plane::Composite);
+  }
+  const sample_type* get_line(FrameID id, size_t line) const override {
+    return line_plane(id, line, Plane::Composite);
+  }
+  std::vector<sample_type> get_line_samples(FrameID id,
+                                            size_t line) const override {
+    // Unchanged lines keep the wrapped source's single-line read path.
+    const auto src = source_frame_id(id);
+    if (!is_synthetic_frame(id) && src && source_ &&
+        !overlays_line(id, line)) {
+      return source_->get_line_samples(*src, line);
+    }
+    return VideoFrameRepresentation::get_line_samples(id, line);
+  }
+  // Runs of frames that map to consecutive upstream frames and substitute
+  // none of |lines| forward to the wrapped source's batched read; the rest
+  // are read row by row.
+  bool read_lines(FrameIDRange frames, const std::vector<size_t>& lines,
+                  std::vector<sample_type>& out) const override {
+    const auto params = get_video_parameters();
+    out.clear();
+    if (!params || !source_) return false;
+    const size_t width = static_cast<size_t>(params->frame_width_nominal);
+    const size_t frame_stride = lines.size() * width;
+    const uint64_t count = frames.count();
+    out.assign(count * frame_stride, 0);
+
+    auto forwarded = [&](FrameID id) -> std::optional<FrameID> {
+      if (is_synthetic_frame(id)) return std::nullopt;
+      const auto src = source_frame_id(id);
+      if (!src) return std::nullopt;
+      for (const size_t line : lines) {
+        if (overlays_line(id, line)) return std::nullopt;
+      }
+      return src;
+    };
+
+    bool complete = true;
+    std::vector<sample_type> run_samples;
+    uint64_t f = 0;
+    while (f < count) {
+      const FrameID id = frames.first + f;
+      const auto src = forwarded(id);
+      if (!src) {
+        sample_type* row = out.data() + f * frame_stride;
+        for (const size_t line : lines) {
+          const auto samples = get_line_samples(id, line);
+          if (samples.size() >= width) {
+            std::copy(samples.begin(), samples.begin() + width, row);
+          } else {
+            complete = false;
+          }
+          row += width;
+        }
+        ++f;
+        continue;
+      }
+      uint64_t run = 1;
+      while (f + run < count) {
+        const auto next = forwarded(id + run);
+        if (!next || *next != *src + run) break;
+        ++run;
+      }
+      complete &= source_->read_lines(FrameIDRange{*src, *src + run - 1},
+                                      lines, run_samples);
+      if (run_samples.size() == run * frame_stride) {
+        std::copy(run_samples.begin(), run_samples.end(),
+                  out.begin() + static_cast<std::ptrdiff_t>(f * frame_stride));
+      } else {
+        complete = false;
+      }
+      f += run;
+    }
+    return complete;
+  }
+  std::vector<sample_type> get_frame_copy(FrameID id) const override {
+    if (is_synthetic_frame(id)) {
+      const sample_type* fill = synthetic_frame();
+      const size_t total =
+          std::min(output_samples_total(id), synthetic_frame_.size());
+      if (!fill || total == 0) return {};
+      return std::vector<sample_type>(fill, fill + total);
+    }
+    const auto src = source_frame_id(id);
+    if (!src || !source_) return {};
+    // Build straight from the source copy; a one-off copy should not evict
+    // frames other readers are working on.
+    auto frame = source_->get_frame_copy(*src);
+    if (!frame.empty() && has_overlay(id)) {
+      apply_overlay(id, Plane::Composite, frame);
+    }
+    return frame;
+  }
+
+  // Shared access: an unchanged frame re-issues the upstream handle under
+  // this frame's ID and hints; a frame with substituted lines shares the
+  // materialised buffers held by the frame cache.
+  FrameHandle acquire_frame(FrameID id) const override {
+    const auto src = source_frame_id(id);
+    if (is_synthetic_frame(id) || !src || !source_) {
+      return VideoFrameRepresentationWrapper::acquire_frame(id);
+    }
+    if (!has_overlay(id)) {
+      return forward_frame_handle(source_->acquire_frame(*src), id,
+                                  get_dropout_hints(id));
+    }
+    auto samples = materialised_plane(id, *src, Plane::Composite);
+    if (!samples) return nullptr;
+    auto frame = std::make_shared<AcquiredFrame>();
+    frame->frame_id = id;
+    frame->samples = std::move(samples);
+    if (source_->has_separate_channels()) {
+      frame->luma = materialised_plane(id, *src, Plane::Luma);
+      frame->chroma = materialised_plane(id, *src, Plane::Chroma);
+    }
+    frame->dropouts = get_dropout_hints(id);
+    return frame;
+  }
+
+  // YC. Synthetic frames carry no separate channels.
+  const sample_type* get_frame_luma(FrameID id) const override {
+    return frame_plane(id, Plane::Luma);
+  }
+  const sample_type* get_frame_chroma(FrameID id) const override {
+    return frame_plane(id, Plane::Chroma);
+  }
+  const sample_type* get_line_luma(FrameID id, size_t line) const override {
+    return line_plane(id, line, Plane::Luma);
+  }
+  const sample_type* get_line_chroma(FrameID id, size_t line) const override {
+    return line_plane(id, line, Plane::Chroma);
+  }
+
+  // Hints: runs describe the output frame they are reported for.
+  std::vector<DropoutRun> get_dropout_hints(FrameID id) const override {
+    const auto src = source_frame_id(id);
+    if (is_synthetic_frame(id) || !src || !source_) return {};
+    auto runs = source_->get_dropout_hints(*src);
+    if (*src != id) {
+      for (auto& run : runs) run.frame_id = id;
+    }
+    return runs;
+  }
+
+  // Audio. A remapped output frame p must serve exactly
+  // audio_pairs_in_frame(p) stereo pairs: synthetic frames carry
+  // cadence-sized silence, and a mapping that breaks the NTSC/PAL-M
+  // five-frame sequence phase (SMPTE 272M-1994 §14.3) truncates one trailing
+  // pair or appends one trailing silence pair. Unmapped frames forward as-is.
+  std::vector<int32_t> get_audio_samples(size_t pair,
+                                         FrameID id) const override {
+    if (!source_) return {};
+    const auto src = source_frame_id(id);
+    const bool synthetic = is_synthetic_frame(id);
+    if (!synthetic && !src) return {};
+    if (!synthetic && *src == id) return source_->get_audio_samples(pair, id);
+    if (pair >= source_->audio_channel_pair_count()) return {};
+
+    const auto params = get_video_parameters();
+    const size_t out_pairs = audio_pairs_in_frame(
+        id, params ? params->system : VideoSystem::Unknown);
+    if (synthetic) return std::vector<int32_t>(out_pairs * 2, 0);
+    auto samples = source_->get_audio_samples(pair, *src);
+    if (samples.empty() || out_pairs == 0) return samples;
+    samples.resize(out_pairs * 2, 0);
+    return samples;
+  }
+  // Same mapping over a range: consecutive unmapped frames forward in one
+  // read, mapped frames read their slice of the upstream window.
+  bool read_audio(size_t pair, uint64_t start_pair, size_t count,
+                  int32_t* out) const override {
+    std::fill(out, out + count * 2, 0);
+    if (!source_ || pair >= source_->audio_channel_pair_count()) return false;
+    const auto params = get_video_parameters();
+    const VideoSystem system = params ? params->system : VideoSystem::Unknown;
+    const FrameIDRange range = frame_range();
+    if (audio_pairs_in_frame(0, system) == 0 || range.empty()) return false;
+
+    bool complete = true;
+    size_t run_at = 0;
+    size_t run_pairs = 0;
+    auto flush_run = [&]() {
+      if (run_pairs == 0) return;
+      complete &= source_->read_audio(pair, start_pair + run_at, run_pairs,
+                                      out + run_at * 2);
+      run_pairs = 0;
+    };
+    for_each_audio_frame_span(
+        start_pair, count, system,
+        [&](uint64_t frame, size_t within, size_t pairs, size_t at) {
+          const bool synthetic = is_synthetic_frame(frame);
+          std::optional<FrameID> src;
+          if (!synthetic) src = source_frame_id(frame);
+          if (!synthetic && src && *src == frame && frame >= range.first &&
+              frame <= range.last) {
+            if (run_pairs == 0) run_at = at;
+            run_pairs += pairs;
+            return;
+          }
+          flush_run();
+          if (synthetic) return;
+          if (!src || frame < range.first || frame > range.last) {
+            complete = false;
+            return;
+          }
+          // Pairs past the end of the upstream window are the silence pad.
+          const size_t src_pairs = audio_pairs_in_frame(*src, system);
+          const size_t take =
+              within < src_pairs ? std::min(pairs, src_pairs - within) : 0;
+          if (take > 0) {
+            complete &= source_->read_audio(
+                pair, audio_pair_offset(*src, system) + within, take,
+                out + at * 2);
+          }
+        });
+    flush_run();
+    return complete;
+  }
+
+  // EFM / AC3
+  uint32_t get_efm_sample_count(FrameID id) const override {
+    const auto src = source_frame_id(id);
+    if (is_synthetic_frame(id) || !src || !source_) return 0;
+    return source_->get_efm_sample_count(*src);
+  }
+  std::vector<uint8_t> get_efm_samples(FrameID id) const override {
+    const auto src = source_frame_id(id);
+    if (is_synthetic_frame(id) || !src || !source_) return {};
+    return source_->get_efm_samples(*src);
+  }
+  uint32_t get_ac3_symbol_count(FrameID id) const override {
+    const auto src = source_frame_id(id);
+    if (is_synthetic_frame(id) || !src || !source_) return 0;
+    return source_->get_ac3_symbol_count(*src);
+  }
+  std::vector<uint8_t> get_ac3_symbols(FrameID id) const override {
+    const auto src = source_frame_id(id);
+    if (is_synthetic_frame(id) || !src || !source_) return {};
+    return source_->get_ac3_symbols(*src);
+  }
+
+  // Number of materialised frames / rendered lines currently cached.
+  size_t cached_frame_count() const { return frame_cache_.size(); }
+  size_t cached_line_count() const { return line_cache_.size(); }
+
+ protected:
+  explicit LineOverlayFrameRepresentation(
+      std::shared_ptr<const VideoFrameRepresentation> source,
+      size_t cache_budget_bytes = kDefaultCacheBudgetBytes)
+      : VideoFrameRepresentationWrapper(std::move(source)),
+        frame_cache_(
+            cache_entries(cache_budget_bytes - cache_budget_bytes / 8,
+                          source_frame_bytes(), kMinCachedFrames)),
+        line_cache_(cache_entries(cache_budget_bytes / 8,
+                                  source_line_bytes(), kMinCachedLines)) {}
+
+  // Upstream frame for output frame |id|; nullopt when |id| does not exist.
+  // Not consulted for synthetic frames.
+  virtual std::optional<FrameID> source_frame_id(FrameID id) const {
+    return id;
+  }
+
+  // True for output frames with no upstream frame. Their samples are
+  // synthetic_fill_level() throughout and they have no luma/chroma planes.
+  virtual bool is_synthetic_frame(FrameID /*id*/) const { return false; }
+
+  virtual sample_type synthetic_fill_level() const {
+    const auto params = get_video_parameters();
+    return params ? static_cast<sample_type>(params->blanking_level)
+                  : sample_type{0};
+  }
+
+  // True when frame-flat line |line| of output frame |id| is substituted.
+  virtual bool overlays_line(FrameID /*id*/, size_t /*line*/) const {
+    return false;
+  }
+
+  // Writes the |count| samples of substituted line |line| of |plane| to
+  // |out|. Called only for lines where overlays_line() is true.
+  virtual void render_overlay_line(FrameID /*id*/, size_t /*line*/,
+                                   Plane /*plane*/, sample_type* /*out*/,
+                                   size_t /*count*/) const {}
+
+  // True when any line of output frame |id| is substituted. The default
+  // scans overlays_line(); override when a cheaper answer is available.
+  virtual bool has_overlay(FrameID id) const {
+    const auto params = get_video_parameters();
+    const size_t height = params && params->frame_height > 0
+                              ? static_cast<size_t>(params->frame_height)
+                              : 0;
+    for (size_t line = 0; line < height; ++line) {
+      if (overlays_line(id, line)) return true;
+    }
+    return false;
+  }
+
+ private:
+  static constexpr size_t kMinCachedFrames = 4;
+  static constexpr size_t kMinCachedLines = 64;
+  static constexpr size_t kWholeFrame = SIZE_MAX;
+
+  struct CacheKey {
+    FrameID id;
+    size_t line;  // kWholeFrame for materialised frames
+    Plane plane;
+    bool operator==(const CacheKey& other) const {
+      return id == other.id && line == other.line && plane == other.plane;
+    }
+  };
+  struct CacheKeyHash {
+    size_t operator()(const CacheKey& key) const {
+      size_t h = std::hash<FrameID>{}(key.id);
+      h ^= std::hash<size_t>{}(key.line) + 0x9e3779b97f4a7c15ULL + (h << 6) +
+           (h >> 2);
+      return h ^ (static_cast<size_t>(key.plane) << 1);
+    }
+  };
+
+  static size_t cache_entries(size_t budget_bytes, size_t entry_bytes,
+                              size_t minimum) {
+    if (entry_bytes == 0) return minimum;
+    return std::max(minimum, budget_bytes / entry_bytes);
+  }
+  size_t source_frame_bytes() const {
+    const auto params =
+        source_ ? source_->get_video_parameters() : std::nullopt;
+    if (!params || params->frame_width_nominal <= 0 ||
+        params->frame_height <= 0) {
+      return 0;
+    }
+    return static_cast<size_t>(params->frame_width_nominal + 1) *
+           static_cast<size_t>(params->frame_height) * sizeof(sample_type);
+  }
+  size_t source_line_bytes() const {
+    const auto params =
+        source_ ? source_->get_video_parameters() : std::nullopt;
+    if (!params || params->frame_width_nominal <= 0) return 0;
+    return static_cast<size_t>(params->frame_width_nominal + 2) *
+           sizeof(sample_type);
+  }
+
+  size_t output_height(FrameID id) const {
+    if (const auto desc = get_frame_descriptor(id)) return desc->height;
+    const auto params = get_video_parameters();
+    return params && params->frame_height > 0
+               ? static_cast<size_t>(params->frame_height)
+               : 0;
+  }
+  size_t output_samples_total(FrameID id) const {
+    if (const auto desc = get_frame_descriptor(id)) return desc->samples_total;
+    const auto params = get_video_parameters();
+    if (!params || params->frame_height <= 0) return 0;
+    return frame_line_sample_offset(
+        params->system, static_cast<size_t>(params->frame_width_nominal),
+        static_cast<size_t>(params->frame_height));
+  }
+
+  const sample_type* upstream_frame(FrameID src, Plane plane) const {
+    switch (plane) {
+      case Plane::Luma:
+        return source_->get_frame_luma(src);
+      case Plane::Chroma:
+        return source_->get_frame_chroma(src);
+      case Plane::Composite:
+        break;
+    }
+    return source_->get_frame(src);
+  }
+  const sample_type* upstream_line(FrameID src, size_t line,
+                                   Plane plane) const {
+    switch (plane) {
+      case Plane::Luma:
+        return source_->get_line_luma(src, line);
+      case Plane::Chroma:
+        return source_->get_line_chroma(src, line);
+      case Plane::Composite:
+        break;
+    }
+    return source_->get_line(src, line);
+  }
+
+  // Renders every substituted line of |id| into the flat buffer |frame|.
+  void apply_overlay(FrameID id, Plane plane,
+                     std::vector<sample_type>& frame) const {
+    const auto params = get_video_parameters();
+    if (!params) return;
+    const auto spl = static_cast<size_t>(params->frame_width_nominal);
+    const size_t height = output_height(id);
+    size_t offset = 0;
+    for (size_t line = 0; line < height; ++line) {
+      const size_t width = frame_line_sample_count(params->system, spl, line);
+      if (offset + width > frame.size()) break;
+      if (overlays_line(id, line)) {
+        render_overlay_line(id, line, plane, frame.data() + offset, width);
+      }
+      offset += width;
+    }
+  }
+
+  const sample_type* frame_plane(FrameID id, Plane plane) const {
+    if (plane != Plane::Composite &&
+        (!source_ || !source_->has_separate_channels())) {
+      return nullptr;
+    }
+    if (is_synthetic_frame(id)) {
+      return plane == Plane::Composite ? synthetic_frame() : nullptr;
+    }
+    const auto src = source_frame_id(id);
+    if (!src || !source_) return nullptr;
+    if (!has_overlay(id)) return upstream_frame(*src, plane);
+    // The cache keeps the buffer alive after |frame| is released.
+    const auto frame = materialised_plane(id, *src, plane);
+    return frame ? frame->data() : upstream_frame(*src, plane);
+  }
+
+  // |plane| of output frame |id| (upstream frame |src|) with its substituted
+  // lines rendered, from the frame cache or built into it. nullptr when the
+  // upstream plane is unavailable.
+  SharedSampleBuffer materialised_plane(FrameID id, FrameID src,
+                                        Plane plane) const {
+    const CacheKey key{id, kWholeFrame, plane};
+    if (auto cached = frame_cache_.get(key)) return *cached;
+    const sample_type* upstream = upstream_frame(src, plane);
+    const size_t total = output_samples_total(id);
+    if (!upstream || total == 0) return nullptr;
+
+    ORC_TRACE_FRAME_SCOPE(plugin::get_tracer(), "transform",
+                          "materialise_overlay_frame", nullptr, id);
+    // Materialised frames are drawn from the host frame buffer pool, so a
+    // frame evicted here is recycled for the next one.
+    auto frame = acquire_sample_buffer(plugin::get_frame_buffer_pool(), total);
+    std::copy(upstream, upstream + total, frame->begin());
+    apply_overlay(id, plane, *frame);
+    SharedSampleBuffer buffer = std::move(frame);
+    // put_if_absent: a concurrent reader may have materialised the same
+    // frame and already hold a pointer into it; share that one instead.
+    if (!frame_cache_.put_if_absent(key, buffer)) {
+      if (auto cached = frame_cache_.get(key)) return *cached;
+    }
+    return buffer;
+  }
+
+  const sample_type* line_plane(FrameID id, size_t line, Plane plane) const {
+    if (plane != Plane::Composite &&
+        (!source_ || !source_->has_separate_channels())) {
+      return nullptr;
+    }
+    const auto params = get_video_parameters();
+    if (!params || line >= static_cast<size_t>(params->frame_height)) {
+      return nullptr;
+    }
+    const auto spl = static_cast<size_t>(params->frame_width_nominal);
+    if (is_synthetic_frame(id)) {
+      const sample_type* fill =
+          plane == Plane::Composite ? synthetic_frame() : nullptr;
+      return fill ? fill + frame_line_sample_offset(params->system, spl, line)
+                  : nullptr;
+    }
+    const auto src = source_frame_id(id);
+    if (!src || !source_) return nullptr;
+    if (!overlays_line(id, line)) return upstream_line(*src, line, plane);
+
+    // Serve from the materialised frame when a flat reader already built it.
+    if (const auto* frame =
+            frame_cache_.get_ptr(CacheKey{id, kWholeFrame, plane})) {
+      return (*frame)->data() +
+             frame_line_sample_offset(params->system, spl, line);
+    }
+    const CacheKey key{id, line, plane};
+    if (const auto* cached = line_cache_.get_ptr(key)) {
+      return cached->data();
+    }
+    std::vector<sample_type> samples(
+        frame_line_sample_count(params->system, spl, line));
+    render_overlay_line(id, line, plane, samples.data(), samples.size());
+    line_cache_.put_if_absent(key, std::move(samples));
+    const auto* cached = line_cache_.get_ptr(key);
+    return cached ? cached->data() : nullptr;
+  }
+
+  // One flat frame at synthetic_fill_level(), shared by every synthetic
+  // frame and sized for the full line geometry.
+  const sample_type* synthetic_frame() const {
+    std::call_once(synthetic_once_, [this] {
+      const auto params = get_video_parameters();
+      if (!params || params->frame_height <= 0 ||
+          params->frame_width_nominal <= 0) {
+        return;
+      }
+      const size_t total = frame_line_sample_offset(
+          params->system, static_cast<size_t>(params->frame_width_nominal),
+          static_cast<size_t>(params->frame_height));
+      synthetic_frame_.assign(total, synthetic_fill_level());
+    });
+    return synthetic_frame_.empty() ? nullptr : synthetic_frame_.data();
+  }
+
+  // Materialised frames are shared so acquire_frame() handles outlive
+  // eviction.
+  mutable LRUCache<CacheKey, SharedSampleBuffer, CacheKeyHash> frame_cache_;
+  mutable LRUCache<CacheKey, std::vector<sample_type>, CacheKeyHash>
+      line_cache_;
+  mutable std::once_flag synthetic_once_;
+  mutable std::vector<sample_type> synthetic_frame_;
+};
+
+}  // namespace orc
@@ -0,0 +1,103 @@
+/*
+ * File:        metrics.h
+ * Module:      decode-orc Plugin SDK (stage contract)
+ * Purpose:     Host pipeline metrics registry (counters, gauges, histograms)
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+// SDK TIER: stage — stage contract type crossing the plugin boundary. A layout
+// change here bumps the host ABI version.
+
+#include <chrono>
+#include <cstdint>
+
+namespace orc {
+
+/// Monotonically increasing count (frames written, bytes read, cache hits).
+class IMetricCounter {
+ public:
+  virtual ~IMetricCounter() = default;
+  virtual void add(uint64_t delta) = 0;
+};
+
+/// Value that goes up and down (queue depth, memory in use).
+class IMetricGauge {
+ public:
+  virtual ~IMetricGauge() = default;
+  virtual void set(double value) = 0;
+  virtual void add(double delta) = 0;
+};
+
+/// Distribution of observed latencies, in seconds.
+class IMetricHistogram {
+ public:
+  virtual ~IMetricHistogram() = default;
+  virtual void observe(double seconds) = 0;
+};
+
+/**
+ * @brief Host registry of live pipeline metrics.
+ *
+ * Stages look an instrument up once (typically at construction) and then
+ * update it from any thread; updates are lock-free. The host samples the
+ * registry for the CLI status line, the Prometheus textfile
+ * (`orc-cli --process --metrics-file`) and the GUI performance panel.
+ *
+ * Names follow Prometheus conventions: snake_case with an `orc_` prefix,
+ * `_total` for counters and a unit suffix (`_bytes`, `_seconds`).
+ * @p labels is a comma-separated `key=value` list, e.g. `cache=stacker.frames`,
+ * or empty; values may not contain commas. Repeated lookups with the same name
+ * and labels return the same instrument, so every instance of a stage
+ * contributes to one series. Returned pointers are host-owned and stay valid
+ * for the life of the process. A name already registered as another kind
+ * yields nullptr.
+ *
+ * Thread-safety: all methods may be called concurrently from any thread.
+ *
+ * Boundary safety: no method throws across the plugin boundary.
+ */
+class IMetricsRegistry {
+ public:
+  virtual ~IMetricsRegistry() = default;
+
+  virtual IMetricCounter* counter(const char* name, const char* help,
+                                  const char* labels) = 0;
+  virtual IMetricGauge* gauge(const char* name, const char* help,
+                              const char* labels) = 0;
+  virtual IMetricHistogram* histogram(const char* name, const char* help,
+                                      const char* labels) = 0;
+};
+
+/**
+ * @brief RAII latency sample: observes its own lifetime into a histogram.
+ *
+ * Inert when @p histogram is nullptr (older hosts, unit tests without a
+ * host).
+ */
+class MetricTimer {
+ public:
+  explicit MetricTimer(IMetricHistogram* histogram) : histogram_(histogram) {
+    if (histogram_) start_ = std::chrono::steady_clock::now();
+  }
+
+  ~MetricTimer() {
+    if (histogram_) {
+      histogram_->observe(std::chrono::duration<double>(
+                              std::chrono::steady_clock::now() - start_)
+                              .count());
+    }
+  }
+
+  MetricTimer(const MetricTimer&) = delete;
+  MetricTimer& operator=(const MetricTimer&) = delete;
+
+ private:
+  IMetricHistogram* histogram_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace orc
@@ -84,6 +84,11 @@ struct ParameterDescriptor {
   // explicitly for output paths on stages that are not sinks (e.g. a report
   // file written by a transform stage).
   bool output_path = false;
+  // For STRING types holding large, tool-edited data (dropout maps, frame
+  // ranges): when true, values above a size threshold are stored in the
+  // project's content-addressed blob store and the stage receives a blob
+  // reference instead of the text. See <orc/stage/blob_store.h>.
+  bool blob_storage = false;
 };
 
 /// Helper functions to work with parameter values
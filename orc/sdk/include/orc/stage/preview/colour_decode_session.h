@@ -0,0 +1,78 @@
+/*
+ * File:        colour_decode_session.h
+ * Module:      decode-orc Plugin SDK (stage contract)
+ * Purpose:     Optional interface for stages that can decode colour frames on
+ *              several threads at once for whole-recording analysis.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#pragma once
+
+// SDK TIER: stage/preview — stage contract type crossing the plugin boundary.
+// A layout change here bumps the host ABI version.
+
+#include <orc/stage/preview/orc_preview_carriers.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace orc {
+
+/**
+ * @brief Independent colour decoder over a stage's current input.
+ *
+ * A session owns its own instance of the stage's configured decoder, so
+ * several sessions may decode concurrently, one per thread. A single session
+ * is not thread-safe.
+ *
+ * The session keeps the input the stage held when it was opened; it must not
+ * outlive the stage that opened it.
+ */
+class IColourDecodeSession {
+ public:
+  virtual ~IColourDecodeSession() = default;
+
+  /// Number of frames the session can decode (indices 0..frame_count()-1).
+  virtual uint64_t frame_count() const = 0;
+
+  /**
+   * @brief Decode one frame at full quality.
+   *
+   * Unlike IColourPreviewProvider::get_colour_preview_carrier(), the carrier
+   * need not carry vectorscope data; callers read the component planes.
+   *
+   * @param frame_index Frame index in the stage's navigation domain.
+   * @return Carrier when available; std::nullopt on decode/fetch failure.
+   */
+  virtual std::optional<ColourFrameCarrier> decode_colour_frame(
+      uint64_t frame_index) = 0;
+};
+
+/**
+ * @brief Optional companion to IColourPreviewProvider for batch analysis.
+ *
+ * Preview carriers are decoded one at a time through a decoder shared by the
+ * preview paths. Stages implementing this interface additionally hand out
+ * decode sessions, letting hosts decode a whole recording in parallel with
+ * the same decoder configuration the export would use.
+ *
+ * Discovered with dynamic_cast; the stage must have been executed so that it
+ * holds an input.
+ */
+class IColourDecodeSessionProvider {
+ public:
+  virtual ~IColourDecodeSessionProvider() = default;
+
+  /**
+   * @brief Open a decode session over the stage's current input.
+   *
+   * @return Session, or nullptr when the stage has no input to decode.
+   */
+  virtual std::unique_ptr<IColourDecodeSession> open_colour_decode_session()
+      const = 0;
+};
+
+}  // namespace orc
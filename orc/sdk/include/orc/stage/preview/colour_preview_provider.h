@@ -16,6 +16,7 @@
 #include <orc/stage/preview/preview_stage_types.h>
 
 #include <cstdint>
+#include <functional>
 #include <optional>
 
 namespace orc {
@@ -48,4 +49,38 @@ class IColourPreviewProvider {
   }
 };
 
+/// Polled by a cancellable decode; returning true abandons it.
+using ColourPreviewCancelCheck = std::function<bool()>;
+
+/**
+ * @brief Optional companion to IColourPreviewProvider for abandonable decodes.
+ *
+ * A colour decode can take long enough that the host no longer wants the
+ * result by the time it finishes (the user scrubbed on). A stage implementing
+ * this interface polls @p cancelled between its field fetches and decode
+ * steps and returns std::nullopt as soon as it reports true.
+ *
+ * Discovered with dynamic_cast; hosts fall back to the uncancellable calls.
+ */
+class ICancellableColourPreviewProvider {
+ public:
+  virtual ~ICancellableColourPreviewProvider() = default;
+
+  /**
+   * @brief Cancellable get_colour_preview_carrier(), or with @p draft the
+   * IDraftColourPreviewProvider::get_draft_colour_preview_carrier() decode.
+   *
+   * @param frame_index Frame index in the stage's navigation domain.
+   * @param hint Navigation hint from preview consumers (ignored for drafts).
+   * @param draft True for the draft decode; only valid when the stage also
+   *              implements IDraftColourPreviewProvider.
+   * @param cancelled Cancel check; may be empty.
+   * @return Carrier when available; std::nullopt on failure or cancellation.
+   */
+  virtual std::optional<ColourFrameCarrier>
+  get_cancellable_colour_preview_carrier(
+      uint64_t frame_index, PreviewNavigationHint hint, bool draft,
+      const ColourPreviewCancelCheck& cancelled) const = 0;
+};
+
 }  // namespace orc
@@ -0,0 +1,63 @@
+/*
+ * File:        draft_colour_preview_provider.h
+ * Module:      decode-orc Plugin SDK (stage contract)
+ * Purpose:     Optional interface for stages offering a fast, reduced-quality
+ *              colour preview for interactive navigation.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#pragma once
+
+// SDK TIER: stage/preview — stage contract type crossing the plugin boundary.
+// A layout change here bumps the host ABI version.
+
+#include <orc/stage/preview/orc_preview_carriers.h>
+
+#include <cstdint>
+#include <optional>
+
+namespace orc {
+
+/**
+ * @brief Horizontal decimation of draft colour preview carriers.
+ *
+ * Carrier sample x of a draft covers full-resolution samples
+ * x * kDraftColourPreviewDecimation onwards; `width` and the `active_x_*`
+ * bounds are in draft samples. Hosts widen the rendered image by this factor
+ * so a draft has the geometry of the full-quality preview it stands in for.
+ */
+inline constexpr uint32_t kDraftColourPreviewDecimation = 2;
+
+/**
+ * @brief Optional companion to IColourPreviewProvider for interactive
+ * navigation.
+ *
+ * Full-quality colour previews run the stage's configured decoder, which may
+ * need neighbouring frames and noise reduction. A stage implementing this
+ * interface also offers a draft: a single-frame, low-cost decode meant to keep
+ * up with scrubbing. Hosts show drafts while the user navigates and replace
+ * them with get_colour_preview_carrier() once navigation pauses.
+ *
+ * Discovered with dynamic_cast alongside IColourPreviewProvider; stages that do
+ * not implement it are always previewed at full quality.
+ */
+class IDraftColourPreviewProvider {
+ public:
+  virtual ~IDraftColourPreviewProvider() = default;
+
+  /**
+   * @brief Return a draft carrier for the requested frame index.
+   *
+   * The carrier is decimated horizontally by kDraftColourPreviewDecimation and
+   * need not carry vectorscope data.
+   *
+   * @param frame_index Frame index in the stage's navigation domain.
+   * @return Carrier when available; std::nullopt on decode/fetch failure.
+   */
+  virtual std::optional<ColourFrameCarrier> get_draft_colour_preview_carrier(
+      uint64_t frame_index) const = 0;
+};
+
+}  // namespace orc
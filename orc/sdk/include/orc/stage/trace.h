@@ -0,0 +1,116 @@
+/*
+ * File:        trace.h
+ * Module:      decode-orc Plugin SDK (stage contract)
+ * Purpose:     Host execution tracer and scoped trace spans
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+// SDK TIER: stage — stage contract type crossing the plugin boundary. A layout
+// change here bumps the host ABI version.
+
+#include <cstdint>
+
+namespace orc {
+
+/// TraceSpan::frame value of a span that is not about one frame.
+inline constexpr uint64_t kTraceNoFrame = ~uint64_t{0};
+
+/**
+ * @brief One completed span, as handed to ITracer::record().
+ *
+ * The strings are copied (and may be truncated) by record(), so they only
+ * need to live for the duration of the call. Timestamps come from
+ * ITracer::now_ns().
+ */
+struct TraceSpan {
+  const char* category = "";       ///< Coarse group: "dag", "source", ...
+  const char* name = "";           ///< What ran: "execute", "decode", ...
+  const char* stage = nullptr;     ///< Stage or node tag; nullptr if none.
+  uint64_t frame = kTraceNoFrame;  ///< Frame tag; kTraceNoFrame if none.
+  uint64_t start_ns = 0;
+  uint64_t end_ns = 0;
+};
+
+/**
+ * @brief Host service recording timed spans for offline inspection.
+ *
+ * The host captures spans only while a trace is running (for example
+ * `orc-cli --process --trace out.json`) and writes them in Chrome trace event
+ * format for chrome://tracing or Perfetto. Outside a capture enabled() is
+ * false and TraceScope does nothing beyond that check, so instrumentation may
+ * stay in hot paths. Spans should cover per-frame or coarser work; the host
+ * keeps a bounded buffer per thread and drops the oldest spans when it fills.
+ *
+ * Thread-safety: all methods may be called concurrently from any thread.
+ *
+ * Boundary safety: no method throws across the plugin boundary.
+ */
+class ITracer {
+ public:
+  virtual ~ITracer() = default;
+
+  /// True while a capture is running.
+  virtual bool enabled() const = 0;
+
+  /// Monotonic timestamp, in nanoseconds, on the tracer's clock.
+  virtual uint64_t now_ns() const = 0;
+
+  /// Record a completed span on the calling thread. Ignored when disabled.
+  virtual void record(const TraceSpan& span) = 0;
+};
+
+/**
+ * @brief RAII span: times its own lifetime and records it on destruction.
+ *
+ * @p tracer may be nullptr (older hosts, unit tests without a host), in which
+ * case the scope is inert. Use the ORC_TRACE_* macros below, or the
+ * ORC_PLUGIN_TRACE_* macros from plugin code.
+ */
+class TraceScope {
+ public:
+  TraceScope(ITracer* tracer, const char* category, const char* name,
+             const char* stage = nullptr, uint64_t frame = kTraceNoFrame)
+      : tracer_(tracer && tracer->enabled() ? tracer : nullptr) {
+    if (tracer_) {
+      span_.category = category;
+      span_.name = name;
+      span_.stage = stage;
+      span_.frame = frame;
+      span_.start_ns = tracer_->now_ns();
+    }
+  }
+
+  ~TraceScope() {
+    if (tracer_) {
+      span_.end_ns = tracer_->now_ns();
+      tracer_->record(span_);
+    }
+  }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+ private:
+  ITracer* tracer_;
+  TraceSpan span_;
+};
+
+}  // namespace orc
+
+#define ORC_TRACE_CONCAT_INNER_(a_, b_) a_##b_
+#define ORC_TRACE_CONCAT_(a_, b_) ORC_TRACE_CONCAT_INNER_(a_, b_)
+
+/// Trace the rest of the enclosing block as span @p name_ on @p tracer_.
+#define ORC_TRACE_SCOPE(tracer_, category_, name_)                 \
+  ::orc::TraceScope ORC_TRACE_CONCAT_(orc_trace_scope_, __LINE__)( \
+      (tracer_), (category_), (name_))
+
+/// As ORC_TRACE_SCOPE, tagged with a stage and a frame id.
+#define ORC_TRACE_FRAME_SCOPE(tracer_, category_, name_, stage_, frame_) \
+  ::orc::TraceScope ORC_TRACE_CONCAT_(orc_trace_scope_, __LINE__)(    \
+      (tracer_), (category_), (name_), (stage_),                       \
+      static_cast<uint64_t>(frame_))
@@ -12,11 +12,13 @@
 #include <orc/stage/audio/audio_channel_pair.h>
 #include <orc/stage/dropout/dropout_run.h>
 #include <orc/stage/frame_descriptor.h>
+#include <orc/stage/frame_handle.h>
 #include <orc/stage/frame_id.h>
 #include <orc/stage/orc_source_parameters.h>
 #include <orc/stage/video_metadata_types.h>
 #include <orc/support/frame_line_util.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -118,6 +120,73 @@ class VideoFrameRepresentation {
     return std::vector<sample_type>(ptr, ptr + width);
   }
 
+  // Batched sparse-line access for scanners that touch a few lines of every
+  // frame across a long range (VBI, VITS, white flag). Copies lines |lines|
+  // (frame-line numbers, any order) of every frame in |frames| into |out|,
+  // frame-major: the samples of frame |frames.first| + f, line |lines|[k]
+  // start at out[(f * lines.size() + k) * frame_width_nominal]. Each row
+  // holds what get_line_samples() returns; rows that cannot be read are
+  // zero-filled. Returns false when any row could not be read.
+  // Sources override it to fetch every requested line of the range in a few
+  // coalesced reads instead of one read (or one full frame) per line;
+  // pass-through wrappers forward it. Default: get_line_samples() per row.
+  virtual bool read_lines(FrameIDRange frames, const std::vector<size_t>& lines,
+                          std::vector<sample_type>& out) const {
+    out.clear();
+    const auto params = get_video_parameters();
+    if (!params) return false;
+    const size_t width = static_cast<size_t>(params->frame_width_nominal);
+    const uint64_t count = frames.count();
+    out.assign(count * lines.size() * width, 0);
+    bool complete = true;
+    sample_type* row = out.data();
+    for (uint64_t f = 0; f < count; ++f) {
+      for (const size_t line : lines) {
+        const auto samples = get_line_samples(frames.first + f, line);
+        if (samples.size() >= width) {
+          std::copy(samples.begin(), samples.begin() + width, row);
+        } else {
+          complete = false;
+        }
+        row += width;
+      }
+    }
+    return complete;
+  }
+
+  // --------------------------------------------------------------------------
+  // Shared-ownership access
+  // --------------------------------------------------------------------------
+
+  // Immutable handle to frame |id| (samples, YC planes when
+  // has_separate_channels(), dropout hints) that stays valid while held —
+  // see frame_handle.h. Returns nullptr when id is not present.
+  // Default: owned copies through get_frame_copy() and the YC accessors.
+  // Sources and caching stages override it to share the buffers they already
+  // hold, so consumers that keep frames across calls never copy samples.
+  virtual FrameHandle acquire_frame(FrameID id) const {
+    auto samples = get_frame_copy(id);
+    if (samples.empty()) return nullptr;
+    auto frame = std::make_shared<AcquiredFrame>();
+    frame->frame_id = id;
+    if (has_separate_channels()) {
+      const auto desc = get_frame_descriptor(id);
+      const size_t total = desc ? desc->samples_total : samples.size();
+      if (const sample_type* luma = get_frame_luma(id)) {
+        frame->luma = std::make_shared<const std::vector<sample_type>>(
+            luma, luma + total);
+      }
+      if (const sample_type* chroma = get_frame_chroma(id)) {
+        frame->chroma = std::make_shared<const std::vector<sample_type>>(
+            chroma, chroma + total);
+      }
+    }
+    frame->samples =
+        std::make_shared<const std::vector<sample_type>>(std::move(samples));
+    frame->dropouts = get_dropout_hints(id);
+    return frame;
+  }
+
   // --------------------------------------------------------------------------
   // YC (separate luma / chroma) access
   // --------------------------------------------------------------------------
@@ -187,6 +256,47 @@ class VideoFrameRepresentation {
     return {};
   }
 
+  // Range access for streaming consumers (export, stacking, alignment):
+  // copies |count| interleaved stereo pairs of channel pair |pair| into
+  // |out| (2 * count values), starting at absolute stream position
+  // |start_pair|. Positions are audio_pair_offset() coordinates, so frame n's
+  // window starts at audio_pair_offset(n, system) and a range may span any
+  // number of frames. |out| is zero-filled first; pairs outside frame_range()
+  // or that the producer cannot serve stay silent. Returns false when any
+  // pair stayed silent for that reason, when |pair| is out of range, or when
+  // the video system is unknown.
+  // Sources override it to copy straight from resident or on-disk audio, and
+  // pass-through wrappers forward it, so a long range costs no per-frame
+  // vector. Default: get_audio_samples() per frame.
+  virtual bool read_audio(size_t pair, uint64_t start_pair, size_t count,
+                          int32_t* out) const {
+    std::fill(out, out + count * 2, 0);
+    if (pair >= audio_channel_pair_count()) return false;
+    const auto params = get_video_parameters();
+    const VideoSystem system = params ? params->system : VideoSystem::Unknown;
+    const FrameIDRange range = frame_range();
+    if (audio_pairs_in_frame(0, system) == 0 || range.empty()) return false;
+    bool complete = true;
+    for_each_audio_frame_span(
+        start_pair, count, system,
+        [&](uint64_t frame, size_t within, size_t pairs, size_t at) {
+          if (frame < range.first || frame > range.last) {
+            complete = false;
+            return;
+          }
+          const auto samples = get_audio_samples(pair, frame);
+          const size_t first = within * 2;
+          const size_t last = std::min(samples.size(), (within + pairs) * 2);
+          if (last < (within + pairs) * 2) complete = false;
+          if (last > first) {
+            std::copy(samples.begin() + static_cast<std::ptrdiff_t>(first),
+                      samples.begin() + static_cast<std::ptrdiff_t>(last),
+                      out + at * 2);
+          }
+        });
+    return complete;
+  }
+
   // Force any deferred whole-stream audio decode backing this representation to
   // run now, reporting progress through |progress|. The default is a no-op:
   // representations whose audio is cheap or already resident need do nothing.
@@ -243,18 +353,21 @@ class VideoFrameRepresentation {
 //      get_dropout_hints, get_video_parameters, audio / EFM / AC3 accessors.
 //    A stage that remaps frame IDs MUST override every per-frame accessor in
 //    this group so IDs are translated on the way through. For audio that
-//    means get_audio_samples (per channel pair): the output frame at
-//    timeline index p must serve exactly audio_pairs_in_frame(p) pairs, so
-//    a mapping that breaks the NTSC/PAL-M cadence phase (source frame index
-//    not congruent to the output index mod 5) must truncate or silence-pad
-//    the mapped window by the one-pair difference — see
-//    audio_channel_pair.h.
+//    means get_audio_samples and read_audio (per channel pair — a stage
+//    that changes audio overrides both, or read_audio's forward would
+//    bypass it): the output frame at timeline index p must serve exactly
+//    audio_pairs_in_frame(p) pairs, so a mapping that breaks the NTSC/PAL-M
+//    cadence phase (source frame index not congruent to the output index
+//    mod 5) must truncate or silence-pad the mapped window by the one-pair
+//    difference — see audio_channel_pair.h.
 //
 // 2. Derived accessors — implemented here in terms of this object's own
 //    virtual primitives, never forwarded:
 //      get_line, get_line_samples  (derive from get_frame)
 //      get_frame_copy              (derives from get_frame)
 //      get_line_luma / get_line_chroma  (derive from get_frame_luma/chroma)
+//      acquire_frame               (derives from get_frame_copy, the YC
+//                                   accessors and get_dropout_hints)
 //    Overriding the frame-level primitives is therefore sufficient for
 //    correctness on every read path; overriding a derived accessor is purely
 //    an optimisation (e.g. a pass-through stage restoring the wrapped
@@ -339,6 +452,12 @@ class VideoFrameRepresentationWrapper : public VideoFrameRepresentation {
     return source_ ? source_->get_audio_samples(pair, id)
                    : std::vector<int32_t>{};
   }
+  bool read_audio(size_t pair, uint64_t start_pair, size_t count,
+                  int32_t* out) const override {
+    if (source_) return source_->read_audio(pair, start_pair, count, out);
+    std::fill(out, out + count * 2, 0);
+    return false;
+  }
   // Forward priming down the chain so a deferred decode nested beneath any
   // number of wrappers (e.g. an audio_channel_map between EFM decode and the
   // sink) is still reached. A wrapper that itself owns a deferred decode
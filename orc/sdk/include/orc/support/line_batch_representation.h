@@ -0,0 +1,120 @@
+/*
+ * File:        line_batch_representation.h
+ * Module:      decode-orc Plugin SDK (stage contract)
+ * Purpose:     Serves a fixed line set of a frame window from one batched read
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+// SDK TIER: support — compiled-into-plugin utility. NOT part of the binary
+// ABI; changes never force an ABI bump (recompile the plugin at your leisure).
+
+#include <orc/stage/video_frame_representation.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace orc {
+
+// ============================================================================
+// LineBatchRepresentation
+// ============================================================================
+// Wraps a representation for a whole-recording scan that only touches a few
+// lines of each frame (VBI, VITS, white flag). load() fetches |lines| of a
+// window of frames with one VideoFrameRepresentation::read_lines() call;
+// get_line() and get_line_samples() for those lines and frames are then
+// served from the batch, so observers written against the per-frame API read
+// kilobytes per field instead of assembling whole frames. Every other
+// request falls through to the wrapped source.
+//
+// @code
+//   LineBatchRepresentation batch(source, {15, 16, 17, 328, 329, 330});
+//   for (FrameID first = range.first; first <= range.last; first += 256) {
+//     batch.load({first, std::min(range.last, first + 255)});
+//     for (FrameID id = first; id <= batch.loaded_range().last; ++id)
+//       observer.process_frame(batch, id, context);
+//   }
+// @endcode
+//
+// Thread safety: load() must not run concurrently with any other call; use
+// one instance per scanning thread. Pointers from get_line() stay valid until
+// the next load().
+class LineBatchRepresentation : public VideoFrameRepresentationWrapper {
+ public:
+  LineBatchRepresentation(
+      std::shared_ptr<const VideoFrameRepresentation> source,
+      std::vector<size_t> lines)
+      : VideoFrameRepresentationWrapper(std::move(source)),
+        lines_(std::move(lines)) {}
+
+  // Batch |lines| of every frame in |frames| (clamped to the source range).
+  // On failure the batch is dropped and all reads go to the source.
+  bool load(FrameIDRange frames) {
+    loaded_ = false;
+    if (!source_) return false;
+    const FrameIDRange available = source_->frame_range();
+    frames.first = std::max(frames.first, available.first);
+    frames.last = std::min(frames.last, available.last);
+    const auto params = source_->get_video_parameters();
+    if (frames.empty() || !params) return false;
+    width_ = static_cast<size_t>(params->frame_width_nominal);
+    if (!source_->read_lines(frames, lines_, batch_)) return false;
+    frames_ = frames;
+    loaded_ = true;
+    return true;
+  }
+
+  // Frames currently served from the batch; empty when nothing is loaded.
+  FrameIDRange loaded_range() const {
+    return loaded_ ? frames_ : FrameIDRange{1, 0};
+  }
+
+  const sample_type* get_line(FrameID id, size_t line) const override {
+    if (const sample_type* row = batched_row(id, line)) return row;
+    return VideoFrameRepresentation::get_line(id, line);
+  }
+  std::vector<sample_type> get_line_samples(FrameID id,
+                                            size_t line) const override {
+    if (const sample_type* row = batched_row(id, line)) {
+      return std::vector<sample_type>(row, row + width_);
+    }
+    return source_ ? source_->get_line_samples(id, line)
+                   : std::vector<sample_type>{};
+  }
+  bool read_lines(FrameIDRange frames, const std::vector<size_t>& lines,
+                  std::vector<sample_type>& out) const override {
+    if (!source_) {
+      out.clear();
+      return false;
+    }
+    return source_->read_lines(frames, lines, out);
+  }
+  FrameHandle acquire_frame(FrameID id) const override {
+    return source_ ? source_->acquire_frame(id) : nullptr;
+  }
+
+ private:
+  const sample_type* batched_row(FrameID id, size_t line) const {
+    if (!loaded_ || !frames_.contains(id)) return nullptr;
+    const auto it = std::find(lines_.begin(), lines_.end(), line);
+    if (it == lines_.end()) return nullptr;
+    const size_t row =
+        static_cast<size_t>(id - frames_.first) * lines_.size() +
+        static_cast<size_t>(it - lines_.begin());
+    return batch_.data() + row * width_;
+  }
+
+  std::vector<size_t> lines_;
+  std::vector<sample_type> batch_;
+  FrameIDRange frames_;
+  size_t width_ = 0;
+  bool loaded_ = false;
+};
+
+}  // namespace orc
@@ -12,10 +12,13 @@
 // SDK TIER: support — compiled-into-plugin utility. NOT part of the binary
 // ABI; changes never force an ABI bump (recompile the plugin at your leisure).
 
+#include <orc/stage/metrics.h>
+
 #include <functional>
 #include <list>
 #include <mutex>
 #include <optional>
+#include <string>
 #include <unordered_map>
 
 namespace orc {
@@ -45,6 +48,36 @@ class LRUCache {
   LRUCache(LRUCache&&) = delete;
   LRUCache& operator=(LRUCache&&) = delete;
 
+  /// Which lookups bind_metrics() counts as hits and misses.
+  enum class CountedLookup {
+    kFetch,     ///< get() and get_ptr()
+    kContains,  ///< contains(), for caches filled by a check-then-put helper
+  };
+
+  /**
+   * @brief Count lookups in the host metrics registry
+   *
+   * The lookups selected by @p counted then feed orc_cache_hits_total and
+   * orc_cache_misses_total, labelled cache=@p cache_name. Caches accessed
+   * through an ensure-cached helper (contains(), fill on a miss, then
+   * get_ptr()) count kContains so every access is counted once. Call before
+   * the cache is shared between threads. A null @p metrics leaves the cache
+   * uncounted.
+   */
+  void bind_metrics(IMetricsRegistry* metrics, const std::string& cache_name,
+                    CountedLookup counted = CountedLookup::kFetch) {
+    if (!metrics) {
+      return;
+    }
+    const std::string labels = "cache=" + cache_name;
+    hits_ = metrics->counter("orc_cache_hits_total",
+                             "Cache lookups that found their entry",
+                             labels.c_str());
+    misses_ = metrics->counter("orc_cache_misses_total",
+                               "Cache lookups that missed", labels.c_str());
+    counted_ = counted;
+  }
+
   /**
    * @brief Get value from cache
    * @param key Key to look up
@@ -53,6 +86,7 @@ class LRUCache {
   std::optional<Value> get(const Key& key) {
     std::lock_guard<std::mutex> lock(mutex_);
     auto it = map_.find(key);
+    count_lookup(CountedLookup::kFetch, it != map_.end());
     if (it == map_.end()) {
       return std::nullopt;
     }
@@ -72,6 +106,7 @@ class LRUCache {
   const Value* get_ptr(const Key& key) {
     std::lock_guard<std::mutex> lock(mutex_);
     auto it = map_.find(key);
+    count_lookup(CountedLookup::kFetch, it != map_.end());
     if (it == map_.end()) {
       return nullptr;
     }
@@ -152,7 +187,9 @@ class LRUCache {
    */
   bool contains(const Key& key) const {
     std::lock_guard<std::mutex> lock(mutex_);
-    return map_.find(key) != map_.end();
+    const bool found = map_.find(key) != map_.end();
+    count_lookup(CountedLookup::kContains, found);
+    return found;
   }
 
   /**
@@ -164,6 +201,27 @@ class LRUCache {
     lru_list_.clear();
   }
 
+  /**
+   * @brief Remove every entry whose key satisfies @p pred
+   * @param pred Callable taking const Key& and returning bool
+   * @return Number of entries removed
+   */
+  template <typename Pred>
+  size_t erase_if(Pred pred) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t removed = 0;
+    for (auto it = lru_list_.begin(); it != lru_list_.end();) {
+      if (pred(static_cast<const Key&>(it->first))) {
+        map_.erase(it->first);
+        it = lru_list_.erase(it);
+        ++removed;
+      } else {
+        ++it;
+      }
+    }
+    return removed;
+  }
+
   /**
    * @brief Get current number of entries in cache
    */
@@ -178,8 +236,23 @@ class LRUCache {
   size_t max_size() const { return max_size_; }
 
  private:
+  void count_lookup(CountedLookup lookup, bool hit) const {
+    if (lookup != counted_) {
+      return;
+    }
+    IMetricCounter* counter = hit ? hits_ : misses_;
+    if (counter) {
+      counter->add(1);
+    }
+  }
+
   size_t max_size_;
 
+  // Host metrics counters; null until bind_metrics()
+  IMetricCounter* hits_ = nullptr;
+  IMetricCounter* misses_ = nullptr;
+  CountedLookup counted_ = CountedLookup::kFetch;
+
   // List of (key, value) pairs in LRU order (front = most recent)
   mutable std::list<std::pair<Key, Value>> lru_list_;
 
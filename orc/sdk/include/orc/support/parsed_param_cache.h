@@ -0,0 +1,84 @@
+/*
+ * File:        parsed_param_cache.h
+ * Module:      decode-orc Plugin SDK (stage contract)
+ * Purpose:     Shared, parse-once cache for large stage parameter values
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 Simon Inns
+ */
+
+#pragma once
+
+// SDK TIER: support — compiled-into-plugin utility. NOT part of the binary
+// ABI; changes never force an ABI bump (recompile the plugin at your leisure).
+
+#include <orc/stage/blob_store.h>
+#include <orc/support/lru_cache.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace orc {
+
+/**
+ * @brief Parse-once cache for a stage's map-like STRING parameter
+ *
+ * The host rebuilds the DAG, and with it every stage instance, after each
+ * edit, so a per-instance parse would re-run for every rebuild. A
+ * function-local static ParsedParamCache instead hands every instance the
+ * same immutable parsed structure for as long as the parameter value is
+ * unchanged. Values are either inline text or blob references (see
+ * IBlobStore); references are keyed by their content hash, so the text itself
+ * is neither hashed nor copied on a hit.
+ *
+ * @code
+ *   static ParsedParamCache<DropoutMap> cache;
+ *   auto map = cache.get(value, plugin::get_blob_store(), &parse_map);
+ *   if (!map) throw DAGExecutionError("dropout map blob missing");
+ * @endcode
+ *
+ * Thread-safe: Yes (LRUCache). Two threads missing on the same value may
+ * both parse it; either result is kept.
+ *
+ * @tparam T Parsed structure; must be constructible from the parser result.
+ */
+template <typename T>
+class ParsedParamCache {
+ public:
+  /// @param max_entries Distinct values kept parsed (a few covers undo/redo).
+  explicit ParsedParamCache(size_t max_entries = 4) : cache_(max_entries) {}
+
+  /**
+   * @brief Parsed form of @p value
+   * @param value Parameter text or blob reference
+   * @param store Blob store used to resolve references; may be null
+   * @param parse Callable taking const std::string& and returning T
+   * @return Shared parsed structure, or nullptr when @p value is a reference
+   *         @p store cannot resolve
+   */
+  template <typename Parser>
+  std::shared_ptr<const T> get(const std::string& value,
+                               const IBlobStore* store, Parser&& parse) {
+    if (auto cached = cache_.get(value)) {
+      return *cached;
+    }
+    std::shared_ptr<const T> parsed;
+    if (is_blob_ref(value)) {
+      const auto text = store ? store->get(value) : nullptr;
+      if (!text) {
+        return nullptr;
+      }
+      parsed = std::make_shared<const T>(std::forward<Parser>(parse)(*text));
+    } else {
+      parsed = std::make_shared<const T>(std::forward<Parser>(parse)(value));
+    }
+    cache_.put(value, parsed);
+    return parsed;
+  }
+
+ private:
+  LRUCache<std::string, std::shared_ptr<const T>> cache_;
+};
+
+}  // namespace orc
@@ -18,6 +18,7 @@
 #include <orc/stage/preview/stage_preview_capability.h>
 #include <orc/stage/video_frame_representation.h>
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -75,13 +76,18 @@ std::vector<PreviewOption> get_standard_preview_options(
  *        and sequential layouts: the mask maps each display row back to its
  *        weaved (frame-flat) line, so the sequential layout gets one active
  *        band per field.  No cropping or rescaling is applied.
- * @return Preview image (invalid if option unknown or rendering fails)
+ * @param cancelled Optional cancel check, polled before each line fetch (a
+ *        line fetch may load a whole field).  Once it reports true the
+ *        render stops and returns an invalid image.
+ * @return Preview image (invalid if option unknown, rendering fails or the
+ *         render was cancelled)
  */
 PreviewImage render_standard_preview(
     const std::shared_ptr<const VideoFrameRepresentation>& representation,
     const std::string& option_id, uint64_t index,
     PreviewNavigationHint hint = PreviewNavigationHint::Random,
-    bool mask_inactive_area = false);
+    bool mask_inactive_area = false,
+    const std::function<bool()>& cancelled = nullptr);
 
 }  // namespace PreviewHelpers
 
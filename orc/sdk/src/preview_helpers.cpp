@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -129,7 +130,7 @@ std::vector<PreviewOption> get_standard_preview_options(
 PreviewImage render_standard_preview(
     const std::shared_ptr<const VideoFrameRepresentation>& representation,
     const std::string& option_id, uint64_t index, PreviewNavigationHint hint,
-    bool mask_inactive_area) {
+    bool mask_inactive_area, const std::function<bool()>& cancelled) {
   (void)hint;
   PreviewImage result{};
 
@@ -232,6 +233,10 @@ PreviewImage render_standard_preview(
   result.rgb_data.resize(static_cast<size_t>(width) * height * 3);
 
   for (uint32_t display_row = 0; display_row < height; ++display_row) {
+    if (cancelled && cancelled()) {
+      return PreviewImage{};
+    }
+
     size_t buf_line;
     if (do_interlace) {
       const bool use_field1 = (display_row % 2 == 0) == field1_on_even_rows;
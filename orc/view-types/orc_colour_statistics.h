@@ -0,0 +1,100 @@
+/*
+ * File:        orc_colour_statistics.h
+ * Module:      orc-view-types
+ * Purpose:     Public API types for whole-recording colour statistics
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * SPDX-FileCopyrightText: 2026 decode-orc contributors
+ */
+
+#ifndef ORC_PUBLIC_ORC_COLOUR_STATISTICS_H
+#define ORC_PUBLIC_ORC_COLOUR_STATISTICS_H
+
+#include <orc/stage/common_types.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "orc_histogram.h"
+
+namespace orc {
+
+/**
+ * @brief U/V density and luma histogram accumulated over many decoded frames.
+ *
+ * Filled by the colour statistics analysis from the active picture of every
+ * frame it decodes. Counts are plain sums, so partial results from separate
+ * threads or frame ranges combine with merge().
+ *
+ * U and V are normalised like VectorscopeData: divided by the full
+ * active-video swing (cvbs_white − cvbs_blanking) and clamped to ±1, so the
+ * edge bins also hold any clipped chroma. The grid is row-major with V
+ * increasing upwards: uv_density[v_bin * kUVBinCount + u_bin], bin 0 at −1.
+ *
+ * The luma histogram uses the VideoHistogramData bins (kYRangeMin % to
+ * kYRangeMax % of black-to-white); samples outside that range are not binned.
+ */
+struct ColourStatisticsData {
+  static constexpr size_t kUVBinCount = 256;
+  static constexpr size_t kYBinCount = VideoHistogramData::kBinCount;
+  static constexpr double kYRangeMin = VideoHistogramData::kRangeMin;
+  static constexpr double kYRangeMax = VideoHistogramData::kRangeMax;
+
+  std::vector<uint64_t> uv_density =
+      std::vector<uint64_t>(kUVBinCount * kUVBinCount, 0);
+  std::array<uint64_t, kYBinCount> y_bins{};
+
+  VideoSystem system{VideoSystem::Unknown};
+
+  // CVBS_U10_4FSC anchor points (same convention as VideoHistogramData),
+  // taken from the first decoded frame.
+  double cvbs_blanking{0.0};
+  double cvbs_black{0.0};
+  double cvbs_white{1023.0};
+
+  uint64_t frames_total{0};    ///< Frames the pass visits
+  uint64_t frames_decoded{0};  ///< Frames accumulated so far
+  uint64_t frames_failed{0};   ///< Frames the decoder did not return
+  uint64_t sample_count{0};    ///< Active-picture samples accumulated
+
+  uint64_t uv_count(size_t u_bin, size_t v_bin) const {
+    return uv_density[v_bin * kUVBinCount + u_bin];
+  }
+
+  /// Add @p other's counts; levels and system are taken from @p other when
+  /// this holds no frames yet. frames_total is left unchanged.
+  void merge(const ColourStatisticsData& other) {
+    if (frames_decoded == 0 && other.frames_decoded > 0) {
+      system = other.system;
+      cvbs_blanking = other.cvbs_blanking;
+      cvbs_black = other.cvbs_black;
+      cvbs_white = other.cvbs_white;
+    }
+    for (size_t i = 0; i < uv_density.size() && i < other.uv_density.size();
+         ++i) {
+      uv_density[i] += other.uv_density[i];
+    }
+    for (size_t i = 0; i < kYBinCount; ++i) {
+      y_bins[i] += other.y_bins[i];
+    }
+    frames_decoded += other.frames_decoded;
+    frames_failed += other.frames_failed;
+    sample_count += other.sample_count;
+  }
+
+  /// Zero the counts, keeping frames_total.
+  void clear_counts() {
+    std::fill(uv_density.begin(), uv_density.end(), 0);
+    y_bins.fill(0);
+    frames_decoded = 0;
+    frames_failed = 0;
+    sample_count = 0;
+  }
+};
+
+}  // namespace orc
+
+#endif  // ORC_PUBLIC_ORC_COLOUR_STATISTICS_H
@@ -23,6 +23,7 @@ fi
 # spanning one or more 6-space-indented continuation lines and is always the
 # last field of an entry, so everything from `summary:` up to the next `- abi:`
 # item belongs to it (joined with single spaces, folded-scalar semantics).
+# `notes` is omitted from the table.
 emit_rows() {
     awk '
         function flush() {
@@ -39,6 +40,7 @@ emit_rows() {
         /^    api:/     { v=$0; sub(/^    api:[[:space:]]*/,"",v); gsub(/"/,"",v); api=v; insumm=0; next }
         /^    cause:/   { insumm=0; next }
         /^    contracts:/ { insumm=0; next }
+        /^    notes:/   { insumm=0; next }
         /^      -[[:space:]]/ { if (!insumm) next }
         /^    summary:/ { insumm=1; next }
         {